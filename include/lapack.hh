@@ -20,5 +20,16 @@ const char* lapackpp_id();
 }  // namespace lapack
 
 #include "lapack/wrappers.hh"
+#include "lapack/plan.hh"
+#include "lapack/allocator.hh"
+#include "lapack/work_size_cache.hh"
+#include "lapack/ilp64_dispatch.hh"
+#include "lapack/dispatch.hh"
+#include "lapack/stats.hh"
+#include "lapack/batch.hh"
+#include "lapack/batching_executor.hh"
+#include "lapack/compact.hh"
+#include "lapack/fixed.hh"
+#include "lapack/recursive.hh"
 
 #endif // LAPACK_HH
@@ -0,0 +1,124 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_ALLOCATOR_HH
+#define LAPACK_ALLOCATOR_HH
+
+#include "lapack/util.hh"
+
+#include <cstddef>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Sets the high-water mark, in bytes, of the per-thread workspace arena.
+///
+/// Wrappers allocate their temporaries (work arrays, 32-bit pivot copies,
+/// etc.) from a per-thread arena when it is enabled, instead of from the
+/// heap. The arena grows on demand up to this limit and is reset when
+/// the wrapper returns, so repeated calls reuse the same memory without
+/// taking a global lock. Requests that do not fit fall back to the heap.
+///
+/// The default is 0, which disables the arena, unless the environment
+/// variable `LAPACKPP_ARENA_LIMIT` is set, e.g., `LAPACKPP_ARENA_LIMIT=64M`.
+/// Suffixes K, M, G are powers of 1024.
+///
+/// @param[in] bytes
+///     Maximum arena size per thread. 0 disables the arena.
+///
+/// @ingroup auxiliary
+void set_arena_limit( size_t bytes );
+
+/// @return high-water mark, in bytes, of the per-thread workspace arena.
+/// @see set_arena_limit
+/// @ingroup auxiliary
+size_t get_arena_limit();
+
+/// Frees the calling thread's arena, if it has no outstanding allocations,
+/// and resets its high-water mark.
+/// The arena is otherwise kept until the thread exits.
+/// @ingroup auxiliary
+void release_arena();
+
+/// @return size, in bytes, of the calling thread's arena buffer;
+/// 0 if it has none. The buffer grows to the most workspace any one
+/// wrapper call has needed, up to the limit.
+/// @see set_arena_limit
+/// @ingroup auxiliary
+size_t get_arena_capacity();
+
+//------------------------------------------------------------------------------
+/// Placement of large workspace allocations, those of at least 2 MiB, such
+/// as the O(n^2) workspace of gesdd and heevd with vectors. Smaller
+/// allocations always use 64-byte aligned heap memory. Policies other
+/// than Default require Linux; elsewhere they behave as Default.
+/// @ingroup auxiliary
+enum class AllocPolicy : char {
+    /// 64-byte aligned heap memory.
+    Default    = 'D',
+
+    /// 2 MiB aligned, advised to use transparent huge pages
+    /// (madvise MADV_HUGEPAGE), reducing TLB misses.
+    HugePage   = 'H',
+
+    /// Fresh pages first touched in parallel by the OpenMP threads,
+    /// with a static schedule, so pages are spread over the NUMA nodes of
+    /// the threads, rather than all placed on the calling thread's node.
+    /// Without OpenMP, pages are placed by whichever thread first writes
+    /// them.
+    FirstTouch = 'F',
+
+    /// Pages interleaved round-robin across all NUMA nodes
+    /// (mbind MPOL_INTERLEAVE), spreading memory traffic.
+    Interleave = 'I',
+};
+
+inline char alloc_policy2char( lapack::AllocPolicy policy )
+{
+    return char( policy );
+}
+
+inline lapack::AllocPolicy char2alloc_policy( char policy )
+{
+    policy = char( toupper( policy ));
+    lapack_error_if( policy != 'D' && policy != 'H'
+                     && policy != 'F' && policy != 'I' );
+    return lapack::AllocPolicy( policy );
+}
+
+inline const char* alloc_policy2str( lapack::AllocPolicy policy )
+{
+    switch (policy) {
+        case lapack::AllocPolicy::Default:    return "default";
+        case lapack::AllocPolicy::HugePage:   return "hugepage";
+        case lapack::AllocPolicy::FirstTouch: return "firsttouch";
+        case lapack::AllocPolicy::Interleave: return "interleave";
+    }
+    return "?";
+}
+
+//------------------------------------------------------------------------------
+/// Sets the placement policy for large workspace allocations,
+/// including the per-thread arena's buffer.
+///
+/// The default is Default, unless the environment variable
+/// `LAPACKPP_ALLOC_POLICY` is set to one of default, hugepage,
+/// firsttouch, or interleave (or its first letter).
+///
+/// @param[in] policy
+///     Policy for later allocations. Memory already allocated is
+///     unaffected and is freed correctly.
+///
+/// @ingroup auxiliary
+void set_alloc_policy( AllocPolicy policy );
+
+/// @return placement policy for large workspace allocations.
+/// @see set_alloc_policy
+/// @ingroup auxiliary
+AllocPolicy get_alloc_policy();
+
+}  // namespace lapack
+
+#endif // LAPACK_ALLOCATOR_HH
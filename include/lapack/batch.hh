@@ -0,0 +1,1568 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCH_HH
+#define LAPACK_BATCH_HH
+
+#include "lapack/util.hh"
+
+#include <vector>
+
+namespace lapack {
+
+// Batch routines solve many independent problems in one call, running the
+// problems in parallel using OpenMP threads, if LAPACK++ is compiled with
+// OpenMP. Each routine has two variants:
+//
+// - Pointer-array, for problems of varying size: each argument is a
+//   std::vector with either one element, applied to all problems, or
+//   one element per problem. Arrays are given as vectors of pointers.
+//   Per-problem results are returned in std::vector info.
+//   Problems are scheduled by their flop count: any large enough to
+//   dominate the load are solved first, one at a time, using threaded
+//   BLAS; the rest run in parallel, one per thread, largest first.
+//   See set_batch_large_gflop.
+//
+// - Strided, for problems of fixed size: problem i uses the arrays
+//   starting at A + i*strideA, etc. Per-problem results are returned
+//   in info[ 0 : batch-1 ].
+//
+// Tridiagonal routines, gtsv_batch, ptsv_batch, etc., have only the strided
+// variant: they vectorize across groups of systems of the same size,
+// like the compact routines in lapack/compact.hh.
+//
+// All arguments are checked before any problem is solved, throwing Error
+// if any is invalid. Numerical failures, such as a singular matrix, are
+// reported in info for that problem without throwing.
+
+//------------------------------------------------------------------------------
+/// Sets the cost, in Gflop, above which pointer-array batch routines may
+/// solve a problem by itself, using all threads of a multithreaded BLAS,
+/// instead of on a single thread in parallel with other problems.
+///
+/// A problem is solved by itself if its cost is at least this threshold
+/// and it is more than an even share of the batch per thread, i.e.,
+/// solving it on one thread would leave the others idle. Such problems
+/// run first, in decreasing order of cost; the remaining problems then
+/// run in parallel, one per thread, largest first, each thread taking
+/// the next problem when it finishes one.
+///
+/// The default is 0.1 Gflop, roughly getrf or potrf with n = 500 to 700,
+/// unless the environment variable `LAPACKPP_BATCH_LARGE_GFLOP` is set.
+///
+/// @param[in] gflop
+///     Threshold in Gflop. 0 runs every problem on a single thread.
+///
+/// @ingroup auxiliary
+void set_batch_large_gflop( double gflop );
+
+/// @return cost, in Gflop, above which pointer-array batch routines may
+///     solve a problem by itself using multithreaded BLAS.
+/// @see set_batch_large_gflop
+/// @ingroup auxiliary
+double get_batch_large_gflop();
+
+// Batch routines are in alphabetical order.
+
+// -----------------------------------------------------------------------------
+void gbsv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbsv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbsv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbsv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbsv_batch(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gbsv_batch(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gbsv_batch(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gbsv_batch(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gbtrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< float* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbtrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< double* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbtrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< std::complex<float>* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbtrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< std::complex<double>* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbtrf_batch(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    float* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+void gbtrf_batch(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    double* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+void gbtrf_batch(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<float>* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+void gbtrf_batch(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<double>* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gbtrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbtrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbtrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbtrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gbtrs_batch(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float const* AB, int64_t ldab, int64_t strideAB,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gbtrs_batch(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double const* AB, int64_t ldab, int64_t strideAB,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gbtrs_batch(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float> const* AB, int64_t ldab, int64_t strideAB,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gbtrs_batch(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double> const* AB, int64_t ldab, int64_t strideAB,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gemqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* T, int64_t tsize, int64_t strideT,
+    float* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info );
+
+void gemqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* T, int64_t tsize, int64_t strideT,
+    double* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info );
+
+void gemqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* T, int64_t tsize, int64_t strideT,
+    std::complex<float>* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info );
+
+void gemqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* T, int64_t tsize, int64_t strideT,
+    std::complex<double>* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void geqr_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* T, int64_t tsize, int64_t strideT,
+    size_t batch,
+    int64_t* info );
+
+void geqr_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* T, int64_t tsize, int64_t strideT,
+    size_t batch,
+    int64_t* info );
+
+void geqr_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* T, int64_t tsize, int64_t strideT,
+    size_t batch,
+    int64_t* info );
+
+void geqr_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* T, int64_t tsize, int64_t strideT,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& tau_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& tau_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& tau_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& tau_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* tau, int64_t stride_tau,
+    size_t batch,
+    int64_t* info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* tau, int64_t stride_tau,
+    size_t batch,
+    int64_t* info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* tau, int64_t stride_tau,
+    size_t batch,
+    int64_t* info );
+
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* tau, int64_t stride_tau,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gesdd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& S_array,
+    std::vector< float* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< float* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesdd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& S_array,
+    std::vector< double* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< double* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesdd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& S_array,
+    std::vector< std::complex<float>* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< std::complex<float>* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesdd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& S_array,
+    std::vector< std::complex<double>* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< std::complex<double>* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    float* U, int64_t ldu, int64_t strideU,
+    float* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    double* U, int64_t ldu, int64_t strideU,
+    double* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    std::complex<float>* U, int64_t ldu, int64_t strideU,
+    std::complex<float>* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info );
+
+void gesdd_batch(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    std::complex<double>* U, int64_t ldu, int64_t strideU,
+    std::complex<double>* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gesv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gesvd_batch(
+    std::vector< lapack::Job > const& jobu,
+    std::vector< lapack::Job > const& jobvt,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& S_array,
+    std::vector< float* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< float* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesvd_batch(
+    std::vector< lapack::Job > const& jobu,
+    std::vector< lapack::Job > const& jobvt,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& S_array,
+    std::vector< double* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< double* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesvd_batch(
+    std::vector< lapack::Job > const& jobu,
+    std::vector< lapack::Job > const& jobvt,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& S_array,
+    std::vector< std::complex<float>* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< std::complex<float>* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesvd_batch(
+    std::vector< lapack::Job > const& jobu,
+    std::vector< lapack::Job > const& jobvt,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& S_array,
+    std::vector< std::complex<double>* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< std::complex<double>* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    float* U, int64_t ldu, int64_t strideU,
+    float* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    double* U, int64_t ldu, int64_t strideU,
+    double* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    std::complex<float>* U, int64_t ldu, int64_t strideU,
+    std::complex<float>* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info );
+
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    std::complex<double>* U, int64_t ldu, int64_t strideU,
+    std::complex<double>* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gtsv_batch(
+    int64_t n, int64_t nrhs,
+    float* DL, int64_t strideDL,
+    float* D,  int64_t strideD,
+    float* DU, int64_t strideDU,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gtsv_batch(
+    int64_t n, int64_t nrhs,
+    double* DL, int64_t strideDL,
+    double* D,  int64_t strideD,
+    double* DU, int64_t strideDU,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gtsv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DL, int64_t strideDL,
+    std::complex<float>* D,  int64_t strideD,
+    std::complex<float>* DU, int64_t strideDU,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gtsv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DL, int64_t strideDL,
+    std::complex<double>* D,  int64_t strideD,
+    std::complex<double>* DU, int64_t strideDU,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gttrf_batch(
+    int64_t n,
+    float* DL,  int64_t strideDL,
+    float* D,   int64_t strideD,
+    float* DU,  int64_t strideDU,
+    float* DU2, int64_t strideDU2,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+void gttrf_batch(
+    int64_t n,
+    double* DL,  int64_t strideDL,
+    double* D,   int64_t strideD,
+    double* DU,  int64_t strideDU,
+    double* DU2, int64_t strideDU2,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+void gttrf_batch(
+    int64_t n,
+    std::complex<float>* DL,  int64_t strideDL,
+    std::complex<float>* D,   int64_t strideD,
+    std::complex<float>* DU,  int64_t strideDU,
+    std::complex<float>* DU2, int64_t strideDU2,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+void gttrf_batch(
+    int64_t n,
+    std::complex<double>* DL,  int64_t strideDL,
+    std::complex<double>* D,   int64_t strideD,
+    std::complex<double>* DU,  int64_t strideDU,
+    std::complex<double>* DU2, int64_t strideDU2,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DL,  int64_t strideDL,
+    float const* D,   int64_t strideD,
+    float const* DU,  int64_t strideDU,
+    float const* DU2, int64_t strideDU2,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DL,  int64_t strideDL,
+    double const* D,   int64_t strideD,
+    double const* DU,  int64_t strideDU,
+    double const* DU2, int64_t strideDU2,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DL,  int64_t strideDL,
+    std::complex<float> const* D,   int64_t strideD,
+    std::complex<float> const* DU,  int64_t strideDU,
+    std::complex<float> const* DU2, int64_t strideDU2,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DL,  int64_t strideDL,
+    std::complex<double> const* D,   int64_t strideD,
+    std::complex<double> const* DU,  int64_t strideDU,
+    std::complex<double> const* DU2, int64_t strideDU2,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void syevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+// heevd_batch alias to syevd_batch
+inline void heevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    syevd_batch( jobz, uplo, n, Aarray, lda, W_array, batch, info );
+}
+
+void syevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+// heevd_batch alias to syevd_batch
+inline void heevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    syevd_batch( jobz, uplo, n, Aarray, lda, W_array, batch, info );
+}
+
+void heevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void heevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void syevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    size_t batch,
+    int64_t* info );
+
+// heevd_batch alias to syevd_batch
+inline void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    size_t batch,
+    int64_t* info )
+{
+    syevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW, batch, info );
+}
+
+void syevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    size_t batch,
+    int64_t* info );
+
+// heevd_batch alias to syevd_batch
+inline void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    size_t batch,
+    int64_t* info )
+{
+    syevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW, batch, info );
+}
+
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    size_t batch,
+    int64_t* info );
+
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void ormqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& tau_array,
+    std::vector< float* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+// unmqr_batch alias to ormqr_batch
+inline void unmqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& tau_array,
+    std::vector< float* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    ormqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                 Carray, ldc, batch, info );
+}
+
+void ormqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& tau_array,
+    std::vector< double* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+// unmqr_batch alias to ormqr_batch
+inline void unmqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& tau_array,
+    std::vector< double* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    ormqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                 Carray, ldc, batch, info );
+}
+
+void ormqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* tau, int64_t stride_tau,
+    float* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info );
+
+// unmqr_batch alias to ormqr_batch
+inline void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* tau, int64_t stride_tau,
+    float* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    ormqr_batch( side, trans, m, n, k, A, lda, strideA, tau, stride_tau,
+                 C, ldc, strideC, batch, info );
+}
+
+void ormqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* tau, int64_t stride_tau,
+    double* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info );
+
+// unmqr_batch alias to ormqr_batch
+inline void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* tau, int64_t stride_tau,
+    double* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    ormqr_batch( side, trans, m, n, k, A, lda, strideA, tau, stride_tau,
+                 C, ldc, strideC, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void posv_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void posv_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info );
+
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void potri_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potri_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potri_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potri_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potri_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info );
+
+void potri_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info );
+
+void potri_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info );
+
+void potri_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void ptsv_batch(
+    int64_t n, int64_t nrhs,
+    float* D, int64_t strideD,
+    float* E, int64_t strideE,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void ptsv_batch(
+    int64_t n, int64_t nrhs,
+    double* D, int64_t strideD,
+    double* E, int64_t strideE,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void ptsv_batch(
+    int64_t n, int64_t nrhs,
+    float* D, int64_t strideD,
+    std::complex<float>* E, int64_t strideE,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void ptsv_batch(
+    int64_t n, int64_t nrhs,
+    double* D, int64_t strideD,
+    std::complex<double>* E, int64_t strideE,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void pttrf_batch(
+    int64_t n,
+    float* D, int64_t strideD,
+    float* E, int64_t strideE,
+    size_t batch,
+    int64_t* info );
+
+void pttrf_batch(
+    int64_t n,
+    double* D, int64_t strideD,
+    double* E, int64_t strideE,
+    size_t batch,
+    int64_t* info );
+
+void pttrf_batch(
+    int64_t n,
+    float* D, int64_t strideD,
+    std::complex<float>* E, int64_t strideE,
+    size_t batch,
+    int64_t* info );
+
+void pttrf_batch(
+    int64_t n,
+    double* D, int64_t strideD,
+    std::complex<double>* E, int64_t strideE,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, int64_t strideD,
+    float const* E, int64_t strideE,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, int64_t strideD,
+    double const* E, int64_t strideE,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, int64_t strideD,
+    std::complex<float> const* E, int64_t strideE,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, int64_t strideD,
+    std::complex<double> const* E, int64_t strideE,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void unmqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& tau_array,
+    std::vector< std::complex<float>* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void unmqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& tau_array,
+    std::vector< std::complex<double>* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info );
+
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* tau, int64_t stride_tau,
+    std::complex<float>* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info );
+
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* tau, int64_t stride_tau,
+    std::complex<double>* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info );
+
+}  // namespace lapack
+
+#endif // LAPACK_BATCH_HH
@@ -0,0 +1,123 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_BATCHING_EXECUTOR_HH
+#define LAPACK_BATCHING_EXECUTOR_HH
+
+#include "lapack/util.hh"
+
+#include <chrono>
+#include <future>
+#include <memory>
+
+namespace lapack {
+
+namespace internal {
+struct BatchRequest;
+}
+
+//------------------------------------------------------------------------------
+/// Collects small, independent solves submitted concurrently from many
+/// threads and runs them together through the batch routines in
+/// lapack/batch.hh, so callers that each issue one small problem get
+/// the throughput of a batch without being rewritten.
+///
+/// Each submit call, e.g., `getrf`, queues the request and returns
+/// immediately with a future for its info. Producers push onto a
+/// lock-free queue; they take a lock only to wake the executor's worker
+/// thread if it is idle. The worker groups requests by routine,
+/// precision, options, and dimensions, including leading dimensions.
+/// A group is solved by one pointer-array batch call, e.g.,
+/// `lapack::getrf_batch`, as soon as it has `max_batch` requests, or
+/// when its oldest request has waited `max_delay`, whichever is first.
+/// The batch call runs problems in parallel using OpenMP threads.
+///
+/// The arrays passed to a submit call must stay valid, and must not be
+/// accessed by the caller, until its future is ready. The future holds
+/// the problem's info, as returned by the corresponding LAPACK routine.
+/// Invalid arguments throw Error from the submit call, so one bad
+/// request cannot fail the rest of its batch.
+///
+/// Destroying the executor solves all requests already submitted, then
+/// joins the worker thread. Submit calls must not race with destruction.
+///
+/// Example:
+///
+///     lapack::BatchingExecutor executor;
+///     // on each request thread
+///     std::future< int64_t > info = executor.getrf( n, n, A, lda, ipiv );
+///     ...
+///     if (info.get() != 0) { ... }
+///
+/// @ingroup auxiliary
+class BatchingExecutor
+{
+public:
+    /// Creates an executor and starts its worker thread.
+    ///
+    /// @param[in] max_batch
+    ///     Largest number of requests solved in one batch call.
+    ///     max_batch >= 1.
+    ///
+    /// @param[in] max_delay
+    ///     Longest time a request waits for others of the same shape
+    ///     before its group is solved. 0 solves requests as soon as the
+    ///     worker sees them, batching only those that arrived together.
+    BatchingExecutor(
+        int64_t max_batch = 256,
+        std::chrono::microseconds max_delay = std::chrono::microseconds( 100 ) );
+
+    ~BatchingExecutor();
+
+    BatchingExecutor( BatchingExecutor const& ) = delete;
+    BatchingExecutor& operator = ( BatchingExecutor const& ) = delete;
+
+    /// Queues `lapack::getrf`. Arguments are as in `lapack::getrf`.
+    template <typename scalar_t>
+    std::future< int64_t > getrf(
+        int64_t m, int64_t n,
+        scalar_t* A, int64_t lda,
+        int64_t* ipiv );
+
+    /// Queues `lapack::potrf`. Arguments are as in `lapack::potrf`.
+    template <typename scalar_t>
+    std::future< int64_t > potrf(
+        lapack::Uplo uplo, int64_t n,
+        scalar_t* A, int64_t lda );
+
+    /// Queues `lapack::gels`. Arguments are as in `lapack::gels`.
+    template <typename scalar_t>
+    std::future< int64_t > gels(
+        lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+        scalar_t* A, int64_t lda,
+        scalar_t* B, int64_t ldb );
+
+    /// Queues `lapack::heevd`, or `lapack::syevd` for real matrices.
+    /// Arguments are as in `lapack::heevd`.
+    template <typename scalar_t>
+    std::future< int64_t > heevd(
+        lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+        scalar_t* A, int64_t lda,
+        blas::real_type< scalar_t >* W );
+
+    /// @return largest number of requests solved in one batch call.
+    int64_t max_batch() const { return max_batch_; }
+
+    /// @return longest time a request waits for others of its shape.
+    std::chrono::microseconds max_delay() const { return max_delay_; }
+
+private:
+    class Impl;
+
+    void submit( internal::BatchRequest* request );
+
+    int64_t max_batch_;
+    std::chrono::microseconds max_delay_;
+    std::unique_ptr< Impl > impl_;
+};
+
+}  // namespace lapack
+
+#endif // LAPACK_BATCHING_EXECUTOR_HH
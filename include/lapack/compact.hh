@@ -0,0 +1,460 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_COMPACT_HH
+#define LAPACK_COMPACT_HH
+
+#include "lapack/util.hh"
+
+#include <cstdint>
+#include <vector>
+
+namespace lapack {
+
+// Compact batch routines work on batches of many small matrices of the
+// same size, e.g., 4-by-4 to 16-by-16, which are too small to vectorize
+// individually. In the compact format, matrices are interleaved in groups
+// of compact_width matrices: element (i, j) of each matrix in a group is
+// stored contiguously, so each operation vectorizes across the matrices
+// of a group. Problem b is in lane l = b % w of group g = b / w, where
+// w = compact_width< scalar_t >(). For an m-by-n compact batch Ac,
+// element (i, j) of problem b is
+//
+//     Ac[ g*m*n*w + (i + j*m)*w + l ].
+//
+// The last group is padded to w matrices; pack_compact fills padding with
+// identity, so padding never causes a numerical failure.
+// Use pack_compact to convert a pointer-array batch of column-major
+// matrices to compact format, and unpack_compact to convert back.
+// Groups run in parallel using OpenMP threads, if LAPACK++ is compiled
+// with OpenMP.
+//
+// This is in alphabetical order.
+
+//------------------------------------------------------------------------------
+/// @return the number of matrices interleaved in each group of the compact
+/// format: as many as fit in a 512-bit vector, so groups fill one AVX-512
+/// register, or two AVX2 registers.
+/// @ingroup auxiliary
+template <typename scalar_t>
+constexpr int64_t compact_width()
+{
+    return 64 / int64_t( sizeof( scalar_t ) );
+}
+
+/// @return the number of elements of a compact batch of batch m-by-n
+/// matrices, including padding: roundup( batch, compact_width ) * m * n.
+/// @ingroup auxiliary
+template <typename scalar_t>
+constexpr int64_t compact_size( int64_t m, int64_t n, size_t batch )
+{
+    return (int64_t( batch ) + compact_width< scalar_t >() - 1)
+           / compact_width< scalar_t >() * compact_width< scalar_t >() * m * n;
+}
+
+// -----------------------------------------------------------------------------
+void getrf_compact(
+    int64_t n,
+    float* Ac,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info );
+
+void getrf_compact(
+    int64_t n,
+    double* Ac,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info );
+
+void getrf_compact(
+    int64_t n,
+    std::complex<float>* Ac,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info );
+
+void getrf_compact(
+    int64_t n,
+    std::complex<double>* Ac,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void getrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* Ac,
+    int64_t const* ipiv,
+    float* Bc,
+    size_t batch );
+
+void getrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* Ac,
+    int64_t const* ipiv,
+    double* Bc,
+    size_t batch );
+
+void getrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* Ac,
+    int64_t const* ipiv,
+    std::complex<float>* Bc,
+    size_t batch );
+
+void getrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* Ac,
+    int64_t const* ipiv,
+    std::complex<double>* Bc,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+void gtsv_compact(
+    int64_t n, int64_t nrhs,
+    float* DLc,
+    float* Dc,
+    float* DUc,
+    float* Bc,
+    size_t batch,
+    int64_t* info );
+
+void gtsv_compact(
+    int64_t n, int64_t nrhs,
+    double* DLc,
+    double* Dc,
+    double* DUc,
+    double* Bc,
+    size_t batch,
+    int64_t* info );
+
+void gtsv_compact(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DLc,
+    std::complex<float>* Dc,
+    std::complex<float>* DUc,
+    std::complex<float>* Bc,
+    size_t batch,
+    int64_t* info );
+
+void gtsv_compact(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DLc,
+    std::complex<double>* Dc,
+    std::complex<double>* DUc,
+    std::complex<double>* Bc,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gttrf_compact(
+    int64_t n,
+    float* DLc,
+    float* Dc,
+    float* DUc,
+    float* DU2c,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info );
+
+void gttrf_compact(
+    int64_t n,
+    double* DLc,
+    double* Dc,
+    double* DUc,
+    double* DU2c,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info );
+
+void gttrf_compact(
+    int64_t n,
+    std::complex<float>* DLc,
+    std::complex<float>* Dc,
+    std::complex<float>* DUc,
+    std::complex<float>* DU2c,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info );
+
+void gttrf_compact(
+    int64_t n,
+    std::complex<double>* DLc,
+    std::complex<double>* Dc,
+    std::complex<double>* DUc,
+    std::complex<double>* DU2c,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void gttrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DLc,
+    float const* Dc,
+    float const* DUc,
+    float const* DU2c,
+    int64_t const* ipiv,
+    float* Bc,
+    size_t batch );
+
+void gttrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DLc,
+    double const* Dc,
+    double const* DUc,
+    double const* DU2c,
+    int64_t const* ipiv,
+    double* Bc,
+    size_t batch );
+
+void gttrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DLc,
+    std::complex<float> const* Dc,
+    std::complex<float> const* DUc,
+    std::complex<float> const* DU2c,
+    int64_t const* ipiv,
+    std::complex<float>* Bc,
+    size_t batch );
+
+void gttrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DLc,
+    std::complex<double> const* Dc,
+    std::complex<double> const* DUc,
+    std::complex<double> const* DU2c,
+    int64_t const* ipiv,
+    std::complex<double>* Bc,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+void pack_compact(
+    int64_t m, int64_t n,
+    std::vector< float* > const& Aarray, int64_t lda,
+    float* Ac,
+    size_t batch );
+
+void pack_compact(
+    int64_t m, int64_t n,
+    std::vector< double* > const& Aarray, int64_t lda,
+    double* Ac,
+    size_t batch );
+
+void pack_compact(
+    int64_t m, int64_t n,
+    std::vector< std::complex<float>* > const& Aarray, int64_t lda,
+    std::complex<float>* Ac,
+    size_t batch );
+
+void pack_compact(
+    int64_t m, int64_t n,
+    std::vector< std::complex<double>* > const& Aarray, int64_t lda,
+    std::complex<double>* Ac,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+void potrf_compact(
+    lapack::Uplo uplo, int64_t n,
+    float* Ac,
+    size_t batch,
+    int64_t* info );
+
+void potrf_compact(
+    lapack::Uplo uplo, int64_t n,
+    double* Ac,
+    size_t batch,
+    int64_t* info );
+
+void potrf_compact(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* Ac,
+    size_t batch,
+    int64_t* info );
+
+void potrf_compact(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* Ac,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void potrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* Ac,
+    float* Bc,
+    size_t batch );
+
+void potrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* Ac,
+    double* Bc,
+    size_t batch );
+
+void potrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* Ac,
+    std::complex<float>* Bc,
+    size_t batch );
+
+void potrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* Ac,
+    std::complex<double>* Bc,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+void ptsv_compact(
+    int64_t n, int64_t nrhs,
+    float* Dc,
+    float* Ec,
+    float* Bc,
+    size_t batch,
+    int64_t* info );
+
+void ptsv_compact(
+    int64_t n, int64_t nrhs,
+    double* Dc,
+    double* Ec,
+    double* Bc,
+    size_t batch,
+    int64_t* info );
+
+void ptsv_compact(
+    int64_t n, int64_t nrhs,
+    float* Dc,
+    std::complex<float>* Ec,
+    std::complex<float>* Bc,
+    size_t batch,
+    int64_t* info );
+
+void ptsv_compact(
+    int64_t n, int64_t nrhs,
+    double* Dc,
+    std::complex<double>* Ec,
+    std::complex<double>* Bc,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void pttrf_compact(
+    int64_t n,
+    float* Dc,
+    float* Ec,
+    size_t batch,
+    int64_t* info );
+
+void pttrf_compact(
+    int64_t n,
+    double* Dc,
+    double* Ec,
+    size_t batch,
+    int64_t* info );
+
+void pttrf_compact(
+    int64_t n,
+    float* Dc,
+    std::complex<float>* Ec,
+    size_t batch,
+    int64_t* info );
+
+void pttrf_compact(
+    int64_t n,
+    double* Dc,
+    std::complex<double>* Ec,
+    size_t batch,
+    int64_t* info );
+
+// -----------------------------------------------------------------------------
+void pttrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* Dc,
+    float const* Ec,
+    float* Bc,
+    size_t batch );
+
+void pttrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* Dc,
+    double const* Ec,
+    double* Bc,
+    size_t batch );
+
+void pttrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* Dc,
+    std::complex<float> const* Ec,
+    std::complex<float>* Bc,
+    size_t batch );
+
+void pttrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* Dc,
+    std::complex<double> const* Ec,
+    std::complex<double>* Bc,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+void trsm_compact(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const* Ac,
+    float* Bc,
+    size_t batch );
+
+void trsm_compact(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* Ac,
+    double* Bc,
+    size_t batch );
+
+void trsm_compact(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* Ac,
+    std::complex<float>* Bc,
+    size_t batch );
+
+void trsm_compact(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* Ac,
+    std::complex<double>* Bc,
+    size_t batch );
+
+// -----------------------------------------------------------------------------
+void unpack_compact(
+    int64_t m, int64_t n,
+    float const* Ac,
+    std::vector< float* > const& Aarray, int64_t lda,
+    size_t batch );
+
+void unpack_compact(
+    int64_t m, int64_t n,
+    double const* Ac,
+    std::vector< double* > const& Aarray, int64_t lda,
+    size_t batch );
+
+void unpack_compact(
+    int64_t m, int64_t n,
+    std::complex<float> const* Ac,
+    std::vector< std::complex<float>* > const& Aarray, int64_t lda,
+    size_t batch );
+
+void unpack_compact(
+    int64_t m, int64_t n,
+    std::complex<double> const* Ac,
+    std::vector< std::complex<double>* > const& Aarray, int64_t lda,
+    size_t batch );
+
+}  // namespace lapack
+
+#endif // LAPACK_COMPACT_HH
@@ -0,0 +1,60 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_DISPATCH_HH
+#define LAPACK_DISPATCH_HH
+
+#include <cstdint>
+#include <string>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Loads a dispatch table that routes calls to LAPACK libraries loaded at
+/// runtime, instead of the LAPACK library LAPACK++ was linked with.
+/// Requires LAPACK++ built with `use_dispatch`; otherwise throws Error.
+///
+/// The table is read at first use from the file named by the environment
+/// variable `LAPACKPP_DISPATCH`, if set, and can be replaced later by
+/// calling this function. It is usually written by `test/calibrate_dispatch.py`,
+/// which times each backend with the tester. Example:
+///
+///     # backend  name      shared library
+///     backend    openblas  /usr/lib/x86_64-linux-gnu/libopenblas.so.0
+///     backend    mkl       libmkl_rt.so
+///
+///     # routine  max_n     backend
+///     dpotrf     512       openblas
+///     dpotrf     *         mkl
+///     *          *         default
+///
+/// For each call, the first rule whose routine matches (or is `*`) and
+/// whose max_n is at least the problem size n (or is `*`) selects the
+/// backend; `default` is the linked LAPACK, which is also used if no rule
+/// matches or the backend lacks the routine. Backends must use the same
+/// integer size as `lapack_int` and the same Fortran name mangling.
+/// Rules and symbols are resolved when the table is loaded, so calls only
+/// look up the problem size. Libraries stay loaded until the process exits.
+/// Loading a table clears the workspace size cache, since backends may
+/// need different workspace.
+///
+/// Routines currently dispatched: potrf, getrf, gesdd, heevd, syevd.
+///
+/// @param[in] filename
+///     Dispatch table to load. An empty name removes the table.
+///
+/// @ingroup auxiliary
+void load_dispatch_table( std::string const& filename );
+
+/// @return name of the backend that a call to `routine`, e.g., "dpotrf",
+/// with problem size n would use; "default" for the linked LAPACK,
+/// including for routines that are not dispatched.
+/// @see load_dispatch_table
+/// @ingroup auxiliary
+std::string dispatch_backend( std::string const& routine, int64_t n );
+
+}  // namespace lapack
+
+#endif // LAPACK_DISPATCH_HH
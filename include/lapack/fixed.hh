@@ -0,0 +1,528 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_FIXED_HH
+#define LAPACK_FIXED_HH
+
+#include "lapack/util.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace lapack {
+
+// Fixed-size routines factor and solve one small matrix whose dimensions
+// are compile-time constants, e.g., 2-by-2 to 8-by-8. For such sizes, the
+// argument checks, lapack_int conversions, and Fortran call of the
+// runtime routines cost far more than the arithmetic. These are header
+// only, so the loops, which have constant trip counts, unroll and inline
+// into the caller. They have the same arguments as the runtime routines,
+// without the dimensions, and the same results and info, e.g.,
+//
+//     lapack::getrf( n, n, A, lda, ipiv );  // runtime n
+//     lapack::fixed::getrf< 4 >( A, lda, ipiv );  // n = 4
+//
+// The algorithms are LAPACK's unblocked ones, getf2, potf2, and geqr2,
+// so results agree with the runtime routines to rounding.
+namespace fixed {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// |re| + |im|, as used by LAPACK's i[cz]amax to choose pivots.
+template <typename scalar_t>
+inline blas::real_type< scalar_t > abs1( scalar_t a )
+{
+    return std::abs( blas::real( a ) ) + std::abs( blas::imag( a ) );
+}
+
+// Returns re + i*im, or re for real types.
+template <typename scalar_t>
+inline scalar_t make_scalar(
+    blas::real_type< scalar_t > re, blas::real_type< scalar_t > im )
+{
+    if constexpr (blas::is_complex< scalar_t >::value)
+        return scalar_t( re, im );
+    else
+        return re;
+}
+
+// Returns ||x||_2, scaled to avoid overflow and underflow, as in nrm2.
+template <typename scalar_t>
+inline blas::real_type< scalar_t > nrm2( int64_t n, scalar_t const* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    real_t scale = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        scale = std::max( scale, std::max( std::abs( blas::real( x[ i ] ) ),
+                                           std::abs( blas::imag( x[ i ] ) ) ) );
+    }
+    if (scale == 0 || ! std::isfinite( scale ))
+        return scale;
+    real_t sum = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        real_t re = blas::real( x[ i ] ) / scale;
+        real_t im = blas::imag( x[ i ] ) / scale;
+        sum += re*re + im*im;
+    }
+    return scale * std::sqrt( sum );
+}
+
+// Returns sqrt( x^2 + y^2 + z^2 ), avoiding overflow, as in lapy3.
+template <typename real_t>
+inline real_t lapy3( real_t x, real_t y, real_t z )
+{
+    real_t w = std::max( { std::abs( x ), std::abs( y ), std::abs( z ) } );
+    if (w == 0)
+        return std::abs( x ) + std::abs( y ) + std::abs( z );
+    x /= w;
+    y /= w;
+    z /= w;
+    return w * std::sqrt( x*x + y*y + z*z );
+}
+
+//------------------------------------------------------------------------------
+// Generates an elementary reflector H such that H^H [ alpha; x ] =
+// [ beta; 0 ], with beta real, as in larfg. On exit, alpha is beta,
+// x is overwritten by v( 1 : n-1 ), and tau is returned.
+template <typename scalar_t>
+scalar_t larfg( int64_t n, scalar_t& alpha, scalar_t* x )
+{
+    using real_t = blas::real_type< scalar_t >;
+    if (n <= 0)
+        return 0;
+
+    real_t xnorm = nrm2( n - 1, x );
+    real_t alphr = blas::real( alpha );
+    real_t alphi = blas::imag( alpha );
+    if (xnorm == 0 && alphi == 0)
+        return 0;
+
+    real_t beta = -std::copysign( lapy3( alphr, alphi, xnorm ), alphr );
+    const real_t safmin = std::numeric_limits< real_t >::min()
+                        / std::numeric_limits< real_t >::epsilon();
+    const real_t rsafmn = 1 / safmin;
+
+    // if beta is tiny, scale up x and alpha, and recompute beta
+    int knt = 0;
+    if (std::abs( beta ) < safmin) {
+        do {
+            ++knt;
+            for (int64_t i = 0; i < n - 1; ++i)
+                x[ i ] *= rsafmn;
+            beta  *= rsafmn;
+            alphr *= rsafmn;
+            alphi *= rsafmn;
+        } while (std::abs( beta ) < safmin && knt < 20);
+        xnorm = nrm2( n - 1, x );
+        beta = -std::copysign( lapy3( alphr, alphi, xnorm ), alphr );
+    }
+
+    scalar_t tau = make_scalar< scalar_t >( (beta - alphr) / beta,
+                                            -alphi / beta );
+    scalar_t scal = scalar_t( 1 ) / (make_scalar< scalar_t >( alphr, alphi )
+                                     - beta);
+    for (int64_t i = 0; i < n - 1; ++i)
+        x[ i ] *= scal;
+
+    for (int j = 0; j < knt; ++j)
+        beta *= safmin;
+    alpha = beta;
+    return tau;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// Computes an LU factorization of an n-by-n matrix A using partial
+/// pivoting with row interchanges, for n fixed at compile time.
+/// Same as `lapack::getrf` with m = n.
+///
+/// @tparam n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On exit, the factors L and U from the factorization
+///     A = P*L*U; the unit diagonal elements of L are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n. The pivot indices; for 1 <= i <= n,
+///     row i of the matrix was interchanged with row ipiv(i).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero. The
+///     factorization has been completed, but U is exactly singular.
+///
+/// @ingroup gesv_computational
+template <int n, typename scalar_t>
+int64_t getrf( scalar_t* A, int64_t lda, int64_t* ipiv )
+{
+    using real_t = blas::real_type< scalar_t >;
+    static_assert( n >= 0, "n must be non-negative" );
+    lapack_error_if( lda < std::max( 1, n ) );
+
+    const real_t sfmin = std::numeric_limits< real_t >::min();
+    int64_t info = 0;
+    for (int j = 0; j < n; ++j) {
+        // find pivot
+        int jp = j;
+        real_t amax = internal::abs1( A[ j + j*lda ] );
+        for (int i = j + 1; i < n; ++i) {
+            real_t a = internal::abs1( A[ i + j*lda ] );
+            if (a > amax) {
+                amax = a;
+                jp = i;
+            }
+        }
+        ipiv[ j ] = jp + 1;
+
+        if (A[ jp + j*lda ] != scalar_t( 0 )) {
+            // swap rows j and jp
+            if (jp != j) {
+                for (int k = 0; k < n; ++k)
+                    std::swap( A[ j + k*lda ], A[ jp + k*lda ] );
+            }
+            // compute elements j+1 : n-1 of column j
+            scalar_t pivot = A[ j + j*lda ];
+            if (std::abs( pivot ) >= sfmin) {
+                scalar_t rcp = scalar_t( 1 ) / pivot;
+                for (int i = j + 1; i < n; ++i)
+                    A[ i + j*lda ] *= rcp;
+            }
+            else {
+                for (int i = j + 1; i < n; ++i)
+                    A[ i + j*lda ] /= pivot;
+            }
+        }
+        else if (info == 0) {
+            info = j + 1;
+        }
+
+        // update trailing submatrix
+        for (int k = j + 1; k < n; ++k) {
+            scalar_t t = A[ j + k*lda ];
+            for (int i = j + 1; i < n; ++i)
+                A[ i + k*lda ] -= A[ i + j*lda ] * t;
+        }
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+/// Solves a system of linear equations op(A) X = B with an n-by-n matrix A
+/// using the LU factorization computed by `lapack::fixed::getrf`,
+/// for n fixed at compile time. Same as `lapack::getrs`.
+///
+/// @tparam n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] trans
+///     The form of the system of equations:
+///     - lapack::Op::NoTrans:   $A   X = B$,
+///     - lapack::Op::Trans:     $A^T X = B$,
+///     - lapack::Op::ConjTrans: $A^H X = B$.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in] A
+///     The factors L and U from `lapack::fixed::getrf`.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] ipiv
+///     The pivot indices from `lapack::fixed::getrf`.
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On exit, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup gesv_computational
+template <int n, typename scalar_t>
+int64_t getrs(
+    lapack::Op trans, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    using blas::conj;
+    static_assert( n >= 0, "n must be non-negative" );
+    lapack_error_if( trans != Op::NoTrans &&
+                     trans != Op::Trans &&
+                     trans != Op::ConjTrans );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < std::max( 1, n ) );
+    lapack_error_if( ldb < std::max( 1, n ) );
+
+    const bool do_conj = (trans == Op::ConjTrans);
+    auto opA = [A, lda, do_conj]( int i, int j ) {
+        scalar_t a = A[ i + j*lda ];
+        return do_conj ? conj( a ) : a;
+    };
+
+    for (int64_t k = 0; k < nrhs; ++k) {
+        scalar_t* b = &B[ k*ldb ];
+        if (trans == Op::NoTrans) {
+            // apply row interchanges, then solve L y = b, U x = y
+            for (int j = 0; j < n; ++j) {
+                int p = int( ipiv[ j ] ) - 1;
+                if (p != j)
+                    std::swap( b[ j ], b[ p ] );
+            }
+            for (int j = 0; j < n; ++j) {
+                for (int i = j + 1; i < n; ++i)
+                    b[ i ] -= A[ i + j*lda ] * b[ j ];
+            }
+            for (int j = n - 1; j >= 0; --j) {
+                b[ j ] /= A[ j + j*lda ];
+                for (int i = 0; i < j; ++i)
+                    b[ i ] -= A[ i + j*lda ] * b[ j ];
+            }
+        }
+        else {
+            // solve op(U) y = b, op(L) x = y, then apply row interchanges
+            // in reverse
+            for (int j = 0; j < n; ++j) {
+                scalar_t t = b[ j ];
+                for (int i = 0; i < j; ++i)
+                    t -= opA( i, j ) * b[ i ];
+                b[ j ] = t / opA( j, j );
+            }
+            for (int j = n - 1; j >= 0; --j) {
+                scalar_t t = b[ j ];
+                for (int i = j + 1; i < n; ++i)
+                    t -= opA( i, j ) * b[ i ];
+                b[ j ] = t;
+            }
+            for (int j = n - 1; j >= 0; --j) {
+                int p = int( ipiv[ j ] ) - 1;
+                if (p != j)
+                    std::swap( b[ j ], b[ p ] );
+            }
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes the Cholesky factorization of an n-by-n Hermitian positive
+/// definite matrix A, for n fixed at compile time.
+/// Same as `lapack::potrf`.
+///
+/// @tparam n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored; $A = U^H U$;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored; $A = L L^H$.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On exit, if return value = 0, the factor U or L.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///     positive definite, and the factorization could not be completed.
+///
+/// @ingroup posv_computational
+template <int n, typename scalar_t>
+int64_t potrf( lapack::Uplo uplo, scalar_t* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+    static_assert( n >= 0, "n must be non-negative" );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( lda < std::max( 1, n ) );
+
+    for (int j = 0; j < n; ++j) {
+        // compute U(j,j) or L(j,j), and test for non-positive definiteness
+        real_t ajj = real( A[ j + j*lda ] );
+        for (int i = 0; i < j; ++i) {
+            scalar_t a = (uplo == Uplo::Upper ? A[ i + j*lda ]
+                                              : A[ j + i*lda ]);
+            ajj -= real( conj( a ) * a );
+        }
+        if (ajj <= 0 || std::isnan( ajj )) {
+            A[ j + j*lda ] = ajj;
+            return j + 1;
+        }
+        ajj = std::sqrt( ajj );
+        A[ j + j*lda ] = ajj;
+        real_t rcp = 1 / ajj;
+
+        if (uplo == Uplo::Upper) {
+            // compute elements j+1 : n-1 of row j
+            for (int k = j + 1; k < n; ++k) {
+                scalar_t t = A[ j + k*lda ];
+                for (int i = 0; i < j; ++i)
+                    t -= conj( A[ i + j*lda ] ) * A[ i + k*lda ];
+                A[ j + k*lda ] = t * rcp;
+            }
+        }
+        else {
+            // compute elements j+1 : n-1 of column j
+            for (int k = j + 1; k < n; ++k) {
+                scalar_t t = A[ k + j*lda ];
+                for (int i = 0; i < j; ++i)
+                    t -= A[ k + i*lda ] * conj( A[ j + i*lda ] );
+                A[ k + j*lda ] = t * rcp;
+            }
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Solves a system of linear equations A X = B with an n-by-n Hermitian
+/// positive definite matrix A using the Cholesky factorization computed
+/// by `lapack::fixed::potrf`, for n fixed at compile time.
+/// Same as `lapack::potrs`.
+///
+/// @tparam n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] nrhs
+///     The number of right hand sides. nrhs >= 0.
+///
+/// @param[in] A
+///     The factor U or L from `lapack::fixed::potrf`.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in,out] B
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On exit, the solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup posv_computational
+template <int n, typename scalar_t>
+int64_t potrs(
+    lapack::Uplo uplo, int64_t nrhs,
+    scalar_t const* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    using blas::conj;
+    static_assert( n >= 0, "n must be non-negative" );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < std::max( 1, n ) );
+    lapack_error_if( ldb < std::max( 1, n ) );
+
+    // With R = U, or R = L^H, A = R^H R; R(i,j) is
+    // A(i,j) if upper, conj( A(j,i) ) if lower.
+    const bool upper = (uplo == Uplo::Upper);
+    auto R = [A, lda, upper]( int i, int j ) {
+        return upper ? A[ i + j*lda ] : conj( A[ j + i*lda ] );
+    };
+
+    for (int64_t k = 0; k < nrhs; ++k) {
+        scalar_t* b = &B[ k*ldb ];
+        // solve R^H y = b
+        for (int j = 0; j < n; ++j) {
+            scalar_t t = b[ j ];
+            for (int i = 0; i < j; ++i)
+                t -= conj( R( i, j ) ) * b[ i ];
+            b[ j ] = t / conj( R( j, j ) );
+        }
+        // solve R x = y
+        for (int j = n - 1; j >= 0; --j) {
+            b[ j ] /= R( j, j );
+            for (int i = 0; i < j; ++i)
+                b[ i ] -= R( i, j ) * b[ j ];
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/// Computes a QR factorization of an m-by-n matrix A, A = Q R,
+/// for m and n fixed at compile time. Same as `lapack::geqrf`.
+///
+/// @tparam m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @tparam n
+///     The number of columns of the matrix A. n >= 0. Defaults to m.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On exit, the elements on and above the diagonal contain the
+///     min(m,n)-by-n upper trapezoidal matrix R; the elements below the
+///     diagonal, with the array tau, represent Q as a product of
+///     min(m,n) elementary reflectors, as in `lapack::geqrf`.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] tau
+///     The vector tau of length min(m,n).
+///     The scalar factors of the elementary reflectors.
+///
+/// @return = 0: successful exit
+///
+/// @ingroup geqrf
+template <int m, int n = m, typename scalar_t>
+int64_t geqrf( scalar_t* A, int64_t lda, scalar_t* tau )
+{
+    using blas::conj;
+    static_assert( m >= 0 && n >= 0, "m and n must be non-negative" );
+    lapack_error_if( lda < std::max( 1, m ) );
+
+    constexpr int k = std::min( m, n );
+    for (int i = 0; i < k; ++i) {
+        // generate reflector H(i) to annihilate A(i+1:m-1, i)
+        scalar_t* v = &A[ i + i*lda ];
+        tau[ i ] = internal::larfg( m - i, v[ 0 ], &v[ 1 ] );
+
+        // apply H(i)^H = I - conj( tau ) v v^H to A(i:m-1, i+1:n-1)
+        // from the left, with v(0) = 1
+        scalar_t ctau = conj( tau[ i ] );
+        if (ctau != scalar_t( 0 )) {
+            for (int j = i + 1; j < n; ++j) {
+                scalar_t* a = &A[ i + j*lda ];
+                scalar_t w = a[ 0 ];
+                for (int r = 1; r < m - i; ++r)
+                    w += conj( v[ r ] ) * a[ r ];
+                w *= ctau;
+                a[ 0 ] -= w;
+                for (int r = 1; r < m - i; ++r)
+                    a[ r ] -= v[ r ] * w;
+            }
+        }
+    }
+    return 0;
+}
+
+}  // namespace fixed
+}  // namespace lapack
+
+#endif // LAPACK_FIXED_HH
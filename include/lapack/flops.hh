@@ -52,6 +52,22 @@ inline double fmuls_getrs(double n, double nrhs)
 inline double fadds_getrs(double n, double nrhs)
     { return nrhs*n*(n - 1); }
 
+//------------------------------------------------------------ gbtrf
+// Band LU of an m-by-n matrix, taking U to have the full kl+ku
+// superdiagonals of fill-in; overestimates for the last kl+ku columns.
+inline double fmuls_gbtrf(double m, double n, double kl, double ku)
+    { return (m < n ? m : n)*kl*(kl + ku + 1); }
+
+inline double fadds_gbtrf(double m, double n, double kl, double ku)
+    { return (m < n ? m : n)*kl*(kl + ku); }
+
+//------------------------------------------------------------ gbtrs
+inline double fmuls_gbtrs(double n, double kl, double ku, double nrhs)
+    { return nrhs*n*(2*kl + ku + 1); }
+
+inline double fadds_gbtrs(double n, double kl, double ku, double nrhs)
+    { return nrhs*n*(2*kl + ku); }
+
 //------------------------------------------------------------ potrf
 inline double fmuls_potrf(double n)
     { return 1./6*n*n*n + 0.5*n*n + 1./3.*n; }
@@ -352,6 +368,15 @@ public:
     static double getrs(double n, double nrhs)
         { return 1e-9 * (mul_ops*fmuls_getrs(n, nrhs) + add_ops*fadds_getrs(n, nrhs)); }
 
+    static double gbsv(double n, double kl, double ku, double nrhs)
+        { return gbtrf(n, n, kl, ku) + gbtrs(n, kl, ku, nrhs); }
+
+    static double gbtrf(double m, double n, double kl, double ku)
+        { return 1e-9 * (mul_ops*fmuls_gbtrf(m, n, kl, ku) + add_ops*fadds_gbtrf(m, n, kl, ku)); }
+
+    static double gbtrs(double n, double kl, double ku, double nrhs)
+        { return 1e-9 * (mul_ops*fmuls_gbtrs(n, kl, ku, nrhs) + add_ops*fadds_gbtrs(n, kl, ku, nrhs)); }
+
     // Cholesky
     static double posv(double n, double nrhs)
         { return potrf(n) + potrs(n, nrhs); }
@@ -0,0 +1,283 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_FORTRAN_64_H
+#define LAPACK_FORTRAN_64_H
+
+#include "lapack/fortran.h"
+
+#include <stdint.h>
+
+/* Prototypes for a 64-bit integer LAPACK linked alongside the 32-bit
+*  integer (LP64) LAPACK, with symbols distinguished by LAPACK_ILP64_SUFFIX.
+*  Wrappers call these when dimensions are too large for lapack_int.
+*  Not needed if LAPACK itself uses 64-bit integers (LAPACK_ILP64). */
+#if defined(LAPACK_ILP64_SUFFIX) && ! defined(LAPACK_ILP64)
+
+#define LAPACK_HAVE_ILP64_DISPATCH
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LAPACK_sgetrf_64 LAPACK_GLOBAL_SUFFIX(sgetrf,SGETRF)
+void LAPACK_sgetrf_64(
+    int64_t const* m, int64_t const* n,
+    float* a, int64_t const* lda,
+    int64_t* ipiv,
+    int64_t* info );
+
+#define LAPACK_dgetrf_64 LAPACK_GLOBAL_SUFFIX(dgetrf,DGETRF)
+void LAPACK_dgetrf_64(
+    int64_t const* m, int64_t const* n,
+    double* a, int64_t const* lda,
+    int64_t* ipiv,
+    int64_t* info );
+
+#define LAPACK_cgetrf_64 LAPACK_GLOBAL_SUFFIX(cgetrf,CGETRF)
+void LAPACK_cgetrf_64(
+    int64_t const* m, int64_t const* n,
+    lapack_complex_float* a, int64_t const* lda,
+    int64_t* ipiv,
+    int64_t* info );
+
+#define LAPACK_zgetrf_64 LAPACK_GLOBAL_SUFFIX(zgetrf,ZGETRF)
+void LAPACK_zgetrf_64(
+    int64_t const* m, int64_t const* n,
+    lapack_complex_double* a, int64_t const* lda,
+    int64_t* ipiv,
+    int64_t* info );
+
+#define LAPACK_sgetrs_64 LAPACK_GLOBAL_SUFFIX(sgetrs,SGETRS)
+void LAPACK_sgetrs_64(
+    char const* trans,
+    int64_t const* n, int64_t const* nrhs,
+    float const* a, int64_t const* lda,
+    int64_t const* ipiv,
+    float* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned trans_len
+    #endif
+    );
+
+#define LAPACK_dgetrs_64 LAPACK_GLOBAL_SUFFIX(dgetrs,DGETRS)
+void LAPACK_dgetrs_64(
+    char const* trans,
+    int64_t const* n, int64_t const* nrhs,
+    double const* a, int64_t const* lda,
+    int64_t const* ipiv,
+    double* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned trans_len
+    #endif
+    );
+
+#define LAPACK_cgetrs_64 LAPACK_GLOBAL_SUFFIX(cgetrs,CGETRS)
+void LAPACK_cgetrs_64(
+    char const* trans,
+    int64_t const* n, int64_t const* nrhs,
+    lapack_complex_float const* a, int64_t const* lda,
+    int64_t const* ipiv,
+    lapack_complex_float* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned trans_len
+    #endif
+    );
+
+#define LAPACK_zgetrs_64 LAPACK_GLOBAL_SUFFIX(zgetrs,ZGETRS)
+void LAPACK_zgetrs_64(
+    char const* trans,
+    int64_t const* n, int64_t const* nrhs,
+    lapack_complex_double const* a, int64_t const* lda,
+    int64_t const* ipiv,
+    lapack_complex_double* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned trans_len
+    #endif
+    );
+
+#define LAPACK_sgesv_64 LAPACK_GLOBAL_SUFFIX(sgesv,SGESV)
+void LAPACK_sgesv_64(
+    int64_t const* n, int64_t const* nrhs,
+    float* a, int64_t const* lda,
+    int64_t* ipiv,
+    float* b, int64_t const* ldb,
+    int64_t* info );
+
+#define LAPACK_dgesv_64 LAPACK_GLOBAL_SUFFIX(dgesv,DGESV)
+void LAPACK_dgesv_64(
+    int64_t const* n, int64_t const* nrhs,
+    double* a, int64_t const* lda,
+    int64_t* ipiv,
+    double* b, int64_t const* ldb,
+    int64_t* info );
+
+#define LAPACK_cgesv_64 LAPACK_GLOBAL_SUFFIX(cgesv,CGESV)
+void LAPACK_cgesv_64(
+    int64_t const* n, int64_t const* nrhs,
+    lapack_complex_float* a, int64_t const* lda,
+    int64_t* ipiv,
+    lapack_complex_float* b, int64_t const* ldb,
+    int64_t* info );
+
+#define LAPACK_zgesv_64 LAPACK_GLOBAL_SUFFIX(zgesv,ZGESV)
+void LAPACK_zgesv_64(
+    int64_t const* n, int64_t const* nrhs,
+    lapack_complex_double* a, int64_t const* lda,
+    int64_t* ipiv,
+    lapack_complex_double* b, int64_t const* ldb,
+    int64_t* info );
+
+#define LAPACK_spotrf_64 LAPACK_GLOBAL_SUFFIX(spotrf,SPOTRF)
+void LAPACK_spotrf_64(
+    char const* uplo,
+    int64_t const* n,
+    float* a, int64_t const* lda,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_dpotrf_64 LAPACK_GLOBAL_SUFFIX(dpotrf,DPOTRF)
+void LAPACK_dpotrf_64(
+    char const* uplo,
+    int64_t const* n,
+    double* a, int64_t const* lda,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_cpotrf_64 LAPACK_GLOBAL_SUFFIX(cpotrf,CPOTRF)
+void LAPACK_cpotrf_64(
+    char const* uplo,
+    int64_t const* n,
+    lapack_complex_float* a, int64_t const* lda,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_zpotrf_64 LAPACK_GLOBAL_SUFFIX(zpotrf,ZPOTRF)
+void LAPACK_zpotrf_64(
+    char const* uplo,
+    int64_t const* n,
+    lapack_complex_double* a, int64_t const* lda,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_spotrs_64 LAPACK_GLOBAL_SUFFIX(spotrs,SPOTRS)
+void LAPACK_spotrs_64(
+    char const* uplo,
+    int64_t const* n, int64_t const* nrhs,
+    float const* a, int64_t const* lda,
+    float* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_dpotrs_64 LAPACK_GLOBAL_SUFFIX(dpotrs,DPOTRS)
+void LAPACK_dpotrs_64(
+    char const* uplo,
+    int64_t const* n, int64_t const* nrhs,
+    double const* a, int64_t const* lda,
+    double* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_cpotrs_64 LAPACK_GLOBAL_SUFFIX(cpotrs,CPOTRS)
+void LAPACK_cpotrs_64(
+    char const* uplo,
+    int64_t const* n, int64_t const* nrhs,
+    lapack_complex_float const* a, int64_t const* lda,
+    lapack_complex_float* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_zpotrs_64 LAPACK_GLOBAL_SUFFIX(zpotrs,ZPOTRS)
+void LAPACK_zpotrs_64(
+    char const* uplo,
+    int64_t const* n, int64_t const* nrhs,
+    lapack_complex_double const* a, int64_t const* lda,
+    lapack_complex_double* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_sposv_64 LAPACK_GLOBAL_SUFFIX(sposv,SPOSV)
+void LAPACK_sposv_64(
+    char const* uplo,
+    int64_t const* n, int64_t const* nrhs,
+    float* a, int64_t const* lda,
+    float* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_dposv_64 LAPACK_GLOBAL_SUFFIX(dposv,DPOSV)
+void LAPACK_dposv_64(
+    char const* uplo,
+    int64_t const* n, int64_t const* nrhs,
+    double* a, int64_t const* lda,
+    double* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_cposv_64 LAPACK_GLOBAL_SUFFIX(cposv,CPOSV)
+void LAPACK_cposv_64(
+    char const* uplo,
+    int64_t const* n, int64_t const* nrhs,
+    lapack_complex_float* a, int64_t const* lda,
+    lapack_complex_float* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#define LAPACK_zposv_64 LAPACK_GLOBAL_SUFFIX(zposv,ZPOSV)
+void LAPACK_zposv_64(
+    char const* uplo,
+    int64_t const* n, int64_t const* nrhs,
+    lapack_complex_double* a, int64_t const* lda,
+    lapack_complex_double* b, int64_t const* ldb,
+    int64_t* info
+    #ifdef LAPACK_FORTRAN_STRLEN_END
+    , unsigned uplo_len
+    #endif
+    );
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif /* LAPACK_ILP64_SUFFIX && ! LAPACK_ILP64 */
+
+#endif /* LAPACK_FORTRAN_64_H */
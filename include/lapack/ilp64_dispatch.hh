@@ -0,0 +1,60 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_ILP64_DISPATCH_HH
+#define LAPACK_ILP64_DISPATCH_HH
+
+#include "lapack/config.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <limits>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Sets the largest dimension or matrix size (e.g., lda*n) that getrf,
+/// getrs, gesv, potrf, potrs, and posv pass to the 32-bit integer LAPACK.
+/// Larger problems call the suffixed 64-bit integer LAPACK instead.
+/// Only has an effect if LAPACK++ was built with `lapack_ilp64_suffix`.
+///
+/// The default, and maximum, is the largest lapack_int. A lower threshold
+/// sends small problems through the 64-bit integer LAPACK, which is
+/// intended for testing; e.g., 0 sends every non-empty problem.
+///
+/// @param[in] threshold
+///     Threshold. Negative values are raised to 0, and larger values
+///     than the largest lapack_int are reduced to it.
+///
+/// @ingroup auxiliary
+void set_ilp64_threshold( int64_t threshold );
+
+/// @return threshold above which problems call the 64-bit integer LAPACK.
+/// @see set_ilp64_threshold
+/// @ingroup auxiliary
+int64_t get_ilp64_threshold();
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Returns true if any of the values, typically dimensions and the number
+// of elements in each matrix (e.g., lda*n), exceeds limit, by default the
+// largest lapack_int.
+inline bool exceeds_lapack_int(
+    std::initializer_list< int64_t > values,
+    int64_t limit = std::numeric_limits< lapack_int >::max() )
+{
+    for (int64_t value : values) {
+        if (std::abs( value ) > limit)
+            return true;
+    }
+    return false;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_ILP64_DISPATCH_HH
@@ -27,4 +27,25 @@
     #endif
 #endif
 
+// -----------------------------------------------------------------------------
+// Name mangling for a second, 64-bit integer LAPACK whose symbols have a
+// suffix, set by LAPACK_ILP64_SUFFIX. E.g., with suffix _64 and
+// FORTRAN_ADD_, dgetrf becomes dgetrf_64_, as in OpenBLAS built with
+// SYMBOLSUFFIX=64_ or reference LAPACK built with BUILD_INDEX64_EXT_API.
+#if defined(LAPACK_ILP64_SUFFIX) && ! defined(LAPACK_GLOBAL_SUFFIX)
+    #define LAPACK_CONCAT_( a, b ) a##b
+    #define LAPACK_CONCAT( a, b ) LAPACK_CONCAT_( a, b )
+
+    #if defined(BLAS_FORTRAN_UPPER) || defined(LAPACK_FORTRAN_UPPER) || defined(LAPACK_GLOBAL_PATTERN_UC)
+        #define LAPACK_GLOBAL_SUFFIX( lower, UPPER ) \
+            LAPACK_CONCAT( UPPER, LAPACK_ILP64_SUFFIX )
+    #elif defined(BLAS_FORTRAN_LOWER) || defined(LAPACK_FORTRAN_LOWER) || defined(LAPACK_GLOBAL_PATTERN_LC)
+        #define LAPACK_GLOBAL_SUFFIX( lower, UPPER ) \
+            LAPACK_CONCAT( lower, LAPACK_ILP64_SUFFIX )
+    #else
+        #define LAPACK_GLOBAL_SUFFIX( lower, UPPER ) \
+            LAPACK_CONCAT( LAPACK_CONCAT( lower, LAPACK_ILP64_SUFFIX ), _ )
+    #endif
+#endif
+
 #endif  /* LAPACK_MANGLING_H */
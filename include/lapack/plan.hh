@@ -0,0 +1,177 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_PLAN_HH
+#define LAPACK_PLAN_HH
+
+#include "lapack/util.hh"
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Base class for plans. A plan fixes the job options and dimensions of a
+/// routine, queries its workspace once at construction, and owns that
+/// workspace, so each `execute` call makes just the compute call with no
+/// workspace query or allocation.
+///
+/// Plans are movable but not copyable. A plan's workspace is used by
+/// execute, so one plan must not be executed concurrently from several
+/// threads; use one plan per thread instead.
+///
+/// @ingroup plan
+template <typename scalar_t>
+class Plan
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    ~Plan();
+
+    Plan( Plan const& ) = delete;
+    Plan& operator = ( Plan const& ) = delete;
+
+    Plan( Plan&& other ) noexcept;
+    Plan& operator = ( Plan&& other ) noexcept;
+
+    /// @return length of the work array.
+    int64_t lwork() const { return lwork_; }
+
+    /// @return length of the real rwork array; 0 if not used.
+    int64_t lrwork() const { return lrwork_; }
+
+    /// @return length of the integer iwork array; 0 if not used.
+    int64_t liwork() const { return liwork_; }
+
+protected:
+    Plan() = default;
+
+    void allocate( int64_t lwork, int64_t lrwork, int64_t liwork );
+    void release();
+
+    // lengths are stored converted, as passed to LAPACK
+    scalar_t*   work_   = nullptr;
+    real_t*     rwork_  = nullptr;
+    lapack_int* iwork_  = nullptr;
+    lapack_int  lwork_  = 0;
+    lapack_int  lrwork_ = 0;
+    lapack_int  liwork_ = 0;
+};
+
+//------------------------------------------------------------------------------
+/// Plan for repeated `lapack::heevd` calls with the same
+/// jobz, uplo, n, and lda. Create using `lapack::plan_heevd`.
+/// @ingroup plan
+template <typename scalar_t>
+class HeevdPlan: public Plan< scalar_t >
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    HeevdPlan(
+        lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t lda );
+
+    int64_t execute( scalar_t* A, real_t* W );
+
+private:
+    // arguments converted for LAPACK
+    char jobz_;
+    char uplo_;
+    lapack_int n_;
+    lapack_int lda_;
+};
+
+//------------------------------------------------------------------------------
+/// Plan for repeated `lapack::gesvd` calls with the same
+/// jobu, jobvt, m, n, and leading dimensions. Create using `lapack::plan_gesvd`.
+/// @ingroup plan
+template <typename scalar_t>
+class GesvdPlan: public Plan< scalar_t >
+{
+public:
+    using real_t = blas::real_type< scalar_t >;
+
+    GesvdPlan(
+        lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+        int64_t lda, int64_t ldu, int64_t ldvt );
+
+    int64_t execute( scalar_t* A, real_t* S, scalar_t* U, scalar_t* VT );
+
+private:
+    // arguments converted for LAPACK
+    char jobu_;
+    char jobvt_;
+    lapack_int m_;
+    lapack_int n_;
+    lapack_int lda_;
+    lapack_int ldu_;
+    lapack_int ldvt_;
+};
+
+//------------------------------------------------------------------------------
+/// Plan for repeated `lapack::gels` calls with the same
+/// trans, m, n, nrhs, lda, and ldb. Create using `lapack::plan_gels`.
+/// @ingroup plan
+template <typename scalar_t>
+class GelsPlan: public Plan< scalar_t >
+{
+public:
+    GelsPlan(
+        lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+        int64_t lda, int64_t ldb );
+
+    int64_t execute( scalar_t* A, scalar_t* B );
+
+private:
+    // arguments converted for LAPACK
+    char trans_;
+    lapack_int m_;
+    lapack_int n_;
+    lapack_int nrhs_;
+    lapack_int lda_;
+    lapack_int ldb_;
+};
+
+//------------------------------------------------------------------------------
+/// Creates a plan for `lapack::heevd`. Arguments are as in `lapack::heevd`.
+/// Example:
+///
+///     auto plan = lapack::plan_heevd< double >( Job::Vec, Uplo::Lower, n, lda );
+///     for (...) {
+///         plan.execute( A, W );
+///     }
+///
+/// @ingroup plan
+template <typename scalar_t>
+HeevdPlan< scalar_t > plan_heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t lda )
+{
+    return HeevdPlan< scalar_t >( jobz, uplo, n, lda );
+}
+
+//------------------------------------------------------------------------------
+/// Creates a plan for `lapack::gesvd`. Arguments are as in `lapack::gesvd`.
+/// @ingroup plan
+template <typename scalar_t>
+GesvdPlan< scalar_t > plan_gesvd(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    int64_t lda, int64_t ldu, int64_t ldvt )
+{
+    return GesvdPlan< scalar_t >( jobu, jobvt, m, n, lda, ldu, ldvt );
+}
+
+//------------------------------------------------------------------------------
+/// Creates a plan for `lapack::gels`. Arguments are as in `lapack::gels`.
+/// @ingroup plan
+template <typename scalar_t>
+GelsPlan< scalar_t > plan_gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    int64_t lda, int64_t ldb )
+{
+    return GelsPlan< scalar_t >( trans, m, n, nrhs, lda, ldb );
+}
+
+}  // namespace lapack
+
+#endif // LAPACK_PLAN_HH
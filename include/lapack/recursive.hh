@@ -0,0 +1,92 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_RECURSIVE_HH
+#define LAPACK_RECURSIVE_HH
+
+#include "lapack/util.hh"
+
+#include <cstdint>
+
+namespace lapack {
+
+// Native recursive factorizations, implemented in C++ on top of BLAS++
+// rather than calling LAPACK. They split the matrix in half recursively,
+// as in getrf2 and potrf2, so almost all flops are in large trsm, gemm,
+// and herk calls, whatever the cache sizes, with no block size to tune.
+// The recursion stops at panels of a few columns, which are factored
+// unblocked, as in getf2 and potf2. They are meant for builds with
+// reference LAPACK, whose blocked getrf and potrf use a fixed block size
+// that may suit neither the cache sizes nor the thread count; an
+// optimized LAPACK is usually as fast or faster. Apart from rounding,
+// the factors, pivots, and info are the same as from getrf and potrf.
+// If LAPACK++ is built with use_recursive, lapack::getrf and
+// lapack::potrf call these instead of LAPACK.
+//
+// This is in alphabetical order.
+
+// -----------------------------------------------------------------------------
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+#ifndef LAPACK_ILP64
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv );
+
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv );
+
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv );
+
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv );
+#endif
+
+// -----------------------------------------------------------------------------
+int64_t potrf_recursive(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
+
+int64_t potrf_recursive(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
+
+int64_t potrf_recursive(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+int64_t potrf_recursive(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
+
+}  // namespace lapack
+
+#endif // LAPACK_RECURSIVE_HH
@@ -0,0 +1,65 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_STATS_HH
+#define LAPACK_STATS_HH
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Statistics for one routine, e.g., "dgetrf" or "zheevd_work", collected
+/// when LAPACK++ is built with `use_instrumentation`. Only the outermost
+/// LAPACK++ call on each thread is counted; e.g., the time heevd spends
+/// in heevd_work_size and heevd_work is attributed to heevd.
+/// @ingroup auxiliary
+struct RoutineStats
+{
+    /// Number of calls.
+    int64_t calls = 0;
+
+    /// Seconds in argument checks and workspace queries,
+    /// before the main LAPACK call.
+    double query_time = 0;
+
+    /// Seconds allocating workspace and temporary arrays.
+    double alloc_time = 0;
+
+    /// Seconds in the main LAPACK call and copying results back.
+    double compute_time = 0;
+
+    /// Total bytes allocated for workspace and temporary arrays.
+    int64_t bytes_allocated = 0;
+
+    /// Largest number of bytes allocated at once by a single call.
+    int64_t peak_workspace = 0;
+};
+
+//------------------------------------------------------------------------------
+/// @return statistics for each routine called so far, summed over threads.
+/// Empty if LAPACK++ was built without `use_instrumentation`.
+///
+/// If the environment variable `LAPACKPP_STATS` is set, the statistics are
+/// also printed at exit: to stderr if it is 1, otherwise to the file it names.
+///
+/// @ingroup auxiliary
+std::map< std::string, RoutineStats > stats();
+
+/// Resets statistics for all routines to zero.
+/// @ingroup auxiliary
+void reset_stats();
+
+/// Prints statistics for all routines as a table.
+/// @param[in] out  File to print to, by default stderr.
+/// @ingroup auxiliary
+void print_stats( FILE* out = stderr );
+
+}  // namespace lapack
+
+#endif // LAPACK_STATS_HH
@@ -873,6 +873,68 @@ inline const char* rowcol2str( lapack::RowCol rowcol )
 // For %lld printf-style printing, cast to llong; guaranteed >= 64 bits.
 using llong = long long;
 
+//------------------------------------------------------------------------------
+/// Describes one LAPACK++ call to trace callbacks.
+/// Only the outermost LAPACK++ call on each thread is traced; e.g.,
+/// heevd is traced, but not the heevd_work it calls.
+/// @ingroup auxiliary
+struct TraceEvent
+{
+    /// Routine with precision prefix, e.g., "dgetrf" or "zheevd_work".
+    const char* routine;
+
+    /// Precision: 's', 'd', 'c', or 'z'.
+    char precision;
+
+    /// Dimensions m, n, and k (or nrhs, kd, kl, etc.); 0 if unused.
+    int64_t m, n, k;
+
+    /// Small integer identifying the calling thread; the first
+    /// thread to call LAPACK++ is 0.
+    uint64_t thread_id;
+
+    /// Start and end times of the call, in seconds from an arbitrary
+    /// epoch. end is 0 in the begin callback.
+    double start, end;
+};
+
+/// Callback invoked at the beginning or end of a LAPACK++ call.
+/// Must be thread safe and must not throw.
+/// @ingroup auxiliary
+using trace_callback_t = void (*)( TraceEvent const& event, void* data );
+
+//------------------------------------------------------------------------------
+/// Registers callbacks invoked at the beginning and end of every
+/// LAPACK++ call, replacing any previous callbacks, including the
+/// trace writer's. Either may be nullptr; both nullptr disables tracing.
+/// Requires LAPACK++ built with `use_instrumentation`; otherwise throws Error.
+///
+/// @param[in] begin  Invoked on entry, before checking arguments.
+/// @param[in] end    Invoked on exit, including when throwing an error.
+/// @param[in] data   Passed to begin and end.
+///
+/// @ingroup auxiliary
+void set_trace_callbacks(
+    trace_callback_t begin, trace_callback_t end, void* data = nullptr );
+
+/// Starts recording LAPACK++ calls to a Chrome trace JSON file, which
+/// can be viewed in Perfetto (https://ui.perfetto.dev) or chrome://tracing.
+/// Each call shows its dimensions and, for routines in lapack/flops.hh,
+/// its Gflop/s. Replaces any registered callbacks.
+/// Setting $LAPACKPP_TRACE to a filename starts tracing at the first
+/// LAPACK++ call and stops at exit.
+/// Requires LAPACK++ built with `use_instrumentation`; otherwise throws Error.
+///
+/// @param[in] filename  File written by stop_trace.
+///
+/// @ingroup auxiliary
+void start_trace( std::string const& filename );
+
+/// Stops recording, writes the trace file from start_trace, and
+/// unregisters the trace callbacks. Does nothing if no trace was started.
+/// @ingroup auxiliary
+void stop_trace();
+
 }  // namespace lapack
 
 #endif  // LAPACK_UTIL_HH
@@ -0,0 +1,59 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_WORK_SIZE_CACHE_HH
+#define LAPACK_WORK_SIZE_CACHE_HH
+
+#include <cstdint>
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+/// Enables or disables the workspace size cache.
+///
+/// The workspace queries (lwork = -1) of the most frequently called
+/// wrappers, namely gels, geqr, geqrf, unmqr, gesvd, gesdd, geev, gees,
+/// gges, getri, heev, heevd, hetrf, hesv, hesvx, their real aliases, and
+/// their `_work_size` variants, remember the result for each routine,
+/// precision, job options, and dimensions. Repeated calls with the same
+/// arguments then skip the query. The cache is process-wide and thread safe.
+/// Other wrappers query LAPACK on every call, since their optimal
+/// workspace may depend on array contents (e.g., trsen, tgsen).
+///
+/// The cache is enabled by default, unless the environment variable
+/// `LAPACKPP_WORK_SIZE_CACHE` is 0, off, or false. Disabling it does not
+/// clear it; see `lapack::clear_work_size_cache`.
+///
+/// @param[in] enable
+///     Whether to use the cache.
+///
+/// @ingroup auxiliary
+void set_work_size_cache( bool enable );
+
+/// @return whether the workspace size cache is enabled.
+/// @see set_work_size_cache
+/// @ingroup auxiliary
+bool get_work_size_cache();
+
+/// Gets the number of workspace queries answered from the cache (hits)
+/// and the number that had to call LAPACK (misses) while it was enabled.
+///
+/// @param[out] hits
+///     Number of cache hits. Ignored if null.
+///
+/// @param[out] misses
+///     Number of cache misses. Ignored if null.
+///
+/// @ingroup auxiliary
+void work_size_cache_stats( int64_t* hits, int64_t* misses );
+
+/// Removes all entries from the workspace size cache and
+/// resets its hit and miss counters.
+/// @ingroup auxiliary
+void clear_work_size_cache();
+
+}  // namespace lapack
+
+#endif // LAPACK_WORK_SIZE_CACHE_HH
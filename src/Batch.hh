@@ -0,0 +1,130 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INTERNAL_BATCH_HH
+#define LAPACK_INTERNAL_BATCH_HH
+
+#include "lapack/util.hh"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Batch routines take each argument either once, applied to every entry,
+// or once per entry, as in BLAS++ batch routines.
+// Checks that the argument vector has size 1 or batch.
+template <typename T>
+inline void check_batch_arg( std::vector< T > const& arg, size_t batch )
+{
+    lapack_error_if( arg.size() != 1 && arg.size() != batch );
+}
+
+// Checks that the array of pointers has one entry per problem.
+template <typename T>
+inline void check_batch_array( std::vector< T > const& array, size_t batch )
+{
+    lapack_error_if( array.size() < batch );
+}
+
+// Checks trans for routines that apply Q or op(A), such as unmqr and gels:
+// NoTrans or ConjTrans, and for real, Trans, which they treat the same as
+// ConjTrans. Checked up front, since LAPACK errors cannot be thrown out
+// of the parallel loop over the batch.
+template <typename scalar_t>
+inline void check_batch_op( lapack::Op trans )
+{
+    lapack_error_if( trans != Op::NoTrans && trans != Op::ConjTrans
+                     && (trans != Op::Trans || blas::is_complex< scalar_t >::value) );
+}
+
+//------------------------------------------------------------------------------
+// Returns argument for batch entry i, which is arg[ 0 ] if it was given once.
+template <typename T>
+inline T const& batch_arg( std::vector< T > const& arg, size_t i )
+{
+    return arg.size() == 1 ? arg[ 0 ] : arg[ i ];
+}
+
+// Returns whether any of the arguments differs between batch entries
+// i-1 and i, e.g., to redo a workspace query only when the size changes.
+template <typename... Args>
+inline bool batch_changed( size_t i, Args const&... args )
+{
+    return (... || (batch_arg( args, i ) != batch_arg( args, i-1 )));
+}
+
+//------------------------------------------------------------------------------
+// Maximum number of threads a parallel loop over the batch uses, for
+// sizing per-thread workspace before the loop. 1 without OpenMP.
+inline int batch_max_threads()
+{
+    #ifdef _OPENMP
+        return omp_get_max_threads();
+    #else
+        return 1;
+    #endif
+}
+
+// Index of the calling thread within the loop over the batch, for
+// selecting its per-thread workspace. 0 without OpenMP.
+inline int batch_thread_num()
+{
+    #ifdef _OPENMP
+        return omp_get_thread_num();
+    #else
+        return 0;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Orders problems by decreasing cost and counts the large ones; see batch.cc.
+void batch_schedule(
+    std::vector< double > const& costs, int nthreads,
+    std::vector< int64_t >& order, int64_t* num_large );
+
+// Runs run( i ) for each problem i of a batch whose sizes vary, using
+// cost( i ), e.g., Gflop, to balance the load. Problems large enough that
+// one thread would be left working long after the others finish (see
+// lapack::set_batch_large_gflop) run first, one at a time on the calling
+// thread, so a multithreaded BLAS spreads each across all cores. The rest
+// run in parallel, one problem per thread, largest first, from a dynamic
+// schedule: threads that finish early take the next problem, so the small
+// problems at the end even out the load. Inside the parallel loop, an
+// OpenMP-threaded BLAS runs single-threaded.
+// run( i ) may use per-thread workspace indexed by batch_thread_num(),
+// which is 0 for the large problems.
+template <typename cost_func, typename run_func>
+void batch_run( size_t batch, cost_func&& cost, run_func&& run )
+{
+    std::vector< double > costs( batch );
+    for (size_t i = 0; i < batch; ++i)
+        costs[ i ] = cost( i );
+
+    std::vector< int64_t > order;
+    int64_t num_large;
+    batch_schedule( costs, batch_max_threads(), order, &num_large );
+
+    for (int64_t j = 0; j < num_large; ++j)
+        run( order[ j ] );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( dynamic )
+    #endif
+    for (int64_t j = num_large; j < int64_t( batch ); ++j)
+        run( order[ j ] );
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_INTERNAL_BATCH_HH
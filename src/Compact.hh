@@ -0,0 +1,196 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INTERNAL_COMPACT_HH
+#define LAPACK_INTERNAL_COMPACT_HH
+
+#include "lapack/util.hh"
+#include "lapack/compact.hh"
+
+#include <complex>
+#include <cstdint>
+
+//------------------------------------------------------------------------------
+// Compact kernels operate on one group of compact_width matrices at a time.
+// Every operation is a loop over the lanes of a group, i.e., the same
+// element of consecutive matrices, which are contiguous. LAPACK_COMPACT_SIMD
+// before such a loop asks the compiler to vectorize it for whatever
+// instruction set it targets (e.g., -march=native gives AVX2 or AVX-512);
+// without OpenMP, the compiler may still auto-vectorize it.
+#ifdef _OPENMP
+    #define LAPACK_COMPACT_SIMD _Pragma( "omp simd" )
+#else
+    #define LAPACK_COMPACT_SIMD
+#endif
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Lane arithmetic. Complex multiply and divide are written out, as the
+// library versions handle Inf and NaN with branches and calls that
+// prevent vectorization. Division is not scaled, which is fine for the
+// small, reasonably scaled matrices compact routines are meant for.
+template <typename real_t>
+inline real_t mul_lane( real_t a, real_t b )
+{
+    return a * b;
+}
+
+template <typename real_t>
+inline std::complex<real_t> mul_lane(
+    std::complex<real_t> a, std::complex<real_t> b )
+{
+    return std::complex<real_t>( a.real()*b.real() - a.imag()*b.imag(),
+                                 a.real()*b.imag() + a.imag()*b.real() );
+}
+
+template <typename real_t>
+inline real_t div_lane( real_t a, real_t b )
+{
+    return a / b;
+}
+
+template <typename real_t>
+inline std::complex<real_t> div_lane(
+    std::complex<real_t> a, std::complex<real_t> b )
+{
+    real_t d = b.real()*b.real() + b.imag()*b.imag();
+    return std::complex<real_t>( (a.real()*b.real() + a.imag()*b.imag()) / d,
+                                 (a.imag()*b.real() - a.real()*b.imag()) / d );
+}
+
+// Returns conj( a ) if do_conj, else a.
+template <typename real_t>
+inline real_t conj_lane( real_t a, bool do_conj )
+{
+    return a;
+}
+
+template <typename real_t>
+inline std::complex<real_t> conj_lane( std::complex<real_t> a, bool do_conj )
+{
+    return do_conj ? std::complex<real_t>( a.real(), -a.imag() ) : a;
+}
+
+// Returns |re(a)| + |im(a)|, as used for pivoting in LAPACK (cabs1).
+template <typename real_t>
+inline real_t abs1_lane( real_t a )
+{
+    return std::abs( a );
+}
+
+template <typename real_t>
+inline real_t abs1_lane( std::complex<real_t> a )
+{
+    return std::abs( a.real() ) + std::abs( a.imag() );
+}
+
+// Returns |a|^2.
+template <typename real_t>
+inline real_t abs2_lane( real_t a )
+{
+    return a * a;
+}
+
+template <typename real_t>
+inline real_t abs2_lane( std::complex<real_t> a )
+{
+    return a.real()*a.real() + a.imag()*a.imag();
+}
+
+//------------------------------------------------------------------------------
+// Number of groups of compact_width matrices holding batch matrices.
+template <typename scalar_t>
+inline int64_t compact_groups( size_t batch )
+{
+    const int64_t w = compact_width< scalar_t >();
+    return (int64_t( batch ) + w - 1) / w;
+}
+
+//------------------------------------------------------------------------------
+// Solves op(A) X = B for one group, overwriting B, where A is an m-by-m
+// triangular compact group and B an m-by-n compact group whose element
+// (i, j) is at B[ (i*ib + j*jb)*w ]. Strides let trsm_compact solve with
+// B transposed for side = Right. If conj_b, B is conjugated before and
+// after the solve, which handles side = Right, trans = ConjTrans.
+template <typename scalar_t>
+void trsm_compact_group(
+    lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t m, int64_t n, scalar_t alpha,
+    scalar_t const* A, scalar_t* B, int64_t ib, int64_t jb, bool conj_b )
+{
+    const int64_t w = compact_width< scalar_t >();
+    const scalar_t one = 1;
+    bool nonunit = (diag == Diag::NonUnit);
+    bool conj_a = (trans == Op::ConjTrans);
+
+    // forward substitution for lower triangular op(A)
+    bool forward = ((uplo == Uplo::Lower) == (trans == Op::NoTrans));
+
+    for (int64_t j = 0; j < n; ++j) {
+        // B = alpha B, or alpha conj( B )
+        if (alpha != one || conj_b) {
+            for (int64_t i = 0; i < m; ++i) {
+                scalar_t* Bij = &B[ (i*ib + j*jb)*w ];
+                LAPACK_COMPACT_SIMD
+                for (int64_t l = 0; l < w; ++l)
+                    Bij[ l ] = mul_lane( alpha, conj_lane( Bij[ l ], conj_b ) );
+            }
+        }
+
+        for (int64_t kk = 0; kk < m; ++kk) {
+            int64_t k = forward ? kk : m-1 - kk;
+            int64_t i_begin = forward ? k+1 : 0;
+            int64_t i_end   = forward ? m   : k;
+            scalar_t* Bk = &B[ (k*ib + j*jb)*w ];
+            scalar_t const* Akk = &A[ (k + k*m)*w ];
+            if (trans == Op::NoTrans) {
+                // B(k) /= A(k, k); B(i) -= A(i, k) B(k) for i below or above k
+                if (nonunit) {
+                    LAPACK_COMPACT_SIMD
+                    for (int64_t l = 0; l < w; ++l)
+                        Bk[ l ] = div_lane( Bk[ l ], Akk[ l ] );
+                }
+                for (int64_t i = i_begin; i < i_end; ++i) {
+                    scalar_t* Bi = &B[ (i*ib + j*jb)*w ];
+                    scalar_t const* Aik = &A[ (i + k*m)*w ];
+                    LAPACK_COMPACT_SIMD
+                    for (int64_t l = 0; l < w; ++l)
+                        Bi[ l ] -= mul_lane( Aik[ l ], Bk[ l ] );
+                }
+            }
+            else {
+                // B(k) -= sum_i op(A)(k, i) B(i) for i solved; B(k) /= op(A)(k, k)
+                for (int64_t i = (forward ? 0 : k+1); i < (forward ? k : m); ++i) {
+                    scalar_t const* Bi = &B[ (i*ib + j*jb)*w ];
+                    scalar_t const* Aik = &A[ (i + k*m)*w ];
+                    LAPACK_COMPACT_SIMD
+                    for (int64_t l = 0; l < w; ++l)
+                        Bk[ l ] -= mul_lane( conj_lane( Aik[ l ], conj_a ), Bi[ l ] );
+                }
+                if (nonunit) {
+                    LAPACK_COMPACT_SIMD
+                    for (int64_t l = 0; l < w; ++l)
+                        Bk[ l ] = div_lane( Bk[ l ], conj_lane( Akk[ l ], conj_a ) );
+                }
+            }
+        }
+
+        if (conj_b) {
+            for (int64_t i = 0; i < m; ++i) {
+                scalar_t* Bij = &B[ (i*ib + j*jb)*w ];
+                LAPACK_COMPACT_SIMD
+                for (int64_t l = 0; l < w; ++l)
+                    Bij[ l ] = conj_lane( Bij[ l ], true );
+            }
+        }
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_INTERNAL_COMPACT_HH
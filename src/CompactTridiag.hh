@@ -0,0 +1,408 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INTERNAL_COMPACT_TRIDIAG_HH
+#define LAPACK_INTERNAL_COMPACT_TRIDIAG_HH
+
+#include "Compact.hh"
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Tridiagonal kernels for one group of w = compact_width< scalar_t >
+// systems. The recurrences of gttrf, pttrf, etc. are sequential in i, but
+// independent across systems, so each step is a lane loop. Vector element
+// i of a group is at X[ i*w + l ], and element (i, j) of the n-by-nrhs B
+// at B[ (i + j*n)*w + l ]. Row interchanges in gttrf and gtsv choose
+// between two candidates per lane, which vectorizes as a select.
+// They are used by both the compact routines, e.g., gtsv_compact, and the
+// strided batch routines, e.g., gtsv_batch, which transpose each group of
+// systems into compact format in per-thread workspace.
+
+// Returns re( conj( a ) * b ), the real part of the dot product.
+template <typename real_t>
+inline real_t re_dotc_lane( real_t a, real_t b )
+{
+    return a * b;
+}
+
+template <typename real_t>
+inline real_t re_dotc_lane( std::complex<real_t> a, std::complex<real_t> b )
+{
+    return a.real()*b.real() + a.imag()*b.imag();
+}
+
+//------------------------------------------------------------------------------
+// LU factorization with partial pivoting of one group of tridiagonal
+// matrices, as in gttrf. Each lane interchanges rows i and i+1 if
+// |dl(i)| > |d(i)|. On a zero pivot, sets info[ l ] and continues with
+// a unit pivot, leaving u(i, i) = 0, so lanes stay finite.
+template <typename scalar_t>
+void gttrf_compact_group(
+    int64_t n, scalar_t* DL, scalar_t* D, scalar_t* DU, scalar_t* DU2,
+    int64_t* ipiv, int64_t* info )
+{
+    const int64_t w = compact_width< scalar_t >();
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    for (int64_t l = 0; l < w; ++l)
+        info[ l ] = 0;
+
+    for (int64_t i = 0; i < n-1; ++i) {
+        scalar_t* DLi = &DL[ i*w ];
+        scalar_t* Di  = &D[ i*w ];
+        scalar_t* DUi = &DU[ i*w ];
+        scalar_t* Di1 = &D[ (i+1)*w ];
+        int64_t* ipivi = &ipiv[ i*w ];
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l) {
+            scalar_t dl = DLi[ l ], d = Di[ l ], du = DUi[ l ], d1 = Di1[ l ];
+            bool swap = abs1_lane( d ) < abs1_lane( dl );
+            scalar_t piv  = swap ? dl : d;
+            scalar_t fact = div_lane( swap ? d : dl, piv != zero ? piv : one );
+            Di [ l ] = piv;
+            DLi[ l ] = fact;
+            DUi[ l ] = swap ? d1 : du;
+            Di1[ l ] = swap ? du - mul_lane( fact, d1 )
+                            : d1 - mul_lane( fact, du );
+            ipivi[ l ] = swap ? i + 2 : i + 1;
+            info[ l ] = (piv == zero && info[ l ] == 0) ? i + 1 : info[ l ];
+        }
+        if (i < n-2) {
+            // fill-in of the second superdiagonal from the interchange
+            scalar_t* DU1  = &DU[ (i+1)*w ];
+            scalar_t* DU2i = &DU2[ i*w ];
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l) {
+                bool swap = ipivi[ l ] != i + 1;
+                scalar_t du1 = DU1[ l ];
+                DU2i[ l ] = swap ? du1 : zero;
+                DU1[ l ]  = swap ? -mul_lane( DLi[ l ], du1 ) : du1;
+            }
+        }
+    }
+    if (n > 0) {
+        scalar_t* Dn = &D[ (n-1)*w ];
+        int64_t* ipivn = &ipiv[ (n-1)*w ];
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l) {
+            ipivn[ l ] = n;
+            info[ l ] = (Dn[ l ] == zero && info[ l ] == 0) ? n : info[ l ];
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Solves U X = B for one group, where U is upper triangular with diagonal
+// D and superdiagonals DU and DU2, from gttrf or gtsv.
+template <typename scalar_t>
+void gt_upper_solve_group(
+    int64_t n, int64_t nrhs,
+    scalar_t const* D, scalar_t const* DU, scalar_t const* DU2, scalar_t* B )
+{
+    const int64_t w = compact_width< scalar_t >();
+    if (n == 0)
+        return;
+
+    for (int64_t j = 0; j < nrhs; ++j) {
+        scalar_t* Bj = &B[ j*n*w ];
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l)
+            Bj[ (n-1)*w + l ] = div_lane( Bj[ (n-1)*w + l ], D[ (n-1)*w + l ] );
+        if (n > 1) {
+            int64_t i = n-2;
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l) {
+                scalar_t b = Bj[ i*w + l ]
+                           - mul_lane( DU[ i*w + l ], Bj[ (i+1)*w + l ] );
+                Bj[ i*w + l ] = div_lane( b, D[ i*w + l ] );
+            }
+        }
+        for (int64_t i = n-3; i >= 0; --i) {
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l) {
+                scalar_t b = Bj[ i*w + l ]
+                           - mul_lane( DU [ i*w + l ], Bj[ (i+1)*w + l ] )
+                           - mul_lane( DU2[ i*w + l ], Bj[ (i+2)*w + l ] );
+                Bj[ i*w + l ] = div_lane( b, D[ i*w + l ] );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Solves op(A) X = B for one group, using the factors from
+// gttrf_compact_group, as in gtts2.
+template <typename scalar_t>
+void gttrs_compact_group(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* DL, scalar_t const* D, scalar_t const* DU,
+    scalar_t const* DU2, int64_t const* ipiv, scalar_t* B )
+{
+    const int64_t w = compact_width< scalar_t >();
+
+    if (trans == Op::NoTrans) {
+        // solve L Y = P^T B, applying interchanges as L is applied
+        for (int64_t j = 0; j < nrhs; ++j) {
+            scalar_t* Bj = &B[ j*n*w ];
+            for (int64_t i = 0; i < n-1; ++i) {
+                LAPACK_COMPACT_SIMD
+                for (int64_t l = 0; l < w; ++l) {
+                    bool swap = ipiv[ i*w + l ] != i + 1;
+                    scalar_t b  = Bj[ i*w + l ];
+                    scalar_t b1 = Bj[ (i+1)*w + l ];
+                    scalar_t dl = DL[ i*w + l ];
+                    Bj[ i*w + l ]     = swap ? b1 : b;
+                    Bj[ (i+1)*w + l ] = swap ? b - mul_lane( dl, b1 )
+                                             : b1 - mul_lane( dl, b );
+                }
+            }
+        }
+        // solve U X = Y
+        gt_upper_solve_group( n, nrhs, D, DU, DU2, B );
+    }
+    else {
+        bool c = (trans == Op::ConjTrans);
+        for (int64_t j = 0; j < nrhs; ++j) {
+            scalar_t* Bj = &B[ j*n*w ];
+            // solve U^T Y = B, or U^H
+            for (int64_t i = 0; i < n; ++i) {
+                LAPACK_COMPACT_SIMD
+                for (int64_t l = 0; l < w; ++l) {
+                    scalar_t b = Bj[ i*w + l ];
+                    if (i >= 1) {
+                        b -= mul_lane( conj_lane( DU[ (i-1)*w + l ], c ),
+                                       Bj[ (i-1)*w + l ] );
+                    }
+                    if (i >= 2) {
+                        b -= mul_lane( conj_lane( DU2[ (i-2)*w + l ], c ),
+                                       Bj[ (i-2)*w + l ] );
+                    }
+                    Bj[ i*w + l ] = div_lane( b, conj_lane( D[ i*w + l ], c ) );
+                }
+            }
+            // solve L^T P^T X = Y, or L^H, undoing interchanges in reverse
+            for (int64_t i = n-2; i >= 0; --i) {
+                LAPACK_COMPACT_SIMD
+                for (int64_t l = 0; l < w; ++l) {
+                    bool swap = ipiv[ i*w + l ] != i + 1;
+                    scalar_t b1 = Bj[ (i+1)*w + l ];
+                    scalar_t t  = Bj[ i*w + l ]
+                                - mul_lane( conj_lane( DL[ i*w + l ], c ), b1 );
+                    Bj[ i*w + l ]     = swap ? b1 : t;
+                    Bj[ (i+1)*w + l ] = swap ? t  : b1;
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Solves A X = B for one group by Gaussian elimination with partial
+// pivoting, as in gtsv, overwriting DL with the second superdiagonal of
+// U, D and DU with the diagonal and superdiagonal of U, and B with X.
+// On a zero pivot, sets info[ l ] and continues with a unit pivot;
+// X is then not meaningful in that lane.
+template <typename scalar_t>
+void gtsv_compact_group(
+    int64_t n, int64_t nrhs,
+    scalar_t* DL, scalar_t* D, scalar_t* DU, scalar_t* B, int64_t* info )
+{
+    const int64_t w = compact_width< scalar_t >();
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+
+    scalar_t fact[ w ];
+    bool swap[ w ];
+    for (int64_t l = 0; l < w; ++l)
+        info[ l ] = 0;
+
+    for (int64_t i = 0; i < n-1; ++i) {
+        scalar_t* DLi = &DL[ i*w ];
+        scalar_t* Di  = &D[ i*w ];
+        scalar_t* DUi = &DU[ i*w ];
+        scalar_t* Di1 = &D[ (i+1)*w ];
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l) {
+            scalar_t dl = DLi[ l ], d = Di[ l ], du = DUi[ l ], d1 = Di1[ l ];
+            swap[ l ] = abs1_lane( d ) < abs1_lane( dl );
+            scalar_t piv = swap[ l ] ? dl : d;
+            fact[ l ] = div_lane( swap[ l ] ? d : dl, piv != zero ? piv : one );
+            Di [ l ] = piv;
+            DUi[ l ] = swap[ l ] ? d1 : du;
+            Di1[ l ] = swap[ l ] ? du - mul_lane( fact[ l ], d1 )
+                                 : d1 - mul_lane( fact[ l ], du );
+            info[ l ] = (piv == zero && info[ l ] == 0) ? i + 1 : info[ l ];
+        }
+        if (i < n-2) {
+            // DL(i) holds the second superdiagonal of U
+            scalar_t* DU1 = &DU[ (i+1)*w ];
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l) {
+                scalar_t du1 = DU1[ l ];
+                DLi[ l ] = swap[ l ] ? du1 : zero;
+                DU1[ l ] = swap[ l ] ? -mul_lane( fact[ l ], du1 ) : du1;
+            }
+        }
+        for (int64_t j = 0; j < nrhs; ++j) {
+            scalar_t* Bi  = &B[ (i + j*n)*w ];
+            scalar_t* Bi1 = &B[ (i+1 + j*n)*w ];
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l) {
+                scalar_t b = Bi[ l ], b1 = Bi1[ l ];
+                Bi [ l ] = swap[ l ] ? b1 : b;
+                Bi1[ l ] = swap[ l ] ? b - mul_lane( fact[ l ], b1 )
+                                     : b1 - mul_lane( fact[ l ], b );
+            }
+        }
+    }
+    if (n > 0) {
+        scalar_t* Dn = &D[ (n-1)*w ];
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l)
+            info[ l ] = (Dn[ l ] == zero && info[ l ] == 0) ? n : info[ l ];
+    }
+
+    gt_upper_solve_group( n, nrhs, D, DU, DL, B );
+}
+
+//------------------------------------------------------------------------------
+// Returns the offset in a compact vector Dc of real_t, of length n, of the
+// first lane of group g of scalar_t. For complex, compact_width< real_t >
+// is twice compact_width< scalar_t >, so group g of E covers half of a
+// group of D, with lanes at stride wd = compact_width< real_t >.
+template <typename scalar_t>
+inline int64_t compact_real_offset( int64_t n, int64_t g )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const int64_t w  = compact_width< scalar_t >();
+    const int64_t wd = compact_width< real_t >();
+    return (g*w / wd)*n*wd + (g*w % wd);
+}
+
+//------------------------------------------------------------------------------
+// L D L^H factorization of one group of Hermitian positive definite
+// tridiagonal matrices, as in pttrf. D is real, with element i of lane l
+// at D[ i*wd + l ], since for complex, a compact group of real D is wider
+// than the group of E; see pttrf_compact. On a non-positive pivot, sets
+// info[ l ] and continues with a unit pivot.
+template <typename scalar_t>
+void pttrf_compact_group(
+    int64_t n, blas::real_type< scalar_t >* D, int64_t wd, scalar_t* E,
+    int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const int64_t w = compact_width< scalar_t >();
+    const real_t zero = 0;
+    const real_t one  = 1;
+
+    for (int64_t l = 0; l < w; ++l)
+        info[ l ] = 0;
+
+    for (int64_t i = 0; i < n; ++i) {
+        real_t* Di = &D[ i*wd ];
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l) {
+            bool bad = ! (Di[ l ] > zero);
+            info[ l ] = (bad && info[ l ] == 0) ? i + 1 : info[ l ];
+            Di[ l ] = bad ? one : Di[ l ];
+        }
+        if (i < n-1) {
+            real_t* Di1 = &D[ (i+1)*wd ];
+            scalar_t* Ei = &E[ i*w ];
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l) {
+                scalar_t e = Ei[ l ];
+                scalar_t f = e / Di[ l ];
+                Ei[ l ] = f;
+                Di1[ l ] -= re_dotc_lane( f, e );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Solves A X = B for one group, using the factors from
+// pttrf_compact_group, as in ptts2: A = L D L^H with E the subdiagonal of
+// L if uplo = Lower, or A = U^H D U with E the superdiagonal of U if
+// uplo = Upper. For real, both are the same.
+template <typename scalar_t>
+void pttrs_compact_group(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t > const* D, int64_t wd, scalar_t const* E,
+    scalar_t* B )
+{
+    const int64_t w = compact_width< scalar_t >();
+    bool conj_fwd = (uplo == Uplo::Upper);
+
+    for (int64_t j = 0; j < nrhs; ++j) {
+        scalar_t* Bj = &B[ j*n*w ];
+        // solve L Y = B, or U^H Y = B
+        for (int64_t i = 1; i < n; ++i) {
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l) {
+                scalar_t e = conj_lane( E[ (i-1)*w + l ], conj_fwd );
+                Bj[ i*w + l ] -= mul_lane( Bj[ (i-1)*w + l ], e );
+            }
+        }
+        // solve D L^H X = Y, or D U X = Y
+        for (int64_t i = n-1; i >= 0; --i) {
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l) {
+                scalar_t b = Bj[ i*w + l ] / D[ i*wd + l ];
+                if (i < n-1) {
+                    b -= mul_lane( Bj[ (i+1)*w + l ],
+                                   conj_lane( E[ i*w + l ], ! conj_fwd ) );
+                }
+                Bj[ i*w + l ] = b;
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Copies the m-by-n matrices of one group of w problems from strided
+// storage, problem l at A + l*strideA with leading dimension lda, into
+// the compact group Ag. Lanes l >= lanes are padding, set to pad.
+template <typename T>
+void pack_strided_group(
+    int64_t m, int64_t n, T const* A, int64_t lda, int64_t strideA,
+    int64_t lanes, int64_t w, T pad, T* Ag )
+{
+    for (int64_t l = 0; l < w; ++l) {
+        if (l < lanes) {
+            T const* Al = &A[ l*strideA ];
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t i = 0; i < m; ++i)
+                    Ag[ (i + j*m)*w + l ] = Al[ i + j*lda ];
+        }
+        else {
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t i = 0; i < m; ++i)
+                    Ag[ (i + j*m)*w + l ] = pad;
+        }
+    }
+}
+
+// Copies lanes [0, lanes) of the compact group Ag back to strided storage.
+template <typename T>
+void unpack_strided_group(
+    int64_t m, int64_t n, T const* Ag, int64_t lanes, int64_t w,
+    T* A, int64_t lda, int64_t strideA )
+{
+    for (int64_t l = 0; l < lanes; ++l) {
+        T* Al = &A[ l*strideA ];
+        for (int64_t j = 0; j < n; ++j)
+            for (int64_t i = 0; i < m; ++i)
+                Al[ i + j*lda ] = Ag[ (i + j*m)*w + l ];
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_INTERNAL_COMPACT_TRIDIAG_HH
@@ -0,0 +1,55 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INTERNAL_DISPATCH_HH
+#define LAPACK_INTERNAL_DISPATCH_HH
+
+#include "lapack/fortran.h"
+
+#include <cstdint>
+
+//------------------------------------------------------------------------------
+// LAPACK_dispatch( dpotrf, n )( args... ) calls dpotrf from the backend
+// that the dispatch table selects for size n, or LAPACK_dpotrf from the
+// linked LAPACK. Without dispatch support, it is just LAPACK_dpotrf.
+#ifdef LAPACK_HAVE_DISPATCH
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Routines that can be dispatched, so a lookup is an array index instead
+// of a string comparison. Keep in sync with dispatch_routine_names.
+enum class DispatchRoutine
+{
+    spotrf, dpotrf, cpotrf, zpotrf,
+    sgetrf, dgetrf, cgetrf, zgetrf,
+    sgesdd, dgesdd, cgesdd, zgesdd,
+    ssyevd, dsyevd, cheevd, zheevd,
+    count
+};
+
+// In dispatch.cc. Returns nullptr to use the linked LAPACK.
+// Lock-free and allocation-free.
+void* dispatch_lookup( DispatchRoutine routine, int64_t n );
+
+template <typename Func>
+Func dispatch( DispatchRoutine routine, int64_t n, Func linked )
+{
+    void* func = dispatch_lookup( routine, n );
+    return func ? reinterpret_cast< Func >( func ) : linked;
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+    #define LAPACK_dispatch( routine, n ) \
+        lapack::internal::dispatch( \
+            lapack::internal::DispatchRoutine::routine, n, &LAPACK_##routine )
+#else
+    #define LAPACK_dispatch( routine, n ) LAPACK_##routine
+#endif
+
+#endif // LAPACK_INTERNAL_DISPATCH_HH
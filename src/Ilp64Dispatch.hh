@@ -0,0 +1,37 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INTERNAL_ILP64_DISPATCH_HH
+#define LAPACK_INTERNAL_ILP64_DISPATCH_HH
+
+#include "lapack/fortran_64.h"
+#include "lapack/ilp64_dispatch.hh"
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Threshold set by lapack::set_ilp64_threshold.
+extern std::atomic< int64_t > ilp64_threshold;
+
+//------------------------------------------------------------------------------
+// Returns true if any of the values, typically dimensions and the number
+// of elements in each matrix (e.g., lda*n), exceeds the ILP64 threshold.
+// With LAPACK_HAVE_ILP64_DISPATCH, wrappers then call the 64-bit integer
+// LAPACK instead of the 32-bit integer LAPACK.
+inline bool use_ilp64( std::initializer_list< int64_t > values )
+{
+    return exceeds_lapack_int(
+        values, ilp64_threshold.load( std::memory_order_relaxed ) );
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_INTERNAL_ILP64_DISPATCH_HH
@@ -0,0 +1,87 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INTERNAL_INSTRUMENT_HH
+#define LAPACK_INTERNAL_INSTRUMENT_HH
+
+#include "lapack/defines.h"
+
+//------------------------------------------------------------------------------
+// LAPACK_INSTRUMENT( "dgetrf", m, n, k ) at the top of a wrapper times the
+// call and invokes trace callbacks; dimensions a routine lacks are 0.
+// LAPACK_INSTRUMENT_COMPUTE() marks where the main LAPACK call starts.
+// Without use_instrumentation, both expand to nothing.
+#ifdef LAPACK_HAVE_INSTRUMENTATION
+
+#include "lapack/util.hh"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace lapack {
+namespace internal {
+
+using instrument_clock = std::chrono::steady_clock;
+
+//------------------------------------------------------------------------------
+// Registered by set_trace_callbacks. Replaced sets are never freed, so a
+// call in progress can still use the set it started with.
+struct TraceCallbacks
+{
+    trace_callback_t begin;
+    trace_callback_t end;
+    void* data;
+};
+
+//------------------------------------------------------------------------------
+// Times one wrapper call. Only the outermost scope on a thread is active;
+// nested wrapper calls add their time and allocations to it.
+class InstrumentScope
+{
+public:
+    InstrumentScope( const char* routine, int64_t m, int64_t n, int64_t k );
+    ~InstrumentScope();
+
+    InstrumentScope( InstrumentScope const& ) = delete;
+    InstrumentScope& operator = ( InstrumentScope const& ) = delete;
+
+    const char* routine_;
+    int64_t m_, n_, k_;
+    TraceCallbacks const* trace_ = nullptr;
+    instrument_clock::time_point start_;
+    instrument_clock::time_point compute_;
+    bool computing_   = false;
+    bool active_      = false;
+    double alloc_before_ = 0;  ///< alloc seconds before compute
+    double alloc_after_  = 0;  ///< alloc seconds after compute started
+    std::size_t bytes_       = 0;
+    std::size_t outstanding_ = 0;
+    std::size_t peak_        = 0;
+};
+
+// In trace.cc. Returns the trace writer's callbacks if $LAPACKPP_TRACE is
+// set, else nullptr.
+TraceCallbacks const* trace_from_env();
+
+// In instrument.cc; each applies to the calling thread's active scope.
+void instrument_compute();
+void instrument_allocate( std::size_t bytes, double seconds );
+void instrument_deallocate( std::size_t bytes );
+
+}  // namespace internal
+}  // namespace lapack
+
+    #define LAPACK_INSTRUMENT( routine, m, n, k ) \
+        lapack::internal::InstrumentScope lapack_instrument_scope_( \
+            routine, m, n, k )
+    #define LAPACK_INSTRUMENT_COMPUTE() \
+        lapack::internal::instrument_compute()
+#else
+    #define LAPACK_INSTRUMENT( routine, m, n, k ) ((void) 0)
+    #define LAPACK_INSTRUMENT_COMPUTE() ((void) 0)
+#endif
+
+#endif // LAPACK_INTERNAL_INSTRUMENT_HH
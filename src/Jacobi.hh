@@ -0,0 +1,390 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INTERNAL_JACOBI_HH
+#define LAPACK_INTERNAL_JACOBI_HH
+
+#include "lapack/util.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Applies the Jacobi rotation J = [ c, su; -sv, c ] to columns x and y,
+// [ x, y ] = [ x, y ] J. Columns are contiguous, so the compiler
+// vectorizes this.
+template <typename scalar_t, typename real_t>
+inline void jacobi_rotate(
+    int64_t n, scalar_t* x, scalar_t* y,
+    real_t c, scalar_t su, scalar_t sv )
+{
+    #ifdef _OPENMP
+    #pragma omp simd
+    #endif
+    for (int64_t k = 0; k < n; ++k) {
+        scalar_t xk = x[ k ];
+        scalar_t yk = y[ k ];
+        x[ k ] = c*xk - sv*yk;
+        y[ k ] = su*xk + c*yk;
+    }
+}
+
+// Complex version. The complex multiply is written out, as the library
+// version handles Inf and NaN with branches and calls that prevent
+// vectorization.
+template <typename real_t>
+inline void jacobi_rotate(
+    int64_t n, std::complex< real_t >* x, std::complex< real_t >* y,
+    real_t c, std::complex< real_t > su, std::complex< real_t > sv )
+{
+    // std::complex is layout compatible with real_t[ 2 ]
+    real_t* xr = reinterpret_cast< real_t* >( x );
+    real_t* yr = reinterpret_cast< real_t* >( y );
+    real_t sur = real( su ), sui = imag( su );
+    real_t svr = real( sv ), svi = imag( sv );
+    #ifdef _OPENMP
+    #pragma omp simd
+    #endif
+    for (int64_t k = 0; k < n; ++k) {
+        real_t xre = xr[ 2*k ], xim = xr[ 2*k + 1 ];
+        real_t yre = yr[ 2*k ], yim = yr[ 2*k + 1 ];
+        xr[ 2*k     ] = c*xre - (svr*yre - svi*yim);
+        xr[ 2*k + 1 ] = c*xim - (svr*yim + svi*yre);
+        yr[ 2*k     ] = (sur*xre - sui*xim) + c*yre;
+        yr[ 2*k + 1 ] = (sur*xim + sui*xre) + c*yim;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Computes xx = x^H x, yy = y^H y, and xy = x^H y for columns x and y.
+// OpenMP simd allows the compiler to reorder the sums to vectorize them.
+template <typename real_t>
+inline void jacobi_dot(
+    int64_t n, real_t const* x, real_t const* y,
+    real_t* xx, real_t* yy, real_t* xy )
+{
+    real_t sxx = 0, syy = 0, sxy = 0;
+    #ifdef _OPENMP
+    #pragma omp simd reduction( +: sxx, syy, sxy )
+    #endif
+    for (int64_t k = 0; k < n; ++k) {
+        sxx += x[ k ]*x[ k ];
+        syy += y[ k ]*y[ k ];
+        sxy += x[ k ]*y[ k ];
+    }
+    *xx = sxx;
+    *yy = syy;
+    *xy = sxy;
+}
+
+// Complex version.
+template <typename real_t>
+inline void jacobi_dot(
+    int64_t n, std::complex< real_t > const* x, std::complex< real_t > const* y,
+    real_t* xx, real_t* yy, std::complex< real_t >* xy )
+{
+    real_t const* xr = reinterpret_cast< real_t const* >( x );
+    real_t const* yr = reinterpret_cast< real_t const* >( y );
+    real_t sxx = 0, syy = 0, sre = 0, sim = 0;
+    #ifdef _OPENMP
+    #pragma omp simd reduction( +: sxx, syy, sre, sim )
+    #endif
+    for (int64_t k = 0; k < n; ++k) {
+        real_t xre = xr[ 2*k ], xim = xr[ 2*k + 1 ];
+        real_t yre = yr[ 2*k ], yim = yr[ 2*k + 1 ];
+        sxx += xre*xre + xim*xim;
+        syy += yre*yre + yim*yim;
+        sre += xre*yre + xim*yim;
+        sim += xre*yim - xim*yre;
+    }
+    *xx = sxx;
+    *yy = syy;
+    *xy = std::complex< real_t >( sre, sim );
+}
+
+//------------------------------------------------------------------------------
+// Problems with min(m,n) <= gesvd_jacobi_max_n use the one-sided Jacobi
+// kernel. Beyond that, the bidiagonal reduction in gesvd and gesdd is
+// cheaper than Jacobi's sweeps; compared to gesdd on one core, the
+// crossover is near n = 12 for real and n = 6 for complex square matrices.
+template <typename scalar_t>
+inline int64_t gesvd_jacobi_max_n()
+{
+    return blas::is_complex< scalar_t >::value ? 6 : 12;
+}
+
+// One-sided Jacobi typically converges in 5 to 10 sweeps. If it has not
+// converged after this many, the problem falls back to gesvd or gesdd.
+const int64_t gesvd_jacobi_max_sweeps = 30;
+
+// Returns whether the Jacobi kernel computes the requested vectors:
+// it computes min(m,n) left and right singular vectors, so it handles
+// NoVec and SomeVec, and AllVec only where that is all min(m,n) vectors.
+inline bool gesvd_jacobi_job(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n )
+{
+    bool ok_u  = (jobu == Job::NoVec || jobu == Job::SomeVec
+                  || (jobu == Job::AllVec && m <= n));
+    bool ok_vt = (jobvt == Job::NoVec || jobvt == Job::SomeVec
+                  || (jobvt == Job::AllVec && n <= m));
+    return ok_u && ok_vt;
+}
+
+//------------------------------------------------------------------------------
+// Computes the SVD A = U diag(S) VT of a small m-by-n matrix using
+// one-sided (Hestenes) Jacobi. If wantu, computes the first min(m,n)
+// columns of U; if wantvt, the first min(m,n) rows of VT.
+// A is not modified. work is at least max(m,n) min(m,n) + min(m,n)^2.
+// Returns false if it did not converge, or A has Inf, NaN, or only
+// subnormal entries; then the caller falls back to LAPACK.
+//
+// For m >= n, G = A is orthogonalized by rotations on pairs of columns,
+// G = A V, until its columns are numerically orthogonal; then S(j) is
+// the norm of column j of G, U(:,j) = G(:,j) / S(j), and VT = V^H.
+// For m < n, the same is applied to G = A^H, swapping the roles of U
+// and V. Each rotation is the Jacobi rotation that diagonalizes the 2x2
+// Gram matrix [ G_p^H G_p, G_p^H G_q; G_q^H G_p, G_q^H G_q ], as in the
+// heevd_batch kernel, and is skipped when
+// |G_p^H G_q| <= max(m,n) eps ||G_p|| ||G_q||, which gives high relative
+// accuracy (Demmel & Veselic, 1992). The factor max(m,n) bounds the
+// rounding error in G_p^H G_q, which a rotation cannot reduce.
+// The rotations and dot products run down contiguous columns, so they
+// vectorize.
+//
+// fixed_n > 0 makes the sizes compile-time constants for m = n = fixed_n,
+// so all loops unroll; for 2x2, one rotation diagonalizes the Gram
+// matrix, so this is in effect a closed form.
+template <int fixed_n, typename scalar_t>
+bool gesvd_jacobi_n(
+    bool wantu, bool wantvt, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt,
+    scalar_t* work )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+    using blas::imag;
+    using std::abs;
+    using std::sqrt;
+
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const real_t safmin = std::numeric_limits< real_t >::min();
+    const real_t inf = std::numeric_limits< real_t >::infinity();
+    const real_t zero = 0;
+    const real_t one = 1;
+
+    // G is mm-by-nn, mm >= nn; V is nn-by-nn
+    const bool trans = (m < n);
+    const int64_t mm = fixed_n > 0 ? fixed_n : std::max( m, n );
+    const int64_t nn = fixed_n > 0 ? fixed_n : std::min( m, n );
+    const bool wantg = (trans ? wantvt : wantu);
+    const bool wantv = (trans ? wantu : wantvt);
+    scalar_t* G = work;
+    scalar_t* V = &work[ mm*nn ];
+    const real_t tol = mm * eps;
+
+    // scale so the largest entry is 1, to avoid over/underflow in the
+    // sums of squares
+    real_t amax = 0;
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i)
+            amax = std::max( amax, abs( A[ i + j*lda ] ) );
+    }
+    if (! (amax < inf) || (amax > 0 && amax < safmin))
+        return false;
+    real_t scl = (amax > 0 ? one / amax : one);
+
+    // G = A, or A^H if m < n; V = I
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < m; ++i) {
+            scalar_t a = scl * A[ i + j*lda ];
+            if (trans)
+                G[ j + i*mm ] = conj( a );
+            else
+                G[ i + j*mm ] = a;
+        }
+    }
+    if (wantv) {
+        for (int64_t j = 0; j < nn; ++j) {
+            for (int64_t i = 0; i < nn; ++i)
+                V[ i + j*nn ] = zero;
+            V[ j + j*nn ] = one;
+        }
+    }
+
+    bool converged = false;
+    for (int64_t sweep = 0; sweep < gesvd_jacobi_max_sweeps && ! converged;
+         ++sweep) {
+        converged = true;
+        for (int64_t p = 0; p < nn-1; ++p) {
+            for (int64_t q = p+1; q < nn; ++q) {
+                scalar_t* Gp = &G[ p*mm ];
+                scalar_t* Gq = &G[ q*mm ];
+                real_t app, aqq;
+                scalar_t g;
+                jacobi_dot( mm, Gp, Gq, &app, &aqq, &g );
+                real_t r = abs( g );
+                if (r <= tol * sqrt( app ) * sqrt( aqq ))
+                    continue;
+                converged = false;
+
+                // if theta^2 overflows, t = 0, and G_p^H G_q is negligible
+                real_t theta = (aqq - app) / (2*r);
+                real_t t = one / (abs( theta ) + sqrt( one + theta*theta ));
+                if (theta < 0)
+                    t = -t;
+                real_t c = one / sqrt( one + t*t );
+                real_t s = t*c;
+                scalar_t u = g / r;
+                scalar_t su = s*u;
+                scalar_t sv = s*conj( u );
+
+                // G = G J, V = V J
+                jacobi_rotate( mm, Gp, Gq, c, su, sv );
+                if (wantv)
+                    jacobi_rotate( nn, &V[ p*nn ], &V[ q*nn ], c, su, sv );
+            }
+        }
+    }
+    if (! converged)
+        return false;
+
+    for (int64_t j = 0; j < nn; ++j) {
+        real_t sum = 0;
+        for (int64_t k = 0; k < mm; ++k) {
+            sum += real( G[ k + j*mm ] )*real( G[ k + j*mm ] )
+                 + imag( G[ k + j*mm ] )*imag( G[ k + j*mm ] );
+        }
+        S[ j ] = sqrt( sum );
+    }
+
+    // selection sort singular values in descending order, with their vectors
+    for (int64_t j = 0; j < nn-1; ++j) {
+        int64_t jmax = j;
+        for (int64_t i = j+1; i < nn; ++i) {
+            if (S[ i ] > S[ jmax ])
+                jmax = i;
+        }
+        if (jmax != j) {
+            std::swap( S[ j ], S[ jmax ] );
+            std::swap_ranges( &G[ j*mm ], &G[ j*mm + mm ], &G[ jmax*mm ] );
+            if (wantv)
+                std::swap_ranges( &V[ j*nn ], &V[ j*nn + nn ], &V[ jmax*nn ] );
+        }
+    }
+
+    // normalize columns of G. Columns for zero singular values, which
+    // are last, are completed to an orthonormal set from unit vectors e_i,
+    // using classical Gram-Schmidt applied twice. The part of e_i outside
+    // the span of the first j columns has squared norm
+    // 1 - sum_l |G(i,l)|^2; these sum to mm - j over i, so the largest
+    // is at least (mm - j)/mm > 0, and that e_i is used.
+    if (wantg) {
+        for (int64_t j = 0; j < nn; ++j) {
+            scalar_t* Gj = &G[ j*mm ];
+            if (S[ j ] > safmin) {
+                real_t rcp = one / S[ j ];
+                for (int64_t k = 0; k < mm; ++k)
+                    Gj[ k ] *= rcp;
+                continue;
+            }
+            int64_t imax = 0;
+            real_t rmax = -1;
+            for (int64_t i = 0; i < mm; ++i) {
+                real_t r = one;
+                for (int64_t l = 0; l < j; ++l) {
+                    scalar_t g = G[ i + l*mm ];
+                    r -= real( g )*real( g ) + imag( g )*imag( g );
+                }
+                if (r > rmax) {
+                    rmax = r;
+                    imax = i;
+                }
+            }
+            for (int64_t k = 0; k < mm; ++k)
+                Gj[ k ] = zero;
+            Gj[ imax ] = one;
+            for (int64_t pass = 0; pass < 2; ++pass) {
+                for (int64_t l = 0; l < j; ++l) {
+                    scalar_t h = 0;
+                    for (int64_t k = 0; k < mm; ++k)
+                        h += conj( G[ k + l*mm ] ) * Gj[ k ];
+                    for (int64_t k = 0; k < mm; ++k)
+                        Gj[ k ] -= h * G[ k + l*mm ];
+                }
+            }
+            real_t sum = 0;
+            for (int64_t k = 0; k < mm; ++k) {
+                sum += real( Gj[ k ] )*real( Gj[ k ] )
+                     + imag( Gj[ k ] )*imag( Gj[ k ] );
+            }
+            real_t rcp = one / sqrt( sum );
+            for (int64_t k = 0; k < mm; ++k)
+                Gj[ k ] *= rcp;
+        }
+    }
+
+    for (int64_t j = 0; j < nn; ++j)
+        S[ j ] *= amax > 0 ? amax : one;
+
+    // A = G V^H, or A = V G^H if m < n
+    scalar_t const* Ul = (trans ? V : G);
+    int64_t ldul = (trans ? nn : mm);
+    scalar_t const* Vr = (trans ? G : V);
+    int64_t ldvr = (trans ? mm : nn);
+    if (wantu) {
+        for (int64_t j = 0; j < nn; ++j) {
+            for (int64_t i = 0; i < m; ++i)
+                U[ i + j*ldu ] = Ul[ i + j*ldul ];
+        }
+    }
+    if (wantvt) {
+        for (int64_t k = 0; k < n; ++k) {
+            for (int64_t j = 0; j < nn; ++j)
+                VT[ j + k*ldvt ] = conj( Vr[ k + j*ldvr ] );
+        }
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Dispatches to gesvd_jacobi_n, with fixed sizes for 2x2 and 3x3.
+template <typename scalar_t>
+bool gesvd_jacobi(
+    bool wantu, bool wantvt, int64_t m, int64_t n,
+    scalar_t const* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt,
+    scalar_t* work )
+{
+    if (m == 2 && n == 2) {
+        return gesvd_jacobi_n< 2 >( wantu, wantvt, m, n, A, lda, S,
+                                    U, ldu, VT, ldvt, work );
+    }
+    else if (m == 3 && n == 3) {
+        return gesvd_jacobi_n< 3 >( wantu, wantvt, m, n, A, lda, S,
+                                    U, ldu, VT, ldvt, work );
+    }
+    else {
+        return gesvd_jacobi_n< 0 >( wantu, wantvt, m, n, A, lda, S,
+                                    U, ldu, VT, ldvt, work );
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_INTERNAL_JACOBI_HH
@@ -6,6 +6,8 @@
 #ifndef LAPACK_NO_CONSTRUCT_ALLOCATOR_HH
 #define LAPACK_NO_CONSTRUCT_ALLOCATOR_HH
 
+#include "Instrument.hh"
+
 #include <cstddef>  // std::size_t
 #include <limits>   // std::numeric_limits
 #include <new>      // std::bad_alloc, std::bad_array_new_length
@@ -17,7 +19,76 @@
 #endif
 
 namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Allocates 64-byte aligned memory from the heap; throws std::bad_alloc.
+inline void* aligned_malloc( std::size_t size )
+{
+    void* memPtr = nullptr;
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        memPtr = _aligned_malloc( size, 64 );
+        if (memPtr != nullptr) {
+            return memPtr;
+        }
+    #else
+        int err = posix_memalign( &memPtr, 64, size );
+        if (err == 0) {
+            return memPtr;
+        }
+    #endif
+
+    throw std::bad_alloc();
+}
+
+//------------------------------------------------------------------------------
+// Frees memory from aligned_malloc.
+inline void aligned_free( void* p ) noexcept
+{
+    #if defined( _WIN32 ) || defined( _WIN64 )
+        _aligned_free( p );
+    #else
+        free( p );
+    #endif
+}
+
+// Allocations of at least this many bytes follow the AllocPolicy.
+constexpr std::size_t policy_min_size = 2*1024*1024;
 
+// In allocator.cc. policy_malloc allocates following the current
+// AllocPolicy; policy_free frees memory from either policy_malloc or
+// aligned_malloc.
+void* policy_malloc( std::size_t size );
+void  policy_free( void* p ) noexcept;
+
+//------------------------------------------------------------------------------
+// Allocates size bytes of workspace: large sizes follow the AllocPolicy,
+// small sizes use aligned_malloc.
+inline void* workspace_malloc( std::size_t size )
+{
+    return size >= policy_min_size ? policy_malloc( size )
+                                   : aligned_malloc( size );
+}
+
+//------------------------------------------------------------------------------
+// Frees workspace from workspace_malloc of the same size.
+inline void workspace_free( void* p, std::size_t size ) noexcept
+{
+    if (size >= policy_min_size)
+        policy_free( p );
+    else
+        aligned_free( p );
+}
+
+// Thread-local arena, in allocator.cc.
+// arena_allocate returns nullptr if the arena is disabled or full;
+// arena_deallocate returns false if p is not from the calling thread's arena.
+void* arena_allocate( std::size_t size );
+bool  arena_deallocate( void* p ) noexcept;
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
 // No-construct allocator type which allocates / deallocates.
 template <typename T>
 struct NoConstructAllocator
@@ -42,31 +113,30 @@ struct NoConstructAllocator
         if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
             throw std::bad_array_new_length();
 
-        void* memPtr = nullptr;
-        #if defined( _WIN32 ) || defined( _WIN64 )
-            memPtr = _aligned_malloc( n*sizeof(T), 64 );
-            if (memPtr != nullptr) {
-                auto p = static_cast<T*>(memPtr);
-                return p;
-            }
-        #else
-            int err = posix_memalign( &memPtr, 64, n*sizeof(T) );
-            if (err == 0) {
-                auto p = static_cast<T*>(memPtr);
-                return p;
-            }
+        #ifdef LAPACK_HAVE_INSTRUMENTATION
+            auto start = internal::instrument_clock::now();
         #endif
 
-        throw std::bad_alloc();
+        // Use the calling thread's arena, if enabled and it has room.
+        void* memPtr = internal::arena_allocate( n*sizeof(T) );
+        if (memPtr == nullptr)
+            memPtr = internal::workspace_malloc( n*sizeof(T) );
+
+        #ifdef LAPACK_HAVE_INSTRUMENTATION
+            std::chrono::duration< double > time
+                = internal::instrument_clock::now() - start;
+            internal::instrument_allocate( n*sizeof(T), time.count() );
+        #endif
+        return static_cast<T*>( memPtr );
     }
 
     void deallocate(T* p, std::size_t n) noexcept
     {
-        #if defined( _WIN32 ) || defined( _WIN64 )
-            _aligned_free( p );
-        #else
-            free( p );
+        #ifdef LAPACK_HAVE_INSTRUMENTATION
+            internal::instrument_deallocate( n*sizeof(T) );
         #endif
+        if (! internal::arena_deallocate( p ))
+            internal::workspace_free( p, n*sizeof(T) );
     }
 };
 
@@ -0,0 +1,301 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INTERNAL_SMALL_BAND_HH
+#define LAPACK_INTERNAL_SMALL_BAND_HH
+
+#include "lapack/util.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Largest kl and ku handled by the fixed-bandwidth kernels below. For such
+// narrow bands, the level 2 BLAS calls that LAPACK's gbtf2 and gbtrs make
+// per column, each on a vector of at most kl+ku elements, cost more than
+// the arithmetic, so batch routines use these native kernels instead.
+// They write 64-bit pivots directly, so no lapack_int copy is needed.
+const int64_t small_band_max = 4;
+
+inline bool is_small_band( int64_t kl, int64_t ku )
+{
+    return kl <= small_band_max && ku <= small_band_max;
+}
+
+//------------------------------------------------------------------------------
+// |re| + |im|, as used by LAPACK's i[cz]amax to choose pivots.
+template <typename scalar_t>
+inline blas::real_type< scalar_t > abs1_band( scalar_t a )
+{
+    return std::abs( blas::real( a ) ) + std::abs( blas::imag( a ) );
+}
+
+//------------------------------------------------------------------------------
+// Band LU with partial pivoting, as in gbtf2, of an m-by-n band matrix with
+// kl subdiagonals and ku superdiagonals, stored in rows kl to 2*kl+ku of AB;
+// see lapack::gbtrf. Pivots are 1-based, as in LAPACK. Returns info.
+// The bandwidths are compile-time constants, so the loops over the band,
+// of at most kl+ku elements, unroll.
+template <int kl, int ku, typename scalar_t>
+int64_t gbtf2_fixed(
+    int64_t m, int64_t n,
+    scalar_t* AB, int64_t ldab,
+    int64_t* ipiv )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const int64_t kv = ku + kl;
+    const scalar_t one = 1;
+    int64_t info = 0;
+    if (m == 0 || n == 0)
+        return info;
+
+    // A(i,j) is AB[ kv + i - j + j*ldab ]
+    auto A = [AB, ldab, kv]( int64_t i, int64_t j ) -> scalar_t& {
+        return AB[ kv + i - j + j*ldab ];
+    };
+
+    // zero fill-in elements in columns ku+1 to kv-1
+    for (int64_t j = ku + 1; j < std::min( kv, n ); ++j) {
+        for (int64_t i = kv - j; i < kl; ++i)
+            AB[ i + j*ldab ] = 0;
+    }
+
+    // ju is the last column affected by the row swaps so far
+    int64_t ju = 0;
+    for (int64_t j = 0; j < std::min( m, n ); ++j) {
+        // zero fill-in elements in column j+kv
+        if (j + kv < n) {
+            for (int64_t i = 0; i < kl; ++i)
+                AB[ i + (j + kv)*ldab ] = 0;
+        }
+
+        // find pivot among the km rows below the diagonal
+        int64_t km = std::min( int64_t( kl ), m - 1 - j );
+        int64_t jp = 0;
+        real_t amax = abs1_band( A( j, j ) );
+        for (int64_t p = 1; p <= kl; ++p) {
+            if (p <= km && abs1_band( A( j + p, j ) ) > amax) {
+                amax = abs1_band( A( j + p, j ) );
+                jp = p;
+            }
+        }
+        ipiv[ j ] = j + jp + 1;
+
+        if (A( j + jp, j ) != scalar_t( 0 )) {
+            ju = std::max( ju, std::min( j + ku + jp, n - 1 ) );
+
+            // swap rows j and j+jp in columns j to ju
+            if (jp != 0) {
+                for (int64_t c = 0; c <= kv; ++c) {
+                    if (c <= ju - j)
+                        std::swap( A( j + jp, j + c ), A( j, j + c ) );
+                }
+            }
+
+            // compute multipliers and update the trailing band
+            scalar_t rcp = one / A( j, j );
+            for (int64_t p = 1; p <= kl; ++p) {
+                if (p <= km)
+                    A( j + p, j ) *= rcp;
+            }
+            for (int64_t c = 1; c <= kv; ++c) {
+                if (c <= ju - j) {
+                    scalar_t t = A( j, j + c );
+                    for (int64_t p = 1; p <= kl; ++p) {
+                        if (p <= km)
+                            A( j + p, j + c ) -= A( j + p, j ) * t;
+                    }
+                }
+            }
+        }
+        else if (info == 0) {
+            // U(j,j) is exactly zero; continue, as in gbtf2
+            info = j + 1;
+        }
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Solves op(A) X = B with the band LU factors from gbtf2_fixed, as in gbtrs.
+template <int kl, int ku, typename scalar_t>
+void gbtrs_fixed(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* AB, int64_t ldab,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    using blas::conj;
+    const int64_t kv = ku + kl;
+    const bool do_conj = (trans == Op::ConjTrans);
+
+    // op(A(i,j)), with A(i,j) at AB[ kv + i - j + j*ldab ]
+    auto A = [AB, ldab, kv, do_conj]( int64_t i, int64_t j ) {
+        scalar_t a = AB[ kv + i - j + j*ldab ];
+        return do_conj ? conj( a ) : a;
+    };
+
+    if (trans == Op::NoTrans) {
+        // solve L Y = P^T B, applying swaps and multipliers in order
+        for (int64_t j = 0; j < n - 1; ++j) {
+            int64_t lm = std::min( int64_t( kl ), n - 1 - j );
+            int64_t l = ipiv[ j ] - 1;
+            for (int64_t k = 0; k < nrhs; ++k) {
+                scalar_t* Bk = &B[ k*ldb ];
+                if (l != j)
+                    std::swap( Bk[ l ], Bk[ j ] );
+                scalar_t t = Bk[ j ];
+                for (int64_t p = 1; p <= kl; ++p) {
+                    if (p <= lm)
+                        Bk[ j + p ] -= A( j + p, j ) * t;
+                }
+            }
+        }
+
+        // solve U X = Y; U has kl+ku superdiagonals
+        for (int64_t k = 0; k < nrhs; ++k) {
+            scalar_t* Bk = &B[ k*ldb ];
+            for (int64_t j = n - 1; j >= 0; --j) {
+                Bk[ j ] /= A( j, j );
+                scalar_t t = Bk[ j ];
+                for (int64_t p = 1; p <= kv; ++p) {
+                    if (p <= j)
+                        Bk[ j - p ] -= A( j - p, j ) * t;
+                }
+            }
+        }
+    }
+    else {
+        // solve op(U) Y = B
+        for (int64_t k = 0; k < nrhs; ++k) {
+            scalar_t* Bk = &B[ k*ldb ];
+            for (int64_t j = 0; j < n; ++j) {
+                scalar_t t = Bk[ j ];
+                for (int64_t p = 1; p <= kv; ++p) {
+                    if (p <= j)
+                        t -= A( j - p, j ) * Bk[ j - p ];
+                }
+                Bk[ j ] = t / A( j, j );
+            }
+        }
+
+        // solve op(L) X = Y, applying multipliers and swaps in reverse
+        for (int64_t j = n - 2; j >= 0; --j) {
+            int64_t lm = std::min( int64_t( kl ), n - 1 - j );
+            int64_t l = ipiv[ j ] - 1;
+            for (int64_t k = 0; k < nrhs; ++k) {
+                scalar_t* Bk = &B[ k*ldb ];
+                scalar_t t = Bk[ j ];
+                for (int64_t p = 1; p <= kl; ++p) {
+                    if (p <= lm)
+                        t -= A( j + p, j ) * Bk[ j + p ];
+                }
+                Bk[ j ] = t;
+                if (l != j)
+                    std::swap( Bk[ l ], Bk[ j ] );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Dispatch to the fixed-bandwidth kernels, for kl, ku <= small_band_max.
+template <typename scalar_t, int kl>
+int64_t gbtrf_small_ku(
+    int64_t m, int64_t n, int64_t ku,
+    scalar_t* AB, int64_t ldab,
+    int64_t* ipiv )
+{
+    switch (ku) {
+        case 0:  return gbtf2_fixed< kl, 0 >( m, n, AB, ldab, ipiv );
+        case 1:  return gbtf2_fixed< kl, 1 >( m, n, AB, ldab, ipiv );
+        case 2:  return gbtf2_fixed< kl, 2 >( m, n, AB, ldab, ipiv );
+        case 3:  return gbtf2_fixed< kl, 3 >( m, n, AB, ldab, ipiv );
+        default: return gbtf2_fixed< kl, 4 >( m, n, AB, ldab, ipiv );
+    }
+}
+
+template <typename scalar_t>
+int64_t gbtrf_small(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    scalar_t* AB, int64_t ldab,
+    int64_t* ipiv )
+{
+    assert( is_small_band( kl, ku ) );
+    switch (kl) {
+        case 0:  return gbtrf_small_ku< scalar_t, 0 >( m, n, ku, AB, ldab, ipiv );
+        case 1:  return gbtrf_small_ku< scalar_t, 1 >( m, n, ku, AB, ldab, ipiv );
+        case 2:  return gbtrf_small_ku< scalar_t, 2 >( m, n, ku, AB, ldab, ipiv );
+        case 3:  return gbtrf_small_ku< scalar_t, 3 >( m, n, ku, AB, ldab, ipiv );
+        default: return gbtrf_small_ku< scalar_t, 4 >( m, n, ku, AB, ldab, ipiv );
+    }
+}
+
+template <typename scalar_t, int kl>
+void gbtrs_small_ku(
+    lapack::Op trans, int64_t n, int64_t ku, int64_t nrhs,
+    scalar_t const* AB, int64_t ldab,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    switch (ku) {
+        case 0:
+            gbtrs_fixed< kl, 0 >( trans, n, nrhs, AB, ldab, ipiv, B, ldb );
+            break;
+        case 1:
+            gbtrs_fixed< kl, 1 >( trans, n, nrhs, AB, ldab, ipiv, B, ldb );
+            break;
+        case 2:
+            gbtrs_fixed< kl, 2 >( trans, n, nrhs, AB, ldab, ipiv, B, ldb );
+            break;
+        case 3:
+            gbtrs_fixed< kl, 3 >( trans, n, nrhs, AB, ldab, ipiv, B, ldb );
+            break;
+        default:
+            gbtrs_fixed< kl, 4 >( trans, n, nrhs, AB, ldab, ipiv, B, ldb );
+    }
+}
+
+template <typename scalar_t>
+void gbtrs_small(
+    lapack::Op trans, int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    scalar_t const* AB, int64_t ldab,
+    int64_t const* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    assert( is_small_band( kl, ku ) );
+    switch (kl) {
+        case 0:
+            gbtrs_small_ku< scalar_t, 0 >( trans, n, ku, nrhs, AB, ldab,
+                                           ipiv, B, ldb );
+            break;
+        case 1:
+            gbtrs_small_ku< scalar_t, 1 >( trans, n, ku, nrhs, AB, ldab,
+                                           ipiv, B, ldb );
+            break;
+        case 2:
+            gbtrs_small_ku< scalar_t, 2 >( trans, n, ku, nrhs, AB, ldab,
+                                           ipiv, B, ldb );
+            break;
+        case 3:
+            gbtrs_small_ku< scalar_t, 3 >( trans, n, ku, nrhs, AB, ldab,
+                                           ipiv, B, ldb );
+            break;
+        default:
+            gbtrs_small_ku< scalar_t, 4 >( trans, n, ku, nrhs, AB, ldab,
+                                           ipiv, B, ldb );
+    }
+}
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_INTERNAL_SMALL_BAND_HH
@@ -0,0 +1,53 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#ifndef LAPACK_INTERNAL_WORK_SIZE_CACHE_HH
+#define LAPACK_INTERNAL_WORK_SIZE_CACHE_HH
+
+#include <array>
+#include <cstdint>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Key for the workspace query cache: the LAPACK routine name, e.g.,
+// "dgesdd", packed into the first entry, followed by the job characters
+// and dimensions that the routine's workspace query depends on.
+using WorkSizeKey = std::array< int64_t, 8 >;
+
+//------------------------------------------------------------------------------
+// Builds a key from the routine name and up to 7 char or integer arguments.
+template <typename... Args>
+WorkSizeKey work_size_key( const char* routine, Args... args )
+{
+    static_assert( sizeof...(args) < 8, "too many arguments for WorkSizeKey" );
+    WorkSizeKey key {};
+    for (int i = 0; i < 8 && routine[ i ] != '\0'; ++i) {
+        key[ 0 ] |= int64_t( uint8_t( routine[ i ] ) ) << (8*i);
+    }
+    int64_t values[] = { 0, int64_t( args )... };
+    for (int i = 1; i <= int( sizeof...(args) ); ++i) {
+        key[ i ] = values[ i ];
+    }
+    return key;
+}
+
+// Cache of workspace sizes, in work_size_cache.cc.
+// work_size_lookup sets the non-null sizes and returns true on a hit;
+// it returns false on a miss or if the cache is disabled.
+// work_size_insert records sizes after a successful query.
+bool work_size_lookup(
+    WorkSizeKey const& key,
+    int64_t* lwork, int64_t* lrwork=nullptr, int64_t* liwork=nullptr );
+
+void work_size_insert(
+    WorkSizeKey const& key,
+    int64_t lwork, int64_t lrwork=0, int64_t liwork=0 );
+
+}  // namespace internal
+}  // namespace lapack
+
+#endif // LAPACK_INTERNAL_WORK_SIZE_CACHE_HH
@@ -0,0 +1,450 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/allocator.hh"
+#include "NoConstructAllocator.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined( __linux__ )
+#   include <sys/mman.h>     // mmap, munmap, madvise
+#   include <sys/syscall.h>  // SYS_mbind
+#   include <unistd.h>       // syscall, sysconf
+#endif
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Parses size in bytes with optional K, M, or G suffix, e.g., "64M".
+static size_t parse_size( const char* str )
+{
+    char* end;
+    size_t size = std::strtoull( str, &end, 10 );
+    switch (*end) {
+        case 'g': case 'G': size <<= 30; break;
+        case 'm': case 'M': size <<= 20; break;
+        case 'k': case 'K': size <<= 10; break;
+        default: break;
+    }
+    return size;
+}
+
+//------------------------------------------------------------------------------
+// Process-wide arena limit, initialized from $LAPACKPP_ARENA_LIMIT.
+static std::atomic< size_t >& arena_limit()
+{
+    static std::atomic< size_t > limit( [] {
+        const char* env = std::getenv( "LAPACKPP_ARENA_LIMIT" );
+        return env ? parse_size( env ) : size_t( 0 );
+    }() );
+    return limit;
+}
+
+#ifndef NDEBUG
+//------------------------------------------------------------------------------
+// In debug builds, the buffers of all threads' arenas, by start address,
+// with their capacities, to catch memory freed by a thread other than the
+// one that allocated it. Never destroyed, since thread_local arenas may be
+// destroyed after static objects.
+struct ArenaRegistry
+{
+    std::mutex mutex;
+    std::map< uintptr_t, size_t > buffers;
+};
+
+static ArenaRegistry& arena_registry()
+{
+    static ArenaRegistry* registry = new ArenaRegistry;
+    return *registry;
+}
+
+// Returns true if p is in some thread's arena buffer.
+static bool in_any_arena( void* p )
+{
+    uintptr_t ptr = reinterpret_cast<uintptr_t>( p );
+    auto& registry = arena_registry();
+    std::lock_guard< std::mutex > guard( registry.mutex );
+    auto iter = registry.buffers.upper_bound( ptr );
+    if (iter == registry.buffers.begin())
+        return false;
+    --iter;
+    return ptr < iter->first + iter->second;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Per-thread bump allocator. Allocations are carved off the top of one
+// buffer; the top is reset to 0 once every allocation has been freed,
+// which happens when the outermost wrapper returns. Requests that do not
+// fit go to the heap, but are remembered in high_water_, and the buffer
+// is grown to that size (up to the limit) the next time it is empty,
+// so the following calls fit entirely. Memory must be freed by the
+// thread that allocated it, which is the case for lapack::vector
+// temporaries local to a wrapper.
+class Arena
+{
+public:
+    ~Arena()
+    {
+        outstanding_ = 0;
+        release();
+    }
+
+    void* allocate( size_t size, size_t limit );
+    bool deallocate( void* p ) noexcept;
+    void release() noexcept;
+
+    size_t capacity() const { return capacity_; }
+
+private:
+    static constexpr size_t align = 64;
+
+    char*   buffer_      = nullptr;
+    size_t  capacity_    = 0;
+    size_t  top_         = 0;
+    size_t  overflow_    = 0;  ///< bytes sent to heap in current cycle
+    size_t  high_water_  = 0;  ///< max bytes requested in any cycle
+    int64_t outstanding_ = 0;
+};
+
+//------------------------------------------------------------------------------
+void* Arena::allocate( size_t size, size_t limit )
+{
+    // Shrink if the limit was lowered, e.g., to 0, while empty.
+    if (outstanding_ == 0 && capacity_ > limit)
+        release();
+
+    if (size == 0 || size > limit)
+        return nullptr;
+
+    size_t need = (size + align - 1) / align * align;
+    size_t capacity = std::min( limit, std::max( need, high_water_ ) );
+    if (outstanding_ == 0 && capacity > capacity_) {
+        // Grow while empty, so no outstanding pointers are invalidated.
+        release();
+        buffer_ = static_cast<char*>( workspace_malloc( capacity ) );
+        capacity_ = capacity;
+        #ifndef NDEBUG
+            auto& registry = arena_registry();
+            std::lock_guard< std::mutex > guard( registry.mutex );
+            registry.buffers[ reinterpret_cast<uintptr_t>( buffer_ ) ] = capacity_;
+        #endif
+    }
+    if (top_ + need > capacity_) {
+        overflow_ += need;
+        high_water_ = std::max( high_water_, top_ + overflow_ );
+        return nullptr;
+    }
+    void* p = buffer_ + top_;
+    top_ += need;
+    ++outstanding_;
+    high_water_ = std::max( high_water_, top_ + overflow_ );
+    return p;
+}
+
+//------------------------------------------------------------------------------
+bool Arena::deallocate( void* p ) noexcept
+{
+    uintptr_t ptr   = reinterpret_cast<uintptr_t>( p );
+    uintptr_t begin = reinterpret_cast<uintptr_t>( buffer_ );
+    if (buffer_ == nullptr || ptr < begin || ptr >= begin + capacity_) {
+        // Memory from another thread's arena would be freed to the heap.
+        assert( ! in_any_arena( p ) );
+        return false;
+    }
+
+    --outstanding_;
+    if (outstanding_ == 0) {
+        top_ = 0;
+        overflow_ = 0;
+        // Shrink if the limit was lowered since the buffer was allocated.
+        if (capacity_ > arena_limit().load( std::memory_order_relaxed ))
+            release();
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void Arena::release() noexcept
+{
+    if (outstanding_ == 0) {
+        // Start over from the next request's size.
+        high_water_ = 0;
+    }
+    if (outstanding_ == 0 && buffer_ != nullptr) {
+        #ifndef NDEBUG
+            auto& registry = arena_registry();
+            std::lock_guard< std::mutex > guard( registry.mutex );
+            registry.buffers.erase( reinterpret_cast<uintptr_t>( buffer_ ) );
+        #endif
+        workspace_free( buffer_, capacity_ );
+        buffer_   = nullptr;
+        capacity_ = 0;
+        top_      = 0;
+    }
+}
+
+static thread_local Arena thread_arena;
+
+//------------------------------------------------------------------------------
+void* arena_allocate( size_t size )
+{
+    size_t limit = arena_limit().load( std::memory_order_relaxed );
+    return thread_arena.allocate( size, limit );
+}
+
+//------------------------------------------------------------------------------
+bool arena_deallocate( void* p ) noexcept
+{
+    return thread_arena.deallocate( p );
+}
+
+//------------------------------------------------------------------------------
+// Process-wide allocation policy, initialized from $LAPACKPP_ALLOC_POLICY.
+static std::atomic< AllocPolicy >& alloc_policy()
+{
+    static std::atomic< AllocPolicy > policy( [] {
+        const char* env = std::getenv( "LAPACKPP_ALLOC_POLICY" );
+        if (env == nullptr || env[ 0 ] == '\0')
+            return AllocPolicy::Default;
+        try {
+            return char2alloc_policy( env[ 0 ] );
+        }
+        catch (Error const&) {
+            fprintf( stderr, "LAPACK++: unknown LAPACKPP_ALLOC_POLICY %s;"
+                     " using default\n", env );
+            return AllocPolicy::Default;
+        }
+    }() );
+    return policy;
+}
+
+#if defined( __linux__ )
+
+//------------------------------------------------------------------------------
+// Allocations from mmap, with their mapped sizes, so policy_free can tell
+// them from aligned_malloc memory. Only large allocations are recorded, so
+// the lock is cheap relative to the allocation. Never destroyed, so it is
+// valid while other static objects free workspace.
+struct MappedRegions
+{
+    std::mutex mutex;
+    std::unordered_map< void*, size_t > sizes;
+};
+
+static MappedRegions& mapped_regions()
+{
+    static MappedRegions* regions = new MappedRegions;
+    return *regions;
+}
+
+//------------------------------------------------------------------------------
+// Returns a mask of online NUMA nodes, from sysfs, e.g., "0-1" or "0,2-3";
+// empty if unavailable.
+static std::vector< unsigned long > online_nodes()
+{
+    std::vector< unsigned long > mask;
+    std::ifstream file( "/sys/devices/system/node/online" );
+    std::string ranges;
+    if (! (file >> ranges))
+        return mask;
+
+    const int bits = 8 * sizeof(unsigned long);
+    const char* str = ranges.c_str();
+    while (*str != '\0') {
+        char* end;
+        long first = std::strtol( str, &end, 10 );
+        if (end == str)
+            break;  // malformed
+        long last = first;
+        if (*end == '-')
+            last = std::strtol( end + 1, &end, 10 );
+        for (long node = first; node <= last; ++node) {
+            if (size_t( node / bits ) >= mask.size())
+                mask.resize( node / bits + 1, 0 );
+            mask[ node / bits ] |= 1ul << (node % bits);
+        }
+        str = (*end == ',' ? end + 1 : end);
+    }
+    return mask;
+}
+
+//------------------------------------------------------------------------------
+// Interleaves pages of [p, p + size) across all online NUMA nodes.
+// Called before the pages are touched. Does nothing on failure,
+// e.g., if there is one node or mbind is not permitted.
+static void interleave( void* p, size_t size )
+{
+    static const std::vector< unsigned long > nodes = online_nodes();
+    if (nodes.empty())
+        return;
+
+    const int mpol_interleave = 3;  // MPOL_INTERLEAVE from <numaif.h>
+    unsigned long maxnode = 8 * sizeof(unsigned long) * nodes.size() + 1;
+    syscall( SYS_mbind, p, size, mpol_interleave, nodes.data(), maxnode, 0 );
+}
+
+//------------------------------------------------------------------------------
+// Writes one byte of each page of [p, p + size) from the OpenMP threads,
+// with a static schedule, so each page is placed on the NUMA node of the
+// thread whose share of a statically scheduled loop covers it.
+// Called before the pages are touched. Without OpenMP, the pages are
+// left untouched until first written.
+static void first_touch( void* p, size_t size )
+{
+    #ifdef _OPENMP
+        static const int64_t page = sysconf( _SC_PAGESIZE );
+        char* bytes = static_cast< char* >( p );
+        int64_t npages = (int64_t( size ) + page - 1) / page;
+
+        #pragma omp parallel for schedule( static )
+        for (int64_t i = 0; i < npages; ++i) {
+            bytes[ i*page ] = 0;
+        }
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// Maps size bytes, rounded up to a 2 MiB multiple, aligned to 2 MiB.
+// Throws std::bad_alloc.
+static void* mmap_aligned( size_t size )
+{
+    const size_t align = policy_min_size;
+    size_t bytes = (size + align - 1) / align * align;
+    size_t map_size = bytes + align;
+    void* base = mmap( nullptr, map_size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if (base == MAP_FAILED)
+        throw std::bad_alloc();
+
+    // Unmap the unaligned head and the unused tail.
+    uintptr_t begin = reinterpret_cast<uintptr_t>( base );
+    uintptr_t p     = (begin + align - 1) / align * align;
+    uintptr_t end   = begin + map_size;
+    if (p > begin)
+        munmap( base, p - begin );
+    if (end > p + bytes)
+        munmap( reinterpret_cast<void*>( p + bytes ), end - (p + bytes) );
+
+    void* ptr = reinterpret_cast<void*>( p );
+    {
+        auto& regions = mapped_regions();
+        std::lock_guard< std::mutex > guard( regions.mutex );
+        regions.sizes[ ptr ] = bytes;
+    }
+    return ptr;
+}
+
+#endif  // __linux__
+
+//------------------------------------------------------------------------------
+void* policy_malloc( size_t size )
+{
+    #if defined( __linux__ )
+        AllocPolicy policy = alloc_policy().load( std::memory_order_relaxed );
+        switch (policy) {
+            case AllocPolicy::Default:
+                break;
+
+            case AllocPolicy::HugePage: {
+                void* p = mmap_aligned( size );
+                #ifdef MADV_HUGEPAGE
+                    madvise( p, size, MADV_HUGEPAGE );
+                #endif
+                return p;
+            }
+
+            case AllocPolicy::FirstTouch: {
+                void* p = mmap_aligned( size );
+                first_touch( p, size );
+                return p;
+            }
+
+            case AllocPolicy::Interleave: {
+                void* p = mmap_aligned( size );
+                interleave( p, size );
+                return p;
+            }
+        }
+    #endif
+    return aligned_malloc( size );
+}
+
+//------------------------------------------------------------------------------
+void policy_free( void* p ) noexcept
+{
+    #if defined( __linux__ )
+        if (p == nullptr)
+            return;
+
+        size_t bytes = 0;
+        {
+            auto& regions = mapped_regions();
+            std::lock_guard< std::mutex > guard( regions.mutex );
+            auto iter = regions.sizes.find( p );
+            if (iter != regions.sizes.end()) {
+                bytes = iter->second;
+                regions.sizes.erase( iter );
+            }
+        }
+        if (bytes > 0) {
+            munmap( p, bytes );
+            return;
+        }
+    #endif
+    aligned_free( p );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+void set_arena_limit( size_t bytes )
+{
+    internal::arena_limit().store( bytes, std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+size_t get_arena_limit()
+{
+    return internal::arena_limit().load( std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+void release_arena()
+{
+    internal::thread_arena.release();
+}
+
+//------------------------------------------------------------------------------
+size_t get_arena_capacity()
+{
+    return internal::thread_arena.capacity();
+}
+
+//------------------------------------------------------------------------------
+void set_alloc_policy( AllocPolicy policy )
+{
+    internal::alloc_policy().store( policy, std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+AllocPolicy get_alloc_policy()
+{
+    return internal::alloc_policy().load( std::memory_order_relaxed );
+}
+
+}  // namespace lapack
@@ -0,0 +1,87 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/batch.hh"
+#include "Batch.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Process-wide large-problem threshold, in Gflop, initialized from
+// $LAPACKPP_BATCH_LARGE_GFLOP. The default of 0.1 Gflop is roughly where
+// one getrf or potrf (n ~ 500 to 700) starts to benefit from threaded BLAS.
+static std::atomic< double >& batch_large_gflop()
+{
+    static std::atomic< double > gflop( [] {
+        const char* env = std::getenv( "LAPACKPP_BATCH_LARGE_GFLOP" );
+        return env ? std::strtod( env, nullptr ) : 0.1;
+    }() );
+    return gflop;
+}
+
+//------------------------------------------------------------------------------
+// Orders problems by decreasing cost, keeping the given order for equal
+// costs, and returns in num_large how many of the leading problems
+// batch_run should solve one at a time with threaded BLAS.
+// A problem is large if it costs at least the threshold and more than
+// an even share, cost / nthreads, of the problems not yet scheduled,
+// i.e., running it on one thread would leave the other threads idle.
+// Since costs decrease, the large problems are a prefix of the order.
+void batch_schedule(
+    std::vector< double > const& costs, int nthreads,
+    std::vector< int64_t >& order, int64_t* num_large )
+{
+    int64_t batch = costs.size();
+    order.resize( batch );
+    std::iota( order.begin(), order.end(), 0 );
+
+    bool uniform = std::all_of( costs.begin(), costs.end(),
+                                [&costs]( double c ) {
+                                    return c == costs[ 0 ];
+                                } );
+    if (! uniform) {
+        std::stable_sort( order.begin(), order.end(),
+                          [&costs]( int64_t a, int64_t b ) {
+                              return costs[ a ] > costs[ b ];
+                          } );
+    }
+
+    *num_large = 0;
+    double threshold = batch_large_gflop().load( std::memory_order_relaxed );
+    if (threshold <= 0 || nthreads <= 1)
+        return;
+
+    double remaining = std::accumulate( costs.begin(), costs.end(), 0.0 );
+    for (int64_t j = 0; j < batch; ++j) {
+        double cost = costs[ order[ j ] ];
+        if (cost < threshold || cost * nthreads <= remaining)
+            break;
+        remaining -= cost;
+        *num_large = j + 1;
+    }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+void set_batch_large_gflop( double gflop )
+{
+    internal::batch_large_gflop().store( gflop, std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+double get_batch_large_gflop()
+{
+    return internal::batch_large_gflop().load( std::memory_order_relaxed );
+}
+
+}  // namespace lapack
@@ -0,0 +1,540 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batching_executor.hh"
+#include "lapack/batch.hh"
+#include "Ilp64Dispatch.hh"
+#include "WorkSizeCache.hh"
+#include "Batch.hh"
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using internal::WorkSizeKey;
+using internal::work_size_key;
+using internal::exceeds_lapack_int;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// One queued solve. Requests with equal keys, i.e., the same routine,
+// precision, options, and dimensions, are solved in the same batch.
+// key[ 0 ] is the LAPACK routine name; key[ 1 : ] are the remaining
+// arguments, in the order of the routine's argument list, which run
+// reads back to call the batch routine.
+struct BatchRequest
+{
+    using run_func = void (*)( std::vector< BatchRequest* > const& group );
+
+    BatchRequest* next = nullptr;  ///< link in the submission stack
+    WorkSizeKey key;
+    run_func    run  = nullptr;
+    void*       A    = nullptr;
+    void*       B    = nullptr;  ///< gels right-hand sides
+    void*       W    = nullptr;  ///< heevd eigenvalues
+    int64_t*    ipiv = nullptr;  ///< getrf pivots
+    std::chrono::steady_clock::time_point arrival;
+    std::promise< int64_t > promise;
+};
+
+using Request = BatchRequest;
+
+//------------------------------------------------------------------------------
+// LAPACK routine name for the precision of scalar_t, used in keys.
+template <typename scalar_t>
+const char* routine_name(
+    const char* sname, const char* dname, const char* cname, const char* zname )
+{
+    using real_t = blas::real_type< scalar_t >;
+    if (blas::is_complex< scalar_t >::value)
+        return std::is_same< real_t, float >::value ? cname : zname;
+    else
+        return std::is_same< real_t, float >::value ? sname : dname;
+}
+
+//------------------------------------------------------------------------------
+// Sets each request's future to its info.
+inline void complete(
+    std::vector< Request* > const& group, std::vector< int64_t > const& info )
+{
+    for (size_t i = 0; i < group.size(); ++i)
+        group[ i ]->promise.set_value( info[ i ] );
+}
+
+//------------------------------------------------------------------------------
+// The run functions solve a group of requests with equal keys using the
+// pointer-array batch routine, giving each argument once.
+
+// key = { name, m, n, lda }
+template <typename scalar_t>
+void run_getrf( std::vector< Request* > const& group )
+{
+    WorkSizeKey const& key = group[ 0 ]->key;
+    size_t batch = group.size();
+    std::vector< int64_t > m( 1, key[ 1 ] ), n( 1, key[ 2 ] ),
+                           lda( 1, key[ 3 ] );
+    std::vector< scalar_t* > Aarray( batch );
+    std::vector< int64_t* > ipiv_array( batch );
+    for (size_t i = 0; i < batch; ++i) {
+        Aarray[ i ] = static_cast< scalar_t* >( group[ i ]->A );
+        ipiv_array[ i ] = group[ i ]->ipiv;
+    }
+    std::vector< int64_t > info( batch );
+    lapack::getrf_batch( m, n, Aarray, lda, ipiv_array, batch, info );
+    complete( group, info );
+}
+
+// key = { name, uplo, n, lda }
+template <typename scalar_t>
+void run_potrf( std::vector< Request* > const& group )
+{
+    WorkSizeKey const& key = group[ 0 ]->key;
+    size_t batch = group.size();
+    std::vector< lapack::Uplo > uplo( 1, lapack::Uplo( key[ 1 ] ) );
+    std::vector< int64_t > n( 1, key[ 2 ] ), lda( 1, key[ 3 ] );
+    std::vector< scalar_t* > Aarray( batch );
+    for (size_t i = 0; i < batch; ++i) {
+        Aarray[ i ] = static_cast< scalar_t* >( group[ i ]->A );
+    }
+    std::vector< int64_t > info( batch );
+    lapack::potrf_batch( uplo, n, Aarray, lda, batch, info );
+    complete( group, info );
+}
+
+// key = { name, trans, m, n, nrhs, lda, ldb }
+template <typename scalar_t>
+void run_gels( std::vector< Request* > const& group )
+{
+    WorkSizeKey const& key = group[ 0 ]->key;
+    size_t batch = group.size();
+    std::vector< lapack::Op > trans( 1, lapack::Op( key[ 1 ] ) );
+    std::vector< int64_t > m( 1, key[ 2 ] ), n( 1, key[ 3 ] ),
+                           nrhs( 1, key[ 4 ] ), lda( 1, key[ 5 ] ),
+                           ldb( 1, key[ 6 ] );
+    std::vector< scalar_t* > Aarray( batch ), Barray( batch );
+    for (size_t i = 0; i < batch; ++i) {
+        Aarray[ i ] = static_cast< scalar_t* >( group[ i ]->A );
+        Barray[ i ] = static_cast< scalar_t* >( group[ i ]->B );
+    }
+    std::vector< int64_t > info( batch );
+    lapack::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                        batch, info );
+    complete( group, info );
+}
+
+// key = { name, jobz, uplo, n, lda }
+template <typename scalar_t>
+void run_heevd( std::vector< Request* > const& group )
+{
+    using real_t = blas::real_type< scalar_t >;
+    WorkSizeKey const& key = group[ 0 ]->key;
+    size_t batch = group.size();
+    std::vector< lapack::Job > jobz( 1, lapack::Job( key[ 1 ] ) );
+    std::vector< lapack::Uplo > uplo( 1, lapack::Uplo( key[ 2 ] ) );
+    std::vector< int64_t > n( 1, key[ 3 ] ), lda( 1, key[ 4 ] );
+    std::vector< scalar_t* > Aarray( batch );
+    std::vector< real_t* > W_array( batch );
+    for (size_t i = 0; i < batch; ++i) {
+        Aarray[ i ] = static_cast< scalar_t* >( group[ i ]->A );
+        W_array[ i ] = static_cast< real_t* >( group[ i ]->W );
+    }
+    std::vector< int64_t > info( batch );
+    lapack::heevd_batch( jobz, uplo, n, Aarray, lda, W_array, batch, info );
+    complete( group, info );
+}
+
+}  // namespace internal
+
+using internal::Request;
+
+//------------------------------------------------------------------------------
+// Worker thread and submission queue.
+//
+// Producers push requests onto a lock-free stack with compare-and-swap.
+// The worker takes the whole stack at once with an exchange, so it never
+// pops single nodes and there is no ABA problem, then reverses it into
+// submission order. Requests are added to the pending group for their
+// key; a group is solved once it is full or its oldest request reaches
+// its deadline.
+//
+// When it has nothing to do, the worker sets sleeping_ and rechecks the
+// stack before waiting, under mutex_. A producer that pushes and then
+// sees sleeping_ takes mutex_ to notify it. Both sides use sequentially
+// consistent operations, so either the worker sees the new request or
+// the producer sees sleeping_; a wakeup cannot be lost. While the worker
+// is busy, producers take no lock.
+class BatchingExecutor::Impl
+{
+public:
+    Impl( int64_t max_batch, std::chrono::microseconds max_delay );
+    ~Impl();
+
+    void push( Request* request );
+
+private:
+    using time_point = std::chrono::steady_clock::time_point;
+
+    struct Group
+    {
+        std::vector< Request* > requests;
+        time_point deadline;
+    };
+
+    void worker();
+    void execute( std::vector< Request* >& requests );
+
+    int64_t max_batch_;
+    std::chrono::microseconds max_delay_;
+
+    std::atomic< Request* > head_ { nullptr };
+    std::atomic< bool > sleeping_ { false };
+    std::atomic< bool > stop_ { false };
+    std::mutex mutex_;
+    std::condition_variable cv_;
+
+    // Started last, after the members it uses are initialized.
+    std::thread thread_;
+};
+
+//------------------------------------------------------------------------------
+BatchingExecutor::Impl::Impl(
+    int64_t max_batch, std::chrono::microseconds max_delay )
+    : max_batch_( max_batch ),
+      max_delay_( max_delay ),
+      thread_( &Impl::worker, this )
+{}
+
+//------------------------------------------------------------------------------
+// Solves all pending requests, then joins the worker.
+BatchingExecutor::Impl::~Impl()
+{
+    {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        stop_.store( true );
+    }
+    cv_.notify_one();
+    thread_.join();
+}
+
+//------------------------------------------------------------------------------
+void BatchingExecutor::Impl::push( Request* request )
+{
+    Request* head = head_.load( std::memory_order_relaxed );
+    do {
+        request->next = head;
+    } while (! head_.compare_exchange_weak( head, request ));
+
+    if (sleeping_.load()) {
+        std::lock_guard< std::mutex > lock( mutex_ );
+        cv_.notify_one();
+    }
+}
+
+//------------------------------------------------------------------------------
+// Solves one group, completing its requests' futures, then frees them.
+// Arguments were checked by the submit call, so the batch routine should
+// not throw; if it does, e.g., out of memory, every future in the group
+// gets the exception.
+void BatchingExecutor::Impl::execute( std::vector< Request* >& requests )
+{
+    try {
+        requests[ 0 ]->run( requests );
+    }
+    catch (...) {
+        for (Request* request : requests)
+            request->promise.set_exception( std::current_exception() );
+    }
+    for (Request* request : requests)
+        delete request;
+    requests.clear();
+}
+
+//------------------------------------------------------------------------------
+void BatchingExecutor::Impl::worker()
+{
+    std::map< WorkSizeKey, Group > groups;
+    std::vector< Request* > arrived;
+
+    while (true) {
+        // Take all requests submitted so far, in submission order.
+        arrived.clear();
+        for (Request* r = head_.exchange( nullptr ); r != nullptr; r = r->next)
+            arrived.push_back( r );
+
+        for (auto iter = arrived.rbegin(); iter != arrived.rend(); ++iter) {
+            Request* request = *iter;
+            Group& group = groups[ request->key ];
+            if (group.requests.empty())
+                group.deadline = request->arrival + max_delay_;
+            group.requests.push_back( request );
+            if (int64_t( group.requests.size() ) >= max_batch_)
+                execute( group.requests );
+        }
+
+        // Solve groups that reached their deadline, or all when stopping.
+        bool stop = stop_.load();
+        time_point now = std::chrono::steady_clock::now();
+        time_point next_deadline = time_point::max();
+        for (auto iter = groups.begin(); iter != groups.end(); ) {
+            Group& group = iter->second;
+            if (! group.requests.empty()
+                && (stop || group.deadline <= now)) {
+                execute( group.requests );
+            }
+            if (group.requests.empty()) {
+                iter = groups.erase( iter );
+            }
+            else {
+                next_deadline = std::min( next_deadline, group.deadline );
+                ++iter;
+            }
+        }
+
+        if (stop && groups.empty() && head_.load() == nullptr)
+            break;
+
+        // Wait for a new request, the next deadline, or stop.
+        std::unique_lock< std::mutex > lock( mutex_ );
+        sleeping_.store( true );
+        auto ready = [this] {
+            return head_.load() != nullptr || stop_.load();
+        };
+        if (groups.empty())
+            cv_.wait( lock, ready );
+        else
+            cv_.wait_until( lock, next_deadline, ready );
+        sleeping_.store( false );
+    }
+}
+
+//------------------------------------------------------------------------------
+BatchingExecutor::BatchingExecutor(
+    int64_t max_batch, std::chrono::microseconds max_delay )
+    : max_batch_( max_batch ),
+      max_delay_( max_delay )
+{
+    lapack_error_if( max_batch < 1 );
+    lapack_error_if( max_delay.count() < 0 );
+    impl_.reset( new Impl( max_batch, max_delay ) );
+}
+
+//------------------------------------------------------------------------------
+BatchingExecutor::~BatchingExecutor()
+{}
+
+//------------------------------------------------------------------------------
+void BatchingExecutor::submit( internal::BatchRequest* request )
+{
+    request->arrival = std::chrono::steady_clock::now();
+    impl_->push( request );
+}
+
+//------------------------------------------------------------------------------
+// The submit calls check arguments as the batch routines do, so errors
+// are thrown to the caller rather than failing the whole batch.
+template <typename scalar_t>
+std::future< int64_t > BatchingExecutor::getrf(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    int64_t* ipiv )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( exceeds_lapack_int( { m, n, lda } ) );
+
+    Request* request = new Request;
+    request->key = work_size_key(
+        internal::routine_name< scalar_t >(
+            "sgetrf", "dgetrf", "cgetrf", "zgetrf" ),
+        m, n, lda );
+    request->run  = internal::run_getrf< scalar_t >;
+    request->A    = A;
+    request->ipiv = ipiv;
+    std::future< int64_t > info = request->promise.get_future();
+    submit( request );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+std::future< int64_t > BatchingExecutor::potrf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( exceeds_lapack_int( { n, lda } ) );
+
+    Request* request = new Request;
+    request->key = work_size_key(
+        internal::routine_name< scalar_t >(
+            "spotrf", "dpotrf", "cpotrf", "zpotrf" ),
+        int64_t( uplo ), n, lda );
+    request->run = internal::run_potrf< scalar_t >;
+    request->A   = A;
+    std::future< int64_t > info = request->promise.get_future();
+    submit( request );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+std::future< int64_t > BatchingExecutor::gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb )
+{
+    internal::check_batch_op< scalar_t >( trans );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldb < max( 1, m, n ) );
+    lapack_error_if( exceeds_lapack_int( { m, n, nrhs, lda, ldb } ) );
+
+    Request* request = new Request;
+    request->key = work_size_key(
+        internal::routine_name< scalar_t >(
+            "sgels", "dgels", "cgels", "zgels" ),
+        int64_t( trans ), m, n, nrhs, lda, ldb );
+    request->run = internal::run_gels< scalar_t >;
+    request->A   = A;
+    request->B   = B;
+    std::future< int64_t > info = request->promise.get_future();
+    submit( request );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+std::future< int64_t > BatchingExecutor::heevd(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W )
+{
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( exceeds_lapack_int( { n, lda } ) );
+
+    Request* request = new Request;
+    request->key = work_size_key(
+        internal::routine_name< scalar_t >(
+            "ssyevd", "dsyevd", "cheevd", "zheevd" ),
+        int64_t( jobz ), int64_t( uplo ), n, lda );
+    request->run = internal::run_heevd< scalar_t >;
+    request->A   = A;
+    request->W   = W;
+    std::future< int64_t > info = request->promise.get_future();
+    submit( request );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template
+std::future< int64_t > BatchingExecutor::getrf< float >(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv );
+
+template
+std::future< int64_t > BatchingExecutor::getrf< double >(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv );
+
+template
+std::future< int64_t > BatchingExecutor::getrf< std::complex<float> >(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv );
+
+template
+std::future< int64_t > BatchingExecutor::getrf< std::complex<double> >(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv );
+
+template
+std::future< int64_t > BatchingExecutor::potrf< float >(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda );
+
+template
+std::future< int64_t > BatchingExecutor::potrf< double >(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda );
+
+template
+std::future< int64_t > BatchingExecutor::potrf< std::complex<float> >(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda );
+
+template
+std::future< int64_t > BatchingExecutor::potrf< std::complex<double> >(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda );
+
+template
+std::future< int64_t > BatchingExecutor::gels< float >(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb );
+
+template
+std::future< int64_t > BatchingExecutor::gels< double >(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb );
+
+template
+std::future< int64_t > BatchingExecutor::gels< std::complex<float> >(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb );
+
+template
+std::future< int64_t > BatchingExecutor::gels< std::complex<double> >(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb );
+
+template
+std::future< int64_t > BatchingExecutor::heevd< float >(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W );
+
+template
+std::future< int64_t > BatchingExecutor::heevd< double >(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W );
+
+template
+std::future< int64_t > BatchingExecutor::heevd< std::complex<float> >(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* W );
+
+template
+std::future< int64_t > BatchingExecutor::heevd< std::complex<double> >(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* W );
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30300  // >= 3.3
 
@@ -36,87 +37,22 @@ int64_t bbcsd(
     float* B22D,
     float* B22E )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobu1_ = job_csd2char( jobu1 );
-    char jobu2_ = job_csd2char( jobu2 );
-    char jobv1t_ = job_csd2char( jobv1t );
-    char jobv2t_ = job_csd2char( jobv2t );
-    char trans_ = op2char( trans );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int p_ = (lapack_int) p;
-    lapack_int q_ = (lapack_int) q;
-    lapack_int ldu1_ = (lapack_int) ldu1;
-    lapack_int ldu2_ = (lapack_int) ldu2;
-    lapack_int ldv1t_ = (lapack_int) ldv1t;
-    lapack_int ldv2t_ = (lapack_int) ldv2t;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "sbbcsd", m, 0, p );
 
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
-        B22E,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    bbcsd_work_size( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                     U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E,
+                     B12D, B12E, B21D, B21E, B22D, B22E,
+                     &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
-        B22E,
-        &work[0], &lwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                       U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E,
+                       B12D, B12E, B21D, B21E, B22D, B22E,
+                       work.data(), lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -138,87 +74,22 @@ int64_t bbcsd(
     double* B22D,
     double* B22E )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobu1_ = job_csd2char( jobu1 );
-    char jobu2_ = job_csd2char( jobu2 );
-    char jobv1t_ = job_csd2char( jobv1t );
-    char jobv2t_ = job_csd2char( jobv2t );
-    char trans_ = op2char( trans );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int p_ = (lapack_int) p;
-    lapack_int q_ = (lapack_int) q;
-    lapack_int ldu1_ = (lapack_int) ldu1;
-    lapack_int ldu2_ = (lapack_int) ldu2;
-    lapack_int ldv1t_ = (lapack_int) ldv1t;
-    lapack_int ldv2t_ = (lapack_int) ldv2t;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "dbbcsd", m, 0, p );
 
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
-        B22E,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    bbcsd_work_size( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                     U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E,
+                     B12D, B12E, B21D, B21E, B22D, B22E,
+                     &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        U1, &ldu1_,
-        U2, &ldu2_,
-        V1T, &ldv1t_,
-        V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
-        B22E,
-        &work[0], &lwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                       U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E,
+                       B12D, B12E, B21D, B21E, B22D, B22E,
+                       work.data(), lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -240,87 +111,22 @@ int64_t bbcsd(
     float* B22D,
     float* B22E )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobu1_ = job_csd2char( jobu1 );
-    char jobu2_ = job_csd2char( jobu2 );
-    char jobv1t_ = job_csd2char( jobv1t );
-    char jobv2t_ = job_csd2char( jobv2t );
-    char trans_ = op2char( trans );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int p_ = (lapack_int) p;
-    lapack_int q_ = (lapack_int) q;
-    lapack_int ldu1_ = (lapack_int) ldu1;
-    lapack_int ldu2_ = (lapack_int) ldu2;
-    lapack_int ldv1t_ = (lapack_int) ldv1t;
-    lapack_int ldv2t_ = (lapack_int) ldv2t;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "cbbcsd", m, 0, p );
 
     // query for workspace size
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        (lapack_complex_float*) U1, &ldu1_,
-        (lapack_complex_float*) U2, &ldu2_,
-        (lapack_complex_float*) V1T, &ldv1t_,
-        (lapack_complex_float*) V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
-        B22E,
-        qry_rwork, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    int64_t lrwork;
+    bbcsd_work_size( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                     U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E,
+                     B12D, B12E, B21D, B21E, B22D, B22E,
+                     &lrwork );
 
     // allocate workspace
-    lapack::vector< float > rwork( lrwork_ );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_cbbcsd(
-        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
-        theta,
-        phi,
-        (lapack_complex_float*) U1, &ldu1_,
-        (lapack_complex_float*) U2, &ldu2_,
-        (lapack_complex_float*) V1T, &ldv1t_,
-        (lapack_complex_float*) V2T, &ldv2t_,
-        B11D,
-        B11E,
-        B12D,
-        B12E,
-        B21D,
-        B21E,
-        B22D,
-        B22E,
-        &rwork[0], &lrwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                       U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E,
+                       B12D, B12E, B21D, B21E, B22D, B22E,
+                       rwork.data(), lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -527,6 +333,46 @@ int64_t bbcsd(
     double* B22D,
     double* B22E )
 {
+    LAPACK_INSTRUMENT( "zbbcsd", m, 0, p );
+
+    // query for workspace size
+    int64_t lrwork;
+    bbcsd_work_size( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                     U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E,
+                     B12D, B12E, B21D, B21E, B22D, B22E,
+                     &lrwork );
+
+    // allocate workspace
+    lapack::vector< double > rwork( lrwork );
+
+    return bbcsd_work( jobu1, jobu2, jobv1t, jobv2t, trans, m, p, q, theta, phi,
+                       U1, ldu1, U2, ldu2, V1T, ldv1t, V2T, ldv2t, B11D, B11E,
+                       B12D, B12E, B21D, B21E, B22D, B22E,
+                       rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "sbbcsd_work_size", m, 0, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -552,16 +398,168 @@ int64_t bbcsd(
     lapack_int info_ = 0;
 
     // query for workspace size
-    double qry_rwork[1];
+    float qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_zbbcsd(
+    LAPACK_sbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
         phi,
-        (lapack_complex_double*) U1, &ldu1_,
-        (lapack_complex_double*) U2, &ldu2_,
-        (lapack_complex_double*) V1T, &ldv1t_,
-        (lapack_complex_double*) V2T, &ldv2t_,
+        U1, &ldu1_,
+        U2, &ldu2_,
+        V1T, &ldv1t_,
+        V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dbbcsd_work_size", m, 0, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu1_ = job_csd2char( jobu1 );
+    char jobu2_ = job_csd2char( jobu2 );
+    char jobv1t_ = job_csd2char( jobv1t );
+    char jobv2t_ = job_csd2char( jobv2t );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int q_ = (lapack_int) q;
+    lapack_int ldu1_ = (lapack_int) ldu1;
+    lapack_int ldu2_ = (lapack_int) ldu2;
+    lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int ldv2t_ = (lapack_int) ldv2t;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        U1, &ldu1_,
+        U2, &ldu2_,
+        V1T, &ldv1t_,
+        V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "cbbcsd_work_size", m, 0, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu1_ = job_csd2char( jobu1 );
+    char jobu2_ = job_csd2char( jobu2 );
+    char jobv1t_ = job_csd2char( jobv1t );
+    char jobv2t_ = job_csd2char( jobv2t );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int q_ = (lapack_int) q;
+    lapack_int ldu1_ = (lapack_int) ldu1;
+    lapack_int ldu2_ = (lapack_int) ldu2;
+    lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int ldv2t_ = (lapack_int) ldv2t;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        (lapack_complex_float*) U1, &ldu1_,
+        (lapack_complex_float*) U2, &ldu2_,
+        (lapack_complex_float*) V1T, &ldv1t_,
+        (lapack_complex_float*) V2T, &ldv2t_,
         B11D,
         B11E,
         B12D,
@@ -578,11 +576,390 @@ int64_t bbcsd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    *lrwork = max( 1, int64_t( qry_rwork[0] ) );
+}
 
-    // allocate workspace
-    lapack::vector< double > rwork( lrwork_ );
+// -----------------------------------------------------------------------------
+/// Queries the workspace size needed by `lapack::bbcsd_work`.
+/// Arguments through B22E are the same as for `lapack::bbcsd`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lrwork
+///     Optimal length of the real array rwork.
+///     Zero for real matrices, which do not use rwork.
+///
+/// @ingroup bbcsd
+void bbcsd_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "zbbcsd_work_size", m, 0, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu1_ = job_csd2char( jobu1 );
+    char jobu2_ = job_csd2char( jobu2 );
+    char jobv1t_ = job_csd2char( jobv1t );
+    char jobv2t_ = job_csd2char( jobv2t );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int q_ = (lapack_int) q;
+    lapack_int ldu1_ = (lapack_int) ldu1;
+    lapack_int ldu2_ = (lapack_int) ldu2;
+    lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int ldv2t_ = (lapack_int) ldv2t;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        (lapack_complex_double*) U1, &ldu1_,
+        (lapack_complex_double*) U2, &ldu2_,
+        (lapack_complex_double*) V1T, &ldv1t_,
+        (lapack_complex_double*) V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        qry_rwork, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lrwork = max( 1, int64_t( qry_rwork[0] ) );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd_work(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "sbbcsd_work", m, 0, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu1_ = job_csd2char( jobu1 );
+    char jobu2_ = job_csd2char( jobu2 );
+    char jobv1t_ = job_csd2char( jobv1t );
+    char jobv2t_ = job_csd2char( jobv2t );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int q_ = (lapack_int) q;
+    lapack_int ldu1_ = (lapack_int) ldu1;
+    lapack_int ldu2_ = (lapack_int) ldu2;
+    lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int ldv2t_ = (lapack_int) ldv2t;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        U1, &ldu1_,
+        U2, &ldu2_,
+        V1T, &ldv1t_,
+        V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd_work(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dbbcsd_work", m, 0, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu1_ = job_csd2char( jobu1 );
+    char jobu2_ = job_csd2char( jobu2 );
+    char jobv1t_ = job_csd2char( jobv1t );
+    char jobv2t_ = job_csd2char( jobv2t );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int q_ = (lapack_int) q;
+    lapack_int ldu1_ = (lapack_int) ldu1;
+    lapack_int ldu2_ = (lapack_int) ldu2;
+    lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int ldv2t_ = (lapack_int) ldv2t;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        U1, &ldu1_,
+        U2, &ldu2_,
+        V1T, &ldv1t_,
+        V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup bbcsd
+int64_t bbcsd_work(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    float* theta,
+    float* phi,
+    std::complex<float>* U1, int64_t ldu1,
+    std::complex<float>* U2, int64_t ldu2,
+    std::complex<float>* V1T, int64_t ldv1t,
+    std::complex<float>* V2T, int64_t ldv2t,
+    float* B11D,
+    float* B11E,
+    float* B12D,
+    float* B12E,
+    float* B21D,
+    float* B21E,
+    float* B22D,
+    float* B22E,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "cbbcsd_work", m, 0, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu1_ = job_csd2char( jobu1 );
+    char jobu2_ = job_csd2char( jobu2 );
+    char jobv1t_ = job_csd2char( jobv1t );
+    char jobv2t_ = job_csd2char( jobv2t );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int q_ = (lapack_int) q;
+    lapack_int ldu1_ = (lapack_int) ldu1;
+    lapack_int ldu2_ = (lapack_int) ldu2;
+    lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int ldv2t_ = (lapack_int) ldv2t;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cbbcsd(
+        &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
+        theta,
+        phi,
+        (lapack_complex_float*) U1, &ldu1_,
+        (lapack_complex_float*) U2, &ldu2_,
+        (lapack_complex_float*) V1T, &ldv1t_,
+        (lapack_complex_float*) V2T, &ldv2t_,
+        B11D,
+        B11E,
+        B12D,
+        B12E,
+        B21D,
+        B21E,
+        B22D,
+        B22E,
+        rwork, &lrwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::bbcsd` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::bbcsd_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through B22E and the return value are the same as for
+/// `lapack::bbcsd`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param rwork
+///     The real vector rwork of length lrwork.
+///     Not referenced for real matrices.
+///
+/// @param[in] lrwork
+///     The length of rwork, as returned by `lapack::bbcsd_work_size`.
+///
+/// @ingroup bbcsd
+int64_t bbcsd_work(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, lapack::Job jobv2t, lapack::Op trans, int64_t m, int64_t p, int64_t q,
+    double* theta,
+    double* phi,
+    std::complex<double>* U1, int64_t ldu1,
+    std::complex<double>* U2, int64_t ldu2,
+    std::complex<double>* V1T, int64_t ldv1t,
+    std::complex<double>* V2T, int64_t ldv2t,
+    double* B11D,
+    double* B11E,
+    double* B12D,
+    double* B12E,
+    double* B21D,
+    double* B21E,
+    double* B22D,
+    double* B22E,
+    double* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "zbbcsd_work", m, 0, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv2t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu1_ = job_csd2char( jobu1 );
+    char jobu2_ = job_csd2char( jobu2 );
+    char jobv1t_ = job_csd2char( jobv1t );
+    char jobv2t_ = job_csd2char( jobv2t );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int q_ = (lapack_int) q;
+    lapack_int ldu1_ = (lapack_int) ldu1;
+    lapack_int ldu2_ = (lapack_int) ldu2;
+    lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int ldv2t_ = (lapack_int) ldv2t;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zbbcsd(
         &jobu1_, &jobu2_, &jobv1t_, &jobv2t_, &trans_, &m_, &p_, &q_,
         theta,
@@ -599,7 +976,7 @@ int64_t bbcsd(
         B21E,
         B22D,
         B22E,
-        &rwork[0], &lrwork_, &info_
+        rwork, &lrwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1, 1, 1
         #endif
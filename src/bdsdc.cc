@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -26,6 +27,8 @@ int64_t bdsdc(
     float* Q,
     int64_t* IQ )
 {
+    LAPACK_INSTRUMENT( "sbdsdc", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -58,6 +61,7 @@ int64_t bdsdc(
     lapack::vector< float > work( (max( 1, lwork )) );
     lapack::vector< lapack_int > iwork( (8*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sbdsdc(
         &uplo_, &compq_, &n_,
         D,
@@ -195,6 +199,8 @@ int64_t bdsdc(
     double* Q,
     int64_t* IQ )
 {
+    LAPACK_INSTRUMENT( "dbdsdc", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -227,6 +233,7 @@ int64_t bdsdc(
     lapack::vector< double > work( (max( 1, lwork )) );
     lapack::vector< lapack_int > iwork( (8*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dbdsdc(
         &uplo_, &compq_, &n_,
         D,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t bdsqr(
     float* U, int64_t ldu,
     float* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "sbdsqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -48,6 +51,7 @@ int64_t bdsqr(
     // allocate workspace
     lapack::vector< float > work( (4*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sbdsqr(
         &uplo_, &n_, &ncvt_, &nru_, &ncc_,
         D,
@@ -76,6 +80,8 @@ int64_t bdsqr(
     double* U, int64_t ldu,
     double* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "dbdsqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -99,6 +105,7 @@ int64_t bdsqr(
     // allocate workspace
     lapack::vector< double > work( (4*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dbdsqr(
         &uplo_, &n_, &ncvt_, &nru_, &ncc_,
         D,
@@ -127,6 +134,8 @@ int64_t bdsqr(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "cbdsqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -150,6 +159,7 @@ int64_t bdsqr(
     // allocate workspace
     lapack::vector< float > rwork( (4*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cbdsqr(
         &uplo_, &n_, &ncvt_, &nru_, &ncc_,
         D,
@@ -277,6 +287,8 @@ int64_t bdsqr(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "zbdsqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -300,6 +312,7 @@ int64_t bdsqr(
     // allocate workspace
     lapack::vector< double > rwork( (4*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zbdsqr(
         &uplo_, &n_, &ncvt_, &nru_, &ncc_,
         D,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
 
@@ -27,6 +28,8 @@ int64_t bdsvdx(
     float* S,
     float* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "sbdsvdx", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -48,6 +51,7 @@ int64_t bdsvdx(
     lapack::vector< float > work( (14*n) );
     lapack::vector< lapack_int > iwork( (12*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sbdsvdx(
         &uplo_, &jobz_, &range_, &n_,
         D,
@@ -205,6 +209,8 @@ int64_t bdsvdx(
     double* S,
     double* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "dbdsvdx", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -226,6 +232,7 @@ int64_t bdsvdx(
     lapack::vector< double > work( (14*n) );
     lapack::vector< lapack_int > iwork( (12*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dbdsvdx(
         &uplo_, &jobz_, &range_, &n_,
         D,
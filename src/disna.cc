@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t disna(
     float const* D,
     float* SEP )
 {
+    LAPACK_INSTRUMENT( "sdisna", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -30,6 +33,7 @@ int64_t disna(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sdisna(
         &jobcond_, &m_, &n_,
         D,
@@ -50,6 +54,8 @@ int64_t disna(
     double const* D,
     double* SEP )
 {
+    LAPACK_INSTRUMENT( "ddisna", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -60,6 +66,7 @@ int64_t disna(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ddisna(
         &jobcond_, &m_, &n_,
         D,
@@ -0,0 +1,287 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/dispatch.hh"
+#include "lapack/util.hh"
+#include "lapack/work_size_cache.hh"
+#include "Dispatch.hh"
+
+#ifdef LAPACK_HAVE_DISPATCH
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Names of DispatchRoutine values, in order.
+static const char* const dispatch_routine_names[] = {
+    "spotrf", "dpotrf", "cpotrf", "zpotrf",
+    "sgetrf", "dgetrf", "cgetrf", "zgetrf",
+    "sgesdd", "dgesdd", "cgesdd", "zgesdd",
+    "ssyevd", "dsyevd", "cheevd", "zheevd",
+};
+
+static constexpr int num_dispatch_routines = int( DispatchRoutine::count );
+
+static_assert( sizeof(dispatch_routine_names) / sizeof(const char*)
+               == num_dispatch_routines,
+               "dispatch_routine_names must match DispatchRoutine" );
+
+//------------------------------------------------------------------------------
+// Returns the routine's index, or -1 if it cannot be dispatched.
+static int dispatch_routine_index( std::string const& routine )
+{
+    for (int i = 0; i < num_dispatch_routines; ++i) {
+        if (routine == dispatch_routine_names[ i ])
+            return i;
+    }
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+// Sizes n <= max_n, and above the previous segment's max_n, call func
+// from backend; func is nullptr and backend -1 for the linked LAPACK,
+// including when the backend lacks the routine.
+struct DispatchSegment
+{
+    int64_t max_n;
+    void* func;
+    int backend;
+};
+
+//------------------------------------------------------------------------------
+// Backends and rules from one dispatch table file, resolved when loaded
+// into, for each routine, segments sorted by max_n. Tables are immutable
+// once published, so lookups need no lock. Libraries are never closed, so
+// function pointers remain valid even after the table is replaced.
+class DispatchTable
+{
+public:
+    explicit DispatchTable( std::string const& filename );
+
+    DispatchSegment const* select( int routine, int64_t n ) const;
+    std::string const& name( int backend ) const;
+
+private:
+    std::vector< std::string > backends_;
+    std::vector< DispatchSegment > segments_[ num_dispatch_routines ];
+};
+
+//------------------------------------------------------------------------------
+// Rule routing routine (or "*") with size n <= max_n to backend,
+// an index into the backends, or -1 for the linked LAPACK.
+struct DispatchRule
+{
+    std::string routine;
+    int64_t max_n;
+    int backend;
+};
+
+//------------------------------------------------------------------------------
+// Returns the routine's entry point in the library, mangled the same as
+// the linked LAPACK, or nullptr if the library lacks it.
+static void* dispatch_symbol( void* handle, const char* routine )
+{
+    std::string name = routine;
+    #if defined(BLAS_FORTRAN_UPPER) || defined(LAPACK_FORTRAN_UPPER) || defined(LAPACK_GLOBAL_PATTERN_UC)
+        for (auto& c : name)
+            c = char( std::toupper( c ) );
+    #elif defined(BLAS_FORTRAN_LOWER) || defined(LAPACK_FORTRAN_LOWER) || defined(LAPACK_GLOBAL_PATTERN_LC)
+        // as is
+    #else
+        name += "_";
+    #endif
+    return dlsym( handle, name.c_str() );
+}
+
+//------------------------------------------------------------------------------
+// Reads the table and resolves its rules. Throws Error on a malformed line
+// or a library that fails to load, naming the file and line.
+DispatchTable::DispatchTable( std::string const& filename )
+{
+    std::ifstream file( filename );
+    if (! file)
+        throw Error( "cannot open dispatch table " + filename );
+
+    std::vector< void* > handles;
+    std::vector< DispatchRule > rules;
+    std::string line;
+    for (int lineno = 1; std::getline( file, line ); ++lineno) {
+        line = line.substr( 0, line.find( '#' ) );
+        std::istringstream words( line );
+        std::string first, second, third;
+        if (! (words >> first))
+            continue;  // blank or comment
+        std::string where = filename + ":" + std::to_string( lineno );
+        if (! (words >> second >> third))
+            throw Error( "expected 3 fields at " + where );
+
+        if (first == "backend") {
+            void* handle = dlopen( third.c_str(), RTLD_NOW | RTLD_LOCAL );
+            if (handle == nullptr)
+                throw Error( "cannot load backend " + third + " at " + where
+                             + ": " + dlerror() );
+            backends_.push_back( second );
+            handles.push_back( handle );
+        }
+        else {
+            int backend = -1;
+            if (third != "default") {
+                auto iter = std::find( backends_.begin(), backends_.end(),
+                                       third );
+                if (iter == backends_.end())
+                    throw Error( "unknown backend " + third + " at " + where );
+                backend = int( iter - backends_.begin() );
+            }
+            int64_t max_n = std::numeric_limits< int64_t >::max();
+            if (second != "*") {
+                char* end;
+                max_n = std::strtoll( second.c_str(), &end, 10 );
+                if (*end != '\0')
+                    throw Error( "invalid max_n " + second + " at " + where );
+            }
+            rules.push_back( { first, max_n, backend } );
+        }
+    }
+
+    // For each routine, the first matching rule with n <= max_n wins,
+    // so a rule adds a segment only above the largest max_n before it.
+    for (int i = 0; i < num_dispatch_routines; ++i) {
+        const char* routine = dispatch_routine_names[ i ];
+        auto& segments = segments_[ i ];
+        for (auto const& rule : rules) {
+            if (rule.routine != "*" && rule.routine != routine)
+                continue;
+            if (! segments.empty() && rule.max_n <= segments.back().max_n)
+                continue;
+            DispatchSegment segment = { rule.max_n, nullptr, -1 };
+            if (rule.backend >= 0) {
+                segment.func = dispatch_symbol( handles[ rule.backend ],
+                                                routine );
+                if (segment.func != nullptr)
+                    segment.backend = rule.backend;
+            }
+            segments.push_back( segment );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Returns the segment for routine and n, or nullptr if no rule matches.
+DispatchSegment const* DispatchTable::select( int routine, int64_t n ) const
+{
+    auto const& segments = segments_[ routine ];
+    auto iter = std::lower_bound(
+        segments.begin(), segments.end(), n,
+        []( DispatchSegment const& segment, int64_t n_ ) {
+            return segment.max_n < n_;
+        } );
+    return iter == segments.end() ? nullptr : &*iter;
+}
+
+//------------------------------------------------------------------------------
+std::string const& DispatchTable::name( int backend ) const
+{
+    static const std::string default_name = "default";
+    return backend < 0 ? default_name : backends_[ backend ];
+}
+
+//------------------------------------------------------------------------------
+// Keeps every loaded table until the process exits, since other threads
+// may still be reading a table after it is replaced; tables are small and
+// replaced rarely. Returns the table.
+static DispatchTable const* keep_table( std::string const& filename )
+{
+    static std::mutex mutex;
+    static std::vector< std::unique_ptr< DispatchTable const > > tables;
+
+    auto table = std::make_unique< DispatchTable const >( filename );
+    std::lock_guard< std::mutex > guard( mutex );
+    tables.push_back( std::move( table ) );
+    return tables.back().get();
+}
+
+//------------------------------------------------------------------------------
+// Current table, initially from $LAPACKPP_DISPATCH; null if none.
+static std::atomic< DispatchTable const* >& dispatch_table()
+{
+    static std::atomic< DispatchTable const* > table { [] {
+        const char* env = std::getenv( "LAPACKPP_DISPATCH" );
+        return env != nullptr && env[ 0 ] != '\0'
+               ? keep_table( env )
+               : nullptr;
+    }() };
+    return table;
+}
+
+//------------------------------------------------------------------------------
+void* dispatch_lookup( DispatchRoutine routine, int64_t n )
+{
+    auto table = dispatch_table().load( std::memory_order_acquire );
+    if (table == nullptr)
+        return nullptr;
+
+    auto segment = table->select( int( routine ), n );
+    return segment ? segment->func : nullptr;
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+void load_dispatch_table( std::string const& filename )
+{
+    internal::DispatchTable const* table = nullptr;
+    if (! filename.empty())
+        table = internal::keep_table( filename );
+    internal::dispatch_table().store( table, std::memory_order_release );
+    clear_work_size_cache();
+}
+
+//------------------------------------------------------------------------------
+std::string dispatch_backend( std::string const& routine, int64_t n )
+{
+    auto table = internal::dispatch_table().load( std::memory_order_acquire );
+    int index = internal::dispatch_routine_index( routine );
+    if (table == nullptr || index < 0)
+        return "default";
+
+    auto segment = table->select( index, n );
+    return table->name( segment ? segment->backend : -1 );
+}
+
+}  // namespace lapack
+
+#else  // not LAPACK_HAVE_DISPATCH
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+void load_dispatch_table( std::string const& filename )
+{
+    throw Error( "LAPACK++ was built without dispatch support (use_dispatch)" );
+}
+
+//------------------------------------------------------------------------------
+std::string dispatch_backend( std::string const& routine, int64_t n )
+{
+    return "default";
+}
+
+}  // namespace lapack
+
+#endif  // LAPACK_HAVE_DISPATCH
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -26,6 +27,8 @@ int64_t gbbrd(
     float* PT, int64_t ldpt,
     float* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "sgbbrd", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -53,6 +56,7 @@ int64_t gbbrd(
     // allocate workspace
     lapack::vector< float > work( (2*max(m,n)) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgbbrd(
         &vect_, &m_, &n_, &ncc_, &kl_, &ku_,
         AB, &ldab_,
@@ -83,6 +87,8 @@ int64_t gbbrd(
     double* PT, int64_t ldpt,
     double* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "dgbbrd", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -110,6 +116,7 @@ int64_t gbbrd(
     // allocate workspace
     lapack::vector< double > work( (2*max(m,n)) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgbbrd(
         &vect_, &m_, &n_, &ncc_, &kl_, &ku_,
         AB, &ldab_,
@@ -140,6 +147,8 @@ int64_t gbbrd(
     std::complex<float>* PT, int64_t ldpt,
     std::complex<float>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "cgbbrd", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -168,6 +177,7 @@ int64_t gbbrd(
     lapack::vector< std::complex<float> > work( (max(m,n)) );
     lapack::vector< float > rwork( (max(m,n)) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgbbrd(
         &vect_, &m_, &n_, &ncc_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -284,6 +294,8 @@ int64_t gbbrd(
     std::complex<double>* PT, int64_t ldpt,
     std::complex<double>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "zgbbrd", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -312,6 +324,7 @@ int64_t gbbrd(
     lapack::vector< std::complex<double> > work( (max(m,n)) );
     lapack::vector< double > rwork( (max(m,n)) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgbbrd(
         &vect_, &m_, &n_, &ncc_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
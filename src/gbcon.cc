@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t gbcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "sgbcon", 0, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -37,7 +40,8 @@ int64_t gbcon(
     lapack_int ldab_ = (lapack_int) ldab;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -48,6 +52,7 @@ int64_t gbcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgbcon(
         &norm_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -72,6 +77,8 @@ int64_t gbcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "dgbcon", 0, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -86,7 +93,8 @@ int64_t gbcon(
     lapack_int ldab_ = (lapack_int) ldab;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -97,6 +105,7 @@ int64_t gbcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgbcon(
         &norm_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -121,6 +130,8 @@ int64_t gbcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "cgbcon", 0, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -135,7 +146,8 @@ int64_t gbcon(
     lapack_int ldab_ = (lapack_int) ldab;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -146,6 +158,7 @@ int64_t gbcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgbcon(
         &norm_, &n_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -222,6 +235,8 @@ int64_t gbcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "zgbcon", 0, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -236,7 +251,8 @@ int64_t gbcon(
     lapack_int ldab_ = (lapack_int) ldab;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -247,6 +263,7 @@ int64_t gbcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgbcon(
         &norm_, &n_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t gbequ(
     float* colcnd,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "sgbequ", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -40,6 +43,7 @@ int64_t gbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgbequ(
         &m_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -62,6 +66,8 @@ int64_t gbequ(
     double* colcnd,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "dgbequ", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -77,6 +83,7 @@ int64_t gbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgbequ(
         &m_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -99,6 +106,8 @@ int64_t gbequ(
     float* colcnd,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "cgbequ", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -114,6 +123,7 @@ int64_t gbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgbequ(
         &m_, &n_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -201,6 +211,8 @@ int64_t gbequ(
     double* colcnd,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "zgbequ", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -216,6 +228,7 @@ int64_t gbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgbequ(
         &m_, &n_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t gbequb(
     float* colcnd,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "sgbequb", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -40,6 +43,7 @@ int64_t gbequb(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgbequb(
         &m_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -62,6 +66,8 @@ int64_t gbequb(
     double* colcnd,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "dgbequb", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -77,6 +83,7 @@ int64_t gbequb(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgbequb(
         &m_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -99,6 +106,8 @@ int64_t gbequb(
     float* colcnd,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "cgbequb", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -114,6 +123,7 @@ int64_t gbequb(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgbequb(
         &m_, &n_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -208,6 +218,8 @@ int64_t gbequb(
     double* colcnd,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "zgbequb", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -223,6 +235,7 @@ int64_t gbequb(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgbequb(
         &m_, &n_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -27,6 +28,8 @@ int64_t gbrfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "sgbrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -47,7 +50,8 @@ int64_t gbrfs(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -60,6 +64,7 @@ int64_t gbrfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgbrfs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -93,6 +98,8 @@ int64_t gbrfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dgbrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -113,7 +120,8 @@ int64_t gbrfs(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -126,6 +134,7 @@ int64_t gbrfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgbrfs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -159,6 +168,8 @@ int64_t gbrfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "cgbrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -179,7 +190,8 @@ int64_t gbrfs(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -192,6 +204,7 @@ int64_t gbrfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgbrfs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -311,6 +324,8 @@ int64_t gbrfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "zgbrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -331,7 +346,8 @@ int64_t gbrfs(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -344,6 +360,7 @@ int64_t gbrfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgbrfs(
         &trans_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
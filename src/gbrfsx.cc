@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #ifdef LAPACK_HAVE_XBLAS
 
@@ -34,6 +35,8 @@ int64_t gbrfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    LAPACK_INSTRUMENT( "sgbrfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -57,7 +60,8 @@ int64_t gbrfsx(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -72,6 +76,7 @@ int64_t gbrfsx(
     lapack::vector< float > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgbrfsx(
         &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -114,6 +119,8 @@ int64_t gbrfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    LAPACK_INSTRUMENT( "dgbrfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -137,7 +144,8 @@ int64_t gbrfsx(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -152,6 +160,7 @@ int64_t gbrfsx(
     lapack::vector< double > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgbrfsx(
         &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -194,6 +203,8 @@ int64_t gbrfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    LAPACK_INSTRUMENT( "cgbrfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -217,7 +228,8 @@ int64_t gbrfsx(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -232,6 +244,7 @@ int64_t gbrfsx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgbrfsx(
         &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -575,6 +588,8 @@ int64_t gbrfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    LAPACK_INSTRUMENT( "zgbrfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -598,7 +613,8 @@ int64_t gbrfsx(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -613,6 +629,7 @@ int64_t gbrfsx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgbrfsx(
         &trans_, &equed_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
@@ -0,0 +1,439 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+#include "SmallBand.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Factors and solves one problem with the fixed-bandwidth kernels, as in
+// gbsv: the solve is skipped if U is exactly singular.
+template <typename scalar_t>
+int64_t gbsv_small(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    scalar_t* AB, int64_t ldab,
+    int64_t* ipiv,
+    scalar_t* B, int64_t ldb )
+{
+    int64_t info = gbtrf_small( n, n, kl, ku, AB, ldab, ipiv );
+    if (info == 0)
+        gbtrs_small( Op::NoTrans, n, kl, ku, nrhs, AB, ldab, ipiv, B, ldb );
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Pointer-array gbsv_batch. Bands with kl, ku <= small_band_max use the
+// native fixed-bandwidth kernels, which write the 64-bit pivots directly.
+// Wider bands call the lapack_int variant of gbsv, so with 32-bit
+// lapack_int, pivots go through a per-thread buffer instead of being
+// allocated per problem.
+template <typename scalar_t>
+void gbsv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< scalar_t* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< scalar_t* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    // check arguments
+    check_batch_arg( n, batch );
+    check_batch_arg( kl, batch );
+    check_batch_arg( ku, batch );
+    check_batch_arg( nrhs, batch );
+    check_batch_arg( ldab, batch );
+    check_batch_arg( ldb, batch );
+    check_batch_array( ABarray, batch );
+    check_batch_array( ipiv_array, batch );
+    check_batch_array( Barray, batch );
+    int64_t max_n = 1;
+    for (size_t i = 0; i < batch; ++i) {
+        int64_t n_i    = batch_arg( n,    i );
+        int64_t kl_i   = batch_arg( kl,   i );
+        int64_t ku_i   = batch_arg( ku,   i );
+        int64_t nrhs_i = batch_arg( nrhs, i );
+        int64_t ldab_i = batch_arg( ldab, i );
+        int64_t ldb_i  = batch_arg( ldb,  i );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( kl_i < 0 );
+        lapack_error_if( ku_i < 0 );
+        lapack_error_if( nrhs_i < 0 );
+        lapack_error_if( ldab_i < 2*kl_i + ku_i + 1 );
+        lapack_error_if( ldb_i < max( 1, n_i ) );
+        lapack_error_if( exceeds_lapack_int( { n_i, kl_i, ku_i, nrhs_i,
+                                               ldab_i, ldb_i } ) );
+        max_n = max( max_n, n_i );
+    }
+    info.resize( batch );
+
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots, one buffer per thread
+        lapack::vector< lapack_int > ipiv_( batch_max_threads() * max_n );
+    #endif
+
+    auto cost = [&]( size_t i ) {
+        return Gflop< scalar_t >::gbsv(
+            batch_arg( n, i ), batch_arg( kl, i ), batch_arg( ku, i ),
+            batch_arg( nrhs, i ) );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        int64_t n_i    = batch_arg( n,    i );
+        int64_t kl_i   = batch_arg( kl,   i );
+        int64_t ku_i   = batch_arg( ku,   i );
+        int64_t nrhs_i = batch_arg( nrhs, i );
+        int64_t ldab_i = batch_arg( ldab, i );
+        int64_t ldb_i  = batch_arg( ldb,  i );
+        if (is_small_band( kl_i, ku_i )) {
+            info[ i ] = gbsv_small( n_i, kl_i, ku_i, nrhs_i,
+                                    ABarray[ i ], ldab_i, ipiv_array[ i ],
+                                    Barray[ i ], ldb_i );
+            return;
+        }
+
+        #ifndef LAPACK_ILP64
+            lapack_int* ipiv_ptr = &ipiv_[ batch_thread_num() * max_n ];
+        #else
+            lapack_int* ipiv_ptr = ipiv_array[ i ];
+        #endif
+
+        info[ i ] = lapack::gbsv( n_i, kl_i, ku_i, nrhs_i,
+                                  ABarray[ i ], ldab_i, ipiv_ptr,
+                                  Barray[ i ], ldb_i );
+
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_ptr, ipiv_ptr + n_i, ipiv_array[ i ] );
+        #endif
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided gbsv_batch.
+template <typename scalar_t>
+void gbsv_batch(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    scalar_t* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( kl < 0 );
+    lapack_error_if( ku < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldab < 2*kl + ku + 1 );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch > 1 && strideAB < ldab*n );
+    lapack_error_if( batch > 1 && stride_ipiv < n );
+    lapack_error_if( batch > 1 && strideB < ldb*nrhs );
+    lapack_error_if( exceeds_lapack_int( { n, kl, ku, nrhs, ldab, ldb } ) );
+
+    if (is_small_band( kl, ku )) {
+        #ifdef _OPENMP
+        #pragma omp parallel for schedule( static )
+        #endif
+        for (int64_t i = 0; i < int64_t( batch ); ++i) {
+            info[ i ] = gbsv_small( n, kl, ku, nrhs, &AB[ i*strideAB ], ldab,
+                                    &ipiv[ i*stride_ipiv ],
+                                    &B[ i*strideB ], ldb );
+        }
+        return;
+    }
+
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots, one buffer per thread
+        int64_t max_n = max( 1, n );
+        lapack::vector< lapack_int > ipiv_( batch_max_threads() * max_n );
+    #endif
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        #ifndef LAPACK_ILP64
+            lapack_int* ipiv_ptr = &ipiv_[ batch_thread_num() * max_n ];
+        #else
+            lapack_int* ipiv_ptr = &ipiv[ i*stride_ipiv ];
+        #endif
+
+        info[ i ] = lapack::gbsv(
+            n, kl, ku, nrhs, &AB[ i*strideAB ], ldab, ipiv_ptr,
+            &B[ i*strideB ], ldb );
+
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_ptr, ipiv_ptr + n, &ipiv[ i*stride_ipiv ] );
+        #endif
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+void gbsv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gbsv_batch( n, kl, ku, nrhs, ABarray, ldab, ipiv_array,
+                          Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+void gbsv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gbsv_batch( n, kl, ku, nrhs, ABarray, ldab, ipiv_array,
+                          Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+void gbsv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gbsv_batch( n, kl, ku, nrhs, ABarray, ldab, ipiv_array,
+                          Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the solutions to a batch of systems of linear equations
+/// \[
+///     A_i X_i = B_i,
+/// \]
+/// where each A_i is an n_i-by-n_i band matrix with kl_i subdiagonals and
+/// ku_i superdiagonals, as in `lapack::gbsv`.
+/// Each A_i is factored as $A_i = P_i L_i U_i$ using partial pivoting
+/// with row interchanges.
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of n, kl, ku, nrhs, ldab, and ldb has either one element, used for
+/// all problems, or batch elements. Problems run in parallel across OpenMP
+/// threads.
+/// Bands with kl, ku <= 4 are factored and solved by native kernels
+/// specialized for each bandwidth, writing ipiv directly; wider bands call
+/// `lapack::gbsv`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n_i >= 0.
+///
+/// @param[in] kl
+///     The number of subdiagonals within the band of each A_i. kl_i >= 0.
+///
+/// @param[in] ku
+///     The number of superdiagonals within the band of each A_i. ku_i >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs_i >= 0.
+///
+/// @param[in,out] ABarray
+///     Array of batch pointers to the band matrices A_i, each stored in
+///     rows kl_i+1 to 2*kl_i+ku_i+1 of an ldab_i-by-n_i array, as in
+///     `lapack::gbsv`. On exit, the factors L_i and U_i.
+///
+/// @param[in] ldab
+///     The leading dimension of each array A_i. ldab_i >= 2*kl_i+ku_i+1.
+///
+/// @param[out] ipiv_array
+///     Array of batch pointers to the pivot vectors of length n_i.
+///
+/// @param[in,out] Barray
+///     Array of batch pointers to the right hand side matrices B_i,
+///     each stored in an ldb_i-by-nrhs_i array.
+///     On exit, if info[i] = 0, the solution matrix X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each array B_i. ldb_i >= max(1,n_i).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::gbsv`
+///     for problem i:
+///     = 0: successful exit;
+///     > 0: if info[i] = j, U_i(j,j) is exactly zero, so A_i is singular
+///          and the solution X_i could not be computed.
+///
+/// @throws Error if any argument is invalid, before any system is solved.
+///
+/// @ingroup gbsv
+void gbsv_batch(
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gbsv_batch( n, kl, ku, nrhs, ABarray, ldab, ipiv_array,
+                          Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+void gbsv_batch(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    float* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gbsv_batch( n, kl, ku, nrhs, AB, ldab, strideAB,
+                          ipiv, stride_ipiv, B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+void gbsv_batch(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    double* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gbsv_batch( n, kl, ku, nrhs, AB, ldab, strideAB,
+                          ipiv, stride_ipiv, B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv
+void gbsv_batch(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<float>* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gbsv_batch( n, kl, ku, nrhs, AB, ldab, strideAB,
+                          ipiv, stride_ipiv, B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the solutions to a batch of systems of linear equations
+/// $A_i X_i = B_i$ with n-by-n band matrices A_i, with kl subdiagonals and
+/// ku superdiagonals, as in `lapack::gbsv`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = AB + i*strideAB, ipiv_i = ipiv + i*stride_ipiv, and
+/// B_i = B + i*strideB. Problems run in parallel across OpenMP threads.
+/// Bands with kl, ku <= 4 are factored and solved by native kernels
+/// specialized for each bandwidth, writing ipiv directly; wider bands call
+/// `lapack::gbsv`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] kl
+///     The number of subdiagonals within the band of each A_i. kl >= 0.
+///
+/// @param[in] ku
+///     The number of superdiagonals within the band of each A_i. ku >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in,out] AB
+///     The band matrices A_i, each stored in rows kl+1 to 2*kl+ku+1 of an
+///     ldab-by-n array, as in `lapack::gbsv`.
+///     On exit, the factors L_i and U_i.
+///
+/// @param[in] ldab
+///     The leading dimension of each A_i. ldab >= 2*kl+ku+1.
+///
+/// @param[in] strideAB
+///     Distance between consecutive matrices A_i. strideAB >= ldab*n.
+///
+/// @param[out] ipiv
+///     The pivot vectors, each of length n.
+///
+/// @param[in] stride_ipiv
+///     Distance between consecutive pivot vectors. stride_ipiv >= n.
+///
+/// @param[in,out] B
+///     The right hand side matrices B_i, each stored in an ldb-by-nrhs
+///     array. On exit, if info[i] = 0, the solution matrix X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between consecutive matrices B_i. strideB >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::gbsv` for problem i.
+///
+/// @throws Error if any argument is invalid, before any system is solved.
+///
+/// @ingroup gbsv
+void gbsv_batch(
+    int64_t n, int64_t kl, int64_t ku, int64_t nrhs,
+    std::complex<double>* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gbsv_batch( n, kl, ku, nrhs, AB, ldab, strideAB,
+                          ipiv, stride_ipiv, B, ldb, strideB, batch, info );
+}
+
+}  // namespace lapack
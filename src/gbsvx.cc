@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -31,6 +32,8 @@ int64_t gbsvx(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "sgbsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -53,7 +56,8 @@ int64_t gbsvx(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int* ipiv_ptr = ipiv;
@@ -66,6 +70,7 @@ int64_t gbsvx(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgbsvx(
         &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -110,6 +115,8 @@ int64_t gbsvx(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dgbsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -132,7 +139,8 @@ int64_t gbsvx(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int* ipiv_ptr = ipiv;
@@ -145,6 +153,7 @@ int64_t gbsvx(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgbsvx(
         &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
         AB, &ldab_,
@@ -189,6 +198,8 @@ int64_t gbsvx(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "cgbsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -211,7 +222,8 @@ int64_t gbsvx(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int* ipiv_ptr = ipiv;
@@ -224,6 +236,7 @@ int64_t gbsvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgbsvx(
         &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -489,6 +502,8 @@ int64_t gbsvx(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "zgbsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -511,7 +526,8 @@ int64_t gbsvx(
     lapack_int ldafb_ = (lapack_int) ldafb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int* ipiv_ptr = ipiv;
@@ -524,6 +540,7 @@ int64_t gbsvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgbsvx(
         &fact_, &trans_, &n_, &kl_, &ku_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
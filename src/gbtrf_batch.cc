@@ -0,0 +1,385 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+#include "SmallBand.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Pointer-array gbtrf_batch. Bands with kl, ku <= small_band_max use the
+// native fixed-bandwidth kernel, which writes the 64-bit pivots directly.
+// Wider bands call the lapack_int variant of gbtrf, so with 32-bit
+// lapack_int, pivots go through a per-thread buffer instead of being
+// allocated per problem.
+template <typename scalar_t>
+void gbtrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< scalar_t* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    // check arguments
+    check_batch_arg( m, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( kl, batch );
+    check_batch_arg( ku, batch );
+    check_batch_arg( ldab, batch );
+    check_batch_array( ABarray, batch );
+    check_batch_array( ipiv_array, batch );
+    int64_t max_mn = 1;
+    for (size_t i = 0; i < batch; ++i) {
+        int64_t m_i    = batch_arg( m,    i );
+        int64_t n_i    = batch_arg( n,    i );
+        int64_t kl_i   = batch_arg( kl,   i );
+        int64_t ku_i   = batch_arg( ku,   i );
+        int64_t ldab_i = batch_arg( ldab, i );
+        lapack_error_if( m_i < 0 );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( kl_i < 0 );
+        lapack_error_if( ku_i < 0 );
+        lapack_error_if( ldab_i < 2*kl_i + ku_i + 1 );
+        lapack_error_if( exceeds_lapack_int( { m_i, n_i, kl_i, ku_i, ldab_i } ) );
+        max_mn = max( max_mn, min( m_i, n_i ) );
+    }
+    info.resize( batch );
+
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots, one buffer per thread
+        lapack::vector< lapack_int > ipiv_( batch_max_threads() * max_mn );
+    #endif
+
+    auto cost = [&]( size_t i ) {
+        return Gflop< scalar_t >::gbtrf(
+            batch_arg( m, i ), batch_arg( n, i ),
+            batch_arg( kl, i ), batch_arg( ku, i ) );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        int64_t m_i    = batch_arg( m,    i );
+        int64_t n_i    = batch_arg( n,    i );
+        int64_t kl_i   = batch_arg( kl,   i );
+        int64_t ku_i   = batch_arg( ku,   i );
+        int64_t ldab_i = batch_arg( ldab, i );
+        if (is_small_band( kl_i, ku_i )) {
+            info[ i ] = gbtrf_small( m_i, n_i, kl_i, ku_i,
+                                     ABarray[ i ], ldab_i, ipiv_array[ i ] );
+            return;
+        }
+
+        #ifndef LAPACK_ILP64
+            lapack_int* ipiv_ptr = &ipiv_[ batch_thread_num() * max_mn ];
+        #else
+            lapack_int* ipiv_ptr = ipiv_array[ i ];
+        #endif
+
+        info[ i ] = lapack::gbtrf( m_i, n_i, kl_i, ku_i,
+                                   ABarray[ i ], ldab_i, ipiv_ptr );
+
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_ptr, ipiv_ptr + min( m_i, n_i ), ipiv_array[ i ] );
+        #endif
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided gbtrf_batch. Problems are the same size, so a static schedule
+// balances the load.
+template <typename scalar_t>
+void gbtrf_batch(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    scalar_t* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( kl < 0 );
+    lapack_error_if( ku < 0 );
+    lapack_error_if( ldab < 2*kl + ku + 1 );
+    lapack_error_if( batch > 1 && strideAB < ldab*n );
+    lapack_error_if( batch > 1 && stride_ipiv < min( m, n ) );
+    lapack_error_if( exceeds_lapack_int( { m, n, kl, ku, ldab } ) );
+
+    if (is_small_band( kl, ku )) {
+        #ifdef _OPENMP
+        #pragma omp parallel for schedule( static )
+        #endif
+        for (int64_t i = 0; i < int64_t( batch ); ++i) {
+            info[ i ] = gbtrf_small( m, n, kl, ku, &AB[ i*strideAB ], ldab,
+                                     &ipiv[ i*stride_ipiv ] );
+        }
+        return;
+    }
+
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots, one buffer per thread
+        int64_t max_mn = max( 1, min( m, n ) );
+        lapack::vector< lapack_int > ipiv_( batch_max_threads() * max_mn );
+    #endif
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        #ifndef LAPACK_ILP64
+            lapack_int* ipiv_ptr = &ipiv_[ batch_thread_num() * max_mn ];
+        #else
+            lapack_int* ipiv_ptr = &ipiv[ i*stride_ipiv ];
+        #endif
+
+        info[ i ] = lapack::gbtrf( m, n, kl, ku, &AB[ i*strideAB ], ldab,
+                                   ipiv_ptr );
+
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_ptr, ipiv_ptr + min( m, n ), &ipiv[ i*stride_ipiv ] );
+        #endif
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+void gbtrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< float* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gbtrf_batch( m, n, kl, ku, ABarray, ldab, ipiv_array,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+void gbtrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< double* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gbtrf_batch( m, n, kl, ku, ABarray, ldab, ipiv_array,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+void gbtrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< std::complex<float>* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gbtrf_batch( m, n, kl, ku, ABarray, ldab, ipiv_array,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes LU factorizations of a batch of general band matrices,
+/// using partial pivoting with row interchanges. Problem i computes
+/// \[
+///     A_i = P_i L_i U_i
+/// \]
+/// as in `lapack::gbtrf`, where A_i is m_i-by-n_i with kl_i subdiagonals
+/// and ku_i superdiagonals.
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of m, n, kl, ku, and ldab has either one element, used for all
+/// problems, or batch elements. Problems run in parallel across OpenMP
+/// threads.
+/// Bands with kl, ku <= 4 are factored by a native kernel specialized
+/// for each bandwidth, writing ipiv directly; wider bands call
+/// `lapack::gbtrf`. Both give the same factorization and pivots.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m_i >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n_i >= 0.
+///
+/// @param[in] kl
+///     The number of subdiagonals within the band of each A_i. kl_i >= 0.
+///
+/// @param[in] ku
+///     The number of superdiagonals within the band of each A_i. ku_i >= 0.
+///
+/// @param[in,out] ABarray
+///     Array of batch pointers to the band matrices A_i, each stored in
+///     rows kl_i+1 to 2*kl_i+ku_i+1 of an ldab_i-by-n_i array, as in
+///     `lapack::gbtrf`. On exit, U_i is stored as an upper triangular band
+///     matrix with kl_i+ku_i superdiagonals in rows 1 to kl_i+ku_i+1, and
+///     the multipliers in rows kl_i+ku_i+2 to 2*kl_i+ku_i+1.
+///
+/// @param[in] ldab
+///     The leading dimension of each array A_i. ldab_i >= 2*kl_i+ku_i+1.
+///
+/// @param[out] ipiv_array
+///     Array of batch pointers to the pivot vectors of length min(m_i,n_i).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::gbtrf`
+///     for problem i:
+///     = 0: successful exit;
+///     > 0: if info[i] = j, U_i(j,j) is exactly zero.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup gbsv_computational
+void gbtrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& kl,
+    std::vector< int64_t > const& ku,
+    std::vector< std::complex<double>* > const& ABarray, std::vector< int64_t > const& ldab,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gbtrf_batch( m, n, kl, ku, ABarray, ldab, ipiv_array,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+void gbtrf_batch(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    float* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gbtrf_batch( m, n, kl, ku, AB, ldab, strideAB,
+                           ipiv, stride_ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+void gbtrf_batch(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    double* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gbtrf_batch( m, n, kl, ku, AB, ldab, strideAB,
+                           ipiv, stride_ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gbsv_computational
+void gbtrf_batch(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<float>* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gbtrf_batch( m, n, kl, ku, AB, ldab, strideAB,
+                           ipiv, stride_ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes LU factorizations of a batch of general m-by-n band matrices
+/// with kl subdiagonals and ku superdiagonals, using partial pivoting with
+/// row interchanges, as in `lapack::gbtrf`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = AB + i*strideAB and ipiv_i = ipiv + i*stride_ipiv.
+/// Problems run in parallel across OpenMP threads.
+/// Bands with kl, ku <= 4 are factored by a native kernel specialized
+/// for each bandwidth, writing ipiv directly; wider bands call
+/// `lapack::gbtrf`. Both give the same factorization and pivots.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in] kl
+///     The number of subdiagonals within the band of each A_i. kl >= 0.
+///
+/// @param[in] ku
+///     The number of superdiagonals within the band of each A_i. ku >= 0.
+///
+/// @param[in,out] AB
+///     The band matrices A_i, each stored in rows kl+1 to 2*kl+ku+1 of an
+///     ldab-by-n array, as in `lapack::gbtrf`.
+///     On exit, the factors L_i and U_i.
+///
+/// @param[in] ldab
+///     The leading dimension of each A_i. ldab >= 2*kl+ku+1.
+///
+/// @param[in] strideAB
+///     Distance between consecutive matrices A_i. strideAB >= ldab*n.
+///
+/// @param[out] ipiv
+///     The pivot vectors, each of length min(m,n).
+///
+/// @param[in] stride_ipiv
+///     Distance between consecutive pivot vectors.
+///     stride_ipiv >= min(m,n).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::gbtrf` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup gbsv_computational
+void gbtrf_batch(
+    int64_t m, int64_t n, int64_t kl, int64_t ku,
+    std::complex<double>* AB, int64_t ldab, int64_t strideAB,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gbtrf_batch( m, n, kl, ku, AB, ldab, strideAB,
+                           ipiv, stride_ipiv, batch, info );
+}
+
+}  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t gebak(
     float const* scale, int64_t m,
     float* V, int64_t ldv )
 {
+    LAPACK_INSTRUMENT( "sgebak", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -38,6 +41,7 @@ int64_t gebak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         scale, &m_,
@@ -59,6 +63,8 @@ int64_t gebak(
     double const* scale, int64_t m,
     double* V, int64_t ldv )
 {
+    LAPACK_INSTRUMENT( "dgebak", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -76,6 +82,7 @@ int64_t gebak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         scale, &m_,
@@ -97,6 +104,8 @@ int64_t gebak(
     float const* scale, int64_t m,
     std::complex<float>* V, int64_t ldv )
 {
+    LAPACK_INSTRUMENT( "cgebak", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -114,6 +123,7 @@ int64_t gebak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         scale, &m_,
@@ -184,6 +194,8 @@ int64_t gebak(
     double const* scale, int64_t m,
     std::complex<double>* V, int64_t ldv )
 {
+    LAPACK_INSTRUMENT( "zgebak", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -201,6 +213,7 @@ int64_t gebak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgebak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         scale, &m_,
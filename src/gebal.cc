@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t gebal(
     int64_t* ihi,
     float* scale )
 {
+    LAPACK_INSTRUMENT( "sgebal", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ int64_t gebal(
     lapack_int ihi_ = (lapack_int) *ihi;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgebal(
         &balance_, &n_,
         A, &lda_, &ilo_, &ihi_,
@@ -60,6 +64,8 @@ int64_t gebal(
     int64_t* ihi,
     double* scale )
 {
+    LAPACK_INSTRUMENT( "dgebal", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -72,6 +78,7 @@ int64_t gebal(
     lapack_int ihi_ = (lapack_int) *ihi;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgebal(
         &balance_, &n_,
         A, &lda_, &ilo_, &ihi_,
@@ -97,6 +104,8 @@ int64_t gebal(
     int64_t* ihi,
     float* scale )
 {
+    LAPACK_INSTRUMENT( "cgebal", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -109,6 +118,7 @@ int64_t gebal(
     lapack_int ihi_ = (lapack_int) *ihi;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgebal(
         &balance_, &n_,
         (lapack_complex_float*) A, &lda_, &ilo_, &ihi_,
@@ -223,6 +233,8 @@ int64_t gebal(
     int64_t* ihi,
     double* scale )
 {
+    LAPACK_INSTRUMENT( "zgebal", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -235,6 +247,7 @@ int64_t gebal(
     lapack_int ihi_ = (lapack_int) *ihi;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgebal(
         &balance_, &n_,
         (lapack_complex_double*) A, &lda_, &ilo_, &ihi_,
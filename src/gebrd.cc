@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,48 +26,18 @@ int64_t gebrd(
     float* tauq,
     float* taup )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "sgebrd", m, n, 0 );
 
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgebrd(
-        &m_, &n_,
-        A, &lda_,
-        D,
-        E,
-        tauq,
-        taup,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gebrd_work_size( m, n, A, lda, D, E, tauq, taup,
+                     &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgebrd(
-        &m_, &n_,
-        A, &lda_,
-        D,
-        E,
-        tauq,
-        taup,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup,
+                       work.data(), lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -79,48 +50,18 @@ int64_t gebrd(
     double* tauq,
     double* taup )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "dgebrd", m, n, 0 );
 
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgebrd(
-        &m_, &n_,
-        A, &lda_,
-        D,
-        E,
-        tauq,
-        taup,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gebrd_work_size( m, n, A, lda, D, E, tauq, taup,
+                     &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgebrd(
-        &m_, &n_,
-        A, &lda_,
-        D,
-        E,
-        tauq,
-        taup,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup,
+                       work.data(), lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -133,48 +74,18 @@ int64_t gebrd(
     std::complex<float>* tauq,
     std::complex<float>* taup )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "cgebrd", m, n, 0 );
 
     // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgebrd(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        D,
-        E,
-        (lapack_complex_float*) tauq,
-        (lapack_complex_float*) taup,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    gebrd_work_size( m, n, A, lda, D, E, tauq, taup,
+                     &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
 
-    LAPACK_cgebrd(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        D,
-        E,
-        (lapack_complex_float*) tauq,
-        (lapack_complex_float*) taup,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gebrd_work( m, n, A, lda, D, E, tauq, taup,
+                       work.data(), lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -315,6 +226,8 @@ int64_t gebrd(
     std::complex<double>* tauq,
     std::complex<double>* taup )
 {
+    LAPACK_INSTRUMENT( "zgebrd", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -345,6 +258,7 @@ int64_t gebrd(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork_ );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgebrd(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -359,4 +273,250 @@ int64_t gebrd(
     return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void gebrd_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "sgebrd_work_size", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgebrd(
+        &m_, &n_,
+        A, &lda_,
+        D,
+        E,
+        tauq,
+        taup,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void gebrd_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dgebrd_work_size", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgebrd(
+        &m_, &n_,
+        A, &lda_,
+        D,
+        E,
+        tauq,
+        taup,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+void gebrd_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "cgebrd_work_size", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgebrd(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        D,
+        E,
+        (lapack_complex_float*) tauq,
+        (lapack_complex_float*) taup,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd_work(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tauq,
+    float* taup,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "sgebrd_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgebrd(
+        &m_, &n_,
+        A, &lda_,
+        D,
+        E,
+        tauq,
+        taup,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd_work(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tauq,
+    double* taup,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dgebrd_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgebrd(
+        &m_, &n_,
+        A, &lda_,
+        D,
+        E,
+        tauq,
+        taup,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd_computational
+int64_t gebrd_work(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* D,
+    float* E,
+    std::complex<float>* tauq,
+    std::complex<float>* taup,
+    std::complex<float>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "cgebrd_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgebrd(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        D,
+        E,
+        (lapack_complex_float*) tauq,
+        (lapack_complex_float*) taup,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
 }  // namespace lapack
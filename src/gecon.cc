@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t gecon(
     float const* A, int64_t lda, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "sgecon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ int64_t gecon(
     lapack::vector< float > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgecon(
         &norm_, &n_,
         A, &lda_, &anorm, rcond,
@@ -58,6 +62,8 @@ int64_t gecon(
     double const* A, int64_t lda, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "dgecon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -72,6 +78,7 @@ int64_t gecon(
     lapack::vector< double > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgecon(
         &norm_, &n_,
         A, &lda_, &anorm, rcond,
@@ -94,6 +101,8 @@ int64_t gecon(
     std::complex<float> const* A, int64_t lda, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "cgecon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -108,6 +117,7 @@ int64_t gecon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgecon(
         &norm_, &n_,
         (lapack_complex_float*) A, &lda_, &anorm, rcond,
@@ -168,6 +178,8 @@ int64_t gecon(
     std::complex<double> const* A, int64_t lda, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "zgecon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -182,6 +194,7 @@ int64_t gecon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgecon(
         &norm_, &n_,
         (lapack_complex_double*) A, &lda_, &anorm, rcond,
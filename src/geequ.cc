@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t geequ(
     float* colcnd,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "sgeequ", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ int64_t geequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgeequ(
         &m_, &n_,
         A, &lda_,
@@ -58,6 +62,8 @@ int64_t geequ(
     double* colcnd,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "dgeequ", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -69,6 +75,7 @@ int64_t geequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgeequ(
         &m_, &n_,
         A, &lda_,
@@ -91,6 +98,8 @@ int64_t geequ(
     float* colcnd,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "cgeequ", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -102,6 +111,7 @@ int64_t geequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgeequ(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -181,6 +191,8 @@ int64_t geequ(
     double* colcnd,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "zgeequ", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -192,6 +204,7 @@ int64_t geequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgeequ(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
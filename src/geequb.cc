@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t geequb(
     float* colcnd,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "sgeequb", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ int64_t geequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgeequb(
         &m_, &n_,
         A, &lda_,
@@ -58,6 +62,8 @@ int64_t geequb(
     double* colcnd,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "dgeequb", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -69,6 +75,7 @@ int64_t geequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgeequb(
         &m_, &n_,
         A, &lda_,
@@ -91,6 +98,8 @@ int64_t geequb(
     float* colcnd,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "cgeequb", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -102,6 +111,7 @@ int64_t geequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgeequb(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -188,6 +198,8 @@ int64_t geequb(
     double* colcnd,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "zgeequb", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -199,6 +211,7 @@ int64_t geequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgeequb(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "WorkSizeCache.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +25,113 @@ int64_t gees(
     std::complex<float>* W,
     float* VS, int64_t ldvs )
 {
+    LAPACK_INSTRUMENT( "sgees", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gees_work_size( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                    &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( max( 1, n ) );
+
+    return gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                      work.data(), lwork,
+                      rwork.data(), lrwork,
+                      bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs )
+{
+    LAPACK_INSTRUMENT( "dgees", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gees_work_size( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                    &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( max( 1, n ) );
+
+    return gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                      work.data(), lwork,
+                      rwork.data(), lrwork,
+                      bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs )
+{
+    LAPACK_INSTRUMENT( "cgees", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gees_work_size( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                    &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( max( 1, n ) );
+
+    return gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                      work.data(), lwork,
+                      rwork.data(), lrwork,
+                      bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gees(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs )
+{
+    LAPACK_INSTRUMENT( "zgees", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gees_work_size( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                    &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( max( 1, n ) );
+
+    return gees_work( jobvs, sort, select, n, A, lda, sdim, W, VS, ldvs,
+                      work.data(), lwork,
+                      rwork.data(), lrwork,
+                      bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+void gees_work_size(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "sgees_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -33,24 +142,27 @@ int64_t gees(
     char sort_ = sort2char( sort );
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
-    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int sdim_ = 0;
     lapack_int ldvs_ = (lapack_int) ldvs;
     lapack_int info_ = 0;
 
-    // split-complex representation
-    lapack::vector< float > WR( max( 1, n ) );
-    lapack::vector< float > WI( max( 1, n ) );
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "sgees", jobvs_, sort_, n_, lda_, ldvs_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
 
     // query for workspace size
     float qry_work[1];
+    float qry_WR[1], qry_WI[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
     LAPACK_sgees(
         &jobvs_, &sort_,
         select, &n_,
         A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
+        qry_WR,
+        qry_WI,
         VS, &ldvs_,
         qry_work, &ineg_one,
         qry_bwork, &info_
@@ -61,21 +173,56 @@ int64_t gees(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 2*max( 1, n );  // split-complex WR, WI
+    internal::work_size_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+// -----------------------------------------------------------------------------
+void gees_work_size(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "dgees_work_size", 0, n, 0 );
 
-    LAPACK_sgees(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvs) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvs_ = job2char( jobvs );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int sdim_ = 0;
+    lapack_int ldvs_ = (lapack_int) ldvs;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "dgees", jobvs_, sort_, n_, lda_, ldvs_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
+
+    // query for workspace size
+    double qry_work[1];
+    double qry_WR[1], qry_WI[1];
+    lapack_int qry_bwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgees(
         &jobvs_, &sort_,
         select, &n_,
         A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
+        qry_WR,
+        qry_WI,
         VS, &ldvs_,
-        &work[0], &lwork_,
-        &bwork[0], &info_
+        qry_work, &ineg_one,
+        qry_bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -83,22 +230,93 @@ int64_t gees(
     if (info_ < 0) {
         throw Error();
     }
-    *sdim = sdim_;
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        W[i] = std::complex<float>( WR[i], WI[i] );
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 2*max( 1, n );  // split-complex WR, WI
+    internal::work_size_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+void gees_work_size(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "cgees_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvs) > std::numeric_limits<lapack_int>::max() );
     }
-    return info_;
+    char jobvs_ = job2char( jobvs );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int sdim_ = 0;
+    lapack_int ldvs_ = (lapack_int) ldvs;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "cgees", jobvs_, sort_, n_, lda_, ldvs_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int qry_bwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgees(
+        &jobvs_, &sort_,
+        (LAPACK_C_SELECT1) select, &n_,
+        (lapack_complex_float*) A, &lda_, &sdim_,
+        (lapack_complex_float*) W,
+        (lapack_complex_float*) VS, &ldvs_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, n );
+    internal::work_size_insert( key, *lwork, *lrwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gees(
-    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
-    double* A, int64_t lda,
+/// Queries the workspace sizes needed by `lapack::gees_work`.
+/// Arguments through ldvs are the same as for `lapack::gees`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @param[out] lrwork
+///     Length of the real array rwork. For real matrices,
+///     rwork holds the split real and imaginary parts
+///     of the eigenvalues.
+void gees_work_size(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
-    double* VS, int64_t ldvs )
+    std::complex<double>* VS, int64_t ldvs,
+    int64_t* lwork, int64_t* lrwork )
 {
+    LAPACK_INSTRUMENT( "zgees_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -109,26 +327,29 @@ int64_t gees(
     char sort_ = sort2char( sort );
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
-    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int sdim_ = 0;
     lapack_int ldvs_ = (lapack_int) ldvs;
     lapack_int info_ = 0;
 
-    // split-complex representation
-    lapack::vector< double > WR( max( 1, n ) );
-    lapack::vector< double > WI( max( 1, n ) );
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "zgees", jobvs_, sort_, n_, lda_, ldvs_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
 
     // query for workspace size
-    double qry_work[1];
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgees(
+    LAPACK_zgees(
         &jobvs_, &sort_,
-        select, &n_,
-        A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
-        VS, &ldvs_,
-        qry_work, &ineg_one,
+        (LAPACK_Z_SELECT1) select, &n_,
+        (lapack_complex_double*) A, &lda_, &sdim_,
+        (lapack_complex_double*) W,
+        (lapack_complex_double*) VS, &ldvs_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork,
         qry_bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
@@ -137,21 +358,55 @@ int64_t gees(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, n );
+    internal::work_size_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t gees_work(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "sgees_work", 0, n, 0 );
 
-    LAPACK_dgees(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*max( 1, n ) );
+    char jobvs_ = job2char( jobvs );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvs_ = (lapack_int) ldvs;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation, stored in rwork
+    float* WR = &rwork[ 0 ];
+    float* WI = &rwork[ max( 1, n ) ];
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgees(
         &jobvs_, &sort_,
         select, &n_,
         A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
+        WR,
+        WI,
         VS, &ldvs_,
-        &work[0], &lwork_,
-        &bwork[0], &info_
+        work, &lwork_,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -162,47 +417,55 @@ int64_t gees(
     *sdim = sdim_;
     // merge split-complex representation
     for (int64_t i = 0; i < n; ++i) {
-        W[i] = std::complex<double>( WR[i], WI[i] );
+        W[i] = std::complex<float>( WR[i], WI[i] );
     }
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t gees(
-    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
-    std::complex<float>* A, int64_t lda,
+int64_t gees_work(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, int64_t n,
+    double* A, int64_t lda,
     int64_t* sdim,
-    std::complex<float>* W,
-    std::complex<float>* VS, int64_t ldvs )
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* bwork )
 {
+    LAPACK_INSTRUMENT( "dgees_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldvs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
+    lapack_error_if( lrwork < 2*max( 1, n ) );
     char jobvs_ = job2char( jobvs );
     char sort_ = sort2char( sort );
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int sdim_ = (lapack_int) *sdim;
     lapack_int ldvs_ = (lapack_int) ldvs;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgees(
+    // split-complex representation, stored in rwork
+    double* WR = &rwork[ 0 ];
+    double* WI = &rwork[ max( 1, n ) ];
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgees(
         &jobvs_, &sort_,
-        (LAPACK_C_SELECT1) select, &n_,
-        (lapack_complex_float*) A, &lda_, &sdim_,
-        (lapack_complex_float*) W,
-        (lapack_complex_float*) VS, &ldvs_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_bwork, &info_
+        select, &n_,
+        A, &lda_, &sdim_,
+        WR,
+        WI,
+        VS, &ldvs_,
+        work, &lwork_,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -210,22 +473,54 @@ int64_t gees(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *sdim = sdim_;
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        W[i] = std::complex<double>( WR[i], WI[i] );
+    }
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
-    lapack::vector< lapack_int > bwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t gees_work(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "cgees_work", 0, n, 0 );
 
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < max( 1, n ) );
+    char jobvs_ = job2char( jobvs );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvs_ = (lapack_int) ldvs;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgees(
         &jobvs_, &sort_,
         (LAPACK_C_SELECT1) select, &n_,
         (lapack_complex_float*) A, &lda_, &sdim_,
         (lapack_complex_float*) W,
         (lapack_complex_float*) VS, &ldvs_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -238,64 +533,75 @@ int64_t gees(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gees(
+/// Variant of `lapack::gees` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::gees_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ldvs and the return value are the same as for
+/// `lapack::gees`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::gees_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
+///
+/// @param rwork
+///     The real vector rwork of length lrwork.
+///     For real matrices, rwork holds
+///     the split real and imaginary parts of the eigenvalues.
+///
+/// @param[in] lrwork
+///     The length of rwork. For real matrices, lrwork >= 2*max(1, n);
+///     for complex matrices, lrwork >= max(1, n).
+///
+/// @param bwork
+///     The integer vector bwork of length n.
+///     Not referenced if sort = NotSorted.
+int64_t gees_work(
     lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
-    std::complex<double>* VS, int64_t ldvs )
+    std::complex<double>* VS, int64_t ldvs,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* bwork )
 {
+    LAPACK_INSTRUMENT( "zgees_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldvs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
+    lapack_error_if( lrwork < max( 1, n ) );
     char jobvs_ = job2char( jobvs );
     char sort_ = sort2char( sort );
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int sdim_ = (lapack_int) *sdim;
     lapack_int ldvs_ = (lapack_int) ldvs;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgees(
-        &jobvs_, &sort_,
-        (LAPACK_Z_SELECT1) select, &n_,
-        (lapack_complex_double*) A, &lda_, &sdim_,
-        (lapack_complex_double*) W,
-        (lapack_complex_double*) VS, &ldvs_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_bwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
-    lapack::vector< lapack_int > bwork( (n) );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgees(
         &jobvs_, &sort_,
         (LAPACK_Z_SELECT1) select, &n_,
         (lapack_complex_double*) A, &lda_, &sdim_,
         (lapack_complex_double*) W,
         (lapack_complex_double*) VS, &ldvs_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
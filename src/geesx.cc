@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,129 @@ int64_t geesx(
     float* rconde,
     float* rcondv )
 {
+    LAPACK_INSTRUMENT( "sgeesx", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    geesx_work_size( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                     rconde, rcondv,
+                     &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                       rconde, rcondv,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv )
+{
+    LAPACK_INSTRUMENT( "dgeesx", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    geesx_work_size( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                     rconde, rcondv,
+                     &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                       rconde, rcondv,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv )
+{
+    LAPACK_INSTRUMENT( "cgeesx", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    geesx_work_size( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                     rconde, rcondv,
+                     &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                       rconde, rcondv,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv )
+{
+    LAPACK_INSTRUMENT( "zgeesx", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    geesx_work_size( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                     rconde, rcondv,
+                     &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return geesx_work( jobvs, sort, select, sense, n, A, lda, sdim, W, VS, ldvs,
+                       rconde, rcondv,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+void geesx_work_size(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "sgeesx_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -66,49 +190,24 @@ int64_t geesx(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
-
-    LAPACK_sgeesx(
-        &jobvs_, &sort_,
-        select, &sense_, &n_,
-        A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
-        VS, &ldvs_, rconde, rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *sdim = sdim_;
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        W[i] = std::complex<float>( WR[i], WI[i] );
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+    *liwork = max( 1, int64_t( qry_iwork[0] ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t geesx(
+void geesx_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
     double* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
     double* VS, int64_t ldvs,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "dgeesx_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -150,49 +249,24 @@ int64_t geesx(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
-
-    LAPACK_dgeesx(
-        &jobvs_, &sort_,
-        select, &sense_, &n_,
-        A, &lda_, &sdim_,
-        &WR[0],
-        &WI[0],
-        VS, &ldvs_, rconde, rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *sdim = sdim_;
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        W[i] = std::complex<double>( WR[i], WI[i] );
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+    *liwork = max( 1, int64_t( qry_iwork[0] ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t geesx(
+void geesx_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
     std::complex<float>* A, int64_t lda,
     int64_t* sdim,
     std::complex<float>* W,
     std::complex<float>* VS, int64_t ldvs,
     float* rconde,
-    float* rcondv )
+    float* rcondv,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "cgeesx_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -229,43 +303,24 @@ int64_t geesx(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
-    lapack::vector< lapack_int > bwork( (n) );
-
-    LAPACK_cgeesx(
-        &jobvs_, &sort_,
-        (LAPACK_C_SELECT1) select, &sense_, &n_,
-        (lapack_complex_float*) A, &lda_, &sdim_,
-        (lapack_complex_float*) W,
-        (lapack_complex_float*) VS, &ldvs_, rconde, rcondv,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *sdim = sdim_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, n );
+    *liwork = 0;
 }
 
 // -----------------------------------------------------------------------------
-int64_t geesx(
+void geesx_work_size(
     lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* sdim,
     std::complex<double>* W,
     std::complex<double>* VS, int64_t ldvs,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "zgeesx_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -302,22 +357,240 @@ int64_t geesx(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, n );
+    *liwork = 0;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
-    lapack::vector< lapack_int > bwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t geesx_work(
+    lapack::Job jobvs, lapack::Sort sort, lapack_s_select2 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    float* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "sgeesx_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvs_ = job2char( jobvs );
+    char sort_ = sort2char( sort );
+    char sense_ = sense2char( sense );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvs_ = (lapack_int) ldvs;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > WR( max( 1, n ) );
+    lapack::vector< float > WI( max( 1, n ) );
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgeesx(
+        &jobvs_, &sort_,
+        select, &sense_, &n_,
+        A, &lda_, &sdim_,
+        &WR[0],
+        &WI[0],
+        VS, &ldvs_, rconde, rcondv,
+        work, &lwork_,
+        iwork, &liwork_,
+        bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *sdim = sdim_;
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        W[i] = std::complex<float>( WR[i], WI[i] );
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx_work(
+    lapack::Job jobvs, lapack::Sort sort, lapack_d_select2 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    double* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "dgeesx_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvs_ = job2char( jobvs );
+    char sort_ = sort2char( sort );
+    char sense_ = sense2char( sense );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvs_ = (lapack_int) ldvs;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > WR( max( 1, n ) );
+    lapack::vector< double > WI( max( 1, n ) );
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgeesx(
+        &jobvs_, &sort_,
+        select, &sense_, &n_,
+        A, &lda_, &sdim_,
+        &WR[0],
+        &WI[0],
+        VS, &ldvs_, rconde, rcondv,
+        work, &lwork_,
+        iwork, &liwork_,
+        bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *sdim = sdim_;
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        W[i] = std::complex<double>( WR[i], WI[i] );
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx_work(
+    lapack::Job jobvs, lapack::Sort sort, lapack_c_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<float>* W,
+    std::complex<float>* VS, int64_t ldvs,
+    float* rconde,
+    float* rcondv,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "cgeesx_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < n );
+    char jobvs_ = job2char( jobvs );
+    char sort_ = sort2char( sort );
+    char sense_ = sense2char( sense );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvs_ = (lapack_int) ldvs;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgeesx(
+        &jobvs_, &sort_,
+        (LAPACK_C_SELECT1) select, &sense_, &n_,
+        (lapack_complex_float*) A, &lda_, &sdim_,
+        (lapack_complex_float*) W,
+        (lapack_complex_float*) VS, &ldvs_, rconde, rcondv,
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *sdim = sdim_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t geesx_work(
+    lapack::Job jobvs, lapack::Sort sort, lapack_z_select1 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* sdim,
+    std::complex<double>* W,
+    std::complex<double>* VS, int64_t ldvs,
+    double* rconde,
+    double* rcondv,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "zgeesx_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < n );
+    char jobvs_ = job2char( jobvs );
+    char sort_ = sort2char( sort );
+    char sense_ = sense2char( sense );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvs_ = (lapack_int) ldvs;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgeesx(
         &jobvs_, &sort_,
         (LAPACK_Z_SELECT1) select, &sense_, &n_,
         (lapack_complex_double*) A, &lda_, &sdim_,
         (lapack_complex_double*) W,
         (lapack_complex_double*) VS, &ldvs_, rconde, rcondv,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "WorkSizeCache.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -24,66 +26,19 @@ int64_t geev(
     float* VL, int64_t ldvl,
     float* VR, int64_t ldvr )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobvl_ = job2char( jobvl );
-    char jobvr_ = job2char( jobvr );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldvl_ = (lapack_int) ldvl;
-    lapack_int ldvr_ = (lapack_int) ldvr;
-    lapack_int info_ = 0;
-
-    // split-complex representation
-    lapack::vector< float > WR( max( 1, n ) );
-    lapack::vector< float > WI( max( 1, n ) );
+    LAPACK_INSTRUMENT( "sgeev", 0, n, 0 );
 
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeev(
-        &jobvl_, &jobvr_, &n_,
-        A, &lda_,
-        &WR[0], &WI[0],
-        VL, &ldvl_,
-        VR, &ldvr_,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    geev_work_size( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                    &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_sgeev(
-        &jobvl_, &jobvr_, &n_,
-        A, &lda_,
-        &WR[0], &WI[0],
-        VL, &ldvl_,
-        VR, &ldvr_,
-        &work[0], &lwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        W[i] = std::complex<float>( WR[i], WI[i] );
-    }
-    return info_;
+    return geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                      work.data(), lwork, rwork.data(), lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -95,66 +50,19 @@ int64_t geev(
     double* VL, int64_t ldvl,
     double* VR, int64_t ldvr )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobvl_ = job2char( jobvl );
-    char jobvr_ = job2char( jobvr );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldvl_ = (lapack_int) ldvl;
-    lapack_int ldvr_ = (lapack_int) ldvr;
-    lapack_int info_ = 0;
-
-    // split-complex representation
-    lapack::vector< double > WR( max( 1, n ) );
-    lapack::vector< double > WI( max( 1, n ) );
+    LAPACK_INSTRUMENT( "dgeev", 0, n, 0 );
 
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeev(
-        &jobvl_, &jobvr_, &n_,
-        A, &lda_,
-        &WR[0], &WI[0],
-        VL, &ldvl_,
-        VR, &ldvr_,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    geev_work_size( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                    &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
 
-    LAPACK_dgeev(
-        &jobvl_, &jobvr_, &n_,
-        A, &lda_,
-        &WR[0], &WI[0],
-        VL, &ldvl_,
-        VR, &ldvr_,
-        &work[0], &lwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        W[i] = std::complex<double>( WR[i], WI[i] );
-    }
-    return info_;
+    return geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                      work.data(), lwork, rwork.data(), lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -166,62 +74,19 @@ int64_t geev(
     std::complex<float>* VL, int64_t ldvl,
     std::complex<float>* VR, int64_t ldvr )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobvl_ = job2char( jobvl );
-    char jobvr_ = job2char( jobvr );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldvl_ = (lapack_int) ldvl;
-    lapack_int ldvr_ = (lapack_int) ldvr;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "cgeev", 0, n, 0 );
 
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeev(
-        &jobvl_, &jobvr_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) W,
-        (lapack_complex_float*) VL, &ldvl_,
-        (lapack_complex_float*) VR, &ldvr_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    geev_work_size( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                    &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_cgeev(
-        &jobvl_, &jobvr_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) W,
-        (lapack_complex_float*) VL, &ldvl_,
-        (lapack_complex_float*) VR, &ldvr_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                      work.data(), lwork, rwork.data(), lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -333,6 +198,217 @@ int64_t geev(
     std::complex<double>* VL, int64_t ldvl,
     std::complex<double>* VR, int64_t ldvr )
 {
+    LAPACK_INSTRUMENT( "zgeev", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    geev_work_size( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                    &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return geev_work( jobvl, jobvr, n, A, lda, W, VL, ldvl, VR, ldvr,
+                      work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+void geev_work_size(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "sgeev_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "sgeev", jobvl_, jobvr_, n_, lda_, ldvl_, ldvr_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
+
+    // query for workspace size
+    float qry_work[1];
+    float qry_WR[1], qry_WI[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgeev(
+        &jobvl_, &jobvr_, &n_,
+        A, &lda_,
+        qry_WR, qry_WI,
+        VL, &ldvl_,
+        VR, &ldvr_,
+        qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 2*max( 1, n );  // split-complex WR, WI
+    internal::work_size_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+void geev_work_size(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "dgeev_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "dgeev", jobvl_, jobvr_, n_, lda_, ldvl_, ldvr_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
+
+    // query for workspace size
+    double qry_work[1];
+    double qry_WR[1], qry_WI[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgeev(
+        &jobvl_, &jobvr_, &n_,
+        A, &lda_,
+        qry_WR, qry_WI,
+        VL, &ldvl_,
+        VR, &ldvr_,
+        qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 2*max( 1, n );  // split-complex WR, WI
+    internal::work_size_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+void geev_work_size(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "cgeev_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "cgeev", jobvl_, jobvr_, n_, lda_, ldvl_, ldvr_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgeev(
+        &jobvl_, &jobvr_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) W,
+        (lapack_complex_float*) VL, &ldvl_,
+        (lapack_complex_float*) VR, &ldvr_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 2*n );
+    internal::work_size_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Queries the workspace sizes needed by `lapack::geev_work`.
+/// Arguments through ldvr are the same as for `lapack::geev`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @param[out] lrwork
+///     Length of the real array rwork. For real matrices, rwork holds
+///     the real and imaginary parts of the eigenvalues, 2*max(1, n);
+///     for complex matrices, max(1, 2*n).
+///
+/// @ingroup geev
+void geev_work_size(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "zgeev_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -348,6 +424,12 @@ int64_t geev(
     lapack_int ldvr_ = (lapack_int) ldvr;
     lapack_int info_ = 0;
 
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "zgeev", jobvl_, jobvr_, n_, lda_, ldvl_, ldvr_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
+
     // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1];
@@ -367,20 +449,242 @@ int64_t geev(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 2*n );
+    internal::work_size_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    float* A, int64_t lda,
+    std::complex<float>* W,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "sgeev_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*max( 1, n ) );
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation, stored in rwork
+    float* WR = &rwork[ 0 ];
+    float* WI = &rwork[ max( 1, n ) ];
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgeev(
+        &jobvl_, &jobvr_, &n_,
+        A, &lda_,
+        WR, WI,
+        VL, &ldvl_,
+        VR, &ldvr_,
+        work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        W[i] = std::complex<float>( WR[i], WI[i] );
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    double* A, int64_t lda,
+    std::complex<double>* W,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "dgeev_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*max( 1, n ) );
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation, stored in rwork
+    double* WR = &rwork[ 0 ];
+    double* WI = &rwork[ max( 1, n ) ];
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgeev(
+        &jobvl_, &jobvr_, &n_,
+        A, &lda_,
+        WR, WI,
+        VL, &ldvl_,
+        VR, &ldvr_,
+        work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        W[i] = std::complex<double>( WR[i], WI[i] );
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* W,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "cgeev_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgeev(
+        &jobvl_, &jobvr_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) W,
+        (lapack_complex_float*) VL, &ldvl_,
+        (lapack_complex_float*) VR, &ldvr_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::geev` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::geev_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ldvr and the return value are the same as for
+/// `lapack::geev`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::geev_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
+///
+/// @param rwork
+///     The real vector rwork of length lrwork.
+///     For real matrices, rwork holds
+///     the split real and imaginary parts of the eigenvalues.
+///
+/// @param[in] lrwork
+///     The length of rwork. For real matrices, lrwork >= 2*max(1, n);
+///     for complex matrices, lrwork >= 2*n.
+///
+/// @ingroup geev
+int64_t geev_work(
+    lapack::Job jobvl, lapack::Job jobvr, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* W,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "zgeev_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    char jobvl_ = job2char( jobvl );
+    char jobvr_ = job2char( jobvr );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgeev(
         &jobvl_, &jobvr_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) W,
         (lapack_complex_double*) VL, &ldvl_,
         (lapack_complex_double*) VR, &ldvr_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
 
@@ -23,6 +24,89 @@ int64_t gelq(
     float* A, int64_t lda,
     float* T, int64_t tsize )
 {
+    LAPACK_INSTRUMENT( "sgelq", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    gelq_work_size( m, n, A, lda, T, tsize,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gelq_work( m, n, A, lda, T, tsize,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize )
+{
+    LAPACK_INSTRUMENT( "dgelq", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    gelq_work_size( m, n, A, lda, T, tsize,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gelq_work( m, n, A, lda, T, tsize,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize )
+{
+    LAPACK_INSTRUMENT( "cgelq", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    gelq_work_size( m, n, A, lda, T, tsize,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return gelq_work( m, n, A, lda, T, tsize,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize )
+{
+    LAPACK_INSTRUMENT( "zgelq", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    gelq_work_size( m, n, A, lda, T, tsize,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gelq_work( m, n, A, lda, T, tsize,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gelq_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "sgelq_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -47,28 +131,18 @@ int64_t gelq(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-
-    LAPACK_sgelq(
-        &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gelq(
+void gelq_work_size(
     int64_t m, int64_t n,
     double* A, int64_t lda,
-    double* T, int64_t tsize )
+    double* T, int64_t tsize,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "dgelq_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -93,28 +167,18 @@ int64_t gelq(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-
-    LAPACK_dgelq(
-        &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gelq(
+void gelq_work_size(
     int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda,
-    std::complex<float>* T, int64_t tsize )
+    std::complex<float>* T, int64_t tsize,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "cgelq_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -139,28 +203,18 @@ int64_t gelq(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-
-    LAPACK_cgelq(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gelq(
+void gelq_work_size(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* T, int64_t tsize )
+    std::complex<double>* T, int64_t tsize,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "zgelq_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -185,16 +239,147 @@ int64_t gelq(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gelq_work(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "sgelq_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgelq(
+        &m_, &n_,
+        A, &lda_,
+        T, &tsize_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq_work(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dgelq_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgelq(
+        &m_, &n_,
+        A, &lda_,
+        T, &tsize_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq_work(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    std::complex<float>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "cgelq_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgelq(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) T, &tsize_,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t gelq_work(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    std::complex<double>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "zgelq_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgelq(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t gelq2(
     float* A, int64_t lda,
     float* tau )
 {
+    LAPACK_INSTRUMENT( "sgelq2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ int64_t gelq2(
     // allocate workspace
     lapack::vector< float > work( (m) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgelq2(
         &m_, &n_,
         A, &lda_,
@@ -54,6 +58,8 @@ int64_t gelq2(
     double* A, int64_t lda,
     double* tau )
 {
+    LAPACK_INSTRUMENT( "dgelq2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -68,6 +74,7 @@ int64_t gelq2(
     // allocate workspace
     lapack::vector< double > work( (m) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgelq2(
         &m_, &n_,
         A, &lda_,
@@ -86,6 +93,8 @@ int64_t gelq2(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    LAPACK_INSTRUMENT( "cgelq2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -100,6 +109,7 @@ int64_t gelq2(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (m) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgelq2(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -167,6 +177,8 @@ int64_t gelq2(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    LAPACK_INSTRUMENT( "zgelq2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -181,6 +193,7 @@ int64_t gelq2(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (m) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgelq2(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
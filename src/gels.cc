@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "WorkSizeCache.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +24,183 @@ int64_t gels(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "sgels", m, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    gels_work_size( trans, m, n, nrhs, A, lda, B, ldb,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "dgels", m, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    gels_work_size( trans, m, n, nrhs, A, lda, B, ldb,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "cgels", m, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    gels_work_size( trans, m, n, nrhs, A, lda, B, ldb,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves overdetermined or underdetermined complex linear systems
+/// involving an m-by-n matrix A, or its conjugate-transpose, using a QR
+/// or LQ factorization of A. It is assumed that A has full rank.
+///
+/// The following options are provided:
+///
+/// 1. If trans = NoTrans and m >= n: find the least squares solution of
+///     an overdetermined system, i.e., solve the least squares problem
+///     minimize $|| B - A X ||_2$.
+///
+/// 2. If trans = NoTrans and m < n: find the minimum norm solution of
+///     an underdetermined system $A X = B$.
+///
+/// 3. If trans = ConjTrans and m >= n: find the minimum norm solution of
+///     an underdetermined system $A^H X = B$.
+///
+/// 4. If trans = ConjTrans and m < n: find the least squares solution of
+///     an overdetermined system, i.e., solve the least squares problem
+///     minimize $|| B - A^H X ||_2$.
+///
+/// Several right hand side vectors b and solution vectors x can be
+/// handled in a single call; they are stored as the columns of the
+/// m-by-nrhs right hand side matrix B and the n-by-nrhs solution
+/// matrix X.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   the linear system involves $A$;
+///     - lapack::Op::ConjTrans: the linear system involves $A^H$.
+///     - lapack::Op::Trans:     the linear system involves $A^T$.
+///     \n
+///     For real matrices, Trans = ConjTrans.
+///     For complex matrices, Trans is illegal.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of
+///     columns of the matrices B and X. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the m-by-n matrix A.
+///     - If m >= n, A is overwritten by details of its QR
+///     factorization as returned by `lapack::geqrf`;
+///
+///     - If m < n, A is overwritten by details of its LQ
+///     factorization as returned by `lapack::gelqf`.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[in,out] B
+///     The max(m,n)-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the matrix B of right hand side vectors, stored
+///     columnwise; B is m-by-nrhs if trans = NoTrans, or n-by-nrhs
+///     if trans = ConjTrans.
+///     On successful exit, B is overwritten by the solution
+///     vectors, stored columnwise:
+///     - If trans = NoTrans and m >= n, rows 1 to n of B contain the least
+///     squares solution vectors; the residual sum of squares for the
+///     solution in each column is given by the sum of squares of the
+///     modulus of elements n+1 to m in that column;
+///
+///     - If trans = NoTrans and m < n, rows 1 to n of B contain the
+///     minimum norm solution vectors;
+///
+///     - If trans = ConjTrans and m >= n, rows 1 to m of B contain the
+///     minimum norm solution vectors;
+///
+///     - If trans = ConjTrans and m < n, rows 1 to m of B contain the
+///     least squares solution vectors; the residual sum of squares
+///     for the solution in each column is given by the sum of
+///     squares of the modulus of elements m+1 to n in that column.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,m,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the i-th diagonal element of the
+///     triangular factor of A is zero, so that A does not have
+///     full rank; the least squares solution could not be
+///     computed.
+///
+/// @ingroup gels
+int64_t gels(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "zgels", m, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    gels_work_size( trans, m, n, nrhs, A, lda, B, ldb,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gels_work( trans, m, n, nrhs, A, lda, B, ldb,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "sgels_work_size", m, n, nrhs );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -42,6 +221,12 @@ int64_t gels(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "sgels", trans_, m_, n_, nrhs_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
@@ -57,16 +242,54 @@ int64_t gels(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dgels_work_size", m, n, nrhs );
 
-    LAPACK_sgels(
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "dgels", trans_, m_, n_, nrhs_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgels(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -74,19 +297,19 @@ int64_t gels(
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 /// @ingroup gels
-int64_t gels(
+void gels_work_size(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    double* B, int64_t ldb )
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork )
 {
-    // for real, map ConjTrans to Trans
-    if (trans == Op::ConjTrans)
-        trans = Op::Trans;
+    LAPACK_INSTRUMENT( "cgels_work_size", m, n, nrhs );
 
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -104,14 +327,20 @@ int64_t gels(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "cgels", trans_, m_, n_, nrhs_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
     // query for workspace size
-    double qry_work[1];
+    std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgels(
+    LAPACK_cgels(
         &trans_, &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -119,16 +348,109 @@ int64_t gels(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Queries the workspace sizes needed by `lapack::gels_work`.
+/// Arguments through ldb are the same as for `lapack::gels`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @ingroup gels
+void gels_work_size(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "zgels_work_size", m, n, nrhs );
 
-    LAPACK_dgels(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "zgels", trans_, m_, n_, nrhs_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zgels(
+        &trans_, &m_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "sgels_work", m, n, nrhs );
+
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgels(
         &trans_, &m_, &n_, &nrhs_,
         A, &lda_,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -141,11 +463,18 @@ int64_t gels(
 
 // -----------------------------------------------------------------------------
 /// @ingroup gels
-int64_t gels(
+int64_t gels_work(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* B, int64_t ldb )
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "dgels_work", m, n, nrhs );
+
+    // for real, map ConjTrans to Trans
+    if (trans == Op::ConjTrans)
+        trans = Op::Trans;
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -153,6 +482,7 @@ int64_t gels(
         lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char trans_ = op2char( trans );
     lapack_int m_ = (lapack_int) m;
@@ -160,16 +490,15 @@ int64_t gels(
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgels(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgels(
         &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        A, &lda_,
+        B, &ldb_,
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -177,16 +506,43 @@ int64_t gels(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gels_work(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "cgels_work", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgels(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -198,102 +554,33 @@ int64_t gels(
 }
 
 // -----------------------------------------------------------------------------
-/// Solves overdetermined or underdetermined complex linear systems
-/// involving an m-by-n matrix A, or its conjugate-transpose, using a QR
-/// or LQ factorization of A. It is assumed that A has full rank.
-///
-/// The following options are provided:
-///
-/// 1. If trans = NoTrans and m >= n: find the least squares solution of
-///     an overdetermined system, i.e., solve the least squares problem
-///     minimize $|| B - A X ||_2$.
-///
-/// 2. If trans = NoTrans and m < n: find the minimum norm solution of
-///     an underdetermined system $A X = B$.
-///
-/// 3. If trans = ConjTrans and m >= n: find the minimum norm solution of
-///     an underdetermined system $A^H X = B$.
-///
-/// 4. If trans = ConjTrans and m < n: find the least squares solution of
-///     an overdetermined system, i.e., solve the least squares problem
-///     minimize $|| B - A^H X ||_2$.
-///
-/// Several right hand side vectors b and solution vectors x can be
-/// handled in a single call; they are stored as the columns of the
-/// m-by-nrhs right hand side matrix B and the n-by-nrhs solution
-/// matrix X.
+/// Variant of `lapack::gels` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::gels_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ldb and the return value are the same as for
+/// `lapack::gels`.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
 ///
-/// @param[in] trans
-///     - lapack::Op::NoTrans:   the linear system involves $A$;
-///     - lapack::Op::ConjTrans: the linear system involves $A^H$.
-///     - lapack::Op::Trans:     the linear system involves $A^T$.
-///     \n
-///     For real matrices, Trans = ConjTrans.
-///     For complex matrices, Trans is illegal.
-///
-/// @param[in] m
-///     The number of rows of the matrix A. m >= 0.
-///
-/// @param[in] n
-///     The number of columns of the matrix A. n >= 0.
-///
-/// @param[in] nrhs
-///     The number of right hand sides, i.e., the number of
-///     columns of the matrices B and X. nrhs >= 0.
+/// @param work
+///     The vector work of length lwork.
 ///
-/// @param[in,out] A
-///     The m-by-n matrix A, stored in an lda-by-n array.
-///     On entry, the m-by-n matrix A.
-///     - If m >= n, A is overwritten by details of its QR
-///     factorization as returned by `lapack::geqrf`;
-///
-///     - If m < n, A is overwritten by details of its LQ
-///     factorization as returned by `lapack::gelqf`.
-///
-/// @param[in] lda
-///     The leading dimension of the array A. lda >= max(1,m).
-///
-/// @param[in,out] B
-///     The max(m,n)-by-nrhs matrix B, stored in an ldb-by-nrhs array.
-///     On entry, the matrix B of right hand side vectors, stored
-///     columnwise; B is m-by-nrhs if trans = NoTrans, or n-by-nrhs
-///     if trans = ConjTrans.
-///     On successful exit, B is overwritten by the solution
-///     vectors, stored columnwise:
-///     - If trans = NoTrans and m >= n, rows 1 to n of B contain the least
-///     squares solution vectors; the residual sum of squares for the
-///     solution in each column is given by the sum of squares of the
-///     modulus of elements n+1 to m in that column;
-///
-///     - If trans = NoTrans and m < n, rows 1 to n of B contain the
-///     minimum norm solution vectors;
-///
-///     - If trans = ConjTrans and m >= n, rows 1 to m of B contain the
-///     minimum norm solution vectors;
-///
-///     - If trans = ConjTrans and m < n, rows 1 to m of B contain the
-///     least squares solution vectors; the residual sum of squares
-///     for the solution in each column is given by the sum of
-///     squares of the modulus of elements m+1 to n in that column.
-///
-/// @param[in] ldb
-///     The leading dimension of the array B. ldb >= max(1,m,n).
-///
-/// @return = 0: successful exit
-/// @return > 0: if return value = i, the i-th diagonal element of the
-///     triangular factor of A is zero, so that A does not have
-///     full rank; the least squares solution could not be
-///     computed.
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::gels_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
 ///
 /// @ingroup gels
-int64_t gels(
+int64_t gels_work(
     lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
-    std::complex<double>* B, int64_t ldb )
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "zgels_work", m, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -301,6 +588,7 @@ int64_t gels(
         lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char trans_ = op2char( trans );
     lapack_int m_ = (lapack_int) m;
@@ -308,33 +596,15 @@ int64_t gels(
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgels(
-        &trans_, &m_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgels(
         &trans_, &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -0,0 +1,366 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Pointer-array gels_batch. The workspace size is queried only when the
+// options or dimensions change from the previous problem, and each thread
+// reuses one workspace of the largest size for all its problems.
+template <typename scalar_t>
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< scalar_t* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    // check arguments
+    check_batch_arg( trans, batch );
+    check_batch_arg( m, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( nrhs, batch );
+    check_batch_arg( lda, batch );
+    check_batch_arg( ldb, batch );
+    check_batch_array( Aarray, batch );
+    check_batch_array( Barray, batch );
+    int64_t lwork = 1;
+    int64_t lwork_i = 1;
+    for (size_t i = 0; i < batch; ++i) {
+        lapack::Op trans_i = batch_arg( trans, i );
+        int64_t m_i    = batch_arg( m,    i );
+        int64_t n_i    = batch_arg( n,    i );
+        int64_t nrhs_i = batch_arg( nrhs, i );
+        int64_t lda_i  = batch_arg( lda,  i );
+        int64_t ldb_i  = batch_arg( ldb,  i );
+        check_batch_op< scalar_t >( trans_i );
+        lapack_error_if( m_i < 0 );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( nrhs_i < 0 );
+        lapack_error_if( lda_i < max( 1, m_i ) );
+        lapack_error_if( ldb_i < max( 1, m_i, n_i ) );
+        lapack_error_if( exceeds_lapack_int( { m_i, n_i, nrhs_i, lda_i, ldb_i } ) );
+        if (i == 0 || batch_changed( i, trans, m, n, nrhs, lda, ldb )) {
+            gels_work_size( trans_i, m_i, n_i, nrhs_i,
+                            Aarray[ i ], lda_i, Barray[ i ], ldb_i,
+                            &lwork_i );
+            lwork = max( lwork, lwork_i );
+        }
+    }
+    info.resize( batch );
+
+    // workspace, one per thread
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    auto cost = [&]( size_t i ) {
+        return Gflop< scalar_t >::gels(
+            batch_arg( m, i ), batch_arg( n, i ), batch_arg( nrhs, i ) );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        scalar_t* work_ptr = &work[ batch_thread_num() * lwork ];
+        info[ i ] = lapack::gels_work(
+            batch_arg( trans, i ),
+            batch_arg( m, i ), batch_arg( n, i ), batch_arg( nrhs, i ),
+            Aarray[ i ], batch_arg( lda, i ),
+            Barray[ i ], batch_arg( ldb, i ),
+            work_ptr, lwork );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided gels_batch. Problems are the same size, so the workspace size
+// is queried once for the whole batch.
+template <typename scalar_t>
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    check_batch_op< scalar_t >( trans );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldb < max( 1, m, n ) );
+    lapack_error_if( batch > 1 && strideA < lda*n );
+    lapack_error_if( batch > 1 && strideB < ldb*nrhs );
+    lapack_error_if( exceeds_lapack_int( { m, n, nrhs, lda, ldb } ) );
+
+    if (batch == 0)
+        return;
+
+    // query for workspace size, one workspace per thread
+    int64_t lwork;
+    gels_work_size( trans, m, n, nrhs, A, lda, B, ldb, &lwork );
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        scalar_t* work_ptr = &work[ batch_thread_num() * lwork ];
+        info[ i ] = lapack::gels_work(
+            trans, m, n, nrhs,
+            &A[ i*strideA ], lda, &B[ i*strideB ], ldb,
+            work_ptr, lwork );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a batch of overdetermined or underdetermined linear systems
+/// involving m_i-by-n_i matrices A_i, or their conjugate-transposes,
+/// using QR or LQ factorizations of A_i, as in `lapack::gels`.
+/// It is assumed that each A_i has full rank.
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of trans, m, n, nrhs, lda, and ldb has either one element, used
+/// for all problems, or batch elements. Problems run in parallel across
+/// OpenMP threads. The workspace size is queried only when the options
+/// or dimensions differ from the previous problem's, and each thread
+/// reuses one workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   the linear systems involve $A_i$;
+///     - lapack::Op::ConjTrans: the linear systems involve $A_i^H$.
+///     \n
+///     For real matrices, Trans = ConjTrans.
+///     For complex matrices, Trans is illegal.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m_i >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n_i >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs_i >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of batch pointers to the matrices A_i, each stored in an
+///     lda_i-by-n_i array. On exit, details of the QR or LQ
+///     factorization of A_i, as in `lapack::gels`.
+///
+/// @param[in] lda
+///     The leading dimension of each array A_i. lda_i >= max(1,m_i).
+///
+/// @param[in,out] Barray
+///     Array of batch pointers to the right hand side matrices B_i,
+///     each stored in an ldb_i-by-nrhs_i array.
+///     On exit, the solution vectors, as in `lapack::gels`.
+///
+/// @param[in] ldb
+///     The leading dimension of each array B_i. ldb_i >= max(1,m_i,n_i).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::gels`
+///     for problem i:
+///     = 0: successful exit;
+///     > 0: if info[i] = j, the j-th diagonal element of the triangular
+///          factor of A_i is zero, so A_i does not have full rank.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup gels
+void gels_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gels_batch( trans, m, n, nrhs, Aarray, lda, Barray, ldb,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gels_batch( trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gels_batch( trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gels_batch( trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a batch of overdetermined or underdetermined linear systems
+/// involving m-by-n matrices A_i, or their conjugate-transposes,
+/// as in `lapack::gels`.
+///
+/// This is the strided variant, for problems of the same size, such as
+/// many small least squares fits. Problem i uses A_i = A + i*strideA and
+/// B_i = B + i*strideB. Problems run in parallel across OpenMP threads.
+/// The workspace size is queried once for the whole batch, and each
+/// thread reuses one workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   the linear systems involve $A_i$;
+///     - lapack::Op::ConjTrans: the linear systems involve $A_i^H$.
+///     \n
+///     For real matrices, Trans = ConjTrans.
+///     For complex matrices, Trans is illegal.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The matrices A_i, each stored in an lda-by-n array.
+///     On exit, details of the QR or LQ factorization of A_i.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between consecutive matrices A_i. strideA >= lda*n.
+///
+/// @param[in,out] B
+///     The right hand side matrices B_i, each stored in an ldb-by-nrhs
+///     array. On exit, the solution vectors, as in `lapack::gels`.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,m,n).
+///
+/// @param[in] strideB
+///     Distance between consecutive matrices B_i. strideB >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::gels` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup gels
+void gels_batch(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gels_batch( trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                          batch, info );
+}
+
+}  // namespace lapack
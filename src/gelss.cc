@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -24,6 +25,172 @@ int64_t gelss(
     float* S, float rcond,
     int64_t* rank )
 {
+    LAPACK_INSTRUMENT( "sgelss", m, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gelss_work_size( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank )
+{
+    LAPACK_INSTRUMENT( "dgelss", m, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gelss_work_size( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank )
+{
+    LAPACK_INSTRUMENT( "cgelss", m, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gelss_work_size( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the minimum norm solution to a complex linear
+/// least squares problem:
+///     minimize $|| b - A x ||_2$
+/// using the singular value decomposition (SVD) of A. A is an m-by-n
+/// matrix which may be rank-deficient.
+///
+/// Several right hand side vectors b and solution vectors x can be
+/// handled in a single call; they are stored as the columns of the
+/// m-by-nrhs right hand side matrix B and the n-by-nrhs solution matrix
+/// X.
+///
+/// The effective rank of A is determined by treating as zero those
+/// singular values which are less than rcond times the largest singular
+/// value.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrices B and X. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the m-by-n matrix A.
+///     On exit, the first min(m,n) rows of A are overwritten with
+///     its right singular vectors, stored rowwise.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[in,out] B
+///     The max(m,n)-by-nrhs matrix B or X, stored in an ldb-by-nrhs array.
+///     On entry, the m-by-nrhs right hand side matrix B.
+///     On exit, B is overwritten by the n-by-nrhs solution matrix X.
+///     If m >= n and rank = n, the residual sum-of-squares for
+///     the solution in the i-th column is given by the sum of
+///     squares of the modulus of elements n+1:m in that column.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,m,n).
+///
+/// @param[out] S
+///     The vector S of length min(m,n).
+///     The singular values of A in decreasing order.
+///     The condition number of A in the 2-norm = S(1)/S(min(m,n)).
+///
+/// @param[in] rcond
+///     rcond is used to determine the effective rank of A.
+///     Singular values S(i) <= rcond*S(1) are treated as zero.
+///     If rcond < 0, machine precision is used instead.
+///
+/// @param[out] rank
+///     The effective rank of A, i.e., the number of singular values
+///     which are greater than rcond*S(1).
+///
+/// @return = 0: successful exit
+/// @return > 0: the algorithm for computing the SVD failed to converge;
+///     if return value = i, i off-diagonal elements of an intermediate
+///     bidiagonal form did not converge to zero.
+///
+/// @ingroup gels
+int64_t gelss(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank )
+{
+    LAPACK_INSTRUMENT( "zgelss", m, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gelss_work_size( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return gelss_work( m, n, nrhs, A, lda, B, ldb, S, rcond, rank,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelss_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "sgelss_work_size", m, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -52,33 +219,22 @@ int64_t gelss(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-
-    LAPACK_sgelss(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
 }
 
 // -----------------------------------------------------------------------------
 /// @ingroup gels
-int64_t gelss(
+void gelss_work_size(
     int64_t m, int64_t n, int64_t nrhs,
     double* A, int64_t lda,
     double* B, int64_t ldb,
     double* S, double rcond,
-    int64_t* rank )
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
 {
+    LAPACK_INSTRUMENT( "dgelss_work_size", m, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -107,33 +263,22 @@ int64_t gelss(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-
-    LAPACK_dgelss(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        S, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
 }
 
 // -----------------------------------------------------------------------------
 /// @ingroup gels
-int64_t gelss(
+void gelss_work_size(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     float* S, float rcond,
-    int64_t* rank )
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
 {
+    LAPACK_INSTRUMENT( "cgelss_work_size", m, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -164,102 +309,36 @@ int64_t gelss(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (5*min(m,n)) );
-
-    LAPACK_cgelss(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        S, &rcond, &rank_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *rank = rank_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 5*min(m,n) );
 }
 
 // -----------------------------------------------------------------------------
-/// Computes the minimum norm solution to a complex linear
-/// least squares problem:
-///     minimize $|| b - A x ||_2$
-/// using the singular value decomposition (SVD) of A. A is an m-by-n
-/// matrix which may be rank-deficient.
-///
-/// Several right hand side vectors b and solution vectors x can be
-/// handled in a single call; they are stored as the columns of the
-/// m-by-nrhs right hand side matrix B and the n-by-nrhs solution matrix
-/// X.
-///
-/// The effective rank of A is determined by treating as zero those
-/// singular values which are less than rcond times the largest singular
-/// value.
+/// Queries the workspace sizes needed by `lapack::gelss_work`.
+/// Arguments through rank are the same as for `lapack::gelss`;
+/// array arguments are passed to the LAPACK query but not referenced.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
 ///
-/// @param[in] m
-///     The number of rows of the matrix A. m >= 0.
-///
-/// @param[in] n
-///     The number of columns of the matrix A. n >= 0.
-///
-/// @param[in] nrhs
-///     The number of right hand sides, i.e., the number of columns
-///     of the matrices B and X. nrhs >= 0.
-///
-/// @param[in,out] A
-///     The m-by-n matrix A, stored in an lda-by-n array.
-///     On entry, the m-by-n matrix A.
-///     On exit, the first min(m,n) rows of A are overwritten with
-///     its right singular vectors, stored rowwise.
-///
-/// @param[in] lda
-///     The leading dimension of the array A. lda >= max(1,m).
-///
-/// @param[in,out] B
-///     The max(m,n)-by-nrhs matrix B or X, stored in an ldb-by-nrhs array.
-///     On entry, the m-by-nrhs right hand side matrix B.
-///     On exit, B is overwritten by the n-by-nrhs solution matrix X.
-///     If m >= n and rank = n, the residual sum-of-squares for
-///     the solution in the i-th column is given by the sum of
-///     squares of the modulus of elements n+1:m in that column.
-///
-/// @param[in] ldb
-///     The leading dimension of the array B. ldb >= max(1,m,n).
-///
-/// @param[out] S
-///     The vector S of length min(m,n).
-///     The singular values of A in decreasing order.
-///     The condition number of A in the 2-norm = S(1)/S(min(m,n)).
-///
-/// @param[in] rcond
-///     rcond is used to determine the effective rank of A.
-///     Singular values S(i) <= rcond*S(1) are treated as zero.
-///     If rcond < 0, machine precision is used instead.
-///
-/// @param[out] rank
-///     The effective rank of A, i.e., the number of singular values
-///     which are greater than rcond*S(1).
+/// @param[out] lwork
+///     Optimal length of the array work.
 ///
-/// @return = 0: successful exit
-/// @return > 0: the algorithm for computing the SVD failed to converge;
-///     if return value = i, i off-diagonal elements of an intermediate
-///     bidiagonal form did not converge to zero.
+/// @param[out] lrwork
+///     Length of the real array rwork.
+///     Zero for real matrices, which do not use rwork.
 ///
 /// @ingroup gels
-int64_t gelss(
+void gelss_work_size(
     int64_t m, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
     double* S, double rcond,
-    int64_t* rank )
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
 {
+    LAPACK_INSTRUMENT( "zgelss_work_size", m, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -290,19 +369,212 @@ int64_t gelss(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 5*min(m,n) );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (5*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "sgelss_work", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgelss(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        S, &rcond, &rank_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "dgelss_work", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgelss(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        S, &rcond, &rank_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelss_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* S, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "cgelss_work", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 5*min(m,n) );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgelss(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        S, &rcond, &rank_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::gelss` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::gelss_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through rank and the return value are the same as for
+/// `lapack::gelss`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::gelss_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
+///
+/// @param rwork
+///     The real vector rwork of length lrwork.
+///     Not referenced for real matrices.
+///
+/// @param[in] lrwork
+///     The length of rwork. lrwork >= max( 1, 5*min(m,n) ).
+///
+/// @ingroup gels
+int64_t gelss_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* S, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "zgelss_work", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 5*min(m,n) );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgelss(
         &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_,
         S, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -24,60 +25,19 @@ int64_t gelsy(
     int64_t* jpvt, float rcond,
     int64_t* rank )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
-    lapack_int rank_ = (lapack_int) *rank;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "sgelsy", m, n, nrhs );
 
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgelsy(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    gelsy_work_size( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                     &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_sgelsy(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
-    #endif
-    *rank = rank_;
-    return info_;
+    return gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                       work.data(), lwork, rwork.data(), lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -89,60 +49,19 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
-    lapack_int rank_ = (lapack_int) *rank;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "dgelsy", m, n, nrhs );
 
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgelsy(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    gelsy_work_size( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                     &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
 
-    LAPACK_dgelsy(
-        &m_, &n_, &nrhs_,
-        A, &lda_,
-        B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
-    #endif
-    *rank = rank_;
-    return info_;
+    return gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                       work.data(), lwork, rwork.data(), lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -154,64 +73,19 @@ int64_t gelsy(
     int64_t* jpvt, float rcond,
     int64_t* rank )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int nrhs_ = (lapack_int) nrhs;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldb_ = (lapack_int) ldb;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
-        lapack_int* jpvt_ptr = &jpvt_[0];
-    #else
-        lapack_int* jpvt_ptr = jpvt;
-    #endif
-    lapack_int rank_ = (lapack_int) *rank;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "cgelsy", m, n, nrhs );
 
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgelsy(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    gelsy_work_size( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                     &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_cgelsy(
-        &m_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
-    #endif
-    *rank = rank_;
-    return info_;
+    return gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                       work.data(), lwork, rwork.data(), lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -322,6 +196,205 @@ int64_t gelsy(
     int64_t* jpvt, double rcond,
     int64_t* rank )
 {
+    LAPACK_INSTRUMENT( "zgelsy", m, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gelsy_work_size( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return gelsy_work( m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "sgelsy_work_size", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgelsy(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "dgelsy_work_size", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgelsy(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "cgelsy_work_size", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgelsy(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 2*n );
+}
+
+// -----------------------------------------------------------------------------
+/// Queries the workspace sizes needed by `lapack::gelsy_work`.
+/// Arguments through rank are the same as for `lapack::gelsy`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @param[out] lrwork
+///     Length of the real array rwork.
+///     Zero for real matrices, which do not use rwork.
+///
+/// @ingroup gels
+void gelsy_work_size(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "zgelsy_work_size", m, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -337,7 +410,8 @@ int64_t gelsy(
     lapack_int ldb_ = (lapack_int) ldb;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
         lapack_int* jpvt_ptr = &jpvt_[0];
     #else
         lapack_int* jpvt_ptr = jpvt;
@@ -359,19 +433,253 @@ int64_t gelsy(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 2*n );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "sgelsy_work", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgelsy(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+    #endif
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "dgelsy_work", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgelsy(
+        &m_, &n_, &nrhs_,
+        A, &lda_,
+        B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+    #endif
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gels
+int64_t gelsy_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* jpvt, float rcond,
+    int64_t* rank,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "cgelsy_work", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgelsy(
+        &m_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        jpvt_ptr, &rcond, &rank_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    #ifndef LAPACK_ILP64
+        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+    #endif
+    *rank = rank_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::gelsy` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::gelsy_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through rank and the return value are the same as for
+/// `lapack::gelsy`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::gelsy_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
+///
+/// @param rwork
+///     The real vector rwork of length lrwork.
+///     Not referenced for real matrices.
+///
+/// @param[in] lrwork
+///     The length of rwork. lrwork >= max( 1, 2*n ).
+///
+/// @ingroup gels
+int64_t gelsy_work(
+    int64_t m, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* jpvt, double rcond,
+    int64_t* rank,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "zgelsy_work", m, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int rank_ = (lapack_int) *rank;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgelsy(
         &m_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) B, &ldb_,
         jpvt_ptr, &rcond, &rank_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
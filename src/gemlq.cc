@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
 
@@ -24,6 +25,93 @@ int64_t gemlq(
     float const* T, int64_t tsize,
     float* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "sgemlq", m, n, k );
+
+    // query for workspace size
+    int64_t lwork;
+    gemlq_work_size( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gemlq_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc )
+{
+    LAPACK_INSTRUMENT( "dgemlq", m, n, k );
+
+    // query for workspace size
+    int64_t lwork;
+    gemlq_work_size( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gemlq_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc )
+{
+    LAPACK_INSTRUMENT( "cgemlq", m, n, k );
+
+    // query for workspace size
+    int64_t lwork;
+    gemlq_work_size( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return gemlq_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemlq(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc )
+{
+    LAPACK_INSTRUMENT( "zgemlq", m, n, k );
+
+    // query for workspace size
+    int64_t lwork;
+    gemlq_work_size( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gemlq_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gemlq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "sgemlq_work_size", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -59,17 +147,47 @@ int64_t gemlq(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void gemlq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dgemlq_work_size", m, n, k );
 
-    LAPACK_sgemlq(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgemlq(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         T, &tsize_,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -77,16 +195,19 @@ int64_t gemlq(
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gemlq(
+void gemlq_work_size(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* T, int64_t tsize,
-    double* C, int64_t ldc )
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "cgemlq_work_size", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -107,14 +228,14 @@ int64_t gemlq(
     lapack_int info_ = 0;
 
     // query for workspace size
-    double qry_work[1];
+    std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgemlq(
+    LAPACK_cgemlq(
         &side_, &trans_, &m_, &n_, &k_,
-        A, &lda_,
-        T, &tsize_,
-        C, &ldc_,
-        qry_work, &ineg_one, &info_
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) T, &tsize_,
+        (lapack_complex_float*) C, &ldc_,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -122,17 +243,47 @@ int64_t gemlq(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+void gemlq_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "zgemlq_work_size", m, n, k );
 
-    LAPACK_dgemlq(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zgemlq(
         &side_, &trans_, &m_, &n_, &k_,
-        A, &lda_,
-        T, &tsize_,
-        C, &ldc_,
-        &work[0], &lwork_, &info_
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) T, &tsize_,
+        (lapack_complex_double*) C, &ldc_,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -140,16 +291,19 @@ int64_t gemlq(
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gemlq(
+int64_t gemlq_work(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* T, int64_t tsize,
-    std::complex<float>* C, int64_t ldc )
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "sgemlq_work", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -158,6 +312,7 @@ int64_t gemlq(
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char side_ = side2char( side );
     char trans_ = op2char( trans );
@@ -167,17 +322,16 @@ int64_t gemlq(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgemlq(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgemlq(
         &side_, &trans_, &m_, &n_, &k_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) C, &ldc_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        A, &lda_,
+        T, &tsize_,
+        C, &ldc_,
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -185,17 +339,47 @@ int64_t gemlq(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gemlq_work(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dgemlq_work", m, n, k );
 
-    LAPACK_cgemlq(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgemlq(
         &side_, &trans_, &m_, &n_, &k_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) C, &ldc_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        A, &lda_,
+        T, &tsize_,
+        C, &ldc_,
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -207,12 +391,15 @@ int64_t gemlq(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gemlq(
+int64_t gemlq_work(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* T, int64_t tsize,
-    std::complex<double>* C, int64_t ldc )
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "cgemlq_work", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -221,6 +408,7 @@ int64_t gemlq(
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char side_ = side2char( side );
     char trans_ = op2char( trans );
@@ -230,17 +418,16 @@ int64_t gemlq(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgemlq(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgemlq(
         &side_, &trans_, &m_, &n_, &k_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) C, &ldc_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) T, &tsize_,
+        (lapack_complex_float*) C, &ldc_,
+        (lapack_complex_float*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -248,17 +435,47 @@ int64_t gemlq(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gemlq_work(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "zgemlq_work", m, n, k );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgemlq(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) T, &tsize_,
         (lapack_complex_double*) C, &ldc_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
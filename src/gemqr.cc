@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
 
@@ -24,6 +25,93 @@ int64_t gemqr(
     float const* T, int64_t tsize,
     float* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "sgemqr", m, n, k );
+
+    // query for workspace size
+    int64_t lwork;
+    gemqr_work_size( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc )
+{
+    LAPACK_INSTRUMENT( "dgemqr", m, n, k );
+
+    // query for workspace size
+    int64_t lwork;
+    gemqr_work_size( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc )
+{
+    LAPACK_INSTRUMENT( "cgemqr", m, n, k );
+
+    // query for workspace size
+    int64_t lwork;
+    gemqr_work_size( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gemqr(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc )
+{
+    LAPACK_INSTRUMENT( "zgemqr", m, n, k );
+
+    // query for workspace size
+    int64_t lwork;
+    gemqr_work_size( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return gemqr_work( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+void gemqr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "sgemqr_work_size", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -43,7 +131,8 @@ int64_t gemqr(
     lapack_int ldc_ = (lapack_int) ldc;
     lapack_int info_ = 0;
 
-    // query for workspace size
+    // query for workspace size; not cached, since it depends on the
+    // block sizes that geqr stored in T
     float qry_work[1];
     lapack_int ineg_one = -1;
     LAPACK_sgemqr(
@@ -59,17 +148,53 @@ int64_t gemqr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    // Some LAPACK versions return mb*nb for side = right, but the routine
+    // uses m*nb, with nb stored in T( 3 ).
+    if (side == Side::Right)
+        *lwork = max( *lwork, m * int64_t( real( T[ 2 ] ) ) );
+}
 
-    LAPACK_sgemqr(
+// -----------------------------------------------------------------------------
+void gemqr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dgemqr_work_size", m, n, k );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int info_ = 0;
+
+    // query for workspace size; not cached, since it depends on the
+    // block sizes that geqr stored in T
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgemqr(
         &side_, &trans_, &m_, &n_, &k_,
         A, &lda_,
         T, &tsize_,
         C, &ldc_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -77,16 +202,24 @@ int64_t gemqr(
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+
+    // Some LAPACK versions return mb*nb for side = right, but the routine
+    // uses m*nb, with nb stored in T( 3 ).
+    if (side == Side::Right)
+        *lwork = max( *lwork, m * int64_t( real( T[ 2 ] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gemqr(
+void gemqr_work_size(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    double const* A, int64_t lda,
-    double const* T, int64_t tsize,
-    double* C, int64_t ldc )
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "cgemqr_work_size", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -106,15 +239,16 @@ int64_t gemqr(
     lapack_int ldc_ = (lapack_int) ldc;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
+    // query for workspace size; not cached, since it depends on the
+    // block sizes that geqr stored in T
+    std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgemqr(
+    LAPACK_cgemqr(
         &side_, &trans_, &m_, &n_, &k_,
-        A, &lda_,
-        T, &tsize_,
-        C, &ldc_,
-        qry_work, &ineg_one, &info_
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) T, &tsize_,
+        (lapack_complex_float*) C, &ldc_,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -122,17 +256,65 @@ int64_t gemqr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    // Some LAPACK versions return mb*nb for side = right, but the routine
+    // uses m*nb, with nb stored in T( 3 ).
+    if (side == Side::Right)
+        *lwork = max( *lwork, m * int64_t( real( T[ 2 ] ) ) );
+}
 
-    LAPACK_dgemqr(
+// -----------------------------------------------------------------------------
+/// Queries the workspace size needed by `lapack::gemqr_work`.
+/// Arguments through ldc are the same as for `lapack::gemqr`.
+/// T must hold the factorization from `lapack::geqr`, since the query
+/// depends on the block sizes stored in T.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @ingroup geqrf
+void gemqr_work_size(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "zgemqr_work_size", m, n, k );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int info_ = 0;
+
+    // query for workspace size; not cached, since it depends on the
+    // block sizes that geqr stored in T
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zgemqr(
         &side_, &trans_, &m_, &n_, &k_,
-        A, &lda_,
-        T, &tsize_,
-        C, &ldc_,
-        &work[0], &lwork_, &info_
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) T, &tsize_,
+        (lapack_complex_double*) C, &ldc_,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -140,16 +322,24 @@ int64_t gemqr(
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+
+    // Some LAPACK versions return mb*nb for side = right, but the routine
+    // uses m*nb, with nb stored in T( 3 ).
+    if (side == Side::Right)
+        *lwork = max( *lwork, m * int64_t( real( T[ 2 ] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gemqr(
+int64_t gemqr_work(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    std::complex<float> const* A, int64_t lda,
-    std::complex<float> const* T, int64_t tsize,
-    std::complex<float>* C, int64_t ldc )
+    float const* A, int64_t lda,
+    float const* T, int64_t tsize,
+    float* C, int64_t ldc,
+    float* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "sgemqr_work", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -158,6 +348,7 @@ int64_t gemqr(
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char side_ = side2char( side );
     char trans_ = op2char( trans );
@@ -167,17 +358,16 @@ int64_t gemqr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgemqr(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgemqr(
         &side_, &trans_, &m_, &n_, &k_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) C, &ldc_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        A, &lda_,
+        T, &tsize_,
+        C, &ldc_,
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -185,17 +375,47 @@ int64_t gemqr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t gemqr_work(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda,
+    double const* T, int64_t tsize,
+    double* C, int64_t ldc,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dgemqr_work", m, n, k );
 
-    LAPACK_cgemqr(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgemqr(
         &side_, &trans_, &m_, &n_, &k_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) C, &ldc_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        A, &lda_,
+        T, &tsize_,
+        C, &ldc_,
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -207,12 +427,15 @@ int64_t gemqr(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gemqr(
+int64_t gemqr_work(
     lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
-    std::complex<double> const* A, int64_t lda,
-    std::complex<double> const* T, int64_t tsize,
-    std::complex<double>* C, int64_t ldc )
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* T, int64_t tsize,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float>* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "cgemqr_work", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -221,6 +444,7 @@ int64_t gemqr(
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char side_ = side2char( side );
     char trans_ = op2char( trans );
@@ -230,17 +454,16 @@ int64_t gemqr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgemqr(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgemqr(
         &side_, &trans_, &m_, &n_, &k_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) C, &ldc_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) T, &tsize_,
+        (lapack_complex_float*) C, &ldc_,
+        (lapack_complex_float*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -248,17 +471,66 @@ int64_t gemqr(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::gemqr` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the size once from `lapack::gemqr_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ldc and the return value are the same as for
+/// `lapack::gemqr`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::gemqr_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
+///
+/// @ingroup geqrf
+int64_t gemqr_work(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* T, int64_t tsize,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "zgemqr_work", m, n, k );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char side_ = side2char( side );
+    char trans_ = op2char( trans );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int k_ = (lapack_int) k;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgemqr(
         &side_, &trans_, &m_, &n_, &k_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) T, &tsize_,
         (lapack_complex_double*) C, &ldc_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -0,0 +1,220 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+
+#if LAPACK_VERSION >= 30700  // >= 3.7.0
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Strided gemqr_batch. The T_i come from geqr_batch on problems of the
+// same size, so they share block sizes, and the workspace size is queried
+// once for the whole batch.
+template <typename scalar_t>
+void gemqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    scalar_t const* T, int64_t tsize, int64_t strideT,
+    scalar_t* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    // for real, map ConjTrans to Trans
+    if (! blas::is_complex< scalar_t >::value && trans == Op::ConjTrans)
+        trans = Op::Trans;
+
+    // check arguments
+    int64_t nq = (side == Side::Left ? m : n);
+    lapack_error_if( side != Side::Left && side != Side::Right );
+    check_batch_op< scalar_t >( trans );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 || k > nq );
+    lapack_error_if( lda < max( 1, nq ) );
+    lapack_error_if( tsize < 5 );
+    lapack_error_if( ldc < max( 1, m ) );
+    lapack_error_if( batch > 1 && strideA < lda*k );
+    lapack_error_if( batch > 1 && strideT < tsize );
+    lapack_error_if( batch > 1 && strideC < ldc*n );
+    lapack_error_if( exceeds_lapack_int( { m, n, k, lda, tsize, ldc } ) );
+
+    if (batch == 0)
+        return;
+
+    // query for workspace size, one workspace per thread
+    int64_t lwork;
+    gemqr_work_size( side, trans, m, n, k, A, lda, T, tsize, C, ldc,
+                     &lwork );
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        scalar_t* work_ptr = &work[ batch_thread_num() * lwork ];
+        info[ i ] = lapack::gemqr_work(
+            side, trans, m, n, k,
+            &A[ i*strideA ], lda, &T[ i*strideT ], tsize,
+            &C[ i*strideC ], ldc,
+            work_ptr, lwork );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void gemqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* T, int64_t tsize, int64_t strideT,
+    float* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gemqr_batch( side, trans, m, n, k, A, lda, strideA,
+                           T, tsize, strideT, C, ldc, strideC, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void gemqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* T, int64_t tsize, int64_t strideT,
+    double* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gemqr_batch( side, trans, m, n, k, A, lda, strideA,
+                           T, tsize, strideT, C, ldc, strideC, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void gemqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* T, int64_t tsize, int64_t strideT,
+    std::complex<float>* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gemqr_batch( side, trans, m, n, k, A, lda, strideA,
+                           T, tsize, strideT, C, ldc, strideC, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Multiplies a batch of general m-by-n matrices C_i by Q_i from
+/// `lapack::geqr_batch`, as in `lapack::gemqr`:
+///
+/// - side = Left,  trans = NoTrans:   $Q_i C_i$
+/// - side = Right, trans = NoTrans:   $C_i Q_i$
+/// - side = Left,  trans = ConjTrans: $Q_i^H C_i$
+/// - side = Right, trans = ConjTrans: $C_i Q_i^H$
+///
+/// This is a strided routine, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA, T_i = T + i*strideT, and
+/// C_i = C + i*strideC. Problems run in parallel across OpenMP threads.
+/// All T_i must come from one `lapack::geqr_batch` call, so they share
+/// block sizes; the workspace size is queried once for the whole batch,
+/// and each thread reuses one workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @since LAPACK 3.7.0
+///
+/// @param[in] side
+///     - lapack::Side::Left:  apply $Q_i$ or $Q_i^H$ from the Left;
+///     - lapack::Side::Right: apply $Q_i$ or $Q_i^H$ from the Right.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   No transpose, apply $Q_i$;
+///     - lapack::Op::ConjTrans: Conjugate transpose, apply $Q_i^H$.
+///     \n
+///     For real matrices, Trans = ConjTrans.
+///
+/// @param[in] m
+///     The number of rows of each matrix C_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix C_i. n >= 0.
+///
+/// @param[in] k
+///     The number of columns of the matrices factored by
+///     `lapack::geqr_batch`.
+///     - If side = Left,  m >= k >= 0;
+///     - if side = Right, n >= k >= 0.
+///
+/// @param[in] A
+///     The factored matrices A_i from `lapack::geqr_batch`,
+///     each stored in an lda-by-k array.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i.
+///     - If side = Left,  lda >= max(1,m);
+///     - if side = Right, lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between consecutive A_i. strideA >= lda*k.
+///
+/// @param[in] T
+///     The vectors T_i from `lapack::geqr_batch`.
+///
+/// @param[in] tsize
+///     The length of each T_i. tsize >= 5.
+///
+/// @param[in] strideT
+///     Distance between consecutive vectors T_i. strideT >= tsize.
+///
+/// @param[in,out] C
+///     The matrices C_i, each stored in an ldc-by-n array.
+///     On exit, C_i is overwritten by
+///     $Q_i C_i$, $Q_i^H C_i$, $C_i Q_i^H$, or $C_i Q_i$.
+///
+/// @param[in] ldc
+///     The leading dimension of each C_i. ldc >= max(1,m).
+///
+/// @param[in] strideC
+///     Distance between consecutive matrices C_i. strideC >= ldc*n.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::gemqr` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is computed.
+///
+/// @ingroup geqrf
+void gemqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* T, int64_t tsize, int64_t strideT,
+    std::complex<double>* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gemqr_batch( side, trans, m, n, k, A, lda, strideA,
+                           T, tsize, strideT, C, ldc, strideC, batch, info );
+}
+
+}  // namespace lapack
+
+#endif  // LAPACK >= 3.7
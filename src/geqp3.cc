@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,97 @@ int64_t geqp3(
     int64_t* jpvt,
     float* tau )
 {
+    LAPACK_INSTRUMENT( "sgeqp3", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    geqp3_work_size( m, n, A, lda, jpvt, tau,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return geqp3_work( m, n, A, lda, jpvt, tau,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau )
+{
+    LAPACK_INSTRUMENT( "dgeqp3", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    geqp3_work_size( m, n, A, lda, jpvt, tau,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return geqp3_work( m, n, A, lda, jpvt, tau,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau )
+{
+    LAPACK_INSTRUMENT( "cgeqp3", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    geqp3_work_size( m, n, A, lda, jpvt, tau,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return geqp3_work( m, n, A, lda, jpvt, tau,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t geqp3(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<double>* tau )
+{
+    LAPACK_INSTRUMENT( "zgeqp3", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    geqp3_work_size( m, n, A, lda, jpvt, tau,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return geqp3_work( m, n, A, lda, jpvt, tau,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "sgeqp3_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -33,7 +125,8 @@ int64_t geqp3(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
         lapack_int* jpvt_ptr = &jpvt_[0];
     #else
         lapack_int* jpvt_ptr = jpvt;
@@ -52,33 +145,112 @@ int64_t geqp3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* jpvt,
+    double* tau,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "dgeqp3_work_size", m, n, 0 );
 
-    LAPACK_sgeqp3(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgeqp3(
         &m_, &n_,
         A, &lda_,
         jpvt_ptr,
         tau,
-        &work[0], &lwork_, &info_ );
+        qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+}
+
+// -----------------------------------------------------------------------------
+void geqp3_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "cgeqp3_work_size", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
-        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
     #endif
-    return info_;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgeqp3(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        jpvt_ptr,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 2*n );
 }
 
 // -----------------------------------------------------------------------------
-int64_t geqp3(
+void geqp3_work_size(
     int64_t m, int64_t n,
-    double* A, int64_t lda,
+    std::complex<double>* A, int64_t lda,
     int64_t* jpvt,
-    double* tau )
+    std::complex<double>* tau,
+    int64_t* lwork, int64_t* lrwork )
 {
+    LAPACK_INSTRUMENT( "zgeqp3_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -90,7 +262,8 @@ int64_t geqp3(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
         lapack_int* jpvt_ptr = &jpvt_[0];
     #else
         lapack_int* jpvt_ptr = jpvt;
@@ -98,28 +271,62 @@ int64_t geqp3(
     lapack_int info_ = 0;
 
     // query for workspace size
-    double qry_work[1];
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgeqp3(
+    LAPACK_zgeqp3(
         &m_, &n_,
-        A, &lda_,
+        (lapack_complex_double*) A, &lda_,
         jpvt_ptr,
-        tau,
-        qry_work, &ineg_one, &info_ );
+        (lapack_complex_double*) tau,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 2*n );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t geqp3_work(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* jpvt,
+    float* tau,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "sgeqp3_work", m, n, 0 );
 
-    LAPACK_dgeqp3(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgeqp3(
         &m_, &n_,
         A, &lda_,
         jpvt_ptr,
         tau,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -130,57 +337,94 @@ int64_t geqp3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t geqp3(
+int64_t geqp3_work(
     int64_t m, int64_t n,
-    std::complex<float>* A, int64_t lda,
+    double* A, int64_t lda,
     int64_t* jpvt,
-    std::complex<float>* tau )
+    double* tau,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
 {
+    LAPACK_INSTRUMENT( "dgeqp3_work", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     lapack_int m_ = (lapack_int) m;
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
         lapack_int* jpvt_ptr = &jpvt_[0];
     #else
         lapack_int* jpvt_ptr = jpvt;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeqp3(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgeqp3(
         &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
+        A, &lda_,
         jpvt_ptr,
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
+        tau,
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    #ifndef LAPACK_ILP64
+        std::copy( jpvt_.begin(), jpvt_.end(), jpvt );
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
+// -----------------------------------------------------------------------------
+int64_t geqp3_work(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* jpvt,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "cgeqp3_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
+        lapack_int* jpvt_ptr = &jpvt_[0];
+    #else
+        lapack_int* jpvt_ptr = jpvt;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgeqp3(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
         jpvt_ptr,
         (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -191,57 +435,46 @@ int64_t geqp3(
 }
 
 // -----------------------------------------------------------------------------
-int64_t geqp3(
+int64_t geqp3_work(
     int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda,
     int64_t* jpvt,
-    std::complex<double>* tau )
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
 {
+    LAPACK_INSTRUMENT( "zgeqp3_work", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
+    lapack_error_if( lrwork < 2*n );
     lapack_int m_ = (lapack_int) m;
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > jpvt_( &jpvt[0], &jpvt[(n)] );
+        lapack::vector< lapack_int > jpvt_( (n) );
+        std::copy( &jpvt[0], &jpvt[(n)], jpvt_.begin() );
         lapack_int* jpvt_ptr = &jpvt_[0];
     #else
         lapack_int* jpvt_ptr = jpvt;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgeqp3(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        jpvt_ptr,
-        (lapack_complex_double*) tau,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgeqp3(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         jpvt_ptr,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_ );
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "WorkSizeCache.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
 
@@ -24,48 +26,18 @@ int64_t geqr(
     float* A, int64_t lda,
     float* T, int64_t tsize )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int tsize_ = (lapack_int) tsize;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "sgeqr", m, n, 0 );
 
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgeqr(
-        &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // tsize == -1 or -2 is query
-    if (tsize < 0) {
-        return info_;
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    geqr_work_size( m, n, A, lda, T, tsize,
+                    &lwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
 
-    LAPACK_sgeqr(
-        &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geqr_work( m, n, A, lda, T, tsize,
+                      work.data(), lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -75,48 +47,18 @@ int64_t geqr(
     double* A, int64_t lda,
     double* T, int64_t tsize )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int tsize_ = (lapack_int) tsize;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "dgeqr", m, n, 0 );
 
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgeqr(
-        &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // tsize == -1 or -2 is query
-    if (tsize < 0) {
-        return info_;
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    geqr_work_size( m, n, A, lda, T, tsize,
+                    &lwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
 
-    LAPACK_dgeqr(
-        &m_, &n_,
-        A, &lda_,
-        T, &tsize_,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geqr_work( m, n, A, lda, T, tsize,
+                      work.data(), lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -126,48 +68,18 @@ int64_t geqr(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t tsize )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int tsize_ = (lapack_int) tsize;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "cgeqr", m, n, 0 );
 
     // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgeqr(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // tsize == -1 or -2 is query
-    if (tsize < 0) {
-        return info_;
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork;
+    geqr_work_size( m, n, A, lda, T, tsize,
+                    &lwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
 
-    LAPACK_cgeqr(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) T, &tsize_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return geqr_work( m, n, A, lda, T, tsize,
+                      work.data(), lwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -266,6 +178,30 @@ int64_t geqr(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t tsize )
 {
+    LAPACK_INSTRUMENT( "zgeqr", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    geqr_work_size( m, n, A, lda, T, tsize,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return geqr_work( m, n, A, lda, T, tsize,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqr_work_size(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "sgeqr_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -279,6 +215,154 @@ int64_t geqr(
     lapack_int tsize_ = (lapack_int) tsize;
     lapack_int info_ = 0;
 
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "sgeqr", m_, n_, lda_, tsize_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size
+    float qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_sgeqr(
+        &m_, &n_,
+        A, &lda_,
+        T, &tsize_,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqr_work_size(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dgeqr_work_size", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "dgeqr", m_, n_, lda_, tsize_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgeqr(
+        &m_, &n_,
+        A, &lda_,
+        T, &tsize_,
+        qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqr_work_size(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "cgeqr_work_size", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "cgeqr", m_, n_, lda_, tsize_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgeqr(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) T, &tsize_,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Queries the workspace sizes needed by `lapack::geqr_work`.
+/// Arguments through tsize are the same as for `lapack::geqr`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @ingroup geqrf
+void geqr_work_size(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "zgeqr_work_size", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "zgeqr", m_, n_, lda_, tsize_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
     // query for workspace size
     std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
@@ -290,20 +374,170 @@ int64_t geqr(
     if (info_ < 0) {
         throw Error();
     }
-    // tsize == -1 or -2 is query
-    if (tsize < 0) {
-        return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqr_work(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* T, int64_t tsize,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "sgeqr_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgeqr(
+        &m_, &n_,
+        A, &lda_,
+        T, &tsize_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqr_work(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* T, int64_t tsize,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dgeqr_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgeqr(
+        &m_, &n_,
+        A, &lda_,
+        T, &tsize_,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+int64_t geqr_work(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* T, int64_t tsize,
+    std::complex<float>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "cgeqr_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgeqr(
+        &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) T, &tsize_,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::geqr` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::geqr_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through tsize and the return value are the same as for
+/// `lapack::geqr`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::geqr_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
+///
+/// @ingroup geqrf
+int64_t geqr_work(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* T, int64_t tsize,
+    std::complex<double>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "zgeqr_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(tsize) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int tsize_ = (lapack_int) tsize;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgeqr(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) T, &tsize_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t geqr2(
     float* A, int64_t lda,
     float* tau )
 {
+    LAPACK_INSTRUMENT( "sgeqr2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ int64_t geqr2(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgeqr2(
         &m_, &n_,
         A, &lda_,
@@ -54,6 +58,8 @@ int64_t geqr2(
     double* A, int64_t lda,
     double* tau )
 {
+    LAPACK_INSTRUMENT( "dgeqr2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -68,6 +74,7 @@ int64_t geqr2(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgeqr2(
         &m_, &n_,
         A, &lda_,
@@ -86,6 +93,8 @@ int64_t geqr2(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* tau )
 {
+    LAPACK_INSTRUMENT( "cgeqr2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -100,6 +109,7 @@ int64_t geqr2(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgeqr2(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -170,6 +180,8 @@ int64_t geqr2(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* tau )
 {
+    LAPACK_INSTRUMENT( "zgeqr2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -184,6 +196,7 @@ int64_t geqr2(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgeqr2(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -0,0 +1,178 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+
+#if LAPACK_VERSION >= 30700  // >= 3.7.0
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Strided geqr_batch. Problems are the same size, so the workspace size
+// is queried once for the whole batch.
+template <typename scalar_t>
+void geqr_batch(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    scalar_t* T, int64_t tsize, int64_t strideT,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( tsize < 5 );
+    lapack_error_if( batch > 1 && strideA < lda*n );
+    lapack_error_if( batch > 1 && strideT < tsize );
+    lapack_error_if( exceeds_lapack_int( { m, n, lda, tsize } ) );
+
+    if (batch == 0)
+        return;
+
+    // check tsize against the minimum here, since an error from LAPACK
+    // cannot be thrown out of the parallel loop
+    scalar_t qry_T[ 5 ];
+    lapack::geqr( m, n, A, lda, qry_T, -2 );
+    lapack_error_if( tsize < int64_t( real( qry_T[ 0 ] ) ) );
+
+    // query for workspace size, one workspace per thread
+    int64_t lwork;
+    geqr_work_size( m, n, A, lda, T, tsize, &lwork );
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        scalar_t* work_ptr = &work[ batch_thread_num() * lwork ];
+        info[ i ] = lapack::geqr_work(
+            m, n, &A[ i*strideA ], lda, &T[ i*strideT ], tsize,
+            work_ptr, lwork );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqr_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* T, int64_t tsize, int64_t strideT,
+    size_t batch,
+    int64_t* info )
+{
+    internal::geqr_batch( m, n, A, lda, strideA, T, tsize, strideT,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqr_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* T, int64_t tsize, int64_t strideT,
+    size_t batch,
+    int64_t* info )
+{
+    internal::geqr_batch( m, n, A, lda, strideA, T, tsize, strideT,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqr_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* T, int64_t tsize, int64_t strideT,
+    size_t batch,
+    int64_t* info )
+{
+    internal::geqr_batch( m, n, A, lda, strideA, T, tsize, strideT,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes QR factorizations of a batch of m-by-n matrices,
+/// as in `lapack::geqr`, which uses a tall-skinny QR (latsqr) when
+/// m is much larger than n.
+///
+/// This is a strided routine, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA and T_i = T + i*strideT.
+/// Problems run in parallel across OpenMP threads. The workspace size
+/// is queried once for the whole batch, and each thread reuses one
+/// workspace. Apply Q_i using `lapack::gemqr_batch`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @since LAPACK 3.7.0
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The matrices A_i, each stored in an lda-by-n array.
+///     On exit, R_i and part of the data structure representing Q_i,
+///     as in `lapack::geqr`.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between consecutive matrices A_i. strideA >= lda*n.
+///
+/// @param[out] T
+///     The vectors T_i, each of length tsize, holding the rest of the
+///     data structure representing Q_i.
+///
+/// @param[in] tsize
+///     The length of each T_i, at least the minimal size returned in
+///     T[0] by `lapack::geqr` with tsize = -2. For best performance,
+///     use the optimal size returned by `lapack::geqr` with tsize = -1.
+///
+/// @param[in] strideT
+///     Distance between consecutive vectors T_i. strideT >= tsize.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::geqr` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup geqrf
+void geqr_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* T, int64_t tsize, int64_t strideT,
+    size_t batch,
+    int64_t* info )
+{
+    internal::geqr_batch( m, n, A, lda, strideA, T, tsize, strideT,
+                          batch, info );
+}
+
+}  // namespace lapack
+
+#endif  // LAPACK >= 3.7
@@ -0,0 +1,305 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Pointer-array geqrf_batch. The workspace size is queried only when the
+// dimensions change from the previous problem, and each thread reuses one
+// workspace of the largest size for all its problems.
+template <typename scalar_t>
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< scalar_t* > const& tau_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    // check arguments
+    check_batch_arg( m, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( lda, batch );
+    check_batch_array( Aarray, batch );
+    check_batch_array( tau_array, batch );
+    int64_t lwork = 1;
+    int64_t lwork_i = 1;
+    for (size_t i = 0; i < batch; ++i) {
+        int64_t m_i   = batch_arg( m,   i );
+        int64_t n_i   = batch_arg( n,   i );
+        int64_t lda_i = batch_arg( lda, i );
+        lapack_error_if( m_i < 0 );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( lda_i < max( 1, m_i ) );
+        lapack_error_if( exceeds_lapack_int( { m_i, n_i, lda_i } ) );
+        if (i == 0 || batch_changed( i, m, n, lda )) {
+            geqrf_work_size( m_i, n_i, Aarray[ i ], lda_i, tau_array[ i ],
+                             &lwork_i );
+            lwork = max( lwork, lwork_i );
+        }
+    }
+    info.resize( batch );
+
+    // workspace, one per thread
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    auto cost = [&]( size_t i ) {
+        return Gflop< scalar_t >::geqrf( batch_arg( m, i ), batch_arg( n, i ) );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        scalar_t* work_ptr = &work[ batch_thread_num() * lwork ];
+        info[ i ] = lapack::geqrf_work(
+            batch_arg( m, i ), batch_arg( n, i ),
+            Aarray[ i ], batch_arg( lda, i ), tau_array[ i ],
+            work_ptr, lwork );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided geqrf_batch. Problems are the same size, so the workspace size
+// is queried once for the whole batch.
+template <typename scalar_t>
+void geqrf_batch(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    scalar_t* tau, int64_t stride_tau,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( batch > 1 && strideA < lda*n );
+    lapack_error_if( batch > 1 && stride_tau < min( m, n ) );
+    lapack_error_if( exceeds_lapack_int( { m, n, lda } ) );
+
+    if (batch == 0)
+        return;
+
+    // query for workspace size, one workspace per thread
+    int64_t lwork;
+    geqrf_work_size( m, n, A, lda, tau, &lwork );
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        scalar_t* work_ptr = &work[ batch_thread_num() * lwork ];
+        info[ i ] = lapack::geqrf_work(
+            m, n, &A[ i*strideA ], lda, &tau[ i*stride_tau ],
+            work_ptr, lwork );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& tau_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::geqrf_batch( m, n, Aarray, lda, tau_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& tau_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::geqrf_batch( m, n, Aarray, lda, tau_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& tau_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::geqrf_batch( m, n, Aarray, lda, tau_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes QR factorizations of a batch of general matrices,
+/// \[
+///     A_i = Q_i R_i,
+/// \]
+/// as in `lapack::geqrf`.
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of m, n, and lda has either one element, used for all problems,
+/// or batch elements. Problems run in parallel across OpenMP threads.
+/// The workspace size is queried only when the dimensions differ from the
+/// previous problem's, and each thread reuses one workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m_i >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n_i >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of batch pointers to the matrices A_i, each stored in an
+///     lda_i-by-n_i array. On exit, R_i on and above the diagonal, and
+///     the elementary reflectors defining Q_i below the diagonal,
+///     as in `lapack::geqrf`.
+///
+/// @param[in] lda
+///     The leading dimension of each array A_i. lda_i >= max(1,m_i).
+///
+/// @param[out] tau_array
+///     Array of batch pointers to the vectors tau_i of length
+///     min(m_i,n_i), the scalar factors of the elementary reflectors.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::geqrf`
+///     for problem i; = 0: successful exit.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup geqrf
+void geqrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& tau_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::geqrf_batch( m, n, Aarray, lda, tau_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* tau, int64_t stride_tau,
+    size_t batch,
+    int64_t* info )
+{
+    internal::geqrf_batch( m, n, A, lda, strideA, tau, stride_tau,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* tau, int64_t stride_tau,
+    size_t batch,
+    int64_t* info )
+{
+    internal::geqrf_batch( m, n, A, lda, strideA, tau, stride_tau,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    std::complex<float>* tau, int64_t stride_tau,
+    size_t batch,
+    int64_t* info )
+{
+    internal::geqrf_batch( m, n, A, lda, strideA, tau, stride_tau,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes QR factorizations of a batch of general m-by-n matrices,
+/// as in `lapack::geqrf`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA and tau_i = tau + i*stride_tau.
+/// Problems run in parallel across OpenMP threads. The workspace size
+/// is queried once for the whole batch, and each thread reuses one
+/// workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The matrices A_i, each stored in an lda-by-n array.
+///     On exit, R_i and the elementary reflectors defining Q_i.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between consecutive matrices A_i. strideA >= lda*n.
+///
+/// @param[out] tau
+///     The vectors tau_i, each of length min(m,n).
+///
+/// @param[in] stride_tau
+///     Distance between consecutive vectors tau_i.
+///     stride_tau >= min(m,n).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::geqrf` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup geqrf
+void geqrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    std::complex<double>* tau, int64_t stride_tau,
+    size_t batch,
+    int64_t* info )
+{
+    internal::geqrf_batch( m, n, A, lda, strideA, tau, stride_tau,
+                           batch, info );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4
 
@@ -23,6 +24,8 @@ int64_t geqrt(
     float* A, int64_t lda,
     float* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "sgeqrt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -41,6 +44,7 @@ int64_t geqrt(
     // allocate workspace
     lapack::vector< float > work( (nb*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgeqrt(
         &m_, &n_, &nb_,
         A, &lda_,
@@ -58,6 +62,8 @@ int64_t geqrt(
     double* A, int64_t lda,
     double* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "dgeqrt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -76,6 +82,7 @@ int64_t geqrt(
     // allocate workspace
     lapack::vector< double > work( (nb*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgeqrt(
         &m_, &n_, &nb_,
         A, &lda_,
@@ -93,6 +100,8 @@ int64_t geqrt(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "cgeqrt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -111,6 +120,7 @@ int64_t geqrt(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (nb*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgeqrt(
         &m_, &n_, &nb_,
         (lapack_complex_float*) A, &lda_,
@@ -128,6 +138,8 @@ int64_t geqrt(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "zgeqrt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -146,6 +158,7 @@ int64_t geqrt(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (nb*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgeqrt(
         &m_, &n_, &nb_,
         (lapack_complex_double*) A, &lda_,
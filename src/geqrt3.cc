@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4
 
@@ -22,6 +23,8 @@ int64_t geqrt3(
     float* A, int64_t lda,
     float* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "sgeqrt3", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ int64_t geqrt3(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgeqrt3(
         &m_, &n_,
         A, &lda_,
@@ -51,6 +55,8 @@ int64_t geqrt3(
     double* A, int64_t lda,
     double* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "dgeqrt3", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -64,6 +70,7 @@ int64_t geqrt3(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgeqrt3(
         &m_, &n_,
         A, &lda_,
@@ -80,6 +87,8 @@ int64_t geqrt3(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "cgeqrt3", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -93,6 +102,7 @@ int64_t geqrt3(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgeqrt3(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -109,6 +119,8 @@ int64_t geqrt3(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "zgeqrt3", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -122,6 +134,7 @@ int64_t geqrt3(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgeqrt3(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
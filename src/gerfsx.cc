@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #ifdef LAPACK_HAVE_XBLAS
 
@@ -34,6 +35,8 @@ int64_t gerfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    LAPACK_INSTRUMENT( "sgerfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -53,7 +56,8 @@ int64_t gerfsx(
     lapack_int ldaf_ = (lapack_int) ldaf;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -68,6 +72,7 @@ int64_t gerfsx(
     lapack::vector< float > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgerfsx(
         &trans_, &equed_, &n_, &nrhs_,
         A, &lda_,
@@ -110,6 +115,8 @@ int64_t gerfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    LAPACK_INSTRUMENT( "dgerfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -129,7 +136,8 @@ int64_t gerfsx(
     lapack_int ldaf_ = (lapack_int) ldaf;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -144,6 +152,7 @@ int64_t gerfsx(
     lapack::vector< double > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgerfsx(
         &trans_, &equed_, &n_, &nrhs_,
         A, &lda_,
@@ -186,6 +195,8 @@ int64_t gerfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    LAPACK_INSTRUMENT( "cgerfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -205,7 +216,8 @@ int64_t gerfsx(
     lapack_int ldaf_ = (lapack_int) ldaf;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -220,6 +232,7 @@ int64_t gerfsx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgerfsx(
         &trans_, &equed_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -534,6 +547,8 @@ int64_t gerfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    LAPACK_INSTRUMENT( "zgerfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -553,7 +568,8 @@ int64_t gerfsx(
     lapack_int ldaf_ = (lapack_int) ldaf;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -568,6 +584,7 @@ int64_t gerfsx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgerfsx(
         &trans_, &equed_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,9 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "WorkSizeCache.hh"
+#include "Dispatch.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -24,63 +27,21 @@ int64_t gesdd(
     float* U, int64_t ldu,
     float* VT, int64_t ldvt )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobz_ = job2char( jobz );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldu_ = (lapack_int) ldu;
-    lapack_int ldvt_ = (lapack_int) ldvt;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "sgesdd", m, n, 0 );
 
     // query for workspace size
-    float qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_sgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork, liwork;
+    gesdd_work_size( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                     &lwork, &lrwork, &liwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
 
-    LAPACK_sgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -92,63 +53,21 @@ int64_t gesdd(
     double* U, int64_t ldu,
     double* VT, int64_t ldvt )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobz_ = job2char( jobz );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldu_ = (lapack_int) ldu;
-    lapack_int ldvt_ = (lapack_int) ldvt;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "dgesdd", m, n, 0 );
 
     // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork, liwork;
+    gesdd_work_size( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                     &lwork, &lrwork, &liwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
 
-    LAPACK_dgesdd(
-        &jobz_, &m_, &n_,
-        A, &lda_,
-        S,
-        U, &ldu_,
-        VT, &ldvt_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -160,80 +79,21 @@ int64_t gesdd(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* VT, int64_t ldvt )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
-    }
-    char jobz_ = job2char( jobz );
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int ldu_ = (lapack_int) ldu;
-    lapack_int ldvt_ = (lapack_int) ldvt;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "cgesdd", m, n, 0 );
 
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1] = { 0 };
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_cgesdd(
-        &jobz_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_iwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    if (lrwork_ == 0) {
-        // if query doesn't work, this is from documentation
-        lapack_int mx = max( m, n );
-        lapack_int mn = min( m, n );
-        if (jobz == lapack::Job::NoVec) {
-            lrwork_ = 7*mn;  // LAPACK > 3.6 needs only 5*mn
-        }
-        else {
-            lrwork_ = max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
-        }
-        lrwork_ = max( 1, lrwork_ );
-    }
+    int64_t lwork, lrwork, liwork;
+    gesdd_work_size( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                     &lwork, &lrwork, &liwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
 
-    LAPACK_cgesdd(
-        &jobz_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        S,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) VT, &ldvt_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    return gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -351,6 +211,35 @@ int64_t gesdd(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* VT, int64_t ldvt )
 {
+    LAPACK_INSTRUMENT( "zgesdd", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    gesdd_work_size( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                     &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return gesdd_work( jobz, m, n, A, lda, S, U, ldu, VT, ldvt,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "sgesdd_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -367,12 +256,224 @@ int64_t gesdd(
     lapack_int ldvt_ = (lapack_int) ldvt;
     lapack_int info_ = 0;
 
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "sgesdd", jobz_, m_, n_, lda_, ldu_, ldvt_ );
+    if (internal::work_size_lookup( key, lwork, lrwork, liwork ))
+        return;
+
+    // query for workspace size
+    float qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dispatch( sgesdd, max( m, n ) )(
+        &jobz_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        qry_work, &ineg_one,
+        qry_iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+    *liwork = max( 1, 8*min( m, n ) );
+    internal::work_size_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "dgesdd_work_size", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "dgesdd", jobz_, m_, n_, lda_, ldu_, ldvt_ );
+    if (internal::work_size_lookup( key, lwork, lrwork, liwork ))
+        return;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dispatch( dgesdd, max( m, n ) )(
+        &jobz_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        qry_work, &ineg_one,
+        qry_iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+    *liwork = max( 1, 8*min( m, n ) );
+    internal::work_size_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "cgesdd_work_size", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "cgesdd", jobz_, m_, n_, lda_, ldu_, ldvt_ );
+    if (internal::work_size_lookup( key, lwork, lrwork, liwork ))
+        return;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    float qry_rwork[1] = { 0 };
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dispatch( cgesdd, max( m, n ) )(
+        &jobz_, &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        S,
+        (lapack_complex_float*) U, &ldu_,
+        (lapack_complex_float*) VT, &ldvt_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    // the query may not set rwork, so use at least the size from the
+    // documentation, which gesdd_work checks
+    int64_t mx = max( m, n );
+    int64_t mn = min( m, n );
+    if (jobz == lapack::Job::NoVec) {
+        *lrwork = 7*mn;  // LAPACK > 3.6 needs only 5*mn
+    }
+    else {
+        *lrwork = max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
+    }
+    *lrwork = max( 1, *lrwork, int64_t( qry_rwork[0] ) );
+    *liwork = max( 1, 8*min( m, n ) );
+    internal::work_size_insert( key, *lwork, *lrwork, *liwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Queries the workspace sizes needed by `lapack::gesdd_work`.
+/// Arguments through ldvt are the same as for `lapack::gesdd`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @param[out] lrwork
+///     Length of the real array rwork. 0 for real matrices,
+///     which do not use rwork.
+///
+/// @param[out] liwork
+///     Length of the integer array iwork. 8*min(m, n).
+///
+/// @ingroup gesvd
+void gesdd_work_size(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "zgesdd_work_size", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "zgesdd", jobz_, m_, n_, lda_, ldu_, ldvt_ );
+    if (internal::work_size_lookup( key, lwork, lrwork, liwork ))
+        return;
+
     // query for workspace size
     std::complex<double> qry_work[1];
     double qry_rwork[1] = { 0 };
     lapack_int qry_iwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_zgesdd(
+    LAPACK_dispatch( zgesdd, max( m, n ) )(
         &jobz_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         S,
@@ -388,35 +489,278 @@ int64_t gesdd(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = qry_rwork[0];
-    if (lrwork_ == 0) {
-        // if query doesn't work, this is from documentation
-        lapack_int mx = max( m, n );
-        lapack_int mn = min( m, n );
-        if (jobz == lapack::Job::NoVec) {
-            lrwork_ = 7*mn;  // LAPACK > 3.6 needs only 5*mn
-        }
-        else {
-            lrwork_ = max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
-        }
-        lrwork_ = max( 1, lrwork_ );
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    // the query may not set rwork, so use at least the size from the
+    // documentation, which gesdd_work checks
+    int64_t mx = max( m, n );
+    int64_t mn = min( m, n );
+    if (jobz == lapack::Job::NoVec) {
+        *lrwork = 7*mn;  // LAPACK > 3.6 needs only 5*mn
     }
+    else {
+        *lrwork = max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn );
+    }
+    *lrwork = max( 1, *lrwork, int64_t( qry_rwork[0] ) );
+    *liwork = max( 1, 8*min( m, n ) );
+    internal::work_size_insert( key, *lwork, *lrwork, *liwork );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
-    lapack::vector< lapack_int > iwork( (8*min(m,n)) );
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    float* A, int64_t lda,
+    float* S,
+    float* U, int64_t ldu,
+    float* VT, int64_t ldvt,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "sgesdd_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < 8*min( m, n ) );
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dispatch( sgesdd, max( m, n ) )(
+        &jobz_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        work, &lwork_,
+        iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    double* A, int64_t lda,
+    double* S,
+    double* U, int64_t ldu,
+    double* VT, int64_t ldvt,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "dgesdd_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < 8*min( m, n ) );
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dispatch( dgesdd, max( m, n ) )(
+        &jobz_, &m_, &n_,
+        A, &lda_,
+        S,
+        U, &ldu_,
+        VT, &ldvt_,
+        work, &lwork_,
+        iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    float* S,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* VT, int64_t ldvt,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "cgesdd_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < 8*min( m, n ) );
+    int64_t mx = max( m, n );
+    int64_t mn = min( m, n );
+    if (jobz == lapack::Job::NoVec) {
+        #if LAPACK_VERSION >= 30700  // >= 3.7
+            lapack_error_if( lrwork < 5*mn );
+        #else
+            lapack_error_if( lrwork < 7*mn );
+        #endif
+    }
+    else {
+        lapack_error_if( lrwork < max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn ) );
+    }
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dispatch( cgesdd, max( m, n ) )(
+        &jobz_, &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        S,
+        (lapack_complex_float*) U, &ldu_,
+        (lapack_complex_float*) VT, &ldvt_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::gesdd` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::gesdd_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ldvt and the return value are the same as for
+/// `lapack::gesdd`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::gesdd_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
+///
+/// @param rwork
+///     The real vector rwork of length lrwork.
+///     Not referenced for real matrices.
+///
+/// @param[in] lrwork
+///     The length of rwork. For complex matrices, at least the value
+///     returned by `lapack::gesdd_work_size`.
+///
+/// @param iwork
+///     The integer vector iwork of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork. liwork >= 8*min(m, n).
+///
+/// @ingroup gesvd
+int64_t gesdd_work(
+    lapack::Job jobz, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    double* S,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* VT, int64_t ldvt,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "zgesdd_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < 8*min( m, n ) );
+    int64_t mx = max( m, n );
+    int64_t mn = min( m, n );
+    if (jobz == lapack::Job::NoVec) {
+        #if LAPACK_VERSION >= 30700  // >= 3.7
+            lapack_error_if( lrwork < 5*mn );
+        #else
+            lapack_error_if( lrwork < 7*mn );
+        #endif
+    }
+    else {
+        lapack_error_if( lrwork < max( 5*mn*mn + 5*mn, 2*mx*mn + 2*mn*mn + mn ) );
+    }
+    char jobz_ = job2char( jobz );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldvt_ = (lapack_int) ldvt;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
-    LAPACK_zgesdd(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dispatch( zgesdd, max( m, n ) )(
         &jobz_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
         S,
         (lapack_complex_double*) U, &ldu_,
         (lapack_complex_double*) VT, &ldvt_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
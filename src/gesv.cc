@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +25,25 @@ int64_t gesv(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "sgesv", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_sgesv_64(
+                &n, &nrhs,
+                A, &lda,
+                ipiv,
+                B, &ldb, &info_ );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -43,6 +64,7 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgesv(
         &n_, &nrhs_,
         A, &lda_,
@@ -65,6 +87,25 @@ int64_t gesv(
     int64_t* ipiv,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dgesv", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_dgesv_64(
+                &n, &nrhs,
+                A, &lda,
+                ipiv,
+                B, &ldb, &info_ );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -85,6 +126,7 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgesv(
         &n_, &nrhs_,
         A, &lda_,
@@ -107,6 +149,25 @@ int64_t gesv(
     int64_t* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "cgesv", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_cgesv_64(
+                &n, &nrhs,
+                (lapack_complex_float*) A, &lda,
+                ipiv,
+                (lapack_complex_float*) B, &ldb, &info_ );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -127,6 +188,7 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgesv(
         &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -198,6 +260,25 @@ int64_t gesv(
     int64_t* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zgesv", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_zgesv_64(
+                &n, &nrhs,
+                (lapack_complex_double*) A, &lda,
+                ipiv,
+                (lapack_complex_double*) B, &ldb, &info_ );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -218,6 +299,7 @@ int64_t gesv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgesv(
         &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -241,6 +323,8 @@ int64_t gesv(
     double* X, int64_t ldx,
     int64_t* iter )
 {
+    LAPACK_INSTRUMENT( "dsgesv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -268,6 +352,7 @@ int64_t gesv(
     lapack::vector< double > work( (n)*(nrhs) );
     lapack::vector< float > swork( (n*(n+nrhs)) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsgesv(
         &n_, &nrhs_,
         A, &lda_,
@@ -295,6 +380,8 @@ int64_t gesv(
     std::complex<double>* X, int64_t ldx,
     int64_t* iter )
 {
+    LAPACK_INSTRUMENT( "zcgesv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -323,6 +410,7 @@ int64_t gesv(
     lapack::vector< std::complex<float> > swork( (n*(n+nrhs)) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zcgesv(
         &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -342,4 +430,162 @@ int64_t gesv(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    lapack_int* ipiv,
+    float* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "sgesv", 0, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgesv(
+        &n_, &nrhs_,
+        A, &lda_,
+        ipiv,
+        B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    lapack_int* ipiv,
+    double* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "dgesv", 0, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgesv(
+        &n_, &nrhs_,
+        A, &lda_,
+        ipiv,
+        B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "cgesv", 0, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgesv(
+        &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv,
+        (lapack_complex_float*) B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::gesv` that takes 32-bit `lapack_int` pivots,
+/// which are passed to LAPACK directly, without converting to and
+/// from `int64_t` or allocating a temporary pivot array.
+/// The pivots can be passed on to the `lapack_int` variant of
+/// `lapack::getrs`.
+/// Other arguments and the return value are the same as for
+/// `lapack::gesv`.
+///
+/// Available only when LAPACK uses 32-bit integers (LAPACK_ILP64
+/// not defined); otherwise `lapack_int` is `int64_t`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @ingroup gesv
+int64_t gesv(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "zgesv", 0, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_zgesv(
+        &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv,
+        (lapack_complex_double*) B, &ldb_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif // LAPACK_ILP64
+
 }  // namespace lapack
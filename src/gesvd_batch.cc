@@ -0,0 +1,530 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+#include "Jacobi.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Checks the arguments of one problem, before any problem is solved,
+// since LAPACK errors cannot be thrown out of the parallel loop.
+inline void gesvd_batch_check(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    int64_t lda, int64_t ldu, int64_t ldvt )
+{
+    lapack_error_if( jobu != Job::NoVec && jobu != Job::SomeVec
+                     && jobu != Job::AllVec && jobu != Job::OverwriteVec );
+    lapack_error_if( jobvt != Job::NoVec && jobvt != Job::SomeVec
+                     && jobvt != Job::AllVec && jobvt != Job::OverwriteVec );
+    lapack_error_if( jobu == Job::OverwriteVec && jobvt == Job::OverwriteVec );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldu < 1 );
+    lapack_error_if( (jobu == Job::SomeVec || jobu == Job::AllVec)
+                     && ldu < m );
+    lapack_error_if( ldvt < 1 );
+    lapack_error_if( jobvt == Job::AllVec && ldvt < n );
+    lapack_error_if( jobvt == Job::SomeVec && ldvt < min( m, n ) );
+    lapack_error_if( exceeds_lapack_int( { m, n, lda, ldu, ldvt } ) );
+}
+
+//------------------------------------------------------------------------------
+// Workspace for one problem: gesvd's, and enough for the Jacobi kernel.
+template <typename scalar_t>
+void gesvd_batch_work_size(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt,
+    int64_t* lwork, int64_t* lrwork )
+{
+    gesvd_work_size( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                     lwork, lrwork );
+    int64_t minmn = min( m, n );
+    if (minmn <= gesvd_jacobi_max_n< scalar_t >())
+        *lwork = max( *lwork, (max( m, n ) + minmn) * minmn );
+    *lwork  = max( 1, *lwork );
+    *lrwork = max( 1, *lrwork );
+}
+
+//------------------------------------------------------------------------------
+// Solves one problem of the batch: with the Jacobi kernel if min(m,n) is
+// small and the requested vectors are ones it computes, else, or if
+// Jacobi does not converge, with gesvd.
+template <typename scalar_t>
+int64_t gesvd_batch_one(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* S,
+    scalar_t* U, int64_t ldu,
+    scalar_t* VT, int64_t ldvt,
+    scalar_t* work, int64_t lwork,
+    blas::real_type< scalar_t >* rwork, int64_t lrwork )
+{
+    if (min( m, n ) <= gesvd_jacobi_max_n< scalar_t >()
+        && gesvd_jacobi_job( jobu, jobvt, m, n )
+        && gesvd_jacobi( jobu != Job::NoVec, jobvt != Job::NoVec, m, n,
+                         A, lda, S, U, ldu, VT, ldvt, work )) {
+        return 0;
+    }
+    return lapack::gesvd_work( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                               work, lwork, rwork, lrwork );
+}
+
+//------------------------------------------------------------------------------
+// Pointer-array gesvd_batch. The workspace size is queried only when the
+// options or dimensions change from the previous problem, and each
+// thread reuses one workspace of the largest size for all its problems.
+template <typename scalar_t>
+void gesvd_batch(
+    std::vector< lapack::Job > const& jobu,
+    std::vector< lapack::Job > const& jobvt,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< blas::real_type< scalar_t >* > const& S_array,
+    std::vector< scalar_t* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< scalar_t* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    check_batch_arg( jobu, batch );
+    check_batch_arg( jobvt, batch );
+    check_batch_arg( m, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( lda, batch );
+    check_batch_arg( ldu, batch );
+    check_batch_arg( ldvt, batch );
+    check_batch_array( Aarray, batch );
+    check_batch_array( S_array, batch );
+    check_batch_array( Uarray, batch );
+    check_batch_array( VTarray, batch );
+    int64_t lwork = 1, lrwork = 1;
+    int64_t lwork_i, lrwork_i;
+    for (size_t i = 0; i < batch; ++i) {
+        gesvd_batch_check( batch_arg( jobu, i ), batch_arg( jobvt, i ),
+                           batch_arg( m, i ), batch_arg( n, i ),
+                           batch_arg( lda, i ), batch_arg( ldu, i ),
+                           batch_arg( ldvt, i ) );
+        if (i == 0 || batch_changed( i, jobu, jobvt, m, n, lda, ldu, ldvt )) {
+            gesvd_batch_work_size(
+                batch_arg( jobu, i ), batch_arg( jobvt, i ),
+                batch_arg( m, i ), batch_arg( n, i ),
+                Aarray[ i ], batch_arg( lda, i ), S_array[ i ],
+                Uarray[ i ], batch_arg( ldu, i ),
+                VTarray[ i ], batch_arg( ldvt, i ),
+                &lwork_i, &lrwork_i );
+            lwork  = max( lwork,  lwork_i );
+            lrwork = max( lrwork, lrwork_i );
+        }
+    }
+    info.resize( batch );
+
+    // workspace, one per thread
+    int nthreads = batch_max_threads();
+    lapack::vector< scalar_t > work( nthreads * lwork );
+    lapack::vector< real_t > rwork( nthreads * lrwork );
+
+    auto cost = [&]( size_t i ) {
+        double m_i = batch_arg( m, i );
+        double n_i = batch_arg( n, i );
+        return m_i * n_i * min( m_i, n_i );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        int tid = batch_thread_num();
+        info[ i ] = gesvd_batch_one(
+            batch_arg( jobu, i ), batch_arg( jobvt, i ),
+            batch_arg( m, i ), batch_arg( n, i ),
+            Aarray[ i ], batch_arg( lda, i ), S_array[ i ],
+            Uarray[ i ], batch_arg( ldu, i ),
+            VTarray[ i ], batch_arg( ldvt, i ),
+            &work[ tid * lwork ], lwork,
+            &rwork[ tid * lrwork ], lrwork );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided gesvd_batch. Problems are the same size, so the workspace size
+// is queried once for the whole batch.
+template <typename scalar_t>
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    blas::real_type< scalar_t >* S, int64_t strideS,
+    scalar_t* U, int64_t ldu, int64_t strideU,
+    scalar_t* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    gesvd_batch_check( jobu, jobvt, m, n, lda, ldu, ldvt );
+    int64_t ucol = (jobu == Job::AllVec ? m : min( m, n ));
+    lapack_error_if( batch > 1 && strideA < lda*n );
+    lapack_error_if( batch > 1 && strideS < min( m, n ) );
+    lapack_error_if( batch > 1 && (jobu == Job::SomeVec || jobu == Job::AllVec)
+                     && strideU < ldu*ucol );
+    lapack_error_if( batch > 1 && (jobvt == Job::SomeVec || jobvt == Job::AllVec)
+                     && strideVT < ldvt*n );
+
+    if (batch == 0)
+        return;
+
+    // query for workspace size, one workspace per thread
+    int64_t lwork, lrwork;
+    gesvd_batch_work_size( jobu, jobvt, m, n, A, lda, S, U, ldu, VT, ldvt,
+                           &lwork, &lrwork );
+    int nthreads = batch_max_threads();
+    lapack::vector< scalar_t > work( nthreads * lwork );
+    lapack::vector< real_t > rwork( nthreads * lrwork );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        int tid = batch_thread_num();
+        info[ i ] = gesvd_batch_one(
+            jobu, jobvt, m, n, &A[ i*strideA ], lda, &S[ i*strideS ],
+            &U[ i*strideU ], ldu, &VT[ i*strideVT ], ldvt,
+            &work[ tid * lwork ], lwork,
+            &rwork[ tid * lrwork ], lrwork );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_batch(
+    std::vector< lapack::Job > const& jobu,
+    std::vector< lapack::Job > const& jobvt,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& S_array,
+    std::vector< float* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< float* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gesvd_batch( jobu, jobvt, m, n, Aarray, lda, S_array,
+                           Uarray, ldu, VTarray, ldvt, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_batch(
+    std::vector< lapack::Job > const& jobu,
+    std::vector< lapack::Job > const& jobvt,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& S_array,
+    std::vector< double* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< double* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gesvd_batch( jobu, jobvt, m, n, Aarray, lda, S_array,
+                           Uarray, ldu, VTarray, ldvt, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_batch(
+    std::vector< lapack::Job > const& jobu,
+    std::vector< lapack::Job > const& jobvt,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& S_array,
+    std::vector< std::complex<float>* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< std::complex<float>* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gesvd_batch( jobu, jobvt, m, n, Aarray, lda, S_array,
+                           Uarray, ldu, VTarray, ldvt, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the singular value decomposition (SVD) of a batch of
+/// m_i-by-n_i matrices A_i, optionally computing the left and/or right
+/// singular vectors, as in `lapack::gesvd`:
+/// $A_i = U_i \Sigma_i V_i^H$.
+///
+/// Small problems, min(m_i,n_i) <= 12 for real or 6 for complex, such as
+/// the 3-by-3 matrices of polar decompositions, use a one-sided Jacobi
+/// kernel, which avoids gesvd's bidiagonal reduction and per-call
+/// overhead, with fixed-size kernels for 2-by-2 and 3-by-3. It computes
+/// min(m_i,n_i) singular vectors, so it handles jobu and jobvt = NoVec
+/// and SomeVec, and AllVec where that is all the vectors. Other problems,
+/// or any that Jacobi does not converge on, call `lapack::gesvd`.
+/// Singular values are in descending order in both cases, but singular
+/// vectors may differ by a unit scalar factor.
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of jobu, jobvt, m, n, lda, ldu, and ldvt has either one element,
+/// used for all problems, or batch elements. Problems run in parallel
+/// across OpenMP threads. The workspace size is queried only when the
+/// options or dimensions differ from the previous problem's, and each
+/// thread reuses one workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] jobu
+///     Specifies options for computing each U_i, as in `lapack::gesvd`:
+///     - lapack::Job::AllVec:       all m_i columns of U_i in U_i;
+///     - lapack::Job::SomeVec:      the first min(m_i,n_i) columns of U_i
+///                                  in U_i;
+///     - lapack::Job::OverwriteVec: the first min(m_i,n_i) columns of U_i
+///                                  overwrite A_i;
+///     - lapack::Job::NoVec:        no columns of U_i.
+///
+/// @param[in] jobvt
+///     Specifies options for computing each V_i^H, as in `lapack::gesvd`:
+///     - lapack::Job::AllVec:       all n_i rows of V_i^H in VT_i;
+///     - lapack::Job::SomeVec:      the first min(m_i,n_i) rows of V_i^H
+///                                  in VT_i;
+///     - lapack::Job::OverwriteVec: the first min(m_i,n_i) rows of V_i^H
+///                                  overwrite A_i;
+///     - lapack::Job::NoVec:        no rows of V_i^H.
+///     \n
+///     jobvt and jobu cannot both be OverwriteVec.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m_i >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n_i >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of batch pointers to the matrices A_i, each stored in an
+///     lda_i-by-n_i array. On exit, as in `lapack::gesvd`; A_i is
+///     overwritten with vectors if jobu or jobvt = OverwriteVec, else it
+///     may be destroyed.
+///
+/// @param[in] lda
+///     The leading dimension of each array A_i. lda_i >= max(1,m_i).
+///
+/// @param[out] S_array
+///     Array of batch pointers to the vectors S_i of length min(m_i,n_i).
+///     If info[i] = 0, the singular values of A_i, sorted so that
+///     S_i(j) >= S_i(j+1).
+///
+/// @param[out] Uarray
+///     Array of batch pointers to the matrices U_i, each stored in an
+///     ldu_i-by-ucol_i array, with ucol_i = m_i if jobu = AllVec, or
+///     min(m_i,n_i) if jobu = SomeVec. Not referenced if jobu = NoVec or
+///     OverwriteVec.
+///
+/// @param[in] ldu
+///     The leading dimension of each array U_i. ldu_i >= 1; if
+///     jobu = SomeVec or AllVec, ldu_i >= m_i.
+///
+/// @param[out] VTarray
+///     Array of batch pointers to the matrices VT_i, each stored in an
+///     ldvt_i-by-n_i array, containing n_i rows of V_i^H if
+///     jobvt = AllVec, or min(m_i,n_i) rows if jobvt = SomeVec.
+///     Not referenced if jobvt = NoVec or OverwriteVec.
+///
+/// @param[in] ldvt
+///     The leading dimension of each array VT_i. ldvt_i >= 1;
+///     if jobvt = AllVec, ldvt_i >= n_i;
+///     if jobvt = SomeVec, ldvt_i >= min(m_i,n_i).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::gesvd`
+///     for problem i; = 0: successful exit.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup gesvd
+void gesvd_batch(
+    std::vector< lapack::Job > const& jobu,
+    std::vector< lapack::Job > const& jobvt,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& S_array,
+    std::vector< std::complex<double>* > const& Uarray, std::vector< int64_t > const& ldu,
+    std::vector< std::complex<double>* > const& VTarray, std::vector< int64_t > const& ldvt,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::gesvd_batch( jobu, jobvt, m, n, Aarray, lda, S_array,
+                           Uarray, ldu, VTarray, ldvt, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    float* U, int64_t ldu, int64_t strideU,
+    float* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gesvd_batch( jobu, jobvt, m, n, A, lda, strideA, S, strideS,
+                           U, ldu, strideU, VT, ldvt, strideVT,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    double* U, int64_t ldu, int64_t strideU,
+    double* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gesvd_batch( jobu, jobvt, m, n, A, lda, strideA, S, strideS,
+                           U, ldu, strideU, VT, ldvt, strideVT,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesvd
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* S, int64_t strideS,
+    std::complex<float>* U, int64_t ldu, int64_t strideU,
+    std::complex<float>* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gesvd_batch( jobu, jobvt, m, n, A, lda, strideA, S, strideS,
+                           U, ldu, strideU, VT, ldvt, strideVT,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the singular value decomposition (SVD) of a batch of
+/// m-by-n matrices A_i, as in `lapack::gesvd`: $A_i = U_i \Sigma_i V_i^H$.
+/// If min(m,n) <= 12 for real or 6 for complex, a one-sided Jacobi
+/// kernel is used instead of gesvd;
+/// see the pointer-array `lapack::gesvd_batch`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA, S_i = S + i*strideS,
+/// U_i = U + i*strideU, and VT_i = VT + i*strideVT.
+/// Problems run in parallel across OpenMP threads. The workspace size
+/// is queried once for the whole batch, and each thread reuses one
+/// workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] jobu
+///     Specifies options for computing each U_i; see `lapack::gesvd`.
+///
+/// @param[in] jobvt
+///     Specifies options for computing each V_i^H; see `lapack::gesvd`.
+///     jobvt and jobu cannot both be OverwriteVec.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The matrices A_i, each stored in an lda-by-n array.
+///     On exit, as in `lapack::gesvd`.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between consecutive matrices A_i. strideA >= lda*n.
+///
+/// @param[out] S
+///     The vectors S_i, each of length min(m,n).
+///     If info[i] = 0, the singular values of A_i, sorted so that
+///     S_i(j) >= S_i(j+1).
+///
+/// @param[in] strideS
+///     Distance between consecutive vectors S_i. strideS >= min(m,n).
+///
+/// @param[out] U
+///     The matrices U_i, each stored in an ldu-by-ucol array, with
+///     ucol = m if jobu = AllVec, or min(m,n) if jobu = SomeVec.
+///     Not referenced if jobu = NoVec or OverwriteVec.
+///
+/// @param[in] ldu
+///     The leading dimension of each U_i. ldu >= 1; if
+///     jobu = SomeVec or AllVec, ldu >= m.
+///
+/// @param[in] strideU
+///     Distance between consecutive matrices U_i. If jobu = SomeVec or
+///     AllVec, strideU >= ldu*ucol.
+///
+/// @param[out] VT
+///     The matrices VT_i, each stored in an ldvt-by-n array, containing
+///     n rows of V_i^H if jobvt = AllVec, or min(m,n) rows if
+///     jobvt = SomeVec. Not referenced if jobvt = NoVec or OverwriteVec.
+///
+/// @param[in] ldvt
+///     The leading dimension of each VT_i. ldvt >= 1;
+///     if jobvt = AllVec, ldvt >= n;
+///     if jobvt = SomeVec, ldvt >= min(m,n).
+///
+/// @param[in] strideVT
+///     Distance between consecutive matrices VT_i. If jobvt = SomeVec or
+///     AllVec, strideVT >= ldvt*n.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::gesvd` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup gesvd
+void gesvd_batch(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* S, int64_t strideS,
+    std::complex<double>* U, int64_t ldu, int64_t strideU,
+    std::complex<double>* VT, int64_t ldvt, int64_t strideVT,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gesvd_batch( jobu, jobvt, m, n, A, lda, strideA, S, strideS,
+                           U, ldu, strideU, VT, ldvt, strideVT,
+                           batch, info );
+}
+
+}  // namespace lapack
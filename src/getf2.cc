@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t getf2(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "sgetf2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -40,6 +43,7 @@ int64_t getf2(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgetf2(
         &m_, &n_,
         A, &lda_,
@@ -60,6 +64,8 @@ int64_t getf2(
     double* A, int64_t lda,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "dgetf2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -78,6 +84,7 @@ int64_t getf2(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgetf2(
         &m_, &n_,
         A, &lda_,
@@ -98,6 +105,8 @@ int64_t getf2(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "cgetf2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -116,6 +125,7 @@ int64_t getf2(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgetf2(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -178,6 +188,8 @@ int64_t getf2(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "zgetf2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -196,6 +208,7 @@ int64_t getf2(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgetf2(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,7 +5,11 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/recursive.hh"
 #include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Dispatch.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,35 +26,60 @@ int64_t getrf(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+    LAPACK_INSTRUMENT( "sgetrf", m, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive LU instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return getrf_recursive( m, n, A, lda, ipiv );
     #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
-    lapack_int info_ = 0;
-
-    LAPACK_sgetrf(
-        &m_, &n_,
-        A, &lda_,
-        ipiv_ptr, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        #ifdef LAPACK_HAVE_ILP64_DISPATCH
+            // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+            if (internal::use_ilp64( { m, n, lda, lda*n } )) {
+                int64_t info_ = 0;
+                LAPACK_INSTRUMENT_COMPUTE();
+                LAPACK_sgetrf_64(
+                    &m, &n,
+                    A, &lda,
+                    ipiv, &info_ );
+                if (info_ < 0) {
+                    throw Error();
+                }
+                return info_;
+            }
+        #endif
+
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        lapack_int m_ = (lapack_int) m;
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        #ifndef LAPACK_ILP64
+            // 32-bit copy
+            lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
+            lapack_int* ipiv_ptr = &ipiv_[0];
+        #else
+            lapack_int* ipiv_ptr = ipiv;
+        #endif
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( sgetrf, max( m, n ) )(
+            &m_, &n_,
+            A, &lda_,
+            ipiv_ptr, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        #endif
+        return info_;
     #endif
-    return info_;
 }
 
 // -----------------------------------------------------------------------------
@@ -60,35 +89,60 @@ int64_t getrf(
     double* A, int64_t lda,
     int64_t* ipiv )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+    LAPACK_INSTRUMENT( "dgetrf", m, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive LU instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return getrf_recursive( m, n, A, lda, ipiv );
     #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
-    lapack_int info_ = 0;
-
-    LAPACK_dgetrf(
-        &m_, &n_,
-        A, &lda_,
-        ipiv_ptr, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        #ifdef LAPACK_HAVE_ILP64_DISPATCH
+            // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+            if (internal::use_ilp64( { m, n, lda, lda*n } )) {
+                int64_t info_ = 0;
+                LAPACK_INSTRUMENT_COMPUTE();
+                LAPACK_dgetrf_64(
+                    &m, &n,
+                    A, &lda,
+                    ipiv, &info_ );
+                if (info_ < 0) {
+                    throw Error();
+                }
+                return info_;
+            }
+        #endif
+
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        lapack_int m_ = (lapack_int) m;
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        #ifndef LAPACK_ILP64
+            // 32-bit copy
+            lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
+            lapack_int* ipiv_ptr = &ipiv_[0];
+        #else
+            lapack_int* ipiv_ptr = ipiv;
+        #endif
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( dgetrf, max( m, n ) )(
+            &m_, &n_,
+            A, &lda_,
+            ipiv_ptr, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        #endif
+        return info_;
     #endif
-    return info_;
 }
 
 // -----------------------------------------------------------------------------
@@ -98,35 +152,60 @@ int64_t getrf(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+    LAPACK_INSTRUMENT( "cgetrf", m, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive LU instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return getrf_recursive( m, n, A, lda, ipiv );
     #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
-    lapack_int info_ = 0;
-
-    LAPACK_cgetrf(
-        &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        ipiv_ptr, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        #ifdef LAPACK_HAVE_ILP64_DISPATCH
+            // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+            if (internal::use_ilp64( { m, n, lda, lda*n } )) {
+                int64_t info_ = 0;
+                LAPACK_INSTRUMENT_COMPUTE();
+                LAPACK_cgetrf_64(
+                    &m, &n,
+                    (lapack_complex_float*) A, &lda,
+                    ipiv, &info_ );
+                if (info_ < 0) {
+                    throw Error();
+                }
+                return info_;
+            }
+        #endif
+
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        lapack_int m_ = (lapack_int) m;
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        #ifndef LAPACK_ILP64
+            // 32-bit copy
+            lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
+            lapack_int* ipiv_ptr = &ipiv_[0];
+        #else
+            lapack_int* ipiv_ptr = ipiv;
+        #endif
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( cgetrf, max( m, n ) )(
+            &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            ipiv_ptr, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        #endif
+        return info_;
     #endif
-    return info_;
 }
 
 // -----------------------------------------------------------------------------
@@ -178,35 +257,226 @@ int64_t getrf(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    lapack_int m_ = (lapack_int) m;
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
+    LAPACK_INSTRUMENT( "zgetrf", m, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive LU instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return getrf_recursive( m, n, A, lda, ipiv );
     #else
-        lapack_int* ipiv_ptr = ipiv;
+        #ifdef LAPACK_HAVE_ILP64_DISPATCH
+            // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+            if (internal::use_ilp64( { m, n, lda, lda*n } )) {
+                int64_t info_ = 0;
+                LAPACK_INSTRUMENT_COMPUTE();
+                LAPACK_zgetrf_64(
+                    &m, &n,
+                    (lapack_complex_double*) A, &lda,
+                    ipiv, &info_ );
+                if (info_ < 0) {
+                    throw Error();
+                }
+                return info_;
+            }
+        #endif
+
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        lapack_int m_ = (lapack_int) m;
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        #ifndef LAPACK_ILP64
+            // 32-bit copy
+            lapack::vector< lapack_int > ipiv_( max( 1, min( m, n )) );
+            lapack_int* ipiv_ptr = &ipiv_[0];
+        #else
+            lapack_int* ipiv_ptr = ipiv;
+        #endif
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( zgetrf, max( m, n ) )(
+            &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            ipiv_ptr, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        #endif
+        return info_;
     #endif
-    lapack_int info_ = 0;
-
-    LAPACK_zgetrf(
-        &m_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+}
+
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    LAPACK_INSTRUMENT( "sgetrf", m, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive LU instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return getrf_recursive( m, n, A, lda, ipiv );
+    #else
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        lapack_int m_ = (lapack_int) m;
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( sgetrf, max( m, n ) )(
+            &m_, &n_,
+            A, &lda_,
+            ipiv, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        return info_;
     #endif
-    return info_;
 }
 
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    LAPACK_INSTRUMENT( "dgetrf", m, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive LU instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return getrf_recursive( m, n, A, lda, ipiv );
+    #else
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        lapack_int m_ = (lapack_int) m;
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( dgetrf, max( m, n ) )(
+            &m_, &n_,
+            A, &lda_,
+            ipiv, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        return info_;
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    LAPACK_INSTRUMENT( "cgetrf", m, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive LU instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return getrf_recursive( m, n, A, lda, ipiv );
+    #else
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        lapack_int m_ = (lapack_int) m;
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( cgetrf, max( m, n ) )(
+            &m_, &n_,
+            (lapack_complex_float*) A, &lda_,
+            ipiv, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        return info_;
+    #endif
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::getrf` that takes 32-bit `lapack_int` pivots,
+/// which are passed to LAPACK directly, without converting to and
+/// from `int64_t` or allocating a temporary pivot array.
+/// The pivots can be passed on to the `lapack_int` variant of
+/// `lapack::getrs`.
+/// Other arguments and the return value are the same as for
+/// `lapack::getrf`.
+///
+/// Available only when LAPACK uses 32-bit integers (LAPACK_ILP64
+/// not defined); otherwise `lapack_int` is `int64_t`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @ingroup gesv_computational
+int64_t getrf(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    LAPACK_INSTRUMENT( "zgetrf", m, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive LU instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return getrf_recursive( m, n, A, lda, ipiv );
+    #else
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        lapack_int m_ = (lapack_int) m;
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( zgetrf, max( m, n ) )(
+            &m_, &n_,
+            (lapack_complex_double*) A, &lda_,
+            ipiv, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        return info_;
+    #endif
+}
+
+#endif // LAPACK_ILP64
+
 }  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
 
@@ -24,6 +25,8 @@ int64_t getrf2(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "sgetrf2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -42,6 +45,7 @@ int64_t getrf2(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgetrf2(
         &m_, &n_,
         A, &lda_,
@@ -62,6 +66,8 @@ int64_t getrf2(
     double* A, int64_t lda,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "dgetrf2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -80,6 +86,7 @@ int64_t getrf2(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgetrf2(
         &m_, &n_,
         A, &lda_,
@@ -100,6 +107,8 @@ int64_t getrf2(
     std::complex<float>* A, int64_t lda,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "cgetrf2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -118,6 +127,7 @@ int64_t getrf2(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgetrf2(
         &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -208,6 +218,8 @@ int64_t getrf2(
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "zgetrf2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -226,6 +238,7 @@ int64_t getrf2(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgetrf2(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
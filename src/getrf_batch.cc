@@ -0,0 +1,313 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Pointer-array getrf_batch. Each problem calls the lapack_int variant of
+// getrf, so with 32-bit lapack_int, pivots go through a per-thread buffer
+// instead of being allocated per problem.
+template <typename scalar_t>
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    // check arguments
+    check_batch_arg( m, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( lda, batch );
+    check_batch_array( Aarray, batch );
+    check_batch_array( ipiv_array, batch );
+    int64_t max_mn = 1;
+    for (size_t i = 0; i < batch; ++i) {
+        int64_t m_i   = batch_arg( m,   i );
+        int64_t n_i   = batch_arg( n,   i );
+        int64_t lda_i = batch_arg( lda, i );
+        lapack_error_if( m_i < 0 );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( lda_i < max( 1, m_i ) );
+        lapack_error_if( exceeds_lapack_int( { m_i, n_i, lda_i } ) );
+        max_mn = max( max_mn, min( m_i, n_i ) );
+    }
+    info.resize( batch );
+
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots, one buffer per thread
+        lapack::vector< lapack_int > ipiv_( batch_max_threads() * max_mn );
+    #endif
+
+    auto cost = [&]( size_t i ) {
+        return Gflop< scalar_t >::getrf( batch_arg( m, i ), batch_arg( n, i ) );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        int64_t m_i = batch_arg( m, i );
+        int64_t n_i = batch_arg( n, i );
+        #ifndef LAPACK_ILP64
+            lapack_int* ipiv_ptr = &ipiv_[ batch_thread_num() * max_mn ];
+        #else
+            lapack_int* ipiv_ptr = ipiv_array[ i ];
+        #endif
+
+        info[ i ] = lapack::getrf( m_i, n_i, Aarray[ i ], batch_arg( lda, i ),
+                                   ipiv_ptr );
+
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_ptr, ipiv_ptr + min( m_i, n_i ), ipiv_array[ i ] );
+        #endif
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided getrf_batch. Problems are the same size, so a static schedule
+// balances the load.
+template <typename scalar_t>
+void getrf_batch(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( batch > 1 && strideA < lda*n );
+    lapack_error_if( batch > 1 && stride_ipiv < min( m, n ) );
+    lapack_error_if( exceeds_lapack_int( { m, n, lda } ) );
+
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots, one buffer per thread
+        int64_t max_mn = max( 1, min( m, n ) );
+        lapack::vector< lapack_int > ipiv_( batch_max_threads() * max_mn );
+    #endif
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        #ifndef LAPACK_ILP64
+            lapack_int* ipiv_ptr = &ipiv_[ batch_thread_num() * max_mn ];
+        #else
+            lapack_int* ipiv_ptr = &ipiv[ i*stride_ipiv ];
+        #endif
+
+        info[ i ] = lapack::getrf( m, n, &A[ i*strideA ], lda, ipiv_ptr );
+
+        #ifndef LAPACK_ILP64
+            std::copy( ipiv_ptr, ipiv_ptr + min( m, n ), &ipiv[ i*stride_ipiv ] );
+        #endif
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::getrf_batch( m, n, Aarray, lda, ipiv_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::getrf_batch( m, n, Aarray, lda, ipiv_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::getrf_batch( m, n, Aarray, lda, ipiv_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes LU factorizations of a batch of general matrices, using
+/// partial pivoting with row interchanges. Problem i computes
+/// \[
+///     A_i = P_i L_i U_i
+/// \]
+/// as in `lapack::getrf`.
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of m, n, and lda has either one element, used for all problems,
+/// or batch elements. Problems run in parallel across OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m_i >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n_i >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of batch pointers to the matrices A_i, each stored in an
+///     lda_i-by-n_i array. On exit, the factors L_i and U_i;
+///     the unit diagonal elements of L_i are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of each array A_i. lda_i >= max(1,m_i).
+///
+/// @param[out] ipiv_array
+///     Array of batch pointers to the pivot vectors of length min(m_i,n_i).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::getrf`
+///     for problem i:
+///     = 0: successful exit;
+///     > 0: if info[i] = j, U_i(j,j) is exactly zero.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup gesv_computational
+void getrf_batch(
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::getrf_batch( m, n, Aarray, lda, ipiv_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrf_batch(
+    int64_t m, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrf_batch( m, n, A, lda, strideA, ipiv, stride_ipiv,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrf_batch(
+    int64_t m, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrf_batch( m, n, A, lda, strideA, ipiv, stride_ipiv,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrf_batch( m, n, A, lda, strideA, ipiv, stride_ipiv,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes LU factorizations of a batch of general m-by-n matrices,
+/// using partial pivoting with row interchanges, as in `lapack::getrf`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA and ipiv_i = ipiv + i*stride_ipiv.
+/// Problems run in parallel across OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The matrices A_i, each stored in an lda-by-n array.
+///     On exit, the factors L_i and U_i.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] strideA
+///     Distance between consecutive matrices A_i. strideA >= lda*n.
+///
+/// @param[out] ipiv
+///     The pivot vectors, each of length min(m,n).
+///
+/// @param[in] stride_ipiv
+///     Distance between consecutive pivot vectors.
+///     stride_ipiv >= min(m,n).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::getrf` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup gesv_computational
+void getrf_batch(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrf_batch( m, n, A, lda, strideA, ipiv, stride_ipiv,
+                           batch, info );
+}
+
+}  // namespace lapack
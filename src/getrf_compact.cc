@@ -0,0 +1,214 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "Compact.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Unblocked right-looking LU with partial pivoting, as in getf2, of one
+// group of n-by-n matrices. Each lane chooses its own pivot, so row swaps
+// gather and scatter across lanes; the pivot search, scaling, and rank-1
+// update are regular lane loops. Sets info[ l ] for each lane.
+template <typename scalar_t>
+void getrf_compact_group(
+    int64_t n, scalar_t* A, int64_t* ipiv, int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const int64_t w = compact_width< scalar_t >();
+    const scalar_t one = 1;
+
+    real_t amax[ w ];
+    int64_t imax[ w ];
+    scalar_t rcp[ w ];
+    for (int64_t l = 0; l < w; ++l)
+        info[ l ] = 0;
+
+    for (int64_t k = 0; k < n; ++k) {
+        scalar_t* Ak = &A[ k*n*w ];  // column k
+
+        // find pivot in column k, on or below the diagonal
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l) {
+            amax[ l ] = abs1_lane( Ak[ k*w + l ] );
+            imax[ l ] = k;
+        }
+        for (int64_t i = k+1; i < n; ++i) {
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l) {
+                real_t a = abs1_lane( Ak[ i*w + l ] );
+                if (a > amax[ l ]) {
+                    amax[ l ] = a;
+                    imax[ l ] = i;
+                }
+            }
+        }
+
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l) {
+            ipiv[ k*w + l ] = imax[ l ] + 1;
+            info[ l ] = (amax[ l ] == 0 && info[ l ] == 0) ? k + 1 : info[ l ];
+        }
+
+        // swap rows k and imax, with a gather and scatter across lanes;
+        // lanes with imax = k store the same value twice
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t* Aj = &A[ j*n*w ];
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l) {
+                scalar_t a = Aj[ k*w + l ];
+                scalar_t b = Aj[ imax[ l ]*w + l ];
+                Aj[ k*w + l ] = b;
+                Aj[ imax[ l ]*w + l ] = a;
+            }
+        }
+
+        // scale below the diagonal by 1 / pivot, unless the pivot is 0
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l)
+            rcp[ l ] = amax[ l ] != 0 ? div_lane( one, Ak[ k*w + l ] ) : one;
+        for (int64_t i = k+1; i < n; ++i) {
+            LAPACK_COMPACT_SIMD
+            for (int64_t l = 0; l < w; ++l)
+                Ak[ i*w + l ] = mul_lane( Ak[ i*w + l ], rcp[ l ] );
+        }
+
+        // rank-1 update of the trailing matrix
+        for (int64_t j = k+1; j < n; ++j) {
+            scalar_t* Aj = &A[ j*n*w ];
+            for (int64_t i = k+1; i < n; ++i) {
+                LAPACK_COMPACT_SIMD
+                for (int64_t l = 0; l < w; ++l)
+                    Aj[ i*w + l ] -= mul_lane( Ak[ i*w + l ], Aj[ k*w + l ] );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void getrf_compact(
+    int64_t n,
+    scalar_t* Ac,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( n < 0 );
+
+    const int64_t w = compact_width< scalar_t >();
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        int64_t info_g[ w ];
+        getrf_compact_group( n, &Ac[ g*n*n*w ], &ipiv[ g*n*w ], info_g );
+        int64_t lanes = std::min( w, int64_t( batch ) - g*w );
+        for (int64_t l = 0; l < lanes; ++l)
+            info[ g*w + l ] = info_g[ l ];
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrf_compact(
+    int64_t n,
+    float* Ac,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrf_compact( n, Ac, ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrf_compact(
+    int64_t n,
+    double* Ac,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrf_compact( n, Ac, ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrf_compact(
+    int64_t n,
+    std::complex<float>* Ac,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrf_compact( n, Ac, ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes LU factorizations with partial pivoting of a compact batch
+/// of n-by-n matrices, as in `lapack::getrf`:
+/// $A_i = P_i L_i U_i$.
+///
+/// The matrices are interleaved in groups of `lapack::compact_width`,
+/// as from `lapack::pack_compact`, and the factorization vectorizes
+/// across the matrices of each group. This is much faster than
+/// `lapack::getrf_batch` for small n, say n <= 16, where each matrix is
+/// too small to vectorize on its own. Groups run in parallel across
+/// OpenMP threads. Solve using `lapack::getrs_compact`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] Ac
+///     The compact batch of matrices A_i, of length
+///     `lapack::compact_size< scalar_t >( n, n, batch )`.
+///     On exit, the factors L_i and U_i in compact format; the unit
+///     diagonal elements of L_i are not stored.
+///
+/// @param[out] ipiv
+///     The pivot indices in compact format, of length
+///     `lapack::compact_size< scalar_t >( n, 1, batch )`: for problem b in
+///     lane l of group g, row k was interchanged with row
+///     ipiv[ g*n*w + k*w + l ], 1-based, as in `lapack::getrf`.
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @param[out] info
+///     The vector info of length batch.
+///     - = 0: successful exit.
+///     - > 0: if info[i] = k, $U_i(k,k)$ is exactly zero. The factorization
+///       has been completed, but the factor U_i is exactly singular, and
+///       division by zero will occur if it is used to solve a system.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup gesv_computational
+void getrf_compact(
+    int64_t n,
+    std::complex<double>* Ac,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrf_compact( n, Ac, ipiv, batch, info );
+}
+
+}  // namespace lapack
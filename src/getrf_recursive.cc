@@ -0,0 +1,330 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/recursive.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Panels with at most this many columns, or rows, end the recursion and
+// are factored with level 2 BLAS. Narrower leaves spend more time in
+// small trsm and gemm calls; wider leaves do more flops in level 2 BLAS.
+const int64_t getrf_recursive_nb = 16;
+
+//------------------------------------------------------------------------------
+// Applies row interchanges ipiv[ k1 ], ..., ipiv[ k2-1 ] (1-based rows)
+// to the n columns of A, in blocks of 32 columns as in laswp.
+// Pivots are int64_t or lapack_int.
+template <typename scalar_t, typename ipiv_t>
+void laswp_recursive(
+    int64_t n, scalar_t* A, int64_t lda,
+    int64_t k1, int64_t k2, ipiv_t const* ipiv )
+{
+    const int64_t nb = 32;
+    for (int64_t jj = 0; jj < n; jj += nb) {
+        int64_t jb = min( nb, n - jj );
+        for (int64_t k = k1; k < k2; ++k) {
+            int64_t p = ipiv[ k ] - 1;
+            if (p != k) {
+                scalar_t* Ak = &A[ k + jj*lda ];
+                scalar_t* Ap = &A[ p + jj*lda ];
+                for (int64_t j = 0; j < jb; ++j)
+                    std::swap( Ak[ j*lda ], Ap[ j*lda ] );
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// Unblocked right-looking LU with partial pivoting, as in getf2.
+template <typename scalar_t, typename ipiv_t>
+int64_t getrf_recursive_leaf(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    ipiv_t* ipiv )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const real_t sfmin = std::numeric_limits< real_t >::min();
+    const scalar_t one = 1;
+    const int64_t minmn = min( m, n );
+
+    int64_t info = 0;
+    for (int64_t j = 0; j < minmn; ++j) {
+        scalar_t* Ajj = &A[ j + j*lda ];
+        int64_t jp = j + blas::iamax( m - j, Ajj, 1 );
+        ipiv[ j ] = ipiv_t( jp + 1 );
+        if (A[ jp + j*lda ] != scalar_t( 0 )) {
+            if (jp != j)
+                blas::swap( n, &A[ j ], lda, &A[ jp ], lda );
+
+            // compute elements below the diagonal of column j
+            if (j < m - 1) {
+                if (std::abs( *Ajj ) >= sfmin) {
+                    blas::scal( m - j - 1, one / *Ajj, Ajj + 1, 1 );
+                }
+                else {
+                    for (int64_t i = 1; i < m - j; ++i)
+                        Ajj[ i ] /= *Ajj;
+                }
+            }
+        }
+        else if (info == 0) {
+            // U(j,j) is exactly zero; continue, as in getf2
+            info = j + 1;
+        }
+
+        // rank-1 update of the trailing matrix
+        if (j < minmn - 1) {
+            blas::geru( blas::Layout::ColMajor, m - j - 1, n - j - 1,
+                        -one, Ajj + 1, 1,
+                              Ajj + lda, lda,
+                              Ajj + 1 + lda, lda );
+        }
+    }
+    return info;
+}
+
+//------------------------------------------------------------------------------
+// Recursive LU with partial pivoting, as in getrf2, but stopping at
+// panels of getrf_recursive_nb columns instead of one column.
+// The left half [A11; A21] is factored, the swaps applied to the right
+// half, then A12 = L11^{-1} A12 and A22 -= A21 A12 are computed and
+// the Schur complement A22 is factored. Pivots are int64_t, or lapack_int
+// for the lapack_int overloads of getrf, which then need no pivot copy.
+template <typename scalar_t, typename ipiv_t>
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    scalar_t* A, int64_t lda,
+    ipiv_t* ipiv )
+{
+    const scalar_t one = 1;
+    const int64_t minmn = min( m, n );
+    if (minmn <= getrf_recursive_nb)
+        return getrf_recursive_leaf( m, n, A, lda, ipiv );
+
+    int64_t n1 = minmn / 2;
+    int64_t n2 = n - n1;
+    scalar_t* A12 = &A[ n1*lda ];
+    scalar_t* A21 = &A[ n1 ];
+    scalar_t* A22 = &A[ n1 + n1*lda ];
+
+    // factor [A11; A21]
+    int64_t info = getrf_recursive( m, n1, A, lda, ipiv );
+
+    // apply swaps to [A12; A22], then A12 = L11^{-1} A12
+    laswp_recursive( n2, A12, lda, 0, n1, ipiv );
+    blas::trsm( blas::Layout::ColMajor, blas::Side::Left, blas::Uplo::Lower,
+                blas::Op::NoTrans, blas::Diag::Unit, n1, n2,
+                one, A, lda, A12, lda );
+
+    // A22 -= A21 A12, then factor A22
+    blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                m - n1, n2, n1,
+                -one, A21, lda, A12, lda,
+                 one, A22, lda );
+    int64_t info2 = getrf_recursive( m - n1, n2, A22, lda, &ipiv[ n1 ] );
+    if (info == 0 && info2 > 0)
+        info = info2 + n1;
+
+    // adjust pivots from A22 and apply their swaps to A21
+    for (int64_t k = n1; k < minmn; ++k)
+        ipiv[ k ] += ipiv_t( n1 );
+    laswp_recursive( n1, A, lda, n1, minmn, ipiv );
+
+    return info;
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    return internal::getrf_recursive( m, n, A, lda, ipiv );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    return internal::getrf_recursive( m, n, A, lda, ipiv );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    return internal::getrf_recursive( m, n, A, lda, ipiv );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes an LU factorization of a general m-by-n matrix A
+/// using partial pivoting with row interchanges, as in `lapack::getrf`,
+/// with a native recursive algorithm instead of calling LAPACK.
+///
+/// The factorization has the form
+/// \[
+///     A = P L U
+/// \]
+/// where P is a permutation matrix, L is lower triangular with unit
+/// diagonal elements (lower trapezoidal if m > n), and U is upper
+/// triangular (upper trapezoidal if m < n).
+///
+/// As in `lapack::getrf2`, the columns are split in half,
+/// $[A_{11}; A_{21}]$ is factored recursively, the row swaps are applied
+/// to $[A_{12}; A_{22}]$, $A_{12}$ is solved with trsm, the Schur
+/// complement $A_{22} - A_{21} A_{12}$ is formed with gemm and factored
+/// recursively. Unlike getrf2, the recursion stops at panels of 16
+/// columns, which are factored with level 2 BLAS, as in `lapack::getf2`.
+/// Being cache oblivious, it needs no block size.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of the matrix A. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The m-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the m-by-n matrix to be factored.
+///     On exit, the factors L and U from the factorization
+///     A = P*L*U; the unit diagonal elements of L are not stored.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,m).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length min(m,n).
+///     The pivot indices; for 1 <= i <= min(m,n), row i of the
+///     matrix was interchanged with row ipiv(i).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero. The factorization
+///     has been completed, but the factor U is exactly
+///     singular, and division by zero will occur if it is used
+///     to solve a system of equations.
+///
+/// @see lapack::getrf
+///
+/// @ingroup gesv_computational
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    return internal::getrf_recursive( m, n, A, lda, ipiv );
+}
+
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    float* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    return internal::getrf_recursive( m, n, A, lda, ipiv );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    double* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    return internal::getrf_recursive( m, n, A, lda, ipiv );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    return internal::getrf_recursive( m, n, A, lda, ipiv );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::getrf_recursive` that takes 32-bit `lapack_int`
+/// pivots, computed in place without a temporary pivot array.
+/// The pivots can be passed on to the `lapack_int` variant of
+/// `lapack::getrs`. Other arguments and the return value are the same as
+/// for `lapack::getrf_recursive`.
+///
+/// Available only when LAPACK uses 32-bit integers (LAPACK_ILP64
+/// not defined); otherwise `lapack_int` is `int64_t`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @ingroup gesv_computational
+int64_t getrf_recursive(
+    int64_t m, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    lapack_int* ipiv )
+{
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+
+    return internal::getrf_recursive( m, n, A, lda, ipiv );
+}
+
+#endif // LAPACK_ILP64
+
+}  // namespace lapack
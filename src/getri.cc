@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "WorkSizeCache.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +24,125 @@ int64_t getri(
     float* A, int64_t lda,
     int64_t const* ipiv )
 {
+    LAPACK_INSTRUMENT( "sgetri", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    getri_work_size( n, A, lda, ipiv,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return getri_work( n, A, lda, ipiv,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    LAPACK_INSTRUMENT( "dgetri", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    getri_work_size( n, A, lda, ipiv,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return getri_work( n, A, lda, ipiv,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    LAPACK_INSTRUMENT( "cgetri", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    getri_work_size( n, A, lda, ipiv,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return getri_work( n, A, lda, ipiv,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the inverse of a matrix using the LU factorization
+/// computed by `lapack::getrf`.
+///
+/// This method inverts U and then computes $A^{-1}$ by solving the system
+/// \[
+///     A^{-1} L = U^{-1} \text{ for } A^{-1}.
+/// \]
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the factors L and U from the factorization
+///     $A = P L U$ as computed by `lapack::getrf`.
+///     On successful exit, the inverse of the original matrix A.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] ipiv
+///     The vector ipiv of length n.
+///     The pivot indices from `lapack::getrf`; for 1 <= i <= n, row i of the
+///     matrix was interchanged with row ipiv(i).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, U(i,i) is exactly zero; the matrix is
+///     singular and its inverse could not be computed.
+///
+/// @ingroup gesv_computational
+int64_t getri(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv )
+{
+    LAPACK_INSTRUMENT( "zgetri", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    getri_work_size( n, A, lda, ipiv,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return getri_work( n, A, lda, ipiv,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size(
+    int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "sgetri_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -29,50 +150,81 @@ int64_t getri(
     }
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
-        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
-        lapack_int const* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int const* ipiv_ptr = ipiv;
-    #endif
     lapack_int info_ = 0;
 
-    // query for workspace size
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "sgetri", n_, lda_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size; ipiv is not referenced
     float qry_work[1];
+    lapack_int qry_ipiv[1];
     lapack_int ineg_one = -1;
     LAPACK_sgetri(
         &n_,
         A, &lda_,
-        ipiv_ptr,
+        qry_ipiv,
         qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getri_work_size(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dgetri_work_size", 0, n, 0 );
 
-    LAPACK_sgetri(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "dgetri", n_, lda_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size; ipiv is not referenced
+    double qry_work[1];
+    lapack_int qry_ipiv[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgetri(
         &n_,
         A, &lda_,
-        ipiv_ptr,
-        &work[0], &lwork_, &info_ );
+        qry_ipiv,
+        qry_work, &ineg_one, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 /// @ingroup gesv_computational
-int64_t getri(
+void getri_work_size(
     int64_t n,
-    double* A, int64_t lda,
-    int64_t const* ipiv )
+    std::complex<float>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "cgetri_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -80,6 +232,99 @@ int64_t getri(
     }
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "cgetri", n_, lda_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size; ipiv is not referenced
+    std::complex<float> qry_work[1];
+    lapack_int qry_ipiv[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgetri(
+        &n_,
+        (lapack_complex_float*) A, &lda_,
+        qry_ipiv,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Queries the workspace size needed by `lapack::getri_work`.
+/// Arguments through ipiv are the same as for `lapack::getri`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @ingroup gesv_computational
+void getri_work_size(
+    int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "zgetri_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "zgetri", n_, lda_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size; ipiv is not referenced
+    std::complex<double> qry_work[1];
+    lapack_int qry_ipiv[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zgetri(
+        &n_,
+        (lapack_complex_double*) A, &lda_,
+        qry_ipiv,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri_work(
+    int64_t n,
+    float* A, int64_t lda,
+    int64_t const* ipiv,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "sgetri_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
         lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
@@ -88,29 +333,56 @@ int64_t getri(
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dgetri(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgetri(
         &n_,
         A, &lda_,
         ipiv_ptr,
-        qry_work, &ineg_one, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getri_work(
+    int64_t n,
+    double* A, int64_t lda,
+    int64_t const* ipiv,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dgetri_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( max( 1, (n) ) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgetri(
         &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_ );
+        work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -119,15 +391,19 @@ int64_t getri(
 
 // -----------------------------------------------------------------------------
 /// @ingroup gesv_computational
-int64_t getri(
+int64_t getri_work(
     int64_t n,
     std::complex<float>* A, int64_t lda,
-    int64_t const* ipiv )
+    int64_t const* ipiv,
+    std::complex<float>* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "cgetri_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
@@ -139,29 +415,15 @@ int64_t getri(
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgetri(
         &n_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-
-    LAPACK_cgetri(
-        &n_,
-        (lapack_complex_float*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
+        (lapack_complex_float*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
@@ -169,48 +431,38 @@ int64_t getri(
 }
 
 // -----------------------------------------------------------------------------
-/// Computes the inverse of a matrix using the LU factorization
-/// computed by `lapack::getrf`.
-///
-/// This method inverts U and then computes $A^{-1}$ by solving the system
-/// \[
-///     A^{-1} L = U^{-1} \text{ for } A^{-1}.
-/// \]
+/// Variant of `lapack::getri` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::getri_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ipiv and the return value are the same as for
+/// `lapack::getri`.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
 ///
-/// @param[in] n
-///     The order of the matrix A. n >= 0.
+/// @param work
+///     The vector work of length lwork.
 ///
-/// @param[in,out] A
-///     The n-by-n matrix A, stored in an lda-by-n array.
-///     On entry, the factors L and U from the factorization
-///     $A = P L U$ as computed by `lapack::getrf`.
-///     On successful exit, the inverse of the original matrix A.
-///
-/// @param[in] lda
-///     The leading dimension of the array A. lda >= max(1,n).
-///
-/// @param[in] ipiv
-///     The vector ipiv of length n.
-///     The pivot indices from `lapack::getrf`; for 1 <= i <= n, row i of the
-///     matrix was interchanged with row ipiv(i).
-///
-/// @return = 0: successful exit
-/// @return > 0: if return value = i, U(i,i) is exactly zero; the matrix is
-///     singular and its inverse could not be computed.
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::getri_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
 ///
 /// @ingroup gesv_computational
-int64_t getri(
+int64_t getri_work(
     int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t const* ipiv )
+    int64_t const* ipiv,
+    std::complex<double>* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "zgetri_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
@@ -222,29 +474,15 @@ int64_t getri(
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgetri(
-        &n_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgetri(
         &n_,
         (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
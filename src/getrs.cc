@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +25,30 @@ int64_t getrs(
     int64_t const* ipiv,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "sgetrs", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char trans_ = op2char( trans );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_sgetrs_64(
+                &trans_, &n, &nrhs,
+                A, &lda,
+                ipiv,
+                B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -45,6 +71,7 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgetrs(
         &trans_, &n_, &nrhs_,
         A, &lda_,
@@ -68,6 +95,30 @@ int64_t getrs(
     int64_t const* ipiv,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dgetrs", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char trans_ = op2char( trans );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_dgetrs_64(
+                &trans_, &n, &nrhs,
+                A, &lda,
+                ipiv,
+                B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -90,6 +141,7 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgetrs(
         &trans_, &n_, &nrhs_,
         A, &lda_,
@@ -113,6 +165,30 @@ int64_t getrs(
     int64_t const* ipiv,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "cgetrs", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char trans_ = op2char( trans );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_cgetrs_64(
+                &trans_, &n, &nrhs,
+                (lapack_complex_float*) A, &lda,
+                ipiv,
+                (lapack_complex_float*) B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -135,6 +211,7 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgetrs(
         &trans_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -211,6 +288,30 @@ int64_t getrs(
     int64_t const* ipiv,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zgetrs", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char trans_ = op2char( trans );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_zgetrs_64(
+                &trans_, &n, &nrhs,
+                (lapack_complex_double*) A, &lda,
+                ipiv,
+                (lapack_complex_double*) B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -233,6 +334,7 @@ int64_t getrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgetrs(
         &trans_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -248,4 +350,182 @@ int64_t getrs(
     return info_;
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda,
+    lapack_int const* ipiv,
+    float* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "sgetrs", 0, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgetrs(
+        &trans_, &n_, &nrhs_,
+        A, &lda_,
+        ipiv,
+        B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda,
+    lapack_int const* ipiv,
+    double* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "dgetrs", 0, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgetrs(
+        &trans_, &n_, &nrhs_,
+        A, &lda_,
+        ipiv,
+        B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "cgetrs", 0, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgetrs(
+        &trans_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv,
+        (lapack_complex_float*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::getrs` that takes 32-bit `lapack_int` pivots,
+/// which are passed to LAPACK directly, without converting to and
+/// from `int64_t` or allocating a temporary pivot array.
+/// The pivots can come from the `lapack_int` variant of
+/// `lapack::getrf`.
+/// Other arguments and the return value are the same as for
+/// `lapack::getrs`.
+///
+/// Available only when LAPACK uses 32-bit integers (LAPACK_ILP64
+/// not defined); otherwise `lapack_int` is `int64_t`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @ingroup gesv_computational
+int64_t getrs(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda,
+    lapack_int const* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "zgetrs", 0, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char trans_ = op2char( trans );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_zgetrs(
+        &trans_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        ipiv,
+        (lapack_complex_double*) B, &ldb_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+#endif // LAPACK_ILP64
+
 }  // namespace lapack
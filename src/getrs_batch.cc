@@ -0,0 +1,361 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Pointer-array getrs_batch. Each problem calls the lapack_int variant of
+// getrs, so with 32-bit lapack_int, pivots are converted into a
+// per-thread buffer instead of being allocated per problem.
+template <typename scalar_t>
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< scalar_t* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    // check arguments
+    check_batch_arg( trans, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( nrhs, batch );
+    check_batch_arg( lda, batch );
+    check_batch_arg( ldb, batch );
+    check_batch_array( Aarray, batch );
+    check_batch_array( ipiv_array, batch );
+    check_batch_array( Barray, batch );
+    int64_t max_n = 1;
+    for (size_t i = 0; i < batch; ++i) {
+        int64_t n_i    = batch_arg( n,    i );
+        int64_t nrhs_i = batch_arg( nrhs, i );
+        int64_t lda_i  = batch_arg( lda,  i );
+        int64_t ldb_i  = batch_arg( ldb,  i );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( nrhs_i < 0 );
+        lapack_error_if( lda_i < max( 1, n_i ) );
+        lapack_error_if( ldb_i < max( 1, n_i ) );
+        lapack_error_if( exceeds_lapack_int( { n_i, nrhs_i, lda_i, ldb_i } ) );
+        max_n = max( max_n, n_i );
+    }
+    info.resize( batch );
+
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots, one buffer per thread
+        lapack::vector< lapack_int > ipiv_( batch_max_threads() * max_n );
+    #endif
+
+    auto cost = [&]( size_t i ) {
+        return Gflop< scalar_t >::getrs( batch_arg( n, i ), batch_arg( nrhs, i ) );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        int64_t n_i = batch_arg( n, i );
+        #ifndef LAPACK_ILP64
+            lapack_int* ipiv_ptr = &ipiv_[ batch_thread_num() * max_n ];
+            std::copy( ipiv_array[ i ], ipiv_array[ i ] + n_i, ipiv_ptr );
+        #else
+            lapack_int* ipiv_ptr = ipiv_array[ i ];
+        #endif
+
+        info[ i ] = lapack::getrs(
+            batch_arg( trans, i ), n_i, batch_arg( nrhs, i ),
+            Aarray[ i ], batch_arg( lda, i ), ipiv_ptr,
+            Barray[ i ], batch_arg( ldb, i ) );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided getrs_batch.
+template <typename scalar_t>
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch > 1 && strideA < lda*n );
+    lapack_error_if( batch > 1 && stride_ipiv < n );
+    lapack_error_if( batch > 1 && strideB < ldb*nrhs );
+    lapack_error_if( exceeds_lapack_int( { n, nrhs, lda, ldb } ) );
+
+    #ifndef LAPACK_ILP64
+        // 32-bit pivots, one buffer per thread
+        int64_t max_n = max( 1, n );
+        lapack::vector< lapack_int > ipiv_( batch_max_threads() * max_n );
+    #endif
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        #ifndef LAPACK_ILP64
+            lapack_int* ipiv_ptr = &ipiv_[ batch_thread_num() * max_n ];
+            std::copy( &ipiv[ i*stride_ipiv ], &ipiv[ i*stride_ipiv ] + n,
+                       ipiv_ptr );
+        #else
+            lapack_int const* ipiv_ptr = &ipiv[ i*stride_ipiv ];
+        #endif
+
+        info[ i ] = lapack::getrs(
+            trans, n, nrhs, &A[ i*strideA ], lda, ipiv_ptr,
+            &B[ i*strideB ], ldb );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::getrs_batch( trans, n, nrhs, Aarray, lda, ipiv_array,
+                           Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::getrs_batch( trans, n, nrhs, Aarray, lda, ipiv_array,
+                           Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::getrs_batch( trans, n, nrhs, Aarray, lda, ipiv_array,
+                           Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations
+/// \[
+///     A_i X_i = B_i,
+///     A_i^T X_i = B_i, \text{ or }
+///     A_i^H X_i = B_i,
+/// \]
+/// using the LU factorizations computed by `lapack::getrf_batch`,
+/// as in `lapack::getrs`.
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of trans, n, nrhs, lda, and ldb has either one element, used for
+/// all problems, or batch elements. Problems run in parallel across
+/// OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of each system of equations, as in `lapack::getrs`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n_i >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs_i >= 0.
+///
+/// @param[in] Aarray
+///     Array of batch pointers to the factors L_i and U_i, each stored in
+///     an lda_i-by-n_i array, from `lapack::getrf_batch`.
+///
+/// @param[in] lda
+///     The leading dimension of each array A_i. lda_i >= max(1,n_i).
+///
+/// @param[in] ipiv_array
+///     Array of batch pointers to the pivot vectors of length n_i,
+///     from `lapack::getrf_batch`.
+///
+/// @param[in,out] Barray
+///     Array of batch pointers to the right hand side matrices B_i,
+///     each stored in an ldb_i-by-nrhs_i array.
+///     On exit, the solution matrices X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each array B_i. ldb_i >= max(1,n_i).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::getrs`
+///     for problem i, which is 0 since arguments are checked beforehand.
+///
+/// @throws Error if any argument is invalid, before any system is solved.
+///
+/// @ingroup gesv_computational
+void getrs_batch(
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< int64_t* > const& ipiv_array,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::getrs_batch( trans, n, nrhs, Aarray, lda, ipiv_array,
+                           Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrs_batch( trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                           B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrs_batch( trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                           B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrs_batch( trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                           B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations with n-by-n matrices A_i,
+/// using the LU factorizations computed by `lapack::getrf_batch`,
+/// as in `lapack::getrs`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA, ipiv_i = ipiv + i*stride_ipiv, and
+/// B_i = B + i*strideB. Problems run in parallel across OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of the systems of equations, as in `lapack::getrs`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in] A
+///     The factors L_i and U_i, each stored in an lda-by-n array,
+///     from `lapack::getrf_batch`.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between consecutive matrices A_i. strideA >= lda*n.
+///
+/// @param[in] ipiv
+///     The pivot vectors, each of length n, from `lapack::getrf_batch`.
+///
+/// @param[in] stride_ipiv
+///     Distance between consecutive pivot vectors. stride_ipiv >= n.
+///
+/// @param[in,out] B
+///     The right hand side matrices B_i, each stored in an ldb-by-nrhs
+///     array. On exit, the solution matrices X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between consecutive matrices B_i. strideB >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::getrs` for problem i.
+///
+/// @throws Error if any argument is invalid, before any system is solved.
+///
+/// @ingroup gesv_computational
+void getrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::getrs_batch( trans, n, nrhs, A, lda, strideA, ipiv, stride_ipiv,
+                           B, ldb, strideB, batch, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,173 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "Compact.hh"
+
+#include <utility>
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Applies the row interchanges from getrf_compact to one group of n-by-nrhs
+// matrices B, in order k = 0, ..., n-1 if forward, else in reverse.
+// Each lane has its own pivots, so this is done per lane.
+template <typename scalar_t>
+void laswp_compact_group(
+    int64_t n, int64_t nrhs, scalar_t* B, int64_t const* ipiv,
+    bool forward )
+{
+    const int64_t w = compact_width< scalar_t >();
+    for (int64_t kk = 0; kk < n; ++kk) {
+        int64_t k = forward ? kk : n-1 - kk;
+        for (int64_t l = 0; l < w; ++l) {
+            int64_t p = ipiv[ k*w + l ] - 1;
+            if (p != k) {
+                for (int64_t j = 0; j < nrhs; ++j) {
+                    std::swap( B[ (k + j*n)*w + l ], B[ (p + j*n)*w + l ] );
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void getrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* Ac,
+    int64_t const* ipiv,
+    scalar_t* Bc,
+    size_t batch )
+{
+    // check arguments
+    lapack_error_if( trans != Op::NoTrans && trans != Op::Trans
+                     && trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+
+    const int64_t w = compact_width< scalar_t >();
+    const scalar_t one = 1;
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        scalar_t const* A = &Ac[ g*n*n*w ];
+        int64_t const* ipiv_g = &ipiv[ g*n*w ];
+        scalar_t* B = &Bc[ g*n*nrhs*w ];
+        if (trans == Op::NoTrans) {
+            // solve L U X = P^T B
+            laswp_compact_group( n, nrhs, B, ipiv_g, true );
+            trsm_compact_group( Uplo::Lower, Op::NoTrans, Diag::Unit,
+                                n, nrhs, one, A, B, 1, n, false );
+            trsm_compact_group( Uplo::Upper, Op::NoTrans, Diag::NonUnit,
+                                n, nrhs, one, A, B, 1, n, false );
+        }
+        else {
+            // solve U^T L^T P^T X = B, or conjugate-transpose
+            trsm_compact_group( Uplo::Upper, trans, Diag::NonUnit,
+                                n, nrhs, one, A, B, 1, n, false );
+            trsm_compact_group( Uplo::Lower, trans, Diag::Unit,
+                                n, nrhs, one, A, B, 1, n, false );
+            laswp_compact_group( n, nrhs, B, ipiv_g, false );
+        }
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* Ac,
+    int64_t const* ipiv,
+    float* Bc,
+    size_t batch )
+{
+    internal::getrs_compact( trans, n, nrhs, Ac, ipiv, Bc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* Ac,
+    int64_t const* ipiv,
+    double* Bc,
+    size_t batch )
+{
+    internal::getrs_compact( trans, n, nrhs, Ac, ipiv, Bc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void getrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* Ac,
+    int64_t const* ipiv,
+    std::complex<float>* Bc,
+    size_t batch )
+{
+    internal::getrs_compact( trans, n, nrhs, Ac, ipiv, Bc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a system of linear equations $op(A_i) X_i = B_i$ for each
+/// problem of a compact batch, using the LU factorizations from
+/// `lapack::getrf_compact`, as in `lapack::getrs`.
+/// The right-hand sides are interleaved like the matrices, as from
+/// `lapack::pack_compact`, and the solves vectorize across the problems
+/// of each group. Groups run in parallel across OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of the systems of equations:
+///     - lapack::Op::NoTrans:   $A_i   X_i = B_i$ (No transpose)
+///     - lapack::Op::Trans:     $A_i^T X_i = B_i$ (Transpose)
+///     - lapack::Op::ConjTrans: $A_i^H X_i = B_i$ (Conjugate transpose)
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns of
+///     each matrix B_i. nrhs >= 0.
+///
+/// @param[in] Ac
+///     The factors L_i and U_i from `lapack::getrf_compact`.
+///
+/// @param[in] ipiv
+///     The pivot indices from `lapack::getrf_compact`.
+///
+/// @param[in,out] Bc
+///     The compact batch of n-by-nrhs right hand side matrices B_i, of
+///     length `lapack::compact_size< scalar_t >( n, nrhs, batch )`.
+///     On exit, the solution matrices X_i.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup gesv_computational
+void getrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* Ac,
+    int64_t const* ipiv,
+    std::complex<double>* Bc,
+    size_t batch )
+{
+    internal::getrs_compact( trans, n, nrhs, Ac, ipiv, Bc, batch );
+}
+
+}  // namespace lapack
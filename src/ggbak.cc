@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t ggbak(
     float const* rscale, int64_t m,
     float* V, int64_t ldv )
 {
+    LAPACK_INSTRUMENT( "sggbak", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -38,6 +41,7 @@ int64_t ggbak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         lscale,
@@ -60,6 +64,8 @@ int64_t ggbak(
     double const* rscale, int64_t m,
     double* V, int64_t ldv )
 {
+    LAPACK_INSTRUMENT( "dggbak", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -77,6 +83,7 @@ int64_t ggbak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         lscale,
@@ -99,6 +106,8 @@ int64_t ggbak(
     float const* rscale, int64_t m,
     std::complex<float>* V, int64_t ldv )
 {
+    LAPACK_INSTRUMENT( "cggbak", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -116,6 +125,7 @@ int64_t ggbak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         lscale,
@@ -138,6 +148,8 @@ int64_t ggbak(
     double const* rscale, int64_t m,
     std::complex<double>* V, int64_t ldv )
 {
+    LAPACK_INSTRUMENT( "zggbak", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -155,6 +167,7 @@ int64_t ggbak(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zggbak(
         &balance_, &side_, &n_, &ilo_, &ihi_,
         lscale,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t ggbal(
     float* lscale,
     float* rscale )
 {
+    LAPACK_INSTRUMENT( "sggbal", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -45,6 +48,7 @@ int64_t ggbal(
     // allocate workspace
     lapack::vector< float > work( (lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sggbal(
         &balance_, &n_,
         A, &lda_,
@@ -74,6 +78,8 @@ int64_t ggbal(
     double* lscale,
     double* rscale )
 {
+    LAPACK_INSTRUMENT( "dggbal", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -94,6 +100,7 @@ int64_t ggbal(
     // allocate workspace
     lapack::vector< double > work( (lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dggbal(
         &balance_, &n_,
         A, &lda_,
@@ -123,6 +130,8 @@ int64_t ggbal(
     float* lscale,
     float* rscale )
 {
+    LAPACK_INSTRUMENT( "cggbal", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -143,6 +152,7 @@ int64_t ggbal(
     // allocate workspace
     lapack::vector< float > work( (lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cggbal(
         &balance_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -172,6 +182,8 @@ int64_t ggbal(
     double* lscale,
     double* rscale )
 {
+    LAPACK_INSTRUMENT( "zggbal", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -192,6 +204,7 @@ int64_t ggbal(
     // allocate workspace
     lapack::vector< double > work( (lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zggbal(
         &balance_, &n_,
         (lapack_complex_double*) A, &lda_,
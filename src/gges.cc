@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "WorkSizeCache.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -27,6 +29,136 @@ int64_t gges(
     float* VSL, int64_t ldvsl,
     float* VSR, int64_t ldvsr )
 {
+    LAPACK_INSTRUMENT( "sgges", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gges_work_size( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                    sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                    &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( max( 1, n ) );
+
+    return gges_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                      sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                      work.data(), lwork,
+                      rwork.data(), lrwork,
+                      bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr )
+{
+    LAPACK_INSTRUMENT( "dgges", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gges_work_size( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                    sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                    &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( max( 1, n ) );
+
+    return gges_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                      sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                      work.data(), lwork,
+                      rwork.data(), lrwork,
+                      bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr )
+{
+    LAPACK_INSTRUMENT( "cgges", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gges_work_size( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                    sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                    &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( max( 1, n ) );
+
+    return gges_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                      sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                      work.data(), lwork,
+                      rwork.data(), lrwork,
+                      bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr )
+{
+    LAPACK_INSTRUMENT( "zgges", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gges_work_size( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                    sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                    &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( max( 1, n ) );
+
+    return gges_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb,
+                      sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                      work.data(), lwork,
+                      rwork.data(), lrwork,
+                      bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+void gges_work_size(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "sgges_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -41,17 +173,20 @@ int64_t gges(
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
-    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int sdim_ = 0;
     lapack_int ldvsl_ = (lapack_int) ldvsl;
     lapack_int ldvsr_ = (lapack_int) ldvsr;
     lapack_int info_ = 0;
 
-    // split-complex representation
-    lapack::vector< float > alphar( max( 1, n ) );
-    lapack::vector< float > alphai( max( 1, n ) );
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "sgges", jobvsl_, jobvsr_, sort_, n_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
 
     // query for workspace size
     float qry_work[1];
+    float qry_alphar[1], qry_alphai[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
     LAPACK_sgges(
@@ -59,8 +194,8 @@ int64_t gges(
         select, &n_,
         A, &lda_,
         B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
+        qry_alphar,
+        qry_alphai,
         beta,
         VSL, &ldvsl_,
         VSR, &ldvsr_,
@@ -73,24 +208,67 @@ int64_t gges(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 2*max( 1, n );  // split-complex alphar, alphai
+    internal::work_size_insert( key, *lwork, *lrwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+// -----------------------------------------------------------------------------
+void gges_work_size(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "dgges_work_size", 0, n, 0 );
 
-    LAPACK_sgges(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = 0;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "dgges", jobvsl_, jobvsr_, sort_, n_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
+
+    // query for workspace size
+    double qry_work[1];
+    double qry_alphar[1], qry_alphai[1];
+    lapack_int qry_bwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dgges(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
         A, &lda_,
         B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
+        qry_alphar,
+        qry_alphai,
         beta,
         VSL, &ldvsl_,
         VSR, &ldvsr_,
-        &work[0], &lwork_,
-        &bwork[0], &info_
+        qry_work, &ineg_one,
+        qry_bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -98,26 +276,107 @@ int64_t gges(
     if (info_ < 0) {
         throw Error();
     }
-    *sdim = sdim_;
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        alpha[i] = std::complex<float>( alphar[i], alphai[i] );
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 2*max( 1, n );  // split-complex alphar, alphai
+    internal::work_size_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+void gges_work_size(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "cgges_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
     }
-    return info_;
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = 0;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "cgges", jobvsl_, jobvsr_, sort_, n_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int qry_bwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_cgges(
+        &jobvsl_, &jobvsr_, &sort_,
+        (LAPACK_C_SELECT2) select, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_, &sdim_,
+        (lapack_complex_float*) alpha,
+        (lapack_complex_float*) beta,
+        (lapack_complex_float*) VSL, &ldvsl_,
+        (lapack_complex_float*) VSR, &ldvsr_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 8*n );
+    internal::work_size_insert( key, *lwork, *lrwork );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gges(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
-    lapack_d_select3 select, int64_t n,
-    double* A, int64_t lda,
-    double* B, int64_t ldb,
+/// Queries the workspace sizes needed by `lapack::gges_work`.
+/// Arguments through ldvsr are the same as for `lapack::gges`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @param[out] lrwork
+///     Length of the real array rwork. For real matrices,
+///     rwork holds the split real and imaginary parts
+///     of alpha.
+void gges_work_size(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
     int64_t* sdim,
     std::complex<double>* alpha,
-    double* beta,
-    double* VSL, int64_t ldvsl,
-    double* VSR, int64_t ldvsr )
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    int64_t* lwork, int64_t* lrwork )
 {
+    LAPACK_INSTRUMENT( "zgges_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -132,31 +391,101 @@ int64_t gges(
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
-    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int sdim_ = 0;
     lapack_int ldvsl_ = (lapack_int) ldvsl;
     lapack_int ldvsr_ = (lapack_int) ldvsr;
     lapack_int info_ = 0;
 
-    // split-complex representation
-    lapack::vector< double > alphar( max( 1, n ) );
-    lapack::vector< double > alphai( max( 1, n ) );
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "zgges", jobvsl_, jobvsr_, sort_, n_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork, lrwork ))
+        return;
 
     // query for workspace size
-    double qry_work[1];
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
     lapack_int qry_bwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_dgges(
+    LAPACK_zgges(
+        &jobvsl_, &jobvsr_, &sort_,
+        (LAPACK_Z_SELECT2) select, &n_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) B, &ldb_, &sdim_,
+        (lapack_complex_double*) alpha,
+        (lapack_complex_double*) beta,
+        (lapack_complex_double*) VSL, &ldvsl_,
+        (lapack_complex_double*) VSR, &ldvsr_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork,
+        qry_bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 8*n );
+    internal::work_size_insert( key, *lwork, *lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "sgges_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*max( 1, n ) );
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation, stored in rwork
+    float* alphar = &rwork[ 0 ];
+    float* alphai = &rwork[ max( 1, n ) ];
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgges(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
         A, &lda_,
         B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
+        alphar,
+        alphai,
         beta,
         VSL, &ldvsl_,
         VSR, &ldvsr_,
-        qry_work, &ineg_one,
-        qry_bwork, &info_
+        work, &lwork_,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -164,24 +493,69 @@ int64_t gges(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *sdim = sdim_;
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        alpha[i] = std::complex<float>( alphar[i], alphai[i] );
+    }
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t gges_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "dgges_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*max( 1, n ) );
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    // split-complex representation, stored in rwork
+    double* alphar = &rwork[ 0 ];
+    double* alphai = &rwork[ max( 1, n ) ];
+
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgges(
         &jobvsl_, &jobvsr_, &sort_,
         select, &n_,
         A, &lda_,
         B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
+        alphar,
+        alphai,
         beta,
         VSL, &ldvsl_,
         VSR, &ldvsr_,
-        &work[0], &lwork_,
-        &bwork[0], &info_
+        work, &lwork_,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -198,17 +572,21 @@ int64_t gges(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gges(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
-    lapack_c_select2 select, int64_t n,
+int64_t gges_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_c_select2 select, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb,
     int64_t* sdim,
     std::complex<float>* alpha,
     std::complex<float>* beta,
     std::complex<float>* VSL, int64_t ldvsl,
-    std::complex<float>* VSR, int64_t ldvsr )
+    std::complex<float>* VSR, int64_t ldvsr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* bwork )
 {
+    LAPACK_INSTRUMENT( "cgges_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -216,7 +594,9 @@ int64_t gges(
         lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
+    lapack_error_if( lrwork < max( 1, 8*n ) );
     char jobvsl_ = job2char( jobvsl );
     char jobvsr_ = job2char( jobvsr );
     char sort_ = sort2char( sort );
@@ -226,13 +606,10 @@ int64_t gges(
     lapack_int sdim_ = (lapack_int) *sdim;
     lapack_int ldvsl_ = (lapack_int) ldvsl;
     lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgges(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_C_SELECT2) select, &n_,
@@ -242,35 +619,9 @@ int64_t gges(
         (lapack_complex_float*) beta,
         (lapack_complex_float*) VSL, &ldvsl_,
         (lapack_complex_float*) VSR, &ldvsr_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_bwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (8*n) );
-    lapack::vector< lapack_int > bwork( (n) );
-
-    LAPACK_cgges(
-        &jobvsl_, &jobvsr_, &sort_,
-        (LAPACK_C_SELECT2) select, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_, &sdim_,
-        (lapack_complex_float*) alpha,
-        (lapack_complex_float*) beta,
-        (lapack_complex_float*) VSL, &ldvsl_,
-        (lapack_complex_float*) VSR, &ldvsr_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -283,17 +634,51 @@ int64_t gges(
 }
 
 // -----------------------------------------------------------------------------
-int64_t gges(
-    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
-    lapack_z_select2 select, int64_t n,
+/// Variant of `lapack::gges` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::gges_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ldvsr and the return value are the same as for
+/// `lapack::gges`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::gges_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
+///
+/// @param rwork
+///     The real vector rwork of length lrwork.
+///     For real matrices, rwork holds
+///     the split real and imaginary parts of alpha.
+///
+/// @param[in] lrwork
+///     The length of rwork. For real matrices, lrwork >= 2*max(1, n);
+///     for complex matrices, lrwork >= max(1, 8*n).
+///
+/// @param bwork
+///     The integer vector bwork of length n.
+///     Not referenced if sort = NotSorted.
+int64_t gges_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort, lapack_z_select2 select, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb,
     int64_t* sdim,
     std::complex<double>* alpha,
     std::complex<double>* beta,
     std::complex<double>* VSL, int64_t ldvsl,
-    std::complex<double>* VSR, int64_t ldvsr )
+    std::complex<double>* VSR, int64_t ldvsr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* bwork )
 {
+    LAPACK_INSTRUMENT( "zgges_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -301,7 +686,9 @@ int64_t gges(
         lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
+    lapack_error_if( lrwork < max( 1, 8*n ) );
     char jobvsl_ = job2char( jobvsl );
     char jobvsr_ = job2char( jobvsr );
     char sort_ = sort2char( sort );
@@ -311,39 +698,10 @@ int64_t gges(
     lapack_int sdim_ = (lapack_int) *sdim;
     lapack_int ldvsl_ = (lapack_int) ldvsl;
     lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int qry_bwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zgges(
-        &jobvsl_, &jobvsr_, &sort_,
-        (LAPACK_Z_SELECT2) select, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) B, &ldb_, &sdim_,
-        (lapack_complex_double*) alpha,
-        (lapack_complex_double*) beta,
-        (lapack_complex_double*) VSL, &ldvsl_,
-        (lapack_complex_double*) VSR, &ldvsr_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork,
-        qry_bwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (8*n) );
-    lapack::vector< lapack_int > bwork( (n) );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgges(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_Z_SELECT2) select, &n_,
@@ -353,9 +711,9 @@ int64_t gges(
         (lapack_complex_double*) beta,
         (lapack_complex_double*) VSL, &ldvsl_,
         (lapack_complex_double*) VSR, &ldvsr_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
 
@@ -29,6 +30,129 @@ int64_t gges3(
     float* VSL, int64_t ldvsl,
     float* VSR, int64_t ldvsr )
 {
+    LAPACK_INSTRUMENT( "sgges3", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gges3_work_size( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                     alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                       alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                       work.data(), lwork, rwork.data(), lrwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr )
+{
+    LAPACK_INSTRUMENT( "dgges3", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gges3_work_size( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                     alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                       alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                       work.data(), lwork, rwork.data(), lrwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr )
+{
+    LAPACK_INSTRUMENT( "cgges3", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gges3_work_size( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                     alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                       alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                       work.data(), lwork, rwork.data(), lrwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr )
+{
+    LAPACK_INSTRUMENT( "zgges3", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    gges3_work_size( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                     alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return gges3_work( jobvsl, jobvsr, sort, select, n, A, lda, B, ldb, sdim,
+                       alpha, beta, VSL, ldvsl, VSR, ldvsr,
+                       work.data(), lwork, rwork.data(), lrwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+void gges3_work_size(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "sgges3_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -75,41 +199,12 @@ int64_t gges3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
-
-    LAPACK_sgges3(
-        &jobvsl_, &jobvsr_, &sort_,
-        select, &n_,
-        A, &lda_,
-        B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
-        beta,
-        VSL, &ldvsl_,
-        VSR, &ldvsr_,
-        &work[0], &lwork_,
-        &bwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *sdim = sdim_;
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        alpha[i] = std::complex<float>( alphar[i], alphai[i] );
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
 }
 
 // -----------------------------------------------------------------------------
-int64_t gges3(
+void gges3_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_d_select3 select, int64_t n,
     double* A, int64_t lda,
@@ -118,8 +213,11 @@ int64_t gges3(
     std::complex<double>* alpha,
     double* beta,
     double* VSL, int64_t ldvsl,
-    double* VSR, int64_t ldvsr )
+    double* VSR, int64_t ldvsr,
+    int64_t* lwork, int64_t* lrwork )
 {
+    LAPACK_INSTRUMENT( "dgges3_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -166,41 +264,12 @@ int64_t gges3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
-
-    LAPACK_dgges3(
-        &jobvsl_, &jobvsr_, &sort_,
-        select, &n_,
-        A, &lda_,
-        B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
-        beta,
-        VSL, &ldvsl_,
-        VSR, &ldvsr_,
-        &work[0], &lwork_,
-        &bwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *sdim = sdim_;
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        alpha[i] = std::complex<double>( alphar[i], alphai[i] );
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
 }
 
 // -----------------------------------------------------------------------------
-int64_t gges3(
+void gges3_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_c_select2 select, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -209,8 +278,11 @@ int64_t gges3(
     std::complex<float>* alpha,
     std::complex<float>* beta,
     std::complex<float>* VSL, int64_t ldvsl,
-    std::complex<float>* VSR, int64_t ldvsr )
+    std::complex<float>* VSR, int64_t ldvsr,
+    int64_t* lwork, int64_t* lrwork )
 {
+    LAPACK_INSTRUMENT( "cgges3_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -254,38 +326,12 @@ int64_t gges3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (8*n) );
-    lapack::vector< lapack_int > bwork( (n) );
-
-    LAPACK_cgges3(
-        &jobvsl_, &jobvsr_, &sort_,
-        (LAPACK_C_SELECT2) select, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_, &sdim_,
-        (lapack_complex_float*) alpha,
-        (lapack_complex_float*) beta,
-        (lapack_complex_float*) VSL, &ldvsl_,
-        (lapack_complex_float*) VSR, &ldvsr_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *sdim = sdim_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 8*n );
 }
 
 // -----------------------------------------------------------------------------
-int64_t gges3(
+void gges3_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_z_select2 select, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -294,8 +340,11 @@ int64_t gges3(
     std::complex<double>* alpha,
     std::complex<double>* beta,
     std::complex<double>* VSL, int64_t ldvsl,
-    std::complex<double>* VSR, int64_t ldvsr )
+    std::complex<double>* VSR, int64_t ldvsr,
+    int64_t* lwork, int64_t* lrwork )
 {
+    LAPACK_INSTRUMENT( "zgges3_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -339,13 +388,253 @@ int64_t gges3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 8*n );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (8*n) );
-    lapack::vector< lapack_int > bwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t gges3_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "sgges3_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > alphar( max( 1, n ) );
+    lapack::vector< float > alphai( max( 1, n ) );
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgges3(
+        &jobvsl_, &jobvsr_, &sort_,
+        select, &n_,
+        A, &lda_,
+        B, &ldb_, &sdim_,
+        &alphar[0],
+        &alphai[0],
+        beta,
+        VSL, &ldvsl_,
+        VSR, &ldvsr_,
+        work, &lwork_,
+        bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *sdim = sdim_;
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        alpha[i] = std::complex<float>( alphar[i], alphai[i] );
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "dgges3_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > alphar( max( 1, n ) );
+    lapack::vector< double > alphai( max( 1, n ) );
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgges3(
+        &jobvsl_, &jobvsr_, &sort_,
+        select, &n_,
+        A, &lda_,
+        B, &ldb_, &sdim_,
+        &alphar[0],
+        &alphai[0],
+        beta,
+        VSL, &ldvsl_,
+        VSR, &ldvsr_,
+        work, &lwork_,
+        bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *sdim = sdim_;
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        alpha[i] = std::complex<double>( alphar[i], alphai[i] );
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "cgges3_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 8*n );
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgges3(
+        &jobvsl_, &jobvsr_, &sort_,
+        (LAPACK_C_SELECT2) select, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_, &sdim_,
+        (lapack_complex_float*) alpha,
+        (lapack_complex_float*) beta,
+        (lapack_complex_float*) VSL, &ldvsl_,
+        (lapack_complex_float*) VSR, &ldvsr_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *sdim = sdim_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t gges3_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "zgges3_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 8*n );
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgges3(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_Z_SELECT2) select, &n_,
@@ -355,9 +644,9 @@ int64_t gges3(
         (lapack_complex_double*) beta,
         (lapack_complex_double*) VSL, &ldvsl_,
         (lapack_complex_double*) VSR, &ldvsr_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &bwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -29,6 +30,149 @@ int64_t ggesx(
     float* rconde,
     float* rcondv )
 {
+    LAPACK_INSTRUMENT( "sggesx", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggesx_work_size( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                     sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                     &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                       sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde,
+                       rcondv,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv )
+{
+    LAPACK_INSTRUMENT( "dggesx", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggesx_work_size( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                     sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                     &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                       sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde,
+                       rcondv,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv )
+{
+    LAPACK_INSTRUMENT( "cggesx", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggesx_work_size( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                     sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                     &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                       sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde,
+                       rcondv,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv )
+{
+    LAPACK_INSTRUMENT( "zggesx", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggesx_work_size( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                     sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde, rcondv,
+                     &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+    lapack::vector< lapack_int > bwork( n );
+
+    return ggesx_work( jobvsl, jobvsr, sort, select, sense, n, A, lda, B, ldb,
+                       sdim, alpha, beta, VSL, ldvsl, VSR, ldvsr, rconde,
+                       rcondv,
+                       work.data(), lwork, rwork.data(), lrwork,
+                       iwork.data(), liwork, bwork.data() );
+}
+
+// -----------------------------------------------------------------------------
+void ggesx_work_size(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "sggesx_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -80,46 +224,13 @@ int64_t ggesx(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
-
-    LAPACK_sggesx(
-        &jobvsl_, &jobvsr_, &sort_,
-        select, &sense_, &n_,
-        A, &lda_,
-        B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
-        beta,
-        VSL, &ldvsl_,
-        VSR, &ldvsr_,
-        rconde,
-        rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *sdim = sdim_;
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        alpha[i] = std::complex<double>( alphar[i], alphai[i] );
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+    *liwork = max( 1, int64_t( qry_iwork[0] ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggesx(
+void ggesx_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_d_select3 select, lapack::Sense sense, int64_t n,
     double* A, int64_t lda,
@@ -130,8 +241,11 @@ int64_t ggesx(
     double* VSL, int64_t ldvsl,
     double* VSR, int64_t ldvsr,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "dggesx_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -183,46 +297,13 @@ int64_t ggesx(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
-
-    LAPACK_dggesx(
-        &jobvsl_, &jobvsr_, &sort_,
-        select, &sense_, &n_,
-        A, &lda_,
-        B, &ldb_, &sdim_,
-        &alphar[0],
-        &alphai[0],
-        beta,
-        VSL, &ldvsl_,
-        VSR, &ldvsr_,
-        rconde,
-        rcondv,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *sdim = sdim_;
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        alpha[i] = std::complex<float>( alphar[i], alphai[i] );
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+    *liwork = max( 1, int64_t( qry_iwork[0] ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggesx(
+void ggesx_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_c_select2 select, lapack::Sense sense, int64_t n,
     std::complex<float>* A, int64_t lda,
@@ -233,8 +314,11 @@ int64_t ggesx(
     std::complex<float>* VSL, int64_t ldvsl,
     std::complex<float>* VSR, int64_t ldvsr,
     float* rconde,
-    float* rcondv )
+    float* rcondv,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "cggesx_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -283,43 +367,13 @@ int64_t ggesx(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (8*n) );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
-
-    LAPACK_cggesx(
-        &jobvsl_, &jobvsr_, &sort_,
-        (LAPACK_C_SELECT2) select, &sense_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_, &sdim_,
-        (lapack_complex_float*) alpha,
-        (lapack_complex_float*) beta,
-        (lapack_complex_float*) VSL, &ldvsl_,
-        (lapack_complex_float*) VSR, &ldvsr_,
-        rconde,
-        rcondv,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *sdim = sdim_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 8*n );
+    *liwork = max( 1, int64_t( qry_iwork[0] ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggesx(
+void ggesx_work_size(
     lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
     lapack_z_select2 select, lapack::Sense sense, int64_t n,
     std::complex<double>* A, int64_t lda,
@@ -330,8 +384,11 @@ int64_t ggesx(
     std::complex<double>* VSL, int64_t ldvsl,
     std::complex<double>* VSR, int64_t ldvsr,
     double* rconde,
-    double* rcondv )
+    double* rcondv,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "zggesx_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -380,15 +437,287 @@ int64_t ggesx(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 8*n );
+    *liwork = max( 1, int64_t( qry_iwork[0] ) );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (8*n) );
-    lapack::vector< lapack_int > iwork( liwork_ );
-    lapack::vector< lapack_int > bwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t ggesx_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_s_select3 select, lapack::Sense sense, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    float* beta,
+    float* VSL, int64_t ldvsl,
+    float* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "sggesx_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    char sense_ = sense2char( sense );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > alphar( max( 1, n ) );
+    lapack::vector< float > alphai( max( 1, n ) );
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sggesx(
+        &jobvsl_, &jobvsr_, &sort_,
+        select, &sense_, &n_,
+        A, &lda_,
+        B, &ldb_, &sdim_,
+        &alphar[0],
+        &alphai[0],
+        beta,
+        VSL, &ldvsl_,
+        VSR, &ldvsr_,
+        rconde,
+        rcondv,
+        work, &lwork_,
+        iwork, &liwork_,
+        bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *sdim = sdim_;
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        alpha[i] = std::complex<double>( alphar[i], alphai[i] );
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_d_select3 select, lapack::Sense sense, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    double* beta,
+    double* VSL, int64_t ldvsl,
+    double* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "dggesx_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    char sense_ = sense2char( sense );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > alphar( max( 1, n ) );
+    lapack::vector< double > alphai( max( 1, n ) );
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dggesx(
+        &jobvsl_, &jobvsr_, &sort_,
+        select, &sense_, &n_,
+        A, &lda_,
+        B, &ldb_, &sdim_,
+        &alphar[0],
+        &alphai[0],
+        beta,
+        VSL, &ldvsl_,
+        VSR, &ldvsr_,
+        rconde,
+        rcondv,
+        work, &lwork_,
+        iwork, &liwork_,
+        bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *sdim = sdim_;
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        alpha[i] = std::complex<float>( alphar[i], alphai[i] );
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_c_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* VSL, int64_t ldvsl,
+    std::complex<float>* VSR, int64_t ldvsr,
+    float* rconde,
+    float* rcondv,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "cggesx_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 8*n );
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    char sense_ = sense2char( sense );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cggesx(
+        &jobvsl_, &jobvsr_, &sort_,
+        (LAPACK_C_SELECT2) select, &sense_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_, &sdim_,
+        (lapack_complex_float*) alpha,
+        (lapack_complex_float*) beta,
+        (lapack_complex_float*) VSL, &ldvsl_,
+        (lapack_complex_float*) VSR, &ldvsr_,
+        rconde,
+        rcondv,
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &liwork_,
+        bwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *sdim = sdim_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggesx_work(
+    lapack::Job jobvsl, lapack::Job jobvsr, lapack::Sort sort,
+    lapack_z_select2 select, lapack::Sense sense, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* sdim,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* VSL, int64_t ldvsl,
+    std::complex<double>* VSR, int64_t ldvsr,
+    double* rconde,
+    double* rcondv,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork,
+    lapack_int* bwork )
+{
+    LAPACK_INSTRUMENT( "zggesx_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvsr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 8*n );
+    char jobvsl_ = job2char( jobvsl );
+    char jobvsr_ = job2char( jobvsr );
+    char sort_ = sort2char( sort );
+    char sense_ = sense2char( sense );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int ldvsl_ = (lapack_int) ldvsl;
+    lapack_int ldvsr_ = (lapack_int) ldvsr;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zggesx(
         &jobvsl_, &jobvsr_, &sort_,
         (LAPACK_Z_SELECT2) select, &sense_, &n_,
@@ -400,10 +729,10 @@ int64_t ggesx(
         (lapack_complex_double*) VSR, &ldvsr_,
         rconde,
         rcondv,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &liwork_,
-        &bwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &liwork_,
+        bwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1, 1
         #endif
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t gghrd(
     float* Q, int64_t ldq,
     float* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "sgghrd", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -43,6 +46,7 @@ int64_t gghrd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
         A, &lda_,
@@ -67,6 +71,8 @@ int64_t gghrd(
     double* Q, int64_t ldq,
     double* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "dgghrd", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -88,6 +94,7 @@ int64_t gghrd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
         A, &lda_,
@@ -112,6 +119,8 @@ int64_t gghrd(
     std::complex<float>* Q, int64_t ldq,
     std::complex<float>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "cgghrd", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -133,6 +142,7 @@ int64_t gghrd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_float*) A, &lda_,
@@ -157,6 +167,8 @@ int64_t gghrd(
     std::complex<double>* Q, int64_t ldq,
     std::complex<double>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "zgghrd", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -178,6 +190,7 @@ int64_t gghrd(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgghrd(
         &compq_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,97 @@ int64_t ggqrf(
     float* B, int64_t ldb,
     float* taub )
 {
+    LAPACK_INSTRUMENT( "sggqrf", m, n, p );
+
+    // query for workspace size
+    int64_t lwork;
+    ggqrf_work_size( n, m, p, A, lda, taua, B, ldb, taub,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub )
+{
+    LAPACK_INSTRUMENT( "dggqrf", m, n, p );
+
+    // query for workspace size
+    int64_t lwork;
+    ggqrf_work_size( n, m, p, A, lda, taua, B, ldb, taub,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub )
+{
+    LAPACK_INSTRUMENT( "cggqrf", m, n, p );
+
+    // query for workspace size
+    int64_t lwork;
+    ggqrf_work_size( n, m, p, A, lda, taua, B, ldb, taub,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub )
+{
+    LAPACK_INSTRUMENT( "zggqrf", m, n, p );
+
+    // query for workspace size
+    int64_t lwork;
+    ggqrf_work_size( n, m, p, A, lda, taua, B, ldb, taub,
+                     &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return ggqrf_work( n, m, p, A, lda, taua, B, ldb, taub,
+                       work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggqrf_work_size(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "sggqrf_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -51,32 +143,20 @@ int64_t ggqrf(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-
-    LAPACK_sggqrf(
-        &n_, &m_, &p_,
-        A, &lda_,
-        taua,
-        B, &ldb_,
-        taub,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggqrf(
+void ggqrf_work_size(
     int64_t n, int64_t m, int64_t p,
     double* A, int64_t lda,
     double* taua,
     double* B, int64_t ldb,
-    double* taub )
+    double* taub,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "dggqrf_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -105,32 +185,20 @@ int64_t ggqrf(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-
-    LAPACK_dggqrf(
-        &n_, &m_, &p_,
-        A, &lda_,
-        taua,
-        B, &ldb_,
-        taub,
-        &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggqrf(
+void ggqrf_work_size(
     int64_t n, int64_t m, int64_t p,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* taua,
     std::complex<float>* B, int64_t ldb,
-    std::complex<float>* taub )
+    std::complex<float>* taub,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "cggqrf_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -159,32 +227,20 @@ int64_t ggqrf(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-
-    LAPACK_cggqrf(
-        &n_, &m_, &p_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) taua,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) taub,
-        (lapack_complex_float*) &work[0], &lwork_, &info_ );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggqrf(
+void ggqrf_work_size(
     int64_t n, int64_t m, int64_t p,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* taua,
     std::complex<double>* B, int64_t ldb,
-    std::complex<double>* taub )
+    std::complex<double>* taub,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "zggqrf_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -213,18 +269,171 @@ int64_t ggqrf(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t ggqrf_work(
+    int64_t n, int64_t m, int64_t p,
+    float* A, int64_t lda,
+    float* taua,
+    float* B, int64_t ldb,
+    float* taub,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "sggqrf_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sggqrf(
+        &n_, &m_, &p_,
+        A, &lda_,
+        taua,
+        B, &ldb_,
+        taub,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf_work(
+    int64_t n, int64_t m, int64_t p,
+    double* A, int64_t lda,
+    double* taua,
+    double* B, int64_t ldb,
+    double* taub,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dggqrf_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dggqrf(
+        &n_, &m_, &p_,
+        A, &lda_,
+        taua,
+        B, &ldb_,
+        taub,
+        work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf_work(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* taua,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* taub,
+    std::complex<float>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "cggqrf_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cggqrf(
+        &n_, &m_, &p_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) taua,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) taub,
+        (lapack_complex_float*) work, &lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggqrf_work(
+    int64_t n, int64_t m, int64_t p,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* taua,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* taub,
+    std::complex<double>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "zggqrf_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zggqrf(
         &n_, &m_, &p_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) taua,
         (lapack_complex_double*) B, &ldb_,
         (lapack_complex_double*) taub,
-        (lapack_complex_double*) &work[0], &lwork_, &info_ );
+        (lapack_complex_double*) work, &lwork_, &info_ );
     if (info_ < 0) {
         throw Error();
     }
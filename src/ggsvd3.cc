@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30600  // >= 3.6
 
@@ -30,6 +31,137 @@ int64_t ggsvd3(
     float* V, int64_t ldv,
     float* Q, int64_t ldq )
 {
+    LAPACK_INSTRUMENT( "sggsvd3", m, n, p );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggsvd3_work_size( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                      beta, U, ldu, V, ldv, Q, ldq,
+                      &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                        beta, U, ldu, V, ldv, Q, ldq,
+                        work.data(), lwork, rwork.data(), lrwork,
+                        iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq )
+{
+    LAPACK_INSTRUMENT( "dggsvd3", m, n, p );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggsvd3_work_size( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                      beta, U, ldu, V, ldv, Q, ldq,
+                      &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                        beta, U, ldu, V, ldv, Q, ldq,
+                        work.data(), lwork, rwork.data(), lrwork,
+                        iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq )
+{
+    LAPACK_INSTRUMENT( "cggsvd3", m, n, p );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggsvd3_work_size( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                      beta, U, ldu, V, ldv, Q, ldq,
+                      &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                        beta, U, ldu, V, ldv, Q, ldq,
+                        work.data(), lwork, rwork.data(), lrwork,
+                        iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq )
+{
+    LAPACK_INSTRUMENT( "zggsvd3", m, n, p );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggsvd3_work_size( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                      beta, U, ldu, V, ldv, Q, ldq,
+                      &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvd3_work( jobu, jobv, jobq, m, n, p, k, l, A, lda, B, ldb, alpha,
+                        beta, U, ldu, V, ldv, Q, ldq,
+                        work.data(), lwork, rwork.data(), lrwork,
+                        iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggsvd3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "sggsvd3_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -78,37 +210,13 @@ int64_t ggsvd3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
-
-    LAPACK_sggsvd3(
-        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
-        A, &lda_,
-        B, &ldb_,
-        alpha,
-        beta,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+    *liwork = max( 1, n );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+void ggsvd3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -118,8 +226,11 @@ int64_t ggsvd3(
     double* beta,
     double* U, int64_t ldu,
     double* V, int64_t ldv,
-    double* Q, int64_t ldq )
+    double* Q, int64_t ldq,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "dggsvd3_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -168,37 +279,13 @@ int64_t ggsvd3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (n) );
-
-    LAPACK_dggsvd3(
-        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
-        A, &lda_,
-        B, &ldb_,
-        alpha,
-        beta,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+    *liwork = max( 1, n );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+void ggsvd3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -208,8 +295,11 @@ int64_t ggsvd3(
     float* beta,
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* V, int64_t ldv,
-    std::complex<float>* Q, int64_t ldq )
+    std::complex<float>* Q, int64_t ldq,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "cggsvd3_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -260,39 +350,13 @@ int64_t ggsvd3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (2*n) );
-    lapack::vector< lapack_int > iwork( (n) );
-
-    LAPACK_cggsvd3(
-        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        alpha,
-        beta,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) V, &ldv_,
-        (lapack_complex_float*) Q, &ldq_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 2*n );
+    *liwork = max( 1, n );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvd3(
+void ggsvd3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
     int64_t* k,
     int64_t* l,
@@ -302,8 +366,11 @@ int64_t ggsvd3(
     double* beta,
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* V, int64_t ldv,
-    std::complex<double>* Q, int64_t ldq )
+    std::complex<double>* Q, int64_t ldq,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "zggsvd3_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -354,13 +421,275 @@ int64_t ggsvd3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 2*n );
+    *liwork = max( 1, n );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (2*n) );
-    lapack::vector< lapack_int > iwork( (n) );
+// -----------------------------------------------------------------------------
+int64_t ggsvd3_work(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "sggsvd3_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < n );
+    char jobu_ = jobu2char( jobu );
+    char jobv_ = job2char( jobv );
+    char jobq_ = jobq2char( jobq );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int k_ = (lapack_int) *k;
+    lapack_int l_ = (lapack_int) *l;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldv_ = (lapack_int) ldv;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sggsvd3(
+        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
+        A, &lda_,
+        B, &ldb_,
+        alpha,
+        beta,
+        U, &ldu_,
+        V, &ldv_,
+        Q, &ldq_,
+        work, &lwork_,
+        iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3_work(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "dggsvd3_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < n );
+    char jobu_ = jobu2char( jobu );
+    char jobv_ = job2char( jobv );
+    char jobq_ = jobq2char( jobq );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int k_ = (lapack_int) *k;
+    lapack_int l_ = (lapack_int) *l;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldv_ = (lapack_int) ldv;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dggsvd3(
+        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
+        A, &lda_,
+        B, &ldb_,
+        alpha,
+        beta,
+        U, &ldu_,
+        V, &ldv_,
+        Q, &ldq_,
+        work, &lwork_,
+        iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3_work(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    float* alpha,
+    float* beta,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "cggsvd3_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    lapack_error_if( liwork < n );
+    char jobu_ = jobu2char( jobu );
+    char jobv_ = job2char( jobv );
+    char jobq_ = jobq2char( jobq );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int k_ = (lapack_int) *k;
+    lapack_int l_ = (lapack_int) *l;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldv_ = (lapack_int) ldv;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cggsvd3(
+        &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        alpha,
+        beta,
+        (lapack_complex_float*) U, &ldu_,
+        (lapack_complex_float*) V, &ldv_,
+        (lapack_complex_float*) Q, &ldq_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork,
+        iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvd3_work(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t n, int64_t p,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    double* alpha,
+    double* beta,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "zggsvd3_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    lapack_error_if( liwork < n );
+    char jobu_ = jobu2char( jobu );
+    char jobv_ = job2char( jobv );
+    char jobq_ = jobq2char( jobq );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int k_ = (lapack_int) *k;
+    lapack_int l_ = (lapack_int) *l;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldv_ = (lapack_int) ldv;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zggsvd3(
         &jobu_, &jobv_, &jobq_, &m_, &n_, &p_, &k_, &l_,
         (lapack_complex_double*) A, &lda_,
@@ -370,9 +699,9 @@ int64_t ggsvd3(
         (lapack_complex_double*) U, &ldu_,
         (lapack_complex_double*) V, &ldv_,
         (lapack_complex_double*) Q, &ldq_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0],
-        &iwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork,
+        iwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
 
@@ -29,6 +30,133 @@ int64_t ggsvp3(
     float* Q, int64_t ldq,
     float* tau )
 {
+    LAPACK_INSTRUMENT( "sggsvp3", m, n, p );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggsvp3_work_size( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k,
+                      l, U, ldu, V, ldv, Q, ldq, tau,
+                      &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb,
+                        k, l, U, ldu, V, ldv, Q, ldq, tau,
+                        work.data(), lwork, rwork.data(), lrwork,
+                        iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau )
+{
+    LAPACK_INSTRUMENT( "dggsvp3", m, n, p );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggsvp3_work_size( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k,
+                      l, U, ldu, V, ldv, Q, ldq, tau,
+                      &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb,
+                        k, l, U, ldu, V, ldv, Q, ldq, tau,
+                        work.data(), lwork, rwork.data(), lrwork,
+                        iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau )
+{
+    LAPACK_INSTRUMENT( "cggsvp3", m, n, p );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggsvp3_work_size( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k,
+                      l, U, ldu, V, ldv, Q, ldq, tau,
+                      &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb,
+                        k, l, U, ldu, V, ldv, Q, ldq, tau,
+                        work.data(), lwork, rwork.data(), lrwork,
+                        iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau )
+{
+    LAPACK_INSTRUMENT( "zggsvp3", m, n, p );
+
+    // query for workspace size
+    int64_t lwork, lrwork, liwork;
+    ggsvp3_work_size( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb, k,
+                      l, U, ldu, V, ldv, Q, ldq, tau,
+                      &lwork, &lrwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return ggsvp3_work( jobu, jobv, jobq, m, p, n, A, lda, B, ldb, tola, tolb,
+                        k, l, U, ldu, V, ldv, Q, ldq, tau,
+                        work.data(), lwork, rwork.data(), lrwork,
+                        iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+void ggsvp3_work_size(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "sggsvp3_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -76,36 +204,13 @@ int64_t ggsvp3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< float > work( lwork_ );
-
-    LAPACK_sggsvp3(
-        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
-        A, &lda_,
-        B, &ldb_, &tola, &tolb, &k_, &l_,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        &iwork[0],
-        tau,
-        &work[0], &lwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+    *liwork = max( 1, n );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
+void ggsvp3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
     double* A, int64_t lda,
     double* B, int64_t ldb, double tola, double tolb,
@@ -114,8 +219,11 @@ int64_t ggsvp3(
     double* U, int64_t ldu,
     double* V, int64_t ldv,
     double* Q, int64_t ldq,
-    double* tau )
+    double* tau,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "dggsvp3_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -163,36 +271,13 @@ int64_t ggsvp3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< double > work( lwork_ );
-
-    LAPACK_dggsvp3(
-        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
-        A, &lda_,
-        B, &ldb_, &tola, &tolb, &k_, &l_,
-        U, &ldu_,
-        V, &ldv_,
-        Q, &ldq_,
-        &iwork[0],
-        tau,
-        &work[0], &lwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+    *liwork = max( 1, n );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
+void ggsvp3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb, float tola, float tolb,
@@ -201,8 +286,11 @@ int64_t ggsvp3(
     std::complex<float>* U, int64_t ldu,
     std::complex<float>* V, int64_t ldv,
     std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* tau )
+    std::complex<float>* tau,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "cggsvp3_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -252,38 +340,13 @@ int64_t ggsvp3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< float > rwork( (2*n) );
-    lapack::vector< std::complex<float> > work( lwork_ );
-
-    LAPACK_cggsvp3(
-        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_, &tola, &tolb, &k_, &l_,
-        (lapack_complex_float*) U, &ldu_,
-        (lapack_complex_float*) V, &ldv_,
-        (lapack_complex_float*) Q, &ldq_,
-        &iwork[0],
-        &rwork[0],
-        (lapack_complex_float*) tau,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *k = k_;
-    *l = l_;
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 2*n );
+    *liwork = max( 1, n );
 }
 
 // -----------------------------------------------------------------------------
-int64_t ggsvp3(
+void ggsvp3_work_size(
     lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb, double tola, double tolb,
@@ -292,8 +355,11 @@ int64_t ggsvp3(
     std::complex<double>* U, int64_t ldu,
     std::complex<double>* V, int64_t ldv,
     std::complex<double>* Q, int64_t ldq,
-    std::complex<double>* tau )
+    std::complex<double>* tau,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "zggsvp3_work_size", m, n, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -343,13 +409,268 @@ int64_t ggsvp3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, 2*n );
+    *liwork = max( 1, n );
+}
 
-    // allocate workspace
-    lapack::vector< lapack_int > iwork( (n) );
-    lapack::vector< double > rwork( (2*n) );
-    lapack::vector< std::complex<double> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t ggsvp3_work(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    float* U, int64_t ldu,
+    float* V, int64_t ldv,
+    float* Q, int64_t ldq,
+    float* tau,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "sggsvp3_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < n );
+    char jobu_ = jobu2char( jobu );
+    char jobv_ = job2char( jobv );
+    char jobq_ = jobq2char( jobq );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int k_ = (lapack_int) *k;
+    lapack_int l_ = (lapack_int) *l;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldv_ = (lapack_int) ldv;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sggsvp3(
+        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
+        A, &lda_,
+        B, &ldb_, &tola, &tolb, &k_, &l_,
+        U, &ldu_,
+        V, &ldv_,
+        Q, &ldq_,
+        iwork,
+        tau,
+        work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3_work(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    double* U, int64_t ldu,
+    double* V, int64_t ldv,
+    double* Q, int64_t ldq,
+    double* tau,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "dggsvp3_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < n );
+    char jobu_ = jobu2char( jobu );
+    char jobv_ = job2char( jobv );
+    char jobq_ = jobq2char( jobq );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int k_ = (lapack_int) *k;
+    lapack_int l_ = (lapack_int) *l;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldv_ = (lapack_int) ldv;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dggsvp3(
+        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
+        A, &lda_,
+        B, &ldb_, &tola, &tolb, &k_, &l_,
+        U, &ldu_,
+        V, &ldv_,
+        Q, &ldq_,
+        iwork,
+        tau,
+        work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3_work(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb, float tola, float tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<float>* U, int64_t ldu,
+    std::complex<float>* V, int64_t ldv,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* tau,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "cggsvp3_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    lapack_error_if( liwork < n );
+    char jobu_ = jobu2char( jobu );
+    char jobv_ = job2char( jobv );
+    char jobq_ = jobq2char( jobq );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int k_ = (lapack_int) *k;
+    lapack_int l_ = (lapack_int) *l;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldv_ = (lapack_int) ldv;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cggsvp3(
+        &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_, &tola, &tolb, &k_, &l_,
+        (lapack_complex_float*) U, &ldu_,
+        (lapack_complex_float*) V, &ldv_,
+        (lapack_complex_float*) Q, &ldq_,
+        iwork,
+        rwork,
+        (lapack_complex_float*) tau,
+        (lapack_complex_float*) work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *k = k_;
+    *l = l_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t ggsvp3_work(
+    lapack::Job jobu, lapack::Job jobv, lapack::Job jobq, int64_t m, int64_t p, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb, double tola, double tolb,
+    int64_t* k,
+    int64_t* l,
+    std::complex<double>* U, int64_t ldu,
+    std::complex<double>* V, int64_t ldv,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* tau,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "zggsvp3_work", m, n, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( lrwork < 2*n );
+    lapack_error_if( liwork < n );
+    char jobu_ = jobu2char( jobu );
+    char jobv_ = job2char( jobv );
+    char jobq_ = jobq2char( jobq );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int k_ = (lapack_int) *k;
+    lapack_int l_ = (lapack_int) *l;
+    lapack_int ldu_ = (lapack_int) ldu;
+    lapack_int ldv_ = (lapack_int) ldv;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zggsvp3(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -357,10 +678,10 @@ int64_t ggsvp3(
         (lapack_complex_double*) U, &ldu_,
         (lapack_complex_double*) V, &ldv_,
         (lapack_complex_double*) Q, &ldq_,
-        &iwork[0],
-        &rwork[0],
+        iwork,
+        rwork,
         (lapack_complex_double*) tau,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
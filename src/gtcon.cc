@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -26,6 +27,8 @@ int64_t gtcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "sgtcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -34,7 +37,8 @@ int64_t gtcon(
     lapack_int n_ = (lapack_int) n;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -45,6 +49,7 @@ int64_t gtcon(
     lapack::vector< float > work( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgtcon(
         &norm_, &n_,
         DL,
@@ -75,6 +80,8 @@ int64_t gtcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "dgtcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -83,7 +90,8 @@ int64_t gtcon(
     lapack_int n_ = (lapack_int) n;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -94,6 +102,7 @@ int64_t gtcon(
     lapack::vector< double > work( (2*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgtcon(
         &norm_, &n_,
         DL,
@@ -124,6 +133,8 @@ int64_t gtcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "cgtcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -132,7 +143,8 @@ int64_t gtcon(
     lapack_int n_ = (lapack_int) n;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -142,6 +154,7 @@ int64_t gtcon(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgtcon(
         &norm_, &n_,
         (lapack_complex_float*) DL,
@@ -227,6 +240,8 @@ int64_t gtcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "zgtcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -235,7 +250,8 @@ int64_t gtcon(
     lapack_int n_ = (lapack_int) n;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -245,6 +261,7 @@ int64_t gtcon(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgtcon(
         &norm_, &n_,
         (lapack_complex_double*) DL,
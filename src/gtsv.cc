@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t gtsv(
     float* DU,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "sgtsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -34,6 +37,7 @@ int64_t gtsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgtsv(
         &n_, &nrhs_,
         DL,
@@ -55,6 +59,8 @@ int64_t gtsv(
     double* DU,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dgtsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -66,6 +72,7 @@ int64_t gtsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgtsv(
         &n_, &nrhs_,
         DL,
@@ -87,6 +94,8 @@ int64_t gtsv(
     std::complex<float>* DU,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "cgtsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -98,6 +107,7 @@ int64_t gtsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgtsv(
         &n_, &nrhs_,
         (lapack_complex_float*) DL,
@@ -170,6 +180,8 @@ int64_t gtsv(
     std::complex<double>* DU,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zgtsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -181,6 +193,7 @@ int64_t gtsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgtsv(
         &n_, &nrhs_,
         (lapack_complex_double*) DL,
@@ -0,0 +1,215 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "NoConstructAllocator.hh"
+#include "Batch.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Strided gtsv_batch. Each group of w systems is packed into compact format
+// in per-thread workspace, solved with gtsv_compact_group, and unpacked.
+template <typename scalar_t>
+void gtsv_batch(
+    int64_t n, int64_t nrhs,
+    scalar_t* DL, int64_t strideDL,
+    scalar_t* D,  int64_t strideD,
+    scalar_t* DU, int64_t strideDU,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch > 1 && strideDL < n-1 );
+    lapack_error_if( batch > 1 && strideD  < n );
+    lapack_error_if( batch > 1 && strideDU < n-1 );
+    lapack_error_if( batch > 1 && strideB  < ldb*nrhs );
+
+    const int64_t w = compact_width< scalar_t >();
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    int64_t n1 = max( n-1, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    // per-thread compact DL, D, DU, B for one group
+    int64_t lwork = (n1 + n + n1 + n*nrhs)*w;
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        int64_t i = g*w;
+        int64_t lanes = min( w, int64_t( batch ) - i );
+        scalar_t* DLg = work.data() + batch_thread_num() * lwork;
+        scalar_t* Dg  = DLg + n1*w;
+        scalar_t* DUg = Dg  + n*w;
+        scalar_t* Bg  = DUg + n1*w;
+
+        // padding systems are the identity
+        pack_strided_group( n1, 1, &DL[ i*strideDL ], n1, strideDL,
+                            lanes, w, zero, DLg );
+        pack_strided_group( n, 1, &D[ i*strideD ], n, strideD,
+                            lanes, w, one, Dg );
+        pack_strided_group( n1, 1, &DU[ i*strideDU ], n1, strideDU,
+                            lanes, w, zero, DUg );
+        pack_strided_group( n, nrhs, &B[ i*strideB ], ldb, strideB,
+                            lanes, w, zero, Bg );
+
+        int64_t info_g[ w ];
+        gtsv_compact_group( n, nrhs, DLg, Dg, DUg, Bg, info_g );
+
+        unpack_strided_group( n1, 1, DLg, lanes, w,
+                              &DL[ i*strideDL ], n1, strideDL );
+        unpack_strided_group( n, 1, Dg, lanes, w, &D[ i*strideD ], n, strideD );
+        unpack_strided_group( n1, 1, DUg, lanes, w,
+                              &DU[ i*strideDU ], n1, strideDU );
+        unpack_strided_group( n, nrhs, Bg, lanes, w,
+                              &B[ i*strideB ], ldb, strideB );
+        std::copy( info_g, info_g + lanes, &info[ i ] );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv
+void gtsv_batch(
+    int64_t n, int64_t nrhs,
+    float* DL, int64_t strideDL,
+    float* D,  int64_t strideD,
+    float* DU, int64_t strideDU,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gtsv_batch( n, nrhs, DL, strideDL, D, strideD, DU, strideDU,
+                          B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv
+void gtsv_batch(
+    int64_t n, int64_t nrhs,
+    double* DL, int64_t strideDL,
+    double* D,  int64_t strideD,
+    double* DU, int64_t strideDU,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gtsv_batch( n, nrhs, DL, strideDL, D, strideD, DU, strideDU,
+                          B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv
+void gtsv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DL, int64_t strideDL,
+    std::complex<float>* D,  int64_t strideD,
+    std::complex<float>* DU, int64_t strideDU,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gtsv_batch( n, nrhs, DL, strideDL, D, strideD, DU, strideDU,
+                          B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a batch of tridiagonal systems $A_i X_i = B_i$ of the same size
+/// by Gaussian elimination with partial pivoting, as in `lapack::gtsv`.
+/// This suits the many independent systems of ADI sweeps and splines.
+///
+/// This is the strided variant: problem i uses DL_i = DL + i*strideDL, etc.
+/// There is no pointer-array variant, as systems vectorize only with
+/// others of the same size.
+/// Each group of `lapack::compact_width` systems is transposed into
+/// compact format in per-thread workspace and solved with the same
+/// kernels as the compact routines, vectorizing across systems. Groups
+/// run in parallel across OpenMP threads. If the systems are already
+/// interleaved, the compact routines avoid the transposition.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in,out] DL
+///     The subdiagonals of A_i, each of length n-1. On exit, the first
+///     n-2 elements are overwritten by the second superdiagonal of U_i
+///     from the LU factorization of A_i, as in `lapack::gtsv`.
+///
+/// @param[in] strideDL
+///     Distance between consecutive vectors DL_i. strideDL >= n-1.
+///
+/// @param[in,out] D
+///     The diagonals of A_i, each of length n.
+///     On exit, the diagonals of U_i.
+///
+/// @param[in] strideD
+///     Distance between consecutive vectors D_i. strideD >= n.
+///
+/// @param[in,out] DU
+///     The superdiagonals of A_i, each of length n-1.
+///     On exit, the first superdiagonals of U_i.
+///
+/// @param[in] strideDU
+///     Distance between consecutive vectors DU_i. strideDU >= n-1.
+///
+/// @param[in,out] B
+///     The right hand side matrices B_i, each stored in an ldb-by-nrhs
+///     array. On exit, the solution matrices X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between consecutive matrices B_i. strideB >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch.
+///     - = 0: successful exit.
+///     - > 0: if info[i] = k, $U_i(k,k)$ is exactly zero, and X_i is
+///       not the solution. Other systems are not affected.
+///
+/// @throws Error if any argument is invalid, before any system is solved.
+///
+/// @ingroup gtsv
+void gtsv_batch(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DL, int64_t strideDL,
+    std::complex<double>* D,  int64_t strideD,
+    std::complex<double>* DU, int64_t strideDU,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gtsv_batch( n, nrhs, DL, strideDL, D, strideD, DU, strideDU,
+                          B, ldb, strideB, batch, info );
+}
+
+}  // namespace lapack
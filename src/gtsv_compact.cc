@@ -0,0 +1,161 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void gtsv_compact(
+    int64_t n, int64_t nrhs,
+    scalar_t* DLc,
+    scalar_t* Dc,
+    scalar_t* DUc,
+    scalar_t* Bc,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+
+    const int64_t w = compact_width< scalar_t >();
+    int64_t n1 = max( n-1, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        int64_t info_g[ w ];
+        gtsv_compact_group( n, nrhs, &DLc[ g*n1*w ], &Dc[ g*n*w ],
+                            &DUc[ g*n1*w ], &Bc[ g*n*nrhs*w ], info_g );
+        int64_t lanes = std::min( w, int64_t( batch ) - g*w );
+        for (int64_t l = 0; l < lanes; ++l)
+            info[ g*w + l ] = info_g[ l ];
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv
+void gtsv_compact(
+    int64_t n, int64_t nrhs,
+    float* DLc,
+    float* Dc,
+    float* DUc,
+    float* Bc,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gtsv_compact( n, nrhs, DLc, Dc, DUc, Bc, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv
+void gtsv_compact(
+    int64_t n, int64_t nrhs,
+    double* DLc,
+    double* Dc,
+    double* DUc,
+    double* Bc,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gtsv_compact( n, nrhs, DLc, Dc, DUc, Bc, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv
+void gtsv_compact(
+    int64_t n, int64_t nrhs,
+    std::complex<float>* DLc,
+    std::complex<float>* Dc,
+    std::complex<float>* DUc,
+    std::complex<float>* Bc,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gtsv_compact( n, nrhs, DLc, Dc, DUc, Bc, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a tridiagonal system for each problem of a compact batch,
+/// $A_i X_i = B_i$, by Gaussian elimination with partial pivoting, as in
+/// `lapack::gtsv`. This suits the many independent tridiagonal systems
+/// of ADI sweeps and splines, which are too short to vectorize one at
+/// a time.
+///
+/// Each vector is interleaved in groups of `lapack::compact_width`, as
+/// from `lapack::pack_compact` with n = 1: element i of vector X_b is
+/// Xc[ g*m*w + i*w + l ] for a vector of length m, with problem b in lane
+/// l of group g. The recurrences vectorize across the systems of each
+/// group, and groups run in parallel across OpenMP threads.
+/// B_i are n-by-nrhs compact matrices, as in `lapack::getrs_compact`.
+/// For systems in strided storage, see `lapack::gtsv_batch`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each matrix B_i. nrhs >= 0.
+///
+/// @param[in,out] DLc
+///     The compact batch of subdiagonals of A_i, each of length n-1.
+///     On exit, elements 0, ..., n-3 of each are overwritten by the
+///     second superdiagonal of U_i from the LU factorization of A_i.
+///
+/// @param[in,out] Dc
+///     The compact batch of diagonals of A_i, each of length n.
+///     On exit, the diagonals of U_i.
+///
+/// @param[in,out] DUc
+///     The compact batch of superdiagonals of A_i, each of length n-1.
+///     On exit, the first superdiagonals of U_i.
+///
+/// @param[in,out] Bc
+///     The compact batch of n-by-nrhs matrices B_i, of length
+///     `lapack::compact_size< scalar_t >( n, nrhs, batch )`.
+///     On successful exit, the solution matrices X_i.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @param[out] info
+///     The vector info of length batch.
+///     - = 0: successful exit.
+///     - > 0: if info[b] = i, $U_b(i,i)$ is exactly zero, and X_b is
+///       not the solution. Other systems are not affected.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup gtsv
+void gtsv_compact(
+    int64_t n, int64_t nrhs,
+    std::complex<double>* DLc,
+    std::complex<double>* Dc,
+    std::complex<double>* DUc,
+    std::complex<double>* Bc,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gtsv_compact( n, nrhs, DLc, Dc, DUc, Bc, batch, info );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t gttrf(
     float* DU2,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "sgttrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -39,6 +42,7 @@ int64_t gttrf(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sgttrf(
         &n_,
         DL,
@@ -65,6 +69,8 @@ int64_t gttrf(
     double* DU2,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "dgttrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -79,6 +85,7 @@ int64_t gttrf(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dgttrf(
         &n_,
         DL,
@@ -105,6 +112,8 @@ int64_t gttrf(
     std::complex<float>* DU2,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "cgttrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -119,6 +128,7 @@ int64_t gttrf(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cgttrf(
         &n_,
         (lapack_complex_float*) DL,
@@ -201,6 +211,8 @@ int64_t gttrf(
     std::complex<double>* DU2,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "zgttrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -215,6 +227,7 @@ int64_t gttrf(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zgttrf(
         &n_,
         (lapack_complex_double*) DL,
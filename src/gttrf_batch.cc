@@ -0,0 +1,223 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "NoConstructAllocator.hh"
+#include "Batch.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Strided gttrf_batch. Each group of w matrices is packed into compact
+// format in per-thread workspace, factored with gttrf_compact_group,
+// and unpacked.
+template <typename scalar_t>
+void gttrf_batch(
+    int64_t n,
+    scalar_t* DL,  int64_t strideDL,
+    scalar_t* D,   int64_t strideD,
+    scalar_t* DU,  int64_t strideDU,
+    scalar_t* DU2, int64_t strideDU2,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( batch > 1 && strideDL  < n-1 );
+    lapack_error_if( batch > 1 && strideD   < n );
+    lapack_error_if( batch > 1 && strideDU  < n-1 );
+    lapack_error_if( batch > 1 && strideDU2 < n-2 );
+    lapack_error_if( batch > 1 && stride_ipiv < n );
+
+    const int64_t w = compact_width< scalar_t >();
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    int64_t n1 = max( n-1, 0 );
+    int64_t n2 = max( n-2, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    // per-thread compact DL, D, DU, DU2, ipiv for one group
+    int64_t lwork = (n1 + n + n1 + n2)*w;
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+    lapack::vector< int64_t > ipiv_work( batch_max_threads() * n*w );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        int64_t i = g*w;
+        int64_t lanes = min( w, int64_t( batch ) - i );
+        int tid = batch_thread_num();
+        scalar_t* DLg  = work.data() + tid * lwork;
+        scalar_t* Dg   = DLg + n1*w;
+        scalar_t* DUg  = Dg  + n*w;
+        scalar_t* DU2g = DUg + n1*w;
+        int64_t* ipivg = ipiv_work.data() + tid * n*w;
+
+        // padding matrices are the identity
+        pack_strided_group( n1, 1, &DL[ i*strideDL ], n1, strideDL,
+                            lanes, w, zero, DLg );
+        pack_strided_group( n, 1, &D[ i*strideD ], n, strideD,
+                            lanes, w, one, Dg );
+        pack_strided_group( n1, 1, &DU[ i*strideDU ], n1, strideDU,
+                            lanes, w, zero, DUg );
+
+        int64_t info_g[ w ];
+        gttrf_compact_group( n, DLg, Dg, DUg, DU2g, ipivg, info_g );
+
+        unpack_strided_group( n1, 1, DLg, lanes, w,
+                              &DL[ i*strideDL ], n1, strideDL );
+        unpack_strided_group( n, 1, Dg, lanes, w, &D[ i*strideD ], n, strideD );
+        unpack_strided_group( n1, 1, DUg, lanes, w,
+                              &DU[ i*strideDU ], n1, strideDU );
+        unpack_strided_group( n2, 1, DU2g, lanes, w,
+                              &DU2[ i*strideDU2 ], n2, strideDU2 );
+        unpack_strided_group( n, 1, ipivg, lanes, w,
+                              &ipiv[ i*stride_ipiv ], n, stride_ipiv );
+        std::copy( info_g, info_g + lanes, &info[ i ] );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrf_batch(
+    int64_t n,
+    float* DL,  int64_t strideDL,
+    float* D,   int64_t strideD,
+    float* DU,  int64_t strideDU,
+    float* DU2, int64_t strideDU2,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrf_batch( n, DL, strideDL, D, strideD, DU, strideDU,
+                           DU2, strideDU2, ipiv, stride_ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrf_batch(
+    int64_t n,
+    double* DL,  int64_t strideDL,
+    double* D,   int64_t strideD,
+    double* DU,  int64_t strideDU,
+    double* DU2, int64_t strideDU2,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrf_batch( n, DL, strideDL, D, strideD, DU, strideDU,
+                           DU2, strideDU2, ipiv, stride_ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrf_batch(
+    int64_t n,
+    std::complex<float>* DL,  int64_t strideDL,
+    std::complex<float>* D,   int64_t strideD,
+    std::complex<float>* DU,  int64_t strideDU,
+    std::complex<float>* DU2, int64_t strideDU2,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrf_batch( n, DL, strideDL, D, strideD, DU, strideDU,
+                           DU2, strideDU2, ipiv, stride_ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes LU factorizations with partial pivoting of a batch of n-by-n
+/// tridiagonal matrices, as in `lapack::gttrf`: $A_i = L_i U_i$.
+///
+/// This is the strided variant: problem i uses DL_i = DL + i*strideDL, etc.
+/// There is no pointer-array variant, as systems vectorize only with
+/// others of the same size.
+/// Each group of `lapack::compact_width` systems is transposed into
+/// compact format in per-thread workspace and solved with the same
+/// kernels as the compact routines, vectorizing across systems. Groups
+/// run in parallel across OpenMP threads. If the systems are already
+/// interleaved, the compact routines avoid the transposition.
+/// Solve using `lapack::gttrs_batch`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] DL
+///     The subdiagonals of A_i, each of length n-1.
+///     On exit, the multipliers that define L_i.
+///
+/// @param[in] strideDL
+///     Distance between consecutive vectors DL_i. strideDL >= n-1.
+///
+/// @param[in,out] D
+///     The diagonals of A_i, each of length n.
+///     On exit, the diagonals of U_i.
+///
+/// @param[in] strideD
+///     Distance between consecutive vectors D_i. strideD >= n.
+///
+/// @param[in,out] DU
+///     The superdiagonals of A_i, each of length n-1.
+///     On exit, the first superdiagonals of U_i.
+///
+/// @param[in] strideDU
+///     Distance between consecutive vectors DU_i. strideDU >= n-1.
+///
+/// @param[out] DU2
+///     The second superdiagonals of U_i, each of length n-2.
+///
+/// @param[in] strideDU2
+///     Distance between consecutive vectors DU2_i. strideDU2 >= n-2.
+///
+/// @param[out] ipiv
+///     The pivot vectors, each of length n, as in `lapack::gttrf`.
+///
+/// @param[in] stride_ipiv
+///     Distance between consecutive pivot vectors. stride_ipiv >= n.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch.
+///     - = 0: successful exit.
+///     - > 0: if info[i] = k, $U_i(k,k)$ is exactly zero. The factorization
+///       has been completed, but the factor U_i is exactly singular, and
+///       division by zero will occur if it is used to solve a system.
+///
+/// @throws Error if any argument is invalid, before any matrix is factored.
+///
+/// @ingroup gtsv_computational
+void gttrf_batch(
+    int64_t n,
+    std::complex<double>* DL,  int64_t strideDL,
+    std::complex<double>* D,   int64_t strideD,
+    std::complex<double>* DU,  int64_t strideDU,
+    std::complex<double>* DU2, int64_t strideDU2,
+    int64_t* ipiv, int64_t stride_ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrf_batch( n, DL, strideDL, D, strideD, DU, strideDU,
+                           DU2, strideDU2, ipiv, stride_ipiv, batch, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,165 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void gttrf_compact(
+    int64_t n,
+    scalar_t* DLc,
+    scalar_t* Dc,
+    scalar_t* DUc,
+    scalar_t* DU2c,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( n < 0 );
+
+    const int64_t w = compact_width< scalar_t >();
+    int64_t n1 = max( n-1, 0 );
+    int64_t n2 = max( n-2, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        int64_t info_g[ w ];
+        gttrf_compact_group( n, &DLc[ g*n1*w ], &Dc[ g*n*w ], &DUc[ g*n1*w ],
+                             &DU2c[ g*n2*w ], &ipiv[ g*n*w ], info_g );
+        int64_t lanes = std::min( w, int64_t( batch ) - g*w );
+        for (int64_t l = 0; l < lanes; ++l)
+            info[ g*w + l ] = info_g[ l ];
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrf_compact(
+    int64_t n,
+    float* DLc,
+    float* Dc,
+    float* DUc,
+    float* DU2c,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrf_compact( n, DLc, Dc, DUc, DU2c, ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrf_compact(
+    int64_t n,
+    double* DLc,
+    double* Dc,
+    double* DUc,
+    double* DU2c,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrf_compact( n, DLc, Dc, DUc, DU2c, ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrf_compact(
+    int64_t n,
+    std::complex<float>* DLc,
+    std::complex<float>* Dc,
+    std::complex<float>* DUc,
+    std::complex<float>* DU2c,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrf_compact( n, DLc, Dc, DUc, DU2c, ipiv, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes LU factorizations with partial pivoting of a compact batch
+/// of n-by-n tridiagonal matrices, as in `lapack::gttrf`:
+/// $A_i = L_i U_i$, where L_i is a product of permutation and unit lower
+/// bidiagonal matrices and U_i is upper triangular with nonzeros in only
+/// the main diagonal and first two superdiagonals.
+///
+/// Each vector is interleaved in groups of `lapack::compact_width`, as
+/// from `lapack::pack_compact` with n = 1: element i of vector X_b is
+/// Xc[ g*m*w + i*w + l ] for a vector of length m, with problem b in lane
+/// l of group g. The recurrences vectorize across the systems of each
+/// group, and groups run in parallel across OpenMP threads.
+/// Solve using `lapack::gttrs_compact`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] DLc
+///     The compact batch of subdiagonals of A_i, each of length n-1.
+///     On exit, the multipliers that define L_i.
+///
+/// @param[in,out] Dc
+///     The compact batch of diagonals of A_i, each of length n.
+///     On exit, the diagonals of U_i.
+///
+/// @param[in,out] DUc
+///     The compact batch of superdiagonals of A_i, each of length n-1.
+///     On exit, the first superdiagonals of U_i.
+///
+/// @param[out] DU2c
+///     The compact batch of second superdiagonals of U_i,
+///     each of length n-2.
+///
+/// @param[out] ipiv
+///     The pivot indices in compact format, each of length n: row i was
+///     interchanged with row ipiv[ g*n*w + i*w + l ], 1-based, which is
+///     either i or i+1, as in `lapack::gttrf`.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @param[out] info
+///     The vector info of length batch.
+///     - = 0: successful exit.
+///     - > 0: if info[b] = i, $U_b(i,i)$ is exactly zero. The factorization
+///       has been completed, but the factor U_b is exactly singular, and
+///       division by zero will occur if it is used to solve a system.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup gtsv_computational
+void gttrf_compact(
+    int64_t n,
+    std::complex<double>* DLc,
+    std::complex<double>* Dc,
+    std::complex<double>* DUc,
+    std::complex<double>* DU2c,
+    int64_t* ipiv,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrf_compact( n, DLc, Dc, DUc, DU2c, ipiv, batch, info );
+}
+
+}  // namespace lapack
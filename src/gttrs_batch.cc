@@ -0,0 +1,248 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "NoConstructAllocator.hh"
+#include "Batch.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Strided gttrs_batch. Each group of w systems is packed into compact
+// format in per-thread workspace, solved with gttrs_compact_group, and
+// the solutions unpacked.
+template <typename scalar_t>
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* DL,  int64_t strideDL,
+    scalar_t const* D,   int64_t strideD,
+    scalar_t const* DU,  int64_t strideDU,
+    scalar_t const* DU2, int64_t strideDU2,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( trans != Op::NoTrans && trans != Op::Trans
+                     && trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch > 1 && strideDL  < n-1 );
+    lapack_error_if( batch > 1 && strideD   < n );
+    lapack_error_if( batch > 1 && strideDU  < n-1 );
+    lapack_error_if( batch > 1 && strideDU2 < n-2 );
+    lapack_error_if( batch > 1 && stride_ipiv < n );
+    lapack_error_if( batch > 1 && strideB < ldb*nrhs );
+
+    const int64_t w = compact_width< scalar_t >();
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    int64_t n1 = max( n-1, 0 );
+    int64_t n2 = max( n-2, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    // per-thread compact DL, D, DU, DU2, B, ipiv for one group
+    int64_t lwork = (n1 + n + n1 + n2 + n*nrhs)*w;
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+    lapack::vector< int64_t > ipiv_work( batch_max_threads() * n*w );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        int64_t i = g*w;
+        int64_t lanes = min( w, int64_t( batch ) - i );
+        int tid = batch_thread_num();
+        scalar_t* DLg  = work.data() + tid * lwork;
+        scalar_t* Dg   = DLg  + n1*w;
+        scalar_t* DUg  = Dg   + n*w;
+        scalar_t* DU2g = DUg  + n1*w;
+        scalar_t* Bg   = DU2g + n2*w;
+        int64_t* ipivg = ipiv_work.data() + tid * n*w;
+
+        // padding systems are the identity with B = 0, so their
+        // interchanges, whatever the padding of ipiv, are harmless
+        pack_strided_group( n1, 1, &DL[ i*strideDL ], n1, strideDL,
+                            lanes, w, zero, DLg );
+        pack_strided_group( n, 1, &D[ i*strideD ], n, strideD,
+                            lanes, w, one, Dg );
+        pack_strided_group( n1, 1, &DU[ i*strideDU ], n1, strideDU,
+                            lanes, w, zero, DUg );
+        pack_strided_group( n2, 1, &DU2[ i*strideDU2 ], n2, strideDU2,
+                            lanes, w, zero, DU2g );
+        pack_strided_group( n, 1, &ipiv[ i*stride_ipiv ], n, stride_ipiv,
+                            lanes, w, int64_t( 0 ), ipivg );
+        pack_strided_group( n, nrhs, &B[ i*strideB ], ldb, strideB,
+                            lanes, w, zero, Bg );
+
+        gttrs_compact_group( trans, n, nrhs, DLg, Dg, DUg, DU2g, ipivg, Bg );
+
+        unpack_strided_group( n, nrhs, Bg, lanes, w,
+                              &B[ i*strideB ], ldb, strideB );
+        std::fill( &info[ i ], &info[ i ] + lanes, 0 );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DL,  int64_t strideDL,
+    float const* D,   int64_t strideD,
+    float const* DU,  int64_t strideDU,
+    float const* DU2, int64_t strideDU2,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrs_batch( trans, n, nrhs, DL, strideDL, D, strideD,
+                           DU, strideDU, DU2, strideDU2, ipiv, stride_ipiv,
+                           B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DL,  int64_t strideDL,
+    double const* D,   int64_t strideD,
+    double const* DU,  int64_t strideDU,
+    double const* DU2, int64_t strideDU2,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrs_batch( trans, n, nrhs, DL, strideDL, D, strideD,
+                           DU, strideDU, DU2, strideDU2, ipiv, stride_ipiv,
+                           B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DL,  int64_t strideDL,
+    std::complex<float> const* D,   int64_t strideD,
+    std::complex<float> const* DU,  int64_t strideDU,
+    std::complex<float> const* DU2, int64_t strideDU2,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrs_batch( trans, n, nrhs, DL, strideDL, D, strideD,
+                           DU, strideDU, DU2, strideDU2, ipiv, stride_ipiv,
+                           B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a batch of tridiagonal systems $op(A_i) X_i = B_i$ of the same
+/// size, using the LU factorizations computed by `lapack::gttrf_batch`,
+/// as in `lapack::gttrs`.
+///
+/// This is the strided variant: problem i uses DL_i = DL + i*strideDL, etc.
+/// There is no pointer-array variant, as systems vectorize only with
+/// others of the same size.
+/// Each group of `lapack::compact_width` systems is transposed into
+/// compact format in per-thread workspace and solved with the same
+/// kernels as the compact routines, vectorizing across systems. Groups
+/// run in parallel across OpenMP threads. If the systems are already
+/// interleaved, the compact routines avoid the transposition.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     The form of the systems of equations, as in `lapack::gttrs`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in] DL
+///     The multipliers that define L_i, each of length n-1,
+///     from `lapack::gttrf_batch`.
+///
+/// @param[in] strideDL
+///     Distance between consecutive vectors DL_i. strideDL >= n-1.
+///
+/// @param[in] D
+///     The diagonals of U_i, each of length n.
+///
+/// @param[in] strideD
+///     Distance between consecutive vectors D_i. strideD >= n.
+///
+/// @param[in] DU
+///     The first superdiagonals of U_i, each of length n-1.
+///
+/// @param[in] strideDU
+///     Distance between consecutive vectors DU_i. strideDU >= n-1.
+///
+/// @param[in] DU2
+///     The second superdiagonals of U_i, each of length n-2.
+///
+/// @param[in] strideDU2
+///     Distance between consecutive vectors DU2_i. strideDU2 >= n-2.
+///
+/// @param[in] ipiv
+///     The pivot vectors, each of length n, from `lapack::gttrf_batch`.
+///
+/// @param[in] stride_ipiv
+///     Distance between consecutive pivot vectors. stride_ipiv >= n.
+///
+/// @param[in,out] B
+///     The right hand side matrices B_i, each stored in an ldb-by-nrhs
+///     array. On exit, the solution matrices X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between consecutive matrices B_i. strideB >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch, set to 0, as arguments are
+///     checked beforehand.
+///
+/// @throws Error if any argument is invalid, before any system is solved.
+///
+/// @ingroup gtsv_computational
+void gttrs_batch(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DL,  int64_t strideDL,
+    std::complex<double> const* D,   int64_t strideD,
+    std::complex<double> const* DU,  int64_t strideDU,
+    std::complex<double> const* DU2, int64_t strideDU2,
+    int64_t const* ipiv, int64_t stride_ipiv,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::gttrs_batch( trans, n, nrhs, DL, strideDL, D, strideD,
+                           DU, strideDU, DU2, strideDU2, ipiv, stride_ipiv,
+                           B, ldb, strideB, batch, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,172 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void gttrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    scalar_t const* DLc,
+    scalar_t const* Dc,
+    scalar_t const* DUc,
+    scalar_t const* DU2c,
+    int64_t const* ipiv,
+    scalar_t* Bc,
+    size_t batch )
+{
+    // check arguments
+    lapack_error_if( trans != Op::NoTrans && trans != Op::Trans
+                     && trans != Op::ConjTrans );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+
+    const int64_t w = compact_width< scalar_t >();
+    int64_t n1 = max( n-1, 0 );
+    int64_t n2 = max( n-2, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        gttrs_compact_group( trans, n, nrhs,
+                             &DLc[ g*n1*w ], &Dc[ g*n*w ], &DUc[ g*n1*w ],
+                             &DU2c[ g*n2*w ], &ipiv[ g*n*w ],
+                             &Bc[ g*n*nrhs*w ] );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    float const* DLc,
+    float const* Dc,
+    float const* DUc,
+    float const* DU2c,
+    int64_t const* ipiv,
+    float* Bc,
+    size_t batch )
+{
+    internal::gttrs_compact( trans, n, nrhs, DLc, Dc, DUc, DU2c, ipiv, Bc,
+                             batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    double const* DLc,
+    double const* Dc,
+    double const* DUc,
+    double const* DU2c,
+    int64_t const* ipiv,
+    double* Bc,
+    size_t batch )
+{
+    internal::gttrs_compact( trans, n, nrhs, DLc, Dc, DUc, DU2c, ipiv, Bc,
+                             batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gtsv_computational
+void gttrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<float> const* DLc,
+    std::complex<float> const* Dc,
+    std::complex<float> const* DUc,
+    std::complex<float> const* DU2c,
+    int64_t const* ipiv,
+    std::complex<float>* Bc,
+    size_t batch )
+{
+    internal::gttrs_compact( trans, n, nrhs, DLc, Dc, DUc, DU2c, ipiv, Bc,
+                             batch );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a tridiagonal system for each problem of a compact batch,
+/// $op(A_i) X_i = B_i$, using the LU factorizations computed by
+/// `lapack::gttrf_compact`, as in `lapack::gttrs`.
+///
+/// Each vector is interleaved in groups of `lapack::compact_width`, as
+/// from `lapack::pack_compact` with n = 1: element i of vector X_b is
+/// Xc[ g*m*w + i*w + l ] for a vector of length m, with problem b in lane
+/// l of group g. The recurrences vectorize across the systems of each
+/// group, and groups run in parallel across OpenMP threads.
+/// B_i are n-by-nrhs compact matrices, as in `lapack::getrs_compact`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   $A_i   X_i = B_i$;
+///     - lapack::Op::Trans:     $A_i^T X_i = B_i$;
+///     - lapack::Op::ConjTrans: $A_i^H X_i = B_i$.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each matrix B_i. nrhs >= 0.
+///
+/// @param[in] DLc
+///     The compact batch of multipliers that define L_i, each of length
+///     n-1, from `lapack::gttrf_compact`.
+///
+/// @param[in] Dc
+///     The compact batch of diagonals of U_i, each of length n.
+///
+/// @param[in] DUc
+///     The compact batch of first superdiagonals of U_i,
+///     each of length n-1.
+///
+/// @param[in] DU2c
+///     The compact batch of second superdiagonals of U_i,
+///     each of length n-2.
+///
+/// @param[in] ipiv
+///     The pivot indices in compact format, from `lapack::gttrf_compact`.
+///
+/// @param[in,out] Bc
+///     The compact batch of n-by-nrhs matrices B_i, of length
+///     `lapack::compact_size< scalar_t >( n, nrhs, batch )`.
+///     On exit, the solution matrices X_i.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup gtsv_computational
+void gttrs_compact(
+    lapack::Op trans, int64_t n, int64_t nrhs,
+    std::complex<double> const* DLc,
+    std::complex<double> const* Dc,
+    std::complex<double> const* DUc,
+    std::complex<double> const* DU2c,
+    int64_t const* ipiv,
+    std::complex<double>* Bc,
+    size_t batch )
+{
+    internal::gttrs_compact( trans, n, nrhs, DLc, Dc, DUc, DU2c, ipiv, Bc,
+                             batch );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t hbev(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "chbev", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -41,6 +44,7 @@ int64_t hbev(
     lapack::vector< std::complex<float> > work( (n) );
     lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chbev(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -65,6 +69,8 @@ int64_t hbev(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "zhbev", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -84,6 +90,7 @@ int64_t hbev(
     lapack::vector< std::complex<double> > work( (n) );
     lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhbev(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t hbevx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "chbevx", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -60,6 +63,7 @@ int64_t hbevx(
     lapack::vector< float > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chbevx(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -96,6 +100,8 @@ int64_t hbevx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "zhbevx", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -131,6 +137,7 @@ int64_t hbevx(
     lapack::vector< double > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhbevx(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
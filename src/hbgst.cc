@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t hbgst(
     std::complex<float> const* BB, int64_t ldbb,
     std::complex<float>* X, int64_t ldx )
 {
+    LAPACK_INSTRUMENT( "chbgst", 0, n, ka );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -45,6 +48,7 @@ int64_t hbgst(
     lapack::vector< std::complex<float> > work( (n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chbgst(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_float*) AB, &ldab_,
@@ -69,6 +73,8 @@ int64_t hbgst(
     std::complex<double> const* BB, int64_t ldbb,
     std::complex<double>* X, int64_t ldx )
 {
+    LAPACK_INSTRUMENT( "zhbgst", 0, n, ka );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -92,6 +98,7 @@ int64_t hbgst(
     lapack::vector< std::complex<double> > work( (n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhbgst(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_double*) AB, &ldab_,
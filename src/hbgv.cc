@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t hbgv(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "chbgv", 0, n, ka );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -46,6 +49,7 @@ int64_t hbgv(
     lapack::vector< std::complex<float> > work( (n) );
     lapack::vector< float > rwork( (3*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chbgv(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_float*) AB, &ldab_,
@@ -72,6 +76,8 @@ int64_t hbgv(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "zhbgv", 0, n, ka );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -95,6 +101,7 @@ int64_t hbgv(
     lapack::vector< std::complex<double> > work( (n) );
     lapack::vector< double > rwork( (3*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhbgv(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_double*) AB, &ldab_,
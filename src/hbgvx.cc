@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -26,6 +27,8 @@ int64_t hbgvx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "chbgvx", 0, n, ka );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -65,6 +68,7 @@ int64_t hbgvx(
     lapack::vector< float > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chbgvx(
         &jobz_, &range_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_float*) AB, &ldab_,
@@ -103,6 +107,8 @@ int64_t hbgvx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "zhbgvx", 0, n, ka );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -142,6 +148,7 @@ int64_t hbgvx(
     lapack::vector< double > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhbgvx(
         &jobz_, &range_, &uplo_, &n_, &ka_, &kb_,
         (lapack_complex_double*) AB, &ldab_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t hbtrd(
     float* E,
     std::complex<float>* Q, int64_t ldq )
 {
+    LAPACK_INSTRUMENT( "chbtrd", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -41,6 +44,7 @@ int64_t hbtrd(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chbtrd(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -66,6 +70,8 @@ int64_t hbtrd(
     double* E,
     std::complex<double>* Q, int64_t ldq )
 {
+    LAPACK_INSTRUMENT( "zhbtrd", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -84,6 +90,7 @@ int64_t hbtrd(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhbtrd(
         &jobz_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
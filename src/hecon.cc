@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t hecon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "checon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -33,7 +36,8 @@ int64_t hecon(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -43,6 +47,7 @@ int64_t hecon(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_checon(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -110,6 +115,8 @@ int64_t hecon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "zhecon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -120,7 +127,8 @@ int64_t hecon(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -130,6 +138,7 @@ int64_t hecon(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhecon(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
 
@@ -26,6 +27,8 @@ int64_t hecon_rk(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "checon_rk", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,7 +39,8 @@ int64_t hecon_rk(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -46,6 +50,7 @@ int64_t hecon_rk(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_checon_3(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -149,6 +154,8 @@ int64_t hecon_rk(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "zhecon_rk", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -159,7 +166,8 @@ int64_t hecon_rk(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -169,6 +177,7 @@ int64_t hecon_rk(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhecon_3(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -24,6 +25,8 @@ int64_t heequb(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "cheequb", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -37,6 +40,7 @@ int64_t heequb(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cheequb(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -106,6 +110,8 @@ int64_t heequb(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "zheequb", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -119,6 +125,7 @@ int64_t heequb(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zheequb(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
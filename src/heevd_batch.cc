@@ -0,0 +1,511 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+#include "Jacobi.hh"
+
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+using blas::real;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Problems with n <= heev_jacobi_max_n use the Jacobi kernel. Beyond that,
+// heevd's tridiagonal reduction is cheaper than Jacobi's sweeps.
+const int64_t heev_jacobi_max_n = 16;
+
+// Jacobi converges quadratically, typically in 5 to 10 sweeps. If it has
+// not converged after this many, the problem falls back to heevd.
+const int64_t heev_jacobi_max_sweeps = 30;
+
+//------------------------------------------------------------------------------
+// Computes the eigenvalues, and optionally eigenvectors, of a small
+// Hermitian matrix using cyclic Jacobi. S and V are n-by-n workspaces.
+// Eigenvalues are sorted in ascending order, as in heevd.
+// Returns false if it did not converge; then A is unchanged.
+//
+// Each rotation zeros S(p,q) = r u, with |u| = 1, using
+//     J = [  c,  s u ]
+//         [ -s conj(u),  c ],
+// where c and s are from the real 2x2 problem [ S(p,p), r; r, S(q,q) ]
+// (Golub & Van Loan, Matrix Computations, sym.schur2). S J updates
+// columns p and q; as S is Hermitian, rows p and q of J^H S J are the
+// conjugates of its columns, so are copied instead of recomputed.
+// Rotations are skipped when |S(p,q)| <= eps sqrt( |S(p,p)| |S(q,q)| ),
+// which gives high relative accuracy (Demmel & Veselic, 1992).
+template <typename scalar_t>
+bool heev_jacobi(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W,
+    scalar_t* S, scalar_t* V )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using std::abs;
+    using std::sqrt;
+
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+    const real_t zero = 0;
+    const real_t one = 1;
+    bool wantz = (jobz == Job::Vec);
+
+    // S = A, filling in the other triangle; V = I
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < n; ++i) {
+            bool stored = (uplo == Uplo::Lower ? i >= j : i <= j);
+            S[ i + j*n ] = stored ? A[ i + j*lda ] : conj( A[ j + i*lda ] );
+        }
+        S[ j + j*n ] = real( S[ j + j*n ] );
+        if (wantz) {
+            for (int64_t i = 0; i < n; ++i)
+                V[ i + j*n ] = zero;
+            V[ j + j*n ] = one;
+        }
+    }
+
+    bool converged = false;
+    for (int64_t sweep = 0; sweep < heev_jacobi_max_sweeps && ! converged;
+         ++sweep) {
+        converged = true;
+        for (int64_t p = 0; p < n-1; ++p) {
+            for (int64_t q = p+1; q < n; ++q) {
+                scalar_t g = S[ p + q*n ];
+                real_t r = abs( g );
+                real_t app = real( S[ p + p*n ] );
+                real_t aqq = real( S[ q + q*n ] );
+                if (r <= eps * sqrt( abs( app ) ) * sqrt( abs( aqq ) ))
+                    continue;
+                converged = false;
+
+                // if theta^2 overflows, t = 0, and S(p,q) is negligible
+                real_t theta = (aqq - app) / (2*r);
+                real_t t = one / (abs( theta ) + sqrt( one + theta*theta ));
+                if (theta < 0)
+                    t = -t;
+                real_t c = one / sqrt( one + t*t );
+                real_t s = t*c;
+                scalar_t u = g / r;
+                scalar_t su = s*u;
+                scalar_t sv = s*conj( u );
+
+                // S = J^H S J
+                jacobi_rotate( n, &S[ p*n ], &S[ q*n ], c, su, sv );
+                S[ p + p*n ] = app - t*r;
+                S[ q + q*n ] = aqq + t*r;
+                S[ p + q*n ] = zero;
+                S[ q + p*n ] = zero;
+                for (int64_t k = 0; k < n; ++k) {
+                    if (k != p && k != q) {
+                        S[ p + k*n ] = conj( S[ k + p*n ] );
+                        S[ q + k*n ] = conj( S[ k + q*n ] );
+                    }
+                }
+
+                // V = V J
+                if (wantz)
+                    jacobi_rotate( n, &V[ p*n ], &V[ q*n ], c, su, sv );
+            }
+        }
+    }
+    if (! converged)
+        return false;
+
+    for (int64_t j = 0; j < n; ++j)
+        W[ j ] = real( S[ j + j*n ] );
+
+    // selection sort eigenvalues in ascending order, with their vectors
+    for (int64_t j = 0; j < n-1; ++j) {
+        int64_t jmin = j;
+        for (int64_t i = j+1; i < n; ++i) {
+            if (W[ i ] < W[ jmin ])
+                jmin = i;
+        }
+        if (jmin != j) {
+            std::swap( W[ j ], W[ jmin ] );
+            if (wantz)
+                std::swap_ranges( &V[ j*n ], &V[ j*n + n ], &V[ jmin*n ] );
+        }
+    }
+
+    // A = V
+    if (wantz) {
+        for (int64_t j = 0; j < n; ++j)
+            std::copy( &V[ j*n ], &V[ j*n + n ], &A[ j*lda ] );
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Solves one problem of the batch: with the Jacobi kernel if n is small,
+// else, or if Jacobi does not converge, with heevd.
+// work must be at least max( lwork, 2 n^2 ) if n <= heev_jacobi_max_n.
+template <typename scalar_t>
+int64_t heevd_batch_one(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda,
+    blas::real_type< scalar_t >* W,
+    scalar_t* work, int64_t lwork,
+    blas::real_type< scalar_t >* rwork, int64_t lrwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    if (n <= heev_jacobi_max_n
+        && heev_jacobi( jobz, uplo, n, A, lda, W, work, &work[ n*n ] )) {
+        return 0;
+    }
+    return lapack::heevd_work( jobz, uplo, n, A, lda, W,
+                               work, lwork, rwork, lrwork, iwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+// Pointer-array heevd_batch. The heevd workspace size is queried only
+// when the options or dimensions change from the previous problem, and
+// each thread reuses one workspace of the largest size for all its
+// problems, including the Jacobi kernel.
+template <typename scalar_t>
+void heevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< blas::real_type< scalar_t >* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    check_batch_arg( jobz, batch );
+    check_batch_arg( uplo, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( lda, batch );
+    check_batch_array( Aarray, batch );
+    check_batch_array( W_array, batch );
+    int64_t lwork = 1, lrwork = 1, liwork = 1;
+    int64_t lwork_i = 1, lrwork_i = 1, liwork_i = 1;
+    for (size_t i = 0; i < batch; ++i) {
+        lapack::Job jobz_i  = batch_arg( jobz, i );
+        lapack::Uplo uplo_i = batch_arg( uplo, i );
+        int64_t n_i   = batch_arg( n,   i );
+        int64_t lda_i = batch_arg( lda, i );
+        lapack_error_if( jobz_i != Job::NoVec && jobz_i != Job::Vec );
+        lapack_error_if( uplo_i != Uplo::Lower && uplo_i != Uplo::Upper );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( lda_i < max( 1, n_i ) );
+        lapack_error_if( exceeds_lapack_int( { n_i, lda_i } ) );
+        if (i == 0 || batch_changed( i, jobz, uplo, n, lda )) {
+            heevd_work_size( jobz_i, uplo_i, n_i, Aarray[ i ], lda_i,
+                             W_array[ i ], &lwork_i, &lrwork_i, &liwork_i );
+            lwork  = max( lwork,  lwork_i );
+            lrwork = max( lrwork, lrwork_i );
+            liwork = max( liwork, liwork_i );
+            if (n_i <= heev_jacobi_max_n)
+                lwork = max( lwork, 2*n_i*n_i );
+        }
+    }
+    info.resize( batch );
+
+    // workspace, one per thread
+    int nthreads = batch_max_threads();
+    lapack::vector< scalar_t > work( nthreads * lwork );
+    lapack::vector< real_t > rwork( nthreads * lrwork );
+    lapack::vector< lapack_int > iwork( nthreads * liwork );
+
+    auto cost = [&]( size_t i ) {
+        double n_i = batch_arg( n, i );
+        return n_i * n_i * n_i;
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        int tid = batch_thread_num();
+        info[ i ] = heevd_batch_one(
+            batch_arg( jobz, i ), batch_arg( uplo, i ), batch_arg( n, i ),
+            Aarray[ i ], batch_arg( lda, i ), W_array[ i ],
+            &work[ tid * lwork ], lwork,
+            &rwork[ tid * lrwork ], lrwork,
+            &iwork[ tid * liwork ], liwork );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided heevd_batch. Problems are the same size, so the workspace size
+// is queried once for the whole batch.
+template <typename scalar_t>
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    blas::real_type< scalar_t >* W, int64_t strideW,
+    size_t batch,
+    int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( batch > 1 && strideA < lda*n );
+    lapack_error_if( batch > 1 && strideW < n );
+    lapack_error_if( exceeds_lapack_int( { n, lda } ) );
+
+    if (batch == 0)
+        return;
+
+    // query for workspace size, one workspace per thread
+    int64_t lwork, lrwork, liwork;
+    heevd_work_size( jobz, uplo, n, A, lda, W, &lwork, &lrwork, &liwork );
+    if (n <= heev_jacobi_max_n)
+        lwork = max( lwork, 2*n*n );
+    lrwork = max( 1, lrwork );
+    liwork = max( 1, liwork );
+    int nthreads = batch_max_threads();
+    lapack::vector< scalar_t > work( nthreads * lwork );
+    lapack::vector< real_t > rwork( nthreads * lrwork );
+    lapack::vector< lapack_int > iwork( nthreads * liwork );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        int tid = batch_thread_num();
+        info[ i ] = heevd_batch_one(
+            jobz, uplo, n, &A[ i*strideA ], lda, &W[ i*strideW ],
+            &work[ tid * lwork ], lwork,
+            &rwork[ tid * lrwork ], lrwork,
+            &iwork[ tid * liwork ], liwork );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd_batch
+/// @ingroup heev
+void syevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::heevd_batch( jobz, uplo, n, Aarray, lda, W_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd_batch
+/// @ingroup heev
+void syevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::heevd_batch( jobz, uplo, n, Aarray, lda, W_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void heevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::heevd_batch( jobz, uplo, n, Aarray, lda, W_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes all eigenvalues and, optionally, eigenvectors of a batch of
+/// Hermitian matrices A_i, as in `lapack::heevd`.
+///
+/// Small problems, n_i <= 16, such as 3-by-3 stress tensors, use a cyclic
+/// Jacobi kernel, which avoids heevd's tridiagonal reduction and
+/// per-call overhead. Larger problems, or any that Jacobi does not
+/// converge on, call `lapack::heevd`. Eigenvalues are in ascending order
+/// in both cases, but eigenvectors may differ by a unit scalar factor.
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of jobz, uplo, n, and lda has either one element, used for all
+/// problems, or batch elements. Problems run in parallel across OpenMP
+/// threads. The workspace size is queried only when the options or
+/// dimensions differ from the previous problem's, and each thread reuses
+/// one workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, this is an alias for `lapack::syevd_batch`.
+///
+/// @param[in] jobz
+///     - lapack::Job::NoVec: Compute eigenvalues only;
+///     - lapack::Job::Vec:   Compute eigenvalues and eigenvectors.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n_i >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of batch pointers to the Hermitian matrices A_i, each stored
+///     in an lda_i-by-n_i array.
+///     On exit, if jobz = Vec, A_i contains the orthonormal eigenvectors
+///     of A_i; if jobz = NoVec, A_i may be destroyed.
+///
+/// @param[in] lda
+///     The leading dimension of each array A_i. lda_i >= max(1,n_i).
+///
+/// @param[out] W_array
+///     Array of batch pointers to the vectors W_i of length n_i.
+///     If info[i] = 0, the eigenvalues of A_i in ascending order.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::heevd`
+///     for problem i; = 0: successful exit.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup heev
+void heevd_batch(
+    std::vector< lapack::Job > const& jobz,
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& W_array,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::heevd_batch( jobz, uplo, n, Aarray, lda, W_array, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd_batch
+/// @ingroup heev
+void syevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    size_t batch,
+    int64_t* info )
+{
+    internal::heevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heevd_batch
+/// @ingroup heev
+void syevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    size_t batch,
+    int64_t* info )
+{
+    internal::heevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    float* W, int64_t strideW,
+    size_t batch,
+    int64_t* info )
+{
+    internal::heevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes all eigenvalues and, optionally, eigenvectors of a batch of
+/// n-by-n Hermitian matrices A_i, as in `lapack::heevd`.
+/// If n <= 16, a cyclic Jacobi kernel is used instead of heevd;
+/// see the pointer-array `lapack::heevd_batch`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA and W_i = W + i*strideW.
+/// Problems run in parallel across OpenMP threads. The workspace size
+/// is queried once for the whole batch, and each thread reuses one
+/// workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, this is an alias for `lapack::syevd_batch`.
+///
+/// @param[in] jobz
+///     - lapack::Job::NoVec: Compute eigenvalues only;
+///     - lapack::Job::Vec:   Compute eigenvalues and eigenvectors.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The Hermitian matrices A_i, each stored in an lda-by-n array.
+///     On exit, if jobz = Vec, A_i contains the orthonormal eigenvectors
+///     of A_i; if jobz = NoVec, A_i may be destroyed.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between consecutive matrices A_i. strideA >= lda*n.
+///
+/// @param[out] W
+///     The vectors W_i, each of length n.
+///     If info[i] = 0, the eigenvalues of A_i in ascending order.
+///
+/// @param[in] strideW
+///     Distance between consecutive vectors W_i. strideW >= n.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::heevd` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup heev
+void heevd_batch(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    double* W, int64_t strideW,
+    size_t batch,
+    int64_t* info )
+{
+    internal::heevd_batch( jobz, uplo, n, A, lda, strideA, W, strideW,
+                           batch, info );
+}
+
+}  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t hegst(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "chegst", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -34,6 +37,7 @@ int64_t hegst(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chegst(
         &itype_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -54,6 +58,8 @@ int64_t hegst(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zhegst", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -68,6 +74,7 @@ int64_t hegst(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhegst(
         &itype_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
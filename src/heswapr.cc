@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30301  // >= 3.3.1
 
@@ -22,6 +23,8 @@ void heswapr(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    LAPACK_INSTRUMENT( "cheswapr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ void heswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cheswapr(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &i1_, &i2_
@@ -80,6 +84,8 @@ void heswapr(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    LAPACK_INSTRUMENT( "zheswapr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -93,6 +99,7 @@ void heswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zheswapr(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &i1_, &i2_
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t hetri(
     std::complex<float>* A, int64_t lda,
     int64_t const* ipiv )
 {
+    LAPACK_INSTRUMENT( "chetri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -32,7 +35,8 @@ int64_t hetri(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -42,6 +46,7 @@ int64_t hetri(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chetri(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -109,6 +114,8 @@ int64_t hetri(
     std::complex<double>* A, int64_t lda,
     int64_t const* ipiv )
 {
+    LAPACK_INSTRUMENT( "zhetri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -119,7 +126,8 @@ int64_t hetri(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -129,6 +137,7 @@ int64_t hetri(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhetri(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
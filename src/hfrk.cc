@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ void hfrk(
     std::complex<float> const* A, int64_t lda, float beta,
     std::complex<float>* C )
 {
+    LAPACK_INSTRUMENT( "chfrk", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ void hfrk(
     lapack_int k_ = (lapack_int) k;
     lapack_int lda_ = (lapack_int) lda;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chfrk(
         &transr_, &uplo_, &trans_, &n_, &k_, &alpha,
         (lapack_complex_float*) A, &lda_, &beta,
@@ -49,6 +53,8 @@ void hfrk(
     std::complex<double> const* A, int64_t lda, double beta,
     std::complex<double>* C )
 {
+    LAPACK_INSTRUMENT( "zhfrk", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -62,6 +68,7 @@ void hfrk(
     lapack_int k_ = (lapack_int) k;
     lapack_int lda_ = (lapack_int) lda;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhfrk(
         &transr_, &uplo_, &trans_, &n_, &k_, &alpha,
         (lapack_complex_double*) A, &lda_, &beta,
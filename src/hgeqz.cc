@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,117 @@ int64_t hgeqz(
     float* Q, int64_t ldq,
     float* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "shgeqz", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    hgeqz_work_size( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                     beta, Q, ldq, Z, ldz,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                       alpha, beta, Q, ldq, Z, ldz,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz )
+{
+    LAPACK_INSTRUMENT( "dhgeqz", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    hgeqz_work_size( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                     beta, Q, ldq, Z, ldz,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                       alpha, beta, Q, ldq, Z, ldz,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz )
+{
+    LAPACK_INSTRUMENT( "chgeqz", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    hgeqz_work_size( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                     beta, Q, ldq, Z, ldz,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
+
+    return hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                       alpha, beta, Q, ldq, Z, ldz,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz )
+{
+    LAPACK_INSTRUMENT( "zhgeqz", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    hgeqz_work_size( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt, alpha,
+                     beta, Q, ldq, Z, ldz,
+                     &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return hgeqz_work( jobschur, compq, compz, n, ilo, ihi, H, ldh, T, ldt,
+                       alpha, beta, Q, ldq, Z, ldz,
+                       work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+void hgeqz_work_size(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    float* T, int64_t ldt,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "shgeqz_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -71,12 +183,53 @@ int64_t hgeqz(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+void hgeqz_work_size(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "dhgeqz_work_size", 0, n, 0 );
 
-    LAPACK_shgeqz(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldh) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobschur_ = jobschur2char( jobschur );
+    char compq_ = job_comp2char( compq );
+    char compz_ = job_comp2char( compz );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int ldh_ = (lapack_int) ldh;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > alphar( max( 1, n ) );
+    lapack::vector< double > alphai( max( 1, n ) );
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
         T, &ldt_,
@@ -85,7 +238,7 @@ int64_t hgeqz(
         beta,
         Q, &ldq_,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -93,23 +246,83 @@ int64_t hgeqz(
     if (info_ < 0) {
         throw Error();
     }
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        alpha[i] = std::complex<float>( alphar[i], alphai[i] );
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+}
+
+// -----------------------------------------------------------------------------
+void hgeqz_work_size(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    std::complex<float>* H, int64_t ldh,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "chgeqz_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldh) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
     }
-    return info_;
+    char jobschur_ = jobschur2char( jobschur );
+    char compq_ = job_comp2char( compq );
+    char compz_ = job_comp2char( compz );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int ldh_ = (lapack_int) ldh;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_chgeqz(
+        &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
+        (lapack_complex_float*) H, &ldh_,
+        (lapack_complex_float*) T, &ldt_,
+        (lapack_complex_float*) alpha,
+        (lapack_complex_float*) beta,
+        (lapack_complex_float*) Q, &ldq_,
+        (lapack_complex_float*) Z, &ldz_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, n );
 }
 
 // -----------------------------------------------------------------------------
-int64_t hgeqz(
+void hgeqz_work_size(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
-    double* H, int64_t ldh,
-    double* T, int64_t ldt,
+    std::complex<double>* H, int64_t ldh,
+    std::complex<double>* T, int64_t ldt,
     std::complex<double>* alpha,
-    double* beta,
-    double* Q, int64_t ldq,
-    double* Z, int64_t ldz )
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* lwork, int64_t* lrwork )
 {
+    LAPACK_INSTRUMENT( "zhgeqz_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -132,14 +345,75 @@ int64_t hgeqz(
     lapack_int ldz_ = (lapack_int) ldz;
     lapack_int info_ = 0;
 
-    // split-complex representation
-    lapack::vector< double > alphar( max( 1, n ) );
-    lapack::vector< double > alphai( max( 1, n ) );
-
     // query for workspace size
-    double qry_work[1];
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
     lapack_int ineg_one = -1;
-    LAPACK_dhgeqz(
+    LAPACK_zhgeqz(
+        &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
+        (lapack_complex_double*) H, &ldh_,
+        (lapack_complex_double*) T, &ldt_,
+        (lapack_complex_double*) alpha,
+        (lapack_complex_double*) beta,
+        (lapack_complex_double*) Q, &ldq_,
+        (lapack_complex_double*) Z, &ldz_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, n );
+}
+
+// -----------------------------------------------------------------------------
+int64_t hgeqz_work(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    float* H, int64_t ldh,
+    float* T, int64_t ldt,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "shgeqz_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldh) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobschur_ = jobschur2char( jobschur );
+    char compq_ = job_comp2char( compq );
+    char compz_ = job_comp2char( compz );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int ldh_ = (lapack_int) ldh;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > alphar( max( 1, n ) );
+    lapack::vector< float > alphai( max( 1, n ) );
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_shgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
         T, &ldt_,
@@ -148,7 +422,7 @@ int64_t hgeqz(
         beta,
         Q, &ldq_,
         Z, &ldz_,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -156,11 +430,56 @@ int64_t hgeqz(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        alpha[i] = std::complex<float>( alphar[i], alphai[i] );
+    }
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t hgeqz_work(
+    lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
+    double* H, int64_t ldh,
+    double* T, int64_t ldt,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "dhgeqz_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ilo) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ihi) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldh) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobschur_ = jobschur2char( jobschur );
+    char compq_ = job_comp2char( compq );
+    char compz_ = job_comp2char( compz );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ilo_ = (lapack_int) ilo;
+    lapack_int ihi_ = (lapack_int) ihi;
+    lapack_int ldh_ = (lapack_int) ldh;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    // split-complex representation
+    lapack::vector< double > alphar( max( 1, n ) );
+    lapack::vector< double > alphai( max( 1, n ) );
+
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         H, &ldh_,
@@ -170,7 +489,7 @@ int64_t hgeqz(
         beta,
         Q, &ldq_,
         Z, &ldz_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -186,15 +505,19 @@ int64_t hgeqz(
 }
 
 // -----------------------------------------------------------------------------
-int64_t hgeqz(
+int64_t hgeqz_work(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     std::complex<float>* H, int64_t ldh,
     std::complex<float>* T, int64_t ldt,
     std::complex<float>* alpha,
     std::complex<float>* beta,
     std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* Z, int64_t ldz )
+    std::complex<float>* Z, int64_t ldz,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
 {
+    LAPACK_INSTRUMENT( "chgeqz_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -204,7 +527,9 @@ int64_t hgeqz(
         lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
+    lapack_error_if( lrwork < n );
     char jobschur_ = jobschur2char( jobschur );
     char compq_ = job_comp2char( compq );
     char compz_ = job_comp2char( compz );
@@ -215,35 +540,10 @@ int64_t hgeqz(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_chgeqz(
-        &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
-        (lapack_complex_float*) H, &ldh_,
-        (lapack_complex_float*) T, &ldt_,
-        (lapack_complex_float*) alpha,
-        (lapack_complex_float*) beta,
-        (lapack_complex_float*) Q, &ldq_,
-        (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( (n) );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_float*) H, &ldh_,
@@ -252,8 +552,8 @@ int64_t hgeqz(
         (lapack_complex_float*) beta,
         (lapack_complex_float*) Q, &ldq_,
         (lapack_complex_float*) Z, &ldz_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -265,15 +565,19 @@ int64_t hgeqz(
 }
 
 // -----------------------------------------------------------------------------
-int64_t hgeqz(
+int64_t hgeqz_work(
     lapack::JobSchur jobschur, lapack::Job compq, lapack::Job compz, int64_t n, int64_t ilo, int64_t ihi,
     std::complex<double>* H, int64_t ldh,
     std::complex<double>* T, int64_t ldt,
     std::complex<double>* alpha,
     std::complex<double>* beta,
     std::complex<double>* Q, int64_t ldq,
-    std::complex<double>* Z, int64_t ldz )
+    std::complex<double>* Z, int64_t ldz,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
 {
+    LAPACK_INSTRUMENT( "zhgeqz_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -283,7 +587,9 @@ int64_t hgeqz(
         lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
+    lapack_error_if( lrwork < n );
     char jobschur_ = jobschur2char( jobschur );
     char compq_ = job_comp2char( compq );
     char compz_ = job_comp2char( compz );
@@ -294,35 +600,10 @@ int64_t hgeqz(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zhgeqz(
-        &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
-        (lapack_complex_double*) H, &ldh_,
-        (lapack_complex_double*) T, &ldt_,
-        (lapack_complex_double*) alpha,
-        (lapack_complex_double*) beta,
-        (lapack_complex_double*) Q, &ldq_,
-        (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( (n) );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhgeqz(
         &jobschur_, &compq_, &compz_, &n_, &ilo_, &ihi_,
         (lapack_complex_double*) H, &ldh_,
@@ -331,8 +612,8 @@ int64_t hgeqz(
         (lapack_complex_double*) beta,
         (lapack_complex_double*) Q, &ldq_,
         (lapack_complex_double*) Z, &ldz_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
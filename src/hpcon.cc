@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t hpcon(
     int64_t const* ipiv, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "chpcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -30,7 +33,8 @@ int64_t hpcon(
     lapack_int n_ = (lapack_int) n;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -40,6 +44,7 @@ int64_t hpcon(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chpcon(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -62,6 +67,8 @@ int64_t hpcon(
     int64_t const* ipiv, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "zhpcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -70,7 +77,8 @@ int64_t hpcon(
     lapack_int n_ = (lapack_int) n;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -80,6 +88,7 @@ int64_t hpcon(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhpcon(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
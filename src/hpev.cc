@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t hpev(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "chpev", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -37,6 +40,7 @@ int64_t hpev(
     lapack::vector< std::complex<float> > work( (max( 1, 2*n-1 )) );
     lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chpev(
         &jobz_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -61,6 +65,8 @@ int64_t hpev(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "zhpev", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -76,6 +82,7 @@ int64_t hpev(
     lapack::vector< std::complex<double> > work( (max( 1, 2*n-1 )) );
     lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhpev(
         &jobz_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -24,6 +25,8 @@ int64_t hpevx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "chpevx", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -53,6 +56,7 @@ int64_t hpevx(
     lapack::vector< float > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chpevx(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) AP, &vl, &vu, &il_, &iu_, &abstol, &m_,
@@ -87,6 +91,8 @@ int64_t hpevx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "zhpevx", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -116,6 +122,7 @@ int64_t hpevx(
     lapack::vector< double > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhpevx(
         &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_double*) AP, &vl, &vu, &il_, &iu_, &abstol, &m_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t hpgst(
     std::complex<float>* AP,
     std::complex<float> const* BP )
 {
+    LAPACK_INSTRUMENT( "chpgst", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -30,6 +33,7 @@ int64_t hpgst(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chpgst(
         &itype_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -50,6 +54,8 @@ int64_t hpgst(
     std::complex<double>* AP,
     std::complex<double> const* BP )
 {
+    LAPACK_INSTRUMENT( "zhpgst", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -60,6 +66,7 @@ int64_t hpgst(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhpgst(
         &itype_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t hpgv(
     float* W,
     std::complex<float>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "chpgv", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -40,6 +43,7 @@ int64_t hpgv(
     lapack::vector< std::complex<float> > work( (max( 1, 2*n-1 )) );
     lapack::vector< float > rwork( (max( 1, 3*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chpgv(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -66,6 +70,8 @@ int64_t hpgv(
     double* W,
     std::complex<double>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "zhpgv", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -83,6 +89,7 @@ int64_t hpgv(
     lapack::vector< std::complex<double> > work( (max( 1, 2*n-1 )) );
     lapack::vector< double > rwork( (max( 1, 3*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhpgv(
         &itype_, &jobz_, &uplo_, &n_,
         (lapack_complex_double*) AP,
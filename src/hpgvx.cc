@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t hpgvx(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "chpgvx", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -56,6 +59,7 @@ int64_t hpgvx(
     lapack::vector< float > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chpgvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -92,6 +96,8 @@ int64_t hpgvx(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "zhpgvx", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -123,6 +129,7 @@ int64_t hpgvx(
     lapack::vector< double > rwork( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhpgvx(
         &itype_, &jobz_, &range_, &uplo_, &n_,
         (lapack_complex_double*) AP,
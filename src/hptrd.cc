@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t hptrd(
     float* E,
     std::complex<float>* tau )
 {
+    LAPACK_INSTRUMENT( "chptrd", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -30,6 +33,7 @@ int64_t hptrd(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chptrd(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -54,6 +58,8 @@ int64_t hptrd(
     double* E,
     std::complex<double>* tau )
 {
+    LAPACK_INSTRUMENT( "zhptrd", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -62,6 +68,7 @@ int64_t hptrd(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhptrd(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
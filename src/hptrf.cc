@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t hptrf(
     std::complex<float>* AP,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "chptrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ int64_t hptrf(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_chptrf(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -59,6 +63,8 @@ int64_t hptrf(
     std::complex<double>* AP,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "zhptrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -74,6 +80,7 @@ int64_t hptrf(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zhptrf(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
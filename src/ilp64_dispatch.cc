@@ -0,0 +1,34 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "Ilp64Dispatch.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+namespace internal {
+
+std::atomic< int64_t > ilp64_threshold {
+    std::numeric_limits< lapack_int >::max() };
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+void set_ilp64_threshold( int64_t threshold )
+{
+    threshold = std::max( int64_t( 0 ), std::min(
+        threshold, int64_t( std::numeric_limits< lapack_int >::max() ) ) );
+    internal::ilp64_threshold.store( threshold, std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+int64_t get_ilp64_threshold()
+{
+    return internal::ilp64_threshold.load( std::memory_order_relaxed );
+}
+
+}  // namespace lapack
@@ -0,0 +1,310 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/stats.hh"
+#include "lapack/util.hh"
+#include "Instrument.hh"
+
+#ifdef LAPACK_HAVE_INSTRUMENTATION
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// One thread's statistics, keyed by routine name literal. The mutex is
+// uncontended except while stats() or reset_stats() reads it.
+struct ThreadStats
+{
+    std::mutex mutex;
+    std::unordered_map< const char*, RoutineStats > routines;
+};
+
+//------------------------------------------------------------------------------
+// All threads' statistics. Kept after a thread exits so its calls are
+// still counted. Never destroyed, so it is valid in the at-exit dump.
+struct StatsRegistry
+{
+    std::mutex mutex;
+    std::vector< std::shared_ptr< ThreadStats > > threads;
+};
+
+static void print_stats_at_exit();
+
+static StatsRegistry& stats_registry()
+{
+    static StatsRegistry* registry = [] {
+        const char* env = std::getenv( "LAPACKPP_STATS" );
+        if (env != nullptr && env[ 0 ] != '\0' && std::strcmp( env, "0" ) != 0)
+            std::atexit( print_stats_at_exit );
+        return new StatsRegistry;
+    }();
+    return *registry;
+}
+
+static ThreadStats& thread_stats()
+{
+    thread_local std::shared_ptr< ThreadStats > stats = [] {
+        auto ptr = std::make_shared< ThreadStats >();
+        auto& registry = stats_registry();
+        std::lock_guard< std::mutex > guard( registry.mutex );
+        registry.threads.push_back( ptr );
+        return ptr;
+    }();
+    return *stats;
+}
+
+// Active scope on this thread, or nullptr.
+thread_local InstrumentScope* current_scope = nullptr;
+
+//------------------------------------------------------------------------------
+// Registered trace callbacks, initially from $LAPACKPP_TRACE; null if none.
+static std::atomic< TraceCallbacks const* >& trace_callbacks()
+{
+    static std::atomic< TraceCallbacks const* > callbacks( trace_from_env() );
+    return callbacks;
+}
+
+//------------------------------------------------------------------------------
+static uint64_t thread_id()
+{
+    static std::atomic< uint64_t > next_id( 0 );
+    thread_local uint64_t id = next_id++;
+    return id;
+}
+
+//------------------------------------------------------------------------------
+static double seconds( instrument_clock::duration d )
+{
+    return std::chrono::duration< double >( d ).count();
+}
+
+//------------------------------------------------------------------------------
+static TraceEvent trace_event( InstrumentScope const& scope )
+{
+    TraceEvent event;
+    event.routine   = scope.routine_;
+    event.precision = scope.routine_[ 0 ];
+    event.m = scope.m_;
+    event.n = scope.n_;
+    event.k = scope.k_;
+    event.thread_id = thread_id();
+    event.start = seconds( scope.start_.time_since_epoch() );
+    event.end   = 0;
+    return event;
+}
+
+//------------------------------------------------------------------------------
+InstrumentScope::InstrumentScope(
+    const char* routine, int64_t m, int64_t n, int64_t k )
+:
+    routine_( routine ),
+    m_( m ),
+    n_( n ),
+    k_( k )
+{
+    if (current_scope == nullptr) {
+        active_ = true;
+        current_scope = this;
+        trace_ = trace_callbacks().load( std::memory_order_acquire );
+        start_ = instrument_clock::now();
+        if (trace_ != nullptr && trace_->begin != nullptr)
+            trace_->begin( trace_event( *this ), trace_->data );
+    }
+}
+
+//------------------------------------------------------------------------------
+// Records the call. Without a compute marker, e.g., a wrapper that threw
+// on invalid arguments, the whole call counts as query time.
+InstrumentScope::~InstrumentScope()
+{
+    if (! active_)
+        return;
+
+    auto end = instrument_clock::now();
+    if (trace_ != nullptr && trace_->end != nullptr) {
+        TraceEvent event = trace_event( *this );
+        event.end = seconds( end.time_since_epoch() );
+        trace_->end( event, trace_->data );
+    }
+    current_scope = nullptr;
+
+    auto& stats = thread_stats();
+    std::lock_guard< std::mutex > guard( stats.mutex );
+    auto& r = stats.routines[ routine_ ];
+    r.calls += 1;
+    r.alloc_time += alloc_before_ + alloc_after_;
+    if (computing_) {
+        r.query_time   += seconds( compute_ - start_ ) - alloc_before_;
+        r.compute_time += seconds( end - compute_ ) - alloc_after_;
+    }
+    else {
+        r.query_time += seconds( end - start_ ) - alloc_before_;
+    }
+    r.bytes_allocated += bytes_;
+    r.peak_workspace = std::max( r.peak_workspace, int64_t( peak_ ) );
+}
+
+//------------------------------------------------------------------------------
+void instrument_compute()
+{
+    auto scope = current_scope;
+    if (scope != nullptr && ! scope->computing_) {
+        scope->computing_ = true;
+        scope->compute_ = instrument_clock::now();
+    }
+}
+
+//------------------------------------------------------------------------------
+void instrument_allocate( std::size_t bytes, double seconds )
+{
+    auto scope = current_scope;
+    if (scope != nullptr) {
+        if (scope->computing_)
+            scope->alloc_after_ += seconds;
+        else
+            scope->alloc_before_ += seconds;
+        scope->bytes_ += bytes;
+        scope->outstanding_ += bytes;
+        scope->peak_ = std::max( scope->peak_, scope->outstanding_ );
+    }
+}
+
+//------------------------------------------------------------------------------
+void instrument_deallocate( std::size_t bytes )
+{
+    // Memory allocated before the scope started isn't counted.
+    auto scope = current_scope;
+    if (scope != nullptr)
+        scope->outstanding_ -= std::min( bytes, scope->outstanding_ );
+}
+
+//------------------------------------------------------------------------------
+static void print_stats_at_exit()
+{
+    const char* env = std::getenv( "LAPACKPP_STATS" );
+    if (env == nullptr || std::strcmp( env, "1" ) == 0) {
+        print_stats( stderr );
+    }
+    else {
+        FILE* out = std::fopen( env, "w" );
+        if (out == nullptr) {
+            std::fprintf( stderr, "LAPACK++: cannot open LAPACKPP_STATS %s\n",
+                          env );
+            return;
+        }
+        print_stats( out );
+        std::fclose( out );
+    }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+std::map< std::string, RoutineStats > stats()
+{
+    std::map< std::string, RoutineStats > result;
+    auto& registry = internal::stats_registry();
+    std::lock_guard< std::mutex > guard( registry.mutex );
+    for (auto const& thread : registry.threads) {
+        std::lock_guard< std::mutex > thread_guard( thread->mutex );
+        for (auto const& iter : thread->routines) {
+            auto const& src = iter.second;
+            auto& dst = result[ iter.first ];
+            dst.calls           += src.calls;
+            dst.query_time      += src.query_time;
+            dst.alloc_time      += src.alloc_time;
+            dst.compute_time    += src.compute_time;
+            dst.bytes_allocated += src.bytes_allocated;
+            dst.peak_workspace = std::max( dst.peak_workspace,
+                                           src.peak_workspace );
+        }
+    }
+    return result;
+}
+
+//------------------------------------------------------------------------------
+void set_trace_callbacks(
+    trace_callback_t begin, trace_callback_t end, void* data )
+{
+    internal::TraceCallbacks const* callbacks = nullptr;
+    if (begin != nullptr || end != nullptr)
+        callbacks = new internal::TraceCallbacks{ begin, end, data };
+    internal::trace_callbacks().store( callbacks, std::memory_order_release );
+}
+
+//------------------------------------------------------------------------------
+void reset_stats()
+{
+    auto& registry = internal::stats_registry();
+    std::lock_guard< std::mutex > guard( registry.mutex );
+    for (auto const& thread : registry.threads) {
+        std::lock_guard< std::mutex > thread_guard( thread->mutex );
+        thread->routines.clear();
+    }
+}
+
+}  // namespace lapack
+
+#else  // not LAPACK_HAVE_INSTRUMENTATION
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+std::map< std::string, RoutineStats > stats()
+{
+    return {};
+}
+
+//------------------------------------------------------------------------------
+void reset_stats()
+{
+}
+
+//------------------------------------------------------------------------------
+void set_trace_callbacks(
+    trace_callback_t begin, trace_callback_t end, void* data )
+{
+    throw Error( "LAPACK++ was built without instrumentation"
+                 " (use_instrumentation)" );
+}
+
+}  // namespace lapack
+
+#endif  // LAPACK_HAVE_INSTRUMENTATION
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+void print_stats( FILE* out )
+{
+    #ifndef LAPACK_HAVE_INSTRUMENTATION
+        std::fprintf( out, "LAPACK++ was built without instrumentation"
+                           " (use_instrumentation)\n" );
+    #else
+        std::fprintf( out, "%-16s  %10s  %12s  %12s  %12s  %14s  %14s\n",
+                      "routine", "calls", "query (s)", "alloc (s)",
+                      "compute (s)", "bytes alloc", "peak work" );
+        for (auto const& iter : stats()) {
+            auto const& r = iter.second;
+            std::fprintf( out,
+                          "%-16s  %10lld  %12.6f  %12.6f  %12.6f  %14lld  %14lld\n",
+                          iter.first.c_str(), (long long) r.calls,
+                          r.query_time, r.alloc_time, r.compute_time,
+                          (long long) r.bytes_allocated,
+                          (long long) r.peak_workspace );
+        }
+    #endif
+}
+
+}  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ void lacgv(
     int64_t n,
     std::complex<float>* x, int64_t incx )
 {
+    LAPACK_INSTRUMENT( "clacgv", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -28,6 +31,7 @@ void lacgv(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clacgv(
         &n_,
         (lapack_complex_float*) x, &incx_ );
@@ -57,6 +61,8 @@ void lacgv(
     int64_t n,
     std::complex<double>* x, int64_t incx )
 {
+    LAPACK_INSTRUMENT( "zlacgv", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -65,6 +71,7 @@ void lacgv(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlacgv(
         &n_,
         (lapack_complex_double*) x, &incx_ );
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ void lacp2(
     float const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "clacp2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ void lacp2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clacp2(
         &uplo_, &m_, &n_,
         A, &lda_,
@@ -49,6 +53,8 @@ void lacp2(
     double const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zlacp2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -62,6 +68,7 @@ void lacp2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlacp2(
         &uplo_, &m_, &n_,
         A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ void lacpy(
     float const* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "slacpy", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -34,6 +37,7 @@ void lacpy(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slacpy(
         &matrixtype_, &m_, &n_,
         A, &lda_,
@@ -51,6 +55,8 @@ void lacpy(
     double const* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dlacpy", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -64,6 +70,7 @@ void lacpy(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlacpy(
         &matrixtype_, &m_, &n_,
         A, &lda_,
@@ -81,6 +88,8 @@ void lacpy(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "clacpy", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -94,6 +103,7 @@ void lacpy(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clacpy(
         &matrixtype_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -145,6 +155,8 @@ void lacpy(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zlacpy", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -158,6 +170,7 @@ void lacpy(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlacpy(
         &matrixtype_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
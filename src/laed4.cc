@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t laed4(
     float* delta, float rho,
     float* lambda )
 {
+    LAPACK_INSTRUMENT( "slaed4", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -32,6 +35,7 @@ int64_t laed4(
     lapack_int i_ = (lapack_int) i + 1;  // change to 1-based
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slaed4(
         &n_, &i_,
         d,
@@ -104,6 +108,8 @@ int64_t laed4(
     double* delta, double rho,
     double* lambda )
 {
+    LAPACK_INSTRUMENT( "dlaed4", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -113,6 +119,7 @@ int64_t laed4(
     lapack_int i_ = (lapack_int) i + 1;  // change to 1-based
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlaed4(
         &n_, &i_,
         d,
@@ -0,0 +1,331 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "Ilp64Dispatch.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Maximum number of iterations per root, as in laed4.
+const int64_t laed4_native_maxit = 30;
+
+//------------------------------------------------------------------------------
+// For j in [j1, j2), computes delta[ j ] = (d[ j ] - d0) - tau and sums
+//     sum  += z_j^2 / delta_j,
+//     dsum += (z_j / delta_j)^2,
+//     err  += (|j - jref| + 1) |z_j^2 / delta_j|,
+// where err bounds the rounding error of the sum as laed4 does: the sum of
+// the absolute values of the partial sums, accumulated away from the pole,
+// each term counted once per partial sum it is in.
+// Unlike laed4's loops, the sums are reductions, so they vectorize.
+template <typename scalar_t>
+void laed4_sums(
+    int64_t j1, int64_t j2, int64_t jref,
+    scalar_t const* d, scalar_t const* z, scalar_t d0, scalar_t tau,
+    scalar_t* delta,
+    scalar_t* sum, scalar_t* dsum, scalar_t* err )
+{
+    scalar_t s = 0, ds = 0, e = 0;
+    #ifdef _OPENMP
+    #pragma omp simd reduction( +: s, ds, e )
+    #endif
+    for (int64_t j = j1; j < j2; ++j) {
+        scalar_t dj = (d[ j ] - d0) - tau;
+        delta[ j ] = dj;
+        scalar_t t = z[ j ] / dj;
+        scalar_t zt = z[ j ] * t;
+        int jj = int( j - jref );
+        s  += zt;
+        ds += t * t;
+        e  += scalar_t( (jj < 0 ? -jj : jj) + 1 ) * std::abs( zt );
+    }
+    *sum  += s;
+    *dsum += ds;
+    *err  += e;
+}
+
+//------------------------------------------------------------------------------
+// Native root finder for the i-th root of the secular equation
+//     f(lambda) = 1/rho + sum_j z_j^2 / (d_j - lambda) = 0,
+// for n >= 3, using the fixed weight method of laed4. Lambda is kept as
+// d0 + tau, where the origin d0 is the pole nearer the root, so
+// delta_j = (d_j - d0) - tau is accurate, as laed3 needs for the
+// eigenvectors. At each step, f is modeled by its origin term, which is
+// kept exactly, plus c + S / (d_far - lambda) for all other terms, where
+// d_far is the adjacent pole on the other side and c and S match f and f'.
+// The model's root is solved for tau itself, rather than for a correction
+// to tau, so roots very close to the origin are not lost to cancellation.
+// Steps that leave the bracket bisect it.
+// Returns 0, or 1 if it did not converge in laed4_native_maxit steps.
+template <typename scalar_t>
+int64_t laed4_native(
+    int64_t n, int64_t i,
+    scalar_t const* d, scalar_t const* z,
+    scalar_t* delta, scalar_t rho,
+    scalar_t* lambda )
+{
+    const scalar_t eps = std::numeric_limits< scalar_t >::epsilon();
+    const scalar_t rhoinv = 1 / rho;
+
+    // Choose the origin ii, the other pole ifar, and the bracket [lb, ub]
+    // for tau. The last root is in (d[n-1], d[n-1] + rho z^T z].
+    // Otherwise, the root is in (d[i], d[i+1]); the sign of f at the
+    // midpoint gives the nearer pole.
+    int64_t ii, ifar;
+    scalar_t lb, ub, tau;
+    if (i == n-1) {
+        scalar_t ztz = 0;
+        for (int64_t j = 0; j < n; ++j)
+            ztz += z[ j ] * z[ j ];
+        ii = n-1;
+        ifar = n-2;
+        lb = 0;
+        ub = rho * ztz;
+        tau = ub;
+    }
+    else {
+        scalar_t mid = (d[ i+1 ] - d[ i ]) / 2;
+        scalar_t f = 0, df = 0, err = 0;
+        laed4_sums( 0, n, 0, d, z, d[ i ], mid, delta, &f, &df, &err );
+        if (rhoinv + f >= 0) {
+            ii = i;
+            ifar = i+1;
+            lb = 0;
+            ub = mid;
+            tau = mid;
+        }
+        else {
+            ii = i+1;
+            ifar = i;
+            lb = -mid;
+            ub = 0;
+            tau = -mid;
+        }
+    }
+    const scalar_t d0 = d[ ii ];
+    const scalar_t s = z[ ii ]*z[ ii ];
+    const scalar_t dist = std::abs( d[ ifar ] - d0 );
+    // +1 if the root is right of the origin, -1 if left
+    const scalar_t sign = (ii == i ? 1 : -1);
+
+    for (int64_t iter = 0; iter <= laed4_native_maxit; ++iter) {
+        // psi is the sum over poles left of the origin, phi right of it
+        scalar_t psi = 0, dpsi = 0, phi = 0, dphi = 0, err = 0;
+        laed4_sums( 0, ii, ii-1, d, z, d0, tau, delta, &psi, &dpsi, &err );
+        laed4_sums( ii+1, n, ii+1, d, z, d0, tau, delta, &phi, &dphi, &err );
+        delta[ ii ] = -tau;
+        scalar_t t = z[ ii ] / delta[ ii ];
+        scalar_t w = rhoinv + psi + phi + z[ ii ]*t;
+        scalar_t erretm = 8*(std::abs( psi ) + std::abs( phi )) + err
+                        + 2*rhoinv + 3*std::abs( z[ ii ]*t )
+                        + std::abs( tau )*(dpsi + dphi + t*t);
+
+        if (std::abs( w ) <= eps*erretm
+            || ub - lb <= eps*max( std::abs( lb ), std::abs( ub ) )) {
+            *lambda = d0 + tau;
+            return 0;
+        }
+        if (iter == laed4_native_maxit)
+            break;
+
+        if (w <= 0)
+            lb = max( lb, tau );
+        else
+            ub = min( ub, tau );
+
+        // Model, with y = |tau| the distance from the origin:
+        // between the poles, c - s/y + S/(dist - y) = 0, for c = sign*cw;
+        // for the last root, cw - s/y - S/(dist + y) = 0.
+        // Both are quadratics in y with one root in range, taken in the
+        // form that avoids cancellation.
+        scalar_t dfar = delta[ ifar ];
+        scalar_t S = dfar*dfar*(dpsi + dphi);
+        scalar_t cw = w - z[ ii ]*t - S/dfar;
+        scalar_t y = -1;
+        if (i < n-1) {
+            // c y^2 - a y + s dist = 0
+            scalar_t c = sign*cw;
+            scalar_t a = c*dist + s + S;
+            scalar_t sq = std::sqrt( std::abs( a*a - 4*c*s*dist ) );
+            if (a >= 0)
+                y = 2*s*dist / (a + sq);
+            else
+                y = (a - sq) / (2*c);
+        }
+        else if (cw > 0) {
+            // cw y^2 + b y - s dist = 0
+            scalar_t b = cw*dist - s - S;
+            scalar_t sq = std::sqrt( b*b + 4*cw*s*dist );
+            if (b <= 0)
+                y = (sq - b) / (2*cw);
+            else
+                y = 2*s*dist / (b + sq);
+        }
+        scalar_t tau_new = sign*y;
+        if (! (lb < tau_new && tau_new < ub))
+            tau_new = lb + (ub - lb) / 2;
+        if (tau_new == tau) {
+            // converged to working precision
+            *lambda = d0 + tau;
+            return 0;
+        }
+        tau = tau_new;
+    }
+    *lambda = d0 + tau;
+    return 1;
+}
+
+//------------------------------------------------------------------------------
+// Computes all n roots, one per loop iteration, in parallel.
+// Deltas go into the columns of delta, or into per-thread workspace if
+// delta is null. Returns the first failure, as in laed4_all.
+template <typename scalar_t>
+int64_t laed4_all(
+    int64_t n,
+    scalar_t const* d, scalar_t const* z, scalar_t rho,
+    scalar_t* lambda,
+    scalar_t* delta, int64_t lddelta,
+    bool native )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( delta != nullptr && lddelta < max( 1, n ) );
+    lapack_error_if( ! native && exceeds_lapack_int( { n } ) );
+
+    // LAPACK's laed5 conventions for n <= 2
+    if (n <= 2)
+        native = false;
+
+    int64_t info = 0;
+    #ifdef _OPENMP
+    #pragma omp parallel
+    #endif
+    {
+        std::vector< scalar_t > work( delta == nullptr ? n : 0 );
+
+        #ifdef _OPENMP
+        #pragma omp for schedule( static )
+        #endif
+        for (int64_t i = 0; i < n; ++i) {
+            scalar_t* delta_i = (delta == nullptr ? work.data()
+                                                  : &delta[ i*lddelta ]);
+            int64_t info_i;
+            if (native)
+                info_i = laed4_native( n, i, d, z, delta_i, rho, &lambda[ i ] );
+            else
+                info_i = lapack::laed4( n, i, d, z, delta_i, rho, &lambda[ i ] );
+            if (info_i != 0) {
+                #ifdef _OPENMP
+                #pragma omp critical( lapack_laed4_all )
+                #endif
+                {
+                    if (info == 0 || i + 1 < info)
+                        info = i + 1;
+                }
+            }
+        }
+    }
+    return info;
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev_auxiliary
+int64_t laed4_all(
+    int64_t n,
+    float const* d, float const* z, float rho,
+    float* lambda,
+    float* delta, int64_t lddelta,
+    bool native )
+{
+    return internal::laed4_all( n, d, z, rho, lambda, delta, lddelta, native );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes all n updated eigenvalues of a symmetric rank-one modification
+/// to a diagonal matrix,
+/// \[
+///     diag( d ) + \rho z z^T,
+/// \]
+/// that is, all n roots of the secular equation, as n calls to
+/// `lapack::laed4`, one per root, but with the roots computed in parallel
+/// using OpenMP threads. As for laed4, d(i) < d(j) for i < j, and rho > 0.
+///
+/// The roots are independent, so the work is split evenly among threads.
+/// By default, each root calls laed4. With native = true, each root is
+/// instead found by a native implementation of laed4's fixed weight
+/// iteration, whose O(n) sums over the poles are vectorized reductions;
+/// the roots and deltas agree with laed4's to within laed4's error
+/// bound, not bitwise. For n <= 2, laed4 is always used.
+///
+/// Overloaded versions are available for
+/// `float`, `double`.
+///
+/// @param[in] n
+///     The length of d and z, and the number of roots.
+///
+/// @param[in] d
+///     The vector d of length n.
+///     The original eigenvalues. It is assumed that they are in
+///     order, d(i) < d(j) for i < j.
+///
+/// @param[in] z
+///     The vector z of length n.
+///     The components of the updating vector.
+///
+/// @param[in] rho
+///     The scalar in the symmetric updating formula.
+///
+/// @param[out] lambda
+///     The vector lambda of length n.
+///     lambda(i) is the i-th updated eigenvalue, in ascending order.
+///
+/// @param[out] delta
+///     The n-by-n matrix delta, stored in an lddelta-by-n array,
+///     or nullptr if the deltas are not needed.
+///     Column i holds the delta of `lapack::laed4` for root i:
+///     if n > 2, delta(j,i) = d(j) - lambda(i), which
+///     `lapack::laed3` and `lapack::laed9` use to construct the
+///     eigenvectors. If n = 1, delta = 1; if n = 2,
+///     see `lapack::laed5`.
+///
+/// @param[in] lddelta
+///     The leading dimension of the array delta.
+///     If delta is not nullptr, lddelta >= max(1,n).
+///
+/// @param[in] native
+///     - false: call laed4 for each root.
+///     - true:  use the native vectorized iteration, if n > 2.
+///
+/// @retval = 0: successful exit
+/// @retval > 0: if return value = i, the updating process failed for
+///     root i-1 (0-based), the first that failed; the other roots are
+///     still computed.
+///
+/// @see lapack::laed4
+///
+/// @ingroup heev_auxiliary
+int64_t laed4_all(
+    int64_t n,
+    double const* d, double const* z, double rho,
+    double* lambda,
+    double* delta, int64_t lddelta,
+    bool native )
+{
+    return internal::laed4_all( n, d, z, rho, lambda, delta, lddelta, native );
+}
+
+}  // namespace lapack
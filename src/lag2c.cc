@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t lag2c(
     std::complex<double> const* A, int64_t lda,
     std::complex<float>* SA, int64_t ldsa )
 {
+    LAPACK_INSTRUMENT( "zlag2c", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ int64_t lag2c(
     lapack_int ldsa_ = (lapack_int) ldsa;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlag2c(
         &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t lag2d(
     float const* SA, int64_t ldsa,
     double* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "slag2d", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ int64_t lag2d(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slag2d(
         &m_, &n_,
         SA, &ldsa_,
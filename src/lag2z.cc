@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t lag2z(
     std::complex<float> const* SA, int64_t ldsa,
     std::complex<double>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "clag2z", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ int64_t lag2z(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clag2z(
         &m_, &n_,
         (lapack_complex_float*) SA, &ldsa_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #ifdef LAPACK_HAVE_MATGEN
 
@@ -24,6 +25,8 @@ int64_t lagge(
     float* A, int64_t lda,
     int64_t* iseed )
 {
+    LAPACK_INSTRUMENT( "slagge", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -39,7 +42,8 @@ int64_t lagge(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( (4) );
+        std::copy( &iseed[0], &iseed[(4)], iseed_.begin() );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
@@ -49,6 +53,7 @@ int64_t lagge(
     // allocate workspace
     lapack::vector< float > work( (m+n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slagge(
         &m_, &n_, &kl_, &ku_,
         D,
@@ -71,6 +76,8 @@ int64_t lagge(
     double* A, int64_t lda,
     int64_t* iseed )
 {
+    LAPACK_INSTRUMENT( "dlagge", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -86,7 +93,8 @@ int64_t lagge(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( (4) );
+        std::copy( &iseed[0], &iseed[(4)], iseed_.begin() );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
@@ -96,6 +104,7 @@ int64_t lagge(
     // allocate workspace
     lapack::vector< double > work( (m+n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlagge(
         &m_, &n_, &kl_, &ku_,
         D,
@@ -118,6 +127,8 @@ int64_t lagge(
     std::complex<float>* A, int64_t lda,
     int64_t* iseed )
 {
+    LAPACK_INSTRUMENT( "clagge", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -133,7 +144,8 @@ int64_t lagge(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( (4) );
+        std::copy( &iseed[0], &iseed[(4)], iseed_.begin() );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
@@ -143,6 +155,7 @@ int64_t lagge(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (m+n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clagge(
         &m_, &n_, &kl_, &ku_,
         D,
@@ -165,6 +178,8 @@ int64_t lagge(
     std::complex<double>* A, int64_t lda,
     int64_t* iseed )
 {
+    LAPACK_INSTRUMENT( "zlagge", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -180,7 +195,8 @@ int64_t lagge(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( (4) );
+        std::copy( &iseed[0], &iseed[(4)], iseed_.begin() );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
@@ -190,6 +206,7 @@ int64_t lagge(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (m+n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlagge(
         &m_, &n_, &kl_, &ku_,
         D,
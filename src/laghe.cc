@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #ifdef LAPACK_HAVE_MATGEN
 
@@ -24,6 +25,8 @@ int64_t laghe(
     std::complex<float>* A, int64_t lda,
     int64_t* iseed )
 {
+    LAPACK_INSTRUMENT( "claghe", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,7 +38,8 @@ int64_t laghe(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( (4) );
+        std::copy( &iseed[0], &iseed[(4)], iseed_.begin() );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
@@ -45,6 +49,7 @@ int64_t laghe(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_claghe(
         &n_, &k_,
         D,
@@ -67,6 +72,8 @@ int64_t laghe(
     std::complex<double>* A, int64_t lda,
     int64_t* iseed )
 {
+    LAPACK_INSTRUMENT( "zlaghe", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -78,7 +85,8 @@ int64_t laghe(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( (4) );
+        std::copy( &iseed[0], &iseed[(4)], iseed_.begin() );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
@@ -88,6 +96,7 @@ int64_t laghe(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlaghe(
         &n_, &k_,
         D,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     float const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "slangb", 0, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -40,6 +43,7 @@ float langb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slangb(
         &norm_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -56,6 +60,8 @@ double langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     double const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "dlangb", 0, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -75,6 +81,7 @@ double langb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlangb(
         &norm_, &n_, &kl_, &ku_,
         AB, &ldab_,
@@ -91,6 +98,8 @@ float langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     std::complex<float> const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "clangb", 0, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -110,6 +119,7 @@ float langb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clangb(
         &norm_, &n_, &kl_, &ku_,
         (lapack_complex_float*) AB, &ldab_,
@@ -160,6 +170,8 @@ double langb(
     lapack::Norm norm, int64_t n, int64_t kl, int64_t ku,
     std::complex<double> const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "zlangb", 0, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -179,6 +191,7 @@ double langb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlangb(
         &norm_, &n_, &kl_, &ku_,
         (lapack_complex_double*) AB, &ldab_,
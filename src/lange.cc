@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lange(
     lapack::Norm norm, int64_t m, int64_t n,
     float const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "slange", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -38,6 +41,7 @@ float lange(
     // allocate workspace
     lapack::vector< float > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slange(
         &norm_, &m_, &n_,
         A, &lda_,
@@ -54,6 +58,8 @@ double lange(
     lapack::Norm norm, int64_t m, int64_t n,
     double const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dlange", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -71,6 +77,7 @@ double lange(
     // allocate workspace
     lapack::vector< double > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlange(
         &norm_, &m_, &n_,
         A, &lda_,
@@ -87,6 +94,8 @@ float lange(
     lapack::Norm norm, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "clange", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -104,6 +113,7 @@ float lange(
     // allocate workspace
     lapack::vector< float > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clange(
         &norm_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -147,6 +157,8 @@ double lange(
     lapack::Norm norm, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zlange", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -164,6 +176,7 @@ double lange(
     // allocate workspace
     lapack::vector< double > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlange(
         &norm_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ float langt(
     float const* D,
     float const* DU )
 {
+    LAPACK_INSTRUMENT( "slangt", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -29,6 +32,7 @@ float langt(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slangt(
         &norm_, &n_,
         DL,
@@ -48,6 +52,8 @@ double langt(
     double const* D,
     double const* DU )
 {
+    LAPACK_INSTRUMENT( "dlangt", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -55,6 +61,7 @@ double langt(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlangt(
         &norm_, &n_,
         DL,
@@ -74,6 +81,8 @@ float langt(
     std::complex<float> const* D,
     std::complex<float> const* DU )
 {
+    LAPACK_INSTRUMENT( "clangt", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -81,6 +90,7 @@ float langt(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clangt(
         &norm_, &n_,
         (lapack_complex_float*) DL,
@@ -130,6 +140,8 @@ double langt(
     std::complex<double> const* D,
     std::complex<double> const* DU )
 {
+    LAPACK_INSTRUMENT( "zlangt", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -137,6 +149,7 @@ double langt(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlangt(
         &norm_, &n_,
         (lapack_complex_double*) DL,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lanhb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float> const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "clanhb", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -39,6 +42,7 @@ float lanhb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clanhb(
         &norm_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -98,6 +102,8 @@ double lanhb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double> const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "zlanhb", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -116,6 +122,7 @@ double lanhb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlanhb(
         &norm_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
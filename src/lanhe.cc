@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lanhe(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "clanhe", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -37,6 +40,7 @@ float lanhe(
     // allocate workspace
     lapack::vector< float > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clanhe(
         &norm_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -98,6 +102,8 @@ double lanhe(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zlanhe", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -114,6 +120,7 @@ double lanhe(
     // allocate workspace
     lapack::vector< double > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlanhe(
         &norm_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
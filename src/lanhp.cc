@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lanhp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* AP )
 {
+    LAPACK_INSTRUMENT( "clanhp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ float lanhp(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clanhp(
         &norm_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -87,6 +91,8 @@ double lanhp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* AP )
 {
+    LAPACK_INSTRUMENT( "zlanhp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -101,6 +107,7 @@ double lanhp(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlanhp(
         &norm_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lanhs(
     lapack::Norm norm, int64_t n,
     float const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "slanhs", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ float lanhs(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slanhs(
         &norm_, &n_,
         A, &lda_,
@@ -52,6 +56,8 @@ double lanhs(
     lapack::Norm norm, int64_t n,
     double const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dlanhs", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -67,6 +73,7 @@ double lanhs(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlanhs(
         &norm_, &n_,
         A, &lda_,
@@ -83,6 +90,8 @@ float lanhs(
     lapack::Norm norm, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "clanhs", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -98,6 +107,7 @@ float lanhs(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clanhs(
         &norm_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -140,6 +150,8 @@ double lanhs(
     lapack::Norm norm, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zlanhs", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -155,6 +167,7 @@ double lanhs(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlanhs(
         &norm_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lanht(
     float const* D,
     std::complex<float> const* E )
 {
+    LAPACK_INSTRUMENT( "clanht", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -28,6 +31,7 @@ float lanht(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clanht(
         &norm_, &n_,
         D,
@@ -73,6 +77,8 @@ double lanht(
     double const* D,
     std::complex<double> const* E )
 {
+    LAPACK_INSTRUMENT( "zlanht", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -80,6 +86,7 @@ double lanht(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlanht(
         &norm_, &n_,
         D,
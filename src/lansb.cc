@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     float const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "slansb", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -39,6 +42,7 @@ float lansb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slansb(
         &norm_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -55,6 +59,8 @@ double lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     double const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "dlansb", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -73,6 +79,7 @@ double lansb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlansb(
         &norm_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -89,6 +96,8 @@ float lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float> const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "clansb", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -107,6 +116,7 @@ float lansb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clansb(
         &norm_, &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -164,6 +174,8 @@ double lansb(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double> const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "zlansb", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -182,6 +194,7 @@ double lansb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlansb(
         &norm_, &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
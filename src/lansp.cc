@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     float const* AP )
 {
+    LAPACK_INSTRUMENT( "slansp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ float lansp(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slansp(
         &norm_, &uplo_, &n_,
         AP,
@@ -51,6 +55,8 @@ double lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     double const* AP )
 {
+    LAPACK_INSTRUMENT( "dlansp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -65,6 +71,7 @@ double lansp(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlansp(
         &norm_, &uplo_, &n_,
         AP,
@@ -81,6 +88,8 @@ float lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* AP )
 {
+    LAPACK_INSTRUMENT( "clansp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -95,6 +104,7 @@ float lansp(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clansp(
         &norm_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -145,6 +155,8 @@ double lansp(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* AP )
 {
+    LAPACK_INSTRUMENT( "zlansp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -159,6 +171,7 @@ double lansp(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlansp(
         &norm_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lanst(
     float const* D,
     float const* E )
 {
+    LAPACK_INSTRUMENT( "slanst", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -28,6 +31,7 @@ float lanst(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slanst( &norm_, &n_, D, E
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
@@ -70,6 +74,8 @@ double lanst(
     double const* D,
     double const* E )
 {
+    LAPACK_INSTRUMENT( "dlanst", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -77,6 +83,7 @@ double lanst(
     char norm_ = norm2char( norm );
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlanst( &norm_, &n_, D, E
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
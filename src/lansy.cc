@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     float const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "slansy", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -37,6 +40,7 @@ float lansy(
     // allocate workspace
     lapack::vector< float > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slansy(
         &norm_, &uplo_, &n_,
         A, &lda_,
@@ -53,6 +57,8 @@ double lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     double const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dlansy", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -69,6 +75,7 @@ double lansy(
     // allocate workspace
     lapack::vector< double > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlansy(
         &norm_, &uplo_, &n_,
         A, &lda_,
@@ -85,6 +92,8 @@ float lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "clansy", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -101,6 +110,7 @@ float lansy(
     // allocate workspace
     lapack::vector< float > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clansy(
         &norm_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -159,6 +169,8 @@ double lansy(
     lapack::Norm norm, lapack::Uplo uplo, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zlansy", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -175,6 +187,7 @@ double lansy(
     // allocate workspace
     lapack::vector< double > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlansy(
         &norm_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
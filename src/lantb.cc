@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     float const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "slantb", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -40,6 +43,7 @@ float lantb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slantb(
         &norm_, &uplo_, &diag_, &n_, &k_,
         AB, &ldab_,
@@ -56,6 +60,8 @@ double lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     double const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "dlantb", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -75,6 +81,7 @@ double lantb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlantb(
         &norm_, &uplo_, &diag_, &n_, &k_,
         AB, &ldab_,
@@ -91,6 +98,8 @@ float lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     std::complex<float> const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "clantb", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -110,6 +119,7 @@ float lantb(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clantb(
         &norm_, &uplo_, &diag_, &n_, &k_,
         (lapack_complex_float*) AB, &ldab_,
@@ -173,6 +183,8 @@ double lantb(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n, int64_t k,
     std::complex<double> const* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "zlantb", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -192,6 +204,7 @@ double lantb(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlantb(
         &norm_, &uplo_, &diag_, &n_, &k_,
         (lapack_complex_double*) AB, &ldab_,
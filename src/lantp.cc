@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     float const* AP )
 {
+    LAPACK_INSTRUMENT( "slantp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ float lantp(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slantp(
         &norm_, &uplo_, &diag_, &n_,
         AP,
@@ -52,6 +56,8 @@ double lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     double const* AP )
 {
+    LAPACK_INSTRUMENT( "dlantp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -67,6 +73,7 @@ double lantp(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlantp(
         &norm_, &uplo_, &diag_, &n_,
         AP,
@@ -83,6 +90,8 @@ float lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<float> const* AP )
 {
+    LAPACK_INSTRUMENT( "clantp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -98,6 +107,7 @@ float lantp(
     // allocate workspace
     lapack::vector< float > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clantp(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_float*) AP,
@@ -153,6 +163,8 @@ double lantp(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<double> const* AP )
 {
+    LAPACK_INSTRUMENT( "zlantp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -168,6 +180,7 @@ double lantp(
     // allocate workspace
     lapack::vector< double > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlantp(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_double*) AP,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ float lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     float const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "slantr", m, n, 0 );
+
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
@@ -48,6 +51,7 @@ float lantr(
     // allocate workspace
     lapack::vector< float > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slantr(
         &norm_, &uplo_, &diag_, &m_, &n_,
         A, &lda_,
@@ -64,6 +68,8 @@ double lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     double const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dlantr", m, n, 0 );
+
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
@@ -91,6 +97,7 @@ double lantr(
     // allocate workspace
     lapack::vector< double > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlantr(
         &norm_, &uplo_, &diag_, &m_, &n_,
         A, &lda_,
@@ -107,6 +114,8 @@ float lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "clantr", m, n, 0 );
+
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
@@ -134,6 +143,7 @@ float lantr(
     // allocate workspace
     lapack::vector< float > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_clantr(
         &norm_, &uplo_, &diag_, &m_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -207,6 +217,8 @@ double lantr(
     lapack::Norm norm, lapack::Uplo uplo, lapack::Diag diag, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zlantr", m, n, 0 );
+
     lapack_error_if( lda < m );
 
     // Safeguard m, n.
@@ -234,6 +246,7 @@ double lantr(
     // allocate workspace
     lapack::vector< double > work( max( 1, lwork ) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_zlantr(
         &norm_, &uplo_, &diag_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
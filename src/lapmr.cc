@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30300  // >= v3.3
 
@@ -23,6 +24,8 @@ void lapmr(
     float* X, int64_t ldx,
     int64_t* K )
 {
+    LAPACK_INSTRUMENT( "slapmr", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -35,12 +38,14 @@ void lapmr(
     lapack_int ldx_ = (lapack_int) ldx;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(m)] );
+        lapack::vector< lapack_int > K_( (m) );
+        std::copy( &K[0], &K[(m)], K_.begin() );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
     #endif
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slapmr(
         &forwrd_, &m_, &n_,
         X, &ldx_,
@@ -56,6 +61,8 @@ void lapmr(
     double* X, int64_t ldx,
     int64_t* K )
 {
+    LAPACK_INSTRUMENT( "dlapmr", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -68,12 +75,14 @@ void lapmr(
     lapack_int ldx_ = (lapack_int) ldx;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(m)] );
+        lapack::vector< lapack_int > K_( (m) );
+        std::copy( &K[0], &K[(m)], K_.begin() );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
     #endif
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlapmr(
         &forwrd_, &m_, &n_,
         X, &ldx_,
@@ -89,6 +98,8 @@ void lapmr(
     std::complex<float>* X, int64_t ldx,
     int64_t* K )
 {
+    LAPACK_INSTRUMENT( "clapmr", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -101,12 +112,14 @@ void lapmr(
     lapack_int ldx_ = (lapack_int) ldx;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(m)] );
+        lapack::vector< lapack_int > K_( (m) );
+        std::copy( &K[0], &K[(m)], K_.begin() );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
     #endif
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clapmr(
         &forwrd_, &m_, &n_,
         (lapack_complex_float*) X, &ldx_,
@@ -122,6 +135,8 @@ void lapmr(
     std::complex<double>* X, int64_t ldx,
     int64_t* K )
 {
+    LAPACK_INSTRUMENT( "zlapmr", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -134,12 +149,14 @@ void lapmr(
     lapack_int ldx_ = (lapack_int) ldx;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(m)] );
+        lapack::vector< lapack_int > K_( (m) );
+        std::copy( &K[0], &K[(m)], K_.begin() );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
     #endif
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlapmr(
         &forwrd_, &m_, &n_,
         (lapack_complex_double*) X, &ldx_,
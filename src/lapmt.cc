@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ void lapmt(
     float* X, int64_t ldx,
     int64_t* K )
 {
+    LAPACK_INSTRUMENT( "slapmt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -33,12 +36,14 @@ void lapmt(
     lapack_int ldx_ = (lapack_int) ldx;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(n)] );
+        lapack::vector< lapack_int > K_( (n) );
+        std::copy( &K[0], &K[(n)], K_.begin() );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
     #endif
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slapmt(
         &forwrd_, &m_, &n_,
         X, &ldx_,
@@ -54,6 +59,8 @@ void lapmt(
     double* X, int64_t ldx,
     int64_t* K )
 {
+    LAPACK_INSTRUMENT( "dlapmt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -66,12 +73,14 @@ void lapmt(
     lapack_int ldx_ = (lapack_int) ldx;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(n)] );
+        lapack::vector< lapack_int > K_( (n) );
+        std::copy( &K[0], &K[(n)], K_.begin() );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
     #endif
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlapmt(
         &forwrd_, &m_, &n_,
         X, &ldx_,
@@ -87,6 +96,8 @@ void lapmt(
     std::complex<float>* X, int64_t ldx,
     int64_t* K )
 {
+    LAPACK_INSTRUMENT( "clapmt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -99,12 +110,14 @@ void lapmt(
     lapack_int ldx_ = (lapack_int) ldx;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(n)] );
+        lapack::vector< lapack_int > K_( (n) );
+        std::copy( &K[0], &K[(n)], K_.begin() );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
     #endif
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clapmt(
         &forwrd_, &m_, &n_,
         (lapack_complex_float*) X, &ldx_,
@@ -120,6 +133,8 @@ void lapmt(
     std::complex<double>* X, int64_t ldx,
     int64_t* K )
 {
+    LAPACK_INSTRUMENT( "zlapmt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -132,12 +147,14 @@ void lapmt(
     lapack_int ldx_ = (lapack_int) ldx;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > K_( &K[0], &K[(n)] );
+        lapack::vector< lapack_int > K_( (n) );
+        std::copy( &K[0], &K[(n)], K_.begin() );
         lapack_int* K_ptr = &K_[0];
     #else
         lapack_int* K_ptr = K;
     #endif
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlapmt(
         &forwrd_, &m_, &n_,
         (lapack_complex_double*) X, &ldx_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -19,6 +20,9 @@ using blas::real;
 float lapy2(
     float x, float y )
 {
+    LAPACK_INSTRUMENT( "slapy2", 0, 0, 0 );
+
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slapy2( &x, &y );
 }
 
@@ -38,6 +42,9 @@ float lapy2(
 double lapy2(
     double x, double y )
 {
+    LAPACK_INSTRUMENT( "dlapy2", 0, 0, 0 );
+
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlapy2( &x, &y );
 }
 
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -19,6 +20,9 @@ using blas::real;
 float lapy3(
     float x, float y, float z )
 {
+    LAPACK_INSTRUMENT( "slapy3", 0, 0, 0 );
+
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_slapy3( &x, &y, &z );
 }
 
@@ -40,6 +44,9 @@ float lapy3(
 double lapy3(
     double x, double y, double z )
 {
+    LAPACK_INSTRUMENT( "dlapy3", 0, 0, 0 );
+
+    LAPACK_INSTRUMENT_COMPUTE();
     return LAPACK_dlapy3( &x, &y, &z );
 }
 
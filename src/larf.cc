@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ void larf(
     float const* v, int64_t incv, float tau,
     float* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "slarf", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -41,6 +44,7 @@ void larf(
     // allocate workspace
     lapack::vector< float > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slarf(
         &side_, &m_, &n_,
         v, &incv_, &tau,
@@ -59,6 +63,8 @@ void larf(
     double const* v, int64_t incv, double tau,
     double* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "dlarf", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -78,6 +84,7 @@ void larf(
     // allocate workspace
     lapack::vector< double > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlarf(
         &side_, &m_, &n_,
         v, &incv_, &tau,
@@ -96,6 +103,8 @@ void larf(
     std::complex<float> const* v, int64_t incv, std::complex<float> tau,
     std::complex<float>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "clarf", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -115,6 +124,7 @@ void larf(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clarf(
         &side_, &m_, &n_,
         (lapack_complex_float*) v, &incv_, (lapack_complex_float*) &tau,
@@ -178,6 +188,8 @@ void larf(
     std::complex<double> const* v, int64_t incv, std::complex<double> tau,
     std::complex<double>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "zlarf", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -197,6 +209,7 @@ void larf(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlarf(
         &side_, &m_, &n_,
         (lapack_complex_double*) v, &incv_, (lapack_complex_double*) &tau,
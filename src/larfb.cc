@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ void larfb(
     float const* T, int64_t ldt,
     float* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "slarfb", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -51,6 +54,7 @@ void larfb(
     // allocate workspace
     lapack::vector< float > work( ldwork_ * k );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slarfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_,
         V, &ldv_,
@@ -72,6 +76,8 @@ void larfb(
     double const* T, int64_t ldt,
     double* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "dlarfb", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -98,6 +104,7 @@ void larfb(
     // allocate workspace
     lapack::vector< double > work( ldwork_ * k );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlarfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_,
         V, &ldv_,
@@ -120,6 +127,8 @@ void larfb(
     std::complex<float> const* T, int64_t ldt,
     std::complex<float>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "clarfb", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -146,6 +155,7 @@ void larfb(
     // allocate workspace
     lapack::vector< std::complex<float> > work( ldwork_ * k );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clarfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_,
         (lapack_complex_float*) V, &ldv_,
@@ -264,6 +274,8 @@ void larfb(
     std::complex<double> const* T, int64_t ldt,
     std::complex<double>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "zlarfb", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -290,6 +302,7 @@ void larfb(
     // allocate workspace
     lapack::vector< std::complex<double> > work( ldwork_ * k );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlarfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_,
         (lapack_complex_double*) V, &ldv_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ void larfg(
     float* X, int64_t incx,
     float* tau )
 {
+    LAPACK_INSTRUMENT( "slarfg", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -30,6 +33,7 @@ void larfg(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slarfg(
         &n_, alpha,
         X, &incx_, tau );
@@ -43,6 +47,8 @@ void larfg(
     double* X, int64_t incx,
     double* tau )
 {
+    LAPACK_INSTRUMENT( "dlarfg", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -51,6 +57,7 @@ void larfg(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlarfg(
         &n_, alpha,
         X, &incx_, tau );
@@ -64,6 +71,8 @@ void larfg(
     std::complex<float>* X, int64_t incx,
     std::complex<float>* tau )
 {
+    LAPACK_INSTRUMENT( "clarfg", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -72,6 +81,7 @@ void larfg(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clarfg(
         &n_, (lapack_complex_float*) alpha,
         (lapack_complex_float*) X, &incx_, (lapack_complex_float*) tau );
@@ -141,6 +151,8 @@ void larfg(
     std::complex<double>* X, int64_t incx,
     std::complex<double>* tau )
 {
+    LAPACK_INSTRUMENT( "zlarfg", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -149,6 +161,7 @@ void larfg(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlarfg(
         &n_, (lapack_complex_double*) alpha,
         (lapack_complex_double*) X, &incx_, (lapack_complex_double*) tau );
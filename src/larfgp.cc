@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30202  // >= 3.2.2
 
@@ -24,6 +25,8 @@ void larfgp(
     float* X, int64_t incx,
     float* tau )
 {
+    LAPACK_INSTRUMENT( "slarfgp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -32,6 +35,7 @@ void larfgp(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slarfgp(
         &n_, alpha,
         X, &incx_, tau );
@@ -45,6 +49,8 @@ void larfgp(
     double* X, int64_t incx,
     double* tau )
 {
+    LAPACK_INSTRUMENT( "dlarfgp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -53,6 +59,7 @@ void larfgp(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlarfgp(
         &n_, alpha,
         X, &incx_, tau );
@@ -66,6 +73,8 @@ void larfgp(
     std::complex<float>* X, int64_t incx,
     std::complex<float>* tau )
 {
+    LAPACK_INSTRUMENT( "clarfgp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -74,6 +83,7 @@ void larfgp(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clarfgp(
         &n_, (lapack_complex_float*) alpha,
         (lapack_complex_float*) X, &incx_, (lapack_complex_float*) tau );
@@ -143,6 +153,8 @@ void larfgp(
     std::complex<double>* X, int64_t incx,
     std::complex<double>* tau )
 {
+    LAPACK_INSTRUMENT( "zlarfgp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -151,6 +163,7 @@ void larfgp(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlarfgp(
         &n_, (lapack_complex_double*) alpha,
         (lapack_complex_double*) X, &incx_, (lapack_complex_double*) tau );
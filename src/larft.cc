@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ void larft(
     float const* tau,
     float* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "slarft", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -37,6 +40,7 @@ void larft(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int ldt_ = (lapack_int) ldt;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slarft(
         &direction_, &storev_, &n_, &k_,
         V, &ldv_,
@@ -57,6 +61,8 @@ void larft(
     double const* tau,
     double* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "dlarft", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -71,6 +77,7 @@ void larft(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int ldt_ = (lapack_int) ldt;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlarft(
         &direction_, &storev_, &n_, &k_,
         V, &ldv_,
@@ -91,6 +98,8 @@ void larft(
     std::complex<float> const* tau,
     std::complex<float>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "clarft", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -105,6 +114,7 @@ void larft(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int ldt_ = (lapack_int) ldt;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clarft(
         &direction_, &storev_, &n_, &k_,
         (lapack_complex_float*) V, &ldv_,
@@ -217,6 +227,8 @@ void larft(
     std::complex<double> const* tau,
     std::complex<double>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "zlarft", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -231,6 +243,7 @@ void larft(
     lapack_int ldv_ = (lapack_int) ldv;
     lapack_int ldt_ = (lapack_int) ldt;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlarft(
         &direction_, &storev_, &n_, &k_,
         (lapack_complex_double*) V, &ldv_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ void larfx(
     float const* v, float tau,
     float* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "slarfx", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -39,6 +42,7 @@ void larfx(
     // allocate workspace
     lapack::vector< float > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slarfx(
         &side_, &m_, &n_,
         v, &tau,
@@ -57,6 +61,8 @@ void larfx(
     double const* v, double tau,
     double* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "dlarfx", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -74,6 +80,7 @@ void larfx(
     // allocate workspace
     lapack::vector< double > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlarfx(
         &side_, &m_, &n_,
         v, &tau,
@@ -92,6 +99,8 @@ void larfx(
     std::complex<float> const* v, std::complex<float> tau,
     std::complex<float>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "clarfx", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -109,6 +118,7 @@ void larfx(
     // allocate workspace
     lapack::vector< std::complex<float> > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clarfx(
         &side_, &m_, &n_,
         (lapack_complex_float*) v, (lapack_complex_float*) &tau,
@@ -168,6 +178,8 @@ void larfx(
     std::complex<double> const* v, std::complex<double> tau,
     std::complex<double>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "zlarfx", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -185,6 +197,7 @@ void larfx(
     // allocate workspace
     lapack::vector< std::complex<double> > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlarfx(
         &side_, &m_, &n_,
         (lapack_complex_double*) v, (lapack_complex_double*) &tau,
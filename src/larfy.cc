@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
 
@@ -24,6 +25,8 @@ void larfy(
     float const* V, int64_t incv, float tau,
     float* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "slarfy", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -38,6 +41,7 @@ void larfy(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slarfy(
         &uplo_, &n_,
         V, &incv_, &tau,
@@ -56,6 +60,8 @@ void larfy(
     double const* V, int64_t incv, double tau,
     double* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "dlarfy", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -70,6 +76,7 @@ void larfy(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlarfy(
         &uplo_, &n_,
         V, &incv_, &tau,
@@ -88,6 +95,8 @@ void larfy(
     std::complex<float> const* V, int64_t incv, std::complex<float> tau,
     std::complex<float>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "clarfy", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -102,6 +111,7 @@ void larfy(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clarfy(
         &uplo_, &n_,
         (lapack_complex_float*) V, &incv_, (lapack_complex_float*) &tau,
@@ -163,6 +173,8 @@ void larfy(
     std::complex<double> const* V, int64_t incv, std::complex<double> tau,
     std::complex<double>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "zlarfy", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -177,6 +189,7 @@ void larfy(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlarfy(
         &uplo_, &n_,
         (lapack_complex_double*) V, &incv_, (lapack_complex_double*) &tau,
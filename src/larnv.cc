@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +23,8 @@ void larnv(
     int64_t* iseed, int64_t n,
     float* X )
 {
+    LAPACK_INSTRUMENT( "slarnv", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(idist) > std::numeric_limits<lapack_int>::max() );
@@ -29,13 +33,15 @@ void larnv(
     lapack_int idist_ = (lapack_int) idist;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( (4) );
+        std::copy( &iseed[0], &iseed[(4)], iseed_.begin() );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slarnv(
         &idist_,
         iseed_ptr, &n_,
@@ -52,6 +58,8 @@ void larnv(
     int64_t* iseed, int64_t n,
     double* X )
 {
+    LAPACK_INSTRUMENT( "dlarnv", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(idist) > std::numeric_limits<lapack_int>::max() );
@@ -60,13 +68,15 @@ void larnv(
     lapack_int idist_ = (lapack_int) idist;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( (4) );
+        std::copy( &iseed[0], &iseed[(4)], iseed_.begin() );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlarnv(
         &idist_,
         iseed_ptr, &n_,
@@ -83,6 +93,8 @@ void larnv(
     int64_t* iseed, int64_t n,
     std::complex<float>* X )
 {
+    LAPACK_INSTRUMENT( "clarnv", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(idist) > std::numeric_limits<lapack_int>::max() );
@@ -91,13 +103,15 @@ void larnv(
     lapack_int idist_ = (lapack_int) idist;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( (4) );
+        std::copy( &iseed[0], &iseed[(4)], iseed_.begin() );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clarnv(
         &idist_,
         iseed_ptr, &n_,
@@ -150,6 +164,8 @@ void larnv(
     int64_t* iseed, int64_t n,
     std::complex<double>* X )
 {
+    LAPACK_INSTRUMENT( "zlarnv", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(idist) > std::numeric_limits<lapack_int>::max() );
@@ -158,13 +174,15 @@ void larnv(
     lapack_int idist_ = (lapack_int) idist;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iseed_( &iseed[0], &iseed[(4)] );
+        lapack::vector< lapack_int > iseed_( (4) );
+        std::copy( &iseed[0], &iseed[(4)], iseed_.begin() );
         lapack_int* iseed_ptr = &iseed_[0];
     #else
         lapack_int* iseed_ptr = iseed;
     #endif
     lapack_int n_ = (lapack_int) n;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlarnv(
         &idist_,
         iseed_ptr, &n_,
@@ -4,6 +4,7 @@
 // the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
 
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 namespace lapack {
 
@@ -14,7 +15,9 @@ void lartg(
     float* sn,
     float* r )
 {
+    LAPACK_INSTRUMENT( "slartg", 0, 0, 0 );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slartg(
         &f, &g, cs, sn, r );
 }
@@ -26,7 +29,9 @@ void lartg(
     double* sn,
     double* r )
 {
+    LAPACK_INSTRUMENT( "dlartg", 0, 0, 0 );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlartg(
         &f, &g, cs, sn, r );
 }
@@ -38,7 +43,9 @@ void lartg(
     std::complex<float>* sn,
     std::complex<float>* r )
 {
+    LAPACK_INSTRUMENT( "clartg", 0, 0, 0 );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clartg(
         (lapack_complex_float*) &f,
         (lapack_complex_float*) &g,
@@ -54,7 +61,9 @@ void lartg(
     std::complex<double>* sn,
     std::complex<double>* r )
 {
+    LAPACK_INSTRUMENT( "zlartg", 0, 0, 0 );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlartg(
         (lapack_complex_double*) &f,
         (lapack_complex_double*) &g,
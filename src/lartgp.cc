@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30300  // >= v3.3
 
@@ -23,7 +24,9 @@ void lartgp(
     float* sn,
     float* r )
 {
+    LAPACK_INSTRUMENT( "slartgp", 0, 0, 0 );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slartgp(
         &f, &g, cs, sn, r );
 }
@@ -35,7 +38,9 @@ void lartgp(
     double* sn,
     double* r )
 {
+    LAPACK_INSTRUMENT( "dlartgp", 0, 0, 0 );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlartgp(
         &f, &g, cs, sn, r );
 }
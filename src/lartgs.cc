@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30300  // >= v3.3
 
@@ -22,7 +23,9 @@ void lartgs(
     float* cs,
     float* sn )
 {
+    LAPACK_INSTRUMENT( "slartgs", 0, 0, 0 );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slartgs(
         &x, &y, &sigma, cs, sn );
 }
@@ -33,7 +36,9 @@ void lartgs(
     double* cs,
     double* sn )
 {
+    LAPACK_INSTRUMENT( "dlartgs", 0, 0, 0 );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlartgs(
         &x, &y, &sigma, cs, sn );
 }
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
     float* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "slascl", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ int64_t lascl(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slascl(
         &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
         A, &lda_, &info_
@@ -55,6 +59,8 @@ int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
     double* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dlascl", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
@@ -71,6 +77,7 @@ int64_t lascl(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlascl(
         &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
         A, &lda_, &info_
@@ -90,6 +97,8 @@ int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, float cfrom, float cto, int64_t m, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "clascl", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
@@ -106,6 +115,7 @@ int64_t lascl(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clascl(
         &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
@@ -198,6 +208,8 @@ int64_t lascl(
     lapack::MatrixType matrixtype, int64_t kl, int64_t ku, double cfrom, double cto, int64_t m, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zlascl", m, n, kl );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(kl) > std::numeric_limits<lapack_int>::max() );
@@ -214,6 +226,7 @@ int64_t lascl(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlascl(
         &matrixtype_, &kl_, &ku_, &cfrom, &cto, &m_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, float offdiag, float diag,
     float* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "slaset", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -31,6 +34,7 @@ void laset(
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slaset(
         &matrixtype_, &m_, &n_, &offdiag, &diag,
         A, &lda_
@@ -46,6 +50,8 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, double offdiag, double diag,
     double* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dlaset", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -57,6 +63,7 @@ void laset(
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlaset(
         &matrixtype_, &m_, &n_, &offdiag, &diag,
         A, &lda_
@@ -72,6 +79,8 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, std::complex<float> offdiag, std::complex<float> diag,
     std::complex<float>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "claset", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -83,6 +92,7 @@ void laset(
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_claset(
         &matrixtype_, &m_, &n_, (lapack_complex_float*) &offdiag, (lapack_complex_float*) &diag,
         (lapack_complex_float*) A, &lda_
@@ -137,6 +147,8 @@ void laset(
     lapack::MatrixType matrixtype, int64_t m, int64_t n, std::complex<double> offdiag, std::complex<double> diag,
     std::complex<double>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zlaset", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -148,6 +160,7 @@ void laset(
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlaset(
         &matrixtype_, &m_, &n_, (lapack_complex_double*) &offdiag, (lapack_complex_double*) &diag,
         (lapack_complex_double*) A, &lda_
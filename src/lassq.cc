@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ void lassq(
     float* scale,
     float* sumsq )
 {
+    LAPACK_INSTRUMENT( "slassq", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -30,6 +33,7 @@ void lassq(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slassq(
         &n_,
         x, &incx_, scale, sumsq );
@@ -43,6 +47,8 @@ void lassq(
     double* scale,
     double* sumsq )
 {
+    LAPACK_INSTRUMENT( "dlassq", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -51,6 +57,7 @@ void lassq(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlassq(
         &n_,
         x, &incx_, scale, sumsq );
@@ -64,6 +71,8 @@ void lassq(
     float* scale,
     float* sumsq )
 {
+    LAPACK_INSTRUMENT( "classq", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -72,6 +81,7 @@ void lassq(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_classq(
         &n_,
         (lapack_complex_float*) x, &incx_, scale, sumsq );
@@ -126,6 +136,8 @@ void lassq(
     double* scale,
     double* sumsq )
 {
+    LAPACK_INSTRUMENT( "zlassq", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -134,6 +146,7 @@ void lassq(
     lapack_int n_ = (lapack_int) n;
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlassq(
         &n_,
         (lapack_complex_double*) x, &incx_, scale, sumsq );
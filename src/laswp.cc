@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ void laswp(
     float* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    LAPACK_INSTRUMENT( "slaswp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,13 +39,15 @@ void laswp(
     lapack_int k2_ = (lapack_int) k2;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
+        lapack::vector< lapack_int > ipiv_( (k1+(k2-k1)*std::abs(incx)) );
+        std::copy( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slaswp(
         &n_,
         A, &lda_, &k1_, &k2_,
@@ -56,6 +61,8 @@ void laswp(
     double* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    LAPACK_INSTRUMENT( "dlaswp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -70,13 +77,15 @@ void laswp(
     lapack_int k2_ = (lapack_int) k2;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
+        lapack::vector< lapack_int > ipiv_( (k1+(k2-k1)*std::abs(incx)) );
+        std::copy( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlaswp(
         &n_,
         A, &lda_, &k1_, &k2_,
@@ -90,6 +99,8 @@ void laswp(
     std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    LAPACK_INSTRUMENT( "claswp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -104,13 +115,15 @@ void laswp(
     lapack_int k2_ = (lapack_int) k2;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
+        lapack::vector< lapack_int > ipiv_( (k1+(k2-k1)*std::abs(incx)) );
+        std::copy( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_claswp(
         &n_,
         (lapack_complex_float*) A, &lda_, &k1_, &k2_,
@@ -162,6 +175,8 @@ void laswp(
     std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
     int64_t const* ipiv, int64_t incx )
 {
+    LAPACK_INSTRUMENT( "zlaswp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -176,17 +191,157 @@ void laswp(
     lapack_int k2_ = (lapack_int) k2;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))] );
+        lapack::vector< lapack_int > ipiv_( (k1+(k2-k1)*std::abs(incx)) );
+        std::copy( &ipiv[0], &ipiv[(k1+(k2-k1)*std::abs(incx))], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
     lapack_int incx_ = (lapack_int) incx;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlaswp(
         &n_,
         (lapack_complex_double*) A, &lda_, &k1_, &k2_,
         ipiv_ptr, &incx_ );
 }
 
+#ifndef LAPACK_ILP64
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    float* A, int64_t lda, int64_t k1, int64_t k2,
+    lapack_int const* ipiv, int64_t incx )
+{
+    LAPACK_INSTRUMENT( "slaswp", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int k1_ = (lapack_int) k1;
+    lapack_int k2_ = (lapack_int) k2;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_slaswp(
+        &n_,
+        A, &lda_, &k1_, &k2_,
+        ipiv, &incx_ );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    double* A, int64_t lda, int64_t k1, int64_t k2,
+    lapack_int const* ipiv, int64_t incx )
+{
+    LAPACK_INSTRUMENT( "dlaswp", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int k1_ = (lapack_int) k1;
+    lapack_int k2_ = (lapack_int) k2;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dlaswp(
+        &n_,
+        A, &lda_, &k1_, &k2_,
+        ipiv, &incx_ );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t k1, int64_t k2,
+    lapack_int const* ipiv, int64_t incx )
+{
+    LAPACK_INSTRUMENT( "claswp", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int k1_ = (lapack_int) k1;
+    lapack_int k2_ = (lapack_int) k2;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_claswp(
+        &n_,
+        (lapack_complex_float*) A, &lda_, &k1_, &k2_,
+        ipiv, &incx_ );
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::laswp` that takes 32-bit `lapack_int` pivots,
+/// which are passed to LAPACK directly, without converting to and
+/// from `int64_t` or allocating a temporary pivot array.
+/// The pivots can come from the `lapack_int` variant of
+/// `lapack::getrf`.
+/// Other arguments are the same as for
+/// `lapack::laswp`.
+///
+/// Available only when LAPACK uses 32-bit integers (LAPACK_ILP64
+/// not defined); otherwise `lapack_int` is `int64_t`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @ingroup gesv_computational
+void laswp(
+    int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t k1, int64_t k2,
+    lapack_int const* ipiv, int64_t incx )
+{
+    LAPACK_INSTRUMENT( "zlaswp", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(k2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(incx) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int k1_ = (lapack_int) k1;
+    lapack_int k2_ = (lapack_int) k2;
+    lapack_int incx_ = (lapack_int) incx;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_zlaswp(
+        &n_,
+        (lapack_complex_double*) A, &lda_, &k1_, &k2_,
+        ipiv, &incx_ );
+}
+
+#endif // LAPACK_ILP64
+
 }  // namespace lapack
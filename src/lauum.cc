@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t lauum(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "slauum", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -30,6 +33,7 @@ int64_t lauum(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_slauum(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -49,6 +53,8 @@ int64_t lauum(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dlauum", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -59,6 +65,7 @@ int64_t lauum(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dlauum(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -78,6 +85,8 @@ int64_t lauum(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "clauum", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -88,6 +97,7 @@ int64_t lauum(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_clauum(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
@@ -145,6 +155,8 @@ int64_t lauum(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zlauum", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -155,6 +167,7 @@ int64_t lauum(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zlauum(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t opgtr(
     float const* tau,
     float* Q, int64_t ldq )
 {
+    LAPACK_INSTRUMENT( "sopgtr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ int64_t opgtr(
     // allocate workspace
     lapack::vector< float > work( (n-1) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sopgtr(
         &uplo_, &n_,
         AP,
@@ -58,6 +62,8 @@ int64_t opgtr(
     double const* tau,
     double* Q, int64_t ldq )
 {
+    LAPACK_INSTRUMENT( "dopgtr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -71,6 +77,7 @@ int64_t opgtr(
     // allocate workspace
     lapack::vector< double > work( (n-1) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dopgtr(
         &uplo_, &n_,
         AP,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t opmtr(
     float const* tau,
     float* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "sopmtr", m, n, 0 );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -46,6 +49,7 @@ int64_t opmtr(
     // allocate workspace
     lapack::vector< float > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sopmtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         AP,
@@ -69,6 +73,8 @@ int64_t opmtr(
     double const* tau,
     double* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "dopmtr", m, n, 0 );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -93,6 +99,7 @@ int64_t opmtr(
     // allocate workspace
     lapack::vector< double > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dopmtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         AP,
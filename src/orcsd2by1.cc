@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30500  // >= 3.5
 
@@ -27,6 +28,63 @@ int64_t orcsd2by1(
     float* U2, int64_t ldu2,
     float* V1T, int64_t ldv1t )
 {
+    LAPACK_INSTRUMENT( "sorcsd2by1", m, 0, p );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    orcsd2by1_work_size( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21,
+                         theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                         &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return orcsd2by1_work( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21,
+                           ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                           work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t )
+{
+    LAPACK_INSTRUMENT( "dorcsd2by1", m, 0, p );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    orcsd2by1_work_size( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21, ldx21,
+                         theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                         &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return orcsd2by1_work( jobu1, jobu2, jobv1t, m, p, q, X11, ldx11, X21,
+                           ldx21, theta, U1, ldu1, U2, ldu2, V1T, ldv1t,
+                           work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+void orcsd2by1_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "sorcsd2by1_work_size", m, 0, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -72,13 +130,52 @@ int64_t orcsd2by1(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = max( 1, m - min( p, min( m-p, min( q, m-q ))) );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m - min( p, min( m-p, min( q, m-q )))) );
+// -----------------------------------------------------------------------------
+void orcsd2by1_work_size(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "dorcsd2by1_work_size", m, 0, p );
 
-    LAPACK_sorcsd2by1(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldx11) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldx21) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobu1_ = job_csd2char( jobu1 );
+    char jobu2_ = job_csd2char( jobu2 );
+    char jobv1t_ = job_csd2char( jobv1t );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int q_ = (lapack_int) q;
+    lapack_int ldx11_ = (lapack_int) ldx11;
+    lapack_int ldx21_ = (lapack_int) ldx21;
+    lapack_int ldu1_ = (lapack_int) ldu1;
+    lapack_int ldu2_ = (lapack_int) ldu2;
+    lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
         X11, &ldx11_,
         X21, &ldx21_,
@@ -86,8 +183,8 @@ int64_t orcsd2by1(
         U1, &ldu1_,
         U2, &ldu2_,
         V1T, &ldv1t_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        qry_work, &ineg_one,
+        qry_iwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -95,19 +192,24 @@ int64_t orcsd2by1(
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = max( 1, m - min( p, min( m-p, min( q, m-q ))) );
 }
 
 // -----------------------------------------------------------------------------
-int64_t orcsd2by1(
+int64_t orcsd2by1_work(
     lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
-    double* X11, int64_t ldx11,
-    double* X21, int64_t ldx21,
-    double* theta,
-    double* U1, int64_t ldu1,
-    double* U2, int64_t ldu2,
-    double* V1T, int64_t ldv1t )
+    float* X11, int64_t ldx11,
+    float* X21, int64_t ldx21,
+    float* theta,
+    float* U1, int64_t ldu1,
+    float* U2, int64_t ldu2,
+    float* V1T, int64_t ldv1t,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
 {
+    LAPACK_INSTRUMENT( "sorcsd2by1_work", m, 0, p );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -118,7 +220,9 @@ int64_t orcsd2by1(
         lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
+    lapack_error_if( liwork < m - min( p, min( m-p, min( q, m-q ))) );
     char jobu1_ = job_csd2char( jobu1 );
     char jobu2_ = job_csd2char( jobu2 );
     char jobv1t_ = job_csd2char( jobv1t );
@@ -130,13 +234,11 @@ int64_t orcsd2by1(
     lapack_int ldu1_ = (lapack_int) ldu1;
     lapack_int ldu2_ = (lapack_int) ldu2;
     lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dorcsd2by1(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
         X11, &ldx11_,
         X21, &ldx21_,
@@ -144,8 +246,8 @@ int64_t orcsd2by1(
         U1, &ldu1_,
         U2, &ldu2_,
         V1T, &ldv1t_,
-        qry_work, &ineg_one,
-        qry_iwork, &info_
+        work, &lwork_,
+        iwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
@@ -153,12 +255,51 @@ int64_t orcsd2by1(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m - min( p, min( m-p, min( q, m-q )))) );
+// -----------------------------------------------------------------------------
+int64_t orcsd2by1_work(
+    lapack::Job jobu1, lapack::Job jobu2, lapack::Job jobv1t, int64_t m, int64_t p, int64_t q,
+    double* X11, int64_t ldx11,
+    double* X21, int64_t ldx21,
+    double* theta,
+    double* U1, int64_t ldu1,
+    double* U2, int64_t ldu2,
+    double* V1T, int64_t ldv1t,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "dorcsd2by1_work", m, 0, p );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(p) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(q) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldx11) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldx21) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu1) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldu2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldv1t) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < m - min( p, min( m-p, min( q, m-q ))) );
+    char jobu1_ = job_csd2char( jobu1 );
+    char jobu2_ = job_csd2char( jobu2 );
+    char jobv1t_ = job_csd2char( jobv1t );
+    lapack_int m_ = (lapack_int) m;
+    lapack_int p_ = (lapack_int) p;
+    lapack_int q_ = (lapack_int) q;
+    lapack_int ldx11_ = (lapack_int) ldx11;
+    lapack_int ldx21_ = (lapack_int) ldx21;
+    lapack_int ldu1_ = (lapack_int) ldu1;
+    lapack_int ldu2_ = (lapack_int) ldu2;
+    lapack_int ldv1t_ = (lapack_int) ldv1t;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dorcsd2by1(
         &jobu1_, &jobu2_, &jobv1t_, &m_, &p_, &q_,
         X11, &ldx11_,
@@ -167,8 +308,8 @@ int64_t orcsd2by1(
         U1, &ldu1_,
         U2, &ldu2_,
         V1T, &ldv1t_,
-        &work[0], &lwork_,
-        &iwork[0], &info_
+        work, &lwork_,
+        iwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
         #endif
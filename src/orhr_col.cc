@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30900  // >= 3.9.0
 
@@ -24,6 +25,8 @@ int64_t orhr_col(
     float* T, int64_t ldt,
     float* D )
 {
+    LAPACK_INSTRUMENT( "sorhr_col", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -40,6 +43,7 @@ int64_t orhr_col(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sorhr_col(
         &m_, &n_, &nb_,
         A, &lda_,
@@ -144,6 +148,8 @@ int64_t orhr_col(
     double* T, int64_t ldt,
     double* D )
 {
+    LAPACK_INSTRUMENT( "dorhr_col", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -159,6 +165,7 @@ int64_t orhr_col(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dorhr_col(
         &m_, &n_, &nb_,
         A, &lda_,
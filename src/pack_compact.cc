@@ -0,0 +1,138 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "Batch.hh"
+#include "Compact.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void pack_compact(
+    int64_t m, int64_t n,
+    std::vector< scalar_t* > const& Aarray, int64_t lda,
+    scalar_t* Ac,
+    size_t batch )
+{
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    check_batch_array( Aarray, batch );
+
+    const int64_t w = compact_width< scalar_t >();
+    const scalar_t zero = 0;
+    const scalar_t one  = 1;
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        scalar_t* Ag = &Ac[ g*m*n*w ];
+        for (int64_t l = 0; l < w; ++l) {
+            int64_t b = g*w + l;
+            if (b < int64_t( batch )) {
+                scalar_t const* A = Aarray[ b ];
+                for (int64_t j = 0; j < n; ++j)
+                    for (int64_t i = 0; i < m; ++i)
+                        Ag[ (i + j*m)*w + l ] = A[ i + j*lda ];
+            }
+            else {
+                // pad with identity
+                for (int64_t j = 0; j < n; ++j)
+                    for (int64_t i = 0; i < m; ++i)
+                        Ag[ (i + j*m)*w + l ] = (i == j ? one : zero);
+            }
+        }
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup auxiliary
+void pack_compact(
+    int64_t m, int64_t n,
+    std::vector< float* > const& Aarray, int64_t lda,
+    float* Ac,
+    size_t batch )
+{
+    internal::pack_compact( m, n, Aarray, lda, Ac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup auxiliary
+void pack_compact(
+    int64_t m, int64_t n,
+    std::vector< double* > const& Aarray, int64_t lda,
+    double* Ac,
+    size_t batch )
+{
+    internal::pack_compact( m, n, Aarray, lda, Ac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup auxiliary
+void pack_compact(
+    int64_t m, int64_t n,
+    std::vector< std::complex<float>* > const& Aarray, int64_t lda,
+    std::complex<float>* Ac,
+    size_t batch )
+{
+    internal::pack_compact( m, n, Aarray, lda, Ac, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// Converts a batch of m-by-n column-major matrices A_i to compact
+/// format, interleaving groups of `lapack::compact_width` matrices so
+/// compact routines such as `lapack::getrf_compact` vectorize across
+/// the matrices of each group. See lapack/compact.hh for the layout.
+/// The last group is padded with identity matrices.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in] Aarray
+///     Array of batch pointers to the matrices A_i, each stored in an
+///     lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[out] Ac
+///     The compact batch, of length
+///     `lapack::compact_size< scalar_t >( m, n, batch )`.
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @throws Error if any argument is invalid.
+///
+/// @ingroup auxiliary
+void pack_compact(
+    int64_t m, int64_t n,
+    std::vector< std::complex<double>* > const& Aarray, int64_t lda,
+    std::complex<double>* Ac,
+    size_t batch )
+{
+    internal::pack_compact( m, n, Aarray, lda, Ac, batch );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t pbcon(
     float const* AB, int64_t ldab, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "spbcon", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -38,6 +41,7 @@ int64_t pbcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spbcon(
         &uplo_, &n_, &kd_,
         AB, &ldab_, &anorm, rcond,
@@ -60,6 +64,8 @@ int64_t pbcon(
     double const* AB, int64_t ldab, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "dpbcon", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -76,6 +82,7 @@ int64_t pbcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpbcon(
         &uplo_, &n_, &kd_,
         AB, &ldab_, &anorm, rcond,
@@ -98,6 +105,8 @@ int64_t pbcon(
     std::complex<float> const* AB, int64_t ldab, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "cpbcon", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -114,6 +123,7 @@ int64_t pbcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpbcon(
         &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_, &anorm, rcond,
@@ -181,6 +191,8 @@ int64_t pbcon(
     std::complex<double> const* AB, int64_t ldab, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "zpbcon", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -197,6 +209,7 @@ int64_t pbcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpbcon(
         &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_, &anorm, rcond,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t pbequ(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "spbequ", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ int64_t pbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spbequ(
         &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -58,6 +62,8 @@ int64_t pbequ(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "dpbequ", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -70,6 +76,7 @@ int64_t pbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpbequ(
         &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -93,6 +100,8 @@ int64_t pbequ(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "cpbequ", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -105,6 +114,7 @@ int64_t pbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpbequ(
         &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_,
@@ -180,6 +190,8 @@ int64_t pbequ(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "zpbequ", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -192,6 +204,7 @@ int64_t pbequ(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpbequ(
         &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_,
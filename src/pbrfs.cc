@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -26,6 +27,8 @@ int64_t pbrfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "spbrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -50,6 +53,7 @@ int64_t pbrfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spbrfs(
         &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -81,6 +85,8 @@ int64_t pbrfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dpbrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -105,6 +111,7 @@ int64_t pbrfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpbrfs(
         &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -136,6 +143,8 @@ int64_t pbrfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "cpbrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -160,6 +169,7 @@ int64_t pbrfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpbrfs(
         &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -269,6 +279,8 @@ int64_t pbrfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "zpbrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -293,6 +305,7 @@ int64_t pbrfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpbrfs(
         &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t pbstf(
     lapack::Uplo uplo, int64_t n, int64_t kd,
     float* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "spbstf", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -32,6 +35,7 @@ int64_t pbstf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spbstf(
         &uplo_, &n_, &kd_,
         AB, &ldab_, &info_
@@ -51,6 +55,8 @@ int64_t pbstf(
     lapack::Uplo uplo, int64_t n, int64_t kd,
     double* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "dpbstf", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -63,6 +69,7 @@ int64_t pbstf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpbstf(
         &uplo_, &n_, &kd_,
         AB, &ldab_, &info_
@@ -82,6 +89,8 @@ int64_t pbstf(
     lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<float>* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "cpbstf", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -94,6 +103,7 @@ int64_t pbstf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpbstf(
         &uplo_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_, &info_
@@ -209,6 +219,8 @@ int64_t pbstf(
     lapack::Uplo uplo, int64_t n, int64_t kd,
     std::complex<double>* AB, int64_t ldab )
 {
+    LAPACK_INSTRUMENT( "zpbstf", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -221,6 +233,7 @@ int64_t pbstf(
     lapack_int ldab_ = (lapack_int) ldab;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpbstf(
         &uplo_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_, &info_
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t pbsv(
     float* AB, int64_t ldab,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "spbsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -37,6 +40,7 @@ int64_t pbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spbsv(
         &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -58,6 +62,8 @@ int64_t pbsv(
     double* AB, int64_t ldab,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dpbsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -74,6 +80,7 @@ int64_t pbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpbsv(
         &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -95,6 +102,8 @@ int64_t pbsv(
     std::complex<float>* AB, int64_t ldab,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "cpbsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -111,6 +120,7 @@ int64_t pbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpbsv(
         &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -220,6 +230,8 @@ int64_t pbsv(
     std::complex<double>* AB, int64_t ldab,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zpbsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -236,6 +248,7 @@ int64_t pbsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpbsv(
         &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
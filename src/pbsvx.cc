@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -29,6 +30,8 @@ int64_t pbsvx(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "spbsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -55,6 +58,7 @@ int64_t pbsvx(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spbsvx(
         &fact_, &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -92,6 +96,8 @@ int64_t pbsvx(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dpbsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -118,6 +124,7 @@ int64_t pbsvx(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpbsvx(
         &fact_, &uplo_, &n_, &kd_, &nrhs_,
         AB, &ldab_,
@@ -155,6 +162,8 @@ int64_t pbsvx(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "cpbsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -181,6 +190,7 @@ int64_t pbsvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpbsvx(
         &fact_, &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_float*) AB, &ldab_,
@@ -416,6 +426,8 @@ int64_t pbsvx(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "zpbsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -442,6 +454,7 @@ int64_t pbsvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpbsvx(
         &fact_, &uplo_, &n_, &kd_, &nrhs_,
         (lapack_complex_double*) AB, &ldab_,
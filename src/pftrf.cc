@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -19,6 +20,8 @@ int64_t pftrf(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     float* A )
 {
+    LAPACK_INSTRUMENT( "spftrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -28,6 +31,7 @@ int64_t pftrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spftrf(
         &transr_, &uplo_, &n_,
         A, &info_
@@ -46,6 +50,8 @@ int64_t pftrf(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     double* A )
 {
+    LAPACK_INSTRUMENT( "dpftrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -55,6 +61,7 @@ int64_t pftrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpftrf(
         &transr_, &uplo_, &n_,
         A, &info_
@@ -73,6 +80,8 @@ int64_t pftrf(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A )
 {
+    LAPACK_INSTRUMENT( "cpftrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -82,6 +91,7 @@ int64_t pftrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpftrf(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) A, &info_
@@ -100,6 +110,8 @@ int64_t pftrf(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A )
 {
+    LAPACK_INSTRUMENT( "zpftrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -109,6 +121,7 @@ int64_t pftrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpftrf(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) A, &info_
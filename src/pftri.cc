@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -19,6 +20,8 @@ int64_t pftri(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     float* A )
 {
+    LAPACK_INSTRUMENT( "spftri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -28,6 +31,7 @@ int64_t pftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spftri(
         &transr_, &uplo_, &n_,
         A, &info_
@@ -46,6 +50,8 @@ int64_t pftri(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     double* A )
 {
+    LAPACK_INSTRUMENT( "dpftri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -55,6 +61,7 @@ int64_t pftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpftri(
         &transr_, &uplo_, &n_,
         A, &info_
@@ -73,6 +80,8 @@ int64_t pftri(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     std::complex<float>* A )
 {
+    LAPACK_INSTRUMENT( "cpftri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -82,6 +91,7 @@ int64_t pftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpftri(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) A, &info_
@@ -100,6 +110,8 @@ int64_t pftri(
     lapack::Op transr, lapack::Uplo uplo, int64_t n,
     std::complex<double>* A )
 {
+    LAPACK_INSTRUMENT( "zpftri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -109,6 +121,7 @@ int64_t pftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpftri(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) A, &info_
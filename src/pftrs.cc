@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t pftrs(
     float const* A,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "spftrs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ int64_t pftrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spftrs(
         &transr_, &uplo_, &n_, &nrhs_,
         A,
@@ -53,6 +57,8 @@ int64_t pftrs(
     double const* A,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dpftrs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -66,6 +72,7 @@ int64_t pftrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpftrs(
         &transr_, &uplo_, &n_, &nrhs_,
         A,
@@ -86,6 +93,8 @@ int64_t pftrs(
     std::complex<float> const* A,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "cpftrs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -99,6 +108,7 @@ int64_t pftrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpftrs(
         &transr_, &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A,
@@ -119,6 +129,8 @@ int64_t pftrs(
     std::complex<double> const* A,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zpftrs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -132,6 +144,7 @@ int64_t pftrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpftrs(
         &transr_, &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A,
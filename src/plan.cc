@@ -0,0 +1,520 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/plan.hh"
+#include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+#include "Dispatch.hh"
+#include "Instrument.hh"
+
+#include <utility>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+//==============================================================================
+namespace internal {
+
+// Low-level overloads call Fortran with arguments already converted by
+// the plans. Real versions ignore rwork, so the plans need not branch.
+
+//------------------------------------------------------------------------------
+inline void heevd(
+    char jobz, char uplo, lapack_int n,
+    float* A, lapack_int lda, float* W,
+    float* work, lapack_int lwork,
+    float* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork, lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "ssyevd_plan", 0, n, 0 );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dispatch( ssyevd, n )(
+        &jobz, &uplo, &n, A, &lda, W,
+        work, &lwork, iwork, &liwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+}
+
+inline void heevd(
+    char jobz, char uplo, lapack_int n,
+    double* A, lapack_int lda, double* W,
+    double* work, lapack_int lwork,
+    double* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork, lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "dsyevd_plan", 0, n, 0 );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dispatch( dsyevd, n )(
+        &jobz, &uplo, &n, A, &lda, W,
+        work, &lwork, iwork, &liwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+}
+
+inline void heevd(
+    char jobz, char uplo, lapack_int n,
+    std::complex<float>* A, lapack_int lda, float* W,
+    std::complex<float>* work, lapack_int lwork,
+    float* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork, lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "cheevd_plan", 0, n, 0 );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dispatch( cheevd, n )(
+        &jobz, &uplo, &n, (lapack_complex_float*) A, &lda, W,
+        (lapack_complex_float*) work, &lwork,
+        rwork, &lrwork, iwork, &liwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+}
+
+inline void heevd(
+    char jobz, char uplo, lapack_int n,
+    std::complex<double>* A, lapack_int lda, double* W,
+    std::complex<double>* work, lapack_int lwork,
+    double* rwork, lapack_int lrwork,
+    lapack_int* iwork, lapack_int liwork, lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "zheevd_plan", 0, n, 0 );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dispatch( zheevd, n )(
+        &jobz, &uplo, &n, (lapack_complex_double*) A, &lda, W,
+        (lapack_complex_double*) work, &lwork,
+        rwork, &lrwork, iwork, &liwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+}
+
+//------------------------------------------------------------------------------
+inline void gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    float* A, lapack_int lda, float* S,
+    float* U, lapack_int ldu, float* VT, lapack_int ldvt,
+    float* work, lapack_int lwork, float* rwork, lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "sgesvd_plan", m, n, 0 );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgesvd(
+        &jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, VT, &ldvt,
+        work, &lwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+}
+
+inline void gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    double* A, lapack_int lda, double* S,
+    double* U, lapack_int ldu, double* VT, lapack_int ldvt,
+    double* work, lapack_int lwork, double* rwork, lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "dgesvd_plan", m, n, 0 );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgesvd(
+        &jobu, &jobvt, &m, &n, A, &lda, S, U, &ldu, VT, &ldvt,
+        work, &lwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+}
+
+inline void gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    std::complex<float>* A, lapack_int lda, float* S,
+    std::complex<float>* U, lapack_int ldu,
+    std::complex<float>* VT, lapack_int ldvt,
+    std::complex<float>* work, lapack_int lwork, float* rwork,
+    lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "cgesvd_plan", m, n, 0 );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgesvd(
+        &jobu, &jobvt, &m, &n, (lapack_complex_float*) A, &lda, S,
+        (lapack_complex_float*) U, &ldu, (lapack_complex_float*) VT, &ldvt,
+        (lapack_complex_float*) work, &lwork, rwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+}
+
+inline void gesvd(
+    char jobu, char jobvt, lapack_int m, lapack_int n,
+    std::complex<double>* A, lapack_int lda, double* S,
+    std::complex<double>* U, lapack_int ldu,
+    std::complex<double>* VT, lapack_int ldvt,
+    std::complex<double>* work, lapack_int lwork, double* rwork,
+    lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "zgesvd_plan", m, n, 0 );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_zgesvd(
+        &jobu, &jobvt, &m, &n, (lapack_complex_double*) A, &lda, S,
+        (lapack_complex_double*) U, &ldu, (lapack_complex_double*) VT, &ldvt,
+        (lapack_complex_double*) work, &lwork, rwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+}
+
+//------------------------------------------------------------------------------
+inline void gels(
+    char trans, lapack_int m, lapack_int n, lapack_int nrhs,
+    float* A, lapack_int lda, float* B, lapack_int ldb,
+    float* work, lapack_int lwork, lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "sgels_plan", m, n, nrhs );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_sgels(
+        &trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+inline void gels(
+    char trans, lapack_int m, lapack_int n, lapack_int nrhs,
+    double* A, lapack_int lda, double* B, lapack_int ldb,
+    double* work, lapack_int lwork, lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "dgels_plan", m, n, nrhs );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dgels(
+        &trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+inline void gels(
+    char trans, lapack_int m, lapack_int n, lapack_int nrhs,
+    std::complex<float>* A, lapack_int lda,
+    std::complex<float>* B, lapack_int ldb,
+    std::complex<float>* work, lapack_int lwork, lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "cgels_plan", m, n, nrhs );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_cgels(
+        &trans, &m, &n, &nrhs,
+        (lapack_complex_float*) A, &lda, (lapack_complex_float*) B, &ldb,
+        (lapack_complex_float*) work, &lwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+inline void gels(
+    char trans, lapack_int m, lapack_int n, lapack_int nrhs,
+    std::complex<double>* A, lapack_int lda,
+    std::complex<double>* B, lapack_int ldb,
+    std::complex<double>* work, lapack_int lwork, lapack_int* info )
+{
+    LAPACK_INSTRUMENT( "zgels_plan", m, n, nrhs );
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_zgels(
+        &trans, &m, &n, &nrhs,
+        (lapack_complex_double*) A, &lda, (lapack_complex_double*) B, &ldb,
+        (lapack_complex_double*) work, &lwork, info
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+Plan< scalar_t >::~Plan()
+{
+    release();
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+Plan< scalar_t >::Plan( Plan&& other ) noexcept
+{
+    *this = std::move( other );
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+Plan< scalar_t >& Plan< scalar_t >::operator = ( Plan&& other ) noexcept
+{
+    if (this != &other) {
+        release();
+        std::swap( work_,   other.work_   );
+        std::swap( rwork_,  other.rwork_  );
+        std::swap( iwork_,  other.iwork_  );
+        std::swap( lwork_,  other.lwork_  );
+        std::swap( lrwork_, other.lrwork_ );
+        std::swap( liwork_, other.liwork_ );
+    }
+    return *this;
+}
+
+//------------------------------------------------------------------------------
+/// Allocates workspace of the given lengths, which persists until the
+/// plan is destroyed. This uses the heap directly, following the
+/// AllocPolicy, but bypassing the per-thread arena, since a plan outlives
+/// the call that creates it.
+/// Each length is set right after its allocation, so if a later
+/// allocation throws, release frees what was allocated with its size.
+template <typename scalar_t>
+void Plan< scalar_t >::allocate( int64_t lwork, int64_t lrwork, int64_t liwork )
+{
+    release();
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    if (lwork > 0) {
+        work_ = static_cast< scalar_t* >(
+            internal::workspace_malloc( lwork * sizeof(scalar_t) ) );
+        lwork_ = (lapack_int) lwork;
+    }
+    if (lrwork > 0) {
+        rwork_ = static_cast< real_t* >(
+            internal::workspace_malloc( lrwork * sizeof(real_t) ) );
+        lrwork_ = (lapack_int) lrwork;
+    }
+    if (liwork > 0) {
+        iwork_ = static_cast< lapack_int* >(
+            internal::workspace_malloc( liwork * sizeof(lapack_int) ) );
+        liwork_ = (lapack_int) liwork;
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void Plan< scalar_t >::release()
+{
+    internal::workspace_free( work_,  lwork_  * sizeof(scalar_t) );
+    internal::workspace_free( rwork_, lrwork_ * sizeof(real_t) );
+    internal::workspace_free( iwork_, liwork_ * sizeof(lapack_int) );
+    work_   = nullptr;
+    rwork_  = nullptr;
+    iwork_  = nullptr;
+    lwork_  = 0;
+    lrwork_ = 0;
+    liwork_ = 0;
+}
+
+//==============================================================================
+// heevd
+
+//------------------------------------------------------------------------------
+/// Checks arguments and queries and allocates workspace.
+/// Arrays are not referenced by the workspace query, so none are needed.
+template <typename scalar_t>
+HeevdPlan< scalar_t >::HeevdPlan(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n, int64_t lda )
+{
+    // check arguments; LAPACK's query would instead call xerbla
+    lapack_error_if( jobz != Job::NoVec && jobz != Job::Vec );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( n   > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( lda > std::numeric_limits<lapack_int>::max() );
+    }
+    jobz_ = job2char( jobz );
+    uplo_ = uplo2char( uplo );
+    n_    = (lapack_int) n;
+    lda_  = (lapack_int) lda;
+
+    int64_t lwork, lrwork, liwork;
+    heevd_work_size( jobz, uplo, n, (scalar_t*) nullptr, lda, (real_t*) nullptr,
+                     &lwork, &lrwork, &liwork );
+    this->allocate( lwork, lrwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// Computes eigenvalues W and, if jobz = Vec, eigenvectors of A,
+/// using the plan's workspace. See `lapack::heevd` for arguments.
+/// Arguments were checked and converted when the plan was created,
+/// so this calls LAPACK directly.
+template <typename scalar_t>
+int64_t HeevdPlan< scalar_t >::execute( scalar_t* A, real_t* W )
+{
+    lapack_int info_ = 0;
+    internal::heevd( jobz_, uplo_, n_, A, lda_, W,
+                     this->work_,  this->lwork_,
+                     this->rwork_, this->lrwork_,
+                     this->iwork_, this->liwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+//==============================================================================
+// gesvd
+
+//------------------------------------------------------------------------------
+/// Checks arguments and queries and allocates workspace.
+template <typename scalar_t>
+GesvdPlan< scalar_t >::GesvdPlan(
+    lapack::Job jobu, lapack::Job jobvt, int64_t m, int64_t n,
+    int64_t lda, int64_t ldu, int64_t ldvt )
+{
+    // check arguments; LAPACK's query would instead call xerbla
+    lapack_error_if( jobu != Job::AllVec && jobu != Job::SomeVec
+                     && jobu != Job::OverwriteVec && jobu != Job::NoVec );
+    lapack_error_if( jobvt != Job::AllVec && jobvt != Job::SomeVec
+                     && jobvt != Job::OverwriteVec && jobvt != Job::NoVec );
+    lapack_error_if( jobu == Job::OverwriteVec && jobvt == Job::OverwriteVec );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldu < 1 );
+    lapack_error_if( (jobu == Job::AllVec || jobu == Job::SomeVec) && ldu < m );
+    lapack_error_if( ldvt < 1 );
+    lapack_error_if( jobvt == Job::AllVec && ldvt < n );
+    lapack_error_if( jobvt == Job::SomeVec && ldvt < min( m, n ) );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( m    > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( n    > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( lda  > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( ldu  > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( ldvt > std::numeric_limits<lapack_int>::max() );
+    }
+    jobu_  = job2char( jobu );
+    jobvt_ = job2char( jobvt );
+    m_     = (lapack_int) m;
+    n_     = (lapack_int) n;
+    lda_   = (lapack_int) lda;
+    ldu_   = (lapack_int) ldu;
+    ldvt_  = (lapack_int) ldvt;
+
+    int64_t lwork, lrwork;
+    gesvd_work_size( jobu, jobvt, m, n, (scalar_t*) nullptr, lda,
+                     (real_t*) nullptr, (scalar_t*) nullptr, ldu,
+                     (scalar_t*) nullptr, ldvt, &lwork, &lrwork );
+    this->allocate( lwork, lrwork, 0 );
+}
+
+//------------------------------------------------------------------------------
+/// Computes the SVD of A using the plan's workspace.
+/// See `lapack::gesvd` for arguments.
+template <typename scalar_t>
+int64_t GesvdPlan< scalar_t >::execute(
+    scalar_t* A, real_t* S, scalar_t* U, scalar_t* VT )
+{
+    lapack_int info_ = 0;
+    internal::gesvd( jobu_, jobvt_, m_, n_, A, lda_, S, U, ldu_, VT, ldvt_,
+                     this->work_, this->lwork_, this->rwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+//==============================================================================
+// gels
+
+//------------------------------------------------------------------------------
+/// Checks arguments and queries and allocates workspace.
+template <typename scalar_t>
+GelsPlan< scalar_t >::GelsPlan(
+    lapack::Op trans, int64_t m, int64_t n, int64_t nrhs,
+    int64_t lda, int64_t ldb )
+{
+    // check arguments; LAPACK's query would instead call xerbla
+    lapack_error_if( trans != Op::NoTrans && trans != Op::Trans
+                     && trans != Op::ConjTrans );
+    lapack_error_if( blas::is_complex< scalar_t >::value && trans == Op::Trans );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    lapack_error_if( ldb < max( 1, m, n ) );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( m    > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( n    > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( nrhs > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( lda  > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( ldb  > std::numeric_limits<lapack_int>::max() );
+    }
+    // for real, map ConjTrans to Trans
+    trans_ = op2char( ! blas::is_complex< scalar_t >::value
+                      && trans == Op::ConjTrans ? Op::Trans : trans );
+    m_     = (lapack_int) m;
+    n_     = (lapack_int) n;
+    nrhs_  = (lapack_int) nrhs;
+    lda_   = (lapack_int) lda;
+    ldb_   = (lapack_int) ldb;
+
+    int64_t lwork;
+    gels_work_size( trans, m, n, nrhs, (scalar_t*) nullptr, lda,
+                    (scalar_t*) nullptr, ldb, &lwork );
+    this->allocate( lwork, 0, 0 );
+}
+
+//------------------------------------------------------------------------------
+/// Solves the least squares problem using the plan's workspace.
+/// See `lapack::gels` for arguments.
+template <typename scalar_t>
+int64_t GelsPlan< scalar_t >::execute( scalar_t* A, scalar_t* B )
+{
+    lapack_int info_ = 0;
+    internal::gels( trans_, m_, n_, nrhs_, A, lda_, B, ldb_,
+                    this->work_, this->lwork_, &info_ );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiations.
+template class Plan< float >;
+template class Plan< double >;
+template class Plan< std::complex<float> >;
+template class Plan< std::complex<double> >;
+
+template class HeevdPlan< float >;
+template class HeevdPlan< double >;
+template class HeevdPlan< std::complex<float> >;
+template class HeevdPlan< std::complex<double> >;
+
+template class GesvdPlan< float >;
+template class GesvdPlan< double >;
+template class GesvdPlan< std::complex<float> >;
+template class GesvdPlan< std::complex<double> >;
+
+template class GelsPlan< float >;
+template class GelsPlan< double >;
+template class GelsPlan< std::complex<float> >;
+template class GelsPlan< std::complex<double> >;
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t pocon(
     float const* A, int64_t lda, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "spocon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ int64_t pocon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spocon(
         &uplo_, &n_,
         A, &lda_, &anorm, rcond,
@@ -58,6 +62,8 @@ int64_t pocon(
     double const* A, int64_t lda, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "dpocon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -72,6 +78,7 @@ int64_t pocon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpocon(
         &uplo_, &n_,
         A, &lda_, &anorm, rcond,
@@ -94,6 +101,8 @@ int64_t pocon(
     std::complex<float> const* A, int64_t lda, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "cpocon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -108,6 +117,7 @@ int64_t pocon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpocon(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &anorm, rcond,
@@ -165,6 +175,8 @@ int64_t pocon(
     std::complex<double> const* A, int64_t lda, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "zpocon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -179,6 +191,7 @@ int64_t pocon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpocon(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &anorm, rcond,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t poequ(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "spoequ", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -32,6 +35,7 @@ int64_t poequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spoequ(
         &n_,
         A, &lda_,
@@ -51,6 +55,8 @@ int64_t poequ(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "dpoequ", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -60,6 +66,7 @@ int64_t poequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpoequ(
         &n_,
         A, &lda_,
@@ -79,6 +86,8 @@ int64_t poequ(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "cpoequ", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -88,6 +97,7 @@ int64_t poequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpoequ(
         &n_,
         (lapack_complex_float*) A, &lda_,
@@ -148,6 +158,8 @@ int64_t poequ(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "zpoequ", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -157,6 +169,7 @@ int64_t poequ(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpoequ(
         &n_,
         (lapack_complex_double*) A, &lda_,
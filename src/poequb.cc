@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t poequb(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "spoequb", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -32,6 +35,7 @@ int64_t poequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spoequb(
         &n_,
         A, &lda_,
@@ -51,6 +55,8 @@ int64_t poequb(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "dpoequb", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -60,6 +66,7 @@ int64_t poequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpoequb(
         &n_,
         A, &lda_,
@@ -79,6 +86,8 @@ int64_t poequb(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "cpoequb", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -88,6 +97,7 @@ int64_t poequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpoequb(
         &n_,
         (lapack_complex_float*) A, &lda_,
@@ -154,6 +164,8 @@ int64_t poequb(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "zpoequb", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -163,6 +175,7 @@ int64_t poequb(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpoequb(
         &n_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -26,6 +27,8 @@ int64_t porfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "sporfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -48,6 +51,7 @@ int64_t porfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sporfs(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -79,6 +83,8 @@ int64_t porfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dporfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -101,6 +107,7 @@ int64_t porfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dporfs(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -132,6 +139,8 @@ int64_t porfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "cporfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -154,6 +163,7 @@ int64_t porfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cporfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -262,6 +272,8 @@ int64_t porfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "zporfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -284,6 +296,7 @@ int64_t porfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zporfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #ifdef LAPACK_HAVE_XBLAS
 
@@ -32,6 +33,8 @@ int64_t porfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    LAPACK_INSTRUMENT( "sporfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -59,6 +62,7 @@ int64_t porfsx(
     lapack::vector< float > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sporfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         A, &lda_,
@@ -97,6 +101,8 @@ int64_t porfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    LAPACK_INSTRUMENT( "dporfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -124,6 +130,7 @@ int64_t porfsx(
     lapack::vector< double > work( (4*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dporfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         A, &lda_,
@@ -162,6 +169,8 @@ int64_t porfsx(
     float* err_bnds_comp, int64_t nparams,
     float* params )
 {
+    LAPACK_INSTRUMENT( "cporfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -189,6 +198,7 @@ int64_t porfsx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cporfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -487,6 +497,8 @@ int64_t porfsx(
     double* err_bnds_comp, int64_t nparams,
     double* params )
 {
+    LAPACK_INSTRUMENT( "zporfsx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -514,6 +526,7 @@ int64_t porfsx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zporfsx(
         &uplo_, &equed_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +24,29 @@ int64_t posv(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "sposv", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char uplo_ = uplo2char( uplo );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_sposv_64(
+                &uplo_, &n, &nrhs,
+                A, &lda,
+                B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +61,7 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sposv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -57,6 +83,29 @@ int64_t posv(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dposv", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char uplo_ = uplo2char( uplo );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_dposv_64(
+                &uplo_, &n, &nrhs,
+                A, &lda,
+                B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -71,6 +120,7 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dposv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -92,6 +142,29 @@ int64_t posv(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "cposv", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char uplo_ = uplo2char( uplo );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_cposv_64(
+                &uplo_, &n, &nrhs,
+                (lapack_complex_float*) A, &lda,
+                (lapack_complex_float*) B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -106,6 +179,7 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cposv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -186,6 +260,29 @@ int64_t posv(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zposv", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char uplo_ = uplo2char( uplo );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_zposv_64(
+                &uplo_, &n, &nrhs,
+                (lapack_complex_double*) A, &lda,
+                (lapack_complex_double*) B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -200,6 +297,7 @@ int64_t posv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zposv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -222,6 +320,8 @@ int64_t posv(
     double* X, int64_t ldx,
     int64_t* iter )
 {
+    LAPACK_INSTRUMENT( "dsposv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -243,6 +343,7 @@ int64_t posv(
     lapack::vector< double > work( (n)*(nrhs) );
     lapack::vector< float > swork( (n*(n+nrhs)) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsposv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -269,6 +370,8 @@ int64_t posv(
     std::complex<double>* X, int64_t ldx,
     int64_t* iter )
 {
+    LAPACK_INSTRUMENT( "zcposv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -291,6 +394,7 @@ int64_t posv(
     lapack::vector< std::complex<float> > swork( (n*(n+nrhs)) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zcposv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -29,6 +30,8 @@ int64_t posvx(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "sposvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -53,6 +56,7 @@ int64_t posvx(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sposvx(
         &fact_, &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -90,6 +94,8 @@ int64_t posvx(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dposvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -114,6 +120,7 @@ int64_t posvx(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dposvx(
         &fact_, &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -151,6 +158,8 @@ int64_t posvx(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "cposvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -175,6 +184,7 @@ int64_t posvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cposvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -381,6 +391,8 @@ int64_t posvx(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "zposvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -405,6 +417,7 @@ int64_t posvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zposvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
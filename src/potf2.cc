@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t potf2(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "spotf2", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -30,6 +33,7 @@ int64_t potf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spotf2(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -49,6 +53,8 @@ int64_t potf2(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dpotf2", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -59,6 +65,7 @@ int64_t potf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpotf2(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -78,6 +85,8 @@ int64_t potf2(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "cpotf2", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -88,6 +97,7 @@ int64_t potf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpotf2(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
@@ -152,6 +162,8 @@ int64_t potf2(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zpotf2", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -162,6 +174,7 @@ int64_t potf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpotf2(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
@@ -5,6 +5,10 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "lapack/recursive.hh"
+#include "Ilp64Dispatch.hh"
+#include "Dispatch.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,27 +24,56 @@ int64_t potrf(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
-
-    LAPACK_spotrf(
-        &uplo_, &n_,
-        A, &lda_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
+    LAPACK_INSTRUMENT( "spotrf", 0, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive Cholesky instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return potrf_recursive( uplo, n, A, lda );
+    #else
+        #ifdef LAPACK_HAVE_ILP64_DISPATCH
+            // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+            if (internal::use_ilp64( { n, lda, lda*n } )) {
+                char uplo_ = uplo2char( uplo );
+                int64_t info_ = 0;
+                LAPACK_INSTRUMENT_COMPUTE();
+                LAPACK_spotrf_64(
+                    &uplo_, &n,
+                    A, &lda, &info_
+                    #ifdef LAPACK_FORTRAN_STRLEN_END
+                    , 1
+                    #endif
+                );
+                if (info_ < 0) {
+                    throw Error();
+                }
+                return info_;
+            }
         #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        char uplo_ = uplo2char( uplo );
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( spotrf, n )(
+            &uplo_, &n_,
+            A, &lda_, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        return info_;
+    #endif
 }
 
 // -----------------------------------------------------------------------------
@@ -49,27 +82,56 @@ int64_t potrf(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
-
-    LAPACK_dpotrf(
-        &uplo_, &n_,
-        A, &lda_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
+    LAPACK_INSTRUMENT( "dpotrf", 0, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive Cholesky instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return potrf_recursive( uplo, n, A, lda );
+    #else
+        #ifdef LAPACK_HAVE_ILP64_DISPATCH
+            // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+            if (internal::use_ilp64( { n, lda, lda*n } )) {
+                char uplo_ = uplo2char( uplo );
+                int64_t info_ = 0;
+                LAPACK_INSTRUMENT_COMPUTE();
+                LAPACK_dpotrf_64(
+                    &uplo_, &n,
+                    A, &lda, &info_
+                    #ifdef LAPACK_FORTRAN_STRLEN_END
+                    , 1
+                    #endif
+                );
+                if (info_ < 0) {
+                    throw Error();
+                }
+                return info_;
+            }
         #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        char uplo_ = uplo2char( uplo );
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( dpotrf, n )(
+            &uplo_, &n_,
+            A, &lda_, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        return info_;
+    #endif
 }
 
 // -----------------------------------------------------------------------------
@@ -78,27 +140,56 @@ int64_t potrf(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
-
-    LAPACK_cpotrf(
-        &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
+    LAPACK_INSTRUMENT( "cpotrf", 0, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive Cholesky instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return potrf_recursive( uplo, n, A, lda );
+    #else
+        #ifdef LAPACK_HAVE_ILP64_DISPATCH
+            // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+            if (internal::use_ilp64( { n, lda, lda*n } )) {
+                char uplo_ = uplo2char( uplo );
+                int64_t info_ = 0;
+                LAPACK_INSTRUMENT_COMPUTE();
+                LAPACK_cpotrf_64(
+                    &uplo_, &n,
+                    (lapack_complex_float*) A, &lda, &info_
+                    #ifdef LAPACK_FORTRAN_STRLEN_END
+                    , 1
+                    #endif
+                );
+                if (info_ < 0) {
+                    throw Error();
+                }
+                return info_;
+            }
         #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        char uplo_ = uplo2char( uplo );
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( cpotrf, n )(
+            &uplo_, &n_,
+            (lapack_complex_float*) A, &lda_, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        return info_;
+    #endif
 }
 
 // -----------------------------------------------------------------------------
@@ -152,27 +243,56 @@ int64_t potrf(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
-    }
-    char uplo_ = uplo2char( uplo );
-    lapack_int n_ = (lapack_int) n;
-    lapack_int lda_ = (lapack_int) lda;
-    lapack_int info_ = 0;
-
-    LAPACK_zpotrf(
-        &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
+    LAPACK_INSTRUMENT( "zpotrf", 0, n, 0 );
+
+    #ifdef LAPACK_USE_RECURSIVE
+        // native recursive Cholesky instead of LAPACK; see lapack/recursive.hh
+        LAPACK_INSTRUMENT_COMPUTE();
+        return potrf_recursive( uplo, n, A, lda );
+    #else
+        #ifdef LAPACK_HAVE_ILP64_DISPATCH
+            // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+            if (internal::use_ilp64( { n, lda, lda*n } )) {
+                char uplo_ = uplo2char( uplo );
+                int64_t info_ = 0;
+                LAPACK_INSTRUMENT_COMPUTE();
+                LAPACK_zpotrf_64(
+                    &uplo_, &n,
+                    (lapack_complex_double*) A, &lda, &info_
+                    #ifdef LAPACK_FORTRAN_STRLEN_END
+                    , 1
+                    #endif
+                );
+                if (info_ < 0) {
+                    throw Error();
+                }
+                return info_;
+            }
         #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+
+        // check for overflow
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        }
+        char uplo_ = uplo2char( uplo );
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        lapack_int info_ = 0;
+
+        LAPACK_INSTRUMENT_COMPUTE();
+        LAPACK_dispatch( zpotrf, n )(
+            &uplo_, &n_,
+            (lapack_complex_double*) A, &lda_, &info_
+            #ifdef LAPACK_FORTRAN_STRLEN_END
+            , 1
+            #endif
+        );
+        if (info_ < 0) {
+            throw Error();
+        }
+        return info_;
+    #endif
 }
 
 }  // namespace lapack
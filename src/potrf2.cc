@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30600  // >= v3.6
 
@@ -22,6 +23,8 @@ int64_t potrf2(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "spotrf2", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -32,6 +35,7 @@ int64_t potrf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spotrf2(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -51,6 +55,8 @@ int64_t potrf2(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dpotrf2", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -61,6 +67,7 @@ int64_t potrf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpotrf2(
         &uplo_, &n_,
         A, &lda_, &info_
@@ -80,6 +87,8 @@ int64_t potrf2(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "cpotrf2", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -90,6 +99,7 @@ int64_t potrf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpotrf2(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
@@ -166,6 +176,8 @@ int64_t potrf2(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zpotrf2", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -176,6 +188,7 @@ int64_t potrf2(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpotrf2(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
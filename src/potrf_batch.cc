@@ -0,0 +1,256 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Pointer-array potrf_batch. batch_run balances the load when sizes vary,
+// using the Gflop count as the cost of each problem.
+template <typename scalar_t>
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    // check arguments
+    check_batch_arg( uplo, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( lda, batch );
+    check_batch_array( Aarray, batch );
+    for (size_t i = 0; i < batch; ++i) {
+        lapack::Uplo uplo_i = batch_arg( uplo, i );
+        int64_t n_i    = batch_arg( n,    i );
+        int64_t lda_i  = batch_arg( lda,  i );
+        lapack_error_if( uplo_i != Uplo::Lower && uplo_i != Uplo::Upper );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( lda_i < max( 1, n_i ) );
+        lapack_error_if( exceeds_lapack_int( { n_i, lda_i } ) );
+    }
+    info.resize( batch );
+
+    auto cost = [&]( size_t i ) {
+        return Gflop< scalar_t >::potrf( batch_arg( n, i ) );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        info[ i ] = lapack::potrf(
+            batch_arg( uplo, i ), batch_arg( n, i ),
+            Aarray[ i ], batch_arg( lda, i ) );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided potrf_batch. Problems are the same size, so a static schedule
+// balances the load.
+template <typename scalar_t>
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( batch > 1 && strideA < lda*n );
+    lapack_error_if( exceeds_lapack_int( { n, lda } ) );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        info[ i ] = lapack::potrf( uplo, n, &A[ i*strideA ], lda );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potrf_batch( uplo, n, Aarray, lda, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potrf_batch( uplo, n, Aarray, lda, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potrf_batch( uplo, n, Aarray, lda, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the Cholesky factorizations of a batch of Hermitian
+/// positive definite matrices, as in `lapack::potrf`:
+/// \[
+///     A_i = U_i^H U_i \text{ or } A_i = L_i L_i^H.
+/// \]
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of uplo, n, and lda has either one element, used for all
+/// problems, or batch elements. Problems run in parallel across OpenMP
+/// threads, largest first, to balance the load. A problem that fails,
+/// e.g., a matrix that is not positive definite, is reported in info
+/// without stopping the others.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n_i >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of batch pointers to the Hermitian matrices A_i, each stored
+///     in an lda_i-by-n_i array, with the triangle given by uplo_i.
+///     On exit, if info[i] = 0, the factor U_i or L_i.
+///
+/// @param[in] lda
+///     The leading dimension of each array A_i. lda_i >= max(1,n_i).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::potrf`
+///     for problem i:
+///     = 0: successful exit;
+///     > 0: if info[i] = j, the leading minor of order j of A_i is not
+///          positive definite, and the factorization could not be completed.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup posv_computational
+void potrf_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potrf_batch( uplo, n, Aarray, lda, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrf_batch( uplo, n, A, lda, strideA, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrf_batch( uplo, n, A, lda, strideA, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrf_batch( uplo, n, A, lda, strideA, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the Cholesky factorizations of a batch of n-by-n Hermitian
+/// positive definite matrices A_i, as in `lapack::potrf`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA.
+/// Problems run in parallel across OpenMP threads. A problem that fails
+/// is reported in info without stopping the others.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The Hermitian matrices A_i, each stored in an lda-by-n array,
+///     with the triangle given by uplo.
+///     On exit, if info[i] = 0, the factor U_i or L_i.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between consecutive matrices A_i. strideA >= lda*n.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::potrf` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup posv_computational
+void potrf_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrf_batch( uplo, n, A, lda, strideA, batch, info );
+}
+
+}  // namespace lapack
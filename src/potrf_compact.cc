@@ -0,0 +1,219 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "Compact.hh"
+
+#include <algorithm>
+#include <cmath>
+
+namespace lapack {
+
+using blas::real;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Unblocked left-looking Cholesky, as in potf2, of one group of n-by-n
+// matrices. A lane that is not positive definite records info[ l ] and
+// continues with a unit pivot, so the other lanes are unaffected; its
+// factor is then not meaningful past column info[ l ].
+template <typename scalar_t>
+void potrf_compact_group(
+    lapack::Uplo uplo, int64_t n, scalar_t* A, int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const int64_t w = compact_width< scalar_t >();
+    const real_t one = 1;
+
+    real_t d[ w ];
+    for (int64_t l = 0; l < w; ++l)
+        info[ l ] = 0;
+
+    for (int64_t j = 0; j < n; ++j) {
+        scalar_t* Aj = &A[ j*n*w ];  // column j
+        scalar_t* Ajj = &Aj[ j*w ];
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l)
+            d[ l ] = real( Ajj[ l ] );
+
+        if (uplo == Uplo::Upper) {
+            // U(0:j-1, j) = U(0:j-1, 0:j-1)^{-H} A(0:j-1, j)
+            for (int64_t i = 0; i < j; ++i) {
+                scalar_t const* Ai = &A[ i*n*w ];  // column i
+                for (int64_t k = 0; k < i; ++k) {
+                    LAPACK_COMPACT_SIMD
+                    for (int64_t l = 0; l < w; ++l) {
+                        Aj[ i*w + l ] -= mul_lane( conj_lane( Ai[ k*w + l ], true ),
+                                                   Aj[ k*w + l ] );
+                    }
+                }
+                LAPACK_COMPACT_SIMD
+                for (int64_t l = 0; l < w; ++l)
+                    Aj[ i*w + l ] = Aj[ i*w + l ] / real( Ai[ i*w + l ] );
+            }
+            // d = A(j, j) - ||U(0:j-1, j)||^2
+            for (int64_t k = 0; k < j; ++k) {
+                LAPACK_COMPACT_SIMD
+                for (int64_t l = 0; l < w; ++l)
+                    d[ l ] -= abs2_lane( Aj[ k*w + l ] );
+            }
+        }
+        else {
+            // d = A(j, j) - ||L(j, 0:j-1)||^2
+            for (int64_t k = 0; k < j; ++k) {
+                LAPACK_COMPACT_SIMD
+                for (int64_t l = 0; l < w; ++l)
+                    d[ l ] -= abs2_lane( A[ (j + k*n)*w + l ] );
+            }
+        }
+
+        for (int64_t l = 0; l < w; ++l) {
+            if (! (d[ l ] > 0)) {
+                if (info[ l ] == 0)
+                    info[ l ] = j + 1;
+                d[ l ] = one;
+            }
+        }
+        LAPACK_COMPACT_SIMD
+        for (int64_t l = 0; l < w; ++l) {
+            d[ l ] = std::sqrt( d[ l ] );
+            Ajj[ l ] = d[ l ];
+        }
+
+        if (uplo == Uplo::Lower) {
+            // L(j+1:n-1, j) = (A(j+1:n-1, j) - L(j+1:n-1, 0:j-1) L(j, 0:j-1)^H) / d
+            for (int64_t k = 0; k < j; ++k) {
+                scalar_t const* Ak = &A[ k*n*w ];  // column k
+                for (int64_t i = j+1; i < n; ++i) {
+                    LAPACK_COMPACT_SIMD
+                    for (int64_t l = 0; l < w; ++l) {
+                        Aj[ i*w + l ] -= mul_lane( Ak[ i*w + l ],
+                                                   conj_lane( Ak[ j*w + l ], true ) );
+                    }
+                }
+            }
+            for (int64_t i = j+1; i < n; ++i) {
+                LAPACK_COMPACT_SIMD
+                for (int64_t l = 0; l < w; ++l)
+                    Aj[ i*w + l ] = Aj[ i*w + l ] / d[ l ];
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void potrf_compact(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* Ac,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+
+    const int64_t w = compact_width< scalar_t >();
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        int64_t info_g[ w ];
+        potrf_compact_group( uplo, n, &Ac[ g*n*n*w ], info_g );
+        int64_t lanes = std::min( w, int64_t( batch ) - g*w );
+        for (int64_t l = 0; l < lanes; ++l)
+            info[ g*w + l ] = info_g[ l ];
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrf_compact(
+    lapack::Uplo uplo, int64_t n,
+    float* Ac,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrf_compact( uplo, n, Ac, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrf_compact(
+    lapack::Uplo uplo, int64_t n,
+    double* Ac,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrf_compact( uplo, n, Ac, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrf_compact(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* Ac,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrf_compact( uplo, n, Ac, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes Cholesky factorizations of a compact batch of n-by-n
+/// Hermitian positive definite matrices, as in `lapack::potrf`:
+/// $A_i = U_i^H U_i$ or $A_i = L_i L_i^H$.
+///
+/// The matrices are interleaved in groups of `lapack::compact_width`,
+/// as from `lapack::pack_compact`, and the factorization vectorizes
+/// across the matrices of each group. This is much faster than
+/// `lapack::potrf_batch` for small n, say n <= 16, where each matrix is
+/// too small to vectorize on its own. Groups run in parallel across
+/// OpenMP threads. Solve using `lapack::potrs_compact`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] Ac
+///     The compact batch of Hermitian matrices A_i, of length
+///     `lapack::compact_size< scalar_t >( n, n, batch )`.
+///     On exit, if info[i] = 0, the factor U_i or L_i in the triangle
+///     given by uplo; the other triangle is not referenced.
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @param[out] info
+///     The vector info of length batch.
+///     - = 0: successful exit
+///     - > 0: if info[i] = k, the leading minor of order k of A_i is not
+///       positive definite, and the factorization could not be completed.
+///
+/// @throws Error if any argument is invalid, before any problem is factored.
+///
+/// @ingroup posv_computational
+void potrf_compact(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* Ac,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrf_compact( uplo, n, Ac, batch, info );
+}
+
+}  // namespace lapack
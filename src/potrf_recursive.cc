@@ -0,0 +1,232 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/recursive.hh"
+
+#include <cmath>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Matrices of at most this order end the recursion and are factored
+// with unblocked loops, as in potf2.
+const int64_t potrf_recursive_nb = 32;
+
+//------------------------------------------------------------------------------
+// Unblocked right-looking Cholesky, as in potf2. Returns j+1 if the
+// leading minor of order j+1 is not positive definite, leaving that
+// diagonal element in A(j,j), as potf2 does.
+template <typename scalar_t>
+int64_t potrf_recursive_leaf(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    using blas::conj;
+    using real_t = blas::real_type< scalar_t >;
+
+    for (int64_t j = 0; j < n; ++j) {
+        real_t ajj = blas::real( A[ j + j*lda ] );
+        if (! (ajj > 0)) {
+            // not positive definite, or NaN
+            A[ j + j*lda ] = ajj;
+            return j + 1;
+        }
+        ajj = std::sqrt( ajj );
+        A[ j + j*lda ] = ajj;
+        real_t rcp = 1 / ajj;
+
+        if (uplo == Uplo::Lower) {
+            // scale column j, then A22 -= L21 L21^H, lower triangle
+            for (int64_t i = j+1; i < n; ++i)
+                A[ i + j*lda ] *= rcp;
+            for (int64_t k = j+1; k < n; ++k) {
+                scalar_t t = conj( A[ k + j*lda ] );
+                for (int64_t i = k; i < n; ++i)
+                    A[ i + k*lda ] -= A[ i + j*lda ] * t;
+            }
+        }
+        else {
+            // scale row j, then A22 -= U12^H U12, upper triangle
+            for (int64_t k = j+1; k < n; ++k)
+                A[ j + k*lda ] *= rcp;
+            for (int64_t k = j+1; k < n; ++k) {
+                scalar_t t = A[ j + k*lda ];
+                for (int64_t i = j+1; i <= k; ++i)
+                    A[ i + k*lda ] -= conj( A[ j + i*lda ] ) * t;
+            }
+        }
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Recursive Cholesky, as in potrf2, but stopping at potrf_recursive_nb.
+// For lower, A11 = L11 L11^H is factored, then L21 = A21 L11^{-H} with
+// trsm, A22 -= L21 L21^H with herk, and A22 is factored; upper is the
+// conjugate transpose.
+template <typename scalar_t>
+int64_t potrf_recursive(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda )
+{
+    using real_t = blas::real_type< scalar_t >;
+    const scalar_t one = 1;
+    const real_t r_one = 1;
+    if (n <= potrf_recursive_nb)
+        return potrf_recursive_leaf( uplo, n, A, lda );
+
+    int64_t n1 = n / 2;
+    int64_t n2 = n - n1;
+    scalar_t* A22 = &A[ n1 + n1*lda ];
+
+    int64_t info = potrf_recursive( uplo, n1, A, lda );
+    if (info != 0)
+        return info;
+
+    if (uplo == Uplo::Lower) {
+        scalar_t* A21 = &A[ n1 ];
+        blas::trsm( blas::Layout::ColMajor, blas::Side::Right, blas::Uplo::Lower,
+                    blas::Op::ConjTrans, blas::Diag::NonUnit, n2, n1,
+                    one, A, lda, A21, lda );
+        blas::herk( blas::Layout::ColMajor, blas::Uplo::Lower, blas::Op::NoTrans,
+                    n2, n1,
+                    -r_one, A21, lda,
+                     r_one, A22, lda );
+    }
+    else {
+        scalar_t* A12 = &A[ n1*lda ];
+        blas::trsm( blas::Layout::ColMajor, blas::Side::Left, blas::Uplo::Upper,
+                    blas::Op::ConjTrans, blas::Diag::NonUnit, n1, n2,
+                    one, A, lda, A12, lda );
+        blas::herk( blas::Layout::ColMajor, blas::Uplo::Upper, blas::Op::ConjTrans,
+                    n2, n1,
+                    -r_one, A12, lda,
+                     r_one, A22, lda );
+    }
+
+    info = potrf_recursive( uplo, n2, A22, lda );
+    if (info != 0)
+        return info + n1;
+
+    return 0;
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_recursive(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda )
+{
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    return internal::potrf_recursive( uplo, n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_recursive(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda )
+{
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    return internal::potrf_recursive( uplo, n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+int64_t potrf_recursive(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda )
+{
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    return internal::potrf_recursive( uplo, n, A, lda );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the Cholesky factorization of a Hermitian
+/// positive definite matrix A, as in `lapack::potrf`,
+/// with a native recursive algorithm instead of calling LAPACK.
+///
+/// The factorization has the form
+///     $A = U^H U,$ if uplo = Upper, or
+///     $A = L L^H,$ if uplo = Lower,
+/// where U is an upper triangular matrix and L is lower triangular.
+///
+/// As in `lapack::potrf2`, the matrix is split in half, $A_{11}$ is
+/// factored recursively, the off-diagonal block is solved with trsm,
+/// and the Schur complement, updated with herk (syrk for real), is
+/// factored recursively. Unlike potrf2, the recursion stops at order 32,
+/// which is factored with unblocked loops, as in `lapack::potf2`.
+/// Being cache oblivious, it needs no block size.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the Hermitian matrix A.
+///     - If uplo = Upper, the leading
+///     n-by-n upper triangular part of A contains the upper
+///     triangular part of the matrix A, and the strictly lower
+///     triangular part of A is not referenced.
+///
+///     - If uplo = Lower, the
+///     leading n-by-n lower triangular part of A contains the lower
+///     triangular part of the matrix A, and the strictly upper
+///     triangular part of A is not referenced.
+///
+///     - On successful exit, the factor U or L from the Cholesky
+///     factorization $A = U^H U$ or $A = L L^H.$
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, the leading minor of order i is not
+///     positive definite, and the factorization could not be
+///     completed.
+///
+/// @see lapack::potrf
+///
+/// @ingroup posv_computational
+int64_t potrf_recursive(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda )
+{
+    lapack_error_if( uplo != Uplo::Lower &&
+                     uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+
+    return internal::potrf_recursive( uplo, n, A, lda );
+}
+
+}  // namespace lapack
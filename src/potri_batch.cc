@@ -0,0 +1,256 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Pointer-array potri_batch. batch_run balances the load when sizes vary,
+// using the Gflop count as the cost of each problem.
+template <typename scalar_t>
+void potri_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    // check arguments
+    check_batch_arg( uplo, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( lda, batch );
+    check_batch_array( Aarray, batch );
+    for (size_t i = 0; i < batch; ++i) {
+        lapack::Uplo uplo_i = batch_arg( uplo, i );
+        int64_t n_i    = batch_arg( n,    i );
+        int64_t lda_i  = batch_arg( lda,  i );
+        lapack_error_if( uplo_i != Uplo::Lower && uplo_i != Uplo::Upper );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( lda_i < max( 1, n_i ) );
+        lapack_error_if( exceeds_lapack_int( { n_i, lda_i } ) );
+    }
+    info.resize( batch );
+
+    auto cost = [&]( size_t i ) {
+        return Gflop< scalar_t >::potri( batch_arg( n, i ) );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        info[ i ] = lapack::potri(
+            batch_arg( uplo, i ), batch_arg( n, i ),
+            Aarray[ i ], batch_arg( lda, i ) );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided potri_batch. Problems are the same size, so a static schedule
+// balances the load.
+template <typename scalar_t>
+void potri_batch(
+    lapack::Uplo uplo, int64_t n,
+    scalar_t* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( batch > 1 && strideA < lda*n );
+    lapack_error_if( exceeds_lapack_int( { n, lda } ) );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        info[ i ] = lapack::potri( uplo, n, &A[ i*strideA ], lda );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potri_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potri_batch( uplo, n, Aarray, lda, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potri_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potri_batch( uplo, n, Aarray, lda, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potri_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potri_batch( uplo, n, Aarray, lda, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the inverses of a batch of Hermitian positive definite
+/// matrices A_i, using the Cholesky factorizations
+/// $A_i = U_i^H U_i$ or $A_i = L_i L_i^H$ computed by
+/// `lapack::potrf_batch`, as in `lapack::potri`.
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of uplo, n, and lda has either one element, used for all
+/// problems, or batch elements. Problems run in parallel across OpenMP
+/// threads, largest first, to balance the load. A problem that fails,
+/// e.g., a matrix that is not positive definite, is reported in info
+/// without stopping the others.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n_i >= 0.
+///
+/// @param[in,out] Aarray
+///     Array of batch pointers to the factors U_i or L_i, each stored in
+///     an lda_i-by-n_i array. On exit, if info[i] = 0, the triangle of
+///     the inverse of A_i given by uplo_i.
+///
+/// @param[in] lda
+///     The leading dimension of each array A_i. lda_i >= max(1,n_i).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::potri`
+///     for problem i:
+///     = 0: successful exit;
+///     > 0: if info[i] = j, the (j,j) element of the factor U_i or L_i
+///          is zero, and the inverse could not be computed.
+///
+/// @throws Error if any argument is invalid, before any problem is inverted.
+///
+/// @ingroup posv_computational
+void potri_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potri_batch( uplo, n, Aarray, lda, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potri_batch(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potri_batch( uplo, n, A, lda, strideA, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potri_batch(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potri_batch( uplo, n, A, lda, strideA, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potri_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potri_batch( uplo, n, A, lda, strideA, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the inverses of a batch of n-by-n Hermitian positive definite
+/// matrices A_i, using the Cholesky factorizations computed by
+/// `lapack::potrf_batch`, as in `lapack::potri`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA.
+/// Problems run in parallel across OpenMP threads. A problem that fails
+/// is reported in info without stopping the others.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] A
+///     The factors U_i or L_i, each stored in an lda-by-n array.
+///     On exit, if info[i] = 0, the triangle of the inverse of A_i
+///     given by uplo.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between consecutive matrices A_i. strideA >= lda*n.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::potri` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is inverted.
+///
+/// @ingroup posv_computational
+void potri_batch(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda, int64_t strideA,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potri_batch( uplo, n, A, lda, strideA, batch, info );
+}
+
+}  // namespace lapack
@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Ilp64Dispatch.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +23,29 @@ int64_t potrs(
     float const* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "spotrs", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char uplo_ = uplo2char( uplo );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_spotrs_64(
+                &uplo_, &n, &nrhs,
+                A, &lda,
+                B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +60,7 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spotrs(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -56,6 +82,29 @@ int64_t potrs(
     double const* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dpotrs", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char uplo_ = uplo2char( uplo );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_dpotrs_64(
+                &uplo_, &n, &nrhs,
+                A, &lda,
+                B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -70,6 +119,7 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpotrs(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
@@ -91,6 +141,29 @@ int64_t potrs(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "cpotrs", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char uplo_ = uplo2char( uplo );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_cpotrs_64(
+                &uplo_, &n, &nrhs,
+                (lapack_complex_float*) A, &lda,
+                (lapack_complex_float*) B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -105,6 +178,7 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpotrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -162,6 +236,29 @@ int64_t potrs(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zpotrs", 0, n, nrhs );
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // too large for 32-bit lapack_int: call 64-bit integer LAPACK
+        if (internal::use_ilp64( { n, nrhs, lda, ldb, lda*n, ldb*nrhs } )) {
+            char uplo_ = uplo2char( uplo );
+            int64_t info_ = 0;
+            LAPACK_INSTRUMENT_COMPUTE();
+            LAPACK_zpotrs_64(
+                &uplo_, &n, &nrhs,
+                (lapack_complex_double*) A, &lda,
+                (lapack_complex_double*) B, &ldb, &info_
+                #ifdef LAPACK_FORTRAN_STRLEN_END
+                , 1
+                #endif
+            );
+            if (info_ < 0) {
+                throw Error();
+            }
+            return info_;
+        }
+    #endif
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -176,6 +273,7 @@ int64_t potrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpotrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -0,0 +1,306 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Pointer-array potrs_batch. batch_run balances the load when sizes vary,
+// using the Gflop count as the cost of each problem.
+template <typename scalar_t>
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< scalar_t* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    // check arguments
+    check_batch_arg( uplo, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( nrhs, batch );
+    check_batch_arg( lda, batch );
+    check_batch_arg( ldb, batch );
+    check_batch_array( Aarray, batch );
+    check_batch_array( Barray, batch );
+    for (size_t i = 0; i < batch; ++i) {
+        lapack::Uplo uplo_i = batch_arg( uplo, i );
+        int64_t n_i    = batch_arg( n,    i );
+        int64_t nrhs_i = batch_arg( nrhs, i );
+        int64_t lda_i  = batch_arg( lda,  i );
+        int64_t ldb_i  = batch_arg( ldb,  i );
+        lapack_error_if( uplo_i != Uplo::Lower && uplo_i != Uplo::Upper );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( nrhs_i < 0 );
+        lapack_error_if( lda_i < max( 1, n_i ) );
+        lapack_error_if( ldb_i < max( 1, n_i ) );
+        lapack_error_if( exceeds_lapack_int( { n_i, nrhs_i, lda_i, ldb_i } ) );
+    }
+    info.resize( batch );
+
+    auto cost = [&]( size_t i ) {
+        return Gflop< scalar_t >::potrs( batch_arg( n, i ), batch_arg( nrhs, i ) );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        info[ i ] = lapack::potrs(
+            batch_arg( uplo, i ), batch_arg( n, i ), batch_arg( nrhs, i ),
+            Aarray[ i ], batch_arg( lda, i ),
+            Barray[ i ], batch_arg( ldb, i ) );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided potrs_batch. Problems are the same size, so a static schedule
+// balances the load.
+template <typename scalar_t>
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( lda < max( 1, n ) );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch > 1 && strideA < lda*n );
+    lapack_error_if( batch > 1 && strideB < ldb*nrhs );
+    lapack_error_if( exceeds_lapack_int( { n, nrhs, lda, ldb } ) );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        info[ i ] = lapack::potrs(
+            uplo, n, nrhs, &A[ i*strideA ], lda, &B[ i*strideB ], ldb );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potrs_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potrs_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potrs_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations $A_i X_i = B_i$ with
+/// Hermitian positive definite matrices A_i, using the Cholesky
+/// factorizations $A_i = U_i^H U_i$ or $A_i = L_i L_i^H$ computed by
+/// `lapack::potrf_batch`, as in `lapack::potrs`.
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of uplo, n, nrhs, lda, and ldb has either one element, used for all
+/// problems, or batch elements. Problems run in parallel across OpenMP
+/// threads, largest first, to balance the load. A problem that fails,
+/// e.g., a matrix that is not positive definite, is reported in info
+/// without stopping the others.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n_i >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs_i >= 0.
+///
+/// @param[in] Aarray
+///     Array of batch pointers to the factors U_i or L_i, each stored in
+///     an lda_i-by-n_i array, from `lapack::potrf_batch`.
+///
+/// @param[in] lda
+///     The leading dimension of each array A_i. lda_i >= max(1,n_i).
+///
+/// @param[in,out] Barray
+///     Array of batch pointers to the right hand side matrices B_i,
+///     each stored in an ldb_i-by-nrhs_i array.
+///     On exit, the solution matrices X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each array B_i. ldb_i >= max(1,n_i).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::potrs`
+///     for problem i, which is 0 since arguments are checked beforehand.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup posv_computational
+void potrs_batch(
+    std::vector< lapack::Uplo > const& uplo,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& nrhs,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& Barray, std::vector< int64_t > const& ldb,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::potrs_batch( uplo, n, nrhs, Aarray, lda, Barray, ldb, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* A, int64_t lda, int64_t strideA,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrs_batch( uplo, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* A, int64_t lda, int64_t strideA,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrs_batch( uplo, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrs_batch( uplo, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                           batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a batch of systems of linear equations $A_i X_i = B_i$ with
+/// n-by-n Hermitian positive definite matrices A_i, using the Cholesky
+/// factorizations computed by `lapack::potrf_batch`, as in `lapack::potrs`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA and B_i = B + i*strideB.
+/// Problems run in parallel across OpenMP threads. A problem that fails
+/// is reported in info without stopping the others.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in] A
+///     The factors U_i or L_i, each stored in an lda-by-n array,
+///     from `lapack::potrf_batch`.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between consecutive matrices A_i. strideA >= lda*n.
+///
+/// @param[in,out] B
+///     The right hand side matrices B_i, each stored in an ldb-by-nrhs
+///     array. On exit, the solution matrices X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between consecutive matrices B_i. strideB >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::potrs` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup posv_computational
+void potrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::potrs_batch( uplo, n, nrhs, A, lda, strideA, B, ldb, strideB,
+                           batch, info );
+}
+
+}  // namespace lapack
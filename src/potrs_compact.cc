@@ -0,0 +1,134 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "Compact.hh"
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void potrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    scalar_t const* Ac,
+    scalar_t* Bc,
+    size_t batch )
+{
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+
+    const int64_t w = compact_width< scalar_t >();
+    const scalar_t one = 1;
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        scalar_t const* A = &Ac[ g*n*n*w ];
+        scalar_t* B = &Bc[ g*n*nrhs*w ];
+        if (uplo == Uplo::Upper) {
+            // solve U^H U X = B
+            trsm_compact_group( Uplo::Upper, Op::ConjTrans, Diag::NonUnit,
+                                n, nrhs, one, A, B, 1, n, false );
+            trsm_compact_group( Uplo::Upper, Op::NoTrans, Diag::NonUnit,
+                                n, nrhs, one, A, B, 1, n, false );
+        }
+        else {
+            // solve L L^H X = B
+            trsm_compact_group( Uplo::Lower, Op::NoTrans, Diag::NonUnit,
+                                n, nrhs, one, A, B, 1, n, false );
+            trsm_compact_group( Uplo::Lower, Op::ConjTrans, Diag::NonUnit,
+                                n, nrhs, one, A, B, 1, n, false );
+        }
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* Ac,
+    float* Bc,
+    size_t batch )
+{
+    internal::potrs_compact( uplo, n, nrhs, Ac, Bc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* Ac,
+    double* Bc,
+    size_t batch )
+{
+    internal::potrs_compact( uplo, n, nrhs, Ac, Bc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup posv_computational
+void potrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float> const* Ac,
+    std::complex<float>* Bc,
+    size_t batch )
+{
+    internal::potrs_compact( uplo, n, nrhs, Ac, Bc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a system of linear equations $A_i X_i = B_i$ for each problem
+/// of a compact batch, using the Cholesky factorizations from
+/// `lapack::potrf_compact`, as in `lapack::potrs`.
+/// The right-hand sides are interleaved like the matrices, as from
+/// `lapack::pack_compact`, and the solves vectorize across the problems
+/// of each group. Groups run in parallel across OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of each A_i is stored;
+///     - lapack::Uplo::Lower: Lower triangle of each A_i is stored.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns of
+///     each matrix B_i. nrhs >= 0.
+///
+/// @param[in] Ac
+///     The factors U_i or L_i from `lapack::potrf_compact`.
+///
+/// @param[in,out] Bc
+///     The compact batch of n-by-nrhs right hand side matrices B_i, of
+///     length `lapack::compact_size< scalar_t >( n, nrhs, batch )`.
+///     On exit, the solution matrices X_i.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup posv_computational
+void potrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double> const* Ac,
+    std::complex<double>* Bc,
+    size_t batch )
+{
+    internal::potrs_compact( uplo, n, nrhs, Ac, Bc, batch );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t ppcon(
     float const* AP, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "sppcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -34,6 +37,7 @@ int64_t ppcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sppcon(
         &uplo_, &n_,
         AP, &anorm, rcond,
@@ -56,6 +60,8 @@ int64_t ppcon(
     double const* AP, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "dppcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -68,6 +74,7 @@ int64_t ppcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dppcon(
         &uplo_, &n_,
         AP, &anorm, rcond,
@@ -90,6 +97,8 @@ int64_t ppcon(
     std::complex<float> const* AP, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "cppcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -102,6 +111,7 @@ int64_t ppcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cppcon(
         &uplo_, &n_,
         (lapack_complex_float*) AP, &anorm, rcond,
@@ -161,6 +171,8 @@ int64_t ppcon(
     std::complex<double> const* AP, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "zppcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -173,6 +185,7 @@ int64_t ppcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zppcon(
         &uplo_, &n_,
         (lapack_complex_double*) AP, &anorm, rcond,
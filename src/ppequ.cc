@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t ppequ(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "sppequ", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -31,6 +34,7 @@ int64_t ppequ(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sppequ(
         &uplo_, &n_,
         AP,
@@ -54,6 +58,8 @@ int64_t ppequ(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "dppequ", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -62,6 +68,7 @@ int64_t ppequ(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dppequ(
         &uplo_, &n_,
         AP,
@@ -85,6 +92,8 @@ int64_t ppequ(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "cppequ", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -93,6 +102,7 @@ int64_t ppequ(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cppequ(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -160,6 +170,8 @@ int64_t ppequ(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "zppequ", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -168,6 +180,7 @@ int64_t ppequ(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zppequ(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
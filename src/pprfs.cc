@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -26,6 +27,8 @@ int64_t pprfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "spprfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -44,6 +47,7 @@ int64_t pprfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spprfs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -75,6 +79,8 @@ int64_t pprfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dpprfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -93,6 +99,7 @@ int64_t pprfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpprfs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -124,6 +131,8 @@ int64_t pprfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "cpprfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -142,6 +151,7 @@ int64_t pprfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpprfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -241,6 +251,8 @@ int64_t pprfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "zpprfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -259,6 +271,7 @@ int64_t pprfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpprfs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t ppsv(
     float* AP,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "sppsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ int64_t ppsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sppsv(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -54,6 +58,8 @@ int64_t ppsv(
     double* AP,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dppsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -66,6 +72,7 @@ int64_t ppsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dppsv(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -87,6 +94,8 @@ int64_t ppsv(
     std::complex<float>* AP,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "cppsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -99,6 +108,7 @@ int64_t ppsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cppsv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -193,6 +203,8 @@ int64_t ppsv(
     std::complex<double>* AP,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zppsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -205,6 +217,7 @@ int64_t ppsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zppsv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
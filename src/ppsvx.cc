@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -29,6 +30,8 @@ int64_t ppsvx(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "sppsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -49,6 +52,7 @@ int64_t ppsvx(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sppsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         AP,
@@ -86,6 +90,8 @@ int64_t ppsvx(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dppsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -106,6 +112,7 @@ int64_t ppsvx(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dppsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         AP,
@@ -143,6 +150,8 @@ int64_t ppsvx(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "cppsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -163,6 +172,7 @@ int64_t ppsvx(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cppsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -377,6 +387,8 @@ int64_t ppsvx(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "zppsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -397,6 +409,7 @@ int64_t ppsvx(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zppsvx(
         &fact_, &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
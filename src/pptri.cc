@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t pptri(
     lapack::Uplo uplo, int64_t n,
     float* AP )
 {
+    LAPACK_INSTRUMENT( "spptri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -28,6 +31,7 @@ int64_t pptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spptri(
         &uplo_, &n_,
         AP, &info_
@@ -47,6 +51,8 @@ int64_t pptri(
     lapack::Uplo uplo, int64_t n,
     double* AP )
 {
+    LAPACK_INSTRUMENT( "dpptri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -55,6 +61,7 @@ int64_t pptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpptri(
         &uplo_, &n_,
         AP, &info_
@@ -74,6 +81,8 @@ int64_t pptri(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* AP )
 {
+    LAPACK_INSTRUMENT( "cpptri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -82,6 +91,7 @@ int64_t pptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpptri(
         &uplo_, &n_,
         (lapack_complex_float*) AP, &info_
@@ -131,6 +141,8 @@ int64_t pptri(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* AP )
 {
+    LAPACK_INSTRUMENT( "zpptri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -139,6 +151,7 @@ int64_t pptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpptri(
         &uplo_, &n_,
         (lapack_complex_double*) AP, &info_
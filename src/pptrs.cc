@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t pptrs(
     float const* AP,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "spptrs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ int64_t pptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spptrs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -54,6 +58,8 @@ int64_t pptrs(
     double const* AP,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dpptrs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -66,6 +72,7 @@ int64_t pptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpptrs(
         &uplo_, &n_, &nrhs_,
         AP,
@@ -87,6 +94,8 @@ int64_t pptrs(
     std::complex<float> const* AP,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "cpptrs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -99,6 +108,7 @@ int64_t pptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpptrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -157,6 +167,8 @@ int64_t pptrs(
     std::complex<double> const* AP,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zpptrs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -169,6 +181,7 @@ int64_t pptrs(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpptrs(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
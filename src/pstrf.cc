@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, float tol )
 {
+    LAPACK_INSTRUMENT( "spstrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -43,6 +46,7 @@ int64_t pstrf(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spstrf(
         &uplo_, &n_,
         A, &lda_,
@@ -69,6 +73,8 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, double tol )
 {
+    LAPACK_INSTRUMENT( "dpstrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -90,6 +96,7 @@ int64_t pstrf(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpstrf(
         &uplo_, &n_,
         A, &lda_,
@@ -116,6 +123,8 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, float tol )
 {
+    LAPACK_INSTRUMENT( "cpstrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -137,6 +146,7 @@ int64_t pstrf(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpstrf(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -163,6 +173,8 @@ int64_t pstrf(
     int64_t* piv,
     int64_t* rank, double tol )
 {
+    LAPACK_INSTRUMENT( "zpstrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -184,6 +196,7 @@ int64_t pstrf(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpstrf(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t ptcon(
     float const* E, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "sptcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ int64_t ptcon(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sptcon(
         &n_,
         D,
@@ -52,6 +56,8 @@ int64_t ptcon(
     double const* E, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "dptcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -62,6 +68,7 @@ int64_t ptcon(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dptcon(
         &n_,
         D,
@@ -81,6 +88,8 @@ int64_t ptcon(
     std::complex<float> const* E, float anorm,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "cptcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -91,6 +100,7 @@ int64_t ptcon(
     // allocate workspace
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cptcon(
         &n_,
         D,
@@ -154,6 +164,8 @@ int64_t ptcon(
     std::complex<double> const* E, double anorm,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "zptcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -164,6 +176,7 @@ int64_t ptcon(
     // allocate workspace
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zptcon(
         &n_,
         D,
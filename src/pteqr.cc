@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t pteqr(
     float* E,
     float* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "spteqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ int64_t pteqr(
     // allocate workspace
     lapack::vector< float > work( (4*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spteqr(
         &compz_, &n_,
         D,
@@ -58,6 +62,8 @@ int64_t pteqr(
     double* E,
     double* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "dpteqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -71,6 +77,7 @@ int64_t pteqr(
     // allocate workspace
     lapack::vector< double > work( (4*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpteqr(
         &compz_, &n_,
         D,
@@ -94,6 +101,8 @@ int64_t pteqr(
     float* E,
     std::complex<float>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "cpteqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -107,6 +116,7 @@ int64_t pteqr(
     // allocate workspace
     lapack::vector< float > work( (4*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpteqr(
         &compz_, &n_,
         D,
@@ -130,6 +140,8 @@ int64_t pteqr(
     double* E,
     std::complex<double>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "zpteqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -143,6 +155,7 @@ int64_t pteqr(
     // allocate workspace
     lapack::vector< double > work( (4*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpteqr(
         &compz_, &n_,
         D,
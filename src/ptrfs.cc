@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -28,6 +29,8 @@ int64_t ptrfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "sptrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -44,6 +47,7 @@ int64_t ptrfs(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sptrfs(
         &n_, &nrhs_,
         D,
@@ -74,6 +78,8 @@ int64_t ptrfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dptrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -90,6 +96,7 @@ int64_t ptrfs(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dptrfs(
         &n_, &nrhs_,
         D,
@@ -120,6 +127,8 @@ int64_t ptrfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "cptrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -138,6 +147,7 @@ int64_t ptrfs(
     lapack::vector< std::complex<float> > work( (n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cptrfs(
         &uplo_, &n_, &nrhs_,
         D,
@@ -249,6 +259,8 @@ int64_t ptrfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "zptrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -267,6 +279,7 @@ int64_t ptrfs(
     lapack::vector< std::complex<double> > work( (n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zptrfs(
         &uplo_, &n_, &nrhs_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t ptsv(
     float* E,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "sptsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ int64_t ptsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sptsv(
         &n_, &nrhs_,
         D,
@@ -52,6 +56,8 @@ int64_t ptsv(
     double* E,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dptsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -63,6 +69,7 @@ int64_t ptsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dptsv(
         &n_, &nrhs_,
         D,
@@ -82,6 +89,8 @@ int64_t ptsv(
     std::complex<float>* E,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "cptsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -93,6 +102,7 @@ int64_t ptsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cptsv(
         &n_, &nrhs_,
         D,
@@ -157,6 +167,8 @@ int64_t ptsv(
     std::complex<double>* E,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "zptsv", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -168,6 +180,7 @@ int64_t ptsv(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zptsv(
         &n_, &nrhs_,
         D,
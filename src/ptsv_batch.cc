@@ -0,0 +1,201 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "NoConstructAllocator.hh"
+#include "Batch.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Strided ptsv_batch. Each group of w systems is packed into compact format
+// in per-thread workspace, factored and solved with pttrf_compact_group and
+// pttrs_compact_group, and unpacked.
+template <typename scalar_t>
+void ptsv_batch(
+    int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t >* D, int64_t strideD,
+    scalar_t* E, int64_t strideE,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch > 1 && strideD < n );
+    lapack_error_if( batch > 1 && strideE < n-1 );
+    lapack_error_if( batch > 1 && strideB < ldb*nrhs );
+
+    const int64_t w = compact_width< scalar_t >();
+    int64_t n1 = max( n-1, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    // per-thread compact D, E, B for one group
+    int64_t lwork = (n1 + n*nrhs)*w;
+    lapack::vector< real_t > D_work( batch_max_threads() * n*w );
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        int64_t i = g*w;
+        int64_t lanes = min( w, int64_t( batch ) - i );
+        int tid = batch_thread_num();
+        real_t* Dg = D_work.data() + tid * n*w;
+        scalar_t* Eg = work.data() + tid * lwork;
+        scalar_t* Bg = Eg + n1*w;
+
+        // padding systems are the identity
+        pack_strided_group( n, 1, &D[ i*strideD ], n, strideD,
+                            lanes, w, real_t( 1 ), Dg );
+        pack_strided_group( n1, 1, &E[ i*strideE ], n1, strideE,
+                            lanes, w, scalar_t( 0 ), Eg );
+        pack_strided_group( n, nrhs, &B[ i*strideB ], ldb, strideB,
+                            lanes, w, scalar_t( 0 ), Bg );
+
+        int64_t info_g[ w ];
+        pttrf_compact_group( n, Dg, w, Eg, info_g );
+        pttrs_compact_group( Uplo::Lower, n, nrhs, Dg, w, Eg, Bg );
+
+        unpack_strided_group( n, 1, Dg, lanes, w, &D[ i*strideD ], n, strideD );
+        unpack_strided_group( n1, 1, Eg, lanes, w,
+                              &E[ i*strideE ], n1, strideE );
+        unpack_strided_group( n, nrhs, Bg, lanes, w,
+                              &B[ i*strideB ], ldb, strideB );
+        std::copy( info_g, info_g + lanes, &info[ i ] );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv
+void ptsv_batch(
+    int64_t n, int64_t nrhs,
+    float* D, int64_t strideD,
+    float* E, int64_t strideE,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::ptsv_batch( n, nrhs, D, strideD, E, strideE, B, ldb, strideB,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv
+void ptsv_batch(
+    int64_t n, int64_t nrhs,
+    double* D, int64_t strideD,
+    double* E, int64_t strideE,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::ptsv_batch( n, nrhs, D, strideD, E, strideE, B, ldb, strideB,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv
+void ptsv_batch(
+    int64_t n, int64_t nrhs,
+    float* D, int64_t strideD,
+    std::complex<float>* E, int64_t strideE,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::ptsv_batch( n, nrhs, D, strideD, E, strideE, B, ldb, strideB,
+                          batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a batch of Hermitian positive definite tridiagonal systems
+/// $A_i X_i = B_i$ of the same size, by factoring $A_i = L_i D_i L_i^H$,
+/// as in `lapack::ptsv`.
+///
+/// This is the strided variant: problem i uses D_i = D + i*strideD, etc.
+/// There is no pointer-array variant, as systems vectorize only with
+/// others of the same size.
+/// Each group of `lapack::compact_width` systems is transposed into
+/// compact format in per-thread workspace and solved with the same
+/// kernels as the compact routines, vectorizing across systems. Groups
+/// run in parallel across OpenMP threads. If the systems are already
+/// interleaved, the compact routines avoid the transposition.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in,out] D
+///     The diagonals of A_i, each of length n.
+///     On exit, the diagonals of D_i.
+///
+/// @param[in] strideD
+///     Distance between consecutive vectors D_i. strideD >= n.
+///
+/// @param[in,out] E
+///     The subdiagonals of A_i, each of length n-1.
+///     On exit, the subdiagonals of L_i.
+///
+/// @param[in] strideE
+///     Distance between consecutive vectors E_i. strideE >= n-1.
+///
+/// @param[in,out] B
+///     The right hand side matrices B_i, each stored in an ldb-by-nrhs
+///     array. On exit, the solution matrices X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between consecutive matrices B_i. strideB >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch.
+///     - = 0: successful exit.
+///     - > 0: if info[i] = k, the leading minor of order k of A_i is not
+///       positive definite, and X_i is not the solution.
+///       Other systems are not affected.
+///
+/// @throws Error if any argument is invalid, before any system is solved.
+///
+/// @ingroup ptsv
+void ptsv_batch(
+    int64_t n, int64_t nrhs,
+    double* D, int64_t strideD,
+    std::complex<double>* E, int64_t strideE,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::ptsv_batch( n, nrhs, D, strideD, E, strideE, B, ldb, strideB,
+                          batch, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,159 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void ptsv_compact(
+    int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t >* Dc,
+    scalar_t* Ec,
+    scalar_t* Bc,
+    size_t batch,
+    int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+
+    const int64_t w  = compact_width< scalar_t >();
+    const int64_t wd = compact_width< real_t >();
+    int64_t n1 = max( n-1, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        real_t* D = &Dc[ compact_real_offset< scalar_t >( n, g ) ];
+        scalar_t* E = &Ec[ g*n1*w ];
+        int64_t info_g[ w ];
+        pttrf_compact_group( n, D, wd, E, info_g );
+        pttrs_compact_group( Uplo::Lower, n, nrhs, D, wd, E,
+                             &Bc[ g*n*nrhs*w ] );
+        int64_t lanes = std::min( w, int64_t( batch ) - g*w );
+        for (int64_t l = 0; l < lanes; ++l)
+            info[ g*w + l ] = info_g[ l ];
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv
+void ptsv_compact(
+    int64_t n, int64_t nrhs,
+    float* Dc,
+    float* Ec,
+    float* Bc,
+    size_t batch,
+    int64_t* info )
+{
+    internal::ptsv_compact( n, nrhs, Dc, Ec, Bc, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv
+void ptsv_compact(
+    int64_t n, int64_t nrhs,
+    double* Dc,
+    double* Ec,
+    double* Bc,
+    size_t batch,
+    int64_t* info )
+{
+    internal::ptsv_compact( n, nrhs, Dc, Ec, Bc, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv
+void ptsv_compact(
+    int64_t n, int64_t nrhs,
+    float* Dc,
+    std::complex<float>* Ec,
+    std::complex<float>* Bc,
+    size_t batch,
+    int64_t* info )
+{
+    internal::ptsv_compact( n, nrhs, Dc, Ec, Bc, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a Hermitian positive definite tridiagonal system for each
+/// problem of a compact batch, $A_i X_i = B_i$, by factoring
+/// $A_i = L_i D_i L_i^H$, as in `lapack::ptsv`.
+///
+/// Each vector is interleaved in groups of `lapack::compact_width`, as
+/// from `lapack::pack_compact` with n = 1: element i of vector X_b is
+/// Xc[ g*m*w + i*w + l ] for a vector of length m, with problem b in lane
+/// l of group g. The recurrences vectorize across the systems of each
+/// group, and groups run in parallel across OpenMP threads.
+/// D_i are real vectors, packed with `lapack::pack_compact` for the real
+/// type, as in `lapack::pttrf_compact`. B_i are n-by-nrhs compact
+/// matrices, as in `lapack::getrs_compact`.
+/// For systems in strided storage, see `lapack::ptsv_batch`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each matrix B_i. nrhs >= 0.
+///
+/// @param[in,out] Dc
+///     The compact batch of diagonals of A_i, each of length n, of length
+///     `lapack::compact_size< real_t >( n, 1, batch )`.
+///     On exit, the diagonals of D_i.
+///
+/// @param[in,out] Ec
+///     The compact batch of subdiagonals of A_i, each of length n-1.
+///     On exit, the subdiagonals of L_i.
+///
+/// @param[in,out] Bc
+///     The compact batch of n-by-nrhs matrices B_i, of length
+///     `lapack::compact_size< scalar_t >( n, nrhs, batch )`.
+///     On successful exit, the solution matrices X_i.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @param[out] info
+///     The vector info of length batch.
+///     - = 0: successful exit.
+///     - > 0: if info[b] = k, the leading minor of order k of A_b is not
+///       positive definite, and X_b is not the solution.
+///       Other systems are not affected.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup ptsv
+void ptsv_compact(
+    int64_t n, int64_t nrhs,
+    double* Dc,
+    std::complex<double>* Ec,
+    std::complex<double>* Bc,
+    size_t batch,
+    int64_t* info )
+{
+    internal::ptsv_compact( n, nrhs, Dc, Ec, Bc, batch, info );
+}
+
+}  // namespace lapack
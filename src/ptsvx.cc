@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -29,6 +30,8 @@ int64_t ptsvx(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "sptsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -46,6 +49,7 @@ int64_t ptsvx(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sptsvx(
         &fact_, &n_, &nrhs_,
         D,
@@ -81,6 +85,8 @@ int64_t ptsvx(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dptsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -98,6 +104,7 @@ int64_t ptsvx(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dptsvx(
         &fact_, &n_, &nrhs_,
         D,
@@ -133,6 +140,8 @@ int64_t ptsvx(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "cptsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -151,6 +160,7 @@ int64_t ptsvx(
     lapack::vector< std::complex<float> > work( (n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cptsvx(
         &fact_, &n_, &nrhs_,
         D,
@@ -290,6 +300,8 @@ int64_t ptsvx(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "zptsvx", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -308,6 +320,7 @@ int64_t ptsvx(
     lapack::vector< std::complex<double> > work( (n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zptsvx(
         &fact_, &n_, &nrhs_,
         D,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t pttrf(
     float* D,
     float* E )
 {
+    LAPACK_INSTRUMENT( "spttrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -28,6 +31,7 @@ int64_t pttrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_spttrf(
         &n_,
         D,
@@ -45,6 +49,8 @@ int64_t pttrf(
     double* D,
     double* E )
 {
+    LAPACK_INSTRUMENT( "dpttrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -52,6 +58,7 @@ int64_t pttrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dpttrf(
         &n_,
         D,
@@ -69,6 +76,8 @@ int64_t pttrf(
     float* D,
     std::complex<float>* E )
 {
+    LAPACK_INSTRUMENT( "cpttrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -76,6 +85,7 @@ int64_t pttrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cpttrf(
         &n_,
         D,
@@ -123,6 +133,8 @@ int64_t pttrf(
     double* D,
     std::complex<double>* E )
 {
+    LAPACK_INSTRUMENT( "zpttrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -130,6 +142,7 @@ int64_t pttrf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zpttrf(
         &n_,
         D,
@@ -0,0 +1,142 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void pttrf_compact(
+    int64_t n,
+    blas::real_type< scalar_t >* Dc,
+    scalar_t* Ec,
+    size_t batch,
+    int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( n < 0 );
+
+    const int64_t w  = compact_width< scalar_t >();
+    const int64_t wd = compact_width< real_t >();
+    int64_t n1 = max( n-1, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        int64_t info_g[ w ];
+        pttrf_compact_group( n, &Dc[ compact_real_offset< scalar_t >( n, g ) ],
+                             wd, &Ec[ g*n1*w ], info_g );
+        int64_t lanes = std::min( w, int64_t( batch ) - g*w );
+        for (int64_t l = 0; l < lanes; ++l)
+            info[ g*w + l ] = info_g[ l ];
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrf_compact(
+    int64_t n,
+    float* Dc,
+    float* Ec,
+    size_t batch,
+    int64_t* info )
+{
+    internal::pttrf_compact( n, Dc, Ec, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrf_compact(
+    int64_t n,
+    double* Dc,
+    double* Ec,
+    size_t batch,
+    int64_t* info )
+{
+    internal::pttrf_compact( n, Dc, Ec, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrf_compact(
+    int64_t n,
+    float* Dc,
+    std::complex<float>* Ec,
+    size_t batch,
+    int64_t* info )
+{
+    internal::pttrf_compact( n, Dc, Ec, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes $L_i D_i L_i^H$ factorizations of a compact batch of n-by-n
+/// Hermitian positive definite tridiagonal matrices, as in
+/// `lapack::pttrf`.
+///
+/// Each vector is interleaved in groups of `lapack::compact_width`, as
+/// from `lapack::pack_compact` with n = 1: element i of vector X_b is
+/// Xc[ g*m*w + i*w + l ] for a vector of length m, with problem b in lane
+/// l of group g. The recurrences vectorize across the systems of each
+/// group, and groups run in parallel across OpenMP threads.
+/// D_i are real vectors, packed with `lapack::pack_compact` for the real
+/// type, so for complex, their groups are twice as wide as those of E_i.
+/// Solve using `lapack::pttrs_compact`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in,out] Dc
+///     The compact batch of diagonals of A_i, each of length n, of length
+///     `lapack::compact_size< real_t >( n, 1, batch )`.
+///     On exit, the diagonals of the diagonal matrices D_i.
+///
+/// @param[in,out] Ec
+///     The compact batch of subdiagonals of A_i, each of length n-1.
+///     On exit, the subdiagonals of the unit bidiagonal factors L_i.
+///     E_i can also be regarded as the superdiagonal of the unit
+///     bidiagonal factor U_i from the $U_i^H D_i U_i$ factorization.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @param[out] info
+///     The vector info of length batch.
+///     - = 0: successful exit.
+///     - > 0: if info[b] = k, the leading minor of order k of A_b is not
+///       positive definite; the factorization of A_b is not complete.
+///       Other systems are not affected.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup ptsv_computational
+void pttrf_compact(
+    int64_t n,
+    double* Dc,
+    std::complex<double>* Ec,
+    size_t batch,
+    int64_t* info )
+{
+    internal::pttrf_compact( n, Dc, Ec, batch, info );
+}
+
+}  // namespace lapack
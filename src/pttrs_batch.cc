@@ -0,0 +1,199 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "NoConstructAllocator.hh"
+#include "Batch.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Strided pttrs_batch. Each group of w systems is packed into compact
+// format in per-thread workspace, solved with pttrs_compact_group, and
+// the solutions unpacked.
+template <typename scalar_t>
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t > const* D, int64_t strideD,
+    scalar_t const* E, int64_t strideE,
+    scalar_t* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+    lapack_error_if( ldb < max( 1, n ) );
+    lapack_error_if( batch > 1 && strideD < n );
+    lapack_error_if( batch > 1 && strideE < n-1 );
+    lapack_error_if( batch > 1 && strideB < ldb*nrhs );
+
+    const int64_t w = compact_width< scalar_t >();
+    int64_t n1 = max( n-1, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    // per-thread compact D, E, B for one group
+    int64_t lwork = (n1 + n*nrhs)*w;
+    lapack::vector< real_t > D_work( batch_max_threads() * n*w );
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        int64_t i = g*w;
+        int64_t lanes = min( w, int64_t( batch ) - i );
+        int tid = batch_thread_num();
+        real_t* Dg = D_work.data() + tid * n*w;
+        scalar_t* Eg = work.data() + tid * lwork;
+        scalar_t* Bg = Eg + n1*w;
+
+        // padding systems are the identity
+        pack_strided_group( n, 1, &D[ i*strideD ], n, strideD,
+                            lanes, w, real_t( 1 ), Dg );
+        pack_strided_group( n1, 1, &E[ i*strideE ], n1, strideE,
+                            lanes, w, scalar_t( 0 ), Eg );
+        pack_strided_group( n, nrhs, &B[ i*strideB ], ldb, strideB,
+                            lanes, w, scalar_t( 0 ), Bg );
+
+        pttrs_compact_group( uplo, n, nrhs, Dg, w, Eg, Bg );
+
+        unpack_strided_group( n, nrhs, Bg, lanes, w,
+                              &B[ i*strideB ], ldb, strideB );
+        std::fill( &info[ i ], &info[ i ] + lanes, 0 );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, int64_t strideD,
+    float const* E, int64_t strideE,
+    float* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::pttrs_batch( uplo, n, nrhs, D, strideD, E, strideE,
+                           B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, int64_t strideD,
+    double const* E, int64_t strideE,
+    double* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::pttrs_batch( uplo, n, nrhs, D, strideD, E, strideE,
+                           B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* D, int64_t strideD,
+    std::complex<float> const* E, int64_t strideE,
+    std::complex<float>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::pttrs_batch( uplo, n, nrhs, D, strideD, E, strideE,
+                           B, ldb, strideB, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a batch of tridiagonal systems $A_i X_i = B_i$ of the same size,
+/// using the factorizations $A_i = U_i^H D_i U_i$ or $A_i = L_i D_i L_i^H$
+/// computed by `lapack::pttrf_batch`, as in `lapack::pttrs`.
+///
+/// This is the strided variant: problem i uses D_i = D + i*strideD, etc.
+/// There is no pointer-array variant, as systems vectorize only with
+/// others of the same size.
+/// Each group of `lapack::compact_width` systems is transposed into
+/// compact format in per-thread workspace and solved with the same
+/// kernels as the compact routines, vectorizing across systems. Groups
+/// run in parallel across OpenMP threads. If the systems are already
+/// interleaved, the compact routines avoid the transposition.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Whether each vector E_i is the superdiagonal of U_i or the
+///     subdiagonal of L_i, as in `lapack::pttrs`. For real matrices,
+///     both are the same.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides of each system. nrhs >= 0.
+///
+/// @param[in] D
+///     The diagonals of D_i, each of length n,
+///     from `lapack::pttrf_batch`.
+///
+/// @param[in] strideD
+///     Distance between consecutive vectors D_i. strideD >= n.
+///
+/// @param[in] E
+///     The off-diagonals of the unit bidiagonal factors, each of
+///     length n-1, from `lapack::pttrf_batch`.
+///
+/// @param[in] strideE
+///     Distance between consecutive vectors E_i. strideE >= n-1.
+///
+/// @param[in,out] B
+///     The right hand side matrices B_i, each stored in an ldb-by-nrhs
+///     array. On exit, the solution matrices X_i.
+///
+/// @param[in] ldb
+///     The leading dimension of each B_i. ldb >= max(1,n).
+///
+/// @param[in] strideB
+///     Distance between consecutive matrices B_i. strideB >= ldb*nrhs.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch, set to 0, as arguments are
+///     checked beforehand.
+///
+/// @throws Error if any argument is invalid, before any system is solved.
+///
+/// @ingroup ptsv_computational
+void pttrs_batch(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* D, int64_t strideD,
+    std::complex<double> const* E, int64_t strideE,
+    std::complex<double>* B, int64_t ldb, int64_t strideB,
+    size_t batch,
+    int64_t* info )
+{
+    internal::pttrs_batch( uplo, n, nrhs, D, strideD, E, strideE,
+                           B, ldb, strideB, batch, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,149 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "CompactTridiag.hh"
+
+#include <algorithm>
+
+namespace lapack {
+
+using blas::max;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void pttrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    blas::real_type< scalar_t > const* Dc,
+    scalar_t const* Ec,
+    scalar_t* Bc,
+    size_t batch )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // check arguments
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( n < 0 );
+    lapack_error_if( nrhs < 0 );
+
+    const int64_t w  = compact_width< scalar_t >();
+    const int64_t wd = compact_width< real_t >();
+    int64_t n1 = max( n-1, 0 );
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        pttrs_compact_group( uplo, n, nrhs,
+                             &Dc[ compact_real_offset< scalar_t >( n, g ) ], wd,
+                             &Ec[ g*n1*w ], &Bc[ g*n*nrhs*w ] );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* Dc,
+    float const* Ec,
+    float* Bc,
+    size_t batch )
+{
+    internal::pttrs_compact( uplo, n, nrhs, Dc, Ec, Bc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* Dc,
+    double const* Ec,
+    double* Bc,
+    size_t batch )
+{
+    internal::pttrs_compact( uplo, n, nrhs, Dc, Ec, Bc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup ptsv_computational
+void pttrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float const* Dc,
+    std::complex<float> const* Ec,
+    std::complex<float>* Bc,
+    size_t batch )
+{
+    internal::pttrs_compact( uplo, n, nrhs, Dc, Ec, Bc, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a tridiagonal system for each problem of a compact batch,
+/// $A_i X_i = B_i$, using the factorizations $A_i = U_i^H D_i U_i$ or
+/// $A_i = L_i D_i L_i^H$ computed by `lapack::pttrf_compact`, as in
+/// `lapack::pttrs`.
+///
+/// Each vector is interleaved in groups of `lapack::compact_width`, as
+/// from `lapack::pack_compact` with n = 1: element i of vector X_b is
+/// Xc[ g*m*w + i*w + l ] for a vector of length m, with problem b in lane
+/// l of group g. The recurrences vectorize across the systems of each
+/// group, and groups run in parallel across OpenMP threads.
+/// B_i are n-by-nrhs compact matrices, as in `lapack::getrs_compact`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] uplo
+///     Specifies the form of the factorization and whether each
+///     vector E_i is the superdiagonal of the upper bidiagonal factor
+///     U_i or the subdiagonal of the lower bidiagonal factor L_i.
+///     For real matrices, both are the same.
+///     - lapack::Uplo::Upper: $A_i = U_i^H D_i U_i,$
+///       E_i is the superdiagonal of U_i;
+///     - lapack::Uplo::Lower: $A_i = L_i D_i L_i^H,$
+///       E_i is the subdiagonal of L_i.
+///
+/// @param[in] n
+///     The order of each matrix A_i. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of each matrix B_i. nrhs >= 0.
+///
+/// @param[in] Dc
+///     The compact batch of diagonals of D_i, each of length n,
+///     from `lapack::pttrf_compact`.
+///
+/// @param[in] Ec
+///     The compact batch of off-diagonals of the unit bidiagonal factors,
+///     each of length n-1, from `lapack::pttrf_compact`.
+///
+/// @param[in,out] Bc
+///     The compact batch of n-by-nrhs matrices B_i, of length
+///     `lapack::compact_size< scalar_t >( n, nrhs, batch )`.
+///     On exit, the solution matrices X_i.
+///
+/// @param[in] batch
+///     The number of systems.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup ptsv_computational
+void pttrs_compact(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double const* Dc,
+    std::complex<double> const* Ec,
+    std::complex<double>* Bc,
+    size_t batch )
+{
+    internal::pttrs_compact( uplo, n, nrhs, Dc, Ec, Bc, batch );
+}
+
+}  // namespace lapack
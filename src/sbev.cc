@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t sbev(
     float* W,
     float* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "ssbev", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -40,6 +43,7 @@ int64_t sbev(
     // allocate workspace
     lapack::vector< float > work( (max( 1, 3*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssbev(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -63,6 +67,8 @@ int64_t sbev(
     double* W,
     double* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "dsbev", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -81,6 +87,7 @@ int64_t sbev(
     // allocate workspace
     lapack::vector< double > work( (max( 1, 3*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsbev(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t sbevx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "ssbevx", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -59,6 +62,7 @@ int64_t sbevx(
     lapack::vector< float > work( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssbevx(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -94,6 +98,8 @@ int64_t sbevx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "dsbevx", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -128,6 +134,7 @@ int64_t sbevx(
     lapack::vector< double > work( (7*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsbevx(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
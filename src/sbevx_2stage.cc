@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
 
@@ -27,6 +28,63 @@ int64_t sbevx_2stage(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "ssbevx_2stage", 0, n, kd );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    sbevx_2stage_work_size( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu,
+                            il, iu, abstol, m, W, Z, ldz, ifail,
+                            &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return sbevx_2stage_work( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl,
+                              vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                              work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t sbevx_2stage(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail )
+{
+    LAPACK_INSTRUMENT( "dsbevx_2stage", 0, n, kd );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    sbevx_2stage_work_size( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl, vu,
+                            il, iu, abstol, m, W, Z, ldz, ifail,
+                            &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return sbevx_2stage_work( jobz, range, uplo, n, kd, AB, ldab, Q, ldq, vl,
+                              vu, il, iu, abstol, m, W, Z, ldz, ifail,
+                              work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+void sbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
+    int64_t* m,
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "ssbevx_2stage_work_size", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -77,20 +135,65 @@ int64_t sbevx_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = max( 1, 5*n );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+// -----------------------------------------------------------------------------
+void sbevx_2stage_work_size(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "dsbevx_2stage_work_size", 0, n, kd );
 
-    LAPACK_ssbevx_2stage(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ifail_( (n) );
+        lapack_int* ifail_ptr = &ifail_[0];
+    #else
+        lapack_int* ifail_ptr = ifail;
+    #endif
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &m_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0],
+        qry_work, &ineg_one,
+        qry_iwork,
         ifail_ptr, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
@@ -99,25 +202,24 @@ int64_t sbevx_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    *m = m_;
-    #ifndef LAPACK_ILP64
-        if (jobz != Job::NoVec) {
-            std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
-        }
-    #endif
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = max( 1, 5*n );
 }
 
 // -----------------------------------------------------------------------------
-int64_t sbevx_2stage(
+int64_t sbevx_2stage_work(
     lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
-    double* AB, int64_t ldab,
-    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    float* AB, int64_t ldab,
+    float* Q, int64_t ldq, float vl, float vu, int64_t il, int64_t iu, float abstol,
     int64_t* m,
-    double* W,
-    double* Z, int64_t ldz,
-    int64_t* ifail )
+    float* W,
+    float* Z, int64_t ldz,
+    int64_t* ifail,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
 {
+    LAPACK_INSTRUMENT( "ssbevx_2stage_work", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -127,7 +229,9 @@ int64_t sbevx_2stage(
         lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
+    lapack_error_if( liwork < 5*n );
     char jobz_ = job2char( jobz );
     char range_ = range2char( range );
     char uplo_ = uplo2char( uplo );
@@ -146,20 +250,18 @@ int64_t sbevx_2stage(
     #else
         lapack_int* ifail_ptr = ifail;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsbevx_2stage(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_ssbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &m_,
         W,
         Z, &ldz_,
-        qry_work, &ineg_one,
-        qry_iwork,
+        work, &lwork_,
+        iwork,
         ifail_ptr, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
@@ -168,20 +270,71 @@ int64_t sbevx_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *m = m_;
+    #ifndef LAPACK_ILP64
+        if (jobz != Job::NoVec) {
+            std::copy( &ifail_[ 0 ], &ifail_[ m_ ], ifail );
+        }
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (5*n) );
+// -----------------------------------------------------------------------------
+int64_t sbevx_2stage_work(
+    lapack::Job jobz, lapack::Range range, lapack::Uplo uplo, int64_t n, int64_t kd,
+    double* AB, int64_t ldab,
+    double* Q, int64_t ldq, double vl, double vu, int64_t il, int64_t iu, double abstol,
+    int64_t* m,
+    double* W,
+    double* Z, int64_t ldz,
+    int64_t* ifail,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "dsbevx_2stage_work", 0, n, kd );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(kd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldab) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(il) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(iu) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < 5*n );
+    char jobz_ = job2char( jobz );
+    char range_ = range2char( range );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int kd_ = (lapack_int) kd;
+    lapack_int ldab_ = (lapack_int) ldab;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int il_ = (lapack_int) il;
+    lapack_int iu_ = (lapack_int) iu;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int ldz_ = (lapack_int) ldz;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ifail_( (n) );
+        lapack_int* ifail_ptr = &ifail_[0];
+    #else
+        lapack_int* ifail_ptr = ifail;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsbevx_2stage(
         &jobz_, &range_, &uplo_, &n_, &kd_,
         AB, &ldab_,
         Q, &ldq_, &vl, &vu, &il_, &iu_, &abstol, &m_,
         W,
         Z, &ldz_,
-        &work[0], &lwork_,
-        &iwork[0],
+        work, &lwork_,
+        iwork,
         ifail_ptr, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1, 1
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t sbgst(
     float const* BB, int64_t ldbb,
     float* X, int64_t ldx )
 {
+    LAPACK_INSTRUMENT( "ssbgst", 0, n, ka );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -44,6 +47,7 @@ int64_t sbgst(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssbgst(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -67,6 +71,8 @@ int64_t sbgst(
     double const* BB, int64_t ldbb,
     double* X, int64_t ldx )
 {
+    LAPACK_INSTRUMENT( "dsbgst", 0, n, ka );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -89,6 +95,7 @@ int64_t sbgst(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsbgst(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t sbgv(
     float* W,
     float* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "ssbgv", 0, n, ka );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -45,6 +48,7 @@ int64_t sbgv(
     // allocate workspace
     lapack::vector< float > work( (3*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssbgv(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -70,6 +74,8 @@ int64_t sbgv(
     double* W,
     double* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "dsbgv", 0, n, ka );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -92,6 +98,7 @@ int64_t sbgv(
     // allocate workspace
     lapack::vector< double > work( (3*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsbgv(
         &jobz_, &uplo_, &n_, &ka_, &kb_,
         AB, &ldab_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t sbtrd(
     float* E,
     float* Q, int64_t ldq )
 {
+    LAPACK_INSTRUMENT( "ssbtrd", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -41,6 +44,7 @@ int64_t sbtrd(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssbtrd(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
@@ -66,6 +70,8 @@ int64_t sbtrd(
     double* E,
     double* Q, int64_t ldq )
 {
+    LAPACK_INSTRUMENT( "dsbtrd", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -84,6 +90,7 @@ int64_t sbtrd(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsbtrd(
         &jobz_, &uplo_, &n_, &kd_,
         AB, &ldab_,
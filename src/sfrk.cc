@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ void sfrk(
     float const* A, int64_t lda, float beta,
     float* C )
 {
+    LAPACK_INSTRUMENT( "ssfrk", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +36,7 @@ void sfrk(
     lapack_int k_ = (lapack_int) k;
     lapack_int lda_ = (lapack_int) lda;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssfrk(
         &transr_, &uplo_, &trans_, &n_, &k_, &alpha,
         A, &lda_, &beta,
@@ -49,6 +53,8 @@ void sfrk(
     double const* A, int64_t lda, double beta,
     double* C )
 {
+    LAPACK_INSTRUMENT( "dsfrk", 0, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -62,6 +68,7 @@ void sfrk(
     lapack_int k_ = (lapack_int) k;
     lapack_int lda_ = (lapack_int) lda;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsfrk(
         &transr_, &uplo_, &trans_, &n_, &k_, &alpha,
         A, &lda_, &beta,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t spev(
     float* W,
     float* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "sspev", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ int64_t spev(
     // allocate workspace
     lapack::vector< float > work( (3*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sspev(
         &jobz_, &uplo_, &n_,
         AP,
@@ -59,6 +63,8 @@ int64_t spev(
     double* W,
     double* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "dspev", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -73,6 +79,7 @@ int64_t spev(
     // allocate workspace
     lapack::vector< double > work( (3*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dspev(
         &jobz_, &uplo_, &n_,
         AP,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -24,6 +25,8 @@ int64_t spevx(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "sspevx", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -52,6 +55,7 @@ int64_t spevx(
     lapack::vector< float > work( (8*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sspevx(
         &jobz_, &range_, &uplo_, &n_,
         AP, &vl, &vu, &il_, &iu_, &abstol, &m_,
@@ -85,6 +89,8 @@ int64_t spevx(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "dspevx", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -113,6 +119,7 @@ int64_t spevx(
     lapack::vector< double > work( (8*n) );
     lapack::vector< lapack_int > iwork( (5*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dspevx(
         &jobz_, &range_, &uplo_, &n_,
         AP, &vl, &vu, &il_, &iu_, &abstol, &m_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t spgv(
     float* W,
     float* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "sspgv", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -39,6 +42,7 @@ int64_t spgv(
     // allocate workspace
     lapack::vector< float > work( (3*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sspgv(
         &itype_, &jobz_, &uplo_, &n_,
         AP,
@@ -64,6 +68,8 @@ int64_t spgv(
     double* W,
     double* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "dspgv", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -80,6 +86,7 @@ int64_t spgv(
     // allocate workspace
     lapack::vector< double > work( (3*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dspgv(
         &itype_, &jobz_, &uplo_, &n_,
         AP,
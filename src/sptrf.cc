@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t sptrf(
     float* AP,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "ssptrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,6 +39,7 @@ int64_t sptrf(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssptrf(
         &uplo_, &n_,
         AP,
@@ -59,6 +63,8 @@ int64_t sptrf(
     double* AP,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "dsptrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -74,6 +80,7 @@ int64_t sptrf(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsptrf(
         &uplo_, &n_,
         AP,
@@ -97,6 +104,8 @@ int64_t sptrf(
     std::complex<float>* AP,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "csptrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -112,6 +121,7 @@ int64_t sptrf(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_csptrf(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -135,6 +145,8 @@ int64_t sptrf(
     std::complex<double>* AP,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "zsptrf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -150,6 +162,7 @@ int64_t sptrf(
     #endif
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zsptrf(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -26,6 +27,8 @@ int64_t stein(
     float* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "sstein", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,14 +39,16 @@ int64_t stein(
     lapack_int m_ = (lapack_int) m;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
+        lapack::vector< lapack_int > iblock_( (n) );
+        std::copy( &iblock[0], &iblock[(n)], iblock_.begin() );
         lapack_int const* iblock_ptr = &iblock_[0];
     #else
         lapack_int const* iblock_ptr = iblock;
     #endif
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
+        lapack::vector< lapack_int > isplit_( (n) );
+        std::copy( &isplit[0], &isplit[(n)], isplit_.begin() );
         lapack_int const* isplit_ptr = &isplit_[0];
     #else
         lapack_int const* isplit_ptr = isplit;
@@ -62,6 +67,7 @@ int64_t stein(
     lapack::vector< float > work( (5*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sstein(
         &n_,
         D,
@@ -93,6 +99,8 @@ int64_t stein(
     double* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "dstein", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -103,14 +111,16 @@ int64_t stein(
     lapack_int m_ = (lapack_int) m;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
+        lapack::vector< lapack_int > iblock_( (n) );
+        std::copy( &iblock[0], &iblock[(n)], iblock_.begin() );
         lapack_int const* iblock_ptr = &iblock_[0];
     #else
         lapack_int const* iblock_ptr = iblock;
     #endif
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
+        lapack::vector< lapack_int > isplit_( (n) );
+        std::copy( &isplit[0], &isplit[(n)], isplit_.begin() );
         lapack_int const* isplit_ptr = &isplit_[0];
     #else
         lapack_int const* isplit_ptr = isplit;
@@ -129,6 +139,7 @@ int64_t stein(
     lapack::vector< double > work( (5*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dstein(
         &n_,
         D,
@@ -160,6 +171,8 @@ int64_t stein(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "cstein", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -170,14 +183,16 @@ int64_t stein(
     lapack_int m_ = (lapack_int) m;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
+        lapack::vector< lapack_int > iblock_( (n) );
+        std::copy( &iblock[0], &iblock[(n)], iblock_.begin() );
         lapack_int const* iblock_ptr = &iblock_[0];
     #else
         lapack_int const* iblock_ptr = iblock;
     #endif
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
+        lapack::vector< lapack_int > isplit_( (n) );
+        std::copy( &isplit[0], &isplit[(n)], isplit_.begin() );
         lapack_int const* isplit_ptr = &isplit_[0];
     #else
         lapack_int const* isplit_ptr = isplit;
@@ -196,6 +211,7 @@ int64_t stein(
     lapack::vector< float > work( (5*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cstein(
         &n_,
         D,
@@ -227,6 +243,8 @@ int64_t stein(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifail )
 {
+    LAPACK_INSTRUMENT( "zstein", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -237,14 +255,16 @@ int64_t stein(
     lapack_int m_ = (lapack_int) m;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > iblock_( &iblock[0], &iblock[(n)] );
+        lapack::vector< lapack_int > iblock_( (n) );
+        std::copy( &iblock[0], &iblock[(n)], iblock_.begin() );
         lapack_int const* iblock_ptr = &iblock_[0];
     #else
         lapack_int const* iblock_ptr = iblock;
     #endif
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > isplit_( &isplit[0], &isplit[(n)] );
+        lapack::vector< lapack_int > isplit_( (n) );
+        std::copy( &isplit[0], &isplit[(n)], isplit_.begin() );
         lapack_int const* isplit_ptr = &isplit_[0];
     #else
         lapack_int const* isplit_ptr = isplit;
@@ -263,6 +283,7 @@ int64_t stein(
     lapack::vector< double > work( (5*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zstein(
         &n_,
         D,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t steqr(
     float* E,
     float* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "ssteqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ int64_t steqr(
     // allocate workspace
     lapack::vector< float > work( (max( 1, 2*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssteqr(
         &compz_, &n_,
         D,
@@ -58,6 +62,8 @@ int64_t steqr(
     double* E,
     double* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "dsteqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -71,6 +77,7 @@ int64_t steqr(
     // allocate workspace
     lapack::vector< double > work( (max( 1, 2*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsteqr(
         &compz_, &n_,
         D,
@@ -94,6 +101,8 @@ int64_t steqr(
     float* E,
     std::complex<float>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "csteqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -107,6 +116,7 @@ int64_t steqr(
     // allocate workspace
     lapack::vector< float > work( (max( 1, 2*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_csteqr(
         &compz_, &n_,
         D,
@@ -130,6 +140,8 @@ int64_t steqr(
     double* E,
     std::complex<double>* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "zsteqr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -143,6 +155,7 @@ int64_t steqr(
     // allocate workspace
     lapack::vector< double > work( (max( 1, 2*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zsteqr(
         &compz_, &n_,
         D,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t stev(
     float* E,
     float* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "sstev", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ int64_t stev(
     // allocate workspace
     lapack::vector< float > work( (max( 1, 2*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_sstev(
         &jobz_, &n_,
         D,
@@ -58,6 +62,8 @@ int64_t stev(
     double* E,
     double* Z, int64_t ldz )
 {
+    LAPACK_INSTRUMENT( "dstev", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -71,6 +77,7 @@ int64_t stev(
     // allocate workspace
     lapack::vector< double > work( (max( 1, 2*n-2 )) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dstev(
         &jobz_, &n_,
         D,
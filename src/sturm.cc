@@ -6,6 +6,9 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace lapack {
@@ -150,6 +153,386 @@ int64_t sturm(
     return isneg;
 }
 
+//------------------------------------------------------------------------------
+// The recurrence for one shift is a chain of dependent operations, so
+// sturm() is latency bound. Here shifts are processed in blocks of
+// sturm_lanes, with the recurrence for all shifts of a block advanced
+// together at each i: the block's loop over shifts has no dependencies,
+// so the compiler vectorizes it, and the independent chains hide each
+// other's latency. Zhang's scaling is applied per shift, without
+// branches, giving the same counts as sturm(). Blocks of
+// shifts run in parallel using OpenMP threads when n * nshifts is large.
+
+namespace internal {
+
+// Shifts per block: two 512-bit vectors, so AVX2 has four independent
+// chains in flight.
+template <typename scalar_t>
+constexpr int64_t sturm_lanes()
+{
+    return 128 / int64_t( sizeof( scalar_t ) );
+}
+
+// Below this n * nshifts, threading costs more than it saves.
+const int64_t sturm_multi_parallel_min = 100000;
+
+template <typename scalar_t>
+void sturm_block(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    scalar_t const* shifts, int64_t* counts )
+{
+    const int64_t w = sturm_lanes< scalar_t >();
+    const scalar_t phi = scalar_t( int64_t( 1 ) << 34 );
+    const scalar_t one = 1.0;
+    const scalar_t upsilon = one/phi;
+
+    scalar_t Pm1_0[ w ], Pm1_1[ w ], u[ w ];
+    int64_t isneg[ w ];
+
+    #ifdef _OPENMP
+    #pragma omp simd
+    #endif
+    for (int64_t l = 0; l < w; ++l) {
+        u[ l ] = shifts[ l ];
+        Pm1_1[ l ] = one;
+        Pm1_0[ l ] = diag[ 0 ] - u[ l ];
+        isneg[ l ] = (Pm1_0[ l ] < 0);
+    }
+    for (int64_t i = 1; i < n; ++i) {
+        const scalar_t d = diag[ i ];
+        const scalar_t e2 = offd[ i-1 ]*offd[ i-1 ];
+        #ifdef _OPENMP
+        #pragma omp simd
+        #endif
+        for (int64_t l = 0; l < w; ++l) {
+            scalar_t v0 = std::abs( Pm1_0[ l ] );
+            scalar_t v1 = std::abs( Pm1_1[ l ] );
+            scalar_t wl = (v0 > v1 ? v0 : v1);
+
+            scalar_t p0 = (d - u[ l ])*Pm1_0[ l ] - (e2*Pm1_1[ l ]);
+            scalar_t p1 = Pm1_0[ l ];
+
+            // scale by phi/w or upsilon/w if w is out of range, else by
+            // w/w = 1, which is exact, so this matches sturm(). The
+            // division is unconditional and the sign test uses & and |,
+            // so there are no branches and the loop vectorizes.
+            // (If w is NaN, p0 is already NaN, and counts stop changing,
+            // as in sturm().)
+            scalar_t t = (wl > phi ? phi : (wl < upsilon ? upsilon : wl));
+            scalar_t s = t / wl;
+            p0 *= s;
+            p1 *= s;
+            Pm1_0[ l ] = p0;
+            Pm1_1[ l ] = p1;
+
+            isneg[ l ] += ((p0 < 0) & (p1 >= 0)) | ((p0 >= 0) & (p1 < 0));
+        }
+    }
+    for (int64_t l = 0; l < w; ++l)
+        counts[ l ] = isneg[ l ];
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// @ingroup heev_computational
+/// sturm_multi computes the scaled Sturm count of sturm() for many shifts
+/// at once, for bisection and spectrum slicing, which need hundreds of
+/// shifts per tridiagonal matrix. Only single and double precision exist.
+///
+/// Parameters:
+///  @param[in]        n: The order of the matrix.
+///  @param[in]     diag: a vector of 'n' diagonal elements.
+///  @param[in]     offd: a vector of 'n-1' off-diagonal elements.
+///  @param[in]  nshifts: The number of shifts.
+///  @param[in]   shifts: a vector of 'nshifts' sigma test points.
+///  @param[out]  counts: a vector of 'nshifts' counts; counts[j] is the
+///                       number of eigenvalues strictly less than shifts[j].
+///
+/// counts[j] is exactly sturm( n, diag, offd, shifts[j] ).
+///
+template <typename scalar_t>
+void sturm_multi(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    int64_t nshifts, scalar_t const* shifts, int64_t* counts )
+{
+    lapack_error_if( n < 0 );
+    lapack_error_if( nshifts < 0 );
+
+    if (n == 0) {
+        std::fill_n( counts, nshifts, 0 );
+        return;
+    }
+
+    const int64_t w = internal::sturm_lanes< scalar_t >();
+    int64_t nblocks = (nshifts + w - 1) / w;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static ) \
+        if (n * nshifts >= internal::sturm_multi_parallel_min)
+    #endif
+    for (int64_t b = 0; b < nblocks; ++b) {
+        int64_t j = b*w;
+        if (j + w <= nshifts) {
+            internal::sturm_block( n, diag, offd, &shifts[ j ], &counts[ j ] );
+        }
+        else {
+            // last, partial block: pad by repeating the last shift
+            scalar_t shifts_b[ w ];
+            int64_t counts_b[ w ];
+            for (int64_t l = 0; l < w; ++l)
+                shifts_b[ l ] = shifts[ std::min( j + l, nshifts - 1 ) ];
+            internal::sturm_block( n, diag, offd, shifts_b, counts_b );
+            std::copy( counts_b, counts_b + (nshifts - j), &counts[ j ] );
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// tridiag_bisect keeps a list of intervals, each holding some wanted
+// eigenvalues, and refines up to sturm_lanes() of them at a time with one
+// sturm_block: each interval of the batch gets an equal share of the
+// lanes as interior points, so a batch of one interval is split into
+// sturm_lanes() + 1 subintervals, and a full batch is plain bisection of
+// sturm_lanes() intervals, which keeps all lanes busy from the first step.
+// Subintervals that still hold wanted eigenvalues go back on the list.
+// An interval is converged once its width is at most
+// atol + rtol * max( |lo|, |hi| ), as in stebz, or when it can no longer
+// be split; all the eigenvalues in it get its midpoint.
+//
+// When the list grows to two batches, half of it is handed to a new
+// OpenMP task, which idle threads take from the task queue, so the work
+// balances even when the spectrum splits unevenly.
+
+namespace internal {
+
+// Below this n * sturm_lanes(), tasks cost more than they save.
+const int64_t tridiag_bisect_task_min = sturm_multi_parallel_min;
+
+// Interval [lo, hi) holding eigenvalues clo, ..., chi-1 (0-based, in
+// ascending order), with clo < chi.
+template <typename scalar_t>
+struct bisect_interval {
+    scalar_t lo, hi;
+    int64_t clo, chi;
+};
+
+// Refines the intervals in work, storing eigenvalues ilo, ..., ihi-1
+// into w[ k - ilo ]. The intervals in work must hold only wanted
+// eigenvalues.
+template <typename scalar_t>
+void tridiag_bisect_refine(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    std::vector< bisect_interval< scalar_t > > work,
+    int64_t ilo, int64_t ihi, scalar_t atol, scalar_t rtol,
+    scalar_t* w )
+{
+    using interval = bisect_interval< scalar_t >;
+
+    const int64_t ns = sturm_lanes< scalar_t >();
+    scalar_t shifts[ ns ];
+    int64_t counts[ ns ];
+    interval batch[ ns ];
+    int64_t first[ ns + 1 ];
+
+    while (! work.empty()) {
+        #ifdef _OPENMP
+        int64_t size = work.size();
+        if (size >= 2*ns && n * ns >= tridiag_bisect_task_min) {
+            std::vector< interval > half( work.begin() + size/2, work.end() );
+            work.resize( size/2 );
+            #pragma omp task firstprivate( half )
+            tridiag_bisect_refine( n, diag, offd, std::move( half ),
+                                   ilo, ihi, atol, rtol, w );
+        }
+        #endif
+
+        // take q intervals; interval t gets lanes first[ t ], ...,
+        // first[ t+1 ] - 1 as its interior points
+        int64_t q = std::min( ns, int64_t( work.size() ) );
+        first[ 0 ] = 0;
+        for (int64_t t = 0; t < q; ++t) {
+            batch[ t ] = work.back();
+            work.pop_back();
+            first[ t+1 ] = first[ t ] + ns/q + (t < ns % q);
+
+            int64_t k = first[ t+1 ] - first[ t ];
+            scalar_t lo = batch[ t ].lo, hi = batch[ t ].hi;
+            scalar_t h = (hi - lo) / (k + 1);
+            for (int64_t j = 0; j < k; ++j)
+                shifts[ first[ t ] + j ] = std::min( lo + (j + 1)*h, hi );
+        }
+        sturm_block( n, diag, offd, shifts, counts );
+
+        for (int64_t t = 0; t < q; ++t) {
+            const interval& iv = batch[ t ];
+            // Scaled Sturm counts can be non-monotonic in rounding;
+            // clamp them so the subintervals partition [clo, chi).
+            // Counts outside [ilo, ihi) are clamped, too, so subintervals
+            // holding only unwanted eigenvalues are empty.
+            int64_t c = iv.clo;
+            for (int64_t l = first[ t ]; l < first[ t+1 ]; ++l) {
+                c = std::min( std::max( counts[ l ], c ), iv.chi );
+                counts[ l ] = c;
+            }
+            for (int64_t l = first[ t ]; l <= first[ t+1 ]; ++l) {
+                interval sub;
+                sub.lo  = (l == first[ t ]   ? iv.lo  : shifts[ l-1 ]);
+                sub.hi  = (l == first[ t+1 ] ? iv.hi  : shifts[ l ]);
+                sub.clo = (l == first[ t ]   ? iv.clo : counts[ l-1 ]);
+                sub.chi = (l == first[ t+1 ] ? iv.chi : counts[ l ]);
+                if (sub.clo >= sub.chi)
+                    continue;
+
+                // written so NaN is treated as converged
+                scalar_t tol = atol + rtol * std::max( std::abs( sub.lo ),
+                                                       std::abs( sub.hi ) );
+                bool stuck = (sub.lo == iv.lo && sub.hi == iv.hi);
+                if (! (sub.hi - sub.lo > tol) || stuck) {
+                    scalar_t mid = sub.lo + (sub.hi - sub.lo) / 2;
+                    for (int64_t k = sub.clo; k < sub.chi; ++k)
+                        w[ k - ilo ] = mid;
+                }
+                else {
+                    work.push_back( sub );
+                }
+            }
+        }
+    }
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+/// @ingroup heev_computational
+/// tridiag_bisect computes selected eigenvalues of a real symmetric
+/// tridiagonal matrix by bisection, using the scaled Sturm count of
+/// sturm(), like stebz but without calling LAPACK. Subintervals of the
+/// spectrum are refined in parallel using OpenMP tasks, so computing many
+/// eigenvalues of a large matrix scales with the number of threads.
+/// Only single and double precision exist.
+///
+/// Parameters:
+///  @param[in]        n: The order of the matrix. n >= 0.
+///  @param[in]     diag: a vector of 'n' diagonal elements.
+///  @param[in]     offd: a vector of 'n-1' off-diagonal elements.
+///  @param[in]    range:
+///     - lapack::Range::All:   all eigenvalues will be found.
+///     - lapack::Range::Value: all eigenvalues in the half-open interval
+///                             (vl,vu] will be found.
+///     - lapack::Range::Index: the il-th through iu-th eigenvalues will
+///                             be found.
+///  @param[in]       vl: If range=Value, the lower bound; vl < vu.
+///                       Not referenced otherwise.
+///  @param[in]       vu: If range=Value, the upper bound; vl < vu.
+///                       Not referenced otherwise.
+///  @param[in]       il: If range=Index, the index of the smallest
+///                       eigenvalue to be returned;
+///                       1 <= il <= iu <= n, if n > 0;
+///                       il = 1 and iu = 0 if n = 0.
+///                       Not referenced otherwise.
+///  @param[in]       iu: If range=Index, the index of the largest
+///                       eigenvalue to be returned.
+///                       Not referenced otherwise.
+///  @param[out]       w: a vector of length n; the first m elements hold
+///                       the selected eigenvalues in ascending order.
+///  @retval     m, the number of eigenvalues found, 0 <= m <= n.
+///                  If range = All, m = n; if range = Index, m = iu-il+1.
+///
+/// Eigenvalues are computed to an absolute accuracy of about
+/// eps * ||T||_1, as stebz does with abstol = 0.
+///
+template <typename scalar_t>
+int64_t tridiag_bisect(
+    int64_t n, scalar_t const* diag, scalar_t const* offd,
+    lapack::Range range, scalar_t vl, scalar_t vu,
+    int64_t il, int64_t iu, scalar_t* w )
+{
+    lapack_error_if( range != Range::All &&
+                     range != Range::Value &&
+                     range != Range::Index );
+    lapack_error_if( n < 0 );
+    if (range == Range::Value) {
+        lapack_error_if( ! (vl < vu) );
+    }
+    else if (range == Range::Index) {
+        lapack_error_if( il < 1 || il > std::max( int64_t( 1 ), n ) );
+        lapack_error_if( iu < std::min( n, il ) || iu > n );
+    }
+
+    if (n == 0)
+        return 0;
+
+    const scalar_t eps = std::numeric_limits< scalar_t >::epsilon();
+    const scalar_t safe_min = std::numeric_limits< scalar_t >::min();
+    const scalar_t fudge = 2.1;
+    const scalar_t inf = std::numeric_limits< scalar_t >::infinity();
+
+    // Gershgorin interval, widened as in stebz so that it holds all
+    // eigenvalues strictly inside.
+    scalar_t gl = diag[ 0 ], gu = diag[ 0 ], emax2 = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        scalar_t r = (i > 0     ? std::abs( offd[ i-1 ] ) : 0)
+                   + (i < n - 1 ? std::abs( offd[ i ] )   : 0);
+        gl = std::min( gl, diag[ i ] - r );
+        gu = std::max( gu, diag[ i ] + r );
+        if (i < n - 1)
+            emax2 = std::max( emax2, offd[ i ]*offd[ i ] );
+    }
+    scalar_t pivmin = safe_min * std::max( scalar_t( 1 ), emax2 );
+    scalar_t tnorm = std::max( std::abs( gl ), std::abs( gu ) );
+    gl -= fudge*tnorm*eps*n + 2*fudge*pivmin;
+    gu += fudge*tnorm*eps*n + 2*fudge*pivmin;
+
+    // stebz's default tolerances
+    scalar_t atol = std::max( eps*tnorm, pivmin );
+    scalar_t rtol = 2*eps;
+
+    scalar_t lo = gl, hi = gu;
+    int64_t clo = 0, chi = n;
+    int64_t ilo = 0, ihi = n;
+    if (range == Range::Value) {
+        // eigenvalues in (vl, vu] are those in [vl^+, vu^+),
+        // where x^+ is the next number after x
+        scalar_t vlp = std::nextafter( vl, inf );
+        scalar_t vup = std::nextafter( vu, inf );
+        if (vlp > gl) {
+            lo = vlp;
+            clo = sturm( n, diag, offd, lo );
+        }
+        if (vup < gu) {
+            hi = vup;
+            chi = sturm( n, diag, offd, hi );
+        }
+        if (! (lo < hi))
+            return 0;
+        ilo = clo;
+        ihi = chi;
+    }
+    else if (range == Range::Index) {
+        ilo = il - 1;
+        ihi = iu;
+    }
+
+    clo = std::max( clo, ilo );
+    chi = std::min( chi, ihi );
+    if (clo >= chi)
+        return 0;
+
+    std::vector< internal::bisect_interval< scalar_t > > work;
+    work.push_back( { lo, hi, clo, chi } );
+
+    #ifdef _OPENMP
+    #pragma omp parallel \
+        if (n * internal::sturm_lanes< scalar_t >() >= internal::tridiag_bisect_task_min)
+    #pragma omp single
+    #endif
+    internal::tridiag_bisect_refine( n, diag, offd, std::move( work ),
+                                     ilo, ihi, atol, rtol, w );
+
+    return ihi - ilo;
+}
+
 //------------------------------------------------------------------------------
 // Explicit instantiations.
 template
@@ -160,4 +543,26 @@ template
 int64_t sturm<double>(
     int64_t n, double const* diag, double const* offd, double u );
 
+template
+void sturm_multi<float>(
+    int64_t n, float const* diag, float const* offd,
+    int64_t nshifts, float const* shifts, int64_t* counts );
+
+template
+void sturm_multi<double>(
+    int64_t n, double const* diag, double const* offd,
+    int64_t nshifts, double const* shifts, int64_t* counts );
+
+template
+int64_t tridiag_bisect<float>(
+    int64_t n, float const* diag, float const* offd,
+    lapack::Range range, float vl, float vu,
+    int64_t il, int64_t iu, float* w );
+
+template
+int64_t tridiag_bisect<double>(
+    int64_t n, double const* diag, double const* offd,
+    lapack::Range range, double vl, double vu,
+    int64_t il, int64_t iu, double* w );
+
 } // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -24,6 +25,8 @@ int64_t syequb(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "ssyequb", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -37,6 +40,7 @@ int64_t syequb(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssyequb(
         &uplo_, &n_,
         A, &lda_,
@@ -61,6 +65,8 @@ int64_t syequb(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "dsyequb", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -74,6 +80,7 @@ int64_t syequb(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsyequb(
         &uplo_, &n_,
         A, &lda_,
@@ -98,6 +105,8 @@ int64_t syequb(
     float* scond,
     float* amax )
 {
+    LAPACK_INSTRUMENT( "csyequb", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -111,6 +120,7 @@ int64_t syequb(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_csyequb(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -180,6 +190,8 @@ int64_t syequb(
     double* scond,
     double* amax )
 {
+    LAPACK_INSTRUMENT( "zsyequb", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -193,6 +205,7 @@ int64_t syequb(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zsyequb(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "WorkSizeCache.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +24,52 @@ int64_t syev(
     float* A, int64_t lda,
     float* W )
 {
+    LAPACK_INSTRUMENT( "ssyev", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    syev_work_size( jobz, uplo, n, A, lda, W,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return syev_work( jobz, uplo, n, A, lda, W,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::heev
+/// @ingroup heev
+int64_t syev(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W )
+{
+    LAPACK_INSTRUMENT( "dsyev", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    syev_work_size( jobz, uplo, n, A, lda, W,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return syev_work( jobz, uplo, n, A, lda, W,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev
+void syev_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* W,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "ssyev_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -33,6 +81,12 @@ int64_t syev(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "ssyev", jobz_, uplo_, n_, lda_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
     // query for workspace size
     float qry_work[1];
     lapack_int ineg_one = -1;
@@ -48,16 +102,52 @@ int64_t syev(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Queries the workspace needed by `lapack::syev_work`.
+/// Arguments through W are the same as for `lapack::syev`.
+/// See `lapack::heev_work_size`, which also covers complex matrices.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @ingroup heev
+void syev_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dsyev_work_size", 0, n, 0 );
 
-    LAPACK_ssyev(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "dsyev", jobz_, uplo_, n_, lda_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsyev(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -65,36 +155,39 @@ int64_t syev(
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::heev
 /// @ingroup heev
-int64_t syev(
+int64_t syev_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* W )
+    float* A, int64_t lda,
+    float* W,
+    float* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "ssyev_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char jobz_ = job2char( jobz );
     char uplo_ = uplo2char( uplo );
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsyev(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_ssyev(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -102,16 +195,47 @@ int64_t syev(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Same as `lapack::syev`, but using workspace provided by the caller.
+/// See `lapack::heev_work`, which also covers complex matrices.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::syev_work_size`.
+///
+/// @ingroup heev
+int64_t syev_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* W,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dsyev_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsyev(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         W,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
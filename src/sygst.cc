@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t sygst(
     float* A, int64_t lda,
     float const* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ssygst", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -34,6 +37,7 @@ int64_t sygst(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssygst(
         &itype_, &uplo_, &n_,
         A, &lda_,
@@ -54,6 +58,8 @@ int64_t sygst(
     double* A, int64_t lda,
     double const* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dsygst", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(itype) > std::numeric_limits<lapack_int>::max() );
@@ -68,6 +74,7 @@ int64_t sygst(
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsygst(
         &itype_, &uplo_, &n_,
         A, &lda_,
@@ -8,6 +8,7 @@
 
 #include "lapack/fortran.h"
 #include "lapack.hh"
+#include "Instrument.hh"
 
 #include <limits>
 
@@ -28,6 +29,8 @@ void symv(
         std::complex<float> beta,
         std::complex<float>       *y, int64_t incy )
 {
+    LAPACK_INSTRUMENT( "csymv", 0, n, 0 );
+
     // check arguments
     lapack_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -57,6 +60,7 @@ void symv(
     }
 
     char uplo_ = uplo2char( uplo );
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_csymv( &uplo_, &n_,
                 (lapack_complex_float*) &alpha,
                 (lapack_complex_float*) A, &lda_,
@@ -81,6 +85,8 @@ void symv(
         std::complex<double> beta,
         std::complex<double>       *y, int64_t incy )
 {
+    LAPACK_INSTRUMENT( "zsymv", 0, n, 0 );
+
     // check arguments
     lapack_error_if( layout != Layout::ColMajor &&
                    layout != Layout::RowMajor );
@@ -110,6 +116,7 @@ void symv(
     }
 
     char uplo_ = uplo2char( uplo );
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zsymv( &uplo_, &n_,
                 (lapack_complex_double*) &alpha,
                 (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 // while [cz]syr are in LAPACK, [sd]syr are in BLAS,
 // so we put them all in the blas namespace
@@ -24,6 +25,8 @@ void syr(
     std::complex<float> const *x, int64_t incx,
     std::complex<float>       *A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "csyr", 0, n, 0 );
+
     // check arguments
     lapack_error_if( layout != Layout::ColMajor &&
                layout != Layout::RowMajor );
@@ -50,6 +53,7 @@ void syr(
     }
 
     char uplo_ = uplo2char( uplo );
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_csyr( &uplo_, &n_,
                  (lapack_complex_float*) &alpha,
                  (lapack_complex_float*) x, &incx_,
@@ -70,6 +74,8 @@ void syr(
     std::complex<double> const *x, int64_t incx,
     std::complex<double>       *A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "zsyr", 0, n, 0 );
+
     // check arguments
     lapack_error_if( layout != Layout::ColMajor &&
                layout != Layout::RowMajor );
@@ -96,6 +102,7 @@ void syr(
     }
 
     char uplo_ = uplo2char( uplo );
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zsyr( &uplo_, &n_,
                  (lapack_complex_double*) &alpha,
                  (lapack_complex_double*) x, &incx_,
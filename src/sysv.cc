@@ -6,6 +6,8 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "WorkSizeCache.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +25,176 @@ int64_t sysv(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ssysv", 0, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    sysv_work_size( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sysv_work( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "dsysv", 0, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    sysv_work_size( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sysv_work( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "csysv", 0, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    sysv_work_size( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return sysv_work( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+///     $A X = B$,
+/// where A is an n-by-n symmetric matrix and X and B are n-by-nrhs
+/// matrices.
+///
+/// The diagonal pivoting method is used to factor A as
+///     $A = U D U^T$ if uplo = Upper, or
+///     $A = L D L^T$ if uplo = Lower,
+/// where U (or L) is a product of permutation and unit upper (lower)
+/// triangular matrices, and D is symmetric and block diagonal with
+/// 1-by-1 and 2-by-2 diagonal blocks. The factored form of A is then
+/// used to solve the system of equations $A X = B$.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, `lapack::hesv` is an alias for this.
+/// For complex Hermitian matrices, see `lapack::hesv`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     On entry, the symmetric matrix A.
+///     - If uplo = Upper, the leading
+///     n-by-n upper triangular part of A contains the upper
+///     triangular part of the matrix A, and the strictly lower
+///     triangular part of A is not referenced.
+///
+///     - If uplo = Lower, the
+///     leading n-by-n lower triangular part of A contains the lower
+///     triangular part of the matrix A, and the strictly upper
+///     triangular part of A is not referenced.
+///
+///     - On successful exit, the block diagonal matrix D and the
+///     multipliers used to obtain the factor U or L from the
+///     factorization $A = U D U^T$ or $A = L D L^T$ as computed by
+///     `lapack::sytrf`.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n.
+///     Details of the interchanges and the block structure of D, as
+///     determined by `lapack::sytrf`. If ipiv(k) > 0, then rows and columns
+///     k and ipiv(k) were interchanged, and D(k,k) is a 1-by-1
+///     diagonal block.
+///     - If uplo = Upper and ipiv(k) = ipiv(k-1) < 0,
+///     then rows and columns k-1 and -ipiv(k) were interchanged and
+///     D(k-1:k,k-1:k) is a 2-by-2 diagonal block.
+///
+///     - If uplo = Lower and
+///     ipiv(k) = ipiv(k+1) < 0, then rows and columns k+1 and
+///     -ipiv(k) were interchanged and D(k:k+1,k:k+1) is a 2-by-2
+///     diagonal block.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On successful exit, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, D(i,i) is exactly zero. The factorization
+///              has been completed, but the block diagonal matrix D is
+///              exactly singular, so the solution could not be computed.
+///
+/// @ingroup sysv
+int64_t sysv(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "zsysv", 0, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    sysv_work_size( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                    &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return sysv_work( uplo, n, nrhs, A, lda, ipiv, B, ldb,
+                      work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "ssysv_work_size", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -34,23 +206,23 @@ int64_t sysv(
     lapack_int n_ = (lapack_int) n;
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "ssysv", uplo_, n_, nrhs_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size; ipiv is not referenced
     float qry_work[1];
+    lapack_int qry_ipiv[1];
     lapack_int ineg_one = -1;
     LAPACK_ssysv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
-        ipiv_ptr,
+        qry_ipiv,
         B, &ldb_,
         qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
@@ -60,17 +232,51 @@ int64_t sysv(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dsysv_work_size", 0, n, nrhs );
 
-    LAPACK_ssysv(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "dsysv", uplo_, n_, nrhs_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size; ipiv is not referenced
+    double qry_work[1];
+    lapack_int qry_ipiv[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsysv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
-        ipiv_ptr,
+        qry_ipiv,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -78,20 +284,21 @@ int64_t sysv(
     if (info_ < 0) {
         throw Error();
     }
-    #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
-    #endif
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
 }
 
 // -----------------------------------------------------------------------------
 /// @ingroup sysv
-int64_t sysv(
+void sysv_work_size(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
+    std::complex<float>* A, int64_t lda,
     int64_t* ipiv,
-    double* B, int64_t ldb )
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "csysv_work_size", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -103,25 +310,25 @@ int64_t sysv(
     lapack_int n_ = (lapack_int) n;
     lapack_int nrhs_ = (lapack_int) nrhs;
     lapack_int lda_ = (lapack_int) lda;
-    #ifndef LAPACK_ILP64
-        // 32-bit copy
-        lapack::vector< lapack_int > ipiv_( (n) );
-        lapack_int* ipiv_ptr = &ipiv_[0];
-    #else
-        lapack_int* ipiv_ptr = ipiv;
-    #endif
     lapack_int ldb_ = (lapack_int) ldb;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "csysv", uplo_, n_, nrhs_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size; ipiv is not referenced
+    std::complex<float> qry_work[1];
+    lapack_int qry_ipiv[1];
     lapack_int ineg_one = -1;
-    LAPACK_dsysv(
+    LAPACK_csysv(
         &uplo_, &n_, &nrhs_,
-        A, &lda_,
-        ipiv_ptr,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
+        (lapack_complex_float*) A, &lda_,
+        qry_ipiv,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -129,17 +336,113 @@ int64_t sysv(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Queries the workspace size needed by `lapack::sysv_work`.
+/// Arguments through ldb are the same as for `lapack::sysv`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @ingroup sysv
+void sysv_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "zsysv_work_size", 0, n, nrhs );
 
-    LAPACK_dsysv(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    // reuse sizes from an earlier query with the same arguments
+    auto key = internal::work_size_key(
+        "zsysv", uplo_, n_, nrhs_, lda_, ldb_ );
+    if (internal::work_size_lookup( key, lwork ))
+        return;
+
+    // query for workspace size; ipiv is not referenced
+    std::complex<double> qry_work[1];
+    lapack_int qry_ipiv[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zsysv(
+        &uplo_, &n_, &nrhs_,
+        (lapack_complex_double*) A, &lda_,
+        qry_ipiv,
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    internal::work_size_insert( key, *lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_work(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "ssysv_work", 0, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_ssysv(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
         ipiv_ptr,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -155,18 +458,22 @@ int64_t sysv(
 
 // -----------------------------------------------------------------------------
 /// @ingroup sysv
-int64_t sysv(
+int64_t sysv_work(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
+    double* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb )
+    double* B, int64_t ldb,
+    double* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "dsysv_work", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char uplo_ = uplo2char( uplo );
     lapack_int n_ = (lapack_int) n;
@@ -180,17 +487,16 @@ int64_t sysv(
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_csysv(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dsysv(
         &uplo_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
+        A, &lda_,
         ipiv_ptr,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        B, &ldb_,
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -198,17 +504,53 @@ int64_t sysv(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_work(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "csysv_work", 0, n, nrhs );
 
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_csysv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr,
         (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -223,98 +565,41 @@ int64_t sysv(
 }
 
 // -----------------------------------------------------------------------------
-/// Computes the solution to a system of linear equations
-///     $A X = B$,
-/// where A is an n-by-n symmetric matrix and X and B are n-by-nrhs
-/// matrices.
-///
-/// The diagonal pivoting method is used to factor A as
-///     $A = U D U^T$ if uplo = Upper, or
-///     $A = L D L^T$ if uplo = Lower,
-/// where U (or L) is a product of permutation and unit upper (lower)
-/// triangular matrices, and D is symmetric and block diagonal with
-/// 1-by-1 and 2-by-2 diagonal blocks. The factored form of A is then
-/// used to solve the system of equations $A X = B$.
+/// Variant of `lapack::sysv` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::sysv_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ldb and the return value are the same as for
+/// `lapack::sysv`.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
-/// For real matrices, `lapack::hesv` is an alias for this.
-/// For complex Hermitian matrices, see `lapack::hesv`.
 ///
-/// @param[in] uplo
-///     - lapack::Uplo::Upper: Upper triangle of A is stored;
-///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+/// @param work
+///     The vector work of length lwork.
 ///
-/// @param[in] n
-///     The number of linear equations, i.e., the order of the
-///     matrix A. n >= 0.
-///
-/// @param[in] nrhs
-///     The number of right hand sides, i.e., the number of columns
-///     of the matrix B. nrhs >= 0.
-///
-/// @param[in,out] A
-///     The n-by-n matrix A, stored in an lda-by-n array.
-///     On entry, the symmetric matrix A.
-///     - If uplo = Upper, the leading
-///     n-by-n upper triangular part of A contains the upper
-///     triangular part of the matrix A, and the strictly lower
-///     triangular part of A is not referenced.
-///
-///     - If uplo = Lower, the
-///     leading n-by-n lower triangular part of A contains the lower
-///     triangular part of the matrix A, and the strictly upper
-///     triangular part of A is not referenced.
-///
-///     - On successful exit, the block diagonal matrix D and the
-///     multipliers used to obtain the factor U or L from the
-///     factorization $A = U D U^T$ or $A = L D L^T$ as computed by
-///     `lapack::sytrf`.
-///
-/// @param[in] lda
-///     The leading dimension of the array A. lda >= max(1,n).
-///
-/// @param[out] ipiv
-///     The vector ipiv of length n.
-///     Details of the interchanges and the block structure of D, as
-///     determined by `lapack::sytrf`. If ipiv(k) > 0, then rows and columns
-///     k and ipiv(k) were interchanged, and D(k,k) is a 1-by-1
-///     diagonal block.
-///     - If uplo = Upper and ipiv(k) = ipiv(k-1) < 0,
-///     then rows and columns k-1 and -ipiv(k) were interchanged and
-///     D(k-1:k,k-1:k) is a 2-by-2 diagonal block.
-///
-///     - If uplo = Lower and
-///     ipiv(k) = ipiv(k+1) < 0, then rows and columns k+1 and
-///     -ipiv(k) were interchanged and D(k:k+1,k:k+1) is a 2-by-2
-///     diagonal block.
-///
-/// @param[in,out] B
-///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
-///     On entry, the n-by-nrhs right hand side matrix B.
-///     On successful exit, the n-by-nrhs solution matrix X.
-///
-/// @param[in] ldb
-///     The leading dimension of the array B. ldb >= max(1,n).
-///
-/// @return = 0: successful exit
-/// @return > 0: if return value = i, D(i,i) is exactly zero. The factorization
-///              has been completed, but the block diagonal matrix D is
-///              exactly singular, so the solution could not be computed.
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::sysv_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
 ///
 /// @ingroup sysv
-int64_t sysv(
+int64_t sysv_work(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
     int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb )
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "zsysv_work", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char uplo_ = uplo2char( uplo );
     lapack_int n_ = (lapack_int) n;
@@ -328,35 +613,16 @@ int64_t sysv(
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zsysv(
-        &uplo_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zsysv(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
         (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
 
@@ -26,6 +27,214 @@ int64_t sysv_rk(
     int64_t* ipiv,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ssysv_rk", 0, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    sysv_rk_work_size( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                       &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sysv_rk_work( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                         work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "dsysv_rk", 0, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    sysv_rk_work_size( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                       &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sysv_rk_work( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                         work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "csysv_rk", 0, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    sysv_rk_work_size( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                       &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return sysv_rk_work( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                         work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the solution to a system of linear equations
+/// \[
+///     A X = B,
+/// \]
+/// where A is an n-by-n symmetric matrix and X and B are n-by-nrhs matrices.
+///
+/// The bounded Bunch-Kaufman (rook) diagonal pivoting method is used
+/// to factor A as
+///     $A = P U D U^T P^T$ if uplo = Upper, or
+///     $A = P L D L^T P^T$ if uplo = Lower,
+/// where U (or L) is unit upper (or lower) triangular matrix,
+/// $U^T$ (or $L^T$) is the transpose of U (or L), P is a permutation
+/// matrix, $P^T$ is the transpose of P, and D is symmetric and block
+/// diagonal with 1-by-1 and 2-by-2 diagonal blocks.
+///
+/// `lapack::sytrf_rk` is called to compute the factorization of a
+/// symmetric matrix. The factored form of A is then used to solve
+/// the system of equations $A X = B$ by calling `lapack::sytrs_rk`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, `lapack::hesv_rk` is an alias for this.
+/// For complex Hermitian matrices, see `lapack::hesv_rk`.
+///
+/// @param[in] uplo
+///     Whether the upper or lower triangular part of the
+///     symmetric matrix A is stored:
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The number of linear equations, i.e., the order of the
+///     matrix A. n >= 0.
+///
+/// @param[in] nrhs
+///     The number of right hand sides, i.e., the number of columns
+///     of the matrix B. nrhs >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     - On entry, the symmetric matrix A.
+///       - If uplo = Upper: the leading n-by-n upper triangular part
+///       of A contains the upper triangular part of the matrix A,
+///       and the strictly lower triangular part of A is not
+///       referenced.
+///
+///       - If uplo = Lower: the leading n-by-n lower triangular part
+///       of A contains the lower triangular part of the matrix A,
+///       and the strictly upper triangular part of A is not
+///       referenced.
+///
+///     - On successful exit, diagonal of the block diagonal
+///     matrix D and factors U or L as computed by `lapack::sytrf_rk`:
+///       - ONLY diagonal elements of the symmetric block diagonal
+///         matrix D on the diagonal of A, i.e. D(k,k) = A(k,k);
+///         (superdiagonal (or subdiagonal) elements of D
+///         are stored on exit in array E), and
+///       - If uplo = Upper: factor U in the superdiagonal part of A.
+///       - If uplo = Lower: factor L in the subdiagonal part of A.
+///
+///     - For more info see the description of `lapack::sytrf_rk`.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] E
+///     The vector E of length n.
+///     On exit, contains the output computed by the factorization
+///     routine `lapack::sytrf_rk`, i.e. the superdiagonal (or subdiagonal)
+///     elements of the symmetric block diagonal matrix D
+///     with 1-by-1 or 2-by-2 diagonal blocks, where
+///     - If uplo = Upper: E(i) = D(i-1,i), i=2:n, E(1) is set to 0;
+///     - If uplo = Lower: E(i) = D(i+1,i), i=1:n-1, E(n) is set to 0.
+///
+///     - Note: For 1-by-1 diagonal block D(k), where
+///     1 <= k <= n, the element E(k) is set to 0 in both
+///     uplo = Upper or uplo = Lower cases.
+///
+///     - For more info see the description of `lapack::sytrf_rk`.
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n.
+///     Details of the interchanges and the block structure of D,
+///     as determined by `lapack::sytrf_rk`.
+///     For more info see the description of `lapack::sytrf_rk`.
+///
+/// @param[in,out] B
+///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
+///     On entry, the n-by-nrhs right hand side matrix B.
+///     On successful exit, the n-by-nrhs solution matrix X.
+///
+/// @param[in] ldb
+///     The leading dimension of the array B. ldb >= max(1,n).
+///
+/// @return = 0: successful exit
+/// @return > 0: If return value = k, the matrix A is singular, because:
+///     If uplo = Upper: column k in the upper
+///     triangular part of A contains all zeros.
+///     If uplo = Lower: column k in the lower
+///     triangular part of A contains all zeros.
+///
+///     Therefore D(k,k) is exactly zero, and superdiagonal
+///     elements of column k of U (or subdiagonal elements of
+///     column k of L ) are all zeros. The factorization has
+///     been completed, but the block diagonal matrix D is
+///     exactly singular, and division by zero will occur if
+///     it is used to solve a system of equations.
+///
+///     NOTE: info only stores the first occurrence of
+///     a singularity, any subsequent occurrence of singularity
+///     is not stored in info even though the factorization
+///     always completes.
+///
+/// @ingroup sysv
+int64_t sysv_rk(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
+    int64_t* ipiv,
+    std::complex<double>* B, int64_t ldb )
+{
+    LAPACK_INSTRUMENT( "zsysv_rk", 0, n, nrhs );
+
+    // query for workspace size
+    int64_t lwork;
+    sysv_rk_work_size( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                       &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return sysv_rk_work( uplo, n, nrhs, A, lda, E, ipiv, B, ldb,
+                         work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "ssysv_rk_work_size", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -64,18 +273,52 @@ int64_t sysv_rk(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    double* A, int64_t lda,
+    double* E,
+    int64_t* ipiv,
+    double* B, int64_t ldb,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dsysv_rk_work_size", 0, n, nrhs );
 
-    LAPACK_ssysv_rk(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsysv_rk(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
         E,
         ipiv_ptr,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -83,21 +326,84 @@ int64_t sysv_rk(
     if (info_ < 0) {
         throw Error();
     }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+void sysv_rk_work_size(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "csysv_rk_work_size", 0, n, nrhs );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
     #endif
-    return info_;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_csysv_rk(
+        &uplo_, &n_, &nrhs_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) E,
+        ipiv_ptr,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
+/// Queries the workspace size needed by `lapack::sysv_rk_work`.
+/// Arguments through ldb are the same as for `lapack::sysv_rk`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
 /// @ingroup sysv
-int64_t sysv_rk(
+void sysv_rk_work_size(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    double* A, int64_t lda,
-    double* E,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* E,
     int64_t* ipiv,
-    double* B, int64_t ldb )
+    std::complex<double>* B, int64_t ldb,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "zsysv_rk_work_size", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -120,15 +426,15 @@ int64_t sysv_rk(
     lapack_int info_ = 0;
 
     // query for workspace size
-    double qry_work[1];
+    std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dsysv_rk(
+    LAPACK_zsysv_rk(
         &uplo_, &n_, &nrhs_,
-        A, &lda_,
-        E,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) E,
         ipiv_ptr,
-        B, &ldb_,
-        qry_work, &ineg_one, &info_
+        (lapack_complex_double*) B, &ldb_,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -136,18 +442,52 @@ int64_t sysv_rk(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_rk_work(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    float* A, int64_t lda,
+    float* E,
+    int64_t* ipiv,
+    float* B, int64_t ldb,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "ssysv_rk_work", 0, n, nrhs );
 
-    LAPACK_dsysv_rk(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_ssysv_rk(
         &uplo_, &n_, &nrhs_,
         A, &lda_,
         E,
         ipiv_ptr,
         B, &ldb_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -163,19 +503,23 @@ int64_t sysv_rk(
 
 // -----------------------------------------------------------------------------
 /// @ingroup sysv
-int64_t sysv_rk(
+int64_t sysv_rk_work(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float>* E,
+    double* A, int64_t lda,
+    double* E,
     int64_t* ipiv,
-    std::complex<float>* B, int64_t ldb )
+    double* B, int64_t ldb,
+    double* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "dsysv_rk_work", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char uplo_ = uplo2char( uplo );
     lapack_int n_ = (lapack_int) n;
@@ -189,18 +533,17 @@ int64_t sysv_rk(
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_csysv_rk(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dsysv_rk(
         &uplo_, &n_, &nrhs_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) E,
+        A, &lda_,
+        E,
         ipiv_ptr,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        B, &ldb_,
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -208,18 +551,55 @@ int64_t sysv_rk(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv
+int64_t sysv_rk_work(
+    lapack::Uplo uplo, int64_t n, int64_t nrhs,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* E,
+    int64_t* ipiv,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "csysv_rk_work", 0, n, nrhs );
 
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int nrhs_ = (lapack_int) nrhs;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_csysv_rk(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) E,
         ipiv_ptr,
         (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -234,133 +614,42 @@ int64_t sysv_rk(
 }
 
 // -----------------------------------------------------------------------------
-/// Computes the solution to a system of linear equations
-/// \[
-///     A X = B,
-/// \]
-/// where A is an n-by-n symmetric matrix and X and B are n-by-nrhs matrices.
-///
-/// The bounded Bunch-Kaufman (rook) diagonal pivoting method is used
-/// to factor A as
-///     $A = P U D U^T P^T$ if uplo = Upper, or
-///     $A = P L D L^T P^T$ if uplo = Lower,
-/// where U (or L) is unit upper (or lower) triangular matrix,
-/// $U^T$ (or $L^T$) is the transpose of U (or L), P is a permutation
-/// matrix, $P^T$ is the transpose of P, and D is symmetric and block
-/// diagonal with 1-by-1 and 2-by-2 diagonal blocks.
-///
-/// `lapack::sytrf_rk` is called to compute the factorization of a
-/// symmetric matrix. The factored form of A is then used to solve
-/// the system of equations $A X = B$ by calling `lapack::sytrs_rk`.
+/// Variant of `lapack::sysv_rk` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::sysv_rk_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ldb and the return value are the same as for
+/// `lapack::sysv_rk`.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
-/// For real matrices, `lapack::hesv_rk` is an alias for this.
-/// For complex Hermitian matrices, see `lapack::hesv_rk`.
-///
-/// @param[in] uplo
-///     Whether the upper or lower triangular part of the
-///     symmetric matrix A is stored:
-///     - lapack::Uplo::Upper: Upper triangle of A is stored;
-///     - lapack::Uplo::Lower: Lower triangle of A is stored.
-///
-/// @param[in] n
-///     The number of linear equations, i.e., the order of the
-///     matrix A. n >= 0.
-///
-/// @param[in] nrhs
-///     The number of right hand sides, i.e., the number of columns
-///     of the matrix B. nrhs >= 0.
-///
-/// @param[in,out] A
-///     The n-by-n matrix A, stored in an lda-by-n array.
-///     - On entry, the symmetric matrix A.
-///       - If uplo = Upper: the leading n-by-n upper triangular part
-///       of A contains the upper triangular part of the matrix A,
-///       and the strictly lower triangular part of A is not
-///       referenced.
-///
-///       - If uplo = Lower: the leading n-by-n lower triangular part
-///       of A contains the lower triangular part of the matrix A,
-///       and the strictly upper triangular part of A is not
-///       referenced.
-///
-///     - On successful exit, diagonal of the block diagonal
-///     matrix D and factors U or L as computed by `lapack::sytrf_rk`:
-///       - ONLY diagonal elements of the symmetric block diagonal
-///         matrix D on the diagonal of A, i.e. D(k,k) = A(k,k);
-///         (superdiagonal (or subdiagonal) elements of D
-///         are stored on exit in array E), and
-///       - If uplo = Upper: factor U in the superdiagonal part of A.
-///       - If uplo = Lower: factor L in the subdiagonal part of A.
-///
-///     - For more info see the description of `lapack::sytrf_rk`.
-///
-/// @param[in] lda
-///     The leading dimension of the array A. lda >= max(1,n).
-///
-/// @param[out] E
-///     The vector E of length n.
-///     On exit, contains the output computed by the factorization
-///     routine `lapack::sytrf_rk`, i.e. the superdiagonal (or subdiagonal)
-///     elements of the symmetric block diagonal matrix D
-///     with 1-by-1 or 2-by-2 diagonal blocks, where
-///     - If uplo = Upper: E(i) = D(i-1,i), i=2:n, E(1) is set to 0;
-///     - If uplo = Lower: E(i) = D(i+1,i), i=1:n-1, E(n) is set to 0.
-///
-///     - Note: For 1-by-1 diagonal block D(k), where
-///     1 <= k <= n, the element E(k) is set to 0 in both
-///     uplo = Upper or uplo = Lower cases.
-///
-///     - For more info see the description of `lapack::sytrf_rk`.
 ///
-/// @param[out] ipiv
-///     The vector ipiv of length n.
-///     Details of the interchanges and the block structure of D,
-///     as determined by `lapack::sytrf_rk`.
-///     For more info see the description of `lapack::sytrf_rk`.
-///
-/// @param[in,out] B
-///     The n-by-nrhs matrix B, stored in an ldb-by-nrhs array.
-///     On entry, the n-by-nrhs right hand side matrix B.
-///     On successful exit, the n-by-nrhs solution matrix X.
-///
-/// @param[in] ldb
-///     The leading dimension of the array B. ldb >= max(1,n).
-///
-/// @return = 0: successful exit
-/// @return > 0: If return value = k, the matrix A is singular, because:
-///     If uplo = Upper: column k in the upper
-///     triangular part of A contains all zeros.
-///     If uplo = Lower: column k in the lower
-///     triangular part of A contains all zeros.
-///
-///     Therefore D(k,k) is exactly zero, and superdiagonal
-///     elements of column k of U (or subdiagonal elements of
-///     column k of L ) are all zeros. The factorization has
-///     been completed, but the block diagonal matrix D is
-///     exactly singular, and division by zero will occur if
-///     it is used to solve a system of equations.
+/// @param work
+///     The vector work of length lwork.
 ///
-///     NOTE: info only stores the first occurrence of
-///     a singularity, any subsequent occurrence of singularity
-///     is not stored in info even though the factorization
-///     always completes.
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::sysv_rk_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
 ///
 /// @ingroup sysv
-int64_t sysv_rk(
+int64_t sysv_rk_work(
     lapack::Uplo uplo, int64_t n, int64_t nrhs,
     std::complex<double>* A, int64_t lda,
     std::complex<double>* E,
     int64_t* ipiv,
-    std::complex<double>* B, int64_t ldb )
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "zsysv_rk_work", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(nrhs) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char uplo_ = uplo2char( uplo );
     lapack_int n_ = (lapack_int) n;
@@ -374,37 +663,17 @@ int64_t sysv_rk(
         lapack_int* ipiv_ptr = ipiv;
     #endif
     lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zsysv_rk(
-        &uplo_, &n_, &nrhs_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) E,
-        ipiv_ptr,
-        (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zsysv_rk(
         &uplo_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) E,
         ipiv_ptr,
         (lapack_complex_double*) B, &ldb_,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30300  // >= 3.3
 
@@ -22,6 +23,8 @@ void syswapr(
     lapack::Uplo uplo, int64_t n,
     float* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    LAPACK_INSTRUMENT( "ssyswapr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ void syswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ssyswapr(
         &uplo_, &n_,
         A, &lda_, &i1_, &i2_
@@ -50,6 +54,8 @@ void syswapr(
     lapack::Uplo uplo, int64_t n,
     double* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    LAPACK_INSTRUMENT( "dsyswapr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -63,6 +69,7 @@ void syswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsyswapr(
         &uplo_, &n_,
         A, &lda_, &i1_, &i2_
@@ -78,6 +85,8 @@ void syswapr(
     lapack::Uplo uplo, int64_t n,
     std::complex<float>* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    LAPACK_INSTRUMENT( "csyswapr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -91,6 +100,7 @@ void syswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_csyswapr(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_, &i1_, &i2_
@@ -136,6 +146,8 @@ void syswapr(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda, int64_t i1, int64_t i2 )
 {
+    LAPACK_INSTRUMENT( "zsyswapr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -149,6 +161,7 @@ void syswapr(
     lapack_int i1_ = (lapack_int) i1;
     lapack_int i2_ = (lapack_int) i2;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zsyswapr(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_, &i1_, &i2_
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= v3.7
 
@@ -27,6 +28,58 @@ int64_t sytrd_2stage(
     float* tau,
     float* hous2, int64_t lhous2 )
 {
+    LAPACK_INSTRUMENT( "ssytrd_2stage", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    sytrd_2stage_work_size( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                            &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sytrd_2stage_work( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                              work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::hetrd_2stage
+/// @ingroup heev_computational
+int64_t sytrd_2stage(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2 )
+{
+    LAPACK_INSTRUMENT( "dsytrd_2stage", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    sytrd_2stage_work_size( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                            &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sytrd_2stage_work( jobz, uplo, n, A, lda, D, E, tau, hous2, lhous2,
+                              work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup heev_computational
+void sytrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "ssytrd_2stage_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -58,19 +111,47 @@ int64_t sytrd_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @see lapack::hetrd_2stage_work_size
+/// @ingroup heev_computational
+void sytrd_2stage_work_size(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dsytrd_2stage_work_size", 0, n, 0 );
 
-    LAPACK_ssytrd_2stage(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lhous2) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lhous2_ = (lapack_int) lhous2;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsytrd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         D,
         E,
         tau,
         hous2, &lhous2_,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -78,44 +159,46 @@ int64_t sytrd_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
-/// @see lapack::hetrd_2stage
 /// @ingroup heev_computational
-int64_t sytrd_2stage(
+int64_t sytrd_2stage_work(
     lapack::Job jobz, lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double* D,
-    double* E,
-    double* tau,
-    double* hous2, int64_t lhous2 )
+    float* A, int64_t lda,
+    float* D,
+    float* E,
+    float* tau,
+    float* hous2, int64_t lhous2,
+    float* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "ssytrd_2stage_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lhous2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char jobz_ = job2char( jobz );
     char uplo_ = uplo2char( uplo );
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
     lapack_int lhous2_ = (lapack_int) lhous2;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dsytrd_2stage(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_ssytrd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
         D,
         E,
         tau,
         hous2, &lhous2_,
-        qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -123,11 +206,39 @@ int64_t sytrd_2stage(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @see lapack::hetrd_2stage_work
+/// @ingroup heev_computational
+int64_t sytrd_2stage_work(
+    lapack::Job jobz, lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double* D,
+    double* E,
+    double* tau,
+    double* hous2, int64_t lhous2,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dsytrd_2stage_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lhous2) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char jobz_ = job2char( jobz );
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int lhous2_ = (lapack_int) lhous2;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dsytrd_2stage(
         &jobz_, &uplo_, &n_,
         A, &lda_,
@@ -135,7 +246,7 @@ int64_t sytrd_2stage(
         E,
         tau,
         hous2, &lhous2_,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
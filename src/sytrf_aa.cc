@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
 
@@ -24,6 +25,144 @@ int64_t sytrf_aa(
     float* A, int64_t lda,
     int64_t* ipiv )
 {
+    LAPACK_INSTRUMENT( "ssytrf_aa", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    sytrf_aa_work_size( uplo, n, A, lda, ipiv,
+                        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sytrf_aa_work( uplo, n, A, lda, ipiv,
+                          work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv )
+{
+    LAPACK_INSTRUMENT( "dsytrf_aa", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    sytrf_aa_work_size( uplo, n, A, lda, ipiv,
+                        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sytrf_aa_work( uplo, n, A, lda, ipiv,
+                          work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    LAPACK_INSTRUMENT( "csytrf_aa", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    sytrf_aa_work_size( uplo, n, A, lda, ipiv,
+                        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return sytrf_aa_work( uplo, n, A, lda, ipiv,
+                          work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// Computes the factorization of a symmetric matrix A
+/// using the Aasen's algorithm. The form of the factorization is
+/// \[
+///     A = U T U^T
+/// \]
+/// or
+/// \[
+///     A = L T L^T
+/// \]
+/// where U (or L) is a product of permutation and unit upper (lower)
+/// triangular matrices, and T is a symmetric tridiagonal matrix.
+///
+/// This is the blocked version of the algorithm, calling Level 3 BLAS.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, `lapack::hetrf_aa` is an alias for this.
+/// For complex Hermitian matrices, see `lapack::hetrf_aa`.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     - On entry, the symmetric matrix A. If uplo = Upper, the leading
+///     n-by-n upper triangular part of A contains the upper
+///     triangular part of the matrix A, and the strictly lower
+///     triangular part of A is not referenced. If uplo = Lower, the
+///     leading n-by-n lower triangular part of A contains the lower
+///     triangular part of the matrix A, and the strictly upper
+///     triangular part of A is not referenced.
+///     - On exit, the tridiagonal matrix is stored in the diagonals
+///     and the subdiagonals of A just below (or above) the diagonals,
+///     and L is stored below (or above) the subdiaonals, when uplo
+///     is 'L' (or 'U').
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[out] ipiv
+///     The vector ipiv of length n.
+///     On exit, it contains the details of the interchanges, i.e.,
+///     the row and column k of A were interchanged with the
+///     row and column ipiv(k).
+///
+/// @return = 0: successful exit
+///
+/// @ingroup sysv_aa_computational
+int64_t sytrf_aa(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv )
+{
+    LAPACK_INSTRUMENT( "zsytrf_aa", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    sytrf_aa_work_size( uplo, n, A, lda, ipiv,
+                        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return sytrf_aa_work( uplo, n, A, lda, ipiv,
+                          work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+void sytrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "ssytrf_aa_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -56,16 +195,44 @@ int64_t sytrf_aa(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+void sytrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dsytrf_aa_work_size", 0, n, 0 );
 
-    LAPACK_ssytrf_aa(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsytrf_aa(
         &uplo_, &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -73,19 +240,74 @@ int64_t sytrf_aa(
     if (info_ < 0) {
         throw Error();
     }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+void sytrf_aa_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "csytrf_aa_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
-        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
     #endif
-    return info_;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_csytrf_aa(
+        &uplo_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        ipiv_ptr,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
+/// Queries the workspace size needed by `lapack::sytrf_aa_work`.
+/// Arguments through ipiv are the same as for `lapack::sytrf_aa`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
 /// @ingroup sysv_aa_computational
-int64_t sytrf_aa(
+void sytrf_aa_work_size(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    int64_t* ipiv )
+    std::complex<double>* A, int64_t lda,
+    int64_t* ipiv,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "zsytrf_aa_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -104,13 +326,13 @@ int64_t sytrf_aa(
     lapack_int info_ = 0;
 
     // query for workspace size
-    double qry_work[1];
+    std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dsytrf_aa(
+    LAPACK_zsytrf_aa(
         &uplo_, &n_,
-        A, &lda_,
+        (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
-        qry_work, &ineg_one, &info_
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -118,16 +340,44 @@ int64_t sytrf_aa(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrf_aa_work(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    int64_t* ipiv,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "ssytrf_aa_work", 0, n, 0 );
 
-    LAPACK_dsytrf_aa(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_ssytrf_aa(
         &uplo_, &n_,
         A, &lda_,
         ipiv_ptr,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -143,15 +393,19 @@ int64_t sytrf_aa(
 
 // -----------------------------------------------------------------------------
 /// @ingroup sysv_aa_computational
-int64_t sytrf_aa(
+int64_t sytrf_aa_work(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    int64_t* ipiv )
+    double* A, int64_t lda,
+    int64_t* ipiv,
+    double* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "dsytrf_aa_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char uplo_ = uplo2char( uplo );
     lapack_int n_ = (lapack_int) n;
@@ -163,16 +417,15 @@ int64_t sytrf_aa(
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_csytrf_aa(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dsytrf_aa(
         &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
+        A, &lda_,
         ipiv_ptr,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -180,16 +433,47 @@ int64_t sytrf_aa(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    #ifndef LAPACK_ILP64
+        std::copy( ipiv_.begin(), ipiv_.end(), ipiv );
+    #endif
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_aa_computational
+int64_t sytrf_aa_work(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    int64_t* ipiv,
+    std::complex<float>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "csytrf_aa_work", 0, n, 0 );
 
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        lapack_int* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int* ipiv_ptr = ipiv;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_csytrf_aa(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -204,67 +488,38 @@ int64_t sytrf_aa(
 }
 
 // -----------------------------------------------------------------------------
-/// Computes the factorization of a symmetric matrix A
-/// using the Aasen's algorithm. The form of the factorization is
-/// \[
-///     A = U T U^T
-/// \]
-/// or
-/// \[
-///     A = L T L^T
-/// \]
-/// where U (or L) is a product of permutation and unit upper (lower)
-/// triangular matrices, and T is a symmetric tridiagonal matrix.
-///
-/// This is the blocked version of the algorithm, calling Level 3 BLAS.
+/// Variant of `lapack::sytrf_aa` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::sytrf_aa_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ipiv and the return value are the same as for
+/// `lapack::sytrf_aa`.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
-/// For real matrices, `lapack::hetrf_aa` is an alias for this.
-/// For complex Hermitian matrices, see `lapack::hetrf_aa`.
 ///
-/// @param[in] uplo
-///     - lapack::Uplo::Upper: Upper triangle of A is stored;
-///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+/// @param work
+///     The vector work of length lwork.
 ///
-/// @param[in] n
-///     The order of the matrix A. n >= 0.
-///
-/// @param[in,out] A
-///     The n-by-n matrix A, stored in an lda-by-n array.
-///     - On entry, the symmetric matrix A. If uplo = Upper, the leading
-///     n-by-n upper triangular part of A contains the upper
-///     triangular part of the matrix A, and the strictly lower
-///     triangular part of A is not referenced. If uplo = Lower, the
-///     leading n-by-n lower triangular part of A contains the lower
-///     triangular part of the matrix A, and the strictly upper
-///     triangular part of A is not referenced.
-///     - On exit, the tridiagonal matrix is stored in the diagonals
-///     and the subdiagonals of A just below (or above) the diagonals,
-///     and L is stored below (or above) the subdiaonals, when uplo
-///     is 'L' (or 'U').
-///
-/// @param[in] lda
-///     The leading dimension of the array A. lda >= max(1,n).
-///
-/// @param[out] ipiv
-///     The vector ipiv of length n.
-///     On exit, it contains the details of the interchanges, i.e.,
-///     the row and column k of A were interchanged with the
-///     row and column ipiv(k).
-///
-/// @return = 0: successful exit
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::sytrf_aa_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
 ///
 /// @ingroup sysv_aa_computational
-int64_t sytrf_aa(
+int64_t sytrf_aa_work(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
-    int64_t* ipiv )
+    int64_t* ipiv,
+    std::complex<double>* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "zsytrf_aa_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char uplo_ = uplo2char( uplo );
     lapack_int n_ = (lapack_int) n;
@@ -276,33 +531,15 @@ int64_t sytrf_aa(
     #else
         lapack_int* ipiv_ptr = ipiv;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zsytrf_aa(
-        &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        ipiv_ptr,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zsytrf_aa(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
         ipiv_ptr,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7
 
@@ -25,6 +26,183 @@ int64_t sytri_rk(
     float const* E,
     int64_t const* ipiv )
 {
+    LAPACK_INSTRUMENT( "ssytri_rk", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    sytri_rk_work_size( uplo, n, A, lda, E, ipiv,
+                        &lwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+
+    return sytri_rk_work( uplo, n, A, lda, E, ipiv,
+                          work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_rk_computational
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv )
+{
+    LAPACK_INSTRUMENT( "dsytri_rk", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    sytri_rk_work_size( uplo, n, A, lda, E, ipiv,
+                        &lwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+
+    return sytri_rk_work( uplo, n, A, lda, E, ipiv,
+                          work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_rk_computational
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv )
+{
+    LAPACK_INSTRUMENT( "csytri_rk", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    sytri_rk_work_size( uplo, n, A, lda, E, ipiv,
+                        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+
+    return sytri_rk_work( uplo, n, A, lda, E, ipiv,
+                          work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+// this is here just to get a doxygen entry
+/// @see lapack::sytri_rk
+/// @ingroup sysv_rk_computational
+#define sytri_3 sytri_rk
+
+// -----------------------------------------------------------------------------
+/// Computes the inverse of a symmetric indefinite
+/// matrix A using the factorization computed by `lapack::sytrf_rk`:
+/// \[
+///     A = P U D U^T P^T
+/// \]
+/// or
+/// \[
+///     A = P L D L^T P^T,
+/// \]
+/// where U (or L) is unit upper (or lower) triangular matrix,
+/// $U^T$ (or $L^T$) is the transpose of U (or L), P is a permutation
+/// matrix, $P^T$ is the transpose of P, and D is symmetric and block
+/// diagonal with 1-by-1 and 2-by-2 diagonal blocks.
+///
+/// This is the blocked version of the algorithm, calling Level 3 BLAS.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, `lapack::hetri_rk` is an alias for this.
+/// For complex Hermitian matrices, see `lapack::hetri_rk`.
+///
+/// Note: LAPACK++ uses the name `sytri_rk` instead of LAPACK's `sytri_3`,
+/// for consistency with `sysv_rk`, `sytrf_rk`, etc.
+///
+/// @since LAPACK 3.7.0.
+/// This interface replaces the older `lapack::sytri_rook`.
+///
+/// @param[in] uplo
+///     Specifies whether the details of the factorization are
+///     stored as an upper or lower triangular matrix.
+///     - lapack::Uplo::Upper: Upper triangle of A is stored;
+///     - lapack::Uplo::Lower: Lower triangle of A is stored.
+///
+/// @param[in] n
+///     The order of the matrix A. n >= 0.
+///
+/// @param[in,out] A
+///     The n-by-n matrix A, stored in an lda-by-n array.
+///     - On entry, diagonal of the block diagonal matrix D and
+///     factors U or L as computed by `lapack::sytrf_rk`:
+///       - ONLY diagonal elements of the symmetric block diagonal
+///         matrix D on the diagonal of A, i.e. D(k,k) = A(k,k);
+///         (superdiagonal (or subdiagonal) elements of D
+///         should be provided on entry in array E), and
+///       - If uplo = Upper: factor U in the superdiagonal part of A.
+///       - If uplo = Lower: factor L in the subdiagonal part of A.
+///
+///     - On successful exit, the symmetric inverse of the original
+///     matrix.
+///         - If uplo = Upper: the upper triangular part of the inverse
+///         is formed and the part of A below the diagonal is not
+///         referenced;
+///         - If uplo = Lower: the lower triangular part of the inverse
+///         is formed and the part of A above the diagonal is not
+///         referenced.
+///
+/// @param[in] lda
+///     The leading dimension of the array A. lda >= max(1,n).
+///
+/// @param[in] E
+///     The vector E of length n.
+///     On entry, contains the superdiagonal (or subdiagonal)
+///     elements of the symmetric block diagonal matrix D
+///     with 1-by-1 or 2-by-2 diagonal blocks, where
+///     - If uplo = Upper: E(i) = D(i-1,i),i=2:n, E(1) not referenced;
+///     - If uplo = Lower: E(i) = D(i+1,i),i=1:n-1, E(n) not referenced.
+///
+///     - Note: For 1-by-1 diagonal block D(k), where
+///     1 <= k <= n, the element E(k) is not referenced in both
+///     uplo = Upper or uplo = Lower cases.
+///
+/// @param[in] ipiv
+///     The vector ipiv of length n.
+///     Details of the interchanges and the block structure of D
+///     as determined by `lapack::sytrf_rk`.
+///
+/// @return = 0: successful exit
+/// @return > 0: if return value = i, D(i,i) = 0; the matrix is singular and its
+///     inverse could not be computed.
+///
+/// @ingroup sysv_rk_computational
+int64_t sytri_rk(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv )
+{
+    LAPACK_INSTRUMENT( "zsytri_rk", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork;
+    sytri_rk_work_size( uplo, n, A, lda, E, ipiv,
+                        &lwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+
+    return sytri_rk_work( uplo, n, A, lda, E, ipiv,
+                          work.data(), lwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_rk_computational
+void sytri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "ssytri_rk_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,7 +213,8 @@ int64_t sytri_rk(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -58,17 +237,47 @@ int64_t sytri_rk(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_rk_computational
+void sytri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dsytri_rk_work_size", 0, n, 0 );
 
-    LAPACK_ssytri_3(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dsytri_3(
         &uplo_, &n_,
         A, &lda_,
         E,
         ipiv_ptr,
-        &work[0], &lwork_, &info_
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -76,17 +285,20 @@ int64_t sytri_rk(
     if (info_ < 0) {
         throw Error();
     }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
 }
 
 // -----------------------------------------------------------------------------
 /// @ingroup sysv_rk_computational
-int64_t sytri_rk(
+void sytri_rk_work_size(
     lapack::Uplo uplo, int64_t n,
-    double* A, int64_t lda,
-    double const* E,
-    int64_t const* ipiv )
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    int64_t* lwork )
 {
+    LAPACK_INSTRUMENT( "csytri_rk_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -97,7 +309,8 @@ int64_t sytri_rk(
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
@@ -105,14 +318,14 @@ int64_t sytri_rk(
     lapack_int info_ = 0;
 
     // query for workspace size
-    double qry_work[1];
+    std::complex<float> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dsytri_3(
+    LAPACK_csytri_3(
         &uplo_, &n_,
-        A, &lda_,
-        E,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) E,
         ipiv_ptr,
-        qry_work, &ineg_one, &info_
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -120,17 +333,105 @@ int64_t sytri_rk(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// Queries the workspace size needed by `lapack::sytri_rk_work`.
+/// Arguments through ipiv are the same as for `lapack::sytri_rk`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @ingroup sysv_rk_computational
+void sytri_rk_work_size(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double> const* E,
+    int64_t const* ipiv,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "zsytri_rk_work_size", 0, n, 0 );
 
-    LAPACK_dsytri_3(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_zsytri_3(
+        &uplo_, &n_,
+        (lapack_complex_double*) A, &lda_,
+        (lapack_complex_double*) E,
+        ipiv_ptr,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_rk_computational
+int64_t sytri_rk_work(
+    lapack::Uplo uplo, int64_t n,
+    float* A, int64_t lda,
+    float const* E,
+    int64_t const* ipiv,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "ssytri_rk_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_ssytri_3(
         &uplo_, &n_,
         A, &lda_,
         E,
         ipiv_ptr,
-        &work[0], &lwork_, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -143,38 +444,42 @@ int64_t sytri_rk(
 
 // -----------------------------------------------------------------------------
 /// @ingroup sysv_rk_computational
-int64_t sytri_rk(
+int64_t sytri_rk_work(
     lapack::Uplo uplo, int64_t n,
-    std::complex<float>* A, int64_t lda,
-    std::complex<float> const* E,
-    int64_t const* ipiv )
+    double* A, int64_t lda,
+    double const* E,
+    int64_t const* ipiv,
+    double* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "dsytri_rk_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char uplo_ = uplo2char( uplo );
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_csytri_3(
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dsytri_3(
         &uplo_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) E,
+        A, &lda_,
+        E,
         ipiv_ptr,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -182,17 +487,47 @@ int64_t sytri_rk(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup sysv_rk_computational
+int64_t sytri_rk_work(
+    lapack::Uplo uplo, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float> const* E,
+    int64_t const* ipiv,
+    std::complex<float>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "csytri_rk_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char uplo_ = uplo2char( uplo );
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    #ifndef LAPACK_ILP64
+        // 32-bit copy
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
+        lapack_int const* ipiv_ptr = &ipiv_[0];
+    #else
+        lapack_int const* ipiv_ptr = ipiv;
+    #endif
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_csytri_3(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
         (lapack_complex_float*) E,
         ipiv_ptr,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -204,143 +539,61 @@ int64_t sytri_rk(
 }
 
 // -----------------------------------------------------------------------------
-// this is here just to get a doxygen entry
-/// @see lapack::sytri_rk
-/// @ingroup sysv_rk_computational
-#define sytri_3 sytri_rk
-
-// -----------------------------------------------------------------------------
-/// Computes the inverse of a symmetric indefinite
-/// matrix A using the factorization computed by `lapack::sytrf_rk`:
-/// \[
-///     A = P U D U^T P^T
-/// \]
-/// or
-/// \[
-///     A = P L D L^T P^T,
-/// \]
-/// where U (or L) is unit upper (or lower) triangular matrix,
-/// $U^T$ (or $L^T$) is the transpose of U (or L), P is a permutation
-/// matrix, $P^T$ is the transpose of P, and D is symmetric and block
-/// diagonal with 1-by-1 and 2-by-2 diagonal blocks.
-///
-/// This is the blocked version of the algorithm, calling Level 3 BLAS.
+/// Variant of `lapack::sytri_rk` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::sytri_rk_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ipiv and the return value are the same as for
+/// `lapack::sytri_rk`.
 ///
 /// Overloaded versions are available for
 /// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
-/// For real matrices, `lapack::hetri_rk` is an alias for this.
-/// For complex Hermitian matrices, see `lapack::hetri_rk`.
-///
-/// Note: LAPACK++ uses the name `sytri_rk` instead of LAPACK's `sytri_3`,
-/// for consistency with `sysv_rk`, `sytrf_rk`, etc.
-///
-/// @since LAPACK 3.7.0.
-/// This interface replaces the older `lapack::sytri_rook`.
-///
-/// @param[in] uplo
-///     Specifies whether the details of the factorization are
-///     stored as an upper or lower triangular matrix.
-///     - lapack::Uplo::Upper: Upper triangle of A is stored;
-///     - lapack::Uplo::Lower: Lower triangle of A is stored.
-///
-/// @param[in] n
-///     The order of the matrix A. n >= 0.
-///
-/// @param[in,out] A
-///     The n-by-n matrix A, stored in an lda-by-n array.
-///     - On entry, diagonal of the block diagonal matrix D and
-///     factors U or L as computed by `lapack::sytrf_rk`:
-///       - ONLY diagonal elements of the symmetric block diagonal
-///         matrix D on the diagonal of A, i.e. D(k,k) = A(k,k);
-///         (superdiagonal (or subdiagonal) elements of D
-///         should be provided on entry in array E), and
-///       - If uplo = Upper: factor U in the superdiagonal part of A.
-///       - If uplo = Lower: factor L in the subdiagonal part of A.
-///
-///     - On successful exit, the symmetric inverse of the original
-///     matrix.
-///         - If uplo = Upper: the upper triangular part of the inverse
-///         is formed and the part of A below the diagonal is not
-///         referenced;
-///         - If uplo = Lower: the lower triangular part of the inverse
-///         is formed and the part of A above the diagonal is not
-///         referenced.
-///
-/// @param[in] lda
-///     The leading dimension of the array A. lda >= max(1,n).
-///
-/// @param[in] E
-///     The vector E of length n.
-///     On entry, contains the superdiagonal (or subdiagonal)
-///     elements of the symmetric block diagonal matrix D
-///     with 1-by-1 or 2-by-2 diagonal blocks, where
-///     - If uplo = Upper: E(i) = D(i-1,i),i=2:n, E(1) not referenced;
-///     - If uplo = Lower: E(i) = D(i+1,i),i=1:n-1, E(n) not referenced.
 ///
-///     - Note: For 1-by-1 diagonal block D(k), where
-///     1 <= k <= n, the element E(k) is not referenced in both
-///     uplo = Upper or uplo = Lower cases.
+/// @param work
+///     The vector work of length lwork.
 ///
-/// @param[in] ipiv
-///     The vector ipiv of length n.
-///     Details of the interchanges and the block structure of D
-///     as determined by `lapack::sytrf_rk`.
-///
-/// @return = 0: successful exit
-/// @return > 0: if return value = i, D(i,i) = 0; the matrix is singular and its
-///     inverse could not be computed.
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::sytri_rk_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
 ///
 /// @ingroup sysv_rk_computational
-int64_t sytri_rk(
+int64_t sytri_rk_work(
     lapack::Uplo uplo, int64_t n,
     std::complex<double>* A, int64_t lda,
     std::complex<double> const* E,
-    int64_t const* ipiv )
+    int64_t const* ipiv,
+    std::complex<double>* work, int64_t lwork )
 {
+    LAPACK_INSTRUMENT( "zsytri_rk_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char uplo_ = uplo2char( uplo );
     lapack_int n_ = (lapack_int) n;
     lapack_int lda_ = (lapack_int) lda;
     #ifndef LAPACK_ILP64
         // 32-bit copy
-        std::vector< lapack_int > ipiv_( &ipiv[0], &ipiv[(n)] );
+        lapack::vector< lapack_int > ipiv_( (n) );
+        std::copy( &ipiv[0], &ipiv[(n)], ipiv_.begin() );
         lapack_int const* ipiv_ptr = &ipiv_[0];
     #else
         lapack_int const* ipiv_ptr = ipiv;
     #endif
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_zsytri_3(
-        &uplo_, &n_,
-        (lapack_complex_double*) A, &lda_,
-        (lapack_complex_double*) E,
-        ipiv_ptr,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zsytri_3(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
         (lapack_complex_double*) E,
         ipiv_ptr,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
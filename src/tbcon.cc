@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t tbcon(
     float const* AB, int64_t ldab,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "stbcon", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -39,6 +42,7 @@ int64_t tbcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stbcon(
         &norm_, &uplo_, &diag_, &n_, &kd_,
         AB, &ldab_, rcond,
@@ -60,6 +64,8 @@ int64_t tbcon(
     double const* AB, int64_t ldab,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "dtbcon", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -78,6 +84,7 @@ int64_t tbcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtbcon(
         &norm_, &uplo_, &diag_, &n_, &kd_,
         AB, &ldab_, rcond,
@@ -99,6 +106,8 @@ int64_t tbcon(
     std::complex<float> const* AB, int64_t ldab,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "ctbcon", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -117,6 +126,7 @@ int64_t tbcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctbcon(
         &norm_, &uplo_, &diag_, &n_, &kd_,
         (lapack_complex_float*) AB, &ldab_, rcond,
@@ -138,6 +148,8 @@ int64_t tbcon(
     std::complex<double> const* AB, int64_t ldab,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "ztbcon", 0, n, kd );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -156,6 +168,7 @@ int64_t tbcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztbcon(
         &norm_, &uplo_, &diag_, &n_, &kd_,
         (lapack_complex_double*) AB, &ldab_, rcond,
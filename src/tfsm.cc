@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ void tfsm(
     float const* A,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "stfsm", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ void tfsm(
     lapack_int n_ = (lapack_int) n;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stfsm(
         &transr_, &side_, &uplo_, &trans_, &diag_, &m_, &n_, &alpha,
         A,
@@ -51,6 +55,8 @@ void tfsm(
     double const* A,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dtfsm", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -66,6 +72,7 @@ void tfsm(
     lapack_int n_ = (lapack_int) n;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtfsm(
         &transr_, &side_, &uplo_, &trans_, &diag_, &m_, &n_, &alpha,
         A,
@@ -82,6 +89,8 @@ void tfsm(
     std::complex<float> const* A,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ctfsm", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -97,6 +106,7 @@ void tfsm(
     lapack_int n_ = (lapack_int) n;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctfsm(
         &transr_, &side_, &uplo_, &trans_, &diag_, &m_, &n_,
         (lapack_complex_float*) &alpha,
@@ -114,6 +124,8 @@ void tfsm(
     std::complex<double> const* A,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ztfsm", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -129,6 +141,7 @@ void tfsm(
     lapack_int n_ = (lapack_int) n;
     lapack_int ldb_ = (lapack_int) ldb;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztfsm(
         &transr_, &side_, &uplo_, &trans_, &diag_, &m_, &n_,
         (lapack_complex_double*) &alpha,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -19,6 +20,8 @@ int64_t tftri(
     lapack::Op transr, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     float* A )
 {
+    LAPACK_INSTRUMENT( "stftri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -29,6 +32,7 @@ int64_t tftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stftri(
         &transr_, &uplo_, &diag_, &n_,
         A, &info_
@@ -47,6 +51,8 @@ int64_t tftri(
     lapack::Op transr, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     double* A )
 {
+    LAPACK_INSTRUMENT( "dtftri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -57,6 +63,7 @@ int64_t tftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtftri(
         &transr_, &uplo_, &diag_, &n_,
         A, &info_
@@ -75,6 +82,8 @@ int64_t tftri(
     lapack::Op transr, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<float>* A )
 {
+    LAPACK_INSTRUMENT( "ctftri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -85,6 +94,7 @@ int64_t tftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctftri(
         &transr_, &uplo_, &diag_, &n_,
         (lapack_complex_float*) A, &info_
@@ -103,6 +113,8 @@ int64_t tftri(
     lapack::Op transr, lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<double>* A )
 {
+    LAPACK_INSTRUMENT( "ztftri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -113,6 +125,7 @@ int64_t tftri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztftri(
         &transr_, &uplo_, &diag_, &n_,
         (lapack_complex_double*) A, &info_
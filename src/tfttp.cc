@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t tfttp(
     float const* ARF,
     float* AP )
 {
+    LAPACK_INSTRUMENT( "stfttp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -29,6 +32,7 @@ int64_t tfttp(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stfttp(
         &transr_, &uplo_, &n_,
         ARF,
@@ -49,6 +53,8 @@ int64_t tfttp(
     double const* ARF,
     double* AP )
 {
+    LAPACK_INSTRUMENT( "dtfttp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -58,6 +64,7 @@ int64_t tfttp(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtfttp(
         &transr_, &uplo_, &n_,
         ARF,
@@ -78,6 +85,8 @@ int64_t tfttp(
     std::complex<float> const* ARF,
     std::complex<float>* AP )
 {
+    LAPACK_INSTRUMENT( "ctfttp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -87,6 +96,7 @@ int64_t tfttp(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctfttp(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) ARF,
@@ -107,6 +117,8 @@ int64_t tfttp(
     std::complex<double> const* ARF,
     std::complex<double>* AP )
 {
+    LAPACK_INSTRUMENT( "ztfttp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -116,6 +128,7 @@ int64_t tfttp(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztfttp(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) ARF,
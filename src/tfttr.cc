@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t tfttr(
     float const* ARF,
     float* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "stfttr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -31,6 +34,7 @@ int64_t tfttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stfttr(
         &transr_, &uplo_, &n_,
         ARF,
@@ -51,6 +55,8 @@ int64_t tfttr(
     double const* ARF,
     double* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dtfttr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -62,6 +68,7 @@ int64_t tfttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtfttr(
         &transr_, &uplo_, &n_,
         ARF,
@@ -82,6 +89,8 @@ int64_t tfttr(
     std::complex<float> const* ARF,
     std::complex<float>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "ctfttr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -93,6 +102,7 @@ int64_t tfttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctfttr(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) ARF,
@@ -113,6 +123,8 @@ int64_t tfttr(
     std::complex<double> const* ARF,
     std::complex<double>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "ztfttr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -124,6 +136,7 @@ int64_t tfttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztfttr(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) ARF,
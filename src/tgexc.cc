@@ -5,6 +5,8 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -30,6 +32,7 @@ inline void tgexc(
     lapack_int* ifst, lapack_int* ilst,
     float* work, lapack_int lwork, lapack_int* info )
 {
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stgexc(
         &wantq, &wantz, &n,
         A, &lda,
@@ -50,6 +53,7 @@ inline void tgexc(
     lapack_int* ifst, lapack_int* ilst,
     double* work, lapack_int lwork, lapack_int* info )
 {
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtgexc(
         &wantq, &wantz, &n,
         A, &lda,
@@ -70,6 +74,7 @@ inline void tgexc(
     lapack_int* ifst, lapack_int* ilst, lapack_int* info )
 {
     // No workspace for complex.
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctgexc(
         &wantq, &wantz, &n,
         (lapack_complex_float*) A, &lda,
@@ -90,6 +95,7 @@ inline void tgexc(
     lapack_int* ifst, lapack_int* ilst, lapack_int* info )
 {
     // No workspace for complex.
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztgexc(
         &wantq, &wantz, &n,
         (lapack_complex_double*) A, &lda,
@@ -105,17 +111,71 @@ namespace impl {
 
 //------------------------------------------------------------------------------
 /// Mid-level templated wrapper checks and converts arguments,
-/// then calls low-level wrapper.
+/// then queries the workspace size with the low-level wrapper.
 /// @ingroup gges_internal
 ///
 template <typename scalar_t>
-int64_t tgexc(
+void tgexc_work_size(
     bool wantq, bool wantz, int64_t n,
     scalar_t* A, int64_t lda,
     scalar_t* B, int64_t ldb,
     scalar_t* Q, int64_t ldq,
     scalar_t* Z, int64_t ldz,
-    int64_t* ifst, int64_t* ilst )
+    int64_t* ifst, int64_t* ilst,
+    int64_t* lwork )
+{
+    if constexpr (! is_complex<scalar_t>::value) {
+        // convert arguments
+        if (sizeof(int64_t) > sizeof(lapack_int)) {
+            lapack_error_if( std::abs(n)   > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+            lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        }
+        lapack_int wantq_ = (lapack_int) wantq;
+        lapack_int wantz_ = (lapack_int) wantz;
+        lapack_int n_ = (lapack_int) n;
+        lapack_int lda_ = (lapack_int) lda;
+        lapack_int ldb_ = (lapack_int) ldb;
+        lapack_int ldq_ = (lapack_int) ldq;
+        lapack_int ldz_ = (lapack_int) ldz;
+        lapack_int ifst_ = (lapack_int) *ifst;
+        lapack_int ilst_ = (lapack_int) *ilst;
+        lapack_int info_ = 0;
+
+        // query for workspace size
+        scalar_t qry_work[1];
+        lapack_int ineg_one = -1;
+        internal::tgexc(
+            wantq_, wantz_, n_,
+            A, lda_, B, ldb_, Q, ldq_, Z, ldz_, &ifst_, &ilst_,
+            qry_work, ineg_one, &info_ );
+        if (info_ < 0) {
+            throw Error();
+        }
+        *lwork = max( 1, int64_t( real( qry_work[ 0 ] ) ) );
+    }
+    else {
+        // No workspace for complex.
+        *lwork = 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments,
+/// then calls low-level wrapper with workspace provided by the caller.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgexc_work(
+    bool wantq, bool wantz, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    scalar_t* work, int64_t lwork )
 {
     // convert arguments
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -124,6 +184,7 @@ int64_t tgexc(
         lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     lapack_int wantq_ = (lapack_int) wantq;
     lapack_int wantz_ = (lapack_int) wantz;
@@ -137,30 +198,15 @@ int64_t tgexc(
     lapack_int info_ = 0;
 
     if constexpr (! is_complex<scalar_t>::value) {
-        // Real needs workspace.
-        // query for workspace size
-        scalar_t qry_work[1];
-        lapack_int ineg_one = -1;
-        internal::tgexc(
-            wantq_, wantz_, n_,
-            A, lda_, B, ldb_, Q, ldq_, Z, ldz_, &ifst_, &ilst_,
-            qry_work, ineg_one, &info_ );
-        if (info_ < 0) {
-            throw Error();
-        }
-        lapack_int lwork_ = real( qry_work[ 0 ] );
-
-        // allocate workspace
-        std::vector< scalar_t > work( lwork_ );
-
         // call low-level wrapper
+        lapack_int lwork_ = (lapack_int) lwork;
         internal::tgexc(
             wantq_, wantz_, n_,
             A, lda_, B, ldb_, Q, ldq_, Z, ldz_, &ifst_, &ilst_,
-            &work[0], lwork_, &info_ );
+            work, lwork_, &info_ );
     }
     else {
-        // call low-level wrapper
+        // call low-level wrapper; work is not referenced
         internal::tgexc(
             wantq_, wantz_, n_,
             A, lda_, B, ldb_, Q, ldq_, Z, ldz_, &ifst_, &ilst_, &info_ );
@@ -173,6 +219,32 @@ int64_t tgexc(
     return info_;
 }
 
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper queries and allocates workspace,
+/// then calls tgexc_work.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgexc(
+    bool wantq, bool wantz, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst )
+{
+    // query for workspace size
+    int64_t lwork;
+    tgexc_work_size( wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz,
+                     ifst, ilst, &lwork );
+
+    // allocate workspace
+    lapack::vector< scalar_t > work( lwork );
+
+    return tgexc_work( wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz,
+                       ifst, ilst, work.data(), lwork );
+}
+
 }  // namespace impl
 
 //==============================================================================
@@ -277,6 +349,8 @@ int64_t tgexc(
     float* Z, int64_t ldz,
     int64_t* ifst, int64_t* ilst )
 {
+    LAPACK_INSTRUMENT( "stgexc", 0, n, 0 );
+
     return impl::tgexc(
         wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst );
 }
@@ -293,6 +367,8 @@ int64_t tgexc(
     int64_t* ifst,
     int64_t* ilst )
 {
+    LAPACK_INSTRUMENT( "dtgexc", 0, n, 0 );
+
     return impl::tgexc(
         wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst );
 }
@@ -308,6 +384,8 @@ int64_t tgexc(
     std::complex<float>* Z, int64_t ldz,
     int64_t* ifst, int64_t* ilst )
 {
+    LAPACK_INSTRUMENT( "ctgexc", 0, n, 0 );
+
     return impl::tgexc(
         wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst );
 }
@@ -323,8 +401,190 @@ int64_t tgexc(
     std::complex<double>* Z, int64_t ldz,
     int64_t* ifst, int64_t* ilst )
 {
+    LAPACK_INSTRUMENT( "ztgexc", 0, n, 0 );
+
     return impl::tgexc(
         wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst );
 }
 
+//==============================================================================
+/// Queries the workspace size needed by `lapack::tgexc_work`.
+/// Arguments through ilst are the same as for `lapack::tgexc`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///     Zero for complex matrices, which do not use work.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gges
+void tgexc_work_size(
+    bool wantq, bool wantz, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "stgexc_work_size", 0, n, 0 );
+
+    impl::tgexc_work_size(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst, lwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gges
+void tgexc_work_size(
+    bool wantq, bool wantz, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "dtgexc_work_size", 0, n, 0 );
+
+    impl::tgexc_work_size(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst, lwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gges
+void tgexc_work_size(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "ctgexc_work_size", 0, n, 0 );
+
+    impl::tgexc_work_size(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst, lwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gges
+void tgexc_work_size(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    int64_t* lwork )
+{
+    LAPACK_INSTRUMENT( "ztgexc_work_size", 0, n, 0 );
+
+    impl::tgexc_work_size(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst, lwork );
+}
+
+//==============================================================================
+/// Variant of `lapack::tgexc` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the size once from `lapack::tgexc_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through ilst and the return value are the same as for
+/// `lapack::tgexc`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param work
+///     The vector work of length lwork.
+///     Not referenced for complex matrices.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::tgexc_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gges
+int64_t tgexc_work(
+    bool wantq, bool wantz, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    float* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "stgexc_work", 0, n, 0 );
+
+    return impl::tgexc_work(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        work, lwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gges
+int64_t tgexc_work(
+    bool wantq, bool wantz, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    double* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "dtgexc_work", 0, n, 0 );
+
+    return impl::tgexc_work(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        work, lwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gges
+int64_t tgexc_work(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    std::complex<float>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "ctgexc_work", 0, n, 0 );
+
+    return impl::tgexc_work(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        work, lwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gges
+int64_t tgexc_work(
+    bool wantq, bool wantz, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* ifst, int64_t* ilst,
+    std::complex<double>* work, int64_t lwork )
+{
+    LAPACK_INSTRUMENT( "ztgexc_work", 0, n, 0 );
+
+    return impl::tgexc_work(
+        wantq, wantz, n, A, lda, B, ldb, Q, ldq, Z, ldz, ifst, ilst,
+        work, lwork );
+}
+
 }  // namespace lapack
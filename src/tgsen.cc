@@ -5,11 +5,14 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
 namespace lapack {
 
+using blas::max;
 using blas::real;
 using blas::is_complex;
 using blas::real_type;
@@ -35,6 +38,7 @@ inline void tgsen(
     lapack_int* iwork, lapack_int liwork,
     lapack_int* info )
 {
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stgsen(
         &ijob, &wantq, &wantz, select, &n,
         A, &lda, B, &ldb, alphar, alphai, beta,
@@ -59,6 +63,7 @@ inline void tgsen(
     lapack_int* iwork, lapack_int liwork,
     lapack_int* info )
 {
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtgsen(
         &ijob, &wantq, &wantz, select, &n,
         A, &lda, B, &ldb, alphar, alphai, beta,
@@ -83,6 +88,7 @@ inline void tgsen(
     lapack_int* iwork, lapack_int liwork,
     lapack_int* info )
 {
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctgsen(
         &ijob, &wantq, &wantz,
         select, &n,
@@ -115,6 +121,7 @@ inline void tgsen(
     lapack_int* iwork, lapack_int liwork,
     lapack_int* info )
 {
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztgsen(
         &ijob, &wantq, &wantz, select, &n,
         (lapack_complex_double*) A, &lda,
@@ -134,11 +141,11 @@ namespace impl {
 
 //------------------------------------------------------------------------------
 /// Mid-level templated wrapper checks and converts arguments,
-/// then calls low-level wrapper.
+/// then queries the workspace size with the low-level wrapper.
 /// @ingroup gges_internal
 ///
 template <typename scalar_t>
-int64_t tgsen(
+void tgsen_work_size(
     int64_t ijob, bool wantq, bool wantz,
     lapack_logical const* select, int64_t n,
     scalar_t* A, int64_t lda,
@@ -149,7 +156,8 @@ int64_t tgsen(
     scalar_t* Z, int64_t ldz,
     int64_t* sdim,
     real_type<scalar_t>* pl, real_type<scalar_t>* pr,
-    real_type<scalar_t>* dif )
+    real_type<scalar_t>* dif,
+    int64_t* lwork, int64_t* liwork )
 {
     // convert arguments
     if (sizeof(int64_t) > sizeof(lapack_int)) {
@@ -173,7 +181,7 @@ int64_t tgsen(
 
     // For real, create vectors for split-complex representation.
     // For complex, creates as dummy `int` type to be optimized away.
-    std::conditional_t< is_complex<scalar_t>::value, int, std::vector<scalar_t> >
+    std::conditional_t< is_complex<scalar_t>::value, int, lapack::vector<scalar_t> >
         alphar, alphai;
     blas_unused( alphar );  // unused in complex
     blas_unused( alphai );
@@ -203,32 +211,82 @@ int64_t tgsen(
         throw Error();
     }
     // LAPACK <= 3.11 has query & documentation error in workspace size; add 1.
-    lapack_int lwork_  = real( qry_work[ 0 ] ) + 1;
-    lapack_int liwork_ = real( qry_iwork[ 0 ] );
+    *lwork  = int64_t( real( qry_work[ 0 ] ) ) + 1;
+    *liwork = max( 1, int64_t( qry_iwork[ 0 ] ) );
+    if constexpr (! is_complex<scalar_t>::value) {
+        // For real, the split-complex alpha is kept at the end of work.
+        *lwork += 2*n;
+    }
+}
 
-    // allocate workspace
-    std::vector< scalar_t > work( lwork_ );
-    std::vector< lapack_int > iwork( liwork_ );
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper checks and converts arguments,
+/// then calls low-level wrapper with workspace provided by the caller.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgsen_work(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    complex_type<scalar_t>* alpha,
+    scalar_t* beta,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* sdim,
+    real_type<scalar_t>* pl, real_type<scalar_t>* pr,
+    real_type<scalar_t>* dif,
+    scalar_t* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    // convert arguments
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(ijob) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldz) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_int ijob_ = (lapack_int) ijob;
+    lapack_int wantq_ = (lapack_int) wantq;
+    lapack_int wantz_ = (lapack_int) wantz;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int ldz_ = (lapack_int) ldz;
+    lapack_int sdim_ = (lapack_int) *sdim;
+    lapack_int info_ = 0;
+    lapack_int liwork_ = (lapack_int) liwork;
 
     // call low-level wrapper
     if constexpr (! is_complex<scalar_t>::value) {
-        // For real, use split-complex alpha.
+        // For real, use split-complex alpha from the end of work.
+        lapack_error_if( lwork < 2*n + 1 );
+        lapack_int lwork_ = (lapack_int) (lwork - 2*n);
+        scalar_t* alphar = &work[ lwork - 2*n ];
+        scalar_t* alphai = &work[ lwork - n ];
         internal::tgsen(
             ijob_, wantq_, wantz_, select, n_,
-            A, lda_, B, ldb_, &alphar[0], &alphai[0], beta,
+            A, lda_, B, ldb_, alphar, alphai, beta,
             Q, ldq_, Z, ldz_, &sdim_, pl, pr, dif,
-            &work[0], lwork_, &iwork[0], liwork_, &info_ );
+            work, lwork_, iwork, liwork_, &info_ );
         // Merge split-complex representation.
         for (int64_t i = 0; i < n; ++i) {
             alpha[ i ] = std::complex<scalar_t>( alphar[ i ], alphai[ i ] );
         }
     }
     else {
+        lapack_int lwork_ = (lapack_int) lwork;
         internal::tgsen(
             ijob_, wantq_, wantz_, select, n_,
             A, lda_, B, ldb_, alpha, beta,
             Q, ldq_, Z, ldz_, &sdim_, pl, pr, dif,
-            &work[0], lwork_, &iwork[0], liwork_, &info_ );
+            work, lwork_, iwork, liwork_, &info_ );
     }
     if (info_ < 0) {
         throw Error();
@@ -237,6 +295,41 @@ int64_t tgsen(
     return info_;
 }
 
+//------------------------------------------------------------------------------
+/// Mid-level templated wrapper queries and allocates workspace,
+/// then calls tgsen_work.
+/// @ingroup gges_internal
+///
+template <typename scalar_t>
+int64_t tgsen(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    scalar_t* A, int64_t lda,
+    scalar_t* B, int64_t ldb,
+    complex_type<scalar_t>* alpha,
+    scalar_t* beta,
+    scalar_t* Q, int64_t ldq,
+    scalar_t* Z, int64_t ldz,
+    int64_t* sdim,
+    real_type<scalar_t>* pl, real_type<scalar_t>* pr,
+    real_type<scalar_t>* dif )
+{
+    // query for workspace size
+    int64_t lwork, liwork;
+    tgsen_work_size(
+        ijob, wantq, wantz, select, n, A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< scalar_t > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return tgsen_work(
+        ijob, wantq, wantz, select, n, A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif,
+        work.data(), lwork, iwork.data(), liwork );
+}
+
 }  // namespace impl
 
 //==============================================================================
@@ -508,6 +601,8 @@ int64_t tgsen(
     float* pl, float* pr,
     float* dif )
 {
+    LAPACK_INSTRUMENT( "stgsen", 0, n, 0 );
+
     return impl::tgsen(
         ijob, wantq, wantz, select, n,
         A, lda, B, ldb, alpha, beta,
@@ -530,6 +625,8 @@ int64_t tgsen(
     double* pl, double* pr,
     double* dif )
 {
+    LAPACK_INSTRUMENT( "dtgsen", 0, n, 0 );
+
     return impl::tgsen(
         ijob, wantq, wantz, select, n,
         A, lda, B, ldb, alpha, beta,
@@ -552,6 +649,8 @@ int64_t tgsen(
     float* pl, float* pr,
     float* dif )
 {
+    LAPACK_INSTRUMENT( "ctgsen", 0, n, 0 );
+
     return impl::tgsen(
         ijob, wantq, wantz, select, n,
         A, lda, B, ldb, alpha, beta,
@@ -574,10 +673,261 @@ int64_t tgsen(
     double* pl, double* pr,
     double* dif )
 {
+    LAPACK_INSTRUMENT( "ztgsen", 0, n, 0 );
+
     return impl::tgsen(
         ijob, wantq, wantz, select, n,
         A, lda, B, ldb, alpha, beta,
         Q, ldq, Z, ldz, sdim, pl, pr, dif );
 }
 
+//==============================================================================
+/// Queries the workspace sizes needed by `lapack::tgsen_work`.
+/// Arguments through dif are the same as for `lapack::tgsen`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///     For real matrices, this includes 2*n entries that `lapack::tgsen_work`
+///     uses for the split-complex representation of alpha.
+///
+/// @param[out] liwork
+///     Optimal length of the array iwork.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gges
+void tgsen_work_size(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr,
+    float* dif,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "stgsen_work_size", 0, n, 0 );
+
+    impl::tgsen_work_size(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, lwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gges
+void tgsen_work_size(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr,
+    double* dif,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "dtgsen_work_size", 0, n, 0 );
+
+    impl::tgsen_work_size(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, lwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gges
+void tgsen_work_size(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr,
+    float* dif,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "ctgsen_work_size", 0, n, 0 );
+
+    impl::tgsen_work_size(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, lwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gges
+void tgsen_work_size(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr,
+    double* dif,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "ztgsen_work_size", 0, n, 0 );
+
+    impl::tgsen_work_size(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif, lwork, liwork );
+}
+
+//==============================================================================
+/// Variant of `lapack::tgsen` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::tgsen_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through dif and the return value are the same as for
+/// `lapack::tgsen`.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::tgsen_work_size`.
+///     For real matrices, the last 2*n entries hold the split-complex
+///     alpha, so lwork >= 2*n + 1.
+///
+/// @param iwork
+///     The vector iwork of length liwork.
+///
+/// @param[in] liwork
+///     The length of iwork, as returned by `lapack::tgsen_work_size`.
+///
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, float version.
+/// @ingroup gges
+int64_t tgsen_work(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    float* A, int64_t lda,
+    float* B, int64_t ldb,
+    std::complex<float>* alpha,
+    float* beta,
+    float* Q, int64_t ldq,
+    float* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr,
+    float* dif,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "stgsen_work", 0, n, 0 );
+
+    return impl::tgsen_work(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif,
+        work, lwork, iwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, double version.
+/// @ingroup gges
+int64_t tgsen_work(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    double* A, int64_t lda,
+    double* B, int64_t ldb,
+    std::complex<double>* alpha,
+    double* beta,
+    double* Q, int64_t ldq,
+    double* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr,
+    double* dif,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "dtgsen_work", 0, n, 0 );
+
+    return impl::tgsen_work(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif,
+        work, lwork, iwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<float> version.
+/// @ingroup gges
+int64_t tgsen_work(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<float>* A, int64_t lda,
+    std::complex<float>* B, int64_t ldb,
+    std::complex<float>* alpha,
+    std::complex<float>* beta,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* Z, int64_t ldz,
+    int64_t* sdim,
+    float* pl, float* pr,
+    float* dif,
+    std::complex<float>* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "ctgsen_work", 0, n, 0 );
+
+    return impl::tgsen_work(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif,
+        work, lwork, iwork, liwork );
+}
+
+//------------------------------------------------------------------------------
+/// High-level overloaded wrapper, complex<double> version.
+/// @ingroup gges
+int64_t tgsen_work(
+    int64_t ijob, bool wantq, bool wantz,
+    lapack_logical const* select, int64_t n,
+    std::complex<double>* A, int64_t lda,
+    std::complex<double>* B, int64_t ldb,
+    std::complex<double>* alpha,
+    std::complex<double>* beta,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* Z, int64_t ldz,
+    int64_t* sdim,
+    double* pl, double* pr,
+    double* dif,
+    std::complex<double>* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "ztgsen_work", 0, n, 0 );
+
+    return impl::tgsen_work(
+        ijob, wantq, wantz, select, n,
+        A, lda, B, ldb, alpha, beta,
+        Q, ldq, Z, ldz, sdim, pl, pr, dif,
+        work, lwork, iwork, liwork );
+}
+
 }  // namespace lapack
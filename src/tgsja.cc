@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -27,6 +28,8 @@ int64_t tgsja(
     float* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    LAPACK_INSTRUMENT( "stgsja", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -59,6 +62,7 @@ int64_t tgsja(
     // allocate workspace
     lapack::vector< float > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stgsja(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_, &k_, &l_,
         A, &lda_,
@@ -92,6 +96,8 @@ int64_t tgsja(
     double* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    LAPACK_INSTRUMENT( "dtgsja", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -124,6 +130,7 @@ int64_t tgsja(
     // allocate workspace
     lapack::vector< double > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtgsja(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_, &k_, &l_,
         A, &lda_,
@@ -157,6 +164,8 @@ int64_t tgsja(
     std::complex<float>* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    LAPACK_INSTRUMENT( "ctgsja", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -189,6 +198,7 @@ int64_t tgsja(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctgsja(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_, &k_, &l_,
         (lapack_complex_float*) A, &lda_,
@@ -222,6 +232,8 @@ int64_t tgsja(
     std::complex<double>* Q, int64_t ldq,
     int64_t* ncycle )
 {
+    LAPACK_INSTRUMENT( "ztgsja", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -254,6 +266,7 @@ int64_t tgsja(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (2*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztgsja(
         &jobu_, &jobv_, &jobq_, &m_, &p_, &n_, &k_, &l_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -27,6 +28,125 @@ int64_t tgsyl(
     float* dif,
     float* scale )
 {
+    LAPACK_INSTRUMENT( "stgsyl", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    tgsyl_work_size( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde,
+                     F, ldf, dif, scale,
+                     &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E,
+                       lde, F, ldf, dif, scale,
+                       work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale )
+{
+    LAPACK_INSTRUMENT( "dtgsyl", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    tgsyl_work_size( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde,
+                     F, ldf, dif, scale,
+                     &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E,
+                       lde, F, ldf, dif, scale,
+                       work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale )
+{
+    LAPACK_INSTRUMENT( "ctgsyl", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    tgsyl_work_size( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde,
+                     F, ldf, dif, scale,
+                     &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E,
+                       lde, F, ldf, dif, scale,
+                       work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale )
+{
+    LAPACK_INSTRUMENT( "ztgsyl", m, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    tgsyl_work_size( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E, lde,
+                     F, ldf, dif, scale,
+                     &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return tgsyl_work( trans, ijob, m, n, A, lda, B, ldb, C, ldc, D, ldd, E,
+                       lde, F, ldf, dif, scale,
+                       work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+void tgsyl_work_size(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "stgsyl_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(ijob) > std::numeric_limits<lapack_int>::max() );
@@ -72,34 +192,12 @@ int64_t tgsyl(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+6) );
-
-    LAPACK_stgsyl(
-        &trans_, &ijob_, &m_, &n_,
-        A, &lda_,
-        B, &ldb_,
-        C, &ldc_,
-        D, &ldd_,
-        E, &lde_,
-        F, &ldf_, dif, scale,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = max( 1, m+n+6 );
 }
 
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+void tgsyl_work_size(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     double const* A, int64_t lda,
     double const* B, int64_t ldb,
@@ -108,8 +206,11 @@ int64_t tgsyl(
     double const* E, int64_t lde,
     double* F, int64_t ldf,
     double* dif,
-    double* scale )
+    double* scale,
+    int64_t* lwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "dtgsyl_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(ijob) > std::numeric_limits<lapack_int>::max() );
@@ -155,34 +256,12 @@ int64_t tgsyl(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+6) );
-
-    LAPACK_dtgsyl(
-        &trans_, &ijob_, &m_, &n_,
-        A, &lda_,
-        B, &ldb_,
-        C, &ldc_,
-        D, &ldd_,
-        E, &lde_,
-        F, &ldf_, dif, scale,
-        &work[0], &lwork_,
-        &iwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = max( 1, m+n+6 );
 }
 
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+void tgsyl_work_size(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     std::complex<float> const* A, int64_t lda,
     std::complex<float> const* B, int64_t ldb,
@@ -191,8 +270,11 @@ int64_t tgsyl(
     std::complex<float> const* E, int64_t lde,
     std::complex<float>* F, int64_t ldf,
     float* dif,
-    float* scale )
+    float* scale,
+    int64_t* lwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "ctgsyl_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(ijob) > std::numeric_limits<lapack_int>::max() );
@@ -238,34 +320,12 @@ int64_t tgsyl(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+2) );
-
-    LAPACK_ctgsyl(
-        &trans_, &ijob_, &m_, &n_,
-        (lapack_complex_float*) A, &lda_,
-        (lapack_complex_float*) B, &ldb_,
-        (lapack_complex_float*) C, &ldc_,
-        (lapack_complex_float*) D, &ldd_,
-        (lapack_complex_float*) E, &lde_,
-        (lapack_complex_float*) F, &ldf_, dif, scale,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &iwork[0], &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    return info_;
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = max( 1, m+n+2 );
 }
 
 // -----------------------------------------------------------------------------
-int64_t tgsyl(
+void tgsyl_work_size(
     lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
     std::complex<double> const* A, int64_t lda,
     std::complex<double> const* B, int64_t ldb,
@@ -274,8 +334,11 @@ int64_t tgsyl(
     std::complex<double> const* E, int64_t lde,
     std::complex<double>* F, int64_t ldf,
     double* dif,
-    double* scale )
+    double* scale,
+    int64_t* lwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "ztgsyl_work_size", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(ijob) > std::numeric_limits<lapack_int>::max() );
@@ -321,12 +384,246 @@ int64_t tgsyl(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = max( 1, m+n+2 );
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< lapack_int > iwork( (m+n+2) );
+// -----------------------------------------------------------------------------
+int64_t tgsyl_work(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    float const* A, int64_t lda,
+    float const* B, int64_t ldb,
+    float* C, int64_t ldc,
+    float const* D, int64_t ldd,
+    float const* E, int64_t lde,
+    float* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "stgsyl_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(ijob) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lde) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldf) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < m+n+6 );
+    char trans_ = op2char( trans );
+    lapack_int ijob_ = (lapack_int) ijob;
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int ldd_ = (lapack_int) ldd;
+    lapack_int lde_ = (lapack_int) lde;
+    lapack_int ldf_ = (lapack_int) ldf;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_stgsyl(
+        &trans_, &ijob_, &m_, &n_,
+        A, &lda_,
+        B, &ldb_,
+        C, &ldc_,
+        D, &ldd_,
+        E, &lde_,
+        F, &ldf_, dif, scale,
+        work, &lwork_,
+        iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl_work(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    double const* A, int64_t lda,
+    double const* B, int64_t ldb,
+    double* C, int64_t ldc,
+    double const* D, int64_t ldd,
+    double const* E, int64_t lde,
+    double* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "dtgsyl_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(ijob) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lde) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldf) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < m+n+6 );
+    char trans_ = op2char( trans );
+    lapack_int ijob_ = (lapack_int) ijob;
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int ldd_ = (lapack_int) ldd;
+    lapack_int lde_ = (lapack_int) lde;
+    lapack_int ldf_ = (lapack_int) ldf;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dtgsyl(
+        &trans_, &ijob_, &m_, &n_,
+        A, &lda_,
+        B, &ldb_,
+        C, &ldc_,
+        D, &ldd_,
+        E, &lde_,
+        F, &ldf_, dif, scale,
+        work, &lwork_,
+        iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl_work(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<float> const* A, int64_t lda,
+    std::complex<float> const* B, int64_t ldb,
+    std::complex<float>* C, int64_t ldc,
+    std::complex<float> const* D, int64_t ldd,
+    std::complex<float> const* E, int64_t lde,
+    std::complex<float>* F, int64_t ldf,
+    float* dif,
+    float* scale,
+    std::complex<float>* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "ctgsyl_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(ijob) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lde) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldf) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < m+n+2 );
+    char trans_ = op2char( trans );
+    lapack_int ijob_ = (lapack_int) ijob;
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int ldd_ = (lapack_int) ldd;
+    lapack_int lde_ = (lapack_int) lde;
+    lapack_int ldf_ = (lapack_int) ldf;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_ctgsyl(
+        &trans_, &ijob_, &m_, &n_,
+        (lapack_complex_float*) A, &lda_,
+        (lapack_complex_float*) B, &ldb_,
+        (lapack_complex_float*) C, &ldc_,
+        (lapack_complex_float*) D, &ldd_,
+        (lapack_complex_float*) E, &lde_,
+        (lapack_complex_float*) F, &ldf_, dif, scale,
+        (lapack_complex_float*) work, &lwork_,
+        iwork, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+int64_t tgsyl_work(
+    lapack::Op trans, int64_t ijob, int64_t m, int64_t n,
+    std::complex<double> const* A, int64_t lda,
+    std::complex<double> const* B, int64_t ldb,
+    std::complex<double>* C, int64_t ldc,
+    std::complex<double> const* D, int64_t ldd,
+    std::complex<double> const* E, int64_t lde,
+    std::complex<double>* F, int64_t ldf,
+    double* dif,
+    double* scale,
+    std::complex<double>* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "ztgsyl_work", m, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(ijob) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lda) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldb) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldc) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldd) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lde) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldf) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    lapack_error_if( liwork < m+n+2 );
+    char trans_ = op2char( trans );
+    lapack_int ijob_ = (lapack_int) ijob;
+    lapack_int m_ = (lapack_int) m;
+    lapack_int n_ = (lapack_int) n;
+    lapack_int lda_ = (lapack_int) lda;
+    lapack_int ldb_ = (lapack_int) ldb;
+    lapack_int ldc_ = (lapack_int) ldc;
+    lapack_int ldd_ = (lapack_int) ldd;
+    lapack_int lde_ = (lapack_int) lde;
+    lapack_int ldf_ = (lapack_int) ldf;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztgsyl(
         &trans_, &ijob_, &m_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -335,8 +632,8 @@ int64_t tgsyl(
         (lapack_complex_double*) D, &ldd_,
         (lapack_complex_double*) E, &lde_,
         (lapack_complex_double*) F, &ldf_, dif, scale,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &iwork[0], &info_
+        (lapack_complex_double*) work, &lwork_,
+        iwork, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1
         #endif
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t tpcon(
     float const* AP,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "stpcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ int64_t tpcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stpcon(
         &norm_, &uplo_, &diag_, &n_,
         AP, rcond,
@@ -56,6 +60,8 @@ int64_t tpcon(
     double const* AP,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "dtpcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -70,6 +76,7 @@ int64_t tpcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtpcon(
         &norm_, &uplo_, &diag_, &n_,
         AP, rcond,
@@ -91,6 +98,8 @@ int64_t tpcon(
     std::complex<float> const* AP,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "ctpcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -105,6 +114,7 @@ int64_t tpcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctpcon(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_float*) AP, rcond,
@@ -126,6 +136,8 @@ int64_t tpcon(
     std::complex<double> const* AP,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "ztpcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -140,6 +152,7 @@ int64_t tpcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztpcon(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_double*) AP, rcond,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
 
@@ -25,6 +26,8 @@ int64_t tplqt(
     float* B, int64_t ldb,
     float* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "stplqt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -47,6 +50,7 @@ int64_t tplqt(
     // allocate workspace
     lapack::vector< float > work( (mb*m) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stplqt(
         &m_, &n_, &l_, &mb_,
         A, &lda_,
@@ -67,6 +71,8 @@ int64_t tplqt(
     double* B, int64_t ldb,
     double* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "dtplqt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -89,6 +95,7 @@ int64_t tplqt(
     // allocate workspace
     lapack::vector< double > work( (mb*m) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtplqt(
         &m_, &n_, &l_, &mb_,
         A, &lda_,
@@ -109,6 +116,8 @@ int64_t tplqt(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "ctplqt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -131,6 +140,7 @@ int64_t tplqt(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (mb*m) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctplqt(
         &m_, &n_, &l_, &mb_,
         (lapack_complex_float*) A, &lda_,
@@ -247,6 +257,8 @@ int64_t tplqt(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "ztplqt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -269,6 +281,7 @@ int64_t tplqt(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (mb*m) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztplqt(
         &m_, &n_, &l_, &mb_,
         (lapack_complex_double*) A, &lda_,
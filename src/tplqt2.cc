@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
 
@@ -24,6 +25,8 @@ int64_t tplqt2(
     float* B, int64_t ldb,
     float* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "stplqt2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -41,6 +44,7 @@ int64_t tplqt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stplqt2(
         &m_, &n_, &l_,
         A, &lda_,
@@ -60,6 +64,8 @@ int64_t tplqt2(
     double* B, int64_t ldb,
     double* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "dtplqt2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -77,6 +83,7 @@ int64_t tplqt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtplqt2(
         &m_, &n_, &l_,
         A, &lda_,
@@ -96,6 +103,8 @@ int64_t tplqt2(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "ctplqt2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -113,6 +122,7 @@ int64_t tplqt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctplqt2(
         &m_, &n_, &l_,
         (lapack_complex_float*) A, &lda_,
@@ -221,6 +231,8 @@ int64_t tplqt2(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "ztplqt2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -238,6 +250,7 @@ int64_t tplqt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztplqt2(
         &m_, &n_, &l_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30700  // >= 3.7.0
 
@@ -26,6 +27,8 @@ int64_t tpmlqt(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "stpmlqt", m, n, k );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -59,6 +62,7 @@ int64_t tpmlqt(
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
     lapack::vector< float > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stpmlqt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &mb_,
         V, &ldv_,
@@ -85,6 +89,8 @@ int64_t tpmlqt(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dtpmlqt", m, n, k );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -118,6 +124,7 @@ int64_t tpmlqt(
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
     lapack::vector< double > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtpmlqt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &mb_,
         V, &ldv_,
@@ -144,6 +151,8 @@ int64_t tpmlqt(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ctpmlqt", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -173,6 +182,7 @@ int64_t tpmlqt(
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
     lapack::vector< std::complex<float> > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctpmlqt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &mb_,
         (lapack_complex_float*) V, &ldv_,
@@ -314,6 +324,8 @@ int64_t tpmlqt(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ztpmlqt", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -343,6 +355,7 @@ int64_t tpmlqt(
     int64_t lwork = (side == Side::Left ? n*mb : m*mb);
     lapack::vector< std::complex<double> > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztpmlqt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &mb_,
         (lapack_complex_double*) V, &ldv_,
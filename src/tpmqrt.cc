@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4.0
 
@@ -26,6 +27,8 @@ int64_t tpmqrt(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "stpmqrt", m, n, k );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -59,6 +62,7 @@ int64_t tpmqrt(
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
     lapack::vector< float > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stpmqrt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &nb_,
         V, &ldv_,
@@ -85,6 +89,8 @@ int64_t tpmqrt(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dtpmqrt", m, n, k );
+
     // for real, map ConjTrans to Trans
     if (trans == Op::ConjTrans)
         trans = Op::Trans;
@@ -118,6 +124,7 @@ int64_t tpmqrt(
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
     lapack::vector< double > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtpmqrt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &nb_,
         V, &ldv_,
@@ -144,6 +151,8 @@ int64_t tpmqrt(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ctpmqrt", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -173,6 +182,7 @@ int64_t tpmqrt(
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
     lapack::vector< std::complex<float> > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctpmqrt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &nb_,
         (lapack_complex_float*) V, &ldv_,
@@ -317,6 +327,8 @@ int64_t tpmqrt(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ztpmqrt", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -346,6 +358,7 @@ int64_t tpmqrt(
     int64_t lwork = (side == Side::Left ? n*nb : m*nb);
     lapack::vector< std::complex<double> > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztpmqrt(
         &side_, &trans_, &m_, &n_, &k_, &l_, &nb_,
         (lapack_complex_double*) V, &ldv_,
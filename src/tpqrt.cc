@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4
 
@@ -25,6 +26,8 @@ int64_t tpqrt(
     float* B, int64_t ldb,
     float* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "stpqrt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -47,6 +50,7 @@ int64_t tpqrt(
     // allocate workspace
     lapack::vector< float > work( (nb*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stpqrt(
         &m_, &n_, &l_, &nb_,
         A, &lda_,
@@ -67,6 +71,8 @@ int64_t tpqrt(
     double* B, int64_t ldb,
     double* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "dtpqrt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -89,6 +95,7 @@ int64_t tpqrt(
     // allocate workspace
     lapack::vector< double > work( (nb*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtpqrt(
         &m_, &n_, &l_, &nb_,
         A, &lda_,
@@ -109,6 +116,8 @@ int64_t tpqrt(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "ctpqrt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -131,6 +140,7 @@ int64_t tpqrt(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (nb*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctpqrt(
         &m_, &n_, &l_, &nb_,
         (lapack_complex_float*) A, &lda_,
@@ -151,6 +161,8 @@ int64_t tpqrt(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "ztpqrt", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -173,6 +185,7 @@ int64_t tpqrt(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (nb*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztpqrt(
         &m_, &n_, &l_, &nb_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4
 
@@ -24,6 +25,8 @@ int64_t tpqrt2(
     float* B, int64_t ldb,
     float* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "stpqrt2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -41,6 +44,7 @@ int64_t tpqrt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stpqrt2(
         &m_, &n_, &l_,
         A, &lda_,
@@ -60,6 +64,8 @@ int64_t tpqrt2(
     double* B, int64_t ldb,
     double* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "dtpqrt2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -77,6 +83,7 @@ int64_t tpqrt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtpqrt2(
         &m_, &n_, &l_,
         A, &lda_,
@@ -96,6 +103,8 @@ int64_t tpqrt2(
     std::complex<float>* B, int64_t ldb,
     std::complex<float>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "ctpqrt2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -113,6 +122,7 @@ int64_t tpqrt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctpqrt2(
         &m_, &n_, &l_,
         (lapack_complex_float*) A, &lda_,
@@ -132,6 +142,8 @@ int64_t tpqrt2(
     std::complex<double>* B, int64_t ldb,
     std::complex<double>* T, int64_t ldt )
 {
+    LAPACK_INSTRUMENT( "ztpqrt2", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -149,6 +161,7 @@ int64_t tpqrt2(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztpqrt2(
         &m_, &n_, &l_,
         (lapack_complex_double*) A, &lda_,
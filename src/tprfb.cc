@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30400  // >= 3.4.0
 
@@ -28,6 +29,8 @@ void tprfb(
     float* A, int64_t lda,
     float* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "stprfb", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -57,6 +60,7 @@ void tprfb(
     int64_t lwork = (side == Side::Left ? k*n : m*k);
     lapack::vector< float > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stprfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_, &l_,
         V, &ldv_,
@@ -81,6 +85,8 @@ void tprfb(
     double* A, int64_t lda,
     double* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "dtprfb", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -110,6 +116,7 @@ void tprfb(
     int64_t lwork = (side == Side::Left ? k*n : m*k);
     lapack::vector< double > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtprfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_, &l_,
         V, &ldv_,
@@ -134,6 +141,8 @@ void tprfb(
     std::complex<float>* A, int64_t lda,
     std::complex<float>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ctprfb", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -163,6 +172,7 @@ void tprfb(
     int64_t lwork = (side == Side::Left ? k*n : m*k);
     lapack::vector< std::complex<float> > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctprfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_, &l_,
         (lapack_complex_float*) V, &ldv_,
@@ -353,6 +363,8 @@ void tprfb(
     std::complex<double>* A, int64_t lda,
     std::complex<double>* B, int64_t ldb )
 {
+    LAPACK_INSTRUMENT( "ztprfb", m, n, k );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -382,6 +394,7 @@ void tprfb(
     int64_t lwork = (side == Side::Left ? k*n : m*k);
     lapack::vector< std::complex<double> > work( lwork );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztprfb(
         &side_, &trans_, &direction_, &storev_, &m_, &n_, &k_, &l_,
         (lapack_complex_double*) V, &ldv_,
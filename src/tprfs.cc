@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -24,6 +25,8 @@ int64_t tprfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "stprfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -44,6 +47,7 @@ int64_t tprfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stprfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         AP,
@@ -72,6 +76,8 @@ int64_t tprfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dtprfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -92,6 +98,7 @@ int64_t tprfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtprfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         AP,
@@ -120,6 +127,8 @@ int64_t tprfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "ctprfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -140,6 +149,7 @@ int64_t tprfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctprfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_float*) AP,
@@ -168,6 +178,8 @@ int64_t tprfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "ztprfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -188,6 +200,7 @@ int64_t tprfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztprfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -19,6 +20,8 @@ int64_t tptri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     float* AP )
 {
+    LAPACK_INSTRUMENT( "stptri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -28,6 +31,7 @@ int64_t tptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stptri(
         &uplo_, &diag_, &n_,
         AP, &info_
@@ -46,6 +50,8 @@ int64_t tptri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     double* AP )
 {
+    LAPACK_INSTRUMENT( "dtptri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -55,6 +61,7 @@ int64_t tptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtptri(
         &uplo_, &diag_, &n_,
         AP, &info_
@@ -73,6 +80,8 @@ int64_t tptri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<float>* AP )
 {
+    LAPACK_INSTRUMENT( "ctptri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -82,6 +91,7 @@ int64_t tptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctptri(
         &uplo_, &diag_, &n_,
         (lapack_complex_float*) AP, &info_
@@ -100,6 +110,8 @@ int64_t tptri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<double>* AP )
 {
+    LAPACK_INSTRUMENT( "ztptri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -109,6 +121,7 @@ int64_t tptri(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztptri(
         &uplo_, &diag_, &n_,
         (lapack_complex_double*) AP, &info_
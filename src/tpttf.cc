@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t tpttf(
     float const* AP,
     float* ARF )
 {
+    LAPACK_INSTRUMENT( "stpttf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -29,6 +32,7 @@ int64_t tpttf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stpttf(
         &transr_, &uplo_, &n_,
         AP,
@@ -49,6 +53,8 @@ int64_t tpttf(
     double const* AP,
     double* ARF )
 {
+    LAPACK_INSTRUMENT( "dtpttf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -58,6 +64,7 @@ int64_t tpttf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtpttf(
         &transr_, &uplo_, &n_,
         AP,
@@ -78,6 +85,8 @@ int64_t tpttf(
     std::complex<float> const* AP,
     std::complex<float>* ARF )
 {
+    LAPACK_INSTRUMENT( "ctpttf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -87,6 +96,7 @@ int64_t tpttf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctpttf(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -107,6 +117,8 @@ int64_t tpttf(
     std::complex<double> const* AP,
     std::complex<double>* ARF )
 {
+    LAPACK_INSTRUMENT( "ztpttf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -116,6 +128,7 @@ int64_t tpttf(
     lapack_int n_ = (lapack_int) n;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztpttf(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t tpttr(
     float const* AP,
     float* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "stpttr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -30,6 +33,7 @@ int64_t tpttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_stpttr(
         &uplo_, &n_,
         AP,
@@ -50,6 +54,8 @@ int64_t tpttr(
     double const* AP,
     double* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dtpttr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -60,6 +66,7 @@ int64_t tpttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtpttr(
         &uplo_, &n_,
         AP,
@@ -80,6 +87,8 @@ int64_t tpttr(
     std::complex<float> const* AP,
     std::complex<float>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "ctpttr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -90,6 +99,7 @@ int64_t tpttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctpttr(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -110,6 +120,8 @@ int64_t tpttr(
     std::complex<double> const* AP,
     std::complex<double>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "ztpttr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -120,6 +132,7 @@ int64_t tpttr(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztpttr(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
@@ -0,0 +1,293 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/util.hh"
+#include "lapack/flops.hh"
+#include "Instrument.hh"
+
+#ifdef LAPACK_HAVE_INSTRUMENTATION
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Returns Gflop for routine (without precision prefix), or 0 if
+// lapack/flops.hh doesn't cover it.
+template <typename scalar_t>
+static double trace_gflop(
+    std::string const& routine, double m, double n, double k )
+{
+    using G = Gflop< scalar_t >;
+
+    // LU, Cholesky, symmetric indefinite
+    if (routine == "getrf") return G::getrf( m, n );
+    if (routine == "getrs") return G::getrs( n, k );
+    if (routine == "gesv" ) return G::gesv( n, k );
+    if (routine == "getri") return G::getri( n );
+    if (routine == "potrf") return G::potrf( n );
+    if (routine == "potrs") return G::potrs( n, k );
+    if (routine == "posv" ) return G::posv( n, k );
+    if (routine == "potri") return G::potri( n );
+    if (routine == "pbtrf") return G::pbtrf( n, k );
+    if (routine == "sytrf" || routine == "hetrf") return G::sytrf( n );
+    if (routine == "sytrs" || routine == "hetrs") return G::sytrs( n, k );
+    if (routine == "sysv"  || routine == "hesv" ) return G::sysv( n, k );
+    if (routine == "sytri" || routine == "hetri") return G::sytri( n );
+
+    // QR, LQ, QL, RQ and least squares
+    if (routine == "geqrf") return G::geqrf( m, n );
+    if (routine == "geqlf") return G::geqlf( m, n );
+    if (routine == "gerqf") return G::gerqf( m, n );
+    if (routine == "gelqf") return G::gelqf( m, n );
+    if (routine == "orgqr" || routine == "ungqr") return G::ungqr( m, n, k );
+    if (routine == "orgql" || routine == "ungql") return G::ungql( m, n, k );
+    if (routine == "orgrq" || routine == "ungrq") return G::ungrq( m, n, k );
+    if (routine == "orglq" || routine == "unglq") return G::unglq( m, n, k );
+    if (routine == "gels" ) return G::gels( m, n, k );
+
+    // reductions and others
+    if (routine == "gehrd") return G::gehrd( n );
+    if (routine == "sytrd" || routine == "hetrd") return G::hetrd( n );
+    if (routine == "gebrd") return G::gebrd( m, n );
+    if (routine == "trtri") return G::trtri( n );
+    if (routine == "lauum") return G::lauum( n );
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// Returns Gflop for the call, or 0 if unknown.
+static double trace_gflop( TraceEvent const& event )
+{
+    // strip precision prefix, two letters for the mixed precision
+    // dsgesv, zcgesv, dsposv, zcposv, and _work suffix
+    std::string routine = event.routine + 1;
+    if (routine == "sgesv" || routine == "cgesv"
+        || routine == "sposv" || routine == "cposv")
+    {
+        if (event.precision == 'd' || event.precision == 'z')
+            routine.erase( 0, 1 );
+    }
+    if (routine.size() > 5
+        && routine.compare( routine.size() - 5, 5, "_work" ) == 0) {
+        routine.resize( routine.size() - 5 );
+    }
+
+    double m = double( event.m );
+    double n = double( event.n );
+    double k = double( event.k );
+    switch (event.precision) {
+        case 's': return trace_gflop< float  >( routine, m, n, k );
+        case 'd': return trace_gflop< double >( routine, m, n, k );
+        case 'c': return trace_gflop< std::complex<float>  >( routine, m, n, k );
+        case 'z': return trace_gflop< std::complex<double> >( routine, m, n, k );
+    }
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+// One thread's finished calls. The mutex is uncontended except while
+// the writer starts or stops.
+struct TraceBuffer
+{
+    std::mutex mutex;
+    std::vector< TraceEvent > events;
+};
+
+//------------------------------------------------------------------------------
+// Collects finished calls in per-thread buffers and writes them as
+// Chrome trace JSON.
+class TraceWriter
+{
+public:
+    void start( std::string const& filename );
+    bool stop();
+
+    static void end_callback( TraceEvent const& event, void* data );
+
+private:
+    TraceBuffer& thread_buffer();
+
+    std::mutex mutex_;
+    std::string filename_;
+    std::vector< std::shared_ptr< TraceBuffer > > buffers_;
+    std::atomic< bool > active_ { false };
+};
+
+// Never destroyed, so it is valid in the at-exit stop_trace.
+static TraceWriter& trace_writer()
+{
+    static TraceWriter* writer = new TraceWriter;
+    return *writer;
+}
+
+//------------------------------------------------------------------------------
+// Returns this thread's buffer, registering it on first use. Buffers are
+// kept after a thread exits so its calls are still written.
+TraceBuffer& TraceWriter::thread_buffer()
+{
+    thread_local std::shared_ptr< TraceBuffer > buffer = [this] {
+        auto ptr = std::make_shared< TraceBuffer >();
+        std::lock_guard< std::mutex > guard( mutex_ );
+        buffers_.push_back( ptr );
+        return ptr;
+    }();
+    return *buffer;
+}
+
+//------------------------------------------------------------------------------
+void TraceWriter::start( std::string const& filename )
+{
+    std::lock_guard< std::mutex > guard( mutex_ );
+    filename_ = filename;
+    for (auto& buffer : buffers_) {
+        std::lock_guard< std::mutex > buffer_guard( buffer->mutex );
+        buffer->events.clear();
+    }
+    active_.store( true, std::memory_order_release );
+}
+
+//------------------------------------------------------------------------------
+void TraceWriter::end_callback( TraceEvent const& event, void* data )
+{
+    auto writer = static_cast< TraceWriter* >( data );
+    if (! writer->active_.load( std::memory_order_acquire ))
+        return;
+    auto& buffer = writer->thread_buffer();
+    std::lock_guard< std::mutex > guard( buffer.mutex );
+    buffer.events.push_back( event );
+}
+
+//------------------------------------------------------------------------------
+// Writes complete ("X") events with times in microseconds from the first
+// call. Dimensions and Gflop/s are shown as args.
+// Returns false if no trace was started.
+bool TraceWriter::stop()
+{
+    std::lock_guard< std::mutex > guard( mutex_ );
+    if (! active_.exchange( false ))
+        return false;
+
+    // Merge the threads' buffers, then drop those of exited threads.
+    std::vector< TraceEvent > events;
+    for (auto& buffer : buffers_) {
+        std::lock_guard< std::mutex > buffer_guard( buffer->mutex );
+        events.insert( events.end(), buffer->events.begin(),
+                       buffer->events.end() );
+        buffer->events.clear();
+    }
+    buffers_.erase(
+        std::remove_if( buffers_.begin(), buffers_.end(),
+                        []( std::shared_ptr< TraceBuffer > const& buffer ) {
+                            return buffer.use_count() == 1;
+                        } ),
+        buffers_.end() );
+
+    FILE* out = std::fopen( filename_.c_str(), "w" );
+    if (out == nullptr) {
+        std::fprintf( stderr, "LAPACK++: cannot open trace file %s\n",
+                      filename_.c_str() );
+        return true;
+    }
+
+    std::sort( events.begin(), events.end(),
+               []( TraceEvent const& a, TraceEvent const& b ) {
+                   return a.start < b.start;
+               } );
+    double t0 = events.empty() ? 0 : events[ 0 ].start;
+
+    std::fprintf( out, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n" );
+    for (size_t i = 0; i < events.size(); ++i) {
+        auto const& e = events[ i ];
+        double time = e.end - e.start;
+        std::fprintf( out,
+                      "{\"name\": \"%s\", \"cat\": \"lapack\", \"ph\": \"X\","
+                      " \"pid\": 0, \"tid\": %llu, \"ts\": %.3f, \"dur\": %.3f,"
+                      " \"args\": {",
+                      e.routine, (unsigned long long) e.thread_id,
+                      (e.start - t0) * 1e6, time * 1e6 );
+        const char* sep = "";
+        const char* names[] = { "m", "n", "k" };
+        int64_t dims[] = { e.m, e.n, e.k };
+        for (int j = 0; j < 3; ++j) {
+            if (dims[ j ] != 0) {
+                std::fprintf( out, "%s\"%s\": %lld", sep, names[ j ],
+                              (long long) dims[ j ] );
+                sep = ", ";
+            }
+        }
+        double gflop = trace_gflop( e );
+        if (gflop > 0 && time > 0)
+            std::fprintf( out, "%s\"gflop/s\": %.3f", sep, gflop / time );
+        std::fprintf( out, "}}%s\n", i + 1 < events.size() ? "," : "" );
+    }
+    std::fprintf( out, "]}\n" );
+    std::fclose( out );
+    return true;
+}
+
+//------------------------------------------------------------------------------
+TraceCallbacks const* trace_from_env()
+{
+    const char* env = std::getenv( "LAPACKPP_TRACE" );
+    if (env == nullptr || env[ 0 ] == '\0')
+        return nullptr;
+
+    auto& writer = trace_writer();
+    writer.start( env );
+    std::atexit( stop_trace );
+    return new TraceCallbacks{ nullptr, &TraceWriter::end_callback, &writer };
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+void start_trace( std::string const& filename )
+{
+    auto& writer = internal::trace_writer();
+    writer.start( filename );
+    set_trace_callbacks( nullptr, &internal::TraceWriter::end_callback,
+                         &writer );
+}
+
+//------------------------------------------------------------------------------
+// Also the at-exit handler for $LAPACKPP_TRACE.
+void stop_trace()
+{
+    auto& writer = internal::trace_writer();
+    if (writer.stop())
+        set_trace_callbacks( nullptr, nullptr );
+}
+
+}  // namespace lapack
+
+#else  // not LAPACK_HAVE_INSTRUMENTATION
+
+namespace lapack {
+
+//------------------------------------------------------------------------------
+void start_trace( std::string const& filename )
+{
+    throw Error( "LAPACK++ was built without instrumentation"
+                 " (use_instrumentation)" );
+}
+
+//------------------------------------------------------------------------------
+void stop_trace()
+{
+}
+
+}  // namespace lapack
+
+#endif  // LAPACK_HAVE_INSTRUMENTATION
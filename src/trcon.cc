@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -21,6 +22,8 @@ int64_t trcon(
     float const* A, int64_t lda,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "strcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -37,6 +40,7 @@ int64_t trcon(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_strcon(
         &norm_, &uplo_, &diag_, &n_,
         A, &lda_, rcond,
@@ -58,6 +62,8 @@ int64_t trcon(
     double const* A, int64_t lda,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "dtrcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -74,6 +80,7 @@ int64_t trcon(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtrcon(
         &norm_, &uplo_, &diag_, &n_,
         A, &lda_, rcond,
@@ -95,6 +102,8 @@ int64_t trcon(
     std::complex<float> const* A, int64_t lda,
     float* rcond )
 {
+    LAPACK_INSTRUMENT( "ctrcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -111,6 +120,7 @@ int64_t trcon(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctrcon(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_float*) A, &lda_, rcond,
@@ -132,6 +142,8 @@ int64_t trcon(
     std::complex<double> const* A, int64_t lda,
     double* rcond )
 {
+    LAPACK_INSTRUMENT( "ztrcon", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -148,6 +160,7 @@ int64_t trcon(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztrcon(
         &norm_, &uplo_, &diag_, &n_,
         (lapack_complex_double*) A, &lda_, rcond,
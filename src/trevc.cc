@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -25,6 +26,8 @@ int64_t trevc(
     float* VR, int64_t ldvr, int64_t mm,
     int64_t* m )
 {
+    LAPACK_INSTRUMENT( "strevc", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -37,7 +40,8 @@ int64_t trevc(
     char howmany_ = howmany2char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
     lapack_logical* select_ptr = &select_[0];
 
     lapack_int n_ = (lapack_int) n;
@@ -51,6 +55,7 @@ int64_t trevc(
     // allocate workspace
     lapack::vector< float > work( (3*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_strevc(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -81,6 +86,8 @@ int64_t trevc(
     double* VR, int64_t ldvr, int64_t mm,
     int64_t* m )
 {
+    LAPACK_INSTRUMENT( "dtrevc", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -93,7 +100,8 @@ int64_t trevc(
     char howmany_ = howmany2char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
     lapack_logical* select_ptr = &select_[0];
 
     lapack_int n_ = (lapack_int) n;
@@ -107,6 +115,7 @@ int64_t trevc(
     // allocate workspace
     lapack::vector< double > work( (3*n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtrevc(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -137,6 +146,8 @@ int64_t trevc(
     std::complex<float>* VR, int64_t ldvr, int64_t mm,
     int64_t* m )
 {
+    LAPACK_INSTRUMENT( "ctrevc", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -149,7 +160,8 @@ int64_t trevc(
     char howmany_ = howmany2char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = (lapack_int) n;
@@ -164,6 +176,7 @@ int64_t trevc(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctrevc(
         &sides_, &howmany_,
         select_ptr, &n_,
@@ -315,6 +328,8 @@ int64_t trevc(
     std::complex<double>* VR, int64_t ldvr, int64_t mm,
     int64_t* m )
 {
+    LAPACK_INSTRUMENT( "ztrevc", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -327,7 +342,8 @@ int64_t trevc(
     char howmany_ = howmany2char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = (lapack_int) n;
@@ -342,6 +358,7 @@ int64_t trevc(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztrevc(
         &sides_, &howmany_,
         select_ptr, &n_,
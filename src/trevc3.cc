@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30601  // >= 3.6.1
 #ifndef BLAS_HAVE_MKL  // MKL 2018 lacks trevc3
@@ -28,69 +29,21 @@ int64_t trevc3(
     float* VR, int64_t ldvr, int64_t mm,
     int64_t* m )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
-    }
-    char sides_ = sides2char( sides );
-    char howmany_ = howmany2char( howmany );
-
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical* select_ptr = &select_[0];
-
-    lapack_int n_ = (lapack_int) n;
-    lapack_int ldt_ = (lapack_int) ldt;
-    lapack_int ldvl_ = (lapack_int) ldvl;
-    lapack_int ldvr_ = (lapack_int) ldvr;
-    lapack_int mm_ = (lapack_int) mm;
-    lapack_int m_ = (lapack_int) *m;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "strevc3", 0, n, 0 );
 
     // query for workspace size
-    float qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_strevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        T, &ldt_,
-        VL, &ldvl_,
-        VR, &ldvr_, &mm_, &m_,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    trevc3_work_size( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm,
+                      m,
+                      &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< float > work( lwork_ );
+    lapack::vector< float > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_strevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        T, &ldt_,
-        VL, &ldvl_,
-        VR, &ldvr_, &mm_, &m_,
-        &work[0], &lwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // [sd]trevc update select
-    std::copy( select_.begin(), select_.end(), select );
-    *m = m_;
-    return info_;
+    return trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr,
+                        mm, m,
+                        work.data(), lwork, rwork.data(), lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -103,69 +56,21 @@ int64_t trevc3(
     double* VR, int64_t ldvr, int64_t mm,
     int64_t* m )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
-    }
-    char sides_ = sides2char( sides );
-    char howmany_ = howmany2char( howmany );
-
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical* select_ptr = &select_[0];
-
-    lapack_int n_ = (lapack_int) n;
-    lapack_int ldt_ = (lapack_int) ldt;
-    lapack_int ldvl_ = (lapack_int) ldvl;
-    lapack_int ldvr_ = (lapack_int) ldvr;
-    lapack_int mm_ = (lapack_int) mm;
-    lapack_int m_ = (lapack_int) *m;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "dtrevc3", 0, n, 0 );
 
     // query for workspace size
-    double qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_dtrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        T, &ldt_,
-        VL, &ldvl_,
-        VR, &ldvr_, &mm_, &m_,
-        qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
+    int64_t lwork, lrwork;
+    trevc3_work_size( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm,
+                      m,
+                      &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< double > work( lwork_ );
+    lapack::vector< double > work( lwork );
+    lapack::vector< double > rwork( lrwork );
 
-    LAPACK_dtrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        T, &ldt_,
-        VL, &ldvl_,
-        VR, &ldvr_, &mm_, &m_,
-        &work[0], &lwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    // [sd]trevc update select
-    std::copy( select_.begin(), select_.end(), select );
-    *m = m_;
-    return info_;
+    return trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr,
+                        mm, m,
+                        work.data(), lwork, rwork.data(), lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -178,72 +83,21 @@ int64_t trevc3(
     std::complex<float>* VR, int64_t ldvr, int64_t mm,
     int64_t* m )
 {
-    // check for overflow
-    if (sizeof(int64_t) > sizeof(lapack_int)) {
-        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
-        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
-    }
-    char sides_ = sides2char( sides );
-    char howmany_ = howmany2char( howmany );
-
-    // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical const* select_ptr = &select_[0];
-
-    lapack_int n_ = (lapack_int) n;
-    lapack_int ldt_ = (lapack_int) ldt;
-    lapack_int ldvl_ = (lapack_int) ldvl;
-    lapack_int ldvr_ = (lapack_int) ldvr;
-    lapack_int mm_ = (lapack_int) mm;
-    lapack_int m_ = (lapack_int) *m;
-    lapack_int info_ = 0;
+    LAPACK_INSTRUMENT( "ctrevc3", 0, n, 0 );
 
     // query for workspace size
-    std::complex<float> qry_work[1];
-    float qry_rwork[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ctrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        (lapack_complex_float*) T, &ldt_,
-        (lapack_complex_float*) VL, &ldvl_,
-        (lapack_complex_float*) VR, &ldvr_, &mm_, &m_,
-        (lapack_complex_float*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    int64_t lwork, lrwork;
+    trevc3_work_size( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm,
+                      m,
+                      &lwork, &lrwork );
 
     // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
-    lapack::vector< float > rwork( lrwork_ );
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< float > rwork( lrwork );
 
-    LAPACK_ctrevc3(
-        &sides_, &howmany_,
-        select_ptr, &n_,
-        (lapack_complex_float*) T, &ldt_,
-        (lapack_complex_float*) VL, &ldvl_,
-        (lapack_complex_float*) VR, &ldvr_, &mm_, &m_,
-        (lapack_complex_float*) &work[0], &lwork_,
-        &rwork[0], &lrwork_, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    *m = m_;
-    return info_;
+    return trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr,
+                        mm, m,
+                        work.data(), lwork, rwork.data(), lrwork );
 }
 
 // -----------------------------------------------------------------------------
@@ -380,6 +234,36 @@ int64_t trevc3(
     std::complex<double>* VR, int64_t ldvr, int64_t mm,
     int64_t* m )
 {
+    LAPACK_INSTRUMENT( "ztrevc3", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, lrwork;
+    trevc3_work_size( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr, mm,
+                      m,
+                      &lwork, &lrwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< double > rwork( lrwork );
+
+    return trevc3_work( sides, howmany, select, n, T, ldt, VL, ldvl, VR, ldvr,
+                        mm, m,
+                        work.data(), lwork, rwork.data(), lrwork );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "strevc3_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -392,8 +276,9 @@ int64_t trevc3(
     char howmany_ = howmany2char( howmany );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
-    lapack_logical const* select_ptr = &select_[0];
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical* select_ptr = &select_[0];
 
     lapack_int n_ = (lapack_int) n;
     lapack_int ldt_ = (lapack_int) ldt;
@@ -404,17 +289,15 @@ int64_t trevc3(
     lapack_int info_ = 0;
 
     // query for workspace size
-    std::complex<double> qry_work[1];
-    double qry_rwork[1];
+    float qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_ztrevc3(
+    LAPACK_strevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
-        (lapack_complex_double*) T, &ldt_,
-        (lapack_complex_double*) VL, &ldvl_,
-        (lapack_complex_double*) VR, &ldvr_, &mm_, &m_,
-        (lapack_complex_double*) qry_work, &ineg_one,
-        qry_rwork, &ineg_one, &info_
+        T, &ldt_,
+        VL, &ldvl_,
+        VR, &ldvr_, &mm_, &m_,
+        qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -422,21 +305,456 @@ int64_t trevc3(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int lrwork_ = real(qry_rwork[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-    lapack::vector< double > rwork( lrwork_ );
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "dtrevc3_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sides_ = sides2char( sides );
+    char howmany_ = howmany2char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical* select_ptr = &select_[0];
+
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int mm_ = (lapack_int) mm;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dtrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        T, &ldt_,
+        VL, &ldvl_,
+        VR, &ldvr_, &mm_, &m_,
+        qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = 0;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "ctrevc3_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sides_ = sides2char( sides );
+    char howmany_ = howmany2char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int mm_ = (lapack_int) mm;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    float qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_ctrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        (lapack_complex_float*) T, &ldt_,
+        (lapack_complex_float*) VL, &ldvl_,
+        (lapack_complex_float*) VR, &ldvr_, &mm_, &m_,
+        (lapack_complex_float*) qry_work, &ineg_one,
+        qry_rwork, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, int64_t( qry_rwork[0] ) );
+}
+
+// -----------------------------------------------------------------------------
+/// Queries the workspace sizes needed by `lapack::trevc3_work`.
+/// Arguments through m are the same as for `lapack::trevc3`;
+/// array arguments are passed to the LAPACK query but not referenced.
+///
+/// @param[out] lwork
+///     Optimal length of the array work.
+///
+/// @param[out] lrwork
+///     Optimal length of the real array rwork.
+///     Zero for real matrices, which do not use rwork.
+///
+/// @ingroup geev_computational
+void trevc3_work_size(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    int64_t* lwork, int64_t* lrwork )
+{
+    LAPACK_INSTRUMENT( "ztrevc3_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sides_ = sides2char( sides );
+    char howmany_ = howmany2char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int mm_ = (lapack_int) mm;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<double> qry_work[1];
+    double qry_rwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_ztrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        (lapack_complex_double*) T, &ldt_,
+        (lapack_complex_double*) VL, &ldvl_,
+        (lapack_complex_double*) VR, &ldvr_, &mm_, &m_,
+        (lapack_complex_double*) qry_work, &ineg_one,
+        qry_rwork, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *lrwork = max( 1, int64_t( qry_rwork[0] ) );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3_work(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    float const* T, int64_t ldt,
+    float* VL, int64_t ldvl,
+    float* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    float* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "strevc3_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sides_ = sides2char( sides );
+    char howmany_ = howmany2char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical* select_ptr = &select_[0];
+
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int mm_ = (lapack_int) mm;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_strevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        T, &ldt_,
+        VL, &ldvl_,
+        VR, &ldvr_, &mm_, &m_,
+        work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    // [sd]trevc update select
+    std::copy( select_.begin(), select_.end(), select );
+    *m = m_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3_work(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool* select, int64_t n,
+    double const* T, int64_t ldt,
+    double* VL, int64_t ldvl,
+    double* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    double* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "dtrevc3_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sides_ = sides2char( sides );
+    char howmany_ = howmany2char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical* select_ptr = &select_[0];
+
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int mm_ = (lapack_int) mm;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dtrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        T, &ldt_,
+        VL, &ldvl_,
+        VR, &ldvr_, &mm_, &m_,
+        work, &lwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    // [sd]trevc update select
+    std::copy( select_.begin(), select_.end(), select );
+    *m = m_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geev_computational
+int64_t trevc3_work(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* VL, int64_t ldvl,
+    std::complex<float>* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    std::complex<float>* work, int64_t lwork,
+    float* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "ctrevc3_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sides_ = sides2char( sides );
+    char howmany_ = howmany2char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int mm_ = (lapack_int) mm;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_ctrevc3(
+        &sides_, &howmany_,
+        select_ptr, &n_,
+        (lapack_complex_float*) T, &ldt_,
+        (lapack_complex_float*) VL, &ldvl_,
+        (lapack_complex_float*) VR, &ldvr_, &mm_, &m_,
+        (lapack_complex_float*) work, &lwork_,
+        rwork, &lrwork_, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *m = m_;
+    return info_;
+}
+
+// -----------------------------------------------------------------------------
+/// Variant of `lapack::trevc3` that uses workspace provided by the caller,
+/// instead of querying and allocating it on every call.
+/// Get the sizes once from `lapack::trevc3_work_size`, then reuse the
+/// same workspace for repeated calls with the same dimensions.
+/// Arguments through m and the return value are the same as for
+/// `lapack::trevc3`.
+///
+/// @param work
+///     The vector work of length lwork.
+///
+/// @param[in] lwork
+///     The length of work, as returned by `lapack::trevc3_work_size`.
+///     Smaller values down to the LAPACK minimum are allowed,
+///     but may reduce performance.
+///
+/// @param rwork
+///     The real vector rwork of length lrwork.
+///     Not referenced for real matrices.
+///
+/// @param[in] lrwork
+///     The length of rwork, as returned by `lapack::trevc3_work_size`.
+///
+/// @ingroup geev_computational
+int64_t trevc3_work(
+    lapack::Sides sides, lapack::HowMany howmany,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* VL, int64_t ldvl,
+    std::complex<double>* VR, int64_t ldvr, int64_t mm,
+    int64_t* m,
+    std::complex<double>* work, int64_t lwork,
+    double* rwork, int64_t lrwork )
+{
+    LAPACK_INSTRUMENT( "ztrevc3_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvl) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldvr) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(mm) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lrwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sides_ = sides2char( sides );
+    char howmany_ = howmany2char( howmany );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldvl_ = (lapack_int) ldvl;
+    lapack_int ldvr_ = (lapack_int) ldvr;
+    lapack_int mm_ = (lapack_int) mm;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int lrwork_ = (lapack_int) lrwork;
+    lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztrevc3(
         &sides_, &howmany_,
         select_ptr, &n_,
         (lapack_complex_double*) T, &ldt_,
         (lapack_complex_double*) VL, &ldvl_,
         (lapack_complex_double*) VR, &ldvr_, &mm_, &m_,
-        (lapack_complex_double*) &work[0], &lwork_,
-        &rwork[0], &lrwork_, &info_
+        (lapack_complex_double*) work, &lwork_,
+        rwork, &lrwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
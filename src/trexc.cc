@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t trexc(
     int64_t* ifst,
     int64_t* ilst )
 {
+    LAPACK_INSTRUMENT( "strexc", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -40,6 +43,7 @@ int64_t trexc(
     // allocate workspace
     lapack::vector< float > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_strexc(
         &compq_, &n_,
         T, &ldt_,
@@ -65,6 +69,8 @@ int64_t trexc(
     int64_t* ifst,
     int64_t* ilst )
 {
+    LAPACK_INSTRUMENT( "dtrexc", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -82,6 +88,7 @@ int64_t trexc(
     // allocate workspace
     lapack::vector< double > work( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtrexc(
         &compq_, &n_,
         T, &ldt_,
@@ -105,6 +112,8 @@ int64_t trexc(
     std::complex<float>* T, int64_t ldt,
     std::complex<float>* Q, int64_t ldq, int64_t ifst, int64_t ilst )
 {
+    LAPACK_INSTRUMENT( "ctrexc", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -121,6 +130,7 @@ int64_t trexc(
     lapack_int ilst_ = (lapack_int) ilst;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctrexc(
         &compq_, &n_,
         (lapack_complex_float*) T, &ldt_,
@@ -141,6 +151,8 @@ int64_t trexc(
     std::complex<double>* T, int64_t ldt,
     std::complex<double>* Q, int64_t ldq, int64_t ifst, int64_t ilst )
 {
+    LAPACK_INSTRUMENT( "ztrexc", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -157,6 +169,7 @@ int64_t trexc(
     lapack_int ilst_ = (lapack_int) ilst;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztrexc(
         &compq_, &n_,
         (lapack_complex_double*) T, &ldt_,
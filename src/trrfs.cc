@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -24,6 +25,8 @@ int64_t trrfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "strrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -46,6 +49,7 @@ int64_t trrfs(
     lapack::vector< float > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_strrfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         A, &lda_,
@@ -74,6 +78,8 @@ int64_t trrfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "dtrrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -96,6 +102,7 @@ int64_t trrfs(
     lapack::vector< double > work( (3*n) );
     lapack::vector< lapack_int > iwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtrrfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         A, &lda_,
@@ -124,6 +131,8 @@ int64_t trrfs(
     float* ferr,
     float* berr )
 {
+    LAPACK_INSTRUMENT( "ctrrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -146,6 +155,7 @@ int64_t trrfs(
     lapack::vector< std::complex<float> > work( (2*n) );
     lapack::vector< float > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctrrfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_float*) A, &lda_,
@@ -174,6 +184,8 @@ int64_t trrfs(
     double* ferr,
     double* berr )
 {
+    LAPACK_INSTRUMENT( "ztrrfs", 0, n, nrhs );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -196,6 +208,7 @@ int64_t trrfs(
     lapack::vector< std::complex<double> > work( (2*n) );
     lapack::vector< double > rwork( (n) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztrrfs(
         &uplo_, &trans_, &diag_, &n_, &nrhs_,
         (lapack_complex_double*) A, &lda_,
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -26,6 +27,113 @@ int64_t trsen(
     float* s,
     float* sep )
 {
+    LAPACK_INSTRUMENT( "strsen", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    trsen_work_size( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                     &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< float > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                       work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    double* T, int64_t ldt,
+    double* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep )
+{
+    LAPACK_INSTRUMENT( "dtrsen", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    trsen_work_size( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                     &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< double > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                       work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep )
+{
+    LAPACK_INSTRUMENT( "ctrsen", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    trsen_work_size( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                     &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<float> > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                       work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+int64_t trsen(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep )
+{
+    LAPACK_INSTRUMENT( "ztrsen", 0, n, 0 );
+
+    // query for workspace size
+    int64_t lwork, liwork;
+    trsen_work_size( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                     &lwork, &liwork );
+
+    // allocate workspace
+    lapack::vector< std::complex<double> > work( lwork );
+    lapack::vector< lapack_int > iwork( liwork );
+
+    return trsen_work( sense, compq, select, n, T, ldt, Q, ldq, W, m, s, sep,
+                       work.data(), lwork, iwork.data(), liwork );
+}
+
+// -----------------------------------------------------------------------------
+void trsen_work_size(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    float* T, int64_t ldt,
+    float* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "strsen_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -36,7 +144,8 @@ int64_t trsen(
     char compq_ = job_comp2char( compq );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = (lapack_int) n;
@@ -70,14 +179,53 @@ int64_t trsen(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = max( 1, int64_t( qry_iwork[0] ) );
+}
 
-    // allocate workspace
-    lapack::vector< float > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+void trsen_work_size(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    double* T, int64_t ldt,
+    double* Q, int64_t ldq,
+    std::complex<double>* W,
+    int64_t* m,
+    double* s,
+    double* sep,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "dtrsen_work_size", 0, n, 0 );
 
-    LAPACK_strsen(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sense_ = sense2char( sense );
+    char compq_ = job_comp2char( compq );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< double > WR( max( 1, n ) );
+    lapack::vector< double > WI( max( 1, n ) );
+
+    // query for workspace size
+    double qry_work[1];
+    lapack_int qry_iwork[1];
+    lapack_int ineg_one = -1;
+    LAPACK_dtrsen(
         &sense_, &compq_,
         select_ptr, &n_,
         T, &ldt_,
@@ -85,8 +233,8 @@ int64_t trsen(
         &WR[0],
         &WI[0],
         &m_, s, sep,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        qry_work, &ineg_one,
+        qry_iwork, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -94,25 +242,79 @@ int64_t trsen(
     if (info_ < 0) {
         throw Error();
     }
-    *m = m_;
-    // merge split-complex representation
-    for (int64_t i = 0; i < n; ++i) {
-        W[i] = std::complex<float>( WR[i], WI[i] );
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = max( 1, int64_t( qry_iwork[0] ) );
+}
+
+// -----------------------------------------------------------------------------
+void trsen_work_size(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    int64_t* lwork, int64_t* liwork )
+{
+    LAPACK_INSTRUMENT( "ctrsen_work_size", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
     }
-    return info_;
+    char sense_ = sense2char( sense );
+    char compq_ = job_comp2char( compq );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int info_ = 0;
+
+    // query for workspace size
+    std::complex<float> qry_work[1];
+    lapack_int ineg_one = -1;
+    LAPACK_ctrsen(
+        &sense_, &compq_,
+        select_ptr, &n_,
+        (lapack_complex_float*) T, &ldt_,
+        (lapack_complex_float*) Q, &ldq_,
+        (lapack_complex_float*) W, &m_, s, sep,
+        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        #ifdef LAPACK_FORTRAN_STRLEN_END
+        , 1, 1
+        #endif
+    );
+    if (info_ < 0) {
+        throw Error();
+    }
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = 0;
 }
 
 // -----------------------------------------------------------------------------
-int64_t trsen(
+void trsen_work_size(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
-    double* T, int64_t ldt,
-    double* Q, int64_t ldq,
+    std::complex<double>* T, int64_t ldt,
+    std::complex<double>* Q, int64_t ldq,
     std::complex<double>* W,
     int64_t* m,
     double* s,
-    double* sep )
+    double* sep,
+    int64_t* lwork, int64_t* liwork )
 {
+    LAPACK_INSTRUMENT( "ztrsen_work_size", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -123,7 +325,8 @@ int64_t trsen(
     char compq_ = job_comp2char( compq );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = (lapack_int) n;
@@ -132,24 +335,16 @@ int64_t trsen(
     lapack_int m_ = (lapack_int) *m;
     lapack_int info_ = 0;
 
-    // split-complex representation
-    lapack::vector< double > WR( max( 1, n ) );
-    lapack::vector< double > WI( max( 1, n ) );
-
     // query for workspace size
-    double qry_work[1];
-    lapack_int qry_iwork[1];
+    std::complex<double> qry_work[1];
     lapack_int ineg_one = -1;
-    LAPACK_dtrsen(
+    LAPACK_ztrsen(
         &sense_, &compq_,
         select_ptr, &n_,
-        T, &ldt_,
-        Q, &ldq_,
-        &WR[0],
-        &WI[0],
-        &m_, s, sep,
-        qry_work, &ineg_one,
-        qry_iwork, &ineg_one, &info_
+        (lapack_complex_double*) T, &ldt_,
+        (lapack_complex_double*) Q, &ldq_,
+        (lapack_complex_double*) W, &m_, s, sep,
+        (lapack_complex_double*) qry_work, &ineg_one, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -157,14 +352,55 @@ int64_t trsen(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
-    lapack_int liwork_ = real(qry_iwork[0]);
+    *lwork = max( 1, int64_t( real( qry_work[0] ) ) );
+    *liwork = 0;
+}
 
-    // allocate workspace
-    lapack::vector< double > work( lwork_ );
-    lapack::vector< lapack_int > iwork( liwork_ );
+// -----------------------------------------------------------------------------
+int64_t trsen_work(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    float* T, int64_t ldt,
+    float* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    float* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "strsen_work", 0, n, 0 );
 
-    LAPACK_dtrsen(
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sense_ = sense2char( sense );
+    char compq_ = job_comp2char( compq );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical const* select_ptr = &select_[0];
+
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
+    lapack_int info_ = 0;
+
+    // split-complex representation
+    lapack::vector< float > WR( max( 1, n ) );
+    lapack::vector< float > WI( max( 1, n ) );
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_strsen(
         &sense_, &compq_,
         select_ptr, &n_,
         T, &ldt_,
@@ -172,8 +408,8 @@ int64_t trsen(
         &WR[0],
         &WI[0],
         &m_, s, sep,
-        &work[0], &lwork_,
-        &iwork[0], &liwork_, &info_
+        work, &lwork_,
+        iwork, &liwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -184,51 +420,65 @@ int64_t trsen(
     *m = m_;
     // merge split-complex representation
     for (int64_t i = 0; i < n; ++i) {
-        W[i] = std::complex<double>( WR[i], WI[i] );
+        W[i] = std::complex<float>( WR[i], WI[i] );
     }
     return info_;
 }
 
 // -----------------------------------------------------------------------------
-int64_t trsen(
+int64_t trsen_work(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
-    std::complex<float>* T, int64_t ldt,
-    std::complex<float>* Q, int64_t ldq,
-    std::complex<float>* W,
+    double* T, int64_t ldt,
+    double* Q, int64_t ldq,
+    std::complex<double>* W,
     int64_t* m,
-    float* s,
-    float* sep )
+    double* s,
+    double* sep,
+    double* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
 {
+    LAPACK_INSTRUMENT( "dtrsen_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(liwork) > std::numeric_limits<lapack_int>::max() );
     }
     char sense_ = sense2char( sense );
     char compq_ = job_comp2char( compq );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = (lapack_int) n;
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int m_ = (lapack_int) *m;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int liwork_ = (lapack_int) liwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<float> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ctrsen(
+    // split-complex representation
+    lapack::vector< double > WR( max( 1, n ) );
+    lapack::vector< double > WI( max( 1, n ) );
+
+    LAPACK_INSTRUMENT_COMPUTE();
+    LAPACK_dtrsen(
         &sense_, &compq_,
         select_ptr, &n_,
-        (lapack_complex_float*) T, &ldt_,
-        (lapack_complex_float*) Q, &ldq_,
-        (lapack_complex_float*) W, &m_, s, sep,
-        (lapack_complex_float*) qry_work, &ineg_one, &info_
+        T, &ldt_,
+        Q, &ldq_,
+        &WR[0],
+        &WI[0],
+        &m_, s, sep,
+        work, &lwork_,
+        iwork, &liwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -236,18 +486,59 @@ int64_t trsen(
     if (info_ < 0) {
         throw Error();
     }
-    lapack_int lwork_ = real(qry_work[0]);
+    *m = m_;
+    // merge split-complex representation
+    for (int64_t i = 0; i < n; ++i) {
+        W[i] = std::complex<double>( WR[i], WI[i] );
+    }
+    return info_;
+}
 
-    // allocate workspace
-    lapack::vector< std::complex<float> > work( lwork_ );
+// -----------------------------------------------------------------------------
+int64_t trsen_work(
+    lapack::Sense sense, lapack::Job compq,
+    bool const* select, int64_t n,
+    std::complex<float>* T, int64_t ldt,
+    std::complex<float>* Q, int64_t ldq,
+    std::complex<float>* W,
+    int64_t* m,
+    float* s,
+    float* sep,
+    std::complex<float>* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
+{
+    LAPACK_INSTRUMENT( "ctrsen_work", 0, n, 0 );
+
+    // check for overflow
+    if (sizeof(int64_t) > sizeof(lapack_int)) {
+        lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
+    }
+    char sense_ = sense2char( sense );
+    char compq_ = job_comp2char( compq );
+
+    // lapack_logical (32 or 64-bit) copy
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
+    lapack_logical const* select_ptr = &select_[0];
 
+    lapack_int n_ = (lapack_int) n;
+    lapack_int ldt_ = (lapack_int) ldt;
+    lapack_int ldq_ = (lapack_int) ldq;
+    lapack_int m_ = (lapack_int) *m;
+    lapack_int lwork_ = (lapack_int) lwork;
+    lapack_int info_ = 0;
+
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctrsen(
         &sense_, &compq_,
         select_ptr, &n_,
         (lapack_complex_float*) T, &ldt_,
         (lapack_complex_float*) Q, &ldq_,
         (lapack_complex_float*) W, &m_, s, sep,
-        (lapack_complex_float*) &work[0], &lwork_, &info_
+        (lapack_complex_float*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
@@ -260,7 +551,7 @@ int64_t trsen(
 }
 
 // -----------------------------------------------------------------------------
-int64_t trsen(
+int64_t trsen_work(
     lapack::Sense sense, lapack::Job compq,
     bool const* select, int64_t n,
     std::complex<double>* T, int64_t ldt,
@@ -268,56 +559,42 @@ int64_t trsen(
     std::complex<double>* W,
     int64_t* m,
     double* s,
-    double* sep )
+    double* sep,
+    std::complex<double>* work, int64_t lwork,
+    lapack_int* iwork, int64_t liwork )
 {
+    LAPACK_INSTRUMENT( "ztrsen_work", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldt) > std::numeric_limits<lapack_int>::max() );
         lapack_error_if( std::abs(ldq) > std::numeric_limits<lapack_int>::max() );
+        lapack_error_if( std::abs(lwork) > std::numeric_limits<lapack_int>::max() );
     }
     char sense_ = sense2char( sense );
     char compq_ = job_comp2char( compq );
 
     // lapack_logical (32 or 64-bit) copy
-    std::vector< lapack_logical > select_( &select[0], &select[(n)] );
+    lapack::vector< lapack_logical > select_( (n) );
+    std::copy( &select[0], &select[(n)], select_.begin() );
     lapack_logical const* select_ptr = &select_[0];
 
     lapack_int n_ = (lapack_int) n;
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int ldq_ = (lapack_int) ldq;
     lapack_int m_ = (lapack_int) *m;
+    lapack_int lwork_ = (lapack_int) lwork;
     lapack_int info_ = 0;
 
-    // query for workspace size
-    std::complex<double> qry_work[1];
-    lapack_int ineg_one = -1;
-    LAPACK_ztrsen(
-        &sense_, &compq_,
-        select_ptr, &n_,
-        (lapack_complex_double*) T, &ldt_,
-        (lapack_complex_double*) Q, &ldq_,
-        (lapack_complex_double*) W, &m_, s, sep,
-        (lapack_complex_double*) qry_work, &ineg_one, &info_
-        #ifdef LAPACK_FORTRAN_STRLEN_END
-        , 1, 1
-        #endif
-    );
-    if (info_ < 0) {
-        throw Error();
-    }
-    lapack_int lwork_ = real(qry_work[0]);
-
-    // allocate workspace
-    lapack::vector< std::complex<double> > work( lwork_ );
-
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztrsen(
         &sense_, &compq_,
         select_ptr, &n_,
         (lapack_complex_double*) T, &ldt_,
         (lapack_complex_double*) Q, &ldq_,
         (lapack_complex_double*) W, &m_, s, sep,
-        (lapack_complex_double*) &work[0], &lwork_, &info_
+        (lapack_complex_double*) work, &lwork_, &info_
         #ifdef LAPACK_FORTRAN_STRLEN_END
         , 1, 1
         #endif
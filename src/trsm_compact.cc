@@ -0,0 +1,183 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "Compact.hh"
+
+namespace lapack {
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// For side = Right, solves with B transposed, using
+//     X   A   = alpha B  <=>  A^T X^T = alpha B^T,
+//     X   A^T = alpha B  <=>  A   X^T = alpha B^T,
+//     X   A^H = alpha B  <=>  A   X^H = conj( alpha ) B^H.
+template <typename scalar_t>
+void trsm_compact(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t m, int64_t n,
+    scalar_t alpha,
+    scalar_t const* Ac,
+    scalar_t* Bc,
+    size_t batch )
+{
+    // check arguments
+    lapack_error_if( side != Side::Left && side != Side::Right );
+    lapack_error_if( uplo != Uplo::Lower && uplo != Uplo::Upper );
+    lapack_error_if( trans != Op::NoTrans && trans != Op::Trans
+                     && trans != Op::ConjTrans );
+    lapack_error_if( diag != Diag::NonUnit && diag != Diag::Unit );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+
+    const int64_t w = compact_width< scalar_t >();
+    int64_t groups = compact_groups< scalar_t >( batch );
+    int64_t na = (side == Side::Left ? m : n);
+
+    lapack::Op trans_left = trans;
+    bool conj_b = false;
+    if (side == Side::Right) {
+        if (trans == Op::NoTrans) {
+            trans_left = Op::Trans;
+        }
+        else {
+            trans_left = Op::NoTrans;
+            if (trans == Op::ConjTrans && blas::is_complex< scalar_t >::value) {
+                conj_b = true;
+                alpha = conj_lane( alpha, true );
+            }
+        }
+    }
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        scalar_t const* A = &Ac[ g*na*na*w ];
+        scalar_t* B = &Bc[ g*m*n*w ];
+        if (side == Side::Left) {
+            trsm_compact_group( uplo, trans_left, diag, m, n, alpha,
+                                A, B, 1, m, false );
+        }
+        else {
+            trsm_compact_group( uplo, trans_left, diag, n, m, alpha,
+                                A, B, m, 1, conj_b );
+        }
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsv_computational
+void trsm_compact(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t m, int64_t n,
+    float alpha,
+    float const* Ac,
+    float* Bc,
+    size_t batch )
+{
+    internal::trsm_compact( side, uplo, trans, diag, m, n, alpha, Ac, Bc,
+                            batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsv_computational
+void trsm_compact(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t m, int64_t n,
+    double alpha,
+    double const* Ac,
+    double* Bc,
+    size_t batch )
+{
+    internal::trsm_compact( side, uplo, trans, diag, m, n, alpha, Ac, Bc,
+                            batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup trsv_computational
+void trsm_compact(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<float> alpha,
+    std::complex<float> const* Ac,
+    std::complex<float>* Bc,
+    size_t batch )
+{
+    internal::trsm_compact( side, uplo, trans, diag, m, n, alpha, Ac, Bc,
+                            batch );
+}
+
+// -----------------------------------------------------------------------------
+/// Solves a triangular system for each problem of a compact batch,
+/// as in `blas::trsm`:
+/// $op(A_i) X_i = \alpha B_i$ or $X_i op(A_i) = \alpha B_i$,
+/// where A_i is triangular.
+/// The matrices are interleaved in groups of `lapack::compact_width`,
+/// as from `lapack::pack_compact`, and the solves vectorize across the
+/// problems of each group. Groups run in parallel across OpenMP threads.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] side
+///     - lapack::Side::Left:  solve $op(A_i) X_i = \alpha B_i$;
+///     - lapack::Side::Right: solve $X_i op(A_i) = \alpha B_i$.
+///
+/// @param[in] uplo
+///     - lapack::Uplo::Upper: each A_i is upper triangular;
+///     - lapack::Uplo::Lower: each A_i is lower triangular.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   $op(A_i) = A_i$;
+///     - lapack::Op::Trans:     $op(A_i) = A_i^T$;
+///     - lapack::Op::ConjTrans: $op(A_i) = A_i^H$.
+///
+/// @param[in] diag
+///     - lapack::Diag::NonUnit: each A_i is non-unit triangular;
+///     - lapack::Diag::Unit:    each A_i is unit triangular; its diagonal
+///       is not referenced.
+///
+/// @param[in] m
+///     The number of rows of each matrix B_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix B_i. n >= 0.
+///
+/// @param[in] alpha
+///     The scalar alpha.
+///
+/// @param[in] Ac
+///     The compact batch of triangular matrices A_i, each m-by-m if
+///     side = Left, or n-by-n if side = Right.
+///
+/// @param[in,out] Bc
+///     The compact batch of m-by-n matrices B_i, of length
+///     `lapack::compact_size< scalar_t >( m, n, batch )`.
+///     On exit, the solution matrices X_i.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @throws Error if any argument is invalid, before any problem is solved.
+///
+/// @ingroup trsv_computational
+void trsm_compact(
+    lapack::Side side, lapack::Uplo uplo, lapack::Op trans, lapack::Diag diag,
+    int64_t m, int64_t n,
+    std::complex<double> alpha,
+    std::complex<double> const* Ac,
+    std::complex<double>* Bc,
+    size_t batch )
+{
+    internal::trsm_compact( side, uplo, trans, diag, m, n, alpha, Ac, Bc,
+                            batch );
+}
+
+}  // namespace lapack
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -19,6 +20,8 @@ int64_t trtri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     float* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "strtri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -30,6 +33,7 @@ int64_t trtri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_strtri(
         &uplo_, &diag_, &n_,
         A, &lda_, &info_
@@ -48,6 +52,8 @@ int64_t trtri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     double* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "dtrtri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -59,6 +65,7 @@ int64_t trtri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtrtri(
         &uplo_, &diag_, &n_,
         A, &lda_, &info_
@@ -77,6 +84,8 @@ int64_t trtri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<float>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "ctrtri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -88,6 +97,7 @@ int64_t trtri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctrtri(
         &uplo_, &diag_, &n_,
         (lapack_complex_float*) A, &lda_, &info_
@@ -106,6 +116,8 @@ int64_t trtri(
     lapack::Uplo uplo, lapack::Diag diag, int64_t n,
     std::complex<double>* A, int64_t lda )
 {
+    LAPACK_INSTRUMENT( "ztrtri", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -117,6 +129,7 @@ int64_t trtri(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztrtri(
         &uplo_, &diag_, &n_,
         (lapack_complex_double*) A, &lda_, &info_
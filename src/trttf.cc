@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t trttf(
     float const* A, int64_t lda,
     float* ARF )
 {
+    LAPACK_INSTRUMENT( "strttf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -31,6 +34,7 @@ int64_t trttf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_strttf(
         &transr_, &uplo_, &n_,
         A, &lda_,
@@ -51,6 +55,8 @@ int64_t trttf(
     double const* A, int64_t lda,
     double* ARF )
 {
+    LAPACK_INSTRUMENT( "dtrttf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -62,6 +68,7 @@ int64_t trttf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtrttf(
         &transr_, &uplo_, &n_,
         A, &lda_,
@@ -82,6 +89,8 @@ int64_t trttf(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* ARF )
 {
+    LAPACK_INSTRUMENT( "ctrttf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -93,6 +102,7 @@ int64_t trttf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctrttf(
         &transr_, &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -113,6 +123,8 @@ int64_t trttf(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* ARF )
 {
+    LAPACK_INSTRUMENT( "ztrttf", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -124,6 +136,7 @@ int64_t trttf(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztrttf(
         &transr_, &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -20,6 +21,8 @@ int64_t trttp(
     float const* A, int64_t lda,
     float* AP )
 {
+    LAPACK_INSTRUMENT( "strttp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -30,6 +33,7 @@ int64_t trttp(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_strttp(
         &uplo_, &n_,
         A, &lda_,
@@ -50,6 +54,8 @@ int64_t trttp(
     double const* A, int64_t lda,
     double* AP )
 {
+    LAPACK_INSTRUMENT( "dtrttp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -60,6 +66,7 @@ int64_t trttp(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_dtrttp(
         &uplo_, &n_,
         A, &lda_,
@@ -80,6 +87,8 @@ int64_t trttp(
     std::complex<float> const* A, int64_t lda,
     std::complex<float>* AP )
 {
+    LAPACK_INSTRUMENT( "ctrttp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -90,6 +99,7 @@ int64_t trttp(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ctrttp(
         &uplo_, &n_,
         (lapack_complex_float*) A, &lda_,
@@ -110,6 +120,8 @@ int64_t trttp(
     std::complex<double> const* A, int64_t lda,
     std::complex<double>* AP )
 {
+    LAPACK_INSTRUMENT( "ztrttp", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -120,6 +132,7 @@ int64_t trttp(
     lapack_int lda_ = (lapack_int) lda;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_ztrttp(
         &uplo_, &n_,
         (lapack_complex_double*) A, &lda_,
@@ -5,6 +5,7 @@
 
 #include "lapack.hh"
 #include "lapack/fortran.h"
+#include "Instrument.hh"
 
 #if LAPACK_VERSION >= 30900  // >= 3.9.0
 
@@ -24,6 +25,8 @@ int64_t unhr_col(
     std::complex<float>* T, int64_t ldt,
     std::complex<float>* D )
 {
+    LAPACK_INSTRUMENT( "cunhr_col", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -40,6 +43,7 @@ int64_t unhr_col(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cunhr_col(
         &m_, &n_, &nb_,
         (lapack_complex_float*) A, &lda_,
@@ -144,6 +148,8 @@ int64_t unhr_col(
     std::complex<double>* T, int64_t ldt,
     std::complex<double>* D )
 {
+    LAPACK_INSTRUMENT( "zunhr_col", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -159,6 +165,7 @@ int64_t unhr_col(
     lapack_int ldt_ = (lapack_int) ldt;
     lapack_int info_ = 0;
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zunhr_col(
         &m_, &n_, &nb_,
         (lapack_complex_double*) A, &lda_,
@@ -0,0 +1,416 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/batch.hh"
+#include "lapack/flops.hh"
+#include "NoConstructAllocator.hh"
+#include "Ilp64Dispatch.hh"
+#include "Batch.hh"
+
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+using blas::min;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+// Pointer-array unmqr_batch. The workspace size is queried only when the
+// options or dimensions change from the previous problem, and each thread
+// reuses one workspace of the largest size for all its problems.
+template <typename scalar_t>
+void unmqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< scalar_t* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< scalar_t* > const& tau_array,
+    std::vector< scalar_t* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    // check arguments
+    check_batch_arg( side, batch );
+    check_batch_arg( trans, batch );
+    check_batch_arg( m, batch );
+    check_batch_arg( n, batch );
+    check_batch_arg( k, batch );
+    check_batch_arg( lda, batch );
+    check_batch_arg( ldc, batch );
+    check_batch_array( Aarray, batch );
+    check_batch_array( tau_array, batch );
+    check_batch_array( Carray, batch );
+    int64_t lwork = 1;
+    int64_t lwork_i = 1;
+    for (size_t i = 0; i < batch; ++i) {
+        lapack::Side side_i = batch_arg( side,  i );
+        lapack::Op trans_i  = batch_arg( trans, i );
+        int64_t m_i   = batch_arg( m,   i );
+        int64_t n_i   = batch_arg( n,   i );
+        int64_t k_i   = batch_arg( k,   i );
+        int64_t lda_i = batch_arg( lda, i );
+        int64_t ldc_i = batch_arg( ldc, i );
+        int64_t nq_i  = (side_i == Side::Left ? m_i : n_i);
+        lapack_error_if( side_i != Side::Left && side_i != Side::Right );
+        check_batch_op< scalar_t >( trans_i );
+        lapack_error_if( m_i < 0 );
+        lapack_error_if( n_i < 0 );
+        lapack_error_if( k_i < 0 || k_i > nq_i );
+        lapack_error_if( lda_i < max( 1, nq_i ) );
+        lapack_error_if( ldc_i < max( 1, m_i ) );
+        lapack_error_if( exceeds_lapack_int( { m_i, n_i, k_i, lda_i, ldc_i } ) );
+        if (i == 0 || batch_changed( i, side, trans, m, n, k, lda, ldc )) {
+            unmqr_work_size( side_i, trans_i, m_i, n_i, k_i,
+                             Aarray[ i ], lda_i, tau_array[ i ],
+                             Carray[ i ], ldc_i, &lwork_i );
+            lwork = max( lwork, lwork_i );
+        }
+    }
+    info.resize( batch );
+
+    // workspace, one per thread
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    auto cost = [&]( size_t i ) {
+        return Gflop< scalar_t >::unmqr(
+            batch_arg( side, i ), batch_arg( m, i ),
+            batch_arg( n, i ), batch_arg( k, i ) );
+    };
+    batch_run( batch, cost, [&]( int64_t i ) {
+        scalar_t* work_ptr = &work[ batch_thread_num() * lwork ];
+        info[ i ] = lapack::unmqr_work(
+            batch_arg( side, i ), batch_arg( trans, i ),
+            batch_arg( m, i ), batch_arg( n, i ), batch_arg( k, i ),
+            Aarray[ i ], batch_arg( lda, i ), tau_array[ i ],
+            Carray[ i ], batch_arg( ldc, i ),
+            work_ptr, lwork );
+    } );
+}
+
+//------------------------------------------------------------------------------
+// Strided unmqr_batch. Problems are the same size, so the workspace size
+// is queried once for the whole batch.
+template <typename scalar_t>
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    scalar_t const* A, int64_t lda, int64_t strideA,
+    scalar_t const* tau, int64_t stride_tau,
+    scalar_t* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    // check arguments
+    int64_t nq = (side == Side::Left ? m : n);
+    lapack_error_if( side != Side::Left && side != Side::Right );
+    check_batch_op< scalar_t >( trans );
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( k < 0 || k > nq );
+    lapack_error_if( lda < max( 1, nq ) );
+    lapack_error_if( ldc < max( 1, m ) );
+    lapack_error_if( batch > 1 && strideA < lda*k );
+    lapack_error_if( batch > 1 && stride_tau < k );
+    lapack_error_if( batch > 1 && strideC < ldc*n );
+    lapack_error_if( exceeds_lapack_int( { m, n, k, lda, ldc } ) );
+
+    if (batch == 0)
+        return;
+
+    // query for workspace size, one workspace per thread
+    int64_t lwork;
+    unmqr_work_size( side, trans, m, n, k, A, lda, tau, C, ldc, &lwork );
+    lapack::vector< scalar_t > work( batch_max_threads() * lwork );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t i = 0; i < int64_t( batch ); ++i) {
+        scalar_t* work_ptr = &work[ batch_thread_num() * lwork ];
+        info[ i ] = lapack::unmqr_work(
+            side, trans, m, n, k,
+            &A[ i*strideA ], lda, &tau[ i*stride_tau ],
+            &C[ i*strideC ], ldc,
+            work_ptr, lwork );
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @see lapack::unmqr_batch
+/// @ingroup geqrf
+void ormqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< float* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< float* > const& tau_array,
+    std::vector< float* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                           Carray, ldc, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::unmqr_batch
+/// @ingroup geqrf
+void ormqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< double* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< double* > const& tau_array,
+    std::vector< double* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                           Carray, ldc, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void unmqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< std::complex<float>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<float>* > const& tau_array,
+    std::vector< std::complex<float>* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                           Carray, ldc, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Multiplies a batch of general matrices C_i by Q_i from
+/// `lapack::geqrf_batch`, as in `lapack::unmqr`:
+///
+/// - side = Left,  trans = NoTrans:   $Q_i C_i$
+/// - side = Right, trans = NoTrans:   $C_i Q_i$
+/// - side = Left,  trans = ConjTrans: $Q_i^H C_i$
+/// - side = Right, trans = ConjTrans: $C_i Q_i^H$
+///
+/// This is the pointer-array variant, for problems of varying size.
+/// Each of side, trans, m, n, k, lda, and ldc has either one element,
+/// used for all problems, or batch elements. Problems run in parallel
+/// across OpenMP threads. The workspace size is queried only when the
+/// options or dimensions differ from the previous problem's, and each
+/// thread reuses one workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, this is an alias for `lapack::ormqr_batch`.
+///
+/// @param[in] side
+///     - lapack::Side::Left:  apply $Q_i$ or $Q_i^H$ from the Left;
+///     - lapack::Side::Right: apply $Q_i$ or $Q_i^H$ from the Right.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   No transpose, apply $Q_i$;
+///     - lapack::Op::ConjTrans: Conjugate transpose, apply $Q_i^H$.
+///
+/// @param[in] m
+///     The number of rows of each matrix C_i. m_i >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix C_i. n_i >= 0.
+///
+/// @param[in] k
+///     The number of elementary reflectors whose product defines Q_i.
+///     - If side = Left,  m_i >= k_i >= 0;
+///     - if side = Right, n_i >= k_i >= 0.
+///
+/// @param[in] Aarray
+///     Array of batch pointers to the elementary reflectors, each stored
+///     in an lda_i-by-k_i array, as returned by `lapack::geqrf_batch`.
+///
+/// @param[in] lda
+///     The leading dimension of each array A_i.
+///     - If side = Left,  lda_i >= max(1,m_i);
+///     - if side = Right, lda_i >= max(1,n_i).
+///
+/// @param[in] tau_array
+///     Array of batch pointers to the vectors tau_i of length k_i,
+///     as returned by `lapack::geqrf_batch`.
+///
+/// @param[in,out] Carray
+///     Array of batch pointers to the matrices C_i, each stored in an
+///     ldc_i-by-n_i array. On exit, C_i is overwritten by
+///     $Q_i C_i$, $Q_i^H C_i$, $C_i Q_i^H$, or $C_i Q_i$.
+///
+/// @param[in] ldc
+///     The leading dimension of each array C_i. ldc_i >= max(1,m_i).
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     Resized to batch. info[i] is the return value of `lapack::unmqr`
+///     for problem i; = 0: successful exit.
+///
+/// @throws Error if any argument is invalid, before any problem is computed.
+///
+/// @ingroup geqrf
+void unmqr_batch(
+    std::vector< lapack::Side > const& side,
+    std::vector< lapack::Op > const& trans,
+    std::vector< int64_t > const& m,
+    std::vector< int64_t > const& n,
+    std::vector< int64_t > const& k,
+    std::vector< std::complex<double>* > const& Aarray, std::vector< int64_t > const& lda,
+    std::vector< std::complex<double>* > const& tau_array,
+    std::vector< std::complex<double>* > const& Carray, std::vector< int64_t > const& ldc,
+    size_t batch,
+    std::vector< int64_t >& info )
+{
+    internal::unmqr_batch( side, trans, m, n, k, Aarray, lda, tau_array,
+                           Carray, ldc, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::unmqr_batch
+/// @ingroup geqrf
+void ormqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    float const* A, int64_t lda, int64_t strideA,
+    float const* tau, int64_t stride_tau,
+    float* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    internal::unmqr_batch( side, trans, m, n, k, A, lda, strideA,
+                           tau, stride_tau, C, ldc, strideC, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @see lapack::unmqr_batch
+/// @ingroup geqrf
+void ormqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    double const* A, int64_t lda, int64_t strideA,
+    double const* tau, int64_t stride_tau,
+    double* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    internal::unmqr_batch( side, trans, m, n, k, A, lda, strideA,
+                           tau, stride_tau, C, ldc, strideC, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup geqrf
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<float> const* A, int64_t lda, int64_t strideA,
+    std::complex<float> const* tau, int64_t stride_tau,
+    std::complex<float>* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    internal::unmqr_batch( side, trans, m, n, k, A, lda, strideA,
+                           tau, stride_tau, C, ldc, strideC, batch, info );
+}
+
+// -----------------------------------------------------------------------------
+/// Multiplies a batch of general m-by-n matrices C_i by Q_i from
+/// `lapack::geqrf_batch`, as in `lapack::unmqr`.
+///
+/// This is the strided variant, for problems of the same size.
+/// Problem i uses A_i = A + i*strideA, tau_i = tau + i*stride_tau, and
+/// C_i = C + i*strideC. Problems run in parallel across OpenMP threads.
+/// The workspace size is queried once for the whole batch, and each
+/// thread reuses one workspace.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+/// For real matrices, this is an alias for `lapack::ormqr_batch`.
+///
+/// @param[in] side
+///     - lapack::Side::Left:  apply $Q_i$ or $Q_i^H$ from the Left;
+///     - lapack::Side::Right: apply $Q_i$ or $Q_i^H$ from the Right.
+///
+/// @param[in] trans
+///     - lapack::Op::NoTrans:   No transpose, apply $Q_i$;
+///     - lapack::Op::ConjTrans: Conjugate transpose, apply $Q_i^H$.
+///
+/// @param[in] m
+///     The number of rows of each matrix C_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix C_i. n >= 0.
+///
+/// @param[in] k
+///     The number of elementary reflectors whose product defines Q_i.
+///     - If side = Left,  m >= k >= 0;
+///     - if side = Right, n >= k >= 0.
+///
+/// @param[in] A
+///     The elementary reflectors, each stored in an lda-by-k array,
+///     as returned by `lapack::geqrf_batch`.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i.
+///     - If side = Left,  lda >= max(1,m);
+///     - if side = Right, lda >= max(1,n).
+///
+/// @param[in] strideA
+///     Distance between consecutive A_i. strideA >= lda*k.
+///
+/// @param[in] tau
+///     The vectors tau_i, each of length k.
+///
+/// @param[in] stride_tau
+///     Distance between consecutive vectors tau_i. stride_tau >= k.
+///
+/// @param[in,out] C
+///     The matrices C_i, each stored in an ldc-by-n array.
+///     On exit, C_i is overwritten by
+///     $Q_i C_i$, $Q_i^H C_i$, $C_i Q_i^H$, or $C_i Q_i$.
+///
+/// @param[in] ldc
+///     The leading dimension of each C_i. ldc >= max(1,m).
+///
+/// @param[in] strideC
+///     Distance between consecutive matrices C_i. strideC >= ldc*n.
+///
+/// @param[in] batch
+///     The number of problems.
+///
+/// @param[out] info
+///     The vector info of length batch. info[i] is the return value of
+///     `lapack::unmqr` for problem i.
+///
+/// @throws Error if any argument is invalid, before any problem is computed.
+///
+/// @ingroup geqrf
+void unmqr_batch(
+    lapack::Side side, lapack::Op trans, int64_t m, int64_t n, int64_t k,
+    std::complex<double> const* A, int64_t lda, int64_t strideA,
+    std::complex<double> const* tau, int64_t stride_tau,
+    std::complex<double>* C, int64_t ldc, int64_t strideC,
+    size_t batch,
+    int64_t* info )
+{
+    internal::unmqr_batch( side, trans, m, n, k, A, lda, strideA,
+                           tau, stride_tau, C, ldc, strideC, batch, info );
+}
+
+}  // namespace lapack
@@ -0,0 +1,127 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack.hh"
+#include "lapack/compact.hh"
+#include "Batch.hh"
+#include "Compact.hh"
+
+#include <algorithm>
+#include <vector>
+
+namespace lapack {
+
+using blas::max;
+
+namespace internal {
+
+//------------------------------------------------------------------------------
+template <typename scalar_t>
+void unpack_compact(
+    int64_t m, int64_t n,
+    scalar_t const* Ac,
+    std::vector< scalar_t* > const& Aarray, int64_t lda,
+    size_t batch )
+{
+    // check arguments
+    lapack_error_if( m < 0 );
+    lapack_error_if( n < 0 );
+    lapack_error_if( lda < max( 1, m ) );
+    check_batch_array( Aarray, batch );
+
+    const int64_t w = compact_width< scalar_t >();
+    int64_t groups = compact_groups< scalar_t >( batch );
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule( static )
+    #endif
+    for (int64_t g = 0; g < groups; ++g) {
+        scalar_t const* Ag = &Ac[ g*m*n*w ];
+        int64_t lanes = std::min( w, int64_t( batch ) - g*w );
+        for (int64_t l = 0; l < lanes; ++l) {
+            scalar_t* A = Aarray[ g*w + l ];
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t i = 0; i < m; ++i)
+                    A[ i + j*lda ] = Ag[ (i + j*m)*w + l ];
+        }
+    }
+}
+
+}  // namespace internal
+
+// -----------------------------------------------------------------------------
+/// @ingroup auxiliary
+void unpack_compact(
+    int64_t m, int64_t n,
+    float const* Ac,
+    std::vector< float* > const& Aarray, int64_t lda,
+    size_t batch )
+{
+    internal::unpack_compact( m, n, Ac, Aarray, lda, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup auxiliary
+void unpack_compact(
+    int64_t m, int64_t n,
+    double const* Ac,
+    std::vector< double* > const& Aarray, int64_t lda,
+    size_t batch )
+{
+    internal::unpack_compact( m, n, Ac, Aarray, lda, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// @ingroup auxiliary
+void unpack_compact(
+    int64_t m, int64_t n,
+    std::complex<float> const* Ac,
+    std::vector< std::complex<float>* > const& Aarray, int64_t lda,
+    size_t batch )
+{
+    internal::unpack_compact( m, n, Ac, Aarray, lda, batch );
+}
+
+// -----------------------------------------------------------------------------
+/// Converts a compact batch of m-by-n matrices, e.g., factors from
+/// `lapack::getrf_compact` or solutions from `lapack::getrs_compact`,
+/// back to column-major matrices A_i. Padding is ignored.
+/// See lapack/compact.hh for the layout.
+///
+/// Overloaded versions are available for
+/// `float`, `double`, `std::complex<float>`, and `std::complex<double>`.
+///
+/// @param[in] m
+///     The number of rows of each matrix A_i. m >= 0.
+///
+/// @param[in] n
+///     The number of columns of each matrix A_i. n >= 0.
+///
+/// @param[in] Ac
+///     The compact batch, from `lapack::pack_compact`.
+///
+/// @param[out] Aarray
+///     Array of batch pointers to the matrices A_i, each stored in an
+///     lda-by-n array.
+///
+/// @param[in] lda
+///     The leading dimension of each A_i. lda >= max(1,m).
+///
+/// @param[in] batch
+///     The number of matrices.
+///
+/// @throws Error if any argument is invalid.
+///
+/// @ingroup auxiliary
+void unpack_compact(
+    int64_t m, int64_t n,
+    std::complex<double> const* Ac,
+    std::vector< std::complex<double>* > const& Aarray, int64_t lda,
+    size_t batch )
+{
+    internal::unpack_compact( m, n, Ac, Aarray, lda, batch );
+}
+
+}  // namespace lapack
@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -22,6 +23,8 @@ int64_t upgtr(
     std::complex<float> const* tau,
     std::complex<float>* Q, int64_t ldq )
 {
+    LAPACK_INSTRUMENT( "cupgtr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -35,6 +38,7 @@ int64_t upgtr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( (n-1) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cupgtr(
         &uplo_, &n_,
         (lapack_complex_float*) AP,
@@ -58,6 +62,8 @@ int64_t upgtr(
     std::complex<double> const* tau,
     std::complex<double>* Q, int64_t ldq )
 {
+    LAPACK_INSTRUMENT( "zupgtr", 0, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(n) > std::numeric_limits<lapack_int>::max() );
@@ -71,6 +77,7 @@ int64_t upgtr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( (n-1) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zupgtr(
         &uplo_, &n_,
         (lapack_complex_double*) AP,
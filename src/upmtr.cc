@@ -6,6 +6,7 @@
 #include "lapack.hh"
 #include "lapack/fortran.h"
 #include "NoConstructAllocator.hh"
+#include "Instrument.hh"
 
 #include <vector>
 
@@ -23,6 +24,8 @@ int64_t upmtr(
     std::complex<float> const* tau,
     std::complex<float>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "cupmtr", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -43,6 +46,7 @@ int64_t upmtr(
     // allocate workspace
     lapack::vector< std::complex<float> > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_cupmtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         (lapack_complex_float*) AP,
@@ -130,6 +134,8 @@ int64_t upmtr(
     std::complex<double> const* tau,
     std::complex<double>* C, int64_t ldc )
 {
+    LAPACK_INSTRUMENT( "zupmtr", m, n, 0 );
+
     // check for overflow
     if (sizeof(int64_t) > sizeof(lapack_int)) {
         lapack_error_if( std::abs(m) > std::numeric_limits<lapack_int>::max() );
@@ -150,6 +156,7 @@ int64_t upmtr(
     // allocate workspace
     lapack::vector< std::complex<double> > work( max(1,lwork) );
 
+    LAPACK_INSTRUMENT_COMPUTE();
     LAPACK_zupmtr(
         &side_, &uplo_, &trans_, &m_, &n_,
         (lapack_complex_double*) AP,
@@ -0,0 +1,196 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "lapack/work_size_cache.hh"
+#include "WorkSizeCache.hh"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+namespace lapack {
+namespace internal {
+
+//------------------------------------------------------------------------------
+// FNV-1a style mix of the key's entries.
+struct WorkSizeKeyHash
+{
+    size_t operator () ( WorkSizeKey const& key ) const noexcept
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (int64_t value : key) {
+            hash ^= uint64_t( value );
+            hash *= 1099511628211ull;
+            hash ^= hash >> 32;
+        }
+        return size_t( hash );
+    }
+};
+
+//------------------------------------------------------------------------------
+// Sizes returned by one workspace query.
+struct WorkSizes
+{
+    int64_t lwork, lrwork, liwork;
+};
+
+//------------------------------------------------------------------------------
+// Hash map split into shards, each with its own mutex, so concurrent
+// queries from different threads rarely contend for the same lock.
+// A shard is cleared when it fills up, which bounds memory if an
+// application uses many distinct sizes.
+class WorkSizeCache
+{
+public:
+    bool lookup( WorkSizeKey const& key, WorkSizes* sizes );
+    void insert( WorkSizeKey const& key, WorkSizes const& sizes );
+    void clear();
+
+    std::atomic< bool >    enabled { default_enabled() };
+    std::atomic< int64_t > hits    { 0 };
+    std::atomic< int64_t > misses  { 0 };
+
+private:
+    static bool default_enabled();
+
+    static constexpr int num_shards = 16;
+    static constexpr size_t max_shard_size = 1024;
+
+    struct alignas(64) Shard
+    {
+        std::mutex mutex;
+        std::unordered_map< WorkSizeKey, WorkSizes, WorkSizeKeyHash > map;
+    };
+
+    Shard& shard( size_t hash ) { return shards_[ (hash >> 8) % num_shards ]; }
+
+    Shard shards_[ num_shards ];
+};
+
+//------------------------------------------------------------------------------
+// Enabled unless $LAPACKPP_WORK_SIZE_CACHE is 0, off, or false.
+bool WorkSizeCache::default_enabled()
+{
+    const char* env = std::getenv( "LAPACKPP_WORK_SIZE_CACHE" );
+    return ! (env != nullptr
+              && (strcmp( env, "0" ) == 0
+                  || strcmp( env, "off" ) == 0
+                  || strcmp( env, "false" ) == 0));
+}
+
+//------------------------------------------------------------------------------
+bool WorkSizeCache::lookup( WorkSizeKey const& key, WorkSizes* sizes )
+{
+    size_t hash = WorkSizeKeyHash()( key );
+    Shard& s = shard( hash );
+    {
+        std::lock_guard< std::mutex > guard( s.mutex );
+        auto iter = s.map.find( key );
+        if (iter != s.map.end()) {
+            *sizes = iter->second;
+            hits.fetch_add( 1, std::memory_order_relaxed );
+            return true;
+        }
+    }
+    misses.fetch_add( 1, std::memory_order_relaxed );
+    return false;
+}
+
+//------------------------------------------------------------------------------
+void WorkSizeCache::insert( WorkSizeKey const& key, WorkSizes const& sizes )
+{
+    size_t hash = WorkSizeKeyHash()( key );
+    Shard& s = shard( hash );
+    std::lock_guard< std::mutex > guard( s.mutex );
+    if (s.map.size() >= max_shard_size)
+        s.map.clear();
+    s.map[ key ] = sizes;
+}
+
+//------------------------------------------------------------------------------
+void WorkSizeCache::clear()
+{
+    for (auto& s : shards_) {
+        std::lock_guard< std::mutex > guard( s.mutex );
+        s.map.clear();
+    }
+    hits.store( 0, std::memory_order_relaxed );
+    misses.store( 0, std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+// Constructed on first use, so it is safe to use from static initializers.
+static WorkSizeCache& work_size_cache()
+{
+    static WorkSizeCache cache;
+    return cache;
+}
+
+//------------------------------------------------------------------------------
+bool work_size_lookup(
+    WorkSizeKey const& key,
+    int64_t* lwork, int64_t* lrwork, int64_t* liwork )
+{
+    WorkSizeCache& cache = work_size_cache();
+    if (! cache.enabled.load( std::memory_order_relaxed ))
+        return false;
+
+    WorkSizes sizes;
+    if (! cache.lookup( key, &sizes ))
+        return false;
+
+    *lwork = sizes.lwork;
+    if (lrwork != nullptr)
+        *lrwork = sizes.lrwork;
+    if (liwork != nullptr)
+        *liwork = sizes.liwork;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+void work_size_insert(
+    WorkSizeKey const& key,
+    int64_t lwork, int64_t lrwork, int64_t liwork )
+{
+    WorkSizeCache& cache = work_size_cache();
+    if (cache.enabled.load( std::memory_order_relaxed ))
+        cache.insert( key, { lwork, lrwork, liwork } );
+}
+
+}  // namespace internal
+
+//------------------------------------------------------------------------------
+void set_work_size_cache( bool enable )
+{
+    internal::work_size_cache().enabled.store(
+        enable, std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+bool get_work_size_cache()
+{
+    return internal::work_size_cache().enabled.load(
+        std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+void work_size_cache_stats( int64_t* hits, int64_t* misses )
+{
+    internal::WorkSizeCache& cache = internal::work_size_cache();
+    if (hits != nullptr)
+        *hits = cache.hits.load( std::memory_order_relaxed );
+    if (misses != nullptr)
+        *misses = cache.misses.load( std::memory_order_relaxed );
+}
+
+//------------------------------------------------------------------------------
+void clear_work_size_cache()
+{
+    internal::work_size_cache().clear();
+}
+
+}  // namespace lapack
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+# This program is free software: you can redistribute it and/or modify it under
+# the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+#
+# Times routines with each LAPACK backend using the tester, and writes a
+# dispatch table that picks the fastest backend per routine and size.
+# Requires LAPACK++ built with use_dispatch. See include/lapack/dispatch.hh.
+#
+# Example usage:
+# help
+#     ./calibrate_dispatch.py -h
+#
+# compare OpenBLAS and MKL with the linked LAPACK for potrf and heevd
+#     ./calibrate_dispatch.py \
+#         --backend openblas=/usr/lib/x86_64-linux-gnu/libopenblas.so.0 \
+#         --backend mkl=libmkl_rt.so \
+#         --dim 50,100,200,500,1000 -o dispatch.txt potrf heevd
+#
+# then use it
+#     export LAPACKPP_DISPATCH=$PWD/dispatch.txt
+
+from __future__ import print_function
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+# ------------------------------------------------------------------------------
+# command line arguments
+parser = argparse.ArgumentParser()
+parser.add_argument( '-t', '--test', action='store',
+    help='test command to run; default "%(default)s"', default='./tester' )
+parser.add_argument( '-b', '--backend', action='append', default=[],
+    help='backend as name=shared_library; repeatable' )
+parser.add_argument( '--type', action='store',
+    help='data types; default "%(default)s"', default='s,d,c,z' )
+parser.add_argument( '--dim', action='store',
+    help='problem sizes n, in increasing order; default "%(default)s"',
+    default='25,50,100,200,500,1000,2000' )
+parser.add_argument( '--repeat', action='store', type=int,
+    help='repetitions per size; the fastest is used; default %(default)s',
+    default=3 )
+parser.add_argument( '--args', action='store',
+    help='extra tester arguments, e.g., "--jobz v"; default "%(default)s"',
+    default='' )
+parser.add_argument( '-o', '--output', action='store',
+    help='dispatch table to write; default stdout' )
+parser.add_argument( 'routines', nargs='*',
+    help='routines to calibrate; default all dispatched routines',
+    default=[ 'potrf', 'getrf', 'gesdd', 'heevd' ] )
+opts = parser.parse_args()
+
+backends = []
+for b in opts.backend:
+    (name, path) = b.split( '=', 1 )
+    backends.append( (name, path) )
+if (not backends):
+    print( 'Error: at least one --backend name=library is required',
+           file=sys.stderr )
+    sys.exit( 1 )
+
+dims = [ int( d ) for d in opts.dim.split( ',' ) ]
+
+# ------------------------------------------------------------------------------
+# LAPACK symbol that a routine uses for a data type,
+# e.g., heevd with type d uses dsyevd.
+def symbol( routine, dtype ):
+    if (dtype in 'sd' and routine.startswith( 'he' )):
+        routine = 'sy' + routine[2:]
+    return dtype + routine
+# end
+
+# ------------------------------------------------------------------------------
+# Writes a table that sends every routine to one backend.
+def write_table( name, path ):
+    (fd, filename) = tempfile.mkstemp( suffix='.txt', text=True )
+    with os.fdopen( fd, 'w' ) as f:
+        if (name != 'default'):
+            f.write( 'backend %s %s\n' % (name, path) )
+        f.write( '* * %s\n' % (name) )
+    return filename
+# end
+
+# ------------------------------------------------------------------------------
+# Runs the tester and returns { n: best gflop/s }.
+def run( table, routine, dtype ):
+    cmd = (opts.test + ' --check n --ref n --type ' + dtype
+           + ' --repeat ' + str( opts.repeat )
+           + ' --dim ' + ','.join( map( str, dims ) )
+           + ' ' + opts.args + ' ' + routine)
+    print( cmd, file=sys.stderr )
+    env = dict( os.environ, LAPACKPP_DISPATCH=table )
+    out = subprocess.run( cmd.split(), env=env, stdout=subprocess.PIPE,
+                          universal_newlines=True ).stdout
+
+    # Columns are right aligned; use the header to find where the
+    # n and gflop/s columns end.
+    result = {}
+    n_end = gflops_end = None
+    for line in out.splitlines():
+        if (re.search( r'\bgflop/s\b', line ) and re.search( r'\bn\b', line )):
+            n_end      = re.search( r'\bn\b', line ).end()
+            gflops_end = line.index( 'gflop/s' ) + len( 'gflop/s' )
+            continue
+        if (n_end is None or not re.match( r'\s*[sdcz]\b', line )):
+            continue
+        n = field( line, n_end )
+        gflops = field( line, gflops_end )
+        if (n is None or gflops is None):
+            continue
+        n = int( n )
+        result[ n ] = max( result.get( n, 0.0 ), float( gflops ) )
+    return result
+# end
+
+# ------------------------------------------------------------------------------
+# Returns the whitespace-delimited token in line that ends at column end.
+def field( line, end ):
+    for m in re.finditer( r'\S+', line ):
+        if (m.start() < end <= m.end() + 1):
+            token = m.group( 0 )
+            if (re.match( r'^[-+]?\d+(\.\d*)?([eE][-+]?\d+)?$', token )):
+                return token
+            return None
+    return None
+# end
+
+# ------------------------------------------------------------------------------
+candidates = [ ('default', '') ] + backends
+tables = { name: write_table( name, path ) for (name, path) in candidates }
+
+lines = [ '# generated by: ' + ' '.join( sys.argv ), '' ]
+for (name, path) in backends:
+    lines.append( 'backend %-10s %s' % (name, path) )
+lines.append( '' )
+lines.append( '# %-8s %8s  %s' % ('routine', 'max_n', 'backend') )
+
+try:
+    for routine in opts.routines:
+        for dtype in opts.type.split( ',' ):
+            speed = { name: run( tables[ name ], routine, dtype )
+                      for (name, path) in candidates }
+
+            # fastest backend per size; sizes that failed are skipped
+            best = []
+            for n in dims:
+                times = [ (speed[ name ].get( n, 0.0 ), name)
+                          for (name, path) in candidates ]
+                (gflops, name) = max( times )
+                if (gflops > 0):
+                    best.append( (n, name) )
+
+            # merge consecutive sizes with the same winner; the last
+            # range is open ended
+            sym = symbol( routine, dtype )
+            for (i, (n, name)) in enumerate( best ):
+                if (i + 1 < len( best ) and best[ i+1 ][1] == name):
+                    continue
+                max_n = '*' if (i + 1 == len( best )) else str( n )
+                lines.append( '%-10s %8s  %s' % (sym, max_n, name) )
+finally:
+    for filename in tables.values():
+        os.remove( filename )
+
+text = '\n'.join( lines ) + '\n'
+if (opts.output):
+    with open( opts.output, 'w' ) as f:
+        f.write( text )
+else:
+    print( text, end='' )
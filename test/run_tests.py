@@ -128,6 +128,7 @@ group_opt.add_argument( '--select', action='store', help='default=%(default)s',
 group_opt.add_argument( '--sense',  action='store', help='default=%(default)s', default='n,e,v,b' )
 group_opt.add_argument( '--vect',   action='store', help='default=%(default)s', default='n,v' )
 group_opt.add_argument( '--l',      action='store', help='default=%(default)s', default='0,100' )
+group_opt.add_argument( '--alloc',  action='store', help='workspace placement for heevd, gesdd, e.g., d,h,f,i with --dim 4000:8000:2000 to compare; default none', default='' )
 group_opt.add_argument( '--ka',     action='store', help='default=%(default)s', default='20,100' )
 group_opt.add_argument( '--kb',     action='store', help='default=%(default)s', default='20,100' )
 group_opt.add_argument( '--kd',     action='store', help='default=%(default)s', default='20,100' )
@@ -319,6 +320,7 @@ vu     = ' --vu '     + opts.vu     if (opts.vu)     else ''
 il     = ' --il '     + opts.il     if (opts.il)     else ''
 iu     = ' --iu '     + opts.iu     if (opts.iu)     else ''
 mtype  = ' --matrixtype ' + opts.matrixtype if (opts.matrixtype) else ''
+alloc  = ' --alloc '  + opts.alloc  if (opts.alloc)  else ''
 
 # general options for all routines
 gen = check + ref + verbose
@@ -356,6 +358,11 @@ if (opts.lu and opts.host):
     # todo: equed
     [ 'gesvx', gen + dtype + align + n + factored + trans ],
     [ 'getrf', gen + dtype + align + mn ],
+    [ 'getrf_batch', gen + dtype + align + mn ],
+    [ 'getrf_vbatch', gen + dtype + n ],
+    [ 'getrf_compact', gen + dtype + align + ' --dim 4 --dim 8 --dim 16' + trans ],
+    [ 'getrf_recursive', gen + dtype + align + mn ],
+    [ 'getrf_fixed', gen + dtype + align + ' --dim 2 --dim 4 --dim 8' + trans ],
     [ 'getrs', gen + dtype + align + n + trans ],
     [ 'getri', gen + dtype + align + n ],
     [ 'gecon', gen + dtype + align + n ],
@@ -374,6 +381,9 @@ if (opts.gb and opts.host):
     cmds += [
     [ 'gbsv',  gen + dtype + align + n  + kl + ku ],
     [ 'gbtrf', gen + dtype + align + mn + kl + ku ],
+    [ 'gbtrf_batch', gen + dtype + align + mn + kl + ku + trans ],
+    # kl, ku <= 4 use native kernels
+    [ 'gbtrf_batch', gen + dtype + align + n + ' --kl 0,1,4 --ku 0,2,4' + trans ],
     [ 'gbtrs', gen + dtype + align + n  + kl + ku + trans ],
     [ 'gbcon', gen + dtype + align + n  + kl + ku ],
     [ 'gbrfs', gen + dtype + align + n  + kl + ku + trans ],
@@ -384,6 +394,7 @@ if (opts.gb and opts.host):
 if (opts.gt and opts.host):
     cmds += [
     [ 'gtsv',  gen + dtype + align + n ],
+    [ 'gtsv_batch', gen + dtype + align + n + trans ],
     [ 'gttrf', gen + dtype +         n ],
     [ 'gttrs', gen + dtype + align + n + trans ],
     [ 'gtcon', gen + dtype +         n ],
@@ -394,9 +405,15 @@ if (opts.gt and opts.host):
 if (opts.chol and opts.host):
     cmds += [
     [ 'posv',  gen + dtype + align + n + uplo ],
+    [ 'posv_batch', gen + dtype + align + n + uplo ],
     [ 'potrf', gen + dtype + align + n + uplo ],
+    [ 'potrf_batch', gen + dtype + align + n + uplo ],
+    [ 'potrf_compact', gen + dtype + align + ' --dim 4 --dim 8 --dim 16' + uplo ],
+    [ 'potrf_recursive', gen + dtype + align + n + uplo ],
+    [ 'potrf_fixed', gen + dtype + align + ' --dim 2 --dim 4 --dim 8' + uplo ],
     [ 'potrs', gen + dtype + align + n + uplo ],
     [ 'potri', gen + dtype + align + n + uplo ],
+    [ 'potri_batch', gen + dtype + align + n + uplo ],
     [ 'pocon', gen + dtype + align + n + uplo ],
     [ 'porfs', gen + dtype + align + n + uplo ],
     [ 'poequ', gen + dtype + align + n ],  # only diagonal elements (no uplo)
@@ -420,6 +437,7 @@ if (opts.chol and opts.host):
 
     # Tri-diagonal
     [ 'ptsv',  gen + dtype + align + n ],
+    [ 'ptsv_batch', gen + dtype + align + n + uplo ],
     [ 'pttrf', gen + dtype         + n ],
     [ 'pttrs', gen + dtype + align + n + uplo ],
     [ 'ptcon', gen + dtype         + n ],
@@ -504,6 +522,7 @@ if (opts.hesv and opts.host):
 if (opts.least_squares and opts.host):
     cmds += [
     [ 'gels',   gen + dtype + align + mn + trans_nc ],
+    [ 'gels_batch', gen + dtype + align + mn + trans_nc ],
     [ 'gelsy',  gen + dtype + align + mn ],
     # todo: gelsd is failing
     #[ 'gelsd',  gen + dtype + align + mn ],
@@ -521,11 +540,18 @@ if (opts.qr and opts.host):
     cmds += [
     [ 'geqr',  gen + dtype + align + n + wide + tall ],
     [ 'geqrf', gen + dtype + align + n + wide + tall ],
+    [ 'geqrf_fixed', gen + dtype + align + ' --dim 4 --dim 8x4 --dim 4x8' ],
+    [ 'geqr_batch',  gen + dtype + align + n + wide + tall ],
+    [ 'geqrf_batch', gen + dtype + align + n + wide + tall ],
     # todo: ggqrf is failing
     #[ 'ggqrf', gen + dtype + align + mnk ],
     [ 'ungqr', gen + dtype + align + mn ],  # m >= n
     #[ 'unmqr', gen + dtype_real    + align + mnk + side + trans    ],  # real does trans = N, T, C
     #[ 'unmqr', gen + dtype_complex + align + mnk + side + trans_nc ],  # complex does trans = N, C, not T
+    [ 'unmqr_batch', gen + dtype_real    + align + mnk + side + trans    ],  # real does trans = N, T, C
+    [ 'unmqr_batch', gen + dtype_complex + align + mnk + side + trans_nc ],  # complex does trans = N, C, not T
+    [ 'gemqr_batch', gen + dtype_real    + align + mnk + side + trans_nt ],
+    [ 'gemqr_batch', gen + dtype_complex + align + mnk + side + trans_nc ],
 
     [ 'orhr_col', gen + dtype_real + align + n + tall ],
     [ 'unhr_col', gen + dtype      + align + n + tall ],
@@ -587,7 +613,12 @@ if (opts.syev and opts.host):
     [ 'heev',  gen + dtype + align + n + jobz + uplo ],
     [ 'heevx', gen + dtype + align + n + jobz + uplo + vl + vu ],
     [ 'heevx', gen + dtype + align + n + jobz + uplo + il + iu ],
-    [ 'heevd', gen + dtype + align + n + jobz + uplo ],
+    [ 'heevd', gen + dtype + align + n + jobz + uplo + alloc ],
+    [ 'heevd_batch', gen + dtype + align + n + jobz + uplo ],
+    [ 'heevd_batch', gen + dtype + align + ' --dim 3 --dim 16' + jobz + uplo ],  # n <= 16 uses Jacobi
+    [ 'sturm_multi', gen + dtype_real + n ],
+    [ 'tridiag_bisect', gen + dtype_real + n + vl + vu ],
+    [ 'tridiag_bisect', gen + dtype_real + n + il + iu ],
     [ 'heevr', gen + dtype + align + n + jobz + uplo + vl + vu ],
     [ 'heevr', gen + dtype + align + n + jobz + uplo + il + iu ],
     [ 'hetrd', gen + dtype + align + n + uplo ],
@@ -671,7 +702,11 @@ if (opts.svd and opts.host):
     #[ 'gesvd',         gen + dtype + align + mn + jobu + jobvt ],
     [ 'gesvd',         gen + dtype + align + mn + " --jobu n,a" + jobvt ],
     [ 'gesvd',         gen + dtype + align + mn + " --jobu o,s --jobvt n" ],
-    [ 'gesdd',         gen + dtype + align + mn + jobu ],
+    [ 'gesvd_batch',   gen + dtype + align + mn + " --jobu n,a" + jobvt ],
+    [ 'gesvd_batch',   gen + dtype + align + ' --dim 2 --dim 3 --dim 7 --dim 12 --dim 12x6 --dim 6x12' + " --jobu n,s,a --jobvt n,s,a" ],  # small min(m,n) uses Jacobi
+    [ 'gesdd',         gen + dtype + align + mn + jobu + alloc ],
+    [ 'gesdd_batch',   gen + dtype + align + mn + jobu ],
+    [ 'gesdd_batch',   gen + dtype + align + ' --dim 2 --dim 3 --dim 7 --dim 12 --dim 12x6 --dim 6x12' + jobu ],  # small min(m,n) uses Jacobi
     # todo: gesvdx is failing
     #[ 'gesvdx',        gen + dtype + align + mn + jobz + jobvr + vl + vu ],
     #[ 'gesvdx',        gen + dtype + align + mn + jobz + jobvr + il + iu ],
@@ -687,8 +722,20 @@ if (opts.aux and opts.host):
     cmds += [
     [ 'lacpy', gen + dtype + align + mn + mtype ],
     [ 'laed4', gen + dtype_real + n ],
+    [ 'laed4_all', gen + dtype_real + n ],
+    [ 'laed4_all_native', gen + dtype_real + n ],
     [ 'laset', gen + dtype + align + mn + mtype ],
     [ 'laswp', gen + dtype + align + mn ],
+    [ 'ilp64', gen + dtype + n + trans + uplo ],
+    [ 'trace', gen + dtype + n ],
+    [ 'stats', gen + dtype + n ],
+    [ 'arena', gen + dtype + n ],
+    [ 'dispatch', gen + dtype + n ],
+    [ 'batching_executor', gen + dtype + mn ],
+    [ 'plan', gen + dtype + mn ],
+    [ 'pivot_int', gen + dtype + n + trans + uplo + kl + ku ],
+    [ 'work', gen + dtype + n ],
+    [ 'work_size_cache', gen + dtype + mn ],
     ]
 
 # auxilary - householder
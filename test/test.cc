@@ -115,6 +115,15 @@ std::vector< testsweeper::routines_t > routines = {
     { "gbequ",              test_gbequ,     Section::gesv },
     { "",                   nullptr,        Section::newline },
 
+    { "getrf_batch",        test_getrf_batch,   Section::gesv },
+    { "getrf_vbatch",       test_getrf_vbatch,  Section::gesv },
+    { "getrf_compact",      test_getrf_compact, Section::gesv },
+    { "getrf_fixed",        test_getrf_fixed, Section::gesv },
+    { "getrf_recursive",    test_getrf_recursive, Section::gesv },
+    { "gtsv_batch",         test_gtsv_batch,    Section::gesv },
+    { "gbtrf_batch",        test_gbtrf_batch,   Section::gesv },
+    { "",                   nullptr,        Section::newline },
+
     // -----
     // Cholesky
     { "posv",               test_posv,      Section::posv },
@@ -139,6 +148,15 @@ std::vector< testsweeper::routines_t > routines = {
     { "pptri",              test_pptri,     Section::posv },
     { "",                   nullptr,        Section::newline },
 
+    { "posv_batch",         test_posv_batch,    Section::posv },
+    { "potrf_batch",        test_potrf_batch,   Section::posv },
+    { "potrf_compact",      test_potrf_compact, Section::posv },
+    { "potrf_fixed",        test_potrf_fixed, Section::posv },
+    { "potrf_recursive",    test_potrf_recursive, Section::posv },
+    { "potri_batch",        test_potri_batch,   Section::posv },
+    { "ptsv_batch",         test_ptsv_batch,    Section::posv },
+    { "",                   nullptr,        Section::newline },
+
     { "pocon",              test_pocon,     Section::posv },
     { "ppcon",              test_ppcon,     Section::posv },
     { "pbcon",              test_pbcon,     Section::posv },
@@ -240,6 +258,9 @@ std::vector< testsweeper::routines_t > routines = {
     { "getsls",             test_getsls,    Section::gels }, // tested via LAPACKE using gcc/MKL
     { "",                   nullptr,        Section::newline },
 
+    { "gels_batch",         test_gels_batch,    Section::gels },
+    { "",                   nullptr,        Section::newline },
+
     { "gglse",              test_gglse,     Section::gels }, // tested via LAPACKE using gcc/MKL
     { "ggglm",              test_ggglm,     Section::gels }, // tested via LAPACKE using gcc/MKL
     { "",                   nullptr,        Section::newline },
@@ -248,6 +269,9 @@ std::vector< testsweeper::routines_t > routines = {
     // QR, LQ, RQ, QL
     { "geqr",               test_geqr,      Section::qr }, // tested numerically
     { "geqrf",              test_geqrf,     Section::qr }, // tested numerically
+    { "geqrf_fixed",        test_geqrf_fixed, Section::qr }, // tested numerically
+    { "geqr_batch",         test_geqr_batch,  Section::qr }, // compared to geqr
+    { "geqrf_batch",        test_geqrf_batch, Section::qr }, // compared to geqrf
     { "gelqf",              test_gelqf,     Section::qr }, // tested numerically
     { "geqlf",              test_geqlf,     Section::qr }, // tested numerically
     { "gerqf",              test_gerqf,     Section::qr }, // tested numerically; R, Q are full sizeof(A), could be smaller
@@ -272,6 +296,8 @@ std::vector< testsweeper::routines_t > routines = {
     { "",                   nullptr,        Section::newline },
 
     //{ "unmqr",              test_unmqr,     Section::qr }, // TODO segfaults
+    { "unmqr_batch",        test_unmqr_batch, Section::qr }, // compared to unmqr
+    { "gemqr_batch",        test_gemqr_batch, Section::qr }, // compared to gemqr
     //{ "unmlq",              test_unmlq,     Section::qr },
     //{ "unmql",              test_unmql,     Section::qr },
     //{ "unmrq",              test_unmrq,     Section::qr },
@@ -298,6 +324,8 @@ std::vector< testsweeper::routines_t > routines = {
     { "hpev",               test_hpev,      Section::heev }, // tested via LAPACKE
     { "hbev",               test_hbev,      Section::heev }, // tested via LAPACKE
     { "sturm",              test_sturm,     Section::heev },
+    { "sturm_multi",        test_sturm_multi, Section::heev },
+    { "tridiag_bisect",     test_tridiag_bisect, Section::heev },
     { "",                   nullptr,        Section::newline },
 
     { "heevx",              test_heevx,     Section::heev }, // tested via LAPACKE
@@ -306,6 +334,7 @@ std::vector< testsweeper::routines_t > routines = {
     { "",                   nullptr,        Section::newline },
 
     { "heevd",              test_heevd,     Section::heev }, // tested via LAPACKE using gcc/MKL
+    { "heevd_batch",        test_heevd_batch,   Section::heev },
     { "hpevd",              test_hpevd,     Section::heev }, // tested via LAPACKE using gcc/MKL
     { "hbevd",              test_hbevd,     Section::heev }, // tested via LAPACKE using gcc/MKL
     { "",                   nullptr,        Section::newline },
@@ -382,10 +411,12 @@ std::vector< testsweeper::routines_t > routines = {
     // -----
     // driver: singular value decomposition
     { "gesvd",              test_gesvd,         Section::svd },
+    { "gesvd_batch",        test_gesvd_batch,   Section::svd },
     //{ "gesvd_2stage",       test_gesvd_2stage,  Section::svd }, // TODO No src
     { "",                   nullptr,            Section::newline },
 
     { "gesdd",              test_gesdd,         Section::svd },
+    { "gesdd_batch",        test_gesdd_batch,   Section::svd },
     //{ "gesdd_2stage",       test_gesdd_2stage,  Section::svd }, // TODO No src
     { "",                   nullptr,            Section::newline },
 
@@ -401,8 +432,20 @@ std::vector< testsweeper::routines_t > routines = {
     // auxiliary
     { "lacpy",              test_lacpy,     Section::aux },
     { "laed4",              test_laed4,     Section::aux },
+    { "laed4_all",          test_laed4_all, Section::aux },
+    { "laed4_all_native",   test_laed4_all_native, Section::aux },
     { "laset",              test_laset,     Section::aux },
     { "laswp",              test_laswp,     Section::aux },
+    { "ilp64",              test_ilp64,     Section::aux },
+    { "trace",              test_trace,     Section::aux },
+    { "stats",              test_stats,     Section::aux },
+    { "arena",              test_arena,     Section::aux },
+    { "dispatch",           test_dispatch,  Section::aux },
+    { "batching_executor",  test_batching_executor, Section::aux },
+    { "plan",               test_plan,      Section::aux },
+    { "pivot_int",          test_pivot_int, Section::aux },
+    { "work",               test_work,      Section::aux },
+    { "work_size_cache",    test_work_size_cache, Section::aux },
     { "",                   nullptr,        Section::newline },
 
     // auxiliary: Householder
@@ -516,6 +559,7 @@ Params::Params():
                 "matrix type: g=general, l=lower, u=upper, h=Hessenberg, z=band-general, b=band-lower, q=band-upper" ),
     factored  ( "factored",    11,    ParamType::List, lapack::Factored::NotFactored, lapack::char2factored, lapack::factored2char, lapack::factored2str, "f=Factored, n=NotFactored, e=Equilibrate" ),
     equed     ( "equed",   9,    ParamType::List, lapack::Equed::None, lapack::char2equed, lapack::equed2char, lapack::equed2str, "n=None, r=Row, c=Col, b=Both, y=Yes" ),
+    alloc     ( "alloc",  10,    ParamType::List, lapack::AllocPolicy::Default, lapack::char2alloc_policy, lapack::alloc_policy2char, lapack::alloc_policy2str, "workspace placement: d=default, h=huge pages, f=NUMA first touch, i=NUMA interleave" ),
 
     //          name,      w, p, type,            def,   min,     max, help
     dim       ( "dim",     6,    ParamType::List,          0, 1000000, "m by n by k dimensions" ),
@@ -528,6 +572,7 @@ Params::Params():
     ku        ( "ku",      6,    ParamType::List, 100,     0, 1000000, "upper bandwidth" ),
     nrhs      ( "nrhs",    6,    ParamType::List,  10,     0, 1000000, "number of right hand sides" ),
     nb        ( "nb",      4,    ParamType::List,  64,     0, 1000000, "block size" ),
+    batch     ( "batch",   6,    ParamType::List, 100,     0, 10000000, "number of problems in batch routines" ),
     vl        ( "vl",      7, 2, ParamType::List, -inf, -inf,     inf, "lower bound of eigen/singular values to find" ),
     vu        ( "vu",      7, 2, ParamType::List,  inf, -inf,     inf, "upper bound of eigen/singular values to find" ),
 
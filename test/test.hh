@@ -8,6 +8,7 @@
 
 #include "testsweeper.hh"
 #include "lapack/util.hh"
+#include "lapack/allocator.hh"
 #include "matrix_params.hh"
 #include "matrix_generator.hh"
 
@@ -74,6 +75,7 @@ public:
     testsweeper::ParamEnum< lapack::MatrixType > matrixtype;
     testsweeper::ParamEnum< lapack::Factored >  factored;
     testsweeper::ParamEnum< lapack::Equed >     equed;
+    testsweeper::ParamEnum< lapack::AllocPolicy > alloc;  // gesdd, heevd
 
     testsweeper::ParamInt3   dim;
     testsweeper::ParamInt    i;
@@ -85,6 +87,7 @@ public:
     testsweeper::ParamInt    ku;
     testsweeper::ParamInt    nrhs;
     testsweeper::ParamInt    nb;
+    testsweeper::ParamInt    batch;
     testsweeper::ParamDouble vl;
     testsweeper::ParamDouble vu;
     testsweeper::ParamInt    il;
@@ -178,6 +181,11 @@ void require_( bool cond, const char* condstr, const char* file, int line )
 void test_gesv  ( Params& params, bool run );
 void test_gesvx ( Params& params, bool run );
 void test_getrf ( Params& params, bool run );
+void test_getrf_batch( Params& params, bool run );
+void test_getrf_vbatch( Params& params, bool run );
+void test_getrf_compact( Params& params, bool run );
+void test_getrf_fixed( Params& params, bool run );
+void test_getrf_recursive( Params& params, bool run );
 void test_getri ( Params& params, bool run );
 void test_getrs ( Params& params, bool run );
 void test_gecon ( Params& params, bool run );
@@ -188,6 +196,7 @@ void test_geequ ( Params& params, bool run );
 void test_gbsv  ( Params& params, bool run );
 void test_gbsvx ( Params& params, bool run );
 void test_gbtrf ( Params& params, bool run );
+void test_gbtrf_batch( Params& params, bool run );
 void test_gbtrs ( Params& params, bool run );
 void test_gbcon ( Params& params, bool run );
 void test_gbrfs ( Params& params, bool run );
@@ -195,6 +204,7 @@ void test_gbequ ( Params& params, bool run );
 
 // LU, tridiagonal
 void test_gtsv  ( Params& params, bool run );
+void test_gtsv_batch( Params& params, bool run );
 void test_gtsvx ( Params& params, bool run );
 void test_gttrf ( Params& params, bool run );
 void test_gttrs ( Params& params, bool run );
@@ -204,9 +214,15 @@ void test_gtequ ( Params& params, bool run );
 
 // Cholesky
 void test_posv  ( Params& params, bool run );
+void test_posv_batch( Params& params, bool run );
 void test_posvx ( Params& params, bool run );
 void test_potrf ( Params& params, bool run );
+void test_potrf_batch( Params& params, bool run );
+void test_potrf_compact( Params& params, bool run );
+void test_potrf_fixed( Params& params, bool run );
+void test_potrf_recursive( Params& params, bool run );
 void test_potri ( Params& params, bool run );
+void test_potri_batch( Params& params, bool run );
 void test_potrs ( Params& params, bool run );
 void test_pocon ( Params& params, bool run );
 void test_porfs ( Params& params, bool run );
@@ -231,6 +247,7 @@ void test_pbequ ( Params& params, bool run );
 
 // Cholesky, tridiagonal
 void test_ptsv  ( Params& params, bool run );
+void test_ptsv_batch( Params& params, bool run );
 void test_pttrf ( Params& params, bool run );
 void test_pttrs ( Params& params, bool run );
 void test_ptcon ( Params& params, bool run );
@@ -294,6 +311,7 @@ void test_hprfs ( Params& params, bool run );
 
 // least squares
 void test_gels  ( Params& params, bool run );
+void test_gels_batch( Params& params, bool run );
 void test_gelsy ( Params& params, bool run );
 void test_gelsd ( Params& params, bool run );
 void test_gelss ( Params& params, bool run );
@@ -304,6 +322,9 @@ void test_ggglm ( Params& params, bool run );
 // QR, LQ, QL, RQ
 void test_geqr  ( Params& params, bool run );
 void test_geqrf ( Params& params, bool run );
+void test_geqrf_fixed( Params& params, bool run );
+void test_geqr_batch ( Params& params, bool run );
+void test_geqrf_batch( Params& params, bool run );
 void test_gelqf ( Params& params, bool run );
 void test_geqlf ( Params& params, bool run );
 void test_gerqf ( Params& params, bool run );
@@ -322,6 +343,8 @@ void test_orhr_col( Params& params, bool run );
 void test_unhr_col( Params& params, bool run );
 
 void test_unmqr ( Params& params, bool run );
+void test_unmqr_batch( Params& params, bool run );
+void test_gemqr_batch( Params& params, bool run );
 void test_unmlq ( Params& params, bool run );
 void test_unmql ( Params& params, bool run );
 void test_unmrq ( Params& params, bool run );
@@ -342,9 +365,12 @@ void test_tprfb ( Params& params, bool run );
 void test_heev  ( Params& params, bool run );
 void test_heevx ( Params& params, bool run );
 void test_heevd ( Params& params, bool run );
+void test_heevd_batch( Params& params, bool run );
 void test_heevr ( Params& params, bool run );
 void test_hetrd ( Params& params, bool run );
 void test_sturm ( Params& params, bool run );
+void test_sturm_multi ( Params& params, bool run );
+void test_tridiag_bisect ( Params& params, bool run );
 void test_ungtr ( Params& params, bool run );
 void test_unmtr ( Params& params, bool run );
 
@@ -407,7 +433,9 @@ void test_ggesx ( Params& params, bool run );
 
 // SVD
 void test_gesvd ( Params& params, bool run );
+void test_gesvd_batch( Params& params, bool run );
 void test_gesdd ( Params& params, bool run );
+void test_gesdd_batch( Params& params, bool run );
 void test_gesvdx( Params& params, bool run );
 void test_gesvd_2stage ( Params& params, bool run );
 void test_gesdd_2stage ( Params& params, bool run );
@@ -418,8 +446,20 @@ void test_gesvj ( Params& params, bool run );
 // auxiliary
 void test_lacpy ( Params& params, bool run );
 void test_laed4 ( Params& params, bool run );
+void test_laed4_all ( Params& params, bool run );
+void test_laed4_all_native ( Params& params, bool run );
 void test_laset ( Params& params, bool run );
 void test_laswp ( Params& params, bool run );
+void test_ilp64 ( Params& params, bool run );
+void test_trace ( Params& params, bool run );
+void test_stats ( Params& params, bool run );
+void test_arena ( Params& params, bool run );
+void test_dispatch ( Params& params, bool run );
+void test_batching_executor ( Params& params, bool run );
+void test_plan  ( Params& params, bool run );
+void test_pivot_int ( Params& params, bool run );
+void test_work  ( Params& params, bool run );
+void test_work_size_cache ( Params& params, bool run );
 
 // auxiliary - Householder
 void test_larfg ( Params& params, bool run );
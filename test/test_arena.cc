@@ -0,0 +1,214 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "error.hh"
+
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Checks the per-thread workspace arena, using heevd, which allocates work,
+// rwork (complex only), and iwork:
+// - with the arena disabled, set_arena_limit( 0 ), no buffer is allocated;
+//   if LAPACKPP_ARENA_LIMIT is 0, the arena is initially disabled;
+// - the first call allocates a buffer for work, and the rest goes to the
+//   heap; the second call grows the buffer to the high-water mark, enough
+//   for all three arrays; the third call reuses it unchanged;
+// - lowering the limit frees the buffer after the next call, which then
+//   stays within the limit, and setting it to 0 frees it;
+// - many threads, each with its own arena, compute the same results.
+// In every case, W and Z must match the results with the arena disabled.
+template< typename scalar_t >
+void test_arena_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+    using lapack::Job;
+    using lapack::Uplo;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // limit from $LAPACKPP_ARENA_LIMIT, before this test changes it
+    static const size_t env_limit = lapack::get_arena_limit();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    std::vector< scalar_t > A( lda * lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A.size(), A.data() );
+    // A = (A + A^H)/2
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < j; ++i) {
+            scalar_t a = (A[ i + j*lda ] + conj( A[ j + i*lda ] )) / real_t( 2 );
+            A[ i + j*lda ] = a;
+            A[ j + i*lda ] = conj( a );
+        }
+        A[ j + j*lda ] = real( A[ j + j*lda ] );
+    }
+
+    auto run_heevd = [&]( std::vector< scalar_t >& Z, std::vector< real_t >& W ) {
+        Z = A;
+        W.resize( lda );
+        lapack::heevd( Job::Vec, Uplo::Lower, n, Z.data(), lda, W.data() );
+    };
+
+    size_t limit_save = lapack::get_arena_limit();
+    bool okay = true;
+    auto require = [&]( bool cond, const char* msg ) {
+        if (! cond) {
+            fprintf( stderr, "arena: %s\n", msg );
+            okay = false;
+        }
+    };
+
+    // ---------- reference with arena disabled
+    const char* env = std::getenv( "LAPACKPP_ARENA_LIMIT" );
+    if (env != nullptr && std::strtoull( env, nullptr, 10 ) == 0)
+        require( env_limit == 0, "LAPACKPP_ARENA_LIMIT=0 did not disable arena" );
+
+    std::vector< scalar_t > Zref, Z;
+    std::vector< real_t > Wref, W;
+    lapack::set_arena_limit( 0 );
+    lapack::release_arena();
+    run_heevd( Zref, Wref );
+    require( lapack::get_arena_capacity() == 0,
+             "set_arena_limit( 0 ) did not disable arena" );
+
+    // Relative error, or absolute error if the reference is zero (n = 0).
+    auto diff = [&]( auto& x, auto& xref ) {
+        real_t err = rel_error( x, xref );
+        if (std::isnan( err ))
+            err = abs_error( x, xref );
+        return err;
+    };
+    real_t error = 0;
+    auto check = [&]() {
+        error = blas::max( error, diff( W, Wref ), diff( Z, Zref ) );
+    };
+
+    // Sizes of the heevd arrays, each rounded up to the arena's 64-byte
+    // alignment; lrwork is 0 for real.
+    int64_t lwork, lrwork, liwork;
+    lapack::heevd_work_size( Job::Vec, Uplo::Lower, n, A.data(), lda,
+                             Wref.data(), &lwork, &lrwork, &liwork );
+    auto round64 = []( size_t bytes ) { return (bytes + 63) / 64 * 64; };
+    size_t work_bytes  = round64( lwork * sizeof(scalar_t) );
+    size_t total_bytes = work_bytes
+                       + round64( lrwork * sizeof(real_t) )
+                       + round64( liwork * sizeof(lapack_int) );
+
+    // ---------- growth and reuse
+    double time = testsweeper::get_wtime();
+    lapack::set_arena_limit( size_t( 1 ) << 30 );
+    run_heevd( Z, W );
+    check();
+    size_t capacity1 = lapack::get_arena_capacity();
+    require( capacity1 >= work_bytes && capacity1 < total_bytes,
+             "first call did not allocate buffer for work only" );
+
+    run_heevd( Z, W );
+    check();
+    size_t capacity2 = lapack::get_arena_capacity();
+    require( capacity2 >= total_bytes,
+             "second call did not grow buffer to high-water mark" );
+
+    run_heevd( Z, W );
+    check();
+    require( lapack::get_arena_capacity() == capacity2,
+             "third call did not reuse buffer" );
+
+    // ---------- lowering the limit shrinks the arena; 0 frees it
+    size_t lower = capacity2 / 2;
+    lapack::set_arena_limit( lower );
+    run_heevd( Z, W );
+    check();
+    require( lapack::get_arena_capacity() <= lower,
+             "lowering limit did not shrink buffer" );
+    run_heevd( Z, W );
+    check();
+    require( lapack::get_arena_capacity() <= lower
+             && (lapack::get_arena_capacity() > 0 || work_bytes > lower),
+             "buffer not reallocated within lowered limit" );
+
+    lapack::set_arena_limit( 0 );
+    run_heevd( Z, W );
+    check();
+    require( lapack::get_arena_capacity() == 0,
+             "set_arena_limit( 0 ) did not free buffer" );
+
+    // ---------- many threads, each with its own arena
+    lapack::set_arena_limit( size_t( 1 ) << 30 );
+    int nthreads = 8;
+    std::vector< real_t > errors( nthreads, 0 );
+    std::vector< size_t > capacities( nthreads, 0 );
+    std::vector< std::thread > threads;
+    for (int t = 0; t < nthreads; ++t) {
+        threads.push_back( std::thread( [&, t]() {
+            std::vector< scalar_t > Zt;
+            std::vector< real_t > Wt;
+            for (int iter = 0; iter < 3; ++iter) {
+                run_heevd( Zt, Wt );
+                errors[ t ] = blas::max( errors[ t ], diff( Wt, Wref ),
+                                         diff( Zt, Zref ) );
+            }
+            capacities[ t ] = lapack::get_arena_capacity();
+        } ) );
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+    for (int t = 0; t < nthreads; ++t) {
+        error = blas::max( error, errors[ t ] );
+        require( capacities[ t ] >= total_bytes,
+                 "thread did not use its own arena" );
+    }
+
+    lapack::set_arena_limit( limit_save );
+    lapack::release_arena();
+
+    params.error() = error;
+    params.okay() = (okay && error < tol);
+}
+
+// -----------------------------------------------------------------------------
+void test_arena( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_arena_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_arena_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_arena_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_arena_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -0,0 +1,360 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/batching_executor.hh"
+#include "error.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Returns true if every future is ready within timeout.
+template <typename T>
+bool all_ready(
+    std::vector< std::future< T > >& futures,
+    std::chrono::milliseconds timeout )
+{
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    for (auto& future : futures) {
+        if (future.wait_until( deadline ) != std::future_status::ready)
+            return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Returns true if no future is ready after waiting timeout.
+template <typename T>
+bool none_ready(
+    std::vector< std::future< T > >& futures,
+    std::chrono::milliseconds timeout )
+{
+    std::this_thread::sleep_for( timeout );
+    for (auto& future : futures) {
+        if (future.wait_for( std::chrono::seconds( 0 ) )
+            == std::future_status::ready)
+            return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Tests BatchingExecutor. Times getrf, potrf, gels, and heevd requests
+// submitted concurrently from several threads, batch of each (time),
+// compared to calling the routines one at a time (ref_time). The error is
+// the max difference from the unbatched results, relative for the
+// factors, solutions, and eigenvalues, and 1 - |v^H v_ref| for the
+// eigenvectors. Also checks that a group is solved when it reaches
+// max_batch but not before, when max_delay expires, and when the executor
+// is destroyed, and that invalid arguments throw from the submit call.
+template< typename scalar_t >
+void test_batching_executor_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+    using std::chrono::milliseconds;
+
+    // constants
+    const scalar_t zero = 0;
+    const milliseconds timeout( 10000 );
+    const std::chrono::hours forever( 1 );
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // getrf and gels use the m-by-n A; potrf and heevd use the n-by-n
+    // Hermitian positive definite H.
+    int64_t lda = blas::max( 1, m );
+    int64_t ldh = blas::max( 1, n );
+    int64_t ldb = blas::max( 1, m, n );
+    int64_t strideA = lda * n;
+    int64_t strideH = ldh * n;
+    int64_t strideB = ldb * nrhs;
+    int64_t min_mn = blas::min( m, n );
+    int64_t strideP = blas::max( 1, min_mn );
+
+    std::vector< scalar_t > A( strideA * batch );
+    std::vector< scalar_t > H( strideH * batch );
+    std::vector< scalar_t > B( strideB * batch );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A.size(), &A[0] );
+    lapack::larnv( idist, iseed, H.size(), &H[0] );
+    lapack::larnv( idist, iseed, B.size(), &B[0] );
+    for (int64_t i = 0; i < batch; ++i) {
+        // H = (H + H^H)/2 + n I, which is diagonally dominant
+        scalar_t* Hi = &H[ i*strideH ];
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t k = 0; k < j; ++k) {
+                scalar_t h = (Hi[ k + j*ldh ] + conj( Hi[ j + k*ldh ] )) / real_t( 2 );
+                Hi[ k + j*ldh ] = h;
+                Hi[ j + k*ldh ] = conj( h );
+            }
+            Hi[ j + j*ldh ] = real( Hi[ j + j*ldh ] ) + n;
+        }
+    }
+
+    std::vector< scalar_t > LU_tst = A, LU_ref = A;
+    std::vector< scalar_t > L_tst = H, L_ref = H;
+    std::vector< scalar_t > QR_tst = A, QR_ref = A;
+    std::vector< scalar_t > X_tst = B, X_ref = B;
+    std::vector< scalar_t > Z_tst = H, Z_ref = H;
+    std::vector< real_t > W_tst( n * batch ), W_ref( n * batch );
+    std::vector< int64_t > ipiv_tst( strideP * batch );
+    std::vector< int64_t > ipiv_ref( strideP * batch );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "m=%5lld, n=%5lld, nrhs=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( nrhs ), llong( batch ) );
+    }
+
+    // test error exits: the submit call throws
+    if (params.error_exit() == 'y') {
+        lapack::BatchingExecutor executor;
+        assert_throw( lapack::BatchingExecutor( 0 ), lapack::Error );
+        assert_throw( executor.getrf( -1, n, &LU_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( executor.getrf( m, n, &LU_tst[0], m-1, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( executor.potrf( lapack::Uplo::Lower, -1, &L_tst[0], ldh ), lapack::Error );
+        assert_throw( executor.potrf( lapack::Uplo::General, n, &L_tst[0], ldh ), lapack::Error );
+        assert_throw( executor.gels( lapack::Op::NoTrans, m, n, -1, &QR_tst[0], lda, &X_tst[0], ldb ), lapack::Error );
+        assert_throw( executor.gels( lapack::Op::NoTrans, m, n, nrhs, &QR_tst[0], lda, &X_tst[0], ldb-1 ), lapack::Error );
+        assert_throw( executor.heevd( lapack::Job::AllVec, lapack::Uplo::Lower, n, &Z_tst[0], ldh, &W_tst[0] ), lapack::Error );
+        assert_throw( executor.heevd( lapack::Job::Vec, lapack::Uplo::Lower, n, &Z_tst[0], n-1, &W_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    // Each thread submits its share of the batch for all four routines,
+    // interleaved, then waits for its futures.
+    int nthreads = 4;
+    std::vector< int64_t > nonzero( nthreads, 0 );
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    {
+        lapack::BatchingExecutor executor( 16 );
+        std::vector< std::thread > threads;
+        for (int t = 0; t < nthreads; ++t) {
+            threads.push_back( std::thread( [&, t]() {
+                std::vector< std::future< int64_t > > infos;
+                for (int64_t i = t; i < batch; i += nthreads) {
+                    infos.push_back( executor.getrf(
+                        m, n, &LU_tst[ i*strideA ], lda, &ipiv_tst[ i*strideP ] ) );
+                    infos.push_back( executor.potrf(
+                        lapack::Uplo::Lower, n, &L_tst[ i*strideH ], ldh ) );
+                    infos.push_back( executor.gels(
+                        lapack::Op::NoTrans, m, n, nrhs,
+                        &QR_tst[ i*strideA ], lda, &X_tst[ i*strideB ], ldb ) );
+                    infos.push_back( executor.heevd(
+                        lapack::Job::Vec, lapack::Uplo::Lower, n,
+                        &Z_tst[ i*strideH ], ldh, &W_tst[ i*n ] ) );
+                }
+                for (auto& info : infos) {
+                    if (info.get() != 0)
+                        ++nonzero[ t ];
+                }
+            } ) );
+        }
+        for (auto& thread : threads)
+            thread.join();
+    }
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    int64_t nonzero_sum = 0;
+    for (int t = 0; t < nthreads; ++t)
+        nonzero_sum += nonzero[ t ];
+    if (nonzero_sum > 0) {
+        fprintf( stderr, "BatchingExecutor returned error for %lld problems\n",
+                 llong( nonzero_sum ) );
+    }
+
+    // ---------- check flushing, using getrf on copies of the first problem
+    std::string failed;
+    if (batch >= 1) {
+        int64_t max_batch = 4;
+        std::vector< scalar_t > LU( strideA * max_batch );
+        std::vector< int64_t > ipiv( strideP * max_batch );
+        auto reset = [&]() {
+            for (int64_t i = 0; i < max_batch; ++i)
+                std::copy( &A[ 0 ], &A[ strideA ], &LU[ i*strideA ] );
+        };
+        std::vector< std::future< int64_t > > infos;
+
+        // solved when the group reaches max_batch, but not before
+        {
+            reset();
+            lapack::BatchingExecutor executor( max_batch, forever );
+            for (int64_t i = 0; i < max_batch - 1; ++i) {
+                infos.push_back( executor.getrf(
+                    m, n, &LU[ i*strideA ], lda, &ipiv[ i*strideP ] ) );
+            }
+            if (! none_ready( infos, milliseconds( 50 ) ))
+                failed += " solved before max_batch;";
+            int64_t i = max_batch - 1;
+            infos.push_back( executor.getrf(
+                m, n, &LU[ i*strideA ], lda, &ipiv[ i*strideP ] ) );
+            if (! all_ready( infos, timeout ))
+                failed += " not solved at max_batch;";
+            infos.clear();
+        }
+
+        // solved when max_delay expires
+        {
+            reset();
+            auto max_delay = milliseconds( 20 );
+            lapack::BatchingExecutor executor( max_batch, max_delay );
+            auto start = std::chrono::steady_clock::now();
+            infos.push_back( executor.getrf( m, n, &LU[ 0 ], lda, &ipiv[ 0 ] ) );
+            if (! all_ready( infos, timeout ))
+                failed += " not solved at max_delay;";
+            else if (std::chrono::steady_clock::now() - start < max_delay)
+                failed += " solved before max_delay;";
+            infos.clear();
+        }
+
+        // solved when the executor is destroyed
+        {
+            reset();
+            {
+                lapack::BatchingExecutor executor( max_batch, forever );
+                for (int64_t i = 0; i < max_batch - 1; ++i) {
+                    infos.push_back( executor.getrf(
+                        m, n, &LU[ i*strideA ], lda, &ipiv[ i*strideP ] ) );
+                }
+            }
+            if (! all_ready( infos, milliseconds( 0 ) ))
+                failed += " not solved at destruction;";
+            infos.clear();
+        }
+
+        // each flush must give the unbatched result
+        std::vector< scalar_t > LU0( &A[ 0 ], &A[ strideA ] );
+        std::vector< int64_t > ipiv0( strideP );
+        lapack::getrf( m, n, &LU0[ 0 ], lda, &ipiv0[ 0 ] );
+        for (int64_t i = 0; i < max_batch - 1; ++i) {
+            std::vector< scalar_t > LUi( &LU[ i*strideA ], &LU[ (i+1)*strideA ] );
+            if ((min_mn > 0 && rel_error( LUi, LU0 ) > tol)
+                || ! std::equal( ipiv0.begin(), ipiv0.begin() + min_mn,
+                                 ipiv.begin() + i*strideP )) {
+                failed += " wrong flushed result;";
+                break;
+            }
+        }
+    }
+    if (! failed.empty()) {
+        fprintf( stderr, "BatchingExecutor:%s\n", failed.c_str() );
+        params.msg() = "flush failed";
+    }
+
+    // ---------- run reference
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    int64_t nonzero_ref = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        int64_t info[4];
+        info[0] = lapack::getrf( m, n, &LU_ref[ i*strideA ], lda, &ipiv_ref[ i*strideP ] );
+        info[1] = lapack::potrf( lapack::Uplo::Lower, n, &L_ref[ i*strideH ], ldh );
+        info[2] = lapack::gels( lapack::Op::NoTrans, m, n, nrhs,
+                                &QR_ref[ i*strideA ], lda, &X_ref[ i*strideB ], ldb );
+        info[3] = lapack::heevd( lapack::Job::Vec, lapack::Uplo::Lower, n,
+                                 &Z_ref[ i*strideH ], ldh, &W_ref[ i*n ] );
+        for (int j = 0; j < 4; ++j) {
+            if (info[ j ] != 0)
+                ++nonzero_ref;
+        }
+    }
+    time = testsweeper::get_wtime() - time;
+    params.ref_time() = time;
+
+    // ---------- check error compared to reference
+    // only the first min(m, n) pivots of each problem are set
+    real_t error = 0;
+    if (nonzero_sum != nonzero_ref) {
+        error = 1;
+    }
+    for (int64_t i = 0; i < batch; ++i) {
+        auto ipiv_i = ipiv_tst.begin() + i*strideP;
+        if (! std::equal( ipiv_i, ipiv_i + min_mn,
+                          ipiv_ref.begin() + i*strideP )) {
+            error = 1;
+        }
+    }
+    // only the lower triangle of L is referenced
+    for (int64_t i = 0; i < batch; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t k = 0; k < j; ++k) {
+                L_tst[ k + j*ldh + i*strideH ] = zero;
+                L_ref[ k + j*ldh + i*strideH ] = zero;
+            }
+        }
+    }
+    if (min_mn > 0) {
+        error = blas::max( error, rel_error( LU_tst, LU_ref ) );
+        error = blas::max( error, rel_error( X_tst,  X_ref  ) );
+    }
+    if (n > 0) {
+        error = blas::max( error, rel_error( L_tst,  L_ref  ) );
+        error = blas::max( error, rel_error( W_tst,  W_ref  ) );
+    }
+    // eigenvectors are unique up to a unit scalar
+    for (int64_t i = 0; i < batch; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            scalar_t const* z_tst = &Z_tst[ j*ldh + i*strideH ];
+            scalar_t const* z_ref = &Z_ref[ j*ldh + i*strideH ];
+            scalar_t dot = blas::dot( n, z_tst, 1, z_ref, 1 );
+            error = blas::max( error, std::abs( 1 - std::abs( dot ) ) );
+        }
+    }
+    params.error() = error;
+    params.okay() = (error < tol && failed.empty());
+}
+
+// -----------------------------------------------------------------------------
+void test_batching_executor( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_batching_executor_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_batching_executor_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_batching_executor_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_batching_executor_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -0,0 +1,274 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/fortran.h"
+#include "error.hh"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifdef LAPACK_HAVE_DISPATCH
+    #include <dlfcn.h>
+    #include <unistd.h>
+
+// -----------------------------------------------------------------------------
+// Returns the path of the shared library containing func,
+// or an empty string if it is not in a loadable shared library.
+static std::string library_path( void* func )
+{
+    Dl_info info;
+    if (dladdr( func, &info ) == 0 || info.dli_fname == nullptr)
+        return "";
+    void* handle = dlopen( info.dli_fname, RTLD_NOW | RTLD_LOCAL );
+    if (handle == nullptr)
+        return "";  // e.g., statically linked into the tester
+    dlclose( handle );
+    return info.dli_fname;
+}
+
+// -----------------------------------------------------------------------------
+// Writes text to a new temporary file and returns its name.
+static std::string write_table( std::string const& text )
+{
+    char filename[] = "/tmp/lapackpp_dispatch_XXXXXX";
+    int fd = mkstemp( filename );
+    if (fd < 0)
+        throw std::runtime_error( "cannot create temporary dispatch table" );
+    FILE* file = fdopen( fd, "w" );
+    fputs( text.c_str(), file );
+    fclose( file );
+    return filename;
+}
+
+#endif  // LAPACK_HAVE_DISPATCH
+
+// -----------------------------------------------------------------------------
+// Checks the runtime dispatch table, using potrf and getrf. Two backends:
+// "linked", the shared library with the linked LAPACK, if there is one,
+// and "libc", which lacks every LAPACK routine. Checks:
+// - dispatch_backend: the first rule matching the routine, or `*`, and
+//   n <= max_n wins, so later rules with smaller max_n are shadowed;
+//   a backend lacking the routine, or no matching rule, gives "default";
+// - potrf and getrf routed to a backend, or to the default after a
+//   missing symbol, match the results without a table;
+// - reloading replaces the table, an empty name clears it, and
+//   a malformed table throws, keeping the current table.
+// Without use_dispatch, load_dispatch_table must throw.
+template< typename scalar_t >
+void test_dispatch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+    using lapack::Uplo;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    if (! run)
+        return;
+
+    bool okay = true;
+    auto require = [&]( bool cond, std::string const& msg ) {
+        if (! cond) {
+            fprintf( stderr, "dispatch: %s\n", msg.c_str() );
+            okay = false;
+        }
+    };
+    real_t error = 0;
+
+    #ifdef LAPACK_HAVE_DISPATCH
+        // ---------- setup
+        char prefix = blas::is_complex< scalar_t >::value
+                    ? (sizeof(real_t) == sizeof(float) ? 'c' : 'z')
+                    : (sizeof(real_t) == sizeof(float) ? 's' : 'd');
+        std::string potrf = prefix + std::string( "potrf" );
+        std::string getrf = prefix + std::string( "getrf" );
+
+        std::string libc = library_path( (void*) &fputs );
+        std::string linked = library_path( (void*) &LAPACK_dpotrf );
+        if (linked.empty()) {
+            // Linked LAPACK is static; route "linked" rules to libc too.
+            linked = libc;
+            params.msg() = "static LAPACK; checked fallback only";
+        }
+        std::string expect_linked = linked == libc ? "default" : "linked";
+
+        int64_t lda = blas::max( 1, n );
+        std::vector< scalar_t > A( lda * n ), H( lda * n );
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed, A.size(), A.data() );
+        // H = (A + A^H)/2 + n I is Hermitian positive definite.
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < j; ++i) {
+                scalar_t h = (A[ i + j*lda ] + conj( A[ j + i*lda ] )) / real_t( 2 );
+                H[ i + j*lda ] = h;
+                H[ j + i*lda ] = conj( h );
+            }
+            H[ j + j*lda ] = real( A[ j + j*lda ] ) + real_t( n );
+        }
+
+        // Factors H with potrf and A with getrf.
+        std::vector< scalar_t > L, LU;
+        std::vector< int64_t > ipiv( lda );
+        auto factor = [&]() {
+            L = H;
+            LU = A;
+            int64_t info = lapack::potrf( Uplo::Lower, n, L.data(), lda );
+            require( info == 0, "potrf failed" );
+            info = lapack::getrf( n, n, LU.data(), lda, ipiv.data() );
+            require( info == 0, "getrf failed" );
+        };
+
+        // Relative error, or absolute error if the reference is zero (n = 0).
+        auto diff = [&]( auto& x, auto& xref ) {
+            real_t err = rel_error( x, xref );
+            if (std::isnan( err ))
+                err = abs_error( x, xref );
+            return err;
+        };
+
+        // ---------- reference, without a table
+        lapack::load_dispatch_table( "" );
+        factor();
+        std::vector< scalar_t > Lref = L, LUref = LU;
+        std::vector< int64_t > ipiv_ref = ipiv;
+        auto check = [&]() {
+            factor();
+            error = blas::max( error, diff( L, Lref ), diff( LU, LUref ) );
+            require( ipiv == ipiv_ref, "getrf pivots differ" );
+        };
+
+        auto expect = [&]( std::string const& routine, int64_t nn,
+                           std::string const& backend ) {
+            std::string got = lapack::dispatch_backend( routine, nn );
+            require( got == backend,
+                     routine + " n " + std::to_string( nn ) + ": backend "
+                     + got + ", expected " + backend );
+        };
+
+        double time = testsweeper::get_wtime();
+
+        // ---------- rule matching and *
+        std::string table1 = write_table(
+            "# test table\n"
+            "backend  libc    " + libc   + "\n"
+            "backend  linked  " + linked + "\n"
+            + potrf + "  100  linked\n"
+            + potrf + "  200  libc    # lacks potrf\n"
+            + potrf + "   50  libc    # shadowed by the first rule\n"
+            "*        300  linked\n"
+            "*        *    default\n" );
+        lapack::load_dispatch_table( table1 );
+        expect( potrf,   0, expect_linked );
+        expect( potrf,  50, expect_linked );
+        expect( potrf, 100, expect_linked );
+        expect( potrf, 101, "default" );
+        expect( potrf, 200, "default" );
+        expect( potrf, 201, expect_linked );
+        expect( potrf, 300, expect_linked );
+        expect( potrf, 301, "default" );
+        expect( getrf,   1, expect_linked );
+        expect( getrf, 300, expect_linked );
+        expect( getrf, 301, "default" );
+        expect( "xyzzy", 1, "default" );  // not dispatched
+        check();
+
+        // ---------- reload; missing symbols fall back to the default
+        std::string table2 = write_table(
+            "backend  libc  " + libc + "\n"
+            "*        *     libc\n" );
+        lapack::load_dispatch_table( table2 );
+        expect( potrf, 1, "default" );
+        expect( getrf, 1000000, "default" );
+        check();
+
+        // ---------- malformed tables throw and keep the current table
+        std::string table3 = write_table(
+            "backend  linked  " + linked + "\n"
+            "*        *\n" );
+        std::string table4 = write_table(
+            "*        *     nosuch\n" );
+        for (auto const& bad : { table3, table4 }) {
+            bool thrown = false;
+            try {
+                lapack::load_dispatch_table( bad );
+            }
+            catch (lapack::Error const&) {
+                thrown = true;
+            }
+            require( thrown, "malformed table did not throw" );
+        }
+        lapack::load_dispatch_table( table1 );
+        expect( potrf, 1, expect_linked );
+
+        // ---------- clear
+        lapack::load_dispatch_table( "" );
+        expect( potrf, 1, "default" );
+        check();
+
+        time = testsweeper::get_wtime() - time;
+        params.time() = time;
+
+        for (auto const& filename : { table1, table2, table3, table4 }) {
+            std::remove( filename.c_str() );
+        }
+
+        // restore table from $LAPACKPP_DISPATCH
+        const char* env = std::getenv( "LAPACKPP_DISPATCH" );
+        if (env != nullptr)
+            lapack::load_dispatch_table( env );
+    #else
+        bool thrown = false;
+        try {
+            lapack::load_dispatch_table( "" );
+        }
+        catch (lapack::Error const&) {
+            thrown = true;
+        }
+        require( thrown, "load_dispatch_table did not throw without dispatch" );
+        require( lapack::dispatch_backend( "dpotrf", 1 ) == "default",
+                 "backend is not default without dispatch" );
+        params.msg() = "no use_dispatch";
+    #endif
+
+    params.error() = error;
+    params.okay() = (okay && error < tol);
+}
+
+// -----------------------------------------------------------------------------
+void test_dispatch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_dispatch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_dispatch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_dispatch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_dispatch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -111,3 +111,208 @@ void test_gbtrf( Params& params, bool run )
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+// Batch mode: times the pointer-array gbtrf_batch (time, gflops) and the
+// strided gbtrf_batch (time2, gflops2). The reference is a loop calling
+// lapack::gbtrf for each problem. Gflop/s are for the whole batch.
+// Bands with kl, ku <= 4 use the native fixed-bandwidth kernels.
+template< typename scalar_t >
+void test_gbtrf_batch_work( Params& params, bool run )
+{
+    using blas::conj;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t kl = params.kl();
+    int64_t ku = params.ku();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.gflops2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t ldab = roundup( 2*kl+ku+1, align );
+    int64_t min_mn = blas::min( m, n );
+    int64_t strideAB = ldab * n;
+    int64_t stride_ipiv = min_mn;
+    size_t size_AB = (size_t) strideAB * batch;
+    size_t size_ipiv = (size_t) stride_ipiv * batch;
+
+    std::vector< scalar_t > AB_tst( size_AB );
+    std::vector< int64_t > ipiv_tst( size_ipiv );
+    std::vector< int64_t > info_tst( batch );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, AB_tst.size(), &AB_tst[0] );
+    std::vector< scalar_t > AB_str = AB_tst;
+    std::vector< scalar_t > AB_ref = AB_tst;
+    std::vector< int64_t > ipiv_str( size_ipiv );
+    std::vector< int64_t > info_str( batch );
+
+    // pointer-array arguments; one m, n, kl, ku, ldab for the whole batch
+    std::vector< int64_t > m_vec( 1, m ), n_vec( 1, n ),
+                           kl_vec( 1, kl ), ku_vec( 1, ku ), ldab_vec( 1, ldab );
+    std::vector< scalar_t* > AB_array( batch );
+    std::vector< int64_t* > ipiv_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        AB_array[ i ] = &AB_tst[ i*strideAB ];
+        ipiv_array[ i ] = &ipiv_tst[ i*stride_ipiv ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "AB m=%5lld, n=%5lld, kl=%5lld, ku=%5lld, ldab=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( kl ), llong( ku ),
+                llong( ldab ), llong( batch ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > neg( 1, -1 ), ldab_bad( 1, 2*kl+ku );
+        assert_throw( lapack::gbtrf_batch( neg, n_vec, kl_vec, ku_vec, AB_array, ldab_vec, ipiv_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gbtrf_batch( m_vec, n_vec, neg, ku_vec, AB_array, ldab_vec, ipiv_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gbtrf_batch( m_vec, n_vec, kl_vec, ku_vec, AB_array, ldab_bad, ipiv_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gbtrf_batch( m, n, kl, ku, &AB_str[0], ldab, strideAB-1, &ipiv_str[0], stride_ipiv, 2, &info_str[0] ), lapack::Error );
+        assert_throw( lapack::gbtrs_batch( lapack::Op( 0 ), n, kl, ku, 1, &AB_str[0], ldab, strideAB, &ipiv_str[0], stride_ipiv, &AB_str[0], n, n, 1, &info_str[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::gbtrf_batch( m_vec, n_vec, kl_vec, ku_vec, AB_array, ldab_vec,
+                         ipiv_array, batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::gbtrf( m, n, kl, ku );
+    params.gflops() = gflop / time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::gbtrf_batch( m, n, kl, ku, &AB_str[0], ldab, strideAB,
+                         &ipiv_str[0], stride_ipiv, batch, &info_str[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+    params.gflops2() = gflop / time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0 || info_str[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::gbtrf_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.check() == 'y' && m == n) {
+        // ---------- check error
+        // Max over the batch of relative backwards error
+        // ||b - op(A) x|| / (n * ||A|| * ||x||), solving with gbtrs_batch.
+        // Also, both variants must give the same factors.
+        int64_t nrhs = 1;
+        int64_t ldb = roundup( blas::max( 1, n ), align );
+        int64_t strideB = ldb * nrhs;
+        size_t size_B = (size_t) strideB * batch;
+        std::vector< scalar_t > B_tst( size_B );
+        std::vector< scalar_t > B_ref( size_B );
+        lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+        B_ref = B_tst;
+
+        lapack::gbtrs_batch(
+            trans, n, kl, ku, nrhs, &AB_tst[0], ldab, strideAB,
+            &ipiv_tst[0], stride_ipiv, &B_tst[0], ldb, strideB,
+            batch, &info_tst[0] );
+
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* ABi = &AB_ref[ i*strideAB ];
+            scalar_t* Xi = &B_tst[ i*strideB ];
+            scalar_t* Ri = &B_ref[ i*strideB ];
+            // A(r,c) is ABi[ kl + ku + r - c + c*ldab ]
+            for (int64_t c = 0; c < n; ++c) {
+                for (int64_t r = blas::max( 0, c-ku ); r < blas::min( n, c+kl+1 ); ++r) {
+                    scalar_t a = ABi[ kl + ku + r - c + c*ldab ];
+                    for (int64_t j = 0; j < nrhs; ++j) {
+                        if (trans == lapack::Op::NoTrans)
+                            Ri[ r + j*ldb ] -= a * Xi[ c + j*ldb ];
+                        else if (trans == lapack::Op::Trans)
+                            Ri[ c + j*ldb ] -= a * Xi[ r + j*ldb ];
+                        else
+                            Ri[ c + j*ldb ] -= conj( a ) * Xi[ r + j*ldb ];
+                    }
+                }
+            }
+
+            real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, Ri, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+            real_t Anorm = lapack::langb( lapack::Norm::One, n, kl, ku, &ABi[ kl ], ldab );
+            if (n > 0)
+                error_i /= (n * Anorm * Xnorm);
+            error = blas::max( error, error_i );
+        }
+        params.error() = error;
+        params.okay() = (error < tol
+                         && AB_str == AB_tst
+                         && ipiv_str == ipiv_tst);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< int64_t > ipiv_ref( blas::max( 1, min_mn ) );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::gbtrf( m, n, kl, ku, &AB_ref[ i*strideAB ], ldab,
+                           &ipiv_ref[0] );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gbtrf_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gbtrf_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gbtrf_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gbtrf_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gbtrf_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
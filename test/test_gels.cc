@@ -123,3 +123,173 @@ void test_gels( Params& params, bool run )
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+// Batch mode: times the pointer-array gels_batch (time) and the strided
+// gels_batch (time2). The reference is a loop calling lapack::gels for
+// each problem. The error is the max over the batch of the check_gels
+// errors.
+template< typename scalar_t >
+void test_gels_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.ref_time();
+    params.error2();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldb = roundup( blas::max( 1, m, n ), align );
+    int64_t strideA = lda * n;
+    int64_t strideB = ldb * nrhs;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_B = (size_t) strideB * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*strideA ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+
+    std::vector< scalar_t > A_str = A_tst;
+    std::vector< scalar_t > B_str = B_tst;
+    std::vector< scalar_t > A_ref = A_tst;
+    std::vector< scalar_t > B_ref = B_tst;
+    std::vector< int64_t > info_str( batch );
+
+    // pointer-array arguments; one trans, m, n, nrhs, lda, ldb for the batch
+    std::vector< lapack::Op > trans_vec( 1, trans );
+    std::vector< int64_t > m_vec( 1, m ), n_vec( 1, n ), nrhs_vec( 1, nrhs );
+    std::vector< int64_t > lda_vec( 1, lda ), ldb_vec( 1, ldb );
+    std::vector< scalar_t* > A_array( batch ), B_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = &A_tst[ i*strideA ];
+        B_array[ i ] = &B_tst[ i*strideB ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, nrhs=%5lld, lda=%5lld, ldb=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( nrhs ), llong( lda ), llong( ldb ),
+                llong( batch ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > neg( 1, -1 ), lda_bad( 1, m-1 );
+        assert_throw( lapack::gels_batch( trans_vec, neg, n_vec, nrhs_vec, A_array, lda_vec, B_array, ldb_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gels_batch( trans_vec, m_vec, neg, nrhs_vec, A_array, lda_vec, B_array, ldb_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gels_batch( trans_vec, m_vec, n_vec, nrhs_vec, A_array, lda_bad, B_array, ldb_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gels_batch( trans, m, n, nrhs, &A_str[0], lda, strideA-1, &B_str[0], ldb, strideB, 2, &info_str[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::gels_batch( trans_vec, m_vec, n_vec, nrhs_vec, A_array, lda_vec,
+                        B_array, ldb_vec, batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::gels_batch( trans, m, n, nrhs, &A_str[0], lda, strideA,
+                        &B_str[0], ldb, strideB, batch, &info_str[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0 || info_str[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::gels_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over the batch of the check_gels errors.
+        // Also, both variants must give the same solutions.
+        real_t error[2] = { 0, 0 };
+        for (int64_t i = 0; i < batch; ++i) {
+            real_t error_i[2];
+            check_gels( false, trans, m, n, nrhs,
+                        &A_ref[ i*strideA ], lda, // original A
+                        &B_tst[ i*strideB ], ldb, // X
+                        &B_ref[ i*strideB ], ldb, // original B
+                        error_i );
+            error[0] = blas::max( error[0], error_i[0] );
+            error[1] = blas::max( error[1], error_i[1] );
+        }
+        params.error()  = error[0];
+        params.error2() = error[1];
+        params.okay() = (error[0] < tol) && (error[1] < tol)
+                        && B_str == B_tst;
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::gels( trans, m, n, nrhs, &A_ref[ i*strideA ], lda,
+                          &B_ref[ i*strideB ], ldb );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gels_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gels_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gels_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gels_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gels_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
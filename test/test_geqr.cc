@@ -120,6 +120,307 @@ void test_geqr( Params& params, bool run )
     }
 }
 
+// -----------------------------------------------------------------------------
+// Times the strided geqr_batch (time, gflops). The reference is a loop
+// calling lapack::geqr for each problem. The error is the relative
+// difference in A and T from the reference.
+template< typename scalar_t >
+void test_geqr_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t strideA = lda * n;
+    size_t size_A = (size_t) strideA * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< int64_t > info_tst( batch );
+
+    // query for T size, the same for all problems
+    scalar_t qry_T[ 5 ];
+    int64_t info = lapack::geqr( m, n, &A_tst[0], lda, qry_T, -1 );
+    if (info != 0) {
+        fprintf( stderr, "lapack::geqr query returned error %lld\n", llong( info ) );
+    }
+    int64_t tsize = std::real( qry_T[0] );
+    int64_t strideT = tsize;
+    size_t size_T = (size_t) strideT * batch;
+
+    std::vector< scalar_t > T_tst( size_T );
+    std::vector< scalar_t > T_ref( size_T );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A_tst.size(), &A_tst[0] );
+    std::vector< scalar_t > A_ref = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, tsize=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( tsize ),
+                llong( batch ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::geqr_batch( -1, n, &A_tst[0], lda, strideA, &T_tst[0], tsize, strideT, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::geqr_batch( m, n, &A_tst[0], m-1, strideA, &T_tst[0], tsize, strideT, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::geqr_batch( m, n, &A_tst[0], lda, strideA, &T_tst[0], 4, strideT, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::geqr_batch( m, n, &A_tst[0], lda, strideA-1, &T_tst[0], tsize, strideT, 2, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::geqr_batch( m, n, &A_tst[0], lda, strideA, &T_tst[0], tsize, strideT,
+                        batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::geqr_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_i = lapack::geqr( m, n, &A_ref[ i*strideA ], lda,
+                                           &T_ref[ i*strideT ], tsize );
+            if (info_i != 0)
+                ++nonzero;
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+
+        // ---------- check error compared to reference
+        // Problems are independent, so each must match the single routine.
+        real_t error = rel_error( T_tst, T_ref );
+        if (blas::min( m, n ) > 0)
+            error += rel_error( A_tst, A_ref );
+        params.error() = error;
+        params.okay() = (error < tol) && (nonzero == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geqr_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_geqr_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geqr_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geqr_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geqr_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Times the strided gemqr_batch (time), applying Q_i from geqr of an
+// nq-by-k A_i to an m-by-n C_i, where nq = m for side = left and nq = n
+// for side = right. The reference is a loop calling lapack::gemqr for each
+// problem. The error is the relative difference in C from the reference.
+template< typename scalar_t >
+void test_gemqr_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Side side = params.side();
+    lapack::Op trans = params.trans();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // skip invalid or unimplemented options
+    int64_t nq = (side == lapack::Side::Left ? m : n);
+    if (k > nq) {
+        params.msg() = "skipping: requires k <= m (left) or k <= n (right)";
+        return;
+    }
+    if (blas::is_complex< scalar_t >::value
+        ? trans == lapack::Op::Trans
+        : trans == lapack::Op::ConjTrans) {
+        params.msg() = "skipping: requires trans = n or t (real), n or c (complex)";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, nq ), align );
+    int64_t ldc = roundup( blas::max( 1, m ), align );
+    int64_t strideA = lda * k;
+    int64_t strideC = ldc * n;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_C = (size_t) strideC * batch;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > C_tst( size_C );
+    std::vector< int64_t > info_tst( batch );
+
+    // query for T size, the same for all problems
+    scalar_t qry_T[ 5 ];
+    int64_t info = lapack::geqr( nq, k, &A[0], lda, qry_T, -1 );
+    if (info != 0) {
+        fprintf( stderr, "lapack::geqr query returned error %lld\n", llong( info ) );
+    }
+    int64_t tsize = std::real( qry_T[0] );
+    int64_t strideT = tsize;
+    std::vector< scalar_t > T( (size_t) strideT * batch );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A.size(), &A[0] );
+    lapack::larnv( idist, iseed, C_tst.size(), &C_tst[0] );
+    std::vector< scalar_t > C_ref = C_tst;
+
+    // factor each A_i = Q_i R_i
+    lapack::geqr_batch( nq, k, &A[0], lda, strideA, &T[0], tsize, strideT,
+                        batch, &info_tst[0] );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A nq=%5lld, k=%5lld, lda=%5lld, tsize=%5lld\n"
+                "C m=%5lld, n=%5lld, ldc=%5lld, batch=%5lld\n",
+                llong( nq ), llong( k ), llong( lda ), llong( tsize ),
+                llong( m ), llong( n ), llong( ldc ), llong( batch ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gemqr_batch( side, trans, -1, n, k, &A[0], lda, strideA, &T[0], tsize, strideT, &C_tst[0], ldc, strideC, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gemqr_batch( side, trans, m, n, nq+1, &A[0], lda, strideA, &T[0], tsize, strideT, &C_tst[0], ldc, strideC, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gemqr_batch( side, trans, m, n, k, &A[0], lda, strideA, &T[0], tsize, strideT, &C_tst[0], m-1, strideC, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gemqr_batch( side, trans, m, n, k, &A[0], lda, strideA, &T[0], tsize, strideT, &C_tst[0], ldc, strideC-1, 2, &info_tst[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::gemqr_batch( side, trans, m, n, k, &A[0], lda, strideA,
+                         &T[0], tsize, strideT, &C_tst[0], ldc, strideC,
+                         batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::gemqr_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_i = lapack::gemqr(
+                side, trans, m, n, k, &A[ i*strideA ], lda,
+                &T[ i*strideT ], tsize, &C_ref[ i*strideC ], ldc );
+            if (info_i != 0)
+                ++nonzero;
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        real_t error = 0;
+        if (m > 0 && n > 0)
+            error = rel_error( C_tst, C_ref );
+        params.error() = error;
+        params.okay() = (error < tol) && (nonzero == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gemqr_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gemqr_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gemqr_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gemqr_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gemqr_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
+
 #else
 
 // -----------------------------------------------------------------------------
@@ -129,4 +430,18 @@ void test_geqr( Params& params, bool run )
     exit(0);
 }
 
+// -----------------------------------------------------------------------------
+void test_geqr_batch( Params& params, bool run )
+{
+    fprintf( stderr, "geqr_batch requires LAPACK >= 3.7.0\n\n" );
+    exit(0);
+}
+
+// -----------------------------------------------------------------------------
+void test_gemqr_batch( Params& params, bool run )
+{
+    fprintf( stderr, "gemqr_batch requires LAPACK >= 3.7.0\n\n" );
+    exit(0);
+}
+
 #endif  // LAPACK >= 3.7.0
@@ -153,3 +153,550 @@ void test_geqrf( Params& params, bool run )
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+// Times lapack::fixed::geqrf< m, n > (time, gflops) over a batch of
+// matrices, one call per matrix. The reference is the same loop calling
+// lapack::geqrf. The error is the max over the batch of
+// ||A - QR|| / (n ||A||), applying Q to R with lapack::unmqr.
+template< typename scalar_t, int m, int n >
+void test_geqrf_fixed_mn( Params& params )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // ---------- setup
+    const int64_t minmn = blas::min( m, n );
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t strideA = lda * n;
+    int64_t stride_tau = blas::max( 1, minmn );
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_tau = (size_t) stride_tau * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > tau_tst( size_tau );
+    std::vector< scalar_t > tau_ref( size_tau );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*strideA ], lda );
+    }
+    std::vector< scalar_t > A_ref = A_tst;
+    std::vector< scalar_t > A_orig = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( (lapack::fixed::geqrf< m, n >( &A_tst[0], 0, &tau_tst[0] )), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::fixed::geqrf< m, n >( &A_tst[ i*strideA ], lda,
+                                      &tau_tst[ i*stride_tau ] );
+    }
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over the batch of ||A - QR|| / (n ||A||),
+        // forming QR by applying Q to the upper trapezoid R.
+        int64_t ldr = lda;
+        std::vector< scalar_t > R( ldr * n );
+
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_tst[ i*strideA ];
+            scalar_t* Ai_orig = &A_orig[ i*strideA ];
+            lapack::laset( lapack::MatrixType::General, m, n, 0.0, 0.0, &R[0], ldr );
+            lapack::lacpy( lapack::MatrixType::Upper, m, n, Ai, lda, &R[0], ldr );
+            lapack::unmqr( lapack::Side::Left, lapack::Op::NoTrans, m, n, minmn,
+                           Ai, lda, &tau_tst[ i*stride_tau ], &R[0], ldr );
+
+            // R = QR - A
+            for (int64_t j = 0; j < n; ++j)
+                for (int64_t ii = 0; ii < m; ++ii)
+                    R[ ii + j*ldr ] -= Ai_orig[ ii + j*lda ];
+
+            real_t Anorm = lapack::lange( lapack::Norm::One, m, n, Ai_orig, lda );
+            real_t error_i = lapack::lange( lapack::Norm::One, m, n, &R[0], ldr );
+            if (Anorm > 0)
+                error_i /= (n * Anorm);
+            error = blas::max( error, error_i );
+        }
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        int64_t info_ref = 0;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_i = lapack::geqrf( m, n, &A_ref[ i*strideA ], lda,
+                                            &tau_ref[ i*stride_tau ] );
+            if (info_i != 0)
+                info_ref = info_i;
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::geqrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Dispatches run-time n to compile-time n, for a given m.
+template< typename scalar_t, int m >
+void test_geqrf_fixed_m( Params& params, int64_t n )
+{
+    switch (n) {
+        case 0: test_geqrf_fixed_mn< scalar_t, m, 0 >( params ); break;
+        case 1: test_geqrf_fixed_mn< scalar_t, m, 1 >( params ); break;
+        case 2: test_geqrf_fixed_mn< scalar_t, m, 2 >( params ); break;
+        case 3: test_geqrf_fixed_mn< scalar_t, m, 3 >( params ); break;
+        case 4: test_geqrf_fixed_mn< scalar_t, m, 4 >( params ); break;
+        case 5: test_geqrf_fixed_mn< scalar_t, m, 5 >( params ); break;
+        case 6: test_geqrf_fixed_mn< scalar_t, m, 6 >( params ); break;
+        case 7: test_geqrf_fixed_mn< scalar_t, m, 7 >( params ); break;
+        case 8: test_geqrf_fixed_mn< scalar_t, m, 8 >( params ); break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_geqrf_fixed_work( Params& params, bool run )
+{
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    params.batch();
+    params.align();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.msg();
+
+    if (! run)
+        return;
+
+    if (m > 8 || n > 8) {
+        params.msg() = "skipping: fixed-size routines are tested for m, n <= 8";
+        return;
+    }
+
+    switch (m) {
+        case 0: test_geqrf_fixed_m< scalar_t, 0 >( params, n ); break;
+        case 1: test_geqrf_fixed_m< scalar_t, 1 >( params, n ); break;
+        case 2: test_geqrf_fixed_m< scalar_t, 2 >( params, n ); break;
+        case 3: test_geqrf_fixed_m< scalar_t, 3 >( params, n ); break;
+        case 4: test_geqrf_fixed_m< scalar_t, 4 >( params, n ); break;
+        case 5: test_geqrf_fixed_m< scalar_t, 5 >( params, n ); break;
+        case 6: test_geqrf_fixed_m< scalar_t, 6 >( params, n ); break;
+        case 7: test_geqrf_fixed_m< scalar_t, 7 >( params, n ); break;
+        case 8: test_geqrf_fixed_m< scalar_t, 8 >( params, n ); break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geqrf_fixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_geqrf_fixed_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geqrf_fixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geqrf_fixed_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geqrf_fixed_work< std::complex<double> >( params, run );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Times the pointer-array geqrf_batch (time, gflops) and the strided
+// geqrf_batch (time2). The reference is a loop calling lapack::geqrf for
+// each problem. The errors are the differences in A (relative) and tau
+// from the reference, for the pointer-array (error) and strided (error2)
+// variants.
+template< typename scalar_t >
+void test_geqrf_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.error2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t min_mn = blas::min( m, n );
+    int64_t strideA = lda * n;
+    int64_t stride_tau = blas::max( 1, min_mn );
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_tau = (size_t) stride_tau * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > tau_tst( size_tau );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*strideA ], lda );
+    }
+    std::vector< scalar_t > A_str = A_tst;
+    std::vector< scalar_t > A_ref = A_tst;
+    std::vector< scalar_t > tau_str( size_tau );
+    std::vector< scalar_t > tau_ref( size_tau );
+    std::vector< int64_t > info_str( batch );
+
+    // pointer-array arguments; one m, n, lda for the whole batch
+    std::vector< int64_t > m_vec( 1, m ), n_vec( 1, n ), lda_vec( 1, lda );
+    std::vector< scalar_t* > A_array( batch ), tau_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = &A_tst[ i*strideA ];
+        tau_array[ i ] = &tau_tst[ i*stride_tau ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > neg( 1, -1 ), lda_bad( 1, m-1 );
+        assert_throw( lapack::geqrf_batch( neg, n_vec, A_array, lda_vec, tau_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::geqrf_batch( m_vec, neg, A_array, lda_vec, tau_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::geqrf_batch( m_vec, n_vec, A_array, lda_bad, tau_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::geqrf_batch( m, n, &A_str[0], lda, strideA-1, &tau_str[0], stride_tau, 2, &info_str[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::geqrf_batch( m_vec, n_vec, A_array, lda_vec, tau_array, batch,
+                         info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::geqrf( m, n );
+    params.gflops() = gflop / time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::geqrf_batch( m, n, &A_str[0], lda, strideA,
+                         &tau_str[0], stride_tau, batch, &info_str[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0 || info_str[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::geqrf_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (verbose >= 2) {
+        printf( "A_factor[0] = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_i = lapack::geqrf( m, n, &A_ref[ i*strideA ], lda,
+                                            &tau_ref[ i*stride_tau ] );
+            if (info_i != 0)
+                ++nonzero;
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+
+        // ---------- check error compared to reference
+        // Problems are independent, so each must match the single routine.
+        // tau can be all zero, but |tau_i| <= 2, so its error is absolute.
+        real_t error = 0, error2 = 0;
+        if (min_mn > 0) {
+            error  = rel_error( A_tst, A_ref ) + abs_error( tau_tst, tau_ref );
+            error2 = rel_error( A_str, A_ref ) + abs_error( tau_str, tau_ref );
+        }
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol) && (nonzero == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_geqrf_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_geqrf_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_geqrf_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_geqrf_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_geqrf_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Times the pointer-array unmqr_batch (time) and the strided unmqr_batch
+// (time2), applying Q_i from geqrf of an nq-by-k A_i to an m-by-n C_i,
+// where nq = m for side = left and nq = n for side = right. The reference
+// is a loop calling lapack::unmqr for each problem. The errors are the
+// relative differences in C from the reference, for the pointer-array
+// (error) and strided (error2) variants.
+template< typename scalar_t >
+void test_unmqr_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Side side = params.side();
+    lapack::Op trans = params.trans();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t k = params.dim.k();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.error2();
+    params.ref_time();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // skip invalid or unimplemented options
+    int64_t nq = (side == lapack::Side::Left ? m : n);
+    if (k > nq) {
+        params.msg() = "skipping: requires k <= m (left) or k <= n (right)";
+        return;
+    }
+    if (blas::is_complex< scalar_t >::value && trans == lapack::Op::Trans) {
+        params.msg() = "skipping: complex requires trans = n or c";
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, nq ), align );
+    int64_t ldc = roundup( blas::max( 1, m ), align );
+    int64_t strideA = lda * k;
+    int64_t stride_tau = blas::max( 1, k );
+    int64_t strideC = ldc * n;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_tau = (size_t) stride_tau * batch;
+    size_t size_C = (size_t) strideC * batch;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< scalar_t > tau( size_tau );
+    std::vector< scalar_t > C_tst( size_C );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, nq, k, &A[ i*strideA ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, C_tst.size(), &C_tst[0] );
+    std::vector< scalar_t > C_str = C_tst;
+    std::vector< scalar_t > C_ref = C_tst;
+    std::vector< int64_t > info_str( batch );
+
+    // factor each A_i = Q_i R_i
+    lapack::geqrf_batch( nq, k, &A[0], lda, strideA, &tau[0], stride_tau,
+                         batch, &info_tst[0] );
+
+    // pointer-array arguments; one side, trans, m, n, k, lda, ldc for the batch
+    std::vector< lapack::Side > side_vec( 1, side );
+    std::vector< lapack::Op > trans_vec( 1, trans );
+    std::vector< int64_t > m_vec( 1, m ), n_vec( 1, n ), k_vec( 1, k );
+    std::vector< int64_t > lda_vec( 1, lda ), ldc_vec( 1, ldc );
+    std::vector< scalar_t* > A_array( batch ), tau_array( batch ), C_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = &A[ i*strideA ];
+        tau_array[ i ] = &tau[ i*stride_tau ];
+        C_array[ i ] = &C_tst[ i*strideC ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A nq=%5lld, k=%5lld, lda=%5lld\n"
+                "C m=%5lld, n=%5lld, ldc=%5lld, batch=%5lld\n",
+                llong( nq ), llong( k ), llong( lda ),
+                llong( m ), llong( n ), llong( ldc ), llong( batch ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > neg( 1, -1 ), ldc_bad( 1, m-1 );
+        assert_throw( lapack::unmqr_batch( side_vec, trans_vec, neg, n_vec, k_vec, A_array, lda_vec, tau_array, C_array, ldc_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::unmqr_batch( side_vec, trans_vec, m_vec, neg, k_vec, A_array, lda_vec, tau_array, C_array, ldc_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::unmqr_batch( side_vec, trans_vec, m_vec, n_vec, k_vec, A_array, lda_vec, tau_array, C_array, ldc_bad, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::unmqr_batch( side, trans, m, n, k, &A[0], lda, strideA, &tau[0], stride_tau, &C_str[0], ldc, strideC-1, 2, &info_str[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::unmqr_batch( side_vec, trans_vec, m_vec, n_vec, k_vec,
+                         A_array, lda_vec, tau_array, C_array, ldc_vec,
+                         batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::unmqr_batch( side, trans, m, n, k, &A[0], lda, strideA,
+                         &tau[0], stride_tau, &C_str[0], ldc, strideC,
+                         batch, &info_str[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0 || info_str[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::unmqr_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::unmqr( side, trans, m, n, k, &A[ i*strideA ], lda,
+                           &tau[ i*stride_tau ], &C_ref[ i*strideC ], ldc );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        real_t error = 0, error2 = 0;
+        if (m > 0 && n > 0) {
+            error  = rel_error( C_tst, C_ref );
+            error2 = rel_error( C_str, C_ref );
+        }
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol) && (nonzero == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_unmqr_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_unmqr_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_unmqr_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_unmqr_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_unmqr_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
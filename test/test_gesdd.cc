@@ -24,6 +24,7 @@ void test_gesdd_work( Params& params, bool run )
     int64_t m = params.dim.m();
     int64_t n = params.dim.n();
     int64_t align = params.align();
+    lapack::AllocPolicy alloc = params.alloc();
     params.matrix.mark();
 
     real_t eps = std::numeric_limits< real_t >::epsilon();
@@ -64,10 +65,13 @@ void test_gesdd_work( Params& params, bool run )
     A_ref = A_tst;
 
     // ---------- run test
+    lapack::AllocPolicy alloc_save = lapack::get_alloc_policy();
+    lapack::set_alloc_policy( alloc );
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::gesdd( jobu, m, n, &A_tst[0], lda, &S_tst[0], &U_tst[0], ldu, &VT_tst[0], ldvt );
     time = testsweeper::get_wtime() - time;
+    lapack::set_alloc_policy( alloc_save );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::gesdd returned error %lld\n", llong( info_tst ) );
     }
@@ -161,3 +165,240 @@ void test_gesdd( Params& params, bool run )
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+// Batch mode: times the pointer-array gesdd_batch (time) and the strided
+// gesdd_batch (time2). The reference is a loop calling lapack::gesdd for
+// each problem. The errors are the max over the batch of the check_svd
+// errors; error2 also includes the error of the batch's singular values
+// compared to lapack::gesdd. Small min(m,n) exercises the Jacobi kernel.
+// Every other problem is rank deficient.
+template< typename scalar_t >
+void test_gesdd_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Job jobz = params.jobu();
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.ref_time();
+    params.ortho_U();
+    params.ortho_V();
+    params.error2();
+    params.error2.name( "Sigma" );
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t min_mn = blas::min( m, n );
+    int64_t ucol = (jobz == lapack::Job::SomeVec ? min_mn : m);
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t ldu = roundup( blas::max( 1, m ), align );
+    int64_t ldvt = roundup( blas::max( 1, (jobz == lapack::Job::SomeVec ? min_mn : n) ), align );
+    int64_t strideA = lda * n;
+    int64_t strideS = min_mn;
+    int64_t strideU = ldu * ucol;
+    int64_t strideVT = ldvt * n;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_S = (size_t) strideS * batch;
+    size_t size_U = (size_t) strideU * batch;
+    size_t size_VT = (size_t) strideVT * batch;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< real_t > S_tst( size_S );
+    std::vector< real_t > S_str( size_S );
+    std::vector< real_t > S_ref( size_S );
+    std::vector< scalar_t > U_tst( size_U );
+    std::vector< scalar_t > U_str( size_U );
+    std::vector< scalar_t > U_ref( size_U );
+    std::vector< scalar_t > VT_tst( size_VT );
+    std::vector< scalar_t > VT_str( size_VT );
+    std::vector< scalar_t > VT_ref( size_VT );
+    std::vector< int64_t > info_tst( batch );
+    std::vector< int64_t > info_str( batch );
+
+    // Odd problems are made rank deficient by zeroing the last
+    // min(m,n)/2 columns (or rows, if m < n), so the zero singular values
+    // are exact and U (or VT) must be completed to an orthonormal set.
+    for (int64_t i = 0; i < batch; ++i) {
+        scalar_t* Ai = &A[ i*strideA ];
+        lapack::generate_matrix( params.matrix, m, n, Ai, lda );
+        if (i % 2 == 1) {
+            const scalar_t zero = 0;
+            int64_t nzero = min_mn / 2;
+            if (m >= n)
+                lapack::laset( lapack::MatrixType::General, m, nzero, zero, zero,
+                               &Ai[ (n-nzero)*lda ], lda );
+            else
+                lapack::laset( lapack::MatrixType::General, nzero, n, zero, zero,
+                               &Ai[ m-nzero ], lda );
+        }
+    }
+    std::vector< scalar_t > A_tst = A;
+    std::vector< scalar_t > A_str = A;
+    std::vector< scalar_t > A_ref = A;
+
+    // pointer-array arguments; one jobz, m, n, lda, ldu, ldvt for the batch
+    std::vector< lapack::Job > jobz_vec( 1, jobz );
+    std::vector< int64_t > m_vec( 1, m ), n_vec( 1, n ), lda_vec( 1, lda ),
+                           ldu_vec( 1, ldu ), ldvt_vec( 1, ldvt );
+    std::vector< scalar_t* > A_array( batch ), U_array( batch ),
+                             VT_array( batch );
+    std::vector< real_t* > S_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = &A_tst[ i*strideA ];
+        S_array[ i ] = &S_tst[ i*strideS ];
+        U_array[ i ] = &U_tst[ i*strideU ];
+        VT_array[ i ] = &VT_tst[ i*strideVT ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( batch ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > neg( 1, -1 ), lda_bad( 1, m-1 );
+        assert_throw( lapack::gesdd_batch( jobz_vec, neg, n_vec, A_array, lda_vec, S_array, U_array, ldu_vec, VT_array, ldvt_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gesdd_batch( jobz_vec, m_vec, n_vec, A_array, lda_bad, S_array, U_array, ldu_vec, VT_array, ldvt_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::gesdd_batch( jobz, m, n, &A_str[0], lda, strideA-1, &S_str[0], strideS, &U_str[0], ldu, strideU, &VT_str[0], ldvt, strideVT, 2, &info_str[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::gesdd_batch( jobz_vec, m_vec, n_vec, A_array, lda_vec, S_array,
+                         U_array, ldu_vec, VT_array, ldvt_vec,
+                         batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::gesdd_batch( jobz, m, n, &A_str[0], lda, strideA,
+                         &S_str[0], strideS, &U_str[0], ldu, strideU,
+                         &VT_str[0], ldvt, strideVT, batch, &info_str[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0 || info_str[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::gesdd_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    // ---------- check numerical error
+    // errors[0..3] are the max over the batch of the check_svd errors
+    // (see test_gesdd). Also, both variants must give the same results.
+    real_t errors[4] = { 0, 0, 0, 0 };
+    if (params.check() == 'y') {
+        for (int64_t i = 0; i < batch; ++i) {
+            // U2 or VT2 points to A if overwriting
+            scalar_t* U2    = &U_tst[ i*strideU ];
+            int64_t   ldu2  = ldu;
+            scalar_t* VT2   = &VT_tst[ i*strideVT ];
+            int64_t   ldvt2 = ldvt;
+            if (jobz == lapack::Job::OverwriteVec) {
+                if (m >= n) {
+                    U2   = &A_tst[ i*strideA ];
+                    ldu2 = lda;
+                }
+                else {
+                    VT2   = &A_tst[ i*strideA ];
+                    ldvt2 = lda;
+                }
+            }
+            real_t errors_i[4] = { 0, 0, 0, 0 };
+            check_svd( jobz, jobz, m, n, &A[ i*strideA ], lda,
+                       &S_tst[ i*strideS ], U2, ldu2, VT2, ldvt2, errors_i );
+            for (int j = 0; j < 4; ++j)
+                errors[ j ] = blas::max( errors[ j ], errors_i[ j ] );
+        }
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_i = lapack::gesdd(
+                jobz, m, n, &A_ref[ i*strideA ], lda, &S_ref[ i*strideS ],
+                &U_ref[ i*strideU ], ldu, &VT_ref[ i*strideVT ], ldvt );
+            if (info_i != 0)
+                info_ref = info_i;
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::gesdd returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        if (nonzero > 0 || info_ref != 0) {
+            errors[0] = 1;
+        }
+        errors[3] += rel_error( S_tst, S_ref );
+    }
+    if (jobz == lapack::Job::NoVec) {
+        errors[0] = errors[1] = errors[2] = testsweeper::no_data_flag;
+    }
+    params.error()   = errors[0];
+    params.ortho_U() = errors[1];
+    params.ortho_V() = errors[2];
+    params.error2()  = errors[3];
+    params.okay() = (
+        (jobz == lapack::Job::NoVec || errors[0] < tol) &&
+        (jobz == lapack::Job::NoVec || errors[1] < tol) &&
+        (jobz == lapack::Job::NoVec || errors[2] < tol) &&
+        errors[3] < tol &&
+        S_str == S_tst && U_str == U_tst && VT_str == VT_tst &&
+        A_str == A_tst);
+}
+
+// -----------------------------------------------------------------------------
+void test_gesdd_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gesdd_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gesdd_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gesdd_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gesdd_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -13,8 +13,10 @@
 #include <vector>
 
 // -----------------------------------------------------------------------------
+// If recursive, tests lapack::getrf_recursive instead of lapack::getrf.
+// Either way, the reference is LAPACK's getrf.
 template< typename scalar_t >
-void test_getrf_work( Params& params, bool run )
+void test_getrf_work( Params& params, bool run, bool recursive )
 {
     using real_t = blas::real_type< scalar_t >;
 
@@ -63,15 +65,22 @@ void test_getrf_work( Params& params, bool run )
         assert_throw( lapack::getrf( -1,  n, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
         assert_throw( lapack::getrf(  m, -1, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
         assert_throw( lapack::getrf(  m,  n, &A_tst[0], m-1, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_recursive( -1,  n, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_recursive(  m, -1, &A_tst[0], lda, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrf_recursive(  m,  n, &A_tst[0], m-1, &ipiv_tst[0] ), lapack::Error );
     }
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    int64_t info_tst = lapack::getrf( m, n, &A_tst[0], lda, &ipiv_tst[0] );
+    int64_t info_tst
+        = recursive
+        ? lapack::getrf_recursive( m, n, &A_tst[0], lda, &ipiv_tst[0] )
+        : lapack::getrf( m, n, &A_tst[0], lda, &ipiv_tst[0] );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
-        fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info_tst ) );
+        fprintf( stderr, "lapack::getrf%s returned error %lld\n",
+                 recursive ? "_recursive" : "", llong( info_tst ) );
     }
 
     params.time() = time;
@@ -147,19 +156,237 @@ void test_getrf( Params& params, bool run )
             break;
 
         case testsweeper::DataType::Single:
-            test_getrf_work< float >( params, run );
+            test_getrf_work< float >( params, run, false );
             break;
 
         case testsweeper::DataType::Double:
-            test_getrf_work< double >( params, run );
+            test_getrf_work< double >( params, run, false );
             break;
 
         case testsweeper::DataType::SingleComplex:
-            test_getrf_work< std::complex<float> >( params, run );
+            test_getrf_work< std::complex<float> >( params, run, false );
             break;
 
         case testsweeper::DataType::DoubleComplex:
-            test_getrf_work< std::complex<double> >( params, run );
+            test_getrf_work< std::complex<double> >( params, run, false );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_getrf_recursive( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_getrf_work< float >( params, run, true );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrf_work< double >( params, run, true );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrf_work< std::complex<float> >( params, run, true );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrf_work< std::complex<double> >( params, run, true );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Times lapack::fixed::getrf< n > (time, gflops) over a batch of matrices,
+// one call per matrix. The reference is the same loop calling
+// lapack::getrf. The error is the max over the batch of the backwards
+// error, solving op(A) X = B with lapack::fixed::getrs< n >.
+template< typename scalar_t, int n >
+void test_getrf_fixed_n( Params& params )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t strideA = lda * n;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_ipiv = (size_t) n * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< int64_t > ipiv_tst( size_ipiv );
+    std::vector< int64_t > ipiv_ref( size_ipiv );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+    std::vector< scalar_t > A_ref = A_tst;
+    std::vector< scalar_t > A_orig = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::fixed::getrf< n >( &A_tst[0], 0, &ipiv_tst[0] ), lapack::Error );
+        assert_throw( lapack::fixed::getrs< n >( lapack::Op( 0 ), 1, &A_tst[0], lda, &ipiv_tst[0], &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::fixed::getrs< n >( trans, -1, &A_tst[0], lda, &ipiv_tst[0], &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::fixed::getrs< n >( trans, 1, &A_tst[0], lda, &ipiv_tst[0], &A_tst[0], 0 ), lapack::Error );
+    }
+
+    // ---------- run test
+    int64_t info_tst = 0;
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < batch; ++i) {
+        int64_t info_i = lapack::fixed::getrf< n >(
+            &A_tst[ i*strideA ], lda, &ipiv_tst[ i*n ] );
+        if (info_i != 0)
+            info_tst = info_i;
+    }
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::fixed::getrf returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::getrf( n, n );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over the batch of relative backwards error
+        // ||b - op(A) x|| / (n * ||A|| * ||x||), solving with fixed::getrs.
+        int64_t nrhs = 1;
+        int64_t ldb = roundup( blas::max( 1, n ), align );
+        int64_t strideB = ldb * nrhs;
+        size_t size_B = (size_t) strideB * batch;
+        std::vector< scalar_t > B_tst( size_B );
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+        std::vector< scalar_t > B_ref = B_tst;
+
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_orig[ i*strideA ];
+            scalar_t* Xi = &B_tst[ i*strideB ];
+            scalar_t* Ri = &B_ref[ i*strideB ];
+            lapack::fixed::getrs< n >( trans, nrhs, &A_tst[ i*strideA ], lda,
+                                       &ipiv_tst[ i*n ], Xi, ldb );
+            blas::gemm( blas::Layout::ColMajor, trans, blas::Op::NoTrans,
+                        n, nrhs, n,
+                        -1.0, Ai, lda,
+                              Xi, ldb,
+                         1.0, Ri, ldb );
+
+            real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, Ri, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+            real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    Ai, lda );
+            if (n > 0)
+                error_i /= (n * Anorm * Xnorm);
+            error = blas::max( error, error_i );
+        }
+        params.error() = error;
+        params.okay() = (error < tol && info_tst == 0);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        int64_t info_ref = 0;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_i = lapack::getrf( n, n, &A_ref[ i*strideA ], lda,
+                                            &ipiv_ref[ i*n ] );
+            if (info_i != 0)
+                info_ref = info_i;
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::getrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_getrf_fixed_work( Params& params, bool run )
+{
+    // get & mark input values
+    params.trans();
+    int64_t n = params.dim.n();
+    params.batch();
+    params.align();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.msg();
+
+    if (! run)
+        return;
+
+    switch (n) {
+        case 0: test_getrf_fixed_n< scalar_t, 0 >( params ); break;
+        case 1: test_getrf_fixed_n< scalar_t, 1 >( params ); break;
+        case 2: test_getrf_fixed_n< scalar_t, 2 >( params ); break;
+        case 3: test_getrf_fixed_n< scalar_t, 3 >( params ); break;
+        case 4: test_getrf_fixed_n< scalar_t, 4 >( params ); break;
+        case 5: test_getrf_fixed_n< scalar_t, 5 >( params ); break;
+        case 6: test_getrf_fixed_n< scalar_t, 6 >( params ); break;
+        case 7: test_getrf_fixed_n< scalar_t, 7 >( params ); break;
+        case 8: test_getrf_fixed_n< scalar_t, 8 >( params ); break;
+        default:
+            params.msg() = "skipping: fixed-size routines are tested for n <= 8";
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_getrf_fixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_getrf_fixed_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrf_fixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrf_fixed_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrf_fixed_work< std::complex<double> >( params, run );
             break;
     }
 }
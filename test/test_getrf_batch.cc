@@ -0,0 +1,559 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/flops.hh"
+#include "print_matrix.hh"
+#include "error.hh"
+
+#include <algorithm>
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+// -----------------------------------------------------------------------------
+// Times the pointer-array getrf_batch (time, gflops) and the strided
+// getrf_batch (time2, gflops2). The reference is a loop calling
+// lapack::getrf for each problem. Gflop/s are for the whole batch.
+template< typename scalar_t >
+void test_getrf_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.gflops2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, m ), align );
+    int64_t min_mn = blas::min( m, n );
+    int64_t strideA = lda * n;
+    int64_t stride_ipiv = min_mn;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_ipiv = (size_t) stride_ipiv * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< int64_t > ipiv_tst( size_ipiv );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, m, n, &A_tst[ i*strideA ], lda );
+    }
+    std::vector< scalar_t > A_str = A_tst;
+    std::vector< scalar_t > A_ref = A_tst;
+    std::vector< int64_t > ipiv_str( size_ipiv );
+    std::vector< int64_t > info_str( batch );
+
+    // pointer-array arguments; one m, n, lda for the whole batch
+    std::vector< int64_t > m_vec( 1, m ), n_vec( 1, n ), lda_vec( 1, lda );
+    std::vector< scalar_t* > A_array( batch );
+    std::vector< int64_t* > ipiv_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = &A_tst[ i*strideA ];
+        ipiv_array[ i ] = &ipiv_tst[ i*stride_ipiv ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A m=%5lld, n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > neg( 1, -1 ), lda_bad( 1, m-1 );
+        assert_throw( lapack::getrf_batch( neg, n_vec, A_array, lda_vec, ipiv_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::getrf_batch( m_vec, neg, A_array, lda_vec, ipiv_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::getrf_batch( m_vec, n_vec, A_array, lda_bad, ipiv_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::getrf_batch( m, n, &A_str[0], lda, strideA-1, &ipiv_str[0], stride_ipiv, 2, &info_str[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::getrf_batch( m_vec, n_vec, A_array, lda_vec, ipiv_array, batch,
+                         info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::getrf( m, n );
+    params.gflops() = gflop / time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::getrf_batch( m, n, &A_str[0], lda, strideA,
+                         &ipiv_str[0], stride_ipiv, batch, &info_str[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+    params.gflops2() = gflop / time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0 || info_str[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::getrf_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (verbose >= 2) {
+        printf( "A_factor[0] = " ); print_matrix( m, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y' && m == n) {
+        // ---------- check error
+        // Max over the batch of relative backwards error
+        // ||b - Ax|| / (n * ||A|| * ||x||).
+        // Also, both variants must give the same factors.
+        int64_t nrhs = 1;
+        int64_t ldb = roundup( blas::max( 1, n ), align );
+        int64_t strideB = ldb * nrhs;
+        size_t size_B = (size_t) strideB * batch;
+        std::vector< scalar_t > B_tst( size_B );
+        std::vector< scalar_t > B_ref( size_B );
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+        B_ref = B_tst;
+
+        lapack::getrs_batch(
+            lapack::Op::NoTrans, n, nrhs, &A_tst[0], lda, strideA,
+            &ipiv_tst[0], stride_ipiv, &B_tst[0], ldb, strideB,
+            batch, &info_tst[0] );
+
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_ref[ i*strideA ];
+            scalar_t* Xi = &B_tst[ i*strideB ];
+            scalar_t* Ri = &B_ref[ i*strideB ];
+            blas::gemm( blas::Layout::ColMajor, blas::Op::NoTrans, blas::Op::NoTrans,
+                        n, nrhs, n,
+                        -1.0, Ai, lda,
+                              Xi, ldb,
+                         1.0, Ri, ldb );
+
+            real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, Ri, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+            real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    Ai, lda );
+            error_i /= (n * Anorm * Xnorm);
+            error = blas::max( error, error_i );
+        }
+        params.error() = error;
+        params.okay() = (error < tol
+                         && A_str == A_tst
+                         && ipiv_str == ipiv_tst);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< int64_t > ipiv_ref( blas::max( 1, min_mn ) );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::getrf( m, n, &A_ref[ i*strideA ], lda, &ipiv_ref[0] );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_getrf_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_getrf_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrf_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrf_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrf_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Times the pointer-array getrf_batch on a variable-size batch (time,
+// gflops). The reference is a loop calling lapack::getrf for each problem.
+// Problem batch/2 is n-by-n; the rest have n_i drawn uniformly from
+// [1, max(1, n/4)], each with lda_i = n_i. The large-problem threshold is
+// set to half the cost of the n-by-n problem, so it alone runs first on
+// the calling thread, and the rest run in the OpenMP dynamic loop; at
+// least 2 threads are used so both run. For small n, the n-by-n problem
+// is not large enough to run alone, which msg reports. The error is the
+// max over the batch of the relative difference from the reference.
+template< typename scalar_t >
+void test_getrf_vbatch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.msg();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // draw sizes; problem batch/2 is the large one
+    std::vector< real_t > u( batch );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, u.size(), &u[0] );
+
+    int64_t n_small = blas::max( 1, n/4 );
+    std::vector< int64_t > n_vec( batch ), lda_vec( batch );
+    std::vector< size_t > offsetA( batch + 1 ), offset_ipiv( batch + 1 );
+    double gflop = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        int64_t n_i = (i == batch/2
+                       ? n
+                       : blas::min( 1 + int64_t( u[ i ] * n_small ), n_small ));
+        n_vec[ i ] = n_i;
+        lda_vec[ i ] = blas::max( 1, n_i );
+        offsetA[ i+1 ] = offsetA[ i ] + lda_vec[ i ] * n_i;
+        offset_ipiv[ i+1 ] = offset_ipiv[ i ] + n_i;
+        gflop += lapack::Gflop< scalar_t >::getrf( n_i, n_i );
+    }
+
+    std::vector< scalar_t > A_tst( offsetA[ batch ] );
+    std::vector< int64_t > ipiv_tst( offset_ipiv[ batch ] );
+    std::vector< int64_t > ipiv_ref( offset_ipiv[ batch ] );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n_vec[ i ], n_vec[ i ],
+                                 A_tst.data() + offsetA[ i ], lda_vec[ i ] );
+    }
+    std::vector< scalar_t > A_ref = A_tst;
+
+    std::vector< scalar_t* > A_array( batch );
+    std::vector< int64_t* > ipiv_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = A_tst.data() + offsetA[ i ];
+        ipiv_array[ i ] = ipiv_tst.data() + offset_ipiv[ i ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "n max=%5lld, small <= %5lld, batch=%5lld\n",
+                llong( n ), llong( n_small ), llong( batch ) );
+    }
+
+    // ---------- run test
+    // As in batch_schedule, the n-by-n problem runs by itself only if it
+    // costs more than an even share of the whole batch.
+    double gflop_n = lapack::Gflop< scalar_t >::getrf( n, n );
+    double large_gflop = lapack::get_batch_large_gflop();
+    lapack::set_batch_large_gflop( 0.5 * gflop_n );
+    #ifdef _OPENMP
+        int nthreads = omp_get_max_threads();
+        omp_set_num_threads( blas::max( 2, nthreads ) );
+        if (gflop_n * blas::max( 2, nthreads ) <= gflop)
+            params.msg() = "large-problem path not reached; increase n";
+    #else
+        params.msg() = "large-problem path requires OpenMP";
+    #endif
+
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::getrf_batch( n_vec, n_vec, A_array, lda_vec, ipiv_array, batch,
+                         info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    #ifdef _OPENMP
+        omp_set_num_threads( nthreads );
+    #endif
+    lapack::set_batch_large_gflop( large_gflop );
+
+    params.time() = time;
+    params.gflops() = gflop / time;
+
+    // ---------- run reference
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::getrf( n_vec[ i ], n_vec[ i ], A_ref.data() + offsetA[ i ],
+                       lda_vec[ i ], ipiv_ref.data() + offset_ipiv[ i ] );
+    }
+    time = testsweeper::get_wtime() - time;
+
+    params.ref_time() = time;
+    params.ref_gflops() = gflop / time;
+
+    // ---------- check error compared to reference
+    // Problems are independent, so each must match the single routine.
+    real_t error = 0;
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        std::vector< scalar_t > LU_tst( A_tst.begin() + offsetA[ i ],
+                                        A_tst.begin() + offsetA[ i+1 ] );
+        std::vector< scalar_t > LU_ref( A_ref.begin() + offsetA[ i ],
+                                        A_ref.begin() + offsetA[ i+1 ] );
+        if (info_tst[ i ] != 0
+            || ! std::equal( ipiv_tst.begin() + offset_ipiv[ i ],
+                             ipiv_tst.begin() + offset_ipiv[ i+1 ],
+                             ipiv_ref.begin() + offset_ipiv[ i ] )) {
+            ++nonzero;
+        }
+        if (n_vec[ i ] > 0)
+            error = blas::max( error, rel_error( LU_tst, LU_ref ) );
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::getrf_batch failed or differs for %lld problems\n",
+                 llong( nonzero ) );
+    }
+    params.error() = error;
+    params.okay() = (error < tol) && (nonzero == 0);
+}
+
+// -----------------------------------------------------------------------------
+void test_getrf_vbatch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_getrf_vbatch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrf_vbatch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrf_vbatch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrf_vbatch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Times getrf_compact (time, gflops) on a batch packed by pack_compact.
+// The reference is the strided getrf_batch. The error is the max over the
+// batch of the backwards error, solving op(A) X = B with getrs_compact.
+template< typename scalar_t >
+void test_getrf_compact_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t strideA = lda * n;
+    size_t size_A = (size_t) strideA * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+    std::vector< scalar_t > A_ref = A_tst;
+
+    std::vector< scalar_t* > A_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = &A_tst[ i*strideA ];
+    }
+    std::vector< scalar_t > Ac( lapack::compact_size< scalar_t >( n, n, batch ) );
+    std::vector< int64_t > ipiv( lapack::compact_size< scalar_t >( n, 1, batch ) );
+    lapack::pack_compact( n, n, A_array, lda, &Ac[0], batch );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld, compact_width=%lld\n",
+                llong( n ), llong( lda ), llong( batch ),
+                llong( lapack::compact_width< scalar_t >() ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::pack_compact( n, n, A_array, n-1, &Ac[0], batch ), lapack::Error );
+        assert_throw( lapack::getrf_compact( -1, &Ac[0], &ipiv[0], batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::getrs_compact( lapack::Op( 0 ), n, 1, &Ac[0], &ipiv[0], &Ac[0], batch ), lapack::Error );
+        assert_throw( lapack::getrs_compact( trans, n, -1, &Ac[0], &ipiv[0], &Ac[0], batch ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::getrf_compact( n, &Ac[0], &ipiv[0], batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::getrf( n, n );
+    params.gflops() = gflop / time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::getrf_compact returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over the batch of relative backwards error
+        // ||b - op(A) x|| / (n * ||A|| * ||x||), solving with getrs_compact.
+        int64_t nrhs = 1;
+        int64_t ldb = roundup( blas::max( 1, n ), align );
+        int64_t strideB = ldb * nrhs;
+        size_t size_B = (size_t) strideB * batch;
+        std::vector< scalar_t > B_tst( size_B );
+        std::vector< scalar_t > B_ref( size_B );
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+        B_ref = B_tst;
+
+        std::vector< scalar_t* > B_array( batch );
+        for (int64_t i = 0; i < batch; ++i) {
+            B_array[ i ] = &B_tst[ i*strideB ];
+        }
+        std::vector< scalar_t > Bc( lapack::compact_size< scalar_t >( n, nrhs, batch ) );
+        lapack::pack_compact( n, nrhs, B_array, ldb, &Bc[0], batch );
+        lapack::getrs_compact( trans, n, nrhs, &Ac[0], &ipiv[0], &Bc[0], batch );
+        lapack::unpack_compact( n, nrhs, &Bc[0], B_array, ldb, batch );
+
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_ref[ i*strideA ];
+            scalar_t* Xi = &B_tst[ i*strideB ];
+            scalar_t* Ri = &B_ref[ i*strideB ];
+            blas::gemm( blas::Layout::ColMajor, trans, blas::Op::NoTrans,
+                        n, nrhs, n,
+                        -1.0, Ai, lda,
+                              Xi, ldb,
+                         1.0, Ri, ldb );
+
+            real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, Ri, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+            real_t Anorm = lapack::lange( lapack::Norm::One, n, n,    Ai, lda );
+            if (n > 0)
+                error_i /= (n * Anorm * Xnorm);
+            error = blas::max( error, error_i );
+        }
+        params.error() = error;
+        params.okay() = (error < tol && nonzero == 0);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< int64_t > ipiv_ref( n * batch );
+        std::vector< int64_t > info_ref( batch );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        lapack::getrf_batch( n, n, &A_ref[0], lda, strideA,
+                             &ipiv_ref[0], n, batch, &info_ref[0] );
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_getrf_compact( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_getrf_compact_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_getrf_compact_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_getrf_compact_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_getrf_compact_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -123,3 +123,234 @@ void test_gtsv( Params& params, bool run )
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+// Batch mode: times the strided gtsv_batch (time) and gtsv_compact on the
+// same batch packed by pack_compact (time2). The reference is a loop calling
+// lapack::gtsv for each problem. The error is the max over the batch of the
+// backwards error of the gtsv_batch solution and of the solution of
+// op(A_i) X_i = B_i by gttrf_batch, gttrs_batch. The compact solution
+// must match gtsv_batch exactly.
+template< typename scalar_t >
+void test_gtsv_batch_work( Params& params, bool run )
+{
+    using blas::conj;
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.time2();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t n1 = blas::max( 0, n-1 );
+    int64_t ld1 = blas::max( 1, n1 );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t strideD = roundup( blas::max( 1, n ), align );
+    int64_t strideB = ldb * nrhs;
+    size_t size_D = (size_t) strideD * batch;
+    size_t size_B = (size_t) strideB * batch;
+
+    std::vector< scalar_t > DL_tst( size_D );
+    std::vector< scalar_t > D_tst( size_D );
+    std::vector< scalar_t > DU_tst( size_D );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< int64_t > info_tst( batch );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, DL_tst.size(), &DL_tst[0] );
+    lapack::larnv( idist, iseed, D_tst.size(), &D_tst[0] );
+    lapack::larnv( idist, iseed, DU_tst.size(), &DU_tst[0] );
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+    std::vector< scalar_t > DL_ref = DL_tst;
+    std::vector< scalar_t > D_ref = D_tst;
+    std::vector< scalar_t > DU_ref = DU_tst;
+    std::vector< scalar_t > B_ref = B_tst;
+
+    // compact copies of the same batch
+    std::vector< scalar_t* > DL_array( batch ), D_array( batch ),
+                             DU_array( batch ), B_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        DL_array[ i ] = &DL_tst[ i*strideD ];
+        D_array[ i ]  = &D_tst[ i*strideD ];
+        DU_array[ i ] = &DU_tst[ i*strideD ];
+        B_array[ i ]  = &B_tst[ i*strideB ];
+    }
+    std::vector< scalar_t > DLc( lapack::compact_size< scalar_t >( n1, 1, batch ) );
+    std::vector< scalar_t > Dc( lapack::compact_size< scalar_t >( n, 1, batch ) );
+    std::vector< scalar_t > DUc( lapack::compact_size< scalar_t >( n1, 1, batch ) );
+    std::vector< scalar_t > Bc( lapack::compact_size< scalar_t >( n, nrhs, batch ) );
+    std::vector< int64_t > info_c( batch );
+    lapack::pack_compact( n1, 1, DL_array, ld1, &DLc[0], batch );
+    lapack::pack_compact( n,  1, D_array,  strideD, &Dc[0], batch );
+    lapack::pack_compact( n1, 1, DU_array, ld1, &DUc[0], batch );
+    lapack::pack_compact( n, nrhs, B_array, ldb, &Bc[0], batch );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "n=%5lld, nrhs=%5lld, ldb=%5lld, stride=%5lld, batch=%5lld\n",
+                llong( n ), llong( nrhs ), llong( ldb ), llong( strideD ),
+                llong( batch ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::gtsv_batch( -1, nrhs, &DL_tst[0], strideD, &D_tst[0], strideD, &DU_tst[0], strideD, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gtsv_batch( n, -1, &DL_tst[0], strideD, &D_tst[0], strideD, &DU_tst[0], strideD, &B_tst[0], ldb, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gtsv_batch( n, nrhs, &DL_tst[0], strideD, &D_tst[0], strideD, &DU_tst[0], strideD, &B_tst[0], n-1, strideB, batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gtsv_batch( n, nrhs, &DL_tst[0], strideD, &D_tst[0], n-1, &DU_tst[0], strideD, &B_tst[0], ldb, strideB, 2, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::gtsv_compact( -1, nrhs, &DLc[0], &Dc[0], &DUc[0], &Bc[0], batch, &info_c[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::gtsv_batch( n, nrhs, &DL_tst[0], strideD, &D_tst[0], strideD,
+                        &DU_tst[0], strideD, &B_tst[0], ldb, strideB,
+                        batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::gtsv_compact( n, nrhs, &DLc[0], &Dc[0], &DUc[0], &Bc[0],
+                          batch, &info_c[0] );
+    time = testsweeper::get_wtime() - time;
+    params.time2() = time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::gtsv_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over the batch of relative backwards error
+        // ||b - op(A) x|| / (n * ||A|| * ||x||).
+        auto backward_error = [&]( lapack::Op op, scalar_t const* X ) {
+            std::vector< scalar_t > R( B_ref );
+            real_t error = 0;
+            for (int64_t i = 0; i < batch; ++i) {
+                scalar_t const* DL = &DL_ref[ i*strideD ];
+                scalar_t const* D  = &D_ref[ i*strideD ];
+                scalar_t const* DU = &DU_ref[ i*strideD ];
+                scalar_t const* Xi = &X[ i*strideB ];
+                scalar_t* Ri = &R[ i*strideB ];
+                // op(A) has subdiagonal L and superdiagonal U
+                for (int64_t k = 0; k < n; ++k) {
+                    scalar_t l = 0, d = D[ k ], u = 0;
+                    if (k > 0)
+                        l = (op == lapack::Op::NoTrans ? DL[ k-1 ] : DU[ k-1 ]);
+                    if (k < n-1)
+                        u = (op == lapack::Op::NoTrans ? DU[ k ] : DL[ k ]);
+                    if (op == lapack::Op::ConjTrans) {
+                        l = conj( l );
+                        d = conj( d );
+                        u = conj( u );
+                    }
+                    for (int64_t j = 0; j < nrhs; ++j) {
+                        scalar_t const* x = &Xi[ j*ldb ];
+                        scalar_t r = d * x[ k ];
+                        if (k > 0)
+                            r += l * x[ k-1 ];
+                        if (k < n-1)
+                            r += u * x[ k+1 ];
+                        Ri[ k + j*ldb ] -= r;
+                    }
+                }
+                real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, Ri, ldb );
+                real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+                real_t Anorm = lapack::langt( lapack::Norm::One, n, DL, D, DU );
+                if (n > 0)
+                    error_i /= (n * Anorm * Xnorm);
+                error = blas::max( error, error_i );
+            }
+            return error;
+        };
+        real_t error = backward_error( lapack::Op::NoTrans, &B_tst[0] );
+
+        // solve again with gttrf_batch, gttrs_batch
+        std::vector< scalar_t > DL_trf = DL_ref, D_trf = D_ref, DU_trf = DU_ref;
+        std::vector< scalar_t > DU2_trf( size_D );
+        std::vector< int64_t > ipiv( size_D );
+        std::vector< scalar_t > X = B_ref;
+        std::vector< int64_t > info_trf( batch );
+        lapack::gttrf_batch( n, &DL_trf[0], strideD, &D_trf[0], strideD,
+                             &DU_trf[0], strideD, &DU2_trf[0], strideD,
+                             &ipiv[0], strideD, batch, &info_trf[0] );
+        lapack::gttrs_batch( trans, n, nrhs, &DL_trf[0], strideD,
+                             &D_trf[0], strideD, &DU_trf[0], strideD,
+                             &DU2_trf[0], strideD, &ipiv[0], strideD,
+                             &X[0], ldb, strideB, batch, &info_trf[0] );
+        error = blas::max( error, backward_error( trans, &X[0] ) );
+
+        // compact solution, unpacked over a copy, must match gtsv_batch
+        std::vector< scalar_t > Xc = B_ref;
+        for (int64_t i = 0; i < batch; ++i) {
+            B_array[ i ] = &Xc[ i*strideB ];
+        }
+        lapack::unpack_compact( n, nrhs, &Bc[0], B_array, ldb, batch );
+        bool same = (Xc == B_tst && info_c == info_tst);
+
+        params.error() = error;
+        params.okay() = (error < tol && nonzero == 0 && same);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::gtsv( n, nrhs, &DL_ref[ i*strideD ], &D_ref[ i*strideD ],
+                          &DU_ref[ i*strideD ], &B_ref[ i*strideB ], ldb );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_gtsv_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_gtsv_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_gtsv_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_gtsv_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_gtsv_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -27,6 +27,7 @@ void test_heevd_work( Params& params, bool run )
     lapack::Uplo uplo = params.uplo();
     int64_t n = params.dim.n();
     int64_t align = params.align();
+    lapack::AllocPolicy alloc = params.alloc();
     int64_t verbose = params.verbose();
     real_t tol = params.tol() * eps;
     params.matrix.mark();
@@ -63,11 +64,14 @@ void test_heevd_work( Params& params, bool run )
     }
 
     // ---------- run test
+    lapack::AllocPolicy alloc_save = lapack::get_alloc_policy();
+    lapack::set_alloc_policy( alloc );
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
     int64_t info_tst = lapack::heevd(
         jobz, uplo, n, &Z[0], lda, &Lambda_tst[0] );
     time = testsweeper::get_wtime() - time;
+    lapack::set_alloc_policy( alloc_save );
     if (info_tst != 0) {
         fprintf( stderr, "lapack::heevd returned error %lld\n", llong( info_tst ) );
     }
@@ -162,3 +166,200 @@ void test_heevd( Params& params, bool run )
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+// Batch mode: times the pointer-array heevd_batch (time) and the strided
+// heevd_batch (time2). The reference is a loop calling lapack::heevd for
+// each problem. The error is the max over the batch of the backwards
+// error; error2 is the error of the batch's eigenvalues compared to
+// lapack::heevd. Small n exercises the Jacobi kernel.
+template< typename scalar_t >
+void test_heevd_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const real_t   eps  = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    lapack::Job jobz = params.jobz();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.time2();
+    params.ref_time();
+    params.error2();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldz = lda;  // vectors overwrite matrix A
+    int64_t strideA = lda * n;
+    int64_t strideW = n;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_W = (size_t) strideW * batch;
+
+    std::vector< scalar_t > A( size_A );
+    std::vector< real_t > Lambda_tst( size_W );
+    std::vector< real_t > Lambda_str( size_W );
+    std::vector< real_t > Lambda_ref( size_W );
+    std::vector< int64_t > info_tst( batch );
+    std::vector< int64_t > info_str( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A[ i*strideA ], lda );
+    }
+    std::vector< scalar_t > Z_tst = A;
+    std::vector< scalar_t > Z_str = A;
+    std::vector< scalar_t > Z_ref = A;
+
+    // pointer-array arguments; one jobz, uplo, n, lda for the batch
+    std::vector< lapack::Job > jobz_vec( 1, jobz );
+    std::vector< lapack::Uplo > uplo_vec( 1, uplo );
+    std::vector< int64_t > n_vec( 1, n ), lda_vec( 1, lda );
+    std::vector< scalar_t* > Z_array( batch );
+    std::vector< real_t* > Lambda_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        Z_array[ i ] = &Z_tst[ i*strideA ];
+        Lambda_array[ i ] = &Lambda_tst[ i*strideW ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        std::vector< int64_t > neg( 1, -1 ), lda_bad( 1, n-1 );
+        assert_throw( lapack::heevd_batch( jobz_vec, uplo_vec, neg, Z_array, lda_vec, Lambda_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::heevd_batch( jobz_vec, uplo_vec, n_vec, Z_array, lda_bad, Lambda_array, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::heevd_batch( jobz, uplo, n, &Z_str[0], lda, strideA-1, &Lambda_str[0], strideW, 2, &info_str[0] ), lapack::Error );
+        assert_throw( lapack::heevd_batch( jobz, uplo, n, &Z_str[0], lda, strideA, &Lambda_str[0], strideW-1, 2, &info_str[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::heevd_batch( jobz_vec, uplo_vec, n_vec, Z_array, lda_vec,
+                         Lambda_array, batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::heevd_batch( jobz, uplo, n, &Z_str[0], lda, strideA,
+                         &Lambda_str[0], strideW, batch, &info_str[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0 || info_str[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::heevd_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.check() == 'y' && jobz == lapack::Job::Vec) {
+        // ---------- check error
+        // Max over the batch of the relative backwards error =
+        //     ||A Z - Z Lambda|| / (n * ||A|| * ||Z||)
+        // Also, both variants must give the same results.
+        std::vector< scalar_t > W( strideA );  // workspace
+        int64_t ldw = ldz;
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* A_i = &A[ i*strideA ];
+            scalar_t* Z_i = &Z_tst[ i*strideA ];
+            real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, A_i, lda );
+            real_t Znorm = lapack::lange( lapack::Norm::One, n, n, Z_i, ldz );
+
+            // W = Z Lambda
+            lapack::lacpy( lapack::MatrixType::General, n, n,
+                           Z_i, ldz,
+                           &W[0], ldw );
+            col_scale( n, n, &W[0], ldw, &Lambda_tst[ i*strideW ] );
+            // W = A Z - (Z Lambda)
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo, n, n,
+                        1.0,  A_i, lda,
+                              Z_i, ldz,
+                        -1.0, &W[0], ldw );
+            real_t error_i = lapack::lange( lapack::Norm::One, n, n, &W[0], ldw );
+            if (n > 0)
+                error_i /= (n * Anorm * Znorm);
+            error = blas::max( error, error_i );
+        }
+        params.error() = error;
+        params.okay() = (error < tol)
+                        && Z_str == Z_tst && Lambda_str == Lambda_tst;
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_i = lapack::heevd(
+                jobz, uplo, n, &Z_ref[ i*strideA ], lda,
+                &Lambda_ref[ i*strideW ] );
+            if (info_i != 0)
+                info_ref = info_i;
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::heevd returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        real_t error = 0;
+        if (nonzero > 0 || info_ref != 0) {
+            error = 1;
+        }
+        error += rel_error( Lambda_tst, Lambda_ref );
+        params.error2() = error;
+        params.okay() = params.okay() && (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_heevd_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_heevd_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_heevd_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_heevd_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_heevd_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -0,0 +1,280 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/fortran_64.h"
+#include "error.hh"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#ifdef LAPACK_HAVE_ILP64_DISPATCH
+
+// -----------------------------------------------------------------------------
+// Simple overloaded wrappers around the suffixed 64-bit integer getrf,
+// to check its prototype directly.
+inline int64_t getrf_64(
+    int64_t m, int64_t n, float* A, int64_t lda, int64_t* ipiv )
+{
+    int64_t info = 0;
+    LAPACK_sgetrf_64( &m, &n, A, &lda, ipiv, &info );
+    return info;
+}
+
+inline int64_t getrf_64(
+    int64_t m, int64_t n, double* A, int64_t lda, int64_t* ipiv )
+{
+    int64_t info = 0;
+    LAPACK_dgetrf_64( &m, &n, A, &lda, ipiv, &info );
+    return info;
+}
+
+inline int64_t getrf_64(
+    int64_t m, int64_t n, std::complex<float>* A, int64_t lda, int64_t* ipiv )
+{
+    int64_t info = 0;
+    LAPACK_cgetrf_64( &m, &n, (lapack_complex_float*) A, &lda, ipiv, &info );
+    return info;
+}
+
+inline int64_t getrf_64(
+    int64_t m, int64_t n, std::complex<double>* A, int64_t lda, int64_t* ipiv )
+{
+    int64_t info = 0;
+    LAPACK_zgetrf_64( &m, &n, (lapack_complex_double*) A, &lda, ipiv, &info );
+    return info;
+}
+
+#endif  // LAPACK_HAVE_ILP64_DISPATCH
+
+// -----------------------------------------------------------------------------
+// Checks the dispatch of large problems to a suffixed 64-bit integer LAPACK:
+// - internal::exceeds_lapack_int, including matrix sizes lda*n that
+//   exceed lapack_int when the dimensions do not;
+// - set_ilp64_threshold and get_ilp64_threshold;
+// - if LAPACK++ was built with lapack_ilp64_suffix, the suffixed getrf
+//   called directly, and getrf, getrs, gesv, potrf, potrs, and posv
+//   forced through the 64-bit integer LAPACK by a threshold of 0,
+//   must return the same info, pivots, factors, and solutions as the
+//   32-bit integer LAPACK.
+template< typename scalar_t >
+void test_ilp64_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+    using lapack::internal::exceeds_lapack_int;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    if (! run)
+        return;
+
+    bool okay = true;
+    auto require = [&]( bool cond, const char* msg ) {
+        if (! cond) {
+            fprintf( stderr, "ilp64: %s\n", msg );
+            okay = false;
+        }
+    };
+
+    // ---------- exceeds_lapack_int
+    const int64_t max_int = std::numeric_limits< lapack_int >::max();
+    require( ! exceeds_lapack_int( {} ), "empty list exceeds" );
+    require( ! exceeds_lapack_int( { 0, 1, -1, max_int, -max_int } ),
+             "max lapack_int exceeds" );
+    if (max_int < std::numeric_limits< int64_t >::max()) {
+        require( exceeds_lapack_int( { 1, max_int + 1 } ),
+                 "max lapack_int + 1 does not exceed" );
+        require( exceeds_lapack_int( { -(max_int + 1), 1 } ),
+                 "-(max lapack_int + 1) does not exceed" );
+    }
+    if (max_int == std::numeric_limits< int32_t >::max()) {
+        // 46341^2 > 2^31 - 1, though 46341 is not.
+        int64_t lda_big = 46341, n_big = 46341;
+        require( ! exceeds_lapack_int( { n_big, lda_big } ),
+                 "46341 exceeds" );
+        require( exceeds_lapack_int( { n_big, lda_big, lda_big*n_big } ),
+                 "lda*n = 46341^2 does not exceed" );
+    }
+    require( exceeds_lapack_int( { 3, 4, 12 }, 11 ), "limit 11 not exceeded" );
+    require( ! exceeds_lapack_int( { 3, 4, 12 }, 12 ), "limit 12 exceeded" );
+
+    // ---------- threshold
+    int64_t threshold_save = lapack::get_ilp64_threshold();
+    require( threshold_save == max_int, "default threshold is not max lapack_int" );
+    lapack::set_ilp64_threshold( 5 );
+    require( lapack::get_ilp64_threshold() == 5, "threshold not set" );
+    lapack::set_ilp64_threshold( std::numeric_limits< int64_t >::max() );
+    require( lapack::get_ilp64_threshold() == max_int,
+             "threshold not reduced to max lapack_int" );
+    lapack::set_ilp64_threshold( -1 );
+    require( lapack::get_ilp64_threshold() == 0, "threshold not raised to 0" );
+    lapack::set_ilp64_threshold( threshold_save );
+
+    real_t error = 0;
+
+    #ifdef LAPACK_HAVE_ILP64_DISPATCH
+        // ---------- setup
+        int64_t lda = blas::max( 1, n );
+        int64_t ldb = lda;
+        std::vector< scalar_t > A( lda * n ), B( ldb * nrhs ), H( lda * n );
+
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed, A.size(), A.data() );
+        lapack::larnv( idist, iseed, B.size(), B.data() );
+
+        // H = (A + A^H)/2 + n I is Hermitian positive definite.
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t i = 0; i < j; ++i) {
+                scalar_t h = (A[ i + j*lda ] + conj( A[ j + i*lda ] )) / real_t( 2 );
+                H[ i + j*lda ] = h;
+                H[ j + i*lda ] = conj( h );
+            }
+            H[ j + j*lda ] = real( A[ j + j*lda ] ) + real_t( n );
+        }
+
+        // Compares results from the 64-bit integer LAPACK (x, ipiv, info)
+        // with those from the 32-bit integer LAPACK (xref, ipiv_ref, info_ref).
+        auto check = [&]( const char* routine,
+                          std::vector< scalar_t >& x,
+                          std::vector< scalar_t >& xref,
+                          std::vector< int64_t >& ipiv,
+                          std::vector< int64_t >& ipiv_ref,
+                          int64_t info, int64_t info_ref ) {
+            real_t err = rel_error( x, xref );
+            if (std::isnan( err ))
+                err = abs_error( x, xref );
+            error = blas::max( error, err );
+
+            bool same = (info == info_ref);
+            for (int64_t i = 0; i < n; ++i) {
+                same = same && (ipiv[ i ] == ipiv_ref[ i ]);
+            }
+            if (! same) {
+                fprintf( stderr, "%s: info or pivots differ\n", routine );
+                okay = false;
+            }
+        };
+
+        double time = testsweeper::get_wtime();
+
+        // ---------- getrf, getrs, gesv
+        std::vector< int64_t > ipiv( lda ), ipiv_ref( lda );
+        std::vector< scalar_t > LU = A, LU_ref = A;
+        int64_t info_ref = lapack::getrf( n, n, LU_ref.data(), lda,
+                                          ipiv_ref.data() );
+        int64_t info = getrf_64( n, n, LU.data(), lda, ipiv.data() );
+        check( "getrf_64", LU, LU_ref, ipiv, ipiv_ref, info, info_ref );
+
+        lapack::set_ilp64_threshold( 0 );
+        LU = A;
+        info = lapack::getrf( n, n, LU.data(), lda, ipiv.data() );
+        lapack::set_ilp64_threshold( threshold_save );
+        check( "getrf", LU, LU_ref, ipiv, ipiv_ref, info, info_ref );
+
+        std::vector< scalar_t > X = B, X_ref = B;
+        if (info_ref == 0) {
+            info_ref = lapack::getrs( trans, n, nrhs, LU_ref.data(), lda,
+                                      ipiv_ref.data(), X_ref.data(), ldb );
+            lapack::set_ilp64_threshold( 0 );
+            info = lapack::getrs( trans, n, nrhs, LU.data(), lda,
+                                  ipiv.data(), X.data(), ldb );
+            lapack::set_ilp64_threshold( threshold_save );
+            check( "getrs", X, X_ref, ipiv, ipiv_ref, info, info_ref );
+        }
+
+        LU = A;
+        LU_ref = A;
+        X = B;
+        X_ref = B;
+        info_ref = lapack::gesv( n, nrhs, LU_ref.data(), lda, ipiv_ref.data(),
+                                 X_ref.data(), ldb );
+        lapack::set_ilp64_threshold( 0 );
+        info = lapack::gesv( n, nrhs, LU.data(), lda, ipiv.data(),
+                             X.data(), ldb );
+        lapack::set_ilp64_threshold( threshold_save );
+        check( "gesv", LU, LU_ref, ipiv, ipiv_ref, info, info_ref );
+        check( "gesv", X, X_ref, ipiv, ipiv_ref, info, info_ref );
+
+        // ---------- potrf, potrs, posv; no pivots
+        std::fill( ipiv.begin(), ipiv.end(), 0 );
+        std::fill( ipiv_ref.begin(), ipiv_ref.end(), 0 );
+        std::vector< scalar_t > L = H, L_ref = H;
+        info_ref = lapack::potrf( uplo, n, L_ref.data(), lda );
+        lapack::set_ilp64_threshold( 0 );
+        info = lapack::potrf( uplo, n, L.data(), lda );
+        lapack::set_ilp64_threshold( threshold_save );
+        check( "potrf", L, L_ref, ipiv, ipiv_ref, info, info_ref );
+
+        if (info_ref == 0) {
+            X = B;
+            X_ref = B;
+            info_ref = lapack::potrs( uplo, n, nrhs, L_ref.data(), lda,
+                                      X_ref.data(), ldb );
+            lapack::set_ilp64_threshold( 0 );
+            info = lapack::potrs( uplo, n, nrhs, L.data(), lda,
+                                  X.data(), ldb );
+            lapack::set_ilp64_threshold( threshold_save );
+            check( "potrs", X, X_ref, ipiv, ipiv_ref, info, info_ref );
+        }
+
+        L = H;
+        L_ref = H;
+        X = B;
+        X_ref = B;
+        info_ref = lapack::posv( uplo, n, nrhs, L_ref.data(), lda,
+                                 X_ref.data(), ldb );
+        lapack::set_ilp64_threshold( 0 );
+        info = lapack::posv( uplo, n, nrhs, L.data(), lda, X.data(), ldb );
+        lapack::set_ilp64_threshold( threshold_save );
+        check( "posv", L, L_ref, ipiv, ipiv_ref, info, info_ref );
+        check( "posv", X, X_ref, ipiv, ipiv_ref, info, info_ref );
+
+        time = testsweeper::get_wtime() - time;
+        params.time() = time;
+    #else
+        params.msg() = "no lapack_ilp64_suffix; checked exceeds_lapack_int only";
+    #endif
+
+    params.error() = error;
+    params.okay() = (okay && error < tol);
+}
+
+// -----------------------------------------------------------------------------
+void test_ilp64( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_ilp64_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_ilp64_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_ilp64_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_ilp64_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -9,6 +9,8 @@
 #include "error.hh"
 #include "lapacke_wrappers.hh"
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 // -----------------------------------------------------------------------------
@@ -111,3 +113,143 @@ void test_laed4( Params& params, bool run )
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+// Times lapack::laed4_all (time), computing all roots and deltas,
+// compared to a loop calling lapack::laed4 for each root (ref_time).
+// If native, tests the native iteration, which agrees with laed4 to
+// within rounding; otherwise, laed4_all must match laed4 exactly.
+template< typename scalar_t >
+void test_laed4_all_work( Params& params, bool run, bool native )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    scalar_t rho = std::abs( params.alpha() );
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lddelta = std::max< int64_t >( 1, n );
+    std::vector< scalar_t > d( n );
+    std::vector< scalar_t > z( n );
+    std::vector< scalar_t > lambda_tst( n );
+    std::vector< scalar_t > lambda_ref( n );
+    std::vector< scalar_t > delta_tst( lddelta * n );
+    std::vector< scalar_t > delta_ref( lddelta * n );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, d.size(), &d[0] );
+    lapack::larnv( idist, iseed, z.size(), &z[0] );
+
+    // sort d.
+    std::sort( d.begin(), d.end() );
+
+    // z should have unit norm.
+    real_t z_norm = blas::nrm2( n, &z[0], 1 );
+    for (int64_t i = 0; i < n; ++i)
+        z[ i ] /= z_norm;
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::laed4_all( -1, &d[0], &z[0], rho, &lambda_tst[0], &delta_tst[0], lddelta, native ), lapack::Error );
+        assert_throw( lapack::laed4_all(  n, &d[0], &z[0], rho, &lambda_tst[0], &delta_tst[0], n-1,     native ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    int64_t info_tst = lapack::laed4_all( n, &d[0], &z[0], rho, &lambda_tst[0],
+                                          &delta_tst[0], lddelta, native );
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::laed4_all returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = 0;
+        for (int64_t i = 0; i < n; ++i) {
+            int64_t info_i = lapack::laed4( n, i, &d[0], &z[0],
+                                            &delta_ref[ i*lddelta ], rho,
+                                            &lambda_ref[ i ] );
+            if (info_i != 0 && info_ref == 0)
+                info_ref = i + 1;
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::laed4 returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        // |lambda| <= max |d| + rho, as z has unit norm.
+        real_t scale = std::max( std::abs( d[ 0 ] ), std::abs( d[ n-1 ] ) ) + rho;
+        real_t error = 0;
+        if (info_tst != info_ref) {
+            error = 1;
+        }
+        for (int64_t i = 0; i < n; ++i) {
+            error = std::max( error, std::abs( lambda_tst[ i ] - lambda_ref[ i ] ) / scale );
+            for (int64_t j = 0; j < n; ++j) {
+                error = std::max( error, std::abs( delta_tst[ j + i*lddelta ]
+                                                   - delta_ref[ j + i*lddelta ] ) / scale );
+            }
+        }
+        params.error() = error;
+        if (native)
+            params.okay() = (error < tol);
+        else
+            params.okay() = (error == 0);  // expect laed4_all == laed4
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_laed4_all_dispatch( Params& params, bool run, bool native )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_laed4_all_work< float >( params, run, native );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_laed4_all_work< double >( params, run, native );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+        case testsweeper::DataType::DoubleComplex:
+            params.msg() = "skipping: no complex version";
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_laed4_all( Params& params, bool run )
+{
+    test_laed4_all_dispatch( params, run, false );
+}
+
+// -----------------------------------------------------------------------------
+void test_laed4_all_native( Params& params, bool run )
+{
+    test_laed4_all_dispatch( params, run, true );
+}
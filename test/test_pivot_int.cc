@@ -0,0 +1,211 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "error.hh"
+
+#include <cmath>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Checks the overloads that take lapack_int pivots against the ones that
+// take int64_t pivots: getrf, getrs, gesv, laswp, gbtrf, gbtrs, gbsv,
+// sytrf, sytrs, hetrf, and hetrs. Both must return the same info, pivots,
+// factors, and solutions. In ILP64 builds, lapack_int is int64_t, so both
+// calls go to the same routine.
+template< typename scalar_t >
+void test_pivot_int_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Op trans = params.trans();
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t kl = params.kl();
+    int64_t ku = params.ku();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    int64_t ldb = lda;
+    int64_t ldab = 2*kl + ku + 1;
+    std::vector< scalar_t > A( lda * n ), B( ldb * nrhs ), AB( ldab * n );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A.size(), A.data() );
+    lapack::larnv( idist, iseed, B.size(), B.data() );
+    lapack::larnv( idist, iseed, AB.size(), AB.data() );
+
+    bool okay = true;
+    real_t error = 0;
+
+    // Compares results from lapack_int pivots (x, ipiv, info)
+    // with those from int64_t pivots (xref, ipiv_ref, info_ref).
+    auto check = [&]( const char* routine,
+                      std::vector< scalar_t >& x, std::vector< scalar_t >& xref,
+                      std::vector< lapack_int >& ipiv,
+                      std::vector< int64_t >& ipiv_ref,
+                      int64_t info, int64_t info_ref ) {
+        real_t err = rel_error( x, xref );
+        if (std::isnan( err ))
+            err = abs_error( x, xref );
+        error = blas::max( error, err );
+
+        bool same = (info == info_ref);
+        for (int64_t i = 0; i < n; ++i) {
+            same = same && (int64_t( ipiv[ i ] ) == ipiv_ref[ i ]);
+        }
+        if (! same) {
+            fprintf( stderr, "%s: info or pivots differ\n", routine );
+            okay = false;
+        }
+    };
+
+    double time = testsweeper::get_wtime();
+
+    // ---------- getrf, getrs, gesv, laswp
+    {
+        std::vector< lapack_int > ipiv( lda );
+        std::vector< int64_t > ipiv_ref( lda );
+        std::vector< scalar_t > LU = A, LU_ref = A;
+        int64_t info = lapack::getrf( n, n, LU.data(), lda, ipiv.data() );
+        int64_t info_ref = lapack::getrf( n, n, LU_ref.data(), lda,
+                                          ipiv_ref.data() );
+        check( "getrf", LU, LU_ref, ipiv, ipiv_ref, info, info_ref );
+
+        if (info == 0) {
+            std::vector< scalar_t > X = B, X_ref = B;
+            info = lapack::getrs( trans, n, nrhs, LU.data(), lda, ipiv.data(),
+                                  X.data(), ldb );
+            info_ref = lapack::getrs( trans, n, nrhs, LU_ref.data(), lda,
+                                      ipiv_ref.data(), X_ref.data(), ldb );
+            check( "getrs", X, X_ref, ipiv, ipiv_ref, info, info_ref );
+        }
+
+        std::vector< scalar_t > X = B, X_ref = B;
+        lapack::laswp( nrhs, X.data(), ldb, 1, n, ipiv.data(), 1 );
+        lapack::laswp( nrhs, X_ref.data(), ldb, 1, n, ipiv_ref.data(), 1 );
+        check( "laswp", X, X_ref, ipiv, ipiv_ref, 0, 0 );
+
+        LU = A;
+        LU_ref = A;
+        X = B;
+        X_ref = B;
+        info = lapack::gesv( n, nrhs, LU.data(), lda, ipiv.data(),
+                             X.data(), ldb );
+        info_ref = lapack::gesv( n, nrhs, LU_ref.data(), lda, ipiv_ref.data(),
+                                 X_ref.data(), ldb );
+        check( "gesv", LU, LU_ref, ipiv, ipiv_ref, info, info_ref );
+        check( "gesv", X, X_ref, ipiv, ipiv_ref, info, info_ref );
+    }
+
+    // ---------- gbtrf, gbtrs, gbsv
+    {
+        std::vector< lapack_int > ipiv( lda );
+        std::vector< int64_t > ipiv_ref( lda );
+        std::vector< scalar_t > LU = AB, LU_ref = AB;
+        int64_t info = lapack::gbtrf( n, n, kl, ku, LU.data(), ldab,
+                                      ipiv.data() );
+        int64_t info_ref = lapack::gbtrf( n, n, kl, ku, LU_ref.data(), ldab,
+                                          ipiv_ref.data() );
+        check( "gbtrf", LU, LU_ref, ipiv, ipiv_ref, info, info_ref );
+
+        if (info == 0) {
+            std::vector< scalar_t > X = B, X_ref = B;
+            info = lapack::gbtrs( trans, n, kl, ku, nrhs, LU.data(), ldab,
+                                  ipiv.data(), X.data(), ldb );
+            info_ref = lapack::gbtrs( trans, n, kl, ku, nrhs, LU_ref.data(),
+                                      ldab, ipiv_ref.data(), X_ref.data(), ldb );
+            check( "gbtrs", X, X_ref, ipiv, ipiv_ref, info, info_ref );
+        }
+
+        LU = AB;
+        LU_ref = AB;
+        std::vector< scalar_t > X = B, X_ref = B;
+        info = lapack::gbsv( n, kl, ku, nrhs, LU.data(), ldab, ipiv.data(),
+                             X.data(), ldb );
+        info_ref = lapack::gbsv( n, kl, ku, nrhs, LU_ref.data(), ldab,
+                                 ipiv_ref.data(), X_ref.data(), ldb );
+        check( "gbsv", LU, LU_ref, ipiv, ipiv_ref, info, info_ref );
+        check( "gbsv", X, X_ref, ipiv, ipiv_ref, info, info_ref );
+    }
+
+    // ---------- sytrf, sytrs, hetrf, hetrs
+    {
+        std::vector< lapack_int > ipiv( lda );
+        std::vector< int64_t > ipiv_ref( lda );
+        std::vector< scalar_t > LD = A, LD_ref = A;
+        int64_t info = lapack::sytrf( uplo, n, LD.data(), lda, ipiv.data() );
+        int64_t info_ref = lapack::sytrf( uplo, n, LD_ref.data(), lda,
+                                          ipiv_ref.data() );
+        check( "sytrf", LD, LD_ref, ipiv, ipiv_ref, info, info_ref );
+
+        if (info == 0) {
+            std::vector< scalar_t > X = B, X_ref = B;
+            info = lapack::sytrs( uplo, n, nrhs, LD.data(), lda, ipiv.data(),
+                                  X.data(), ldb );
+            info_ref = lapack::sytrs( uplo, n, nrhs, LD_ref.data(), lda,
+                                      ipiv_ref.data(), X_ref.data(), ldb );
+            check( "sytrs", X, X_ref, ipiv, ipiv_ref, info, info_ref );
+        }
+
+        LD = A;
+        LD_ref = A;
+        info = lapack::hetrf( uplo, n, LD.data(), lda, ipiv.data() );
+        info_ref = lapack::hetrf( uplo, n, LD_ref.data(), lda,
+                                  ipiv_ref.data() );
+        check( "hetrf", LD, LD_ref, ipiv, ipiv_ref, info, info_ref );
+
+        if (info == 0) {
+            std::vector< scalar_t > X = B, X_ref = B;
+            info = lapack::hetrs( uplo, n, nrhs, LD.data(), lda, ipiv.data(),
+                                  X.data(), ldb );
+            info_ref = lapack::hetrs( uplo, n, nrhs, LD_ref.data(), lda,
+                                      ipiv_ref.data(), X_ref.data(), ldb );
+            check( "hetrs", X, X_ref, ipiv, ipiv_ref, info, info_ref );
+        }
+    }
+
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    params.error() = error;
+    params.okay() = (okay && error < tol);
+}
+
+// -----------------------------------------------------------------------------
+void test_pivot_int( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_pivot_int_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_pivot_int_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_pivot_int_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_pivot_int_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -0,0 +1,215 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "lapack/plan.hh"
+#include "error.hh"
+
+#include <utility>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Tests plan_heevd, plan_gesvd, and plan_gels. Each plan is created once,
+// then executed on batch different matrices (time), compared to calling
+// heevd, gesvd, and gels on the same matrices (ref_time). The heevd plan is
+// moved halfway through, so the moved-to plan must also be reusable.
+// The error is the max relative difference from the direct calls in the
+// eigenvalues and eigenvectors, singular values and vectors, and least
+// squares factors and solutions. Also checks that invalid arguments throw
+// when creating a plan.
+template< typename scalar_t >
+void test_plan_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // gesvd and gels use the m-by-n A; heevd uses the n-by-n Hermitian H.
+    int64_t min_mn = blas::min( m, n );
+    int64_t lda = blas::max( 1, m );
+    int64_t ldh = blas::max( 1, n );
+    int64_t ldu = blas::max( 1, m );
+    int64_t ldvt = blas::max( 1, min_mn );
+    int64_t ldb = blas::max( 1, m, n );
+    int64_t strideA = lda * n;
+    int64_t strideH = ldh * n;
+    int64_t strideU = ldu * min_mn;
+    int64_t strideVT = ldvt * n;
+    int64_t strideB = ldb * nrhs;
+
+    std::vector< scalar_t > A( strideA * batch );
+    std::vector< scalar_t > H( strideH * batch );
+    std::vector< scalar_t > B( strideB * batch );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A.size(), A.data() );
+    lapack::larnv( idist, iseed, H.size(), H.data() );
+    lapack::larnv( idist, iseed, B.size(), B.data() );
+    for (int64_t i = 0; i < batch; ++i) {
+        // H = (H + H^H)/2
+        scalar_t* Hi = &H[ i*strideH ];
+        for (int64_t j = 0; j < n; ++j) {
+            for (int64_t k = 0; k < j; ++k) {
+                scalar_t h = (Hi[ k + j*ldh ] + conj( Hi[ j + k*ldh ] )) / real_t( 2 );
+                Hi[ k + j*ldh ] = h;
+                Hi[ j + k*ldh ] = conj( h );
+            }
+            Hi[ j + j*ldh ] = real( Hi[ j + j*ldh ] );
+        }
+    }
+
+    std::vector< scalar_t > Z_tst = H, Z_ref = H;
+    std::vector< real_t > W_tst( n * batch ), W_ref( n * batch );
+    std::vector< scalar_t > SV_tst = A, SV_ref = A;
+    std::vector< real_t > S_tst( min_mn * batch ), S_ref( min_mn * batch );
+    std::vector< scalar_t > U_tst( strideU * batch ), U_ref( strideU * batch );
+    std::vector< scalar_t > VT_tst( strideVT * batch ), VT_ref( strideVT * batch );
+    std::vector< scalar_t > QR_tst = A, QR_ref = A;
+    std::vector< scalar_t > X_tst = B, X_ref = B;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "m=%5lld, n=%5lld, nrhs=%5lld, batch=%5lld\n",
+                llong( m ), llong( n ), llong( nrhs ), llong( batch ) );
+    }
+
+    // test error exits: creating the plan throws
+    if (params.error_exit() == 'y') {
+        using lapack::Job;
+        using lapack::Op;
+        using lapack::Uplo;
+        assert_throw( lapack::plan_heevd< scalar_t >( Job::Vec, Uplo::Lower, -1, ldh ), lapack::Error );
+        assert_throw( lapack::plan_heevd< scalar_t >( Job::Vec, Uplo::Lower,  n, n-1 ), lapack::Error );
+        assert_throw( lapack::plan_gesvd< scalar_t >( Job::SomeVec, Job::SomeVec, -1,  n, lda, ldu, ldvt ), lapack::Error );
+        assert_throw( lapack::plan_gesvd< scalar_t >( Job::SomeVec, Job::SomeVec,  m, -1, lda, ldu, ldvt ), lapack::Error );
+        assert_throw( lapack::plan_gesvd< scalar_t >( Job::SomeVec, Job::SomeVec,  m,  n, m-1, ldu, ldvt ), lapack::Error );
+        assert_throw( lapack::plan_gels< scalar_t >( Op::NoTrans, -1,  n, nrhs, lda, ldb ), lapack::Error );
+        assert_throw( lapack::plan_gels< scalar_t >( Op::NoTrans,  m, -1, nrhs, lda, ldb ), lapack::Error );
+        assert_throw( lapack::plan_gels< scalar_t >( Op::NoTrans,  m,  n,   -1, lda, ldb ), lapack::Error );
+        assert_throw( lapack::plan_gels< scalar_t >( Op::NoTrans,  m,  n, nrhs, lda, ldb-1 ), lapack::Error );
+    }
+
+    // ---------- run test
+    // Each plan is reused for all problems in the batch.
+    int64_t nonzero = 0;
+    double time = testsweeper::get_wtime();
+
+    auto heevd_plan = lapack::plan_heevd< scalar_t >(
+        lapack::Job::Vec, lapack::Uplo::Lower, n, ldh );
+    for (int64_t i = 0; i < batch/2; ++i) {
+        if (heevd_plan.execute( &Z_tst[ i*strideH ], &W_tst[ i*n ] ) != 0)
+            ++nonzero;
+    }
+    // move, then continue with the moved-to plan
+    lapack::HeevdPlan< scalar_t > heevd_plan2 = std::move( heevd_plan );
+    for (int64_t i = batch/2; i < batch; ++i) {
+        if (heevd_plan2.execute( &Z_tst[ i*strideH ], &W_tst[ i*n ] ) != 0)
+            ++nonzero;
+    }
+
+    auto gesvd_plan = lapack::plan_gesvd< scalar_t >(
+        lapack::Job::SomeVec, lapack::Job::SomeVec, m, n, lda, ldu, ldvt );
+    for (int64_t i = 0; i < batch; ++i) {
+        if (gesvd_plan.execute( &SV_tst[ i*strideA ], &S_tst[ i*min_mn ],
+                                &U_tst[ i*strideU ], &VT_tst[ i*strideVT ] ) != 0)
+            ++nonzero;
+    }
+
+    auto gels_plan = lapack::plan_gels< scalar_t >(
+        lapack::Op::NoTrans, m, n, nrhs, lda, ldb );
+    for (int64_t i = 0; i < batch; ++i) {
+        if (gels_plan.execute( &QR_tst[ i*strideA ], &X_tst[ i*strideB ] ) != 0)
+            ++nonzero;
+    }
+
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    if (nonzero > 0) {
+        fprintf( stderr, "plan execute returned error for %lld calls\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::heevd( lapack::Job::Vec, lapack::Uplo::Lower, n,
+                           &Z_ref[ i*strideH ], ldh, &W_ref[ i*n ] );
+            lapack::gesvd( lapack::Job::SomeVec, lapack::Job::SomeVec, m, n,
+                           &SV_ref[ i*strideA ], lda, &S_ref[ i*min_mn ],
+                           &U_ref[ i*strideU ], ldu,
+                           &VT_ref[ i*strideVT ], ldvt );
+            lapack::gels( lapack::Op::NoTrans, m, n, nrhs,
+                          &QR_ref[ i*strideA ], lda, &X_ref[ i*strideB ], ldb );
+        }
+        time = testsweeper::get_wtime() - time;
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        // The plans call the same routines with the same workspace sizes,
+        // so results should match to rounding.
+        real_t error = 0;
+        if (n > 0) {
+            error = blas::max( error, rel_error( W_tst, W_ref ) );
+            error = blas::max( error, rel_error( Z_tst, Z_ref ) );
+        }
+        if (min_mn > 0) {
+            error = blas::max( error, rel_error( S_tst,  S_ref  ) );
+            error = blas::max( error, rel_error( U_tst,  U_ref  ) );
+            error = blas::max( error, rel_error( VT_tst, VT_ref ) );
+            error = blas::max( error, rel_error( QR_tst, QR_ref ) );
+            if (nrhs > 0)
+                error = blas::max( error, rel_error( X_tst, X_ref ) );
+        }
+        params.error() = error;
+        params.okay() = (error < tol && nonzero == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_plan( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_plan_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_plan_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_plan_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_plan_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -163,3 +163,187 @@ void test_posv( Params& params, bool run )
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+// Times the pointer-array posv_batch (time, gflops) and the strided
+// posv_batch (time2, gflops2). The reference is a loop calling lapack::posv
+// for each problem. The errors are the relative differences in the
+// solutions X and Cholesky factors from the reference, for the
+// pointer-array (error) and strided (error2) variants.
+template< typename scalar_t >
+void test_posv_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.gflops2();
+    params.error2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t ldb = roundup( blas::max( 1, n ), align );
+    int64_t strideA = lda * n;
+    int64_t strideB = ldb * nrhs;
+    size_t size_A = (size_t) strideA * batch;
+    size_t size_B = (size_t) strideB * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< scalar_t > B_tst( size_B );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+
+    std::vector< scalar_t > A_str = A_tst;
+    std::vector< scalar_t > B_str = B_tst;
+    std::vector< scalar_t > A_ref = A_tst;
+    std::vector< scalar_t > B_ref = B_tst;
+    std::vector< int64_t > info_str( batch );
+
+    // pointer-array arguments; one uplo, n, nrhs, lda, ldb for the batch
+    std::vector< lapack::Uplo > uplo_vec( 1, uplo );
+    std::vector< int64_t > n_vec( 1, n ), nrhs_vec( 1, nrhs );
+    std::vector< int64_t > lda_vec( 1, lda ), ldb_vec( 1, ldb );
+    std::vector< scalar_t* > A_array( batch ), B_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = &A_tst[ i*strideA ];
+        B_array[ i ] = &B_tst[ i*strideB ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, nrhs=%5lld, lda=%5lld, ldb=%5lld, batch=%5lld\n",
+                llong( n ), llong( nrhs ), llong( lda ), llong( ldb ),
+                llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+        printf( "B[0] = " ); print_matrix( n, nrhs, &B_tst[0], ldb );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        std::vector< Uplo > uplo_bad( 1, Uplo(0) );
+        std::vector< int64_t > neg( 1, -1 ), ldb_bad( 1, n-1 );
+        assert_throw( lapack::posv_batch( uplo_bad, n_vec, nrhs_vec, A_array, lda_vec, B_array, ldb_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::posv_batch( uplo_vec, neg,   nrhs_vec, A_array, lda_vec, B_array, ldb_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::posv_batch( uplo_vec, n_vec, neg,      A_array, lda_vec, B_array, ldb_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::posv_batch( uplo_vec, n_vec, nrhs_vec, A_array, lda_vec, B_array, ldb_bad, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::posv_batch( uplo, n, nrhs, &A_str[0], lda, strideA-1, &B_str[0], ldb, strideB, 2, &info_str[0] ), lapack::Error );
+        assert_throw( lapack::posv_batch( uplo, n, nrhs, &A_str[0], lda, strideA, &B_str[0], ldb, strideB-1, 2, &info_str[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::posv_batch( uplo_vec, n_vec, nrhs_vec, A_array, lda_vec,
+                        B_array, ldb_vec, batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::posv( n, nrhs );
+    params.gflops() = gflop / time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::posv_batch( uplo, n, nrhs, &A_str[0], lda, strideA,
+                        &B_str[0], ldb, strideB, batch, &info_str[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+    params.gflops2() = gflop / time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0 || info_str[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::posv_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_i = lapack::posv( uplo, n, nrhs,
+                                           &A_ref[ i*strideA ], lda,
+                                           &B_ref[ i*strideB ], ldb );
+            if (info_i != 0)
+                ++nonzero;
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+
+        // ---------- check error compared to reference
+        // Problems are independent, so each must match the single routine.
+        real_t error = 0, error2 = 0;
+        if (n > 0) {
+            error  = rel_error( A_tst, A_ref );
+            error2 = rel_error( A_str, A_ref );
+            if (nrhs > 0) {
+                error  += rel_error( B_tst, B_ref );
+                error2 += rel_error( B_str, B_ref );
+            }
+        }
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol) && (nonzero == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_posv_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_posv_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_posv_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_posv_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_posv_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -13,8 +13,10 @@
 #include <vector>
 
 // -----------------------------------------------------------------------------
+// If recursive, tests lapack::potrf_recursive instead of lapack::potrf.
+// Either way, the reference is LAPACK's potrf.
 template< typename scalar_t >
-void test_potrf_work( Params& params, bool run )
+void test_potrf_work( Params& params, bool run, bool recursive )
 {
     using real_t = blas::real_type< scalar_t >;
 
@@ -63,15 +65,22 @@ void test_potrf_work( Params& params, bool run )
         assert_throw( lapack::potrf( Uplo(0),  n, &A_tst[0], lda ), lapack::Error );
         assert_throw( lapack::potrf( uplo,    -1, &A_tst[0], lda ), lapack::Error );
         assert_throw( lapack::potrf( uplo,     n, &A_tst[0], n-1 ), lapack::Error );
+        assert_throw( lapack::potrf_recursive( Uplo(0),  n, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::potrf_recursive( uplo,    -1, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::potrf_recursive( uplo,     n, &A_tst[0], n-1 ), lapack::Error );
     }
 
     // ---------- run test
     testsweeper::flush_cache( params.cache() );
     double time = testsweeper::get_wtime();
-    int64_t info_tst = lapack::potrf( uplo, n, &A_tst[0], lda );
+    int64_t info_tst
+        = recursive
+        ? lapack::potrf_recursive( uplo, n, &A_tst[0], lda )
+        : lapack::potrf( uplo, n, &A_tst[0], lda );
     time = testsweeper::get_wtime() - time;
     if (info_tst != 0) {
-        fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_tst ) );
+        fprintf( stderr, "lapack::potrf%s returned error %lld\n",
+                 recursive ? "_recursive" : "", llong( info_tst ) );
     }
 
     params.time() = time;
@@ -146,19 +155,598 @@ void test_potrf( Params& params, bool run )
             break;
 
         case testsweeper::DataType::Single:
-            test_potrf_work< float >( params, run );
+            test_potrf_work< float >( params, run, false );
             break;
 
         case testsweeper::DataType::Double:
-            test_potrf_work< double >( params, run );
+            test_potrf_work< double >( params, run, false );
             break;
 
         case testsweeper::DataType::SingleComplex:
-            test_potrf_work< std::complex<float> >( params, run );
+            test_potrf_work< std::complex<float> >( params, run, false );
             break;
 
         case testsweeper::DataType::DoubleComplex:
-            test_potrf_work< std::complex<double> >( params, run );
+            test_potrf_work< std::complex<double> >( params, run, false );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_recursive( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_potrf_work< float >( params, run, true );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_work< double >( params, run, true );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_work< std::complex<float> >( params, run, true );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_work< std::complex<double> >( params, run, true );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Batch mode: times the pointer-array potrf_batch (time, gflops) and the
+// strided potrf_batch (time2, gflops2). The reference is a loop calling
+// lapack::potrf for each problem. Gflop/s are for the whole batch.
+template< typename scalar_t >
+void test_potrf_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.gflops2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t strideA = lda * n;
+    size_t size_A = (size_t) strideA * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+    std::vector< scalar_t > A_str = A_tst;
+    std::vector< scalar_t > A_ref = A_tst;
+    std::vector< int64_t > info_str( batch );
+
+    // pointer-array arguments; one uplo, n, lda for the whole batch
+    std::vector< lapack::Uplo > uplo_vec( 1, uplo );
+    std::vector< int64_t > n_vec( 1, n ), lda_vec( 1, lda );
+    std::vector< scalar_t* > A_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = &A_tst[ i*strideA ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        std::vector< Uplo > uplo_bad( 1, Uplo(0) );
+        std::vector< int64_t > neg( 1, -1 ), lda_bad( 1, n-1 );
+        assert_throw( lapack::potrf_batch( uplo_bad, n_vec, A_array, lda_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::potrf_batch( uplo_vec, neg,   A_array, lda_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::potrf_batch( uplo_vec, n_vec, A_array, lda_bad, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::potrf_batch( uplo, n, &A_str[0], lda, strideA-1, 2, &info_str[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::potrf_batch( uplo_vec, n_vec, A_array, lda_vec, batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::potrf( n );
+    params.gflops() = gflop / time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::potrf_batch( uplo, n, &A_str[0], lda, strideA, batch, &info_str[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+    params.gflops2() = gflop / time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0 || info_str[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::potrf_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (verbose >= 2) {
+        printf( "A_factor[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over the batch of relative backwards error
+        // ||b - Ax|| / (n * ||A|| * ||x||), solving with potrs_batch.
+        // Also, both variants must give the same factors.
+        int64_t nrhs = 1;
+        int64_t ldb = roundup( blas::max( 1, n ), align );
+        int64_t strideB = ldb * nrhs;
+        size_t size_B = (size_t) strideB * batch;
+        std::vector< scalar_t > B_tst( size_B );
+        std::vector< scalar_t > B_ref( size_B );
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+        B_ref = B_tst;
+
+        lapack::potrs_batch(
+            uplo, n, nrhs, &A_tst[0], lda, strideA, &B_tst[0], ldb, strideB,
+            batch, &info_tst[0] );
+
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_ref[ i*strideA ];
+            scalar_t* Xi = &B_tst[ i*strideB ];
+            scalar_t* Ri = &B_ref[ i*strideB ];
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                        n, nrhs,
+                        -1.0, Ai, lda,
+                              Xi, ldb,
+                         1.0, Ri, ldb );
+
+            real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, Ri, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+            real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, Ai, lda );
+            error_i /= (n * Anorm * Xnorm);
+            error = blas::max( error, error_i );
+        }
+        params.error() = error;
+        params.okay() = (error < tol && nonzero == 0 && A_str == A_tst);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            lapack::potrf( uplo, n, &A_ref[ i*strideA ], lda );
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_potrf_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Times potrf_compact (time, gflops) on a batch packed by pack_compact.
+// The reference is the strided potrf_batch. The error is the max over the
+// batch of the backwards error, solving with potrs_compact.
+template< typename scalar_t >
+void test_potrf_compact_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t strideA = lda * n;
+    size_t size_A = (size_t) strideA * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+    std::vector< scalar_t > A_ref = A_tst;
+
+    std::vector< scalar_t* > A_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = &A_tst[ i*strideA ];
+    }
+    std::vector< scalar_t > Ac( lapack::compact_size< scalar_t >( n, n, batch ) );
+    lapack::pack_compact( n, n, A_array, lda, &Ac[0], batch );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld, compact_width=%lld\n",
+                llong( n ), llong( lda ), llong( batch ),
+                llong( lapack::compact_width< scalar_t >() ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::potrf_compact( Uplo(0), n, &Ac[0], batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::potrf_compact( uplo,   -1, &Ac[0], batch, &info_tst[0] ), lapack::Error );
+        assert_throw( lapack::potrs_compact( uplo, n, -1, &Ac[0], &Ac[0], batch ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::potrf_compact( uplo, n, &Ac[0], batch, &info_tst[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::potrf( n );
+    params.gflops() = gflop / time;
+
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::potrf_compact returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over the batch of relative backwards error
+        // ||b - Ax|| / (n * ||A|| * ||x||), solving with potrs_compact.
+        int64_t nrhs = 1;
+        int64_t ldb = roundup( blas::max( 1, n ), align );
+        int64_t strideB = ldb * nrhs;
+        size_t size_B = (size_t) strideB * batch;
+        std::vector< scalar_t > B_tst( size_B );
+        std::vector< scalar_t > B_ref( size_B );
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+        B_ref = B_tst;
+
+        std::vector< scalar_t* > B_array( batch );
+        for (int64_t i = 0; i < batch; ++i) {
+            B_array[ i ] = &B_tst[ i*strideB ];
+        }
+        std::vector< scalar_t > Bc( lapack::compact_size< scalar_t >( n, nrhs, batch ) );
+        lapack::pack_compact( n, nrhs, B_array, ldb, &Bc[0], batch );
+        lapack::potrs_compact( uplo, n, nrhs, &Ac[0], &Bc[0], batch );
+        lapack::unpack_compact( n, nrhs, &Bc[0], B_array, ldb, batch );
+
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_ref[ i*strideA ];
+            scalar_t* Xi = &B_tst[ i*strideB ];
+            scalar_t* Ri = &B_ref[ i*strideB ];
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                        n, nrhs,
+                        -1.0, Ai, lda,
+                              Xi, ldb,
+                         1.0, Ri, ldb );
+
+            real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, Ri, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+            real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, Ai, lda );
+            if (n > 0)
+                error_i /= (n * Anorm * Xnorm);
+            error = blas::max( error, error_i );
+        }
+        params.error() = error;
+        params.okay() = (error < tol && nonzero == 0);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        std::vector< int64_t > info_ref( batch );
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        lapack::potrf_batch( uplo, n, &A_ref[0], lda, strideA, batch,
+                             &info_ref[0] );
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_compact( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_potrf_compact_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_compact_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_compact_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_compact_work< std::complex<double> >( params, run );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Times lapack::fixed::potrf< n > (time, gflops) over a batch of matrices,
+// one call per matrix. The reference is the same loop calling
+// lapack::potrf. The error is the max over the batch of the backwards
+// error, solving with lapack::fixed::potrs< n >.
+template< typename scalar_t, int n >
+void test_potrf_fixed_n( Params& params )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t strideA = lda * n;
+    size_t size_A = (size_t) strideA * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+    std::vector< scalar_t > A_ref = A_tst;
+    std::vector< scalar_t > A_orig = A_tst;
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        assert_throw( lapack::fixed::potrf< n >( Uplo(0), &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::fixed::potrf< n >( uplo, &A_tst[0], 0 ), lapack::Error );
+        assert_throw( lapack::fixed::potrs< n >( uplo, -1, &A_tst[0], lda, &A_tst[0], lda ), lapack::Error );
+        assert_throw( lapack::fixed::potrs< n >( uplo, 1, &A_tst[0], lda, &A_tst[0], 0 ), lapack::Error );
+    }
+
+    // ---------- run test
+    int64_t info_tst = 0;
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    for (int64_t i = 0; i < batch; ++i) {
+        int64_t info_i = lapack::fixed::potrf< n >(
+            uplo, &A_tst[ i*strideA ], lda );
+        if (info_i != 0)
+            info_tst = info_i;
+    }
+    time = testsweeper::get_wtime() - time;
+    if (info_tst != 0) {
+        fprintf( stderr, "lapack::fixed::potrf returned error %lld\n", llong( info_tst ) );
+    }
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::potrf( n );
+    params.gflops() = gflop / time;
+
+    if (params.check() == 'y') {
+        // ---------- check error
+        // Max over the batch of relative backwards error
+        // ||b - Ax|| / (n * ||A|| * ||x||), solving with fixed::potrs.
+        int64_t nrhs = 1;
+        int64_t ldb = roundup( blas::max( 1, n ), align );
+        int64_t strideB = ldb * nrhs;
+        size_t size_B = (size_t) strideB * batch;
+        std::vector< scalar_t > B_tst( size_B );
+        int64_t idist = 1;
+        int64_t iseed[4] = { 0, 1, 2, 3 };
+        lapack::larnv( idist, iseed, B_tst.size(), &B_tst[0] );
+        std::vector< scalar_t > B_ref = B_tst;
+
+        real_t error = 0;
+        for (int64_t i = 0; i < batch; ++i) {
+            scalar_t* Ai = &A_orig[ i*strideA ];
+            scalar_t* Xi = &B_tst[ i*strideB ];
+            scalar_t* Ri = &B_ref[ i*strideB ];
+            lapack::fixed::potrs< n >( uplo, nrhs, &A_tst[ i*strideA ], lda,
+                                       Xi, ldb );
+            blas::hemm( blas::Layout::ColMajor, blas::Side::Left, uplo,
+                        n, nrhs,
+                        -1.0, Ai, lda,
+                              Xi, ldb,
+                         1.0, Ri, ldb );
+
+            real_t error_i = lapack::lange( lapack::Norm::One, n, nrhs, Ri, ldb );
+            real_t Xnorm = lapack::lange( lapack::Norm::One, n, nrhs, Xi, ldb );
+            real_t Anorm = lapack::lanhe( lapack::Norm::One, uplo, n, Ai, lda );
+            if (n > 0)
+                error_i /= (n * Anorm * Xnorm);
+            error = blas::max( error, error_i );
+        }
+        params.error() = error;
+        params.okay() = (error < tol && info_tst == 0);
+    }
+
+    if (params.ref() == 'y') {
+        // ---------- run reference
+        int64_t info_ref = 0;
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_i = lapack::potrf( uplo, n, &A_ref[ i*strideA ], lda );
+            if (info_i != 0)
+                info_ref = info_i;
+        }
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::potrf returned error %lld\n", llong( info_ref ) );
+        }
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+    }
+}
+
+// -----------------------------------------------------------------------------
+template< typename scalar_t >
+void test_potrf_fixed_work( Params& params, bool run )
+{
+    // get & mark input values
+    params.uplo();
+    int64_t n = params.dim.n();
+    params.batch();
+    params.align();
+    params.matrix.mark();
+
+    // mark non-standard output values
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+    params.msg();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    switch (n) {
+        case 0: test_potrf_fixed_n< scalar_t, 0 >( params ); break;
+        case 1: test_potrf_fixed_n< scalar_t, 1 >( params ); break;
+        case 2: test_potrf_fixed_n< scalar_t, 2 >( params ); break;
+        case 3: test_potrf_fixed_n< scalar_t, 3 >( params ); break;
+        case 4: test_potrf_fixed_n< scalar_t, 4 >( params ); break;
+        case 5: test_potrf_fixed_n< scalar_t, 5 >( params ); break;
+        case 6: test_potrf_fixed_n< scalar_t, 6 >( params ); break;
+        case 7: test_potrf_fixed_n< scalar_t, 7 >( params ); break;
+        case 8: test_potrf_fixed_n< scalar_t, 8 >( params ); break;
+        default:
+            params.msg() = "skipping: fixed-size routines are tested for n <= 8";
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potrf_fixed( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_potrf_fixed_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potrf_fixed_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potrf_fixed_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potrf_fixed_work< std::complex<double> >( params, run );
             break;
     }
 }
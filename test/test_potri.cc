@@ -184,3 +184,180 @@ void test_potri( Params& params, bool run )
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+// Times the pointer-array potri_batch (time, gflops) and the strided
+// potri_batch (time2, gflops2) on matrices factored by potrf_batch.
+// The reference is a loop calling lapack::potri for each problem.
+// The errors are the relative differences in the inverses from the
+// reference, for the pointer-array (error) and strided (error2) variants.
+template< typename scalar_t >
+void test_potri_batch_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    lapack::Uplo uplo = params.uplo();
+    int64_t n = params.dim.n();
+    int64_t batch = params.batch();
+    int64_t align = params.align();
+    int64_t verbose = params.verbose();
+    params.matrix.mark();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.time2();
+    params.gflops2();
+    params.error2();
+    params.ref_time();
+    params.ref_gflops();
+    params.gflops();
+
+    if (! run) {
+        params.matrix.kind.set_default( "rand_dominant" );
+        return;
+    }
+
+    // ---------- setup
+    int64_t lda = roundup( blas::max( 1, n ), align );
+    int64_t strideA = lda * n;
+    size_t size_A = (size_t) strideA * batch;
+
+    std::vector< scalar_t > A_tst( size_A );
+    std::vector< int64_t > info_tst( batch );
+
+    for (int64_t i = 0; i < batch; ++i) {
+        lapack::generate_matrix( params.matrix, n, n, &A_tst[ i*strideA ], lda );
+    }
+
+    // factor A = LL^H or U^H U, so potri can compute the inverse
+    lapack::potrf_batch( uplo, n, &A_tst[0], lda, strideA, batch, &info_tst[0] );
+    int64_t nonzero = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0)
+            ++nonzero;
+    }
+    if (nonzero > 0) {
+        fprintf( stderr, "lapack::potrf_batch returned error for %lld problems\n",
+                 llong( nonzero ) );
+    }
+
+    std::vector< scalar_t > A_str = A_tst;
+    std::vector< scalar_t > A_ref = A_tst;
+    std::vector< int64_t > info_str( batch );
+
+    // pointer-array arguments; one uplo, n, lda for the whole batch
+    std::vector< lapack::Uplo > uplo_vec( 1, uplo );
+    std::vector< int64_t > n_vec( 1, n ), lda_vec( 1, lda );
+    std::vector< scalar_t* > A_array( batch );
+    for (int64_t i = 0; i < batch; ++i) {
+        A_array[ i ] = &A_tst[ i*strideA ];
+    }
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "A n=%5lld, lda=%5lld, batch=%5lld\n",
+                llong( n ), llong( lda ), llong( batch ) );
+    }
+    if (verbose >= 2) {
+        printf( "A_factor[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        using lapack::Uplo;
+        std::vector< Uplo > uplo_bad( 1, Uplo(0) );
+        std::vector< int64_t > neg( 1, -1 ), lda_bad( 1, n-1 );
+        assert_throw( lapack::potri_batch( uplo_bad, n_vec, A_array, lda_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::potri_batch( uplo_vec, neg,   A_array, lda_vec, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::potri_batch( uplo_vec, n_vec, A_array, lda_bad, batch, info_tst ), lapack::Error );
+        assert_throw( lapack::potri_batch( uplo, n, &A_str[0], lda, strideA-1, 2, &info_str[0] ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::potri_batch( uplo_vec, n_vec, A_array, lda_vec, batch, info_tst );
+    time = testsweeper::get_wtime() - time;
+
+    params.time() = time;
+    double gflop = batch * lapack::Gflop< scalar_t >::potri( n );
+    params.gflops() = gflop / time;
+
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    lapack::potri_batch( uplo, n, &A_str[0], lda, strideA, batch, &info_str[0] );
+    time = testsweeper::get_wtime() - time;
+
+    params.time2() = time;
+    params.gflops2() = gflop / time;
+
+    int64_t nonzero_inv = 0;
+    for (int64_t i = 0; i < batch; ++i) {
+        if (info_tst[ i ] != 0 || info_str[ i ] != 0)
+            ++nonzero_inv;
+    }
+    if (nonzero_inv > 0) {
+        fprintf( stderr, "lapack::potri_batch returned error for %lld problems\n",
+                 llong( nonzero_inv ) );
+    }
+    nonzero += nonzero_inv;
+
+    if (verbose >= 2) {
+        printf( "A_inv[0] = " ); print_matrix( n, n, &A_tst[0], lda );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        for (int64_t i = 0; i < batch; ++i) {
+            int64_t info_i = lapack::potri( uplo, n, &A_ref[ i*strideA ], lda );
+            if (info_i != 0)
+                ++nonzero;
+        }
+        time = testsweeper::get_wtime() - time;
+
+        params.ref_time() = time;
+        params.ref_gflops() = gflop / time;
+
+        // ---------- check error compared to reference
+        // Problems are independent, so each must match the single routine.
+        real_t error = 0, error2 = 0;
+        if (n > 0) {
+            error  = rel_error( A_tst, A_ref );
+            error2 = rel_error( A_str, A_ref );
+        }
+        params.error() = error;
+        params.error2() = error2;
+        params.okay() = (error < tol) && (error2 < tol) && (nonzero == 0);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_potri_batch( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_potri_batch_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_potri_batch_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_potri_batch_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_potri_batch_work< std::complex<double> >( params, run );
+            break;
+    }
+}
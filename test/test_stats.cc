@@ -0,0 +1,178 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Checks the statistics collected with use_instrumentation, using heevd,
+// which allocates work, rwork (complex only), and iwork, then calls
+// heevd_work_size and heevd_work:
+// - calls are counted per routine, summed over threads;
+// - nested heevd_work_size and heevd_work calls are attributed to heevd,
+//   but count as their own routines when called directly;
+// - compute time is positive, and bytes allocated and peak workspace
+//   match the workspace sizes;
+// - reset_stats clears everything.
+// Without use_instrumentation, stats() must stay empty.
+template< typename scalar_t >
+void test_stats_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using lapack::Job;
+    using lapack::Uplo;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t lda = blas::max( 1, n );
+    std::vector< scalar_t > A( lda * n ), Z;
+    std::vector< real_t > W( lda );
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A.size(), A.data() );
+
+    // For real, heevd is an alias for syevd.
+    char prefix = blas::is_complex< scalar_t >::value
+                ? (sizeof(real_t) == sizeof(float) ? 'c' : 'z')
+                : (sizeof(real_t) == sizeof(float) ? 's' : 'd');
+    std::string routine = prefix + std::string(
+        blas::is_complex< scalar_t >::value ? "heevd" : "syevd" );
+
+    auto run_heevd = [&]() {
+        Z = A;
+        lapack::heevd( Job::Vec, Uplo::Lower, n, Z.data(), lda, W.data() );
+    };
+
+    bool okay = true;
+    auto require = [&]( bool cond, std::string const& msg ) {
+        if (! cond) {
+            fprintf( stderr, "stats: %s\n", msg.c_str() );
+            okay = false;
+        }
+    };
+
+    // Bytes heevd allocates per call.
+    int64_t lwork, lrwork, liwork;
+    lapack::heevd_work_size( Job::Vec, Uplo::Lower, n, A.data(), lda,
+                             W.data(), &lwork, &lrwork, &liwork );
+    int64_t bytes = lwork  * sizeof(scalar_t)
+                  + lrwork * sizeof(real_t)
+                  + liwork * sizeof(lapack_int);
+
+    // ---------- run test
+    double time = testsweeper::get_wtime();
+    lapack::reset_stats();
+    require( lapack::stats().empty(), "stats not empty after reset" );
+
+    int ncalls = 3;
+    for (int i = 0; i < ncalls; ++i) {
+        run_heevd();
+    }
+
+    // calls on other threads are summed
+    int nthreads = 4;
+    std::vector< std::thread > threads;
+    std::vector< std::vector< scalar_t > > Zt( nthreads, A );
+    std::vector< std::vector< real_t > > Wt( nthreads, W );
+    for (int t = 0; t < nthreads; ++t) {
+        threads.push_back( std::thread( [&, t]() {
+            lapack::heevd( Job::Vec, Uplo::Lower, n, Zt[ t ].data(), lda,
+                           Wt[ t ].data() );
+        } ) );
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ncalls += nthreads;
+
+    #ifdef LAPACK_HAVE_INSTRUMENTATION
+        auto stats = lapack::stats();
+        auto const& r = stats[ routine ];
+        require( r.calls == ncalls, routine + " calls "
+                 + std::to_string( r.calls ) + ", expected "
+                 + std::to_string( ncalls ) );
+        require( n == 0 || r.compute_time > 0,
+                 routine + " compute time not positive" );
+        require( r.query_time >= 0 && r.alloc_time >= 0,
+                 routine + " query or alloc time negative" );
+        require( r.bytes_allocated == ncalls * bytes,
+                 routine + " bytes allocated "
+                 + std::to_string( r.bytes_allocated ) + ", expected "
+                 + std::to_string( ncalls * bytes ) );
+        require( r.peak_workspace == bytes,
+                 routine + " peak workspace "
+                 + std::to_string( r.peak_workspace ) + ", expected "
+                 + std::to_string( bytes ) );
+
+        // nested calls are not counted separately
+        require( stats.count( routine + "_work_size" ) == 0
+                 && stats.count( routine + "_work" ) == 0,
+                 "nested calls counted separately" );
+        require( stats.size() == 1, "unexpected routines counted" );
+
+        // direct calls are counted as their own routines
+        std::vector< scalar_t > work( lwork );
+        std::vector< real_t > rwork( lrwork );
+        std::vector< lapack_int > iwork( liwork );
+        Z = A;
+        lapack::heevd_work_size( Job::Vec, Uplo::Lower, n, Z.data(), lda,
+                                 W.data(), &lwork, &lrwork, &liwork );
+        lapack::heevd_work( Job::Vec, Uplo::Lower, n, Z.data(), lda, W.data(),
+                            work.data(), lwork, rwork.data(), lrwork,
+                            iwork.data(), liwork );
+        stats = lapack::stats();
+        require( stats[ routine + "_work_size" ].calls == 1
+                 && stats[ routine + "_work" ].calls == 1
+                 && stats[ routine ].calls == ncalls,
+                 "direct calls not counted" );
+        require( stats[ routine + "_work" ].bytes_allocated == 0,
+                 "_work counted bytes it did not allocate" );
+    #else
+        params.msg() = "no use_instrumentation";
+        require( lapack::stats().empty(), "stats not empty" );
+    #endif
+
+    lapack::reset_stats();
+    require( lapack::stats().empty(), "stats not empty after reset" );
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    params.okay() = okay;
+}
+
+// -----------------------------------------------------------------------------
+void test_stats( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_stats_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_stats_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_stats_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_stats_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -10,6 +10,7 @@
 #include "error.hh"
 #include "lapacke_wrappers.hh"
 
+#include <algorithm>
 #include <vector>
 #include <ctgmath>
 
@@ -216,3 +217,243 @@ void test_sturm( Params& params, bool run )
             break;
     }
 }
+
+// -----------------------------------------------------------------------------
+// Times lapack::sturm_multi (time) for batch shifts spread evenly over
+// the Gershgorin interval of the Kahan matrix, including the shifts just
+// below and above each eigenvalue tested by test_sturm. The reference is
+// a loop calling lapack::sturm (ref_time); error is the number of shifts
+// whose counts differ.
+template< typename scalar_t >
+void test_sturm_multi_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t nshifts = params.batch();
+    int64_t verbose = params.verbose();
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run) {
+        return;
+    }
+
+    // ---------- setup
+    std::vector< scalar_t > diag( (size_t) n );
+    std::vector< scalar_t > eigv( (size_t) n );
+    std::vector< scalar_t > offd( (size_t) std::max< int64_t >( 0, n-1 ) );
+    real_t real_max=std::numeric_limits< real_t >::max();
+
+    real_t one_norm = 0, my_ulp = 0;
+    if (n >= 2) {
+        test_sturm_Kahan(n, diag, offd, eigv, &one_norm);
+        my_ulp = (real_t(2.))*(nextafter(one_norm, real_max) - one_norm);
+    }
+
+    std::vector< scalar_t > shifts( (size_t) nshifts );
+    for (int64_t j = 0; j < nshifts; ++j) {
+        shifts[ j ] = -one_norm + 2*one_norm*j / std::max< int64_t >( 1, nshifts-1 );
+    }
+    // replace the first few shifts with those tested by test_sturm
+    if (n >= 2) {
+        scalar_t tested[] = {
+            eigv[ 0 ]   - my_ulp, eigv[ 0 ]   + my_ulp,
+            eigv[ n/2 ] - my_ulp, eigv[ n/2 ] + my_ulp,
+            eigv[ n-1 ] - my_ulp, eigv[ n-1 ] + my_ulp,
+        };
+        for (int64_t j = 0; j < std::min< int64_t >( 6, nshifts ); ++j)
+            shifts[ j ] = tested[ j ];
+    }
+
+    std::vector< int64_t > counts_tst( (size_t) nshifts );
+    std::vector< int64_t > counts_ref( (size_t) nshifts );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "n=%5lld, nshifts=%5lld, one-norm=%.16e\n",
+                llong( n ), llong( nshifts ), one_norm );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::sturm_multi( -1, diag.data(), offd.data(), nshifts, shifts.data(), counts_tst.data() ), lapack::Error );
+        assert_throw( lapack::sturm_multi(  n, diag.data(), offd.data(), -1,      shifts.data(), counts_tst.data() ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    lapack::sturm_multi( n, diag.data(), offd.data(), nshifts, shifts.data(),
+                         counts_tst.data() );
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    // ---------- run reference
+    testsweeper::flush_cache( params.cache() );
+    time = testsweeper::get_wtime();
+    for (int64_t j = 0; j < nshifts; ++j) {
+        counts_ref[ j ] = lapack::sturm( n, diag.data(), offd.data(), shifts[ j ] );
+    }
+    time = testsweeper::get_wtime() - time;
+    params.ref_time() = time;
+
+    // ---------- check error
+    int64_t error = 0;
+    for (int64_t j = 0; j < nshifts; ++j) {
+        if (counts_tst[ j ] != counts_ref[ j ]) {
+            ++error;
+            if (verbose >= 2) {
+                printf( "shift %lld = %.16e: sturm_multi %lld, sturm %lld\n",
+                        llong( j ), shifts[ j ],
+                        llong( counts_tst[ j ] ), llong( counts_ref[ j ] ) );
+            }
+        }
+    }
+    params.error() = error;
+    params.okay() = (error == 0);
+}
+
+// -----------------------------------------------------------------------------
+void test_sturm_multi( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_sturm_multi_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_sturm_multi_work< double >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unsupported datatype" );
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Times lapack::tridiag_bisect (time) on a random tridiagonal matrix,
+// compared to lapack::stevx (ref_time) with the same range.
+template< typename scalar_t >
+void test_tridiag_bisect_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // Constants
+    const real_t eps = std::numeric_limits< real_t >::epsilon();
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t verbose = params.verbose();
+    real_t tol = params.tol() * eps;
+
+    real_t  vl;  // = params.vl();
+    real_t  vu;  // = params.vu();
+    int64_t il;  // = params.il();
+    int64_t iu;  // = params.iu();
+    lapack::Range range;  // derived from vl,vu,il,iu
+    params.get_range( n, &range, &vl, &vu, &il, &iu );
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t idist = 2;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    int64_t nfound_tst, nfound_ref;
+    std::vector< scalar_t > D( n );
+    std::vector< scalar_t > E( std::max< int64_t >( 0, n-1 ) );
+    std::vector< scalar_t > D_ref( n );
+    std::vector< scalar_t > E_ref( n );
+    std::vector< scalar_t > Lambda_tst( n );
+    std::vector< scalar_t > Lambda_ref( n );
+    std::vector< scalar_t > Z( 1 );
+    std::vector< int64_t > ifail( n );
+
+    lapack::larnv( idist, iseed, D.size(), D.data() );
+    lapack::larnv( idist, iseed, E.size(), E.data() );
+    std::copy( D.begin(), D.end(), D_ref.begin() );
+    std::copy( E.begin(), E.end(), E_ref.begin() );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "n=%5lld, range %s\n",
+                llong( n ), lapack::range2str( range ) );
+    }
+
+    // test error exits
+    if (params.error_exit() == 'y') {
+        assert_throw( lapack::tridiag_bisect( -1, D.data(), E.data(), lapack::Range::All, vl, vu, il, iu, Lambda_tst.data() ), lapack::Error );
+        assert_throw( lapack::tridiag_bisect(  n, D.data(), E.data(), lapack::Range::Value, real_t( 1 ), real_t( 0 ), il, iu, Lambda_tst.data() ), lapack::Error );
+        assert_throw( lapack::tridiag_bisect(  n, D.data(), E.data(), lapack::Range::Index, vl, vu, 0, iu, Lambda_tst.data() ), lapack::Error );
+    }
+
+    // ---------- run test
+    testsweeper::flush_cache( params.cache() );
+    double time = testsweeper::get_wtime();
+    nfound_tst = lapack::tridiag_bisect( n, D.data(), E.data(), range,
+                                         vl, vu, il, iu, Lambda_tst.data() );
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    if (verbose >= 2) {
+        printf( "nfound = %lld\n", llong( nfound_tst ) );
+        printf( "Lambda = " );
+        print_vector( nfound_tst, &Lambda_tst[0], 1 );
+    }
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        testsweeper::flush_cache( params.cache() );
+        time = testsweeper::get_wtime();
+        int64_t info_ref = lapack::stevx(
+                               lapack::Job::NoVec, range, n,
+                               D_ref.data(), E_ref.data(), vl, vu, il, iu,
+                               real_t( 0 ), &nfound_ref, Lambda_ref.data(),
+                               Z.data(), 1, ifail.data() );
+        time = testsweeper::get_wtime() - time;
+        if (info_ref != 0) {
+            fprintf( stderr, "lapack::stevx returned error %lld\n", llong( info_ref ) );
+        }
+        params.ref_time() = time;
+
+        if (verbose >= 2) {
+            printf( "Lambda_ref = " );
+            print_vector( nfound_ref, &Lambda_ref[0], 1 );
+        }
+
+        // ---------- check error compared to reference
+        Lambda_tst.resize( nfound_tst );
+        Lambda_ref.resize( nfound_ref );
+        real_t error = 0;
+        if (nfound_tst > 0 || nfound_ref > 0)
+            error = rel_error( Lambda_tst, Lambda_ref );
+        error += std::abs( nfound_tst - nfound_ref );
+        params.error() = error;
+        params.okay() = (error < tol);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_tridiag_bisect( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Single:
+            test_tridiag_bisect_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_tridiag_bisect_work< double >( params, run );
+            break;
+
+        default:
+            throw std::runtime_error( "unsupported datatype" );
+            break;
+    }
+}
@@ -0,0 +1,210 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Events collected by the trace callbacks.
+struct TraceLog
+{
+    std::mutex mutex;
+    std::vector< lapack::TraceEvent > begins, ends;
+
+    static void begin( lapack::TraceEvent const& event, void* data )
+    {
+        auto log = static_cast< TraceLog* >( data );
+        std::lock_guard< std::mutex > guard( log->mutex );
+        log->begins.push_back( event );
+    }
+
+    static void end( lapack::TraceEvent const& event, void* data )
+    {
+        auto log = static_cast< TraceLog* >( data );
+        std::lock_guard< std::mutex > guard( log->mutex );
+        log->ends.push_back( event );
+    }
+};
+
+// -----------------------------------------------------------------------------
+// Returns true if event is for routine with precision and dimensions m, n, k.
+static bool trace_matches(
+    lapack::TraceEvent const& event, std::string const& routine,
+    char precision, int64_t m, int64_t n, int64_t k )
+{
+    bool okay = (event.routine == routine
+                 && event.precision == precision
+                 && event.m == m && event.n == n && event.k == k
+                 && event.end >= event.start);
+    if (! okay) {
+        fprintf( stderr, "trace event %s, %c, m %lld, n %lld, k %lld;"
+                 " expected %s, %c, m %lld, n %lld, k %lld\n",
+                 event.routine, event.precision,
+                 llong( event.m ), llong( event.n ), llong( event.k ),
+                 routine.c_str(), precision,
+                 llong( m ), llong( n ), llong( k ) );
+    }
+    return okay;
+}
+
+// -----------------------------------------------------------------------------
+// Checks the trace callbacks and Chrome trace writer. Calls getrf, ptsv,
+// whose complex versions take a real D, and, for double and complex<double>,
+// the mixed precision gesv. Each must be traced once with the routine name,
+// precision, and dimensions of scalar_t; the trace file must name each
+// routine, with Gflop/s for getrf and gesv. Requires LAPACK++ built with
+// use_instrumentation.
+template< typename scalar_t >
+void test_trace_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    char precision = blas::is_complex< scalar_t >::value
+                   ? (sizeof( real_t ) == sizeof( float ) ? 'c' : 'z')
+                   : (sizeof( real_t ) == sizeof( float ) ? 's' : 'd');
+    std::string prefix( 1, precision );
+    bool mixed = (precision == 'd' || precision == 'z');
+    std::string mixed_name = (precision == 'd' ? "dsgesv" : "zcgesv");
+
+    // at least 1 element, so &x[0] is valid for n = 0
+    int64_t lda = blas::max( 1, n );
+    std::vector< scalar_t > A_gen( lda * lda );
+    std::vector< scalar_t > B_gen( lda * blas::max( 1, nrhs ) );
+    std::vector< real_t > D_gen( lda );
+    std::vector< scalar_t > E_gen( lda );
+    std::vector< scalar_t > X( B_gen.size() );
+    std::vector< int64_t > ipiv( lda );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A_gen.size(), &A_gen[0] );
+    lapack::larnv( idist, iseed, B_gen.size(), &B_gen[0] );
+    lapack::larnv( idist, iseed, D_gen.size(), &D_gen[0] );
+    lapack::larnv( idist, iseed, E_gen.size(), &E_gen[0] );
+    // diagonally dominant
+    for (int64_t i = 0; i < n; ++i) {
+        A_gen[ i + i*lda ] += n;
+        D_gen[ i ] += n;
+    }
+
+    // Calls the traced routines on copies of the generated data;
+    // no other LAPACK++ routines may be called while tracing.
+    auto run_routines = [&]() {
+        std::vector< scalar_t > A = A_gen, B = B_gen, E = E_gen;
+        std::vector< real_t > D = D_gen;
+        lapack::getrf( n, n, &A[0], lda, &ipiv[0] );
+        lapack::ptsv( n, nrhs, &D[0], &E[0], &B[0], lda );
+        if constexpr (std::is_same< real_t, double >::value) {
+            A = A_gen;
+            int64_t iter;
+            lapack::gesv( n, nrhs, &A[0], lda, &ipiv[0], &B_gen[0], lda,
+                          &X[0], lda, &iter );
+        }
+    };
+
+    // ---------- run test with callbacks
+    TraceLog log;
+    try {
+        lapack::set_trace_callbacks( &TraceLog::begin, &TraceLog::end, &log );
+    }
+    catch (lapack::Error const&) {
+        params.msg() = "skipping: requires use_instrumentation";
+        return;
+    }
+    run_routines();
+    lapack::set_trace_callbacks( nullptr, nullptr );
+
+    size_t ncalls = mixed ? 3 : 2;
+    bool okay = (log.begins.size() == ncalls && log.ends.size() == ncalls);
+    if (okay) {
+        okay = trace_matches( log.ends[ 0 ], prefix + "getrf", precision, n, n, 0 )
+            && trace_matches( log.ends[ 1 ], prefix + "ptsv",  precision, 0, n, nrhs )
+            && (! mixed
+                || trace_matches( log.ends[ 2 ], mixed_name, precision, 0, n, nrhs ));
+    }
+    else {
+        fprintf( stderr, "%lld begin and %lld end events; expected %lld\n",
+                 llong( log.begins.size() ), llong( log.ends.size() ),
+                 llong( ncalls ) );
+    }
+
+    // ---------- run test with trace file
+    std::string filename = "trace_" + prefix + ".json";
+    lapack::start_trace( filename );
+    run_routines();
+    lapack::stop_trace();
+
+    std::ifstream file( filename );
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    std::string trace = buffer.str();
+    std::remove( filename.c_str() );
+
+    // each event is one line; check its name and Gflop/s
+    auto find_event = [&]( std::string const& routine, bool gflops ) {
+        std::string name = "{\"name\": \"" + routine + "\"";
+        size_t pos = trace.find( name );
+        if (pos == std::string::npos) {
+            fprintf( stderr, "trace file is missing %s\n", routine.c_str() );
+            return false;
+        }
+        std::string line = trace.substr( pos, trace.find( '\n', pos ) - pos );
+        if (gflops && n > 0 && line.find( "\"gflop/s\"" ) == std::string::npos) {
+            fprintf( stderr, "trace file is missing Gflop/s for %s\n",
+                     routine.c_str() );
+            return false;
+        }
+        return true;
+    };
+    okay = okay
+        && find_event( prefix + "getrf", true )
+        && find_event( prefix + "ptsv",  false )
+        && (! mixed || find_event( mixed_name, true ));
+
+    params.okay() = okay;
+}
+
+// -----------------------------------------------------------------------------
+void test_trace( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_trace_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_trace_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_trace_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_trace_work< std::complex<double> >( params, run );
+            break;
+    }
+}
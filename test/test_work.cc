@@ -0,0 +1,674 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+#include "error.hh"
+
+#include <cmath>
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Outputs of the routines called by test_work_work, for either the _work
+// variants or the allocating routines.
+template< typename scalar_t >
+struct WorkOutputs
+{
+    using real_t = blas::real_type< scalar_t >;
+
+    // general matrices
+    std::vector< scalar_t > QR, tau, QC, QQ, LS, XLS;
+    std::vector< scalar_t > SV, U, VT, DC, UD, VTD;
+    std::vector< scalar_t > EV, VR, LU, SC, VS;
+    std::vector< scalar_t > GA, GB, beta, VSL, VSR, GEA, GEB, betaE, VRE;
+    std::vector< std::complex< real_t > > W, WS, alpha, alphaE;
+    std::vector< real_t > S, SD;
+
+    // Hermitian matrices
+    std::vector< scalar_t > HE, HED, HR, ZR, SY, HF, SYS, XS, HS, XH;
+    std::vector< scalar_t > AFS, XSX, AFH, XHX;
+    std::vector< real_t > WH, WHD, WHR;
+    std::vector< real_t > rcond, ferr, berr;
+    std::vector< int64_t > ipiv, isuppz;
+
+    std::vector< int64_t > info, sdim, nfound;
+};
+
+// -----------------------------------------------------------------------------
+// Checks that the _work variants, which take workspace from the caller,
+// give the same results as the allocating routines: geqrf, unmqr, ungqr,
+// gels, gesvd, gesdd, geev, heev, heevd, heevr, getri, sytrf, hetrf, sysv,
+// hesv, sysvx, hesvx, gees, gges, and ggev. Each _work variant gets its sizes from
+// _work_size and runs with a workspace allocated once for it (time);
+// the allocating routines run on the same inputs (ref_time). Both call
+// LAPACK with the same lwork, so the error, the max relative difference
+// in outputs, should be at rounding level, and the return values,
+// pivots, sdim, and nfound must be identical.
+template< typename scalar_t >
+void test_work_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+    using lapack::Factored;
+    using lapack::Job;
+    using lapack::Op;
+    using lapack::Side;
+    using lapack::Sort;
+    using lapack::Uplo;
+
+    // get & mark input values
+    int64_t n = params.dim.n();
+    int64_t nrhs = params.nrhs();
+    int64_t verbose = params.verbose();
+
+    real_t eps = std::numeric_limits< real_t >::epsilon();
+    real_t tol = params.tol() * eps;
+
+    // mark non-standard output values
+    params.ref_time();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    // at least 1 element, so data() is valid for n = 0
+    int64_t lda = blas::max( 1, n );
+    int64_t ldb = lda;
+    int64_t size_A = lda * lda;
+    int64_t size_B = ldb * blas::max( 1, nrhs );
+
+    std::vector< scalar_t > A( size_A ), H( size_A ), A2( size_A );
+    std::vector< scalar_t > B( size_B );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A.size(), A.data() );
+    lapack::larnv( idist, iseed, H.size(), H.data() );
+    lapack::larnv( idist, iseed, A2.size(), A2.data() );
+    lapack::larnv( idist, iseed, B.size(), B.data() );
+    // H = (H + H^H)/2; A and H diagonally dominant, so they are nonsingular
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i < j; ++i) {
+            scalar_t h = (H[ i + j*lda ] + conj( H[ j + i*lda ] )) / real_t( 2 );
+            H[ i + j*lda ] = h;
+            H[ j + i*lda ] = conj( h );
+        }
+        H[ j + j*lda ] = real( H[ j + j*lda ] ) + real_t( n );
+        A[ j + j*lda ] += real_t( n );
+    }
+
+    // LU factors and pivots for getri
+    std::vector< scalar_t > LU = A;
+    std::vector< int64_t > ipiv_lu( lda );
+    lapack::getrf( n, n, LU.data(), lda, ipiv_lu.data() );
+
+    if (verbose >= 1) {
+        printf( "\n"
+                "n=%5lld, nrhs=%5lld\n",
+                llong( n ), llong( nrhs ) );
+    }
+
+    // Runs each routine on fresh copies of the inputs, using either the
+    // _work variant with caller-provided workspace, or the allocating routine.
+    auto run_routines = [&]( bool use_work, WorkOutputs< scalar_t >& out ) {
+        int64_t lwork, lrwork, liwork;
+        std::vector< scalar_t > work;
+        std::vector< real_t > rwork;
+        std::vector< lapack_int > iwork, bwork( lda );
+        auto alloc = [&]() {
+            work.resize( lwork );
+            rwork.resize( lrwork );
+            iwork.resize( liwork );
+        };
+        int64_t info, sdim;
+        lwork = lrwork = liwork = 0;
+
+        // ----- QR factorization, multiply by Q^H, and least squares
+        out.QR = A;
+        out.tau.resize( lda );
+        if (use_work) {
+            lapack::geqrf_work_size( n, n, out.QR.data(), lda, out.tau.data(),
+                                     &lwork );
+            alloc();
+            info = lapack::geqrf_work( n, n, out.QR.data(), lda, out.tau.data(),
+                                       work.data(), lwork );
+        }
+        else {
+            info = lapack::geqrf( n, n, out.QR.data(), lda, out.tau.data() );
+        }
+        out.info.push_back( info );
+
+        out.QC = B;
+        if (use_work) {
+            lapack::unmqr_work_size( Side::Left, Op::ConjTrans, n, nrhs, n,
+                                     out.QR.data(), lda, out.tau.data(),
+                                     out.QC.data(), ldb, &lwork );
+            alloc();
+            info = lapack::unmqr_work( Side::Left, Op::ConjTrans, n, nrhs, n,
+                                       out.QR.data(), lda, out.tau.data(),
+                                       out.QC.data(), ldb,
+                                       work.data(), lwork );
+        }
+        else {
+            info = lapack::unmqr( Side::Left, Op::ConjTrans, n, nrhs, n,
+                                  out.QR.data(), lda, out.tau.data(),
+                                  out.QC.data(), ldb );
+        }
+        out.info.push_back( info );
+
+        out.QQ = out.QR;
+        if (use_work) {
+            lapack::ungqr_work_size( n, n, n, out.QQ.data(), lda, out.tau.data(),
+                                     &lwork );
+            alloc();
+            info = lapack::ungqr_work( n, n, n, out.QQ.data(), lda, out.tau.data(),
+                                       work.data(), lwork );
+        }
+        else {
+            info = lapack::ungqr( n, n, n, out.QQ.data(), lda, out.tau.data() );
+        }
+        out.info.push_back( info );
+
+        out.LS = A;
+        out.XLS = B;
+        if (use_work) {
+            lapack::gels_work_size( Op::NoTrans, n, n, nrhs,
+                                    out.LS.data(), lda, out.XLS.data(), ldb,
+                                    &lwork );
+            alloc();
+            info = lapack::gels_work( Op::NoTrans, n, n, nrhs,
+                                      out.LS.data(), lda, out.XLS.data(), ldb,
+                                      work.data(), lwork );
+        }
+        else {
+            info = lapack::gels( Op::NoTrans, n, n, nrhs,
+                                 out.LS.data(), lda, out.XLS.data(), ldb );
+        }
+        out.info.push_back( info );
+
+        // ----- SVD
+        out.SV = A;
+        out.S.resize( lda );
+        out.U.resize( size_A );
+        out.VT.resize( size_A );
+        if (use_work) {
+            lapack::gesvd_work_size( Job::SomeVec, Job::SomeVec, n, n,
+                                     out.SV.data(), lda, out.S.data(),
+                                     out.U.data(), lda, out.VT.data(), lda,
+                                     &lwork, &lrwork );
+            alloc();
+            info = lapack::gesvd_work( Job::SomeVec, Job::SomeVec, n, n,
+                                       out.SV.data(), lda, out.S.data(),
+                                       out.U.data(), lda, out.VT.data(), lda,
+                                       work.data(), lwork,
+                                       rwork.data(), lrwork );
+        }
+        else {
+            info = lapack::gesvd( Job::SomeVec, Job::SomeVec, n, n,
+                                  out.SV.data(), lda, out.S.data(),
+                                  out.U.data(), lda, out.VT.data(), lda );
+        }
+        out.info.push_back( info );
+
+        out.DC = A;
+        out.SD.resize( lda );
+        out.UD.resize( size_A );
+        out.VTD.resize( size_A );
+        if (use_work) {
+            lapack::gesdd_work_size( Job::SomeVec, n, n,
+                                     out.DC.data(), lda, out.SD.data(),
+                                     out.UD.data(), lda, out.VTD.data(), lda,
+                                     &lwork, &lrwork, &liwork );
+            alloc();
+            info = lapack::gesdd_work( Job::SomeVec, n, n,
+                                       out.DC.data(), lda, out.SD.data(),
+                                       out.UD.data(), lda, out.VTD.data(), lda,
+                                       work.data(), lwork,
+                                       rwork.data(), lrwork,
+                                       iwork.data(), liwork );
+        }
+        else {
+            info = lapack::gesdd( Job::SomeVec, n, n,
+                                  out.DC.data(), lda, out.SD.data(),
+                                  out.UD.data(), lda, out.VTD.data(), lda );
+        }
+        out.info.push_back( info );
+
+        // ----- non-symmetric eigenvalues and Schur factorization
+        out.EV = A;
+        out.W.resize( lda );
+        out.VR.resize( size_A );
+        if (use_work) {
+            lapack::geev_work_size( Job::NoVec, Job::Vec, n,
+                                    out.EV.data(), lda, out.W.data(),
+                                    nullptr, 1, out.VR.data(), lda,
+                                    &lwork, &lrwork );
+            alloc();
+            info = lapack::geev_work( Job::NoVec, Job::Vec, n,
+                                      out.EV.data(), lda, out.W.data(),
+                                      nullptr, 1, out.VR.data(), lda,
+                                      work.data(), lwork,
+                                      rwork.data(), lrwork );
+        }
+        else {
+            info = lapack::geev( Job::NoVec, Job::Vec, n,
+                                 out.EV.data(), lda, out.W.data(),
+                                 nullptr, 1, out.VR.data(), lda );
+        }
+        out.info.push_back( info );
+
+        out.SC = A;
+        out.WS.resize( lda );
+        out.VS.resize( size_A );
+        if (use_work) {
+            lapack::gees_work_size( Job::Vec, Sort::NotSorted, nullptr, n,
+                                    out.SC.data(), lda, &sdim, out.WS.data(),
+                                    out.VS.data(), lda,
+                                    &lwork, &lrwork );
+            alloc();
+            info = lapack::gees_work( Job::Vec, Sort::NotSorted, nullptr, n,
+                                      out.SC.data(), lda, &sdim, out.WS.data(),
+                                      out.VS.data(), lda,
+                                      work.data(), lwork,
+                                      rwork.data(), lrwork,
+                                      bwork.data() );
+        }
+        else {
+            info = lapack::gees( Job::Vec, Sort::NotSorted, nullptr, n,
+                                 out.SC.data(), lda, &sdim, out.WS.data(),
+                                 out.VS.data(), lda );
+        }
+        out.info.push_back( info );
+        out.sdim.push_back( sdim );
+
+        out.GA = A;
+        out.GB = A2;
+        out.alpha.resize( lda );
+        out.beta.resize( lda );
+        out.VSL.resize( size_A );
+        out.VSR.resize( size_A );
+        if (use_work) {
+            lapack::gges_work_size( Job::Vec, Job::Vec, Sort::NotSorted, nullptr, n,
+                                    out.GA.data(), lda, out.GB.data(), lda,
+                                    &sdim, out.alpha.data(), out.beta.data(),
+                                    out.VSL.data(), lda, out.VSR.data(), lda,
+                                    &lwork, &lrwork );
+            alloc();
+            info = lapack::gges_work( Job::Vec, Job::Vec, Sort::NotSorted, nullptr, n,
+                                      out.GA.data(), lda, out.GB.data(), lda,
+                                      &sdim, out.alpha.data(), out.beta.data(),
+                                      out.VSL.data(), lda, out.VSR.data(), lda,
+                                      work.data(), lwork,
+                                      rwork.data(), lrwork,
+                                      bwork.data() );
+        }
+        else {
+            info = lapack::gges( Job::Vec, Job::Vec, Sort::NotSorted, nullptr, n,
+                                 out.GA.data(), lda, out.GB.data(), lda,
+                                 &sdim, out.alpha.data(), out.beta.data(),
+                                 out.VSL.data(), lda, out.VSR.data(), lda );
+        }
+        out.info.push_back( info );
+        out.sdim.push_back( sdim );
+
+        out.GEA = A;
+        out.GEB = A2;
+        out.alphaE.resize( lda );
+        out.betaE.resize( lda );
+        out.VRE.resize( size_A );
+        if (use_work) {
+            lapack::ggev_work_size( Job::NoVec, Job::Vec, n,
+                                    out.GEA.data(), lda, out.GEB.data(), lda,
+                                    out.alphaE.data(), out.betaE.data(),
+                                    nullptr, 1, out.VRE.data(), lda,
+                                    &lwork, &lrwork );
+            alloc();
+            info = lapack::ggev_work( Job::NoVec, Job::Vec, n,
+                                      out.GEA.data(), lda, out.GEB.data(), lda,
+                                      out.alphaE.data(), out.betaE.data(),
+                                      nullptr, 1, out.VRE.data(), lda,
+                                      work.data(), lwork,
+                                      rwork.data(), lrwork );
+        }
+        else {
+            info = lapack::ggev( Job::NoVec, Job::Vec, n,
+                                 out.GEA.data(), lda, out.GEB.data(), lda,
+                                 out.alphaE.data(), out.betaE.data(),
+                                 nullptr, 1, out.VRE.data(), lda );
+        }
+        out.info.push_back( info );
+
+        // ----- inverse
+        out.LU = LU;
+        if (use_work) {
+            lapack::getri_work_size( n, out.LU.data(), lda, ipiv_lu.data(),
+                                     &lwork );
+            alloc();
+            info = lapack::getri_work( n, out.LU.data(), lda, ipiv_lu.data(),
+                                       work.data(), lwork );
+        }
+        else {
+            info = lapack::getri( n, out.LU.data(), lda, ipiv_lu.data() );
+        }
+        out.info.push_back( info );
+
+        // ----- Hermitian eigenvalues
+        out.HE = H;
+        out.WH.resize( lda );
+        if (use_work) {
+            lapack::heev_work_size( Job::Vec, Uplo::Lower, n,
+                                    out.HE.data(), lda, out.WH.data(),
+                                    &lwork, &lrwork );
+            alloc();
+            info = lapack::heev_work( Job::Vec, Uplo::Lower, n,
+                                      out.HE.data(), lda, out.WH.data(),
+                                      work.data(), lwork,
+                                      rwork.data(), lrwork );
+        }
+        else {
+            info = lapack::heev( Job::Vec, Uplo::Lower, n,
+                                 out.HE.data(), lda, out.WH.data() );
+        }
+        out.info.push_back( info );
+
+        out.HED = H;
+        out.WHD.resize( lda );
+        if (use_work) {
+            lapack::heevd_work_size( Job::Vec, Uplo::Lower, n,
+                                     out.HED.data(), lda, out.WHD.data(),
+                                     &lwork, &lrwork, &liwork );
+            alloc();
+            info = lapack::heevd_work( Job::Vec, Uplo::Lower, n,
+                                       out.HED.data(), lda, out.WHD.data(),
+                                       work.data(), lwork,
+                                       rwork.data(), lrwork,
+                                       iwork.data(), liwork );
+        }
+        else {
+            info = lapack::heevd( Job::Vec, Uplo::Lower, n,
+                                  out.HED.data(), lda, out.WHD.data() );
+        }
+        out.info.push_back( info );
+
+        out.HR = H;
+        out.WHR.resize( lda );
+        out.ZR.resize( size_A );
+        out.isuppz.resize( 2*lda );
+        int64_t nfound;
+        if (use_work) {
+            lapack::heevr_work_size( Job::Vec, lapack::Range::All, Uplo::Lower, n,
+                                     out.HR.data(), lda, 0, 0, 0, 0, 0, &nfound,
+                                     out.WHR.data(), out.ZR.data(), lda,
+                                     out.isuppz.data(),
+                                     &lwork, &lrwork, &liwork );
+            alloc();
+            info = lapack::heevr_work( Job::Vec, lapack::Range::All, Uplo::Lower, n,
+                                       out.HR.data(), lda, 0, 0, 0, 0, 0, &nfound,
+                                       out.WHR.data(), out.ZR.data(), lda,
+                                       out.isuppz.data(),
+                                       work.data(), lwork,
+                                       rwork.data(), lrwork,
+                                       iwork.data(), liwork );
+        }
+        else {
+            info = lapack::heevr( Job::Vec, lapack::Range::All, Uplo::Lower, n,
+                                  out.HR.data(), lda, 0, 0, 0, 0, 0, &nfound,
+                                  out.WHR.data(), out.ZR.data(), lda,
+                                  out.isuppz.data() );
+        }
+        out.info.push_back( info );
+        out.nfound.push_back( nfound );
+
+        // ----- symmetric and Hermitian indefinite factorizations and solves
+        // For real types, H is symmetric and the he routines are aliases.
+        std::vector< int64_t > ipiv( lda );
+        out.ipiv.clear();
+
+        out.SY = H;
+        if (use_work) {
+            lapack::sytrf_work_size( Uplo::Lower, n, out.SY.data(), lda,
+                                     ipiv.data(), &lwork );
+            alloc();
+            info = lapack::sytrf_work( Uplo::Lower, n, out.SY.data(), lda,
+                                       ipiv.data(), work.data(), lwork );
+        }
+        else {
+            info = lapack::sytrf( Uplo::Lower, n, out.SY.data(), lda,
+                                  ipiv.data() );
+        }
+        out.info.push_back( info );
+        out.ipiv.insert( out.ipiv.end(), ipiv.begin(), ipiv.end() );
+
+        out.HF = H;
+        if (use_work) {
+            lapack::hetrf_work_size( Uplo::Upper, n, out.HF.data(), lda,
+                                     ipiv.data(), &lwork );
+            alloc();
+            info = lapack::hetrf_work( Uplo::Upper, n, out.HF.data(), lda,
+                                       ipiv.data(), work.data(), lwork );
+        }
+        else {
+            info = lapack::hetrf( Uplo::Upper, n, out.HF.data(), lda,
+                                  ipiv.data() );
+        }
+        out.info.push_back( info );
+        out.ipiv.insert( out.ipiv.end(), ipiv.begin(), ipiv.end() );
+
+        out.SYS = H;
+        out.XS = B;
+        if (use_work) {
+            lapack::sysv_work_size( Uplo::Lower, n, nrhs, out.SYS.data(), lda,
+                                    ipiv.data(), out.XS.data(), ldb, &lwork );
+            alloc();
+            info = lapack::sysv_work( Uplo::Lower, n, nrhs, out.SYS.data(), lda,
+                                      ipiv.data(), out.XS.data(), ldb,
+                                      work.data(), lwork );
+        }
+        else {
+            info = lapack::sysv( Uplo::Lower, n, nrhs, out.SYS.data(), lda,
+                                 ipiv.data(), out.XS.data(), ldb );
+        }
+        out.info.push_back( info );
+        out.ipiv.insert( out.ipiv.end(), ipiv.begin(), ipiv.end() );
+
+        out.HS = H;
+        out.XH = B;
+        if (use_work) {
+            lapack::hesv_work_size( Uplo::Upper, n, nrhs, out.HS.data(), lda,
+                                    ipiv.data(), out.XH.data(), ldb, &lwork );
+            alloc();
+            info = lapack::hesv_work( Uplo::Upper, n, nrhs, out.HS.data(), lda,
+                                      ipiv.data(), out.XH.data(), ldb,
+                                      work.data(), lwork );
+        }
+        else {
+            info = lapack::hesv( Uplo::Upper, n, nrhs, out.HS.data(), lda,
+                                 ipiv.data(), out.XH.data(), ldb );
+        }
+        out.info.push_back( info );
+        out.ipiv.insert( out.ipiv.end(), ipiv.begin(), ipiv.end() );
+
+        real_t rcond;
+        out.rcond.clear();
+        out.ferr.resize( blas::max( 1, 2*nrhs ) );
+        out.berr.resize( blas::max( 1, 2*nrhs ) );
+
+        out.AFS.resize( size_A );
+        out.XSX.resize( size_B );
+        if (use_work) {
+            lapack::sysvx_work_size( Factored::NotFactored, Uplo::Lower, n, nrhs,
+                                     H.data(), lda, out.AFS.data(), lda,
+                                     ipiv.data(), B.data(), ldb,
+                                     out.XSX.data(), ldb, &rcond,
+                                     out.ferr.data(), out.berr.data(),
+                                     &lwork, &lrwork, &liwork );
+            alloc();
+            info = lapack::sysvx_work( Factored::NotFactored, Uplo::Lower, n, nrhs,
+                                       H.data(), lda, out.AFS.data(), lda,
+                                       ipiv.data(), B.data(), ldb,
+                                       out.XSX.data(), ldb, &rcond,
+                                       out.ferr.data(), out.berr.data(),
+                                       work.data(), lwork,
+                                       rwork.data(), lrwork,
+                                       iwork.data(), liwork );
+        }
+        else {
+            info = lapack::sysvx( Factored::NotFactored, Uplo::Lower, n, nrhs,
+                                  H.data(), lda, out.AFS.data(), lda,
+                                  ipiv.data(), B.data(), ldb,
+                                  out.XSX.data(), ldb, &rcond,
+                                  out.ferr.data(), out.berr.data() );
+        }
+        out.info.push_back( info );
+        out.ipiv.insert( out.ipiv.end(), ipiv.begin(), ipiv.end() );
+        out.rcond.push_back( rcond );
+
+        out.AFH.resize( size_A );
+        out.XHX.resize( size_B );
+        if (use_work) {
+            lapack::hesvx_work_size( Factored::NotFactored, Uplo::Upper, n, nrhs,
+                                     H.data(), lda, out.AFH.data(), lda,
+                                     ipiv.data(), B.data(), ldb,
+                                     out.XHX.data(), ldb, &rcond,
+                                     out.ferr.data() + nrhs, out.berr.data() + nrhs,
+                                     &lwork, &lrwork, &liwork );
+            alloc();
+            info = lapack::hesvx_work( Factored::NotFactored, Uplo::Upper, n, nrhs,
+                                       H.data(), lda, out.AFH.data(), lda,
+                                       ipiv.data(), B.data(), ldb,
+                                       out.XHX.data(), ldb, &rcond,
+                                       out.ferr.data() + nrhs, out.berr.data() + nrhs,
+                                       work.data(), lwork,
+                                       rwork.data(), lrwork,
+                                       iwork.data(), liwork );
+        }
+        else {
+            info = lapack::hesvx( Factored::NotFactored, Uplo::Upper, n, nrhs,
+                                  H.data(), lda, out.AFH.data(), lda,
+                                  ipiv.data(), B.data(), ldb,
+                                  out.XHX.data(), ldb, &rcond,
+                                  out.ferr.data() + nrhs, out.berr.data() + nrhs );
+        }
+        out.info.push_back( info );
+        out.ipiv.insert( out.ipiv.end(), ipiv.begin(), ipiv.end() );
+        out.rcond.push_back( rcond );
+    };
+
+    // ---------- run test
+    WorkOutputs< scalar_t > tst, ref;
+    double time = testsweeper::get_wtime();
+    run_routines( true, tst );
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    if (params.ref() == 'y' || params.check() == 'y') {
+        // ---------- run reference
+        time = testsweeper::get_wtime();
+        run_routines( false, ref );
+        time = testsweeper::get_wtime() - time;
+        params.ref_time() = time;
+
+        // ---------- check error compared to reference
+        // Relative error, or absolute error if the reference is zero,
+        // e.g., tau for n = 1, or if n = 0.
+        real_t error = 0;
+        auto check = [&]( auto& x, auto& xref ) {
+            real_t err = rel_error( x, xref );
+            if (std::isnan( err ))
+                err = abs_error( x, xref );
+            error = blas::max( error, err );
+        };
+        check( tst.QR,    ref.QR    );
+        check( tst.tau,   ref.tau   );
+        check( tst.QC,    ref.QC    );
+        check( tst.QQ,    ref.QQ    );
+        check( tst.LS,    ref.LS    );
+        check( tst.XLS,   ref.XLS   );
+        check( tst.SV,    ref.SV    );
+        check( tst.S,     ref.S     );
+        check( tst.U,     ref.U     );
+        check( tst.VT,    ref.VT    );
+        check( tst.DC,    ref.DC    );
+        check( tst.SD,    ref.SD    );
+        check( tst.UD,    ref.UD    );
+        check( tst.VTD,   ref.VTD   );
+        check( tst.EV,    ref.EV    );
+        check( tst.W,     ref.W     );
+        check( tst.VR,    ref.VR    );
+        check( tst.SC,    ref.SC    );
+        check( tst.WS,    ref.WS    );
+        check( tst.VS,    ref.VS    );
+        check( tst.GA,    ref.GA    );
+        check( tst.GB,    ref.GB    );
+        check( tst.alpha, ref.alpha );
+        check( tst.beta,  ref.beta  );
+        check( tst.VSL,   ref.VSL   );
+        check( tst.VSR,   ref.VSR   );
+        check( tst.GEA,   ref.GEA   );
+        check( tst.GEB,   ref.GEB   );
+        check( tst.alphaE, ref.alphaE );
+        check( tst.betaE, ref.betaE );
+        check( tst.VRE,   ref.VRE   );
+        check( tst.LU,    ref.LU    );
+        check( tst.HE,    ref.HE    );
+        check( tst.WH,    ref.WH    );
+        check( tst.HED,   ref.HED   );
+        check( tst.WHD,   ref.WHD   );
+        check( tst.WHR,   ref.WHR   );
+        check( tst.ZR,    ref.ZR    );
+        check( tst.SY,    ref.SY    );
+        check( tst.HF,    ref.HF    );
+        check( tst.SYS,   ref.SYS   );
+        check( tst.XS,    ref.XS    );
+        check( tst.HS,    ref.HS    );
+        check( tst.XH,    ref.XH    );
+        check( tst.AFS,   ref.AFS   );
+        check( tst.XSX,   ref.XSX   );
+        check( tst.AFH,   ref.AFH   );
+        check( tst.XHX,   ref.XHX   );
+        check( tst.rcond, ref.rcond );
+        check( tst.ferr,  ref.ferr  );
+        check( tst.berr,  ref.berr  );
+
+        bool same = (tst.info == ref.info
+                     && tst.sdim == ref.sdim
+                     && tst.nfound == ref.nfound
+                     && tst.ipiv == ref.ipiv
+                     && tst.isuppz == ref.isuppz);
+        if (! same) {
+            fprintf( stderr, "_work return values, pivots, sdim, or nfound differ"
+                     " from allocating routines\n" );
+        }
+        params.error() = error;
+        params.okay() = (error < tol && same);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void test_work( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_work_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_work_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_work_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_work_work< std::complex<double> >( params, run );
+            break;
+    }
+}
@@ -0,0 +1,173 @@
+// Copyright (c) 2017-2023, University of Tennessee. All rights reserved.
+// SPDX-License-Identifier: BSD-3-Clause
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the BSD 3-Clause license. See the accompanying LICENSE file.
+
+#include "test.hh"
+#include "lapack.hh"
+
+#include <vector>
+
+// -----------------------------------------------------------------------------
+// Checks the workspace size cache with heevd and gesdd:
+// - the first query with given arguments misses and the next ones hit,
+//   including the query made by the allocating routine;
+// - changing jobz or a leading dimension misses;
+// - with the cache disabled, the counters do not change;
+// - in all cases, the sizes equal those queried with the cache disabled.
+template< typename scalar_t >
+void test_work_size_cache_work( Params& params, bool run )
+{
+    using real_t = blas::real_type< scalar_t >;
+    using blas::conj;
+    using blas::real;
+    using lapack::Job;
+    using lapack::Uplo;
+
+    // get & mark input values
+    int64_t m = params.dim.m();
+    int64_t n = params.dim.n();
+
+    if (! run)
+        return;
+
+    // ---------- setup
+    int64_t minmn = blas::min( m, n );
+    int64_t lda = blas::max( 1, m, n );
+    std::vector< scalar_t > A( (lda + 1) * blas::max( 1, n ) );
+    std::vector< scalar_t > U( (lda + 1) * blas::max( 1, minmn ) );
+    std::vector< scalar_t > VT( (lda + 1) * blas::max( 1, n ) );
+    std::vector< real_t > W( lda ), S( lda );
+
+    int64_t idist = 1;
+    int64_t iseed[4] = { 0, 1, 2, 3 };
+    lapack::larnv( idist, iseed, A.size(), A.data() );
+
+    struct Sizes
+    {
+        int64_t lwork, lrwork, liwork;
+        bool operator == ( Sizes const& other ) const
+        {
+            return lwork == other.lwork && lrwork == other.lrwork
+                   && liwork == other.liwork;
+        }
+    };
+
+    // heevd with jobz and lda, and gesdd with jobz and ldu.
+    auto heevd_size = [&]( Job jobz, int64_t ld ) {
+        Sizes s;
+        lapack::heevd_work_size( jobz, Uplo::Lower, n, A.data(), ld, W.data(),
+                                 &s.lwork, &s.lrwork, &s.liwork );
+        return s;
+    };
+    auto gesdd_size = [&]( Job jobz, int64_t ldu ) {
+        Sizes s;
+        lapack::gesdd_work_size( jobz, m, n, A.data(), lda, S.data(),
+                                 U.data(), ldu, VT.data(), minmn + 1,
+                                 &s.lwork, &s.lrwork, &s.liwork );
+        return s;
+    };
+
+    bool enabled_save = lapack::get_work_size_cache();
+    bool okay = true;
+    int64_t hits = 0, misses = 0;
+    // Checks the counters, which count since the last clear, after the
+    // query that computes `same`.
+    auto require = [&]( int64_t hits_expect, int64_t misses_expect,
+                        bool same, const char* what ) {
+        lapack::work_size_cache_stats( &hits, &misses );
+        if (hits != hits_expect || misses != misses_expect || ! same) {
+            fprintf( stderr, "%s: hits %lld, misses %lld; expected"
+                     " hits %lld, misses %lld%s\n", what,
+                     llong( hits ), llong( misses ),
+                     llong( hits_expect ), llong( misses_expect ),
+                     same ? "" : "; wrong sizes" );
+            okay = false;
+        }
+    };
+
+    // ---------- reference sizes, with the cache disabled
+    lapack::set_work_size_cache( false );
+    lapack::clear_work_size_cache();
+    Sizes heevd_vec    = heevd_size( Job::Vec,   lda );
+    Sizes heevd_novec  = heevd_size( Job::NoVec, lda );
+    Sizes heevd_ld     = heevd_size( Job::Vec,   lda + 1 );
+    Sizes gesdd_vec    = gesdd_size( Job::SomeVec, lda );
+    Sizes gesdd_novec  = gesdd_size( Job::NoVec,   lda );
+    Sizes gesdd_ld     = gesdd_size( Job::SomeVec, lda + 1 );
+    require( 0, 0, true, "disabled" );
+
+    // ---------- run test
+    double time = testsweeper::get_wtime();
+    lapack::set_work_size_cache( true );
+
+    // heevd: miss, then hits, also from the allocating routine
+    require( 0, 1, heevd_size( Job::Vec, lda ) == heevd_vec, "heevd first query" );
+    require( 1, 1, heevd_size( Job::Vec, lda ) == heevd_vec, "heevd repeat" );
+    require( 2, 1, heevd_size( Job::Vec, lda ) == heevd_vec, "heevd repeat" );
+    std::vector< scalar_t > Z( A.begin(), A.begin() + lda * n );
+    // make Z Hermitian, so heevd succeeds
+    for (int64_t j = 0; j < n; ++j) {
+        for (int64_t i = 0; i <= j; ++i) {
+            Z[ i + j*lda ] = conj( Z[ j + i*lda ] );
+        }
+        Z[ j + j*lda ] = real( Z[ j + j*lda ] );
+    }
+    lapack::heevd( Job::Vec, Uplo::Lower, n, Z.data(), lda, W.data() );
+    require( 3, 1, true, "heevd allocating routine" );
+
+    // heevd: changed jobz and lda miss
+    require( 3, 2, heevd_size( Job::NoVec, lda ) == heevd_novec, "heevd jobz" );
+    require( 3, 3, heevd_size( Job::Vec, lda + 1 ) == heevd_ld, "heevd lda" );
+    require( 4, 3, heevd_size( Job::NoVec, lda ) == heevd_novec, "heevd jobz repeat" );
+
+    // gesdd: miss, then hit; changed jobz and ldu miss
+    require( 4, 4, gesdd_size( Job::SomeVec, lda ) == gesdd_vec, "gesdd first query" );
+    require( 5, 4, gesdd_size( Job::SomeVec, lda ) == gesdd_vec, "gesdd repeat" );
+    require( 5, 5, gesdd_size( Job::NoVec, lda ) == gesdd_novec, "gesdd jobz" );
+    require( 5, 6, gesdd_size( Job::SomeVec, lda + 1 ) == gesdd_ld, "gesdd ldu" );
+
+    // disabled: counters stop, sizes are still correct
+    lapack::set_work_size_cache( false );
+    require( 5, 6, heevd_size( Job::Vec, lda ) == heevd_vec, "disabled heevd" );
+    require( 5, 6, gesdd_size( Job::NoVec, lda ) == gesdd_novec, "disabled gesdd" );
+    require( 5, 6, heevd_size( Job::Vec, lda + 2 ).lwork > 0, "disabled new lda" );
+
+    // re-enabled: entries were kept
+    lapack::set_work_size_cache( true );
+    require( 6, 6, heevd_size( Job::Vec, lda ) == heevd_vec, "re-enabled" );
+
+    time = testsweeper::get_wtime() - time;
+    params.time() = time;
+
+    lapack::set_work_size_cache( enabled_save );
+    lapack::clear_work_size_cache();
+
+    params.okay() = okay;
+}
+
+// -----------------------------------------------------------------------------
+void test_work_size_cache( Params& params, bool run )
+{
+    switch (params.datatype()) {
+        case testsweeper::DataType::Integer:
+            throw std::exception();
+            break;
+
+        case testsweeper::DataType::Single:
+            test_work_size_cache_work< float >( params, run );
+            break;
+
+        case testsweeper::DataType::Double:
+            test_work_size_cache_work< double >( params, run );
+            break;
+
+        case testsweeper::DataType::SingleComplex:
+            test_work_size_cache_work< std::complex<float> >( params, run );
+            break;
+
+        case testsweeper::DataType::DoubleComplex:
+            test_work_size_cache_work< std::complex<double> >( params, run );
+            break;
+    }
+}